@@ -654,6 +654,20 @@ gpt_params_context gpt_params_parser_init(gpt_params & params, llama_example ex,
             params.speculative.p_min = std::stof(value);
         }
     ).set_examples({LLAMA_EXAMPLE_SPECULATIVE, LLAMA_EXAMPLE_SERVER}));
+    add_opt(llama_arg(
+        {"--draft-adaptive"},
+        format("choose the draft length between --draft-min and --draft-max from the measured verification cost and acceptance rate (default: %s)", params.speculative.adaptive ? "true" : "false"),
+        [](gpt_params & params) {
+            params.speculative.adaptive = true;
+        }
+    ).set_examples({LLAMA_EXAMPLE_SERVER}).set_env("LLAMA_ARG_DRAFT_ADAPTIVE"));
+    add_opt(llama_arg(
+        {"--draft-ahead"},
+        format("keep drafting on the head device while a draft is being verified through the ring (default: %s)", params.speculative.ahead ? "true" : "false"),
+        [](gpt_params & params) {
+            params.speculative.ahead = true;
+        }
+    ).set_examples({LLAMA_EXAMPLE_SERVER}).set_env("LLAMA_ARG_DRAFT_AHEAD"));
     add_opt(llama_arg(
         {"-lcs", "--lookup-cache-static"}, "FNAME",
         "path to static lookup cache to use for lookup decoding (not updated by generation)",
@@ -704,6 +718,54 @@ gpt_params_context gpt_params_parser_init(gpt_params & params, llama_example ex,
             params.signal_port = value;
         }
     ).set_env("LLAMA_ARG_SIGNAL_PORT"));
+    add_opt(llama_arg(
+        {"--tp-port"}, "N",
+        format("port to compute the FFN rows split off by the previous device on (default: %d)", params.tp_port),
+        [](gpt_params & params, int value) {
+            params.tp_port = value;
+        }
+    ).set_env("LLAMA_ARG_TP_PORT"));
+    add_opt(llama_arg(
+        {"--fail-timeout"}, "N",
+        format("drop a device from the ring after N seconds without a heartbeat and continue without it (default: %d, 0 = disabled)", params.fail_timeout),
+        [](gpt_params & params, int value) {
+            if (value < 0) {
+                throw std::invalid_argument("fail timeout must be non-negative");
+            }
+            params.fail_timeout = value;
+        }
+    ).set_env("LLAMA_ARG_FAIL_TIMEOUT"));
+    add_opt(llama_arg(
+        {"--kv-replicate"},
+        format("send the kv cache written by each pass along to the next device, so that the layers of a failed device "
+               "are taken over without evaluating the context again, set on all devices (default: %s)", params.kv_replicate ? "true" : "false"),
+        [](gpt_params & params) {
+            params.kv_replicate = true;
+        }
+    ).set_env("LLAMA_ARG_KV_REPLICATE"));
+    add_opt(llama_arg(
+        {"--tensor-parallel"},
+        format("master: with auto scheduling, split the FFN of the CPU layers of a device with its next device when the link "
+               "between them is fast enough to cut the latency of a token, the next device maps the rows it computes "
+               "from its own model file (default: %s)", params.tensor_parallel ? "true" : "false"),
+        [](gpt_params & params) {
+            params.tensor_parallel = true;
+        }
+    ).set_env("LLAMA_ARG_TENSOR_PARALLEL"));
+    add_opt(llama_arg(
+        {"--accept-join"},
+        format("master: take in devices that ask to join with --join while running (default: %s)", params.accept_join ? "true" : "false"),
+        [](gpt_params & params) {
+            params.accept_join = true;
+        }
+    ).set_env("LLAMA_ARG_ACCEPT_JOIN"));
+    add_opt(llama_arg(
+        {"--join"},
+        "join the running ring of the master at --master, listening on the ports of --rank (default: false)",
+        [](gpt_params & params) {
+            params.join = true;
+        }
+    ).set_env("LLAMA_ARG_JOIN"));
     add_opt(llama_arg(
         {"-lw", "--layer-window", "--n-layer-window"}, "N",
         format("number of layers to process in each compute (e.g., 16,16)"),
@@ -776,6 +838,36 @@ gpt_params_context gpt_params_parser_init(gpt_params & params, llama_example ex,
             params.n_cycles = value;
         }
     ).set_env("LLAMA_ARG_K"));
+    add_opt(llama_arg(
+        {"--rebalance-interval"}, "N",
+        format("re-solve the layer windows from the latency measured on each device every N tokens and move layers\n"
+               "between devices if it pays off, requires automatic scheduling (default: %d, 0 = disabled)", params.rebalance_interval),
+        [](gpt_params & params, int value) {
+            params.rebalance_interval = value;
+        }
+    ).set_env("LLAMA_ARG_REBALANCE_INTERVAL"));
+    add_opt(llama_arg(
+        {"--profile-cache"}, "FNAME",
+        "file to cache the device profile in, so that a restart skips the disk, memory and flops benchmarks\n"
+        "(default: <cache dir>/device-profiles.bin)",
+        [](gpt_params & params, const std::string & value) {
+            params.profile_cache_path = value;
+        }
+    ).set_env("LLAMA_ARG_PROFILE_CACHE"));
+    add_opt(llama_arg(
+        {"--no-profile-cache"},
+        "always profile this device and do not read or write the profile cache",
+        [](gpt_params & params) {
+            params.profile_cache = false;
+        }
+    ).set_env("LLAMA_ARG_NO_PROFILE_CACHE"));
+    add_opt(llama_arg(
+        {"--profile-refresh"},
+        "discard the cached profile of this device, measure it again and update the cache",
+        [](gpt_params & params) {
+            params.profile_refresh = true;
+        }
+    ).set_env("LLAMA_ARG_PROFILE_REFRESH"));
     add_opt(llama_arg(
         {"--force"},
         format("force to start prefetching after computation (default: %s)", params.force ? "true" : "false"),
@@ -783,6 +875,31 @@ gpt_params_context gpt_params_parser_init(gpt_params & params, llama_example ex,
             params.force = true;
         }
     ).set_env("LLAMA_ARG_FORCE"));
+    add_opt(llama_arg(
+        {"--release"}, "{off,advise,force}",
+        "release the pages of a computed layer window when the next one would not fit in available memory (default: off)\n"
+        "advise: unmap the pages from this process, they stay in the page cache; force: also evict them from the page cache",
+        [](gpt_params & params, const std::string & value) {
+            /**/ if (value == "off")    { params.release_policy = LLAMA_RELEASE_POLICY_OFF;    }
+            else if (value == "advise") { params.release_policy = LLAMA_RELEASE_POLICY_ADVISE; }
+            else if (value == "force")  { params.release_policy = LLAMA_RELEASE_POLICY_FORCE;  }
+            else { throw std::invalid_argument("invalid value"); }
+        }
+    ).set_env("LLAMA_ARG_RELEASE"));
+    add_opt(llama_arg(
+        {"--async-comm"},
+        format("send and receive activations on dedicated threads, overlapped with compute (default: %s)", params.async_comm ? "true" : "false"),
+        [](gpt_params & params) {
+            params.async_comm = true;
+        }
+    ).set_env("LLAMA_ARG_ASYNC_COMM"));
+    add_opt(llama_arg(
+        {"--residency-stats"},
+        format("sample how much of each layer window is resident when its compute starts, on with --metrics (default: %s)", params.residency_stats ? "true" : "false"),
+        [](gpt_params & params) {
+            params.residency_stats = true;
+        }
+    ).set_env("LLAMA_ARG_RESIDENCY_STATS"));
     add_opt(llama_arg(
         {"--master-priority"}, "N",
         format("priority to assign workload to the master (default: %f, set 1.01 to use master first, and 0.99 to offload to other devices)", params.master_priority),
@@ -790,6 +907,16 @@ gpt_params_context gpt_params_parser_init(gpt_params & params, llama_example ex,
             params.master_priority = std::stof(value);
         }
     ).set_env("LLAMA_ARG_MASTER_PRIORITY"));
+    add_opt(llama_arg(
+        {"-ct", "--comm-type"}, "TYPE",
+        format("data type of activations sent to the next device, one of f32, f16, bf16, q8_0 (default: %s)", params.comm_type.c_str()),
+        [](gpt_params & params, const std::string & value) {
+            if (value != "f32" && value != "f16" && value != "bf16" && value != "q8_0") {
+                throw std::invalid_argument("invalid value for --comm-type");
+            }
+            params.comm_type = value;
+        }
+    ).set_env("LLAMA_ARG_COMM_TYPE"));
 
 // #ifdef GGML_USE_METAL
 //     // warn: if the output layer weights are not kept in metal shared memory, its mmap-ed weight data
@@ -835,6 +962,13 @@ gpt_params_context gpt_params_parser_init(gpt_params & params, llama_example ex,
             params.n_ubatch = value;
         }
     ).set_env("LLAMA_ARG_UBATCH"));
+    add_opt(llama_arg(
+        {"-mb", "--micro-batch-size"}, "N",
+        format("split prompt ubatches into micro-batches of N tokens that are pipelined through the devices (default: %d, 0 = disabled)", params.n_micro_batch),
+        [](gpt_params & params, int value) {
+            params.n_micro_batch = value;
+        }
+    ).set_env("LLAMA_ARG_MICRO_BATCH"));
     add_opt(llama_arg(
         {"--keep"}, "N",
         format("number of tokens to keep from the initial prompt (default: %d, -1 = all)", params.n_keep),
@@ -1470,7 +1604,7 @@ gpt_params_context gpt_params_parser_init(gpt_params & params, llama_example ex,
     ).set_examples({LLAMA_EXAMPLE_PERPLEXITY}));
     add_opt(llama_arg(
         {"-dt", "--defrag-thold"}, "N",
-        format("KV cache defragmentation threshold (default: %.1f, < 0 - disabled)", (double)params.defrag_thold),
+        format("KV cache defragmentation threshold, no effect on the paged KV cache (default: %.1f, < 0 - disabled)", (double)params.defrag_thold),
         [](gpt_params & params, const std::string & value) {
             params.defrag_thold = std::stof(value);
         }
@@ -1533,6 +1667,22 @@ gpt_params_context gpt_params_parser_init(gpt_params & params, llama_example ex,
             params.use_mlock = true;
         }
     ).set_env("LLAMA_ARG_MLOCK"));
+    add_opt(llama_arg(
+        {"--stream-weights"},
+        "read the layer windows kept on CPU from disk into two staging buffers, overlapping the read of the next window "
+        "with the compute of the current one, instead of relying on mmap page faults",
+        [](gpt_params & params) {
+            params.stream_weights = true;
+        }
+    ).set_env("LLAMA_ARG_STREAM_WEIGHTS"));
+    add_opt(llama_arg(
+        {"--repack"},
+        "repack Q4_K/Q6_K weights of the layers kept on CPU into 4-row interleaved blocks at load time, "
+        "for faster CPU matrix multiplications (needs --no-mmap)",
+        [](gpt_params & params) {
+            params.repack = true;
+        }
+    ).set_env("LLAMA_ARG_REPACK"));
     add_opt(llama_arg(
         {"--no-mmap"},
         "do not memory-map model (slower load but may reduce pageouts if not using mlock)",
@@ -21,6 +21,7 @@
 #include <fstream>
 #include <iostream>
 #include <iterator>
+#include <numeric>
 #include <regex>
 #include <sstream>
 #include <string>
@@ -857,16 +858,37 @@ static backend_type get_backend_type(const gpu_support & support) {
     return BACKEND_CPU;
 }
 
+// time device dev takes to compute one layer on its CPU, from the flops of a layer profiled on the master
+static float device_cpu_layer_ms(const device_info & master, const device_info & dev) {
+    return (
+        master.model_flops.layer_f32_f32   / (dev.cpu_props.flops_f32_f32   * 1e9 + EPS) +
+        master.model_flops.layer_f16_f32   / (dev.cpu_props.flops_f16_f32   * 1e9 + EPS) +
+        master.model_flops.layer_q2k_f32   / (dev.cpu_props.flops_q2k_f32   * 1e9 + EPS) +
+        master.model_flops.layer_q4k_f32   / (dev.cpu_props.flops_q4k_f32   * 1e9 + EPS) +
+        master.model_flops.layer_q5k_f32   / (dev.cpu_props.flops_q5k_f32   * 1e9 + EPS) +
+        master.model_flops.layer_q6k_f32   / (dev.cpu_props.flops_q6k_f32   * 1e9 + EPS) +
+        master.model_flops.layer_iq2xxs_f32/ (dev.cpu_props.flops_iq2xxs_f32* 1e9 + EPS) +
+        master.model_flops.layer_q50_f32   / (dev.cpu_props.flops_q50_f32   * 1e9 + EPS) +
+        master.model_flops.layer_q80_f32   / (dev.cpu_props.flops_q80_f32   * 1e9 + EPS) +
+        master.model_flops.layer_iq1s_f32  / (dev.cpu_props.flops_iq1s_f32  * 1e9 + EPS) +
+        master.model_flops.layer_iq4nl_f32 / (dev.cpu_props.flops_iq4nl_f32 * 1e9 + EPS) +
+        master.model_flops.layer_iq1m_f32  / (dev.cpu_props.flops_iq1m_f32  * 1e9 + EPS) ) * 1000; // in ms
+}
+
 static bool assign_layers_to_device(
                                 uint32_t   n_world,
                        const device_info * dev_info_set, 
                                 uint32_t * n_layer_window, 
+                                uint32_t * n_layer_extra, 
                                 uint32_t * n_gpu_layers,
                       struct llama_model * model,
        const struct llama_context_params   cparams,
-                                   float   min_disk_read_speed = 0.1f) { // minimum disk I/O speed: 100 MB/s
+                                    bool * link_bound          = nullptr,
+                                   float   min_disk_read_speed = 0.1f,     // minimum disk I/O speed: 100 MB/s
+                 const llama_rank_perf * measured            = nullptr) { // per-rank cost measured while decoding
     GGML_ASSERT(dev_info_set != nullptr);
     GGML_ASSERT(n_layer_window != nullptr);
+    GGML_ASSERT(n_layer_extra  != nullptr);
 
     const uint32_t n_layer = llama_model_n_layers(model);
     std::vector<int>   w(n_world, 0);
@@ -884,7 +906,43 @@ static bool assign_layers_to_device(
 
     const int64_t b        = dev_info_set[0].model_bytes.nb_layer;
     const int64_t bo       = dev_info_set[0].model_bytes.nb_output;
-    const int64_t b_prime  = b + 2 * (n_embd_k_gqa + n_embd_v_gqa) * n_kv;
+    const int64_t nb_kv    = n_kv * (ggml_row_size(cparams.type_k, n_embd_k_gqa) + ggml_row_size(cparams.type_v, n_embd_v_gqa)); // per layer, a quantized cache is smaller
+    const int64_t b_prime  = b + nb_kv;
+
+    // the layers of a hybrid quantized model differ in size and which of them a device holds is only known
+    // after solving, so the memory of l layers is that of the l largest ones and a device never gets more than fits
+    std::vector<int64_t> nb_largest;
+    if (llama_model_layers_nbytes(model, 0, n_layer) >= 0) {
+        for (int il = 0; il < (int)n_layer; ++il) {
+            nb_largest.push_back(llama_model_layers_nbytes(model, il, il + 1));
+        }
+    }
+    std::sort(nb_largest.begin(), nb_largest.end(), std::greater<int64_t>());
+
+    // bytes of the weights of l layers
+    auto nb_layers_max = [&](int l) -> int64_t {
+        if (nb_largest.empty()) {
+            return l * b;
+        }
+        l = std::min(std::max(l, 0), (int)nb_largest.size());
+        return std::accumulate(nb_largest.begin(), nb_largest.begin() + l, (int64_t)0);
+    };
+
+    // number of layers whose weights and kv cache fit in mem bytes, in fractions of a layer as the solver takes it
+    auto n_layers_fit = [&](double mem) -> double {
+        if (mem <= 0.0 || nb_largest.empty()) {
+            return mem / b_prime;
+        }
+        double n_fit = 0.0;
+        for (int64_t nb : nb_largest) {
+            if (mem < nb + nb_kv) {
+                return n_fit + mem / (nb + nb_kv);
+            }
+            mem   -= nb + nb_kv;
+            n_fit += 1.0;
+        }
+        return n_fit + mem / b_prime;
+    };
 
 #if defined(USE_HIGHS) 
     const device_info &master = dev_info_set[0];
@@ -897,25 +955,16 @@ static bool assign_layers_to_device(
     std::vector<float> xi(n_world, 0.0f);
     float kappa = 0.0f;
 
+    // bytes of the activations of one token sent over each link
+    const double nb_act = ggml_row_size(cparams.comm_type, llama_n_embd(model));
+
     // -------- Compute alpha[m], beta[m], xi[m] --------
     for (uint32_t m = 0; m < n_world; ++m) {
         // alpha[m]
         const device_info & dev = dev_info_set[m];
         float t_read_ram_cpu = 0.0f;
 
-        float t_calc_cpu = (
-            master.model_flops.layer_f32_f32   / (dev.cpu_props.flops_f32_f32   * 1e9 + EPS) +
-            master.model_flops.layer_f16_f32   / (dev.cpu_props.flops_f16_f32   * 1e9 + EPS) +
-            master.model_flops.layer_q2k_f32   / (dev.cpu_props.flops_q2k_f32   * 1e9 + EPS) +
-            master.model_flops.layer_q4k_f32   / (dev.cpu_props.flops_q4k_f32   * 1e9 + EPS) +
-            master.model_flops.layer_q5k_f32   / (dev.cpu_props.flops_q5k_f32   * 1e9 + EPS) +
-            master.model_flops.layer_q6k_f32   / (dev.cpu_props.flops_q6k_f32   * 1e9 + EPS) +
-            master.model_flops.layer_iq2xxs_f32/ (dev.cpu_props.flops_iq2xxs_f32* 1e9 + EPS) +
-            master.model_flops.layer_q50_f32   / (dev.cpu_props.flops_q50_f32   * 1e9 + EPS) +
-            master.model_flops.layer_q80_f32   / (dev.cpu_props.flops_q80_f32   * 1e9 + EPS) +
-            master.model_flops.layer_iq1s_f32  / (dev.cpu_props.flops_iq1s_f32  * 1e9 + EPS) +
-            master.model_flops.layer_iq4nl_f32 / (dev.cpu_props.flops_iq4nl_f32 * 1e9 + EPS) +
-            master.model_flops.layer_iq1m_f32  / (dev.cpu_props.flops_iq1m_f32  * 1e9 + EPS) ) * 1000; // in ms
+        float t_calc_cpu = device_cpu_layer_ms(master, dev); // in ms
 
         float t_kv_cpy_cpu = dev.memory.mem_cpy_delay; // in ms
         // t_read_ram_cpu = b_prime / (dev.memory.cpu_read_ram_bw * 1e9) * 1000; // in ms
@@ -967,12 +1016,41 @@ static bool assign_layers_to_device(
         }
         
         // xi[m]
-        // the ram-vram and vram-ram transfer time and the communication time are less than 1 ms
+        // the ram-vram and vram-ram transfer time is less than 1 ms, but the link that brings the activations 
+        // of one token to device m is paid once per cycle and can be much slower on Wi-Fi
         xi[m] = 0.0;
+        if (dev.net.link_bw > 0.0f) {
+            xi[m] = dev.net.link_latency + nb_act / (dev.net.link_bw * 1e6) * 1000; // in ms
+        }
+    }
+
+    // when the ranks have been decoding for a while, calibrate alpha[m] and beta[m] against the measured 
+    // latency per layer, which includes the page faults and throttling the synthetic profile cannot see.
+    // xi[m] keeps the profiled link, the sender only times the encoding and enqueueing of the activations
+    if (measured != nullptr) {
+        for (uint32_t m = 0; m < n_world; ++m) {
+            const llama_rank_perf & perf = measured[m];
+            if (perf.n_layers == 0 || perf.n_evals == 0) {
+                continue;
+            }
+
+            const double t_layer_meas = (perf.t_compute_ms + perf.t_prefetch_ms) / perf.n_evals / perf.n_layers; // in ms
+            const double t_layer_pred = alpha[m] + beta[m] * perf.n_gpu_layers / perf.n_layers;                 // in ms
+            if (t_layer_pred > EPS) {
+                const double scale = t_layer_meas / t_layer_pred;
+                alpha[m] *= scale;
+                beta[m]  *= scale;
+            }
+
+            LOG_INF("Device %u measured: %.3f ms/layer (profiled %.3f ms/layer), %" PRId64 " major faults\n",
+                m, t_layer_meas, t_layer_pred, perf.n_major_faults);
+        }
     }
 
     // we adopt an iterative optimization approach. Initially, $w_m$ is set proportionally 
     // based on the available memory budget and $n_m$ is initialized to 0. 
+    // $w_m$ and $n_m$ count the layers of device m over all cycles, and those of them on its GPU, 
+    // so that the number of cycles k does not have to divide L
     for (uint32_t m = 0; m < n_world; ++m) {
         const device_info & dev = dev_info_set[m];
         GGML_ASSERT(dev.device_os != nullptr);
@@ -1011,7 +1089,7 @@ static bool assign_layers_to_device(
             }
         }
     }
-    // adjust w[m] to ensure L mod W = 0
+    // adjust w[m] so that the layers add up to L
     int diff = n_layer - std::accumulate(w.begin(), w.end(), 0);
     auto device = (diff > 0) ? std::max_element(mem_budget.begin(), mem_budget.end()) 
                              : std::min_element(mem_budget.begin(), mem_budget.end());
@@ -1039,19 +1117,15 @@ static bool assign_layers_to_device(
         }
     }
 
-    // helper function to find valid factors for a given n_layers
-    auto find_factors = [&](int n_layers) {
-        std::vector<int> factors;
-        for (int k = 1; k <= n_layers / 2; ++k) {
-            if (n_layers % k == 0) {
-                factors.push_back(k);
-            }
+    // any k works as long as every device keeps at least one layer in each cycle
+    std::vector<int> valid_k;
+    if (cparams.n_cycles > 0) {
+        valid_k.push_back(cparams.n_cycles);
+    } else {
+        for (int k = 1; k <= (int)(n_layer / n_world); ++k) {
+            valid_k.push_back(k);
         }
-        return factors;
-    };
-
-    // get valid factors
-    std::vector<int> valid_k = cparams.n_cycles > 0 ? std::vector<int>{static_cast<int>(cparams.n_cycles)} : find_factors(n_layer);
+    }
 
     // assign devices to sets M1, M2, M3, and M4
     // M1: devices running on macOS without Metal, and with insufficient memory
@@ -1067,7 +1141,7 @@ static bool assign_layers_to_device(
         return (std::find(M.begin(), M.end(), m) != M.end());
     };
 
-    auto assign_sets = [&](int k) -> bool {
+    auto assign_sets = [&]() -> bool {
         M1.clear(), M2.clear(), M3.clear(), M4.clear();
 
         for (uint32_t m = 0; m < n_world; ++m) {
@@ -1082,11 +1156,11 @@ static bool assign_layers_to_device(
 
             llama_model_compute_buf_size(&c_cpu[m], &c_gpu[m], model, cparams, get_backend_type(dev.gpu_support), m, dev_info_set[0].model_bytes, w[m] > n[m], n[m] > 0);
 
-            int  l_m          = w[m] * k;  // total number of layers assigned to device m
-            int  l_m_gpu      = n[m] * k;  // number of layers assigned to device m that run on GPU
-            bool condition1   = l_m * b + (bi / n_vocab + bo) * int(m == 0) + 2 * (n_embd_k_gqa + n_embd_v_gqa) * n_kv * l_m + c_cpu[m] > mem_budget[m] * GIGABYTE;
-            bool condition2   = l_m * b + (bi / n_vocab + bo) * int(m == 0) + 2 * (n_embd_k_gqa + n_embd_v_gqa) * n_kv * l_m + c_cpu[m] + c_gpu[m] > mem_budget[m] * GIGABYTE;
-            bool condition3   = (l_m - l_m_gpu) * b_prime + (bi / n_vocab + bo) * int(m == 0) + c_cpu[m] > mem_budget[m] * GIGABYTE;
+            int  l_m          = w[m];  // total number of layers assigned to device m
+            int  l_m_gpu      = n[m];  // number of layers assigned to device m that run on GPU
+            bool condition1   = nb_layers_max(l_m) + (bi / n_vocab + bo) * int(m == 0) + nb_kv * l_m + c_cpu[m] > mem_budget[m] * GIGABYTE;
+            bool condition2   = nb_layers_max(l_m) + (bi / n_vocab + bo) * int(m == 0) + nb_kv * l_m + c_cpu[m] + c_gpu[m] > mem_budget[m] * GIGABYTE;
+            bool condition3   = nb_layers_max(l_m - l_m_gpu) + nb_kv * (l_m - l_m_gpu) + (bi / n_vocab + bo) * int(m == 0) + c_cpu[m] > mem_budget[m] * GIGABYTE;
             bool is_slow_disk = disk_speed[m] < min_disk_read_speed;
 
             if (M4_force[m] || is_slow_disk) {
@@ -1127,17 +1201,7 @@ static bool assign_layers_to_device(
 
     // iterative optimization to find a valid set assignment (M1, M2, M3, M4)
     while (true) {
-        int W = std::accumulate(w.begin(), w.end(), 0);
-        int cur_k = (int)n_layer / W;
-
-        if (W <= 1 || (int)n_layer % W != 0) {
-            LOG_INF("Constraint: L = k * W must hold, but W = %d, L = %d\n", W, n_layer);
-            fflush(stdout);
-            fflush(stderr);
-            return false;
-        }
-
-        if (!assign_sets(cur_k)) break;
+        if (!assign_sets()) break;
 
         LOG_INF("Set assignment: M1: %s, M2: %s, M3: %s, M4: %s\n", 
                 vec_to_str(M1).c_str(), vec_to_str(M2).c_str(), vec_to_str(M3).c_str(), vec_to_str(M4).c_str());
@@ -1221,26 +1285,27 @@ static bool assign_layers_to_device(
             int64_t b_cio = (bi / n_vocab + bo) * int(m == 0) + c_cpu[m];
 
             if (in_set(m, M1)) {
-                vec_z[m] = (double)(dev.memory.available_physical * GIGABYTE - b_cio) / (double)(n_layer * b_prime);
+                vec_z[m] = n_layers_fit(dev.memory.available_physical * GIGABYTE - b_cio) / n_layer;
             } else if (in_set(m, M2)) {
-                vec_z[m] = (double)(dev.gpu_props.memory_free * GIGABYTE - b_cio - c_gpu[m]) / (double)(n_layer * b_prime);
+                vec_z[m] = n_layers_fit(dev.gpu_props.memory_free * GIGABYTE - b_cio - c_gpu[m]) / n_layer;
             } else if (in_set(m, M3)) {
-                vec_z[m] = (double)(dev.memory.available_physical * GIGABYTE + dev.memory.used_can_swap * GIGABYTE * int(is_android) - b_cio) / (double)(n_layer * b_prime);
+                vec_z[m] = n_layers_fit(dev.memory.available_physical * GIGABYTE + dev.memory.used_can_swap * GIGABYTE * int(is_android) - b_cio) / n_layer;
             } else {
                 if (is_macos && !dev.gpu_support.metal) {
-                    vec_z[m] = - (double)(dev.memory.available_physical * GIGABYTE - b_cio) / (double)(n_layer * b_prime);
+                    vec_z[m] = - n_layers_fit(dev.memory.available_physical * GIGABYTE - b_cio) / n_layer;
                 } else if (is_macos && dev.gpu_support.metal) {
-                    vec_z[m] = - (double)(dev.gpu_props.memory_free * GIGABYTE - b_cio - c_gpu[m]) / (double)(n_layer * b_prime);
+                    vec_z[m] = - n_layers_fit(dev.gpu_props.memory_free * GIGABYTE - b_cio - c_gpu[m]) / n_layer;
                 } else {
-                    vec_z[m] = - (double)((dev.memory.available_physical + dev.memory.used_can_swap * int(is_android)) * GIGABYTE - b_cio) / (double)(n_layer * b_prime);
+                    vec_z[m] = - n_layers_fit((dev.memory.available_physical + dev.memory.used_can_swap * int(is_android)) * GIGABYTE - b_cio) / n_layer;
                 }
             }
 
             if (dev_gpu[m]) {
-                vec_z_gpu[m] = (double)(dev.gpu_props.memory_free * GIGABYTE - c_gpu[m]) / (double)(n_layer * b_prime);
+                double gpu_free = dev.gpu_props.memory_free * GIGABYTE - c_gpu[m];
                 if (dev.gpu_support.metal && m == 0 && cparams.keep_out_in_metal) {
-                    vec_z_gpu[m] -= (double)bo / (double)(n_layer * b_prime);
+                    gpu_free -= bo;
                 }
+                vec_z_gpu[m] = n_layers_fit(gpu_free) / n_layer;
                 vec_z_gpu[m] = std::max(vec_z_gpu[m], 0.0f);
             }
         }
@@ -1254,34 +1319,24 @@ static bool assign_layers_to_device(
 
         // iterate over all possible values of k to find the best solution
         for (int k : valid_k) {
-            GGML_ASSERT(n_layer % k == 0 && "Constraint: L = k * W must hold\n");
-            int W = n_layer / k;
-
             HighsModel model;
 
             // define the number of decision variables and constraints
             model.lp_.num_col_ = n_world * 2; // number of decision variables
             model.lp_.num_row_ = 1 + 3 * n_world; // number of constraints
 
-            // define the objective: k * sum(a[m] * w[m] + b[m] * n[m]) + kappa + k * sum(c[m])
+            // define the objective: sum(a[m] * w[m] + b[m] * n[m]) + kappa + k * sum(c[m])
             model.lp_.sense_  = ObjSense::kMinimize;
             model.lp_.offset_ = k * std::accumulate(vec_c.begin(), vec_c.end(), 0.0f) + kappa;
             model.lp_.col_cost_.clear();
             std::copy(vec_a.begin(), vec_a.end(), std::back_inserter(model.lp_.col_cost_));
             std::copy(vec_b.begin(), vec_b.end(), std::back_inserter(model.lp_.col_cost_));
-            std::transform(
-                model.lp_.col_cost_.begin(), 
-                model.lp_.col_cost_.end(), 
-                model.lp_.col_cost_.begin(), [k](double cost) {
-                    return cost * k;
-                }
-            );
             // apply priority to the head device
             model.lp_.col_cost_[0] *= 1.0 / cparams.master_priority;
 
-            // define the variable bounds
+            // define the variable bounds, each device keeps at least one layer in each cycle
             model.lp_.col_lower_ = std::vector<double>(n_world * 2, 0.0);
-            std::fill(model.lp_.col_lower_.begin(), model.lp_.col_lower_.begin() + n_world, 1.0);
+            std::fill(model.lp_.col_lower_.begin(), model.lp_.col_lower_.begin() + n_world, (double)k);
             model.lp_.col_upper_ = std::vector<double>(n_world * 2, n_layer);
 
             // define the constraint bounds
@@ -1289,9 +1344,9 @@ static bool assign_layers_to_device(
             model.lp_.row_lower_ = std::vector<double>(model.lp_.num_row_, -1.0e30); // initialize to a large negative value
             model.lp_.row_upper_ = std::vector<double>(model.lp_.num_row_,  1.0e30); // initialize to a large positive value
             
-            // constraint bound 1: sum(w[m]) = W
-            model.lp_.row_lower_[constraint_idx] = {(double)W}; 
-            model.lp_.row_upper_[constraint_idx] = {(double)W};
+            // constraint bound 1: sum(w[m]) = L
+            model.lp_.row_lower_[constraint_idx] = {(double)n_layer}; 
+            model.lp_.row_upper_[constraint_idx] = {(double)n_layer};
             constraint_idx++;
 
             // constraint bound 2: n[m] <= w[m], m = 1, 2, ..., n_world
@@ -1300,13 +1355,13 @@ static bool assign_layers_to_device(
 
             // constraint bound 3: RAM constraint for each device
             for (uint32_t m = 0; m < n_world; ++m) {
-                model.lp_.row_upper_[constraint_idx + m] = -W * vec_z[m];
+                model.lp_.row_upper_[constraint_idx + m] = -(double)n_layer * vec_z[m];
             }
             constraint_idx += n_world;
 
             // constraint bound 4: CUDA/shared memory constraint for CUDA/Metal devices
             for (uint32_t m = 0; m < n_world; ++m) {
-                double upper_bound = W * vec_z_gpu[m];
+                double upper_bound = n_layer * vec_z_gpu[m];
                 model.lp_.row_upper_[constraint_idx] = std::max(upper_bound, 0.0);
                 constraint_idx++;
             }
@@ -1317,7 +1372,7 @@ static bool assign_layers_to_device(
             std::vector<std::vector<double>> A(n_rows, std::vector<double>(n_cols, 0.0));
             constraint_idx = 0;
 
-            // constraint coefficients 1: sum(w[m]) = W
+            // constraint coefficients 1: sum(w[m]) = L
             std::fill_n(A[constraint_idx].begin(), n_world, 1.0);
             constraint_idx++;
 
@@ -1448,18 +1503,30 @@ static bool assign_layers_to_device(
             // if (!dev_gpu[m]) continue;
             uint32_t w_m = best_solution[m], n_m = best_solution[m + n_world];
 
-            if (w_m == 1 && n_m == 0) {
-                // if the device is weak
+            if ((int)w_m <= best_k && n_m == 0) {
+                // if the device is weak, it only holds a single layer in each cycle
                 has_weak_device = true;
                 LOG_INF("Device %d is weak, need to be removed: w_m = %d, n_m = %d\n", m, w_m, n_m);
             }
 
+            const float t_window = (vec_a[m] * w_m + vec_b[m] * n_m) / best_k; // compute time of one window
+            bool is_link_bound = m > 0 && xi[m] > t_window;
+            if (link_bound != nullptr) link_bound[m] = is_link_bound;
+
+            if (is_link_bound) {
+                // if the device spends more time waiting for its link than computing its window, 
+                // the ring is faster without it
+                has_weak_device = true;
+                LOG_INF("Device %d is link-bound, need to be removed: link = %.2f ms, compute = %.2f ms\n", 
+                    m, xi[m], t_window);
+            }
+
             if (dev_gpu[m]) {
-                if (n_m < static_cast<uint32_t>(std::floor(W * vec_z_gpu[m]))) {
+                if (n_m < static_cast<uint32_t>(std::floor(n_layer * vec_z_gpu[m]))) {
                     // if there is still free GPU memory
                     has_free_gpu_memory = true;
-                    LOG_INF("Device %d still has free GPU memory: w_m = %d, n_m = %d, W * vec_z_gpu[m]) = %d\n", 
-                        m, w_m, n_m, static_cast<uint32_t>(std::floor(W * vec_z_gpu[m])));
+                    LOG_INF("Device %d still has free GPU memory: w_m = %d, n_m = %d, L * vec_z_gpu[m]) = %d\n", 
+                        m, w_m, n_m, static_cast<uint32_t>(std::floor(n_layer * vec_z_gpu[m])));
                 }
                 if (w_m > n_m) {
                     // if layers are offloaded to CPU
@@ -1512,24 +1579,28 @@ static bool assign_layers_to_device(
     LOG_INF("\n----- Allocation Strategy (by HiGHS) -----\n");
     LOG_INF("\nParameters:\n");
     LOG_INF("  - k = %d\n", final_k);
-    LOG_INF("  - W = %d\n", n_layer / final_k);
     for (uint32_t m = 0; m < n_world; ++m) {
+        // split the layers of device m evenly over the k cycles, the first w[m] % k windows take one more.
+        // its GPU layers are spread over the windows the same way when the model is loaded
+        n_layer_window[m] = w[m] / final_k;
+        n_layer_extra[m]  = w[m] % final_k;
+        n_gpu_layers[m]   = std::min(n[m], w[m]);
+
         const char * device_name = dev_info_set[m].device_name;
         GGML_ASSERT(final_solution[m] == w[m] && final_solution[m + n_world] == n[m]);
         LOG_INF("\n%s:\n", device_name);
         LOG_INF("  - Device Index   : %d\n", m);
         LOG_INF("  - Assignment Set : %s\n", in_set(m, M1) ? "M1" : in_set(m, M2) ? "M2" : in_set(m, M3) ? "M3" : "M4");
-        LOG_INF("  - N Layer Window : %d\n", w[m]);
-        LOG_INF("  - N GPU Layers   : %d\n", n[m]);
+        LOG_INF("  - N Layers       : %d\n", w[m]);
+        LOG_INF("  - N Layer Window : %d (+1 in the first %d cycles)\n", n_layer_window[m], n_layer_extra[m]);
+        LOG_INF("  - N GPU Layers   : %d\n", n_gpu_layers[m]);
     }
     LOG_INF("\n");
 
-    // copy value from w and n to n_layer_window and n_gpu_layers, respectively
-    std::copy(w.begin(), w.end(), n_layer_window);
-    std::copy(n.begin(), n.end(), n_gpu_layers);
-
 #else
+    (void)link_bound;
     (void)min_disk_read_speed;
+    (void)measured;
 
     // assign layers according to RAM/VRAM
     for (uint32_t m = 0; m < n_world; ++m) {
@@ -1557,13 +1628,14 @@ static bool assign_layers_to_device(
             }
         }
     }
-    // adjust w[m] to ensure L mod W = 0
+    // adjust w[m] so that the layers add up to L in a single cycle
     int diff = n_layer - std::accumulate(w.begin(), w.end(), 0);
     auto device = (diff > 0) ? std::max_element(mem_budget.begin(), mem_budget.end()) 
                             : std::min_element(mem_budget.begin(), mem_budget.end());
     w[std::distance(mem_budget.begin(), device)] += diff;
 
     std::copy(w.begin(), w.end(), n_layer_window);
+    std::fill_n(n_layer_extra, n_world, 0u);
 
     std::vector<float> vec_z_gpu(n_world, 0.0f);
     std::vector<int64_t> c_cpu(n_world, 0), c_gpu(n_world, 0); 
@@ -1573,7 +1645,7 @@ static bool assign_layers_to_device(
         llama_model_compute_buf_size(&c_cpu[m], &c_gpu[m], model, cparams, get_backend_type(dev.gpu_support), m, dev_info_set[0].model_bytes, false, true);
 
         if (dev.gpu_support.cuda || dev.gpu_support.metal) {
-            int64_t required_mem = w[m] * b_prime;
+            int64_t required_mem = nb_layers_max(w[m]) + w[m] * nb_kv;
             int64_t available_mem = dev.gpu_props.memory_free * GIGABYTE - c_gpu[m];
             if (dev.gpu_support.metal && m == 0 && cparams.keep_out_in_metal) {
                 available_mem -= bo;
@@ -1582,7 +1654,7 @@ static bool assign_layers_to_device(
             if (required_mem <= available_mem) {
                 n_gpu_layers[m] = w[m];
             } else {
-                n_gpu_layers[m] = available_mem / b_prime;
+                n_gpu_layers[m] = std::max(0.0, std::floor(n_layers_fit(available_mem)));
             }
         }
     }
@@ -1596,37 +1668,43 @@ static bool assign_layers_and_select_devices(
                                 uint32_t   n_world,
                 std::vector<device_info>   dev_infos,
                                 uint32_t * n_layer_window, 
+                                uint32_t * n_layer_extra, 
                                 uint32_t * n_gpu_layers,
                       struct llama_model * model,
        const struct llama_context_params   cparams) {
     memset(n_layer_window, 0, n_world * sizeof(uint32_t));
+    memset(n_layer_extra,  0, n_world * sizeof(uint32_t));
     memset(n_gpu_layers,   0, n_world * sizeof(uint32_t));
 
     std::vector<device_info> dev_infos_temp = dev_infos;
-    std::vector<uint32_t> n_layer_windows_temp, n_gpu_layers_temp;
+    std::vector<uint32_t> n_layer_windows_temp, n_layer_extra_temp, n_gpu_layers_temp;
     
     while (n_world > 0) {
         std::vector<device_info> dev_infos_ = dev_infos_temp;
-        std::vector<uint32_t> n_layer_windows_(n_world, 0), n_gpu_layers_(n_world, 0);
+        std::vector<uint32_t> n_layer_windows_(n_world, 0), n_layer_extra_(n_world, 0), n_gpu_layers_(n_world, 0);
         
-        if (!assign_layers_to_device(n_world, dev_infos_.data(), 
-                                     n_layer_windows_.data(), n_gpu_layers_.data(), model, cparams)) {
+        bool link_bound[32] = {false};
+        if (!assign_layers_to_device(n_world, dev_infos_.data(), n_layer_windows_.data(), 
+                                     n_layer_extra_.data(), n_gpu_layers_.data(), model, cparams, link_bound)) {
             return false;
         }
 
         dev_infos_temp.clear();
         n_layer_windows_temp.clear();
+        n_layer_extra_temp.clear();
         n_gpu_layers_temp.clear();
 
         for (uint32_t i = 0; i < n_world; i++) {
-            if (n_layer_windows_[i] > 1 || i == 0 ) {
+            const bool is_weak = n_layer_windows_[i] <= 1 && n_layer_extra_[i] == 0;
+            if ((!is_weak && !link_bound[i]) || i == 0 ) {
                 dev_infos_temp.push_back(dev_infos_[i]);
                 n_layer_windows_temp.push_back(n_layer_windows_[i]);
+                n_layer_extra_temp.push_back(n_layer_extra_[i]);
                 n_gpu_layers_temp.push_back(n_gpu_layers_[i]);
             } else {
                 // remove this device
-                LOG_INF("Remove device %s (rank %d) with only %d layer assigned.\n", 
-                        dev_infos_[i].device_name, dev_infos_[i].rank, n_layer_windows_[i]);
+                LOG_INF("Remove device %s (rank %d) with %d layer(s) assigned%s.\n", 
+                        dev_infos_[i].device_name, dev_infos_[i].rank, n_layer_windows_[i], link_bound[i] ? " behind a slow link" : "");
             }
         }
 
@@ -1644,10 +1722,12 @@ static bool assign_layers_and_select_devices(
     while (j < n_world) {
         if (dev_infos[i].rank == dev_infos_temp[j].rank) {
             n_layer_window[i] = n_layer_windows_temp[j];
+            n_layer_extra[i]  = n_layer_extra_temp[j];
             n_gpu_layers[i]   = n_gpu_layers_temp[j];
             j++;
         } else {
             n_layer_window[i] = 0;
+            n_layer_extra[i]  = 0;
             n_gpu_layers[i] = 0;
         }
         i++;
@@ -1656,10 +1736,166 @@ static bool assign_layers_and_select_devices(
     return true;
 }
 
+// let a device hand the FFN rows of its CPU layers from a split point on to its next device, see llama_tp. with one
+// token in flight the next device waits for activations while this one computes, so it can take them at the cost of
+// the FFN input and partial output crossing the link between them, for every layer. the split point balances the two
+// parts, and a split is only chosen if it saves a tenth of the FFN time and the rows fit in the free memory of the
+// next device next to its own layers
+static void select_tensor_parallel(
+                                uint32_t   n_world,
+          const std::vector<device_info> & dev_info_set,
+                          const uint32_t * n_layer_window,
+                          const uint32_t * n_gpu_layers,
+                      struct llama_model * model,
+                                uint32_t * tp_ffn_share) {
+    std::fill(tp_ffn_share, tp_ffn_share + 32, 0);
+
+    const device_info & master = dev_info_set[0];
+    const model_bytes & mb     = master.model_bytes;
+
+    uint32_t n_window = 0;
+    for (uint32_t m = 0; m < n_world; ++m) {
+        n_window += n_layer_window[m];
+    }
+    if (mb.nb_layer <= 0 || n_window == 0) {
+        return;
+    }
+    const uint32_t n_layer  = llama_model_n_layers(model);
+    const uint32_t n_cycles = (n_layer + n_window - 1) / n_window;
+
+    // a token is bound by reading the weights, so the FFN takes the share of its bytes in a layer
+    const double nb_ffn = 2.0 * mb.nb_ffn_gate_w + mb.nb_ffn_down_w;
+    const double f_ffn  = std::min(1.0, nb_ffn / mb.nb_layer);
+    const double nb_act = llama_n_embd(model) * sizeof(float); // the FFN input and output cross the link in f32
+
+    for (uint32_t m = 0; m < n_world; ++m) {
+        const uint32_t next = (m + 1) % n_world;
+        if (next == m || n_layer_window[m] == 0 || n_layer_window[next] == 0 || n_gpu_layers[m] >= n_layer_window[m] * n_cycles) {
+            continue;
+        }
+
+        // profiled on the link from device m
+        const net_props & net = dev_info_set[next].net;
+        if (net.link_bw <= 0.0f) {
+            continue;
+        }
+
+        const double t_ffn  = device_cpu_layer_ms(master, dev_info_set[m])    * f_ffn;                    // in ms
+        const double t_next = device_cpu_layer_ms(master, dev_info_set[next]) * f_ffn;                    // in ms
+        const double t_link = 2.0 * (net.link_latency + nb_act / (net.link_bw * 1e6) * 1000);             // in ms
+
+        // device m keeps a share s of the rows: s * t_ffn = (1 - s) * t_next + t_link
+        const double s = (t_next + t_link) / (t_ffn + t_next);
+        if (s >= 0.9) {
+            continue;
+        }
+
+        const double nb_rows = (1.0 - s) * nb_ffn * (n_layer_window[m] * n_cycles - n_gpu_layers[m]);
+        const double nb_free = dev_info_set[next].memory.available_physical * 1024.0 * 1024.0 * 1024.0 -
+                               (double) n_layer_window[next] * n_cycles * mb.nb_layer;
+        if (nb_rows > nb_free) {
+            LOG_INF("%s: device %s (rank %u) has no room for the FFN rows of rank %u\n", __func__, dev_info_set[next].device_name, next, m);
+            continue;
+        }
+
+        tp_ffn_share[m] = (uint32_t) std::lround(s * 1000);
+        LOG_INF("%s: rank %u computes %.1f%% of its FFN rows, rank %u the rest (%.2f ms instead of %.2f ms per layer)\n",
+            __func__, m, s * 100, next, s * t_ffn, t_ffn);
+    }
+}
+
 //
 // Model utils
 //
 
+// profile this device, reusing the measurements of an earlier run on the same device, build and model
+static void profile_this_device(device_info & dev_info, struct llama_model * model, llama_model_loader * ml, const gpt_params & params) {
+    const int n_threads = params.cpuparams.n_threads;
+
+    std::string cache_path;
+    uint64_t    cache_key = 0;
+    device_info cached_info;
+    bool        use_cache = false;
+    if (params.profile_cache) {
+        cache_path = params.profile_cache_path.empty() ? fs_get_cache_file("device-profiles.bin") : params.profile_cache_path;
+        cache_key  = device_profile_key(model, params.model.c_str(), n_threads);
+        use_cache  = !params.profile_refresh && device_profile_cache_load(cache_path.c_str(), cache_key, &cached_info);
+    }
+
+    // a quick f32 matmul on the CPU and on the GPU tells whether the device still performs like it did (e.g.,
+    // thermal state, power mode, background load or another job on the GPU changed), fall back to a full
+    // profile if either drifted too far
+    auto is_stale = [&](const char * unit, float flops, float flops_cached) {
+        if (std::fabs(flops - flops_cached) / flops_cached <= 0.3f) {
+            return false;
+        }
+        LOG_INF("%s: cached device profile is stale (%s f32 flops %.2f vs %.2f GFLOPS), profiling again\n",
+            __func__, unit, flops, flops_cached);
+        return true;
+    };
+    if (use_cache && cached_info.cpu_props.flops_f32_f32 > 0.0f) {
+        use_cache = !is_stale("CPU", device_cpu_flops(model, GGML_TYPE_F32, GGML_TYPE_F32, n_threads), cached_info.cpu_props.flops_f32_f32);
+    }
+    if (use_cache && cached_info.gpu_props.cuda_flops_f32_f32 > 0.0f) {
+        use_cache = !is_stale("CUDA", device_cuda_flops(model, GGML_TYPE_F32, GGML_TYPE_F32), cached_info.gpu_props.cuda_flops_f32_f32);
+    }
+    if (use_cache && cached_info.gpu_props.metal_flops_f32_f32 > 0.0f) {
+        use_cache = !is_stale("Metal", device_metal_flops(model, GGML_TYPE_F32, GGML_TYPE_F32), cached_info.gpu_props.metal_flops_f32_f32);
+    }
+    if (use_cache) {
+        LOG_INF("%s: using cached device profile from %s\n", __func__, cache_path.c_str());
+    }
+
+    llama_profile_device(&dev_info, model, ml, params.gpu_mem, params.n_predict, params.n_ctx, n_threads, params.flash_attn,
+        use_cache ? &cached_info : nullptr);
+
+    if (params.profile_cache && !use_cache && !device_profile_cache_save(cache_path.c_str(), cache_key, &dev_info)) {
+        LOG_WRN("%s: failed to write the device profile cache to %s\n", __func__, cache_path.c_str());
+    }
+}
+
+// apply the layer setup of the ring to this device
+static void set_layer_setup(
+                  gpt_params & params,
+         llama_context_params & cparams,
+           llama_model_params & mparams,
+                llama_context * lctx,
+                  llama_model * model,
+                     uint32_t   my_rank,
+               const uint32_t * n_layer_window,
+               const uint32_t * n_layer_extra,
+               const uint32_t * n_gpu_layers,
+               const uint32_t * tp_ffn_share = nullptr) {
+    std::copy(n_layer_window, n_layer_window + 32, params.n_layer_window);
+    std::copy(n_layer_window, n_layer_window + 32, cparams.n_layer_window);
+    std::copy(n_layer_window, n_layer_window + 32, mparams.n_layer_window);
+    std::copy(n_layer_window, n_layer_window + 32, llama_context_n_layer_window(lctx));
+    std::copy(n_layer_extra,  n_layer_extra  + 32, params.n_layer_extra);
+    std::copy(n_layer_extra,  n_layer_extra  + 32, cparams.n_layer_extra);
+    std::copy(n_layer_extra,  n_layer_extra  + 32, mparams.n_layer_extra);
+    std::copy(n_layer_extra,  n_layer_extra  + 32, llama_context_n_layer_extra(lctx));
+    if (tp_ffn_share != nullptr) {
+        std::copy(tp_ffn_share, tp_ffn_share + 32, cparams.tp_ffn_share);
+        std::copy(tp_ffn_share, tp_ffn_share + 32, llama_context_tp_ffn_share(lctx));
+    }
+
+    if (params.n_gpu_layers == 0) { // if -ngl not set
+        params.n_gpu_layers  = n_gpu_layers[my_rank];
+        cparams.n_gpu_layers = n_gpu_layers[my_rank];
+        mparams.n_gpu_layers = n_gpu_layers[my_rank];
+        llama_model_set_n_gpu_layers(model, n_gpu_layers[my_rank]);
+    } else { // -ngl is set
+        // at most all the layers of this device, over all of its windows
+        const uint32_t n_window = std::accumulate(n_layer_window, n_layer_window + 32, 0u);
+        const uint32_t n_extra  = std::accumulate(n_layer_extra,  n_layer_extra  + 32, 0u);
+        const uint32_t n_cycles = (llama_model_n_layers(model) - n_extra) / n_window;
+        params.n_gpu_layers  = std::min(params.n_gpu_layers, (int32_t)(n_layer_window[my_rank] * n_cycles + n_layer_extra[my_rank]));
+        cparams.n_gpu_layers = params.n_gpu_layers;
+        mparams.n_gpu_layers = params.n_gpu_layers;
+        llama_model_set_n_gpu_layers(model, params.n_gpu_layers);
+    }
+}
+
 struct llama_init_result llama_init_from_gpt_params(gpt_params & params) {
 
 #if !(defined(GGML_USE_METAL) || defined(GGML_USE_CUDA))
@@ -1720,7 +1956,32 @@ struct llama_init_result llama_init_from_gpt_params(gpt_params & params) {
     struct llama_context_params cparams = llama_context_params_from_gpt_params(params);
     llama_context * lctx                = llama_new_context_with_model(model, cparams);
 
-    if (n_world == 1) {
+    if (params.join) {
+        // a new device profiles itself for the master, which takes it into the running ring after the last rank
+        LOG_INF("\nstart profiling this device, this may take some seconds ...\n");
+        dev_info.next_ip = params.master_ip.c_str();
+        profile_this_device(dev_info, model, ml, params);
+
+        struct llama_join_setup setup;
+        if (llama_join_ring(lctx, params.rank, &dev_info, &setup) != 0) {
+            LOG_ERR("%s: failed to join the ring of the master at %s\n", __func__, params.master_ip.c_str());
+            llama_free(lctx);
+            llama_free_model(model);
+            return iparams;
+        }
+
+        cparams.rank    = setup.rank;
+        mparams.rank    = setup.rank;
+        params.rank     = setup.rank;
+        my_rank         = setup.rank;
+        cparams.n_world = setup.n_world;
+        mparams.n_world = setup.n_world;
+        params.n_world  = setup.n_world;
+        n_world         = setup.n_world;
+        cparams.n_ctx   = setup.n_ctx;
+        params.n_ctx    = setup.n_ctx;
+        set_layer_setup(params, cparams, mparams, lctx, model, my_rank, setup.n_layer_window, setup.n_layer_extra, setup.n_gpu_layers);
+    } else if (n_world == 1) {
         uint32_t n_layers = llama_model_n_layers(model);
         
         // assign all layers to this device
@@ -1737,7 +1998,7 @@ struct llama_init_result llama_init_from_gpt_params(gpt_params & params) {
 #endif
 
     } else {
-        uint32_t n_layer_window[32] = {0}, n_gpu_layers[32] = {0};
+        uint32_t n_layer_window[32] = {0}, n_layer_extra[32] = {0}, n_gpu_layers[32] = {0}, tp_ffn_share[32] = {0};
 
         // initialize sockets
         llama_init_sockets(lctx, n_world, my_rank);
@@ -1765,7 +2026,10 @@ struct llama_init_result llama_init_from_gpt_params(gpt_params & params) {
             dev_info.rank = params.rank;
             dev_info.next_ip = params.next_node_ip.c_str();
             if (n_world > 1) {
-                llama_profile_device(&dev_info, model, ml, params.gpu_mem, params.n_predict, params.n_ctx, params.cpuparams.n_threads, params.flash_attn);
+                profile_this_device(dev_info, model, ml, params);
+                if (llama_profile_links(lctx, &dev_info) != 0) {
+                    LOG_WRN("%s: failed to profile the ring links, communication will not be considered\n", __func__);
+                }
             }
         }
 
@@ -1774,33 +2038,37 @@ struct llama_init_result llama_init_from_gpt_params(gpt_params & params) {
         char is_forwarder[32] = {0};
         if (my_rank == 0) {
             if (auto_schedule) {
-                std::vector<device_info> dev_info_set(n_world);
+                std::vector<device_info> & dev_info_set = iparams.dev_info_set;
+                dev_info_set.resize(n_world);
                 dev_info_set[0] = dev_info;
 
                 llama_gather_device_info(lctx, dev_info_set.data());
                 device_print_props      (dev_info_set.data(), n_world, model, cparams);
 
                 // assign layers to devices and remove weak devices
-                if (!assign_layers_and_select_devices(n_world, dev_info_set, n_layer_window, n_gpu_layers, model, cparams)) {
+                if (!assign_layers_and_select_devices(n_world, dev_info_set, n_layer_window, n_layer_extra, n_gpu_layers, model, cparams)) {
                     LOG_ERR("%s: Invalid allocation by HiGHS solver\n", __func__);
                     llama_free(lctx);
                     llama_free_model(model);
                     return iparams;
                 }
-                llama_bcast_layer_setup(lctx, n_layer_window, n_gpu_layers);
+                if (params.tensor_parallel) {
+                    select_tensor_parallel(n_world, dev_info_set, n_layer_window, n_gpu_layers, model, tp_ffn_share);
+                }
+                llama_bcast_layer_setup(lctx, n_layer_window, n_layer_extra, n_gpu_layers, tp_ffn_share);
                 llama_rebuild_topo     (lctx, n_layer_window, dev_info_set.data(), &node_type, is_forwarder);
             } else {
                 // use the user-defined n_layer_window
                 std::copy(std::begin(params.n_layer_window), std::end(params.n_layer_window), n_layer_window);
-                llama_bcast_layer_setup(lctx, n_layer_window, nullptr);
+                llama_bcast_layer_setup(lctx, n_layer_window, nullptr, nullptr, nullptr);
             }
         } else {
             if (auto_schedule){
                 llama_send_device_info (lctx, &dev_info);
-                llama_recv_layer_setup (lctx, n_layer_window, n_gpu_layers);
+                llama_recv_layer_setup (lctx, n_layer_window, n_layer_extra, n_gpu_layers, tp_ffn_share);
                 llama_rebuild_topo     (lctx, n_layer_window, nullptr, &node_type, is_forwarder);
             } else {
-                llama_recv_layer_setup (lctx, n_layer_window, n_gpu_layers);
+                llama_recv_layer_setup (lctx, n_layer_window, n_layer_extra, n_gpu_layers, tp_ffn_share);
             }
         }
 
@@ -1815,7 +2083,15 @@ struct llama_init_result llama_init_from_gpt_params(gpt_params & params) {
         // update my rank and n_world
         uint32_t update_rank = 0, update_n_world = 1;
         uint32_t worker_rank = 0, n_worker       = 1;
-        std::vector<uint32_t> n_layer_window_temp = {n_layer_window[0]}, n_gpu_layers_temp = {n_gpu_layers[0]};
+        std::vector<uint32_t> n_layer_window_temp = {n_layer_window[0]}, n_layer_extra_temp = {n_layer_extra[0]}, n_gpu_layers_temp = {n_gpu_layers[0]}, tp_ffn_share_temp = {tp_ffn_share[0]};
+        std::vector<device_info> dev_info_set_temp;
+
+        for (uint32_t i = 0; i < iparams.dev_info_set.size(); i++) {
+            if (i == 0 || n_layer_window[i] > 0 || is_forwarder[i] != 0) {
+                dev_info_set_temp.push_back(iparams.dev_info_set[i]);
+            }
+        }
+        iparams.dev_info_set = dev_info_set_temp;
 
         for (uint32_t i = 1; i < n_world; i++) {
             if (n_layer_window[i] <= 0 && is_forwarder[i] == 0) {
@@ -1824,7 +2100,9 @@ struct llama_init_result llama_init_from_gpt_params(gpt_params & params) {
             if (i <= my_rank) update_rank++;
             update_n_world++;
             n_layer_window_temp.push_back(n_layer_window[i]);
+            n_layer_extra_temp.push_back(n_layer_extra[i]);
             n_gpu_layers_temp.push_back(n_gpu_layers[i]);
+            tp_ffn_share_temp.push_back(tp_ffn_share[i]);
 
             if (n_layer_window[i] > 0) {
                 if (i <= my_rank) worker_rank++;
@@ -1833,11 +2111,15 @@ struct llama_init_result llama_init_from_gpt_params(gpt_params & params) {
         }
 
         memset(n_layer_window, 0, n_world * sizeof(uint32_t));
+        memset(n_layer_extra,  0, n_world * sizeof(uint32_t));
         memset(n_gpu_layers,   0, n_world * sizeof(uint32_t));
+        memset(tp_ffn_share,   0, n_world * sizeof(uint32_t));
 
         for (uint32_t i = 0; i < update_n_world; i++) {
             n_layer_window[i] = n_layer_window_temp[i];
+            n_layer_extra[i]  = n_layer_extra_temp[i];
             n_gpu_layers[i]   = n_gpu_layers_temp[i];
+            tp_ffn_share[i]   = tp_ffn_share_temp[i];
         }
 
         // update my rank
@@ -1873,22 +2155,7 @@ struct llama_init_result llama_init_from_gpt_params(gpt_params & params) {
         }
 
         // update n_layer_window and n_gpu_layers
-        std::copy(std::begin(n_layer_window), std::end(n_layer_window), params.n_layer_window);
-        std::copy(std::begin(n_layer_window), std::end(n_layer_window), cparams.n_layer_window);
-        std::copy(std::begin(n_layer_window), std::end(n_layer_window), mparams.n_layer_window);
-        std::copy(std::begin(n_layer_window), std::end(n_layer_window), llama_context_n_layer_window(lctx));
-
-        if (params.n_gpu_layers == 0) { // if -ngl not set
-            params.n_gpu_layers  = n_gpu_layers[my_rank];
-            cparams.n_gpu_layers = n_gpu_layers[my_rank];
-            mparams.n_gpu_layers = n_gpu_layers[my_rank];
-            llama_model_set_n_gpu_layers(model, n_gpu_layers[my_rank]);
-        } else { // -ngl is set
-            params.n_gpu_layers  = std::min(params.n_gpu_layers, (int32_t)n_layer_window[my_rank]);
-            cparams.n_gpu_layers = params.n_gpu_layers;
-            mparams.n_gpu_layers = params.n_gpu_layers;
-            llama_model_set_n_gpu_layers(model, params.n_gpu_layers);
-        }
+        set_layer_setup(params, cparams, mparams, lctx, model, my_rank, n_layer_window, n_layer_extra, n_gpu_layers, tp_ffn_share);
     }
 
     LOG_INF("\nUsing window size: %d, GPU layers: %d\n\n", cparams.n_layer_window[my_rank], cparams.n_gpu_layers);
@@ -1956,7 +2223,8 @@ struct llama_init_result llama_init_from_gpt_params(gpt_params & params) {
         params.sparams.ignore_eos = false;
     }
 
-    if (params.warmup) {
+    // the ring of a joining device is already running, a warm-up pass would take the first batch of the master
+    if (params.warmup && !params.join) {
         LOG_WRN("%s: warming up the model with an empty run - please wait ...\n", __func__);
 
         const uint32_t my_rank = cparams.rank;
@@ -1996,12 +2264,239 @@ struct llama_init_result llama_init_from_gpt_params(gpt_params & params) {
         llama_perf_context_reset(lctx);
     }
 
+    if (n_world > 1 && (params.fail_timeout > 0 || (my_rank == 0 && params.accept_join))) {
+        // a forwarder is a hop that only the ranks next to it know of
+        if (std::find(params.n_layer_window, params.n_layer_window + n_world, 0u) != params.n_layer_window + n_world) {
+            LOG_WRN("%s: failure detection and joining devices do not support rings with forwarders, they are disabled\n", __func__);
+        } else {
+            llama_start_heartbeat(lctx);
+        }
+    }
+
     iparams.model   = model;
     iparams.context = lctx;
 
     return iparams;
 }
 
+bool llama_rebalance_layer_windows(
+                   struct llama_context * lctx,
+                     struct llama_model * model,
+        const std::vector<device_info>  & dev_info_set,
+                       const gpt_params & params) {
+    // moving layers costs a reload on the affected devices and sending their kv cache,
+    // so the measured latency has to promise a clearly faster token
+    const double min_gain = 0.1;
+
+    const uint32_t n_world = params.n_world;
+    if (n_world <= 1 || params.rank != 0) {
+        return false;
+    }
+    if (dev_info_set.size() != n_world) {
+        LOG_WRN("%s: the layer windows were not scheduled automatically, there is no profile to rebalance from\n", __func__);
+        return false;
+    }
+    if (!params.lora_adapters.empty() || !params.control_vectors.empty()) {
+        LOG_WRN("%s: layers cannot be moved with LoRA adapters or control vectors applied\n", __func__);
+        return false;
+    }
+
+    std::vector<llama_rank_perf> perf(n_world);
+    if (llama_gather_rank_perf(lctx, perf.data()) != 0) {
+        LOG_WRN("%s: failed to collect the measured latency of the devices\n", __func__);
+        return false;
+    }
+
+    // forwarders hold no layers and stay out of the model
+    const uint32_t * n_layer_window_cur = llama_context_n_layer_window(lctx);
+    const uint32_t * n_layer_extra_cur  = llama_context_n_layer_extra(lctx);
+    std::vector<uint32_t>        ranks;
+    std::vector<device_info>     dev_infos;
+    std::vector<llama_rank_perf> measured;
+    for (uint32_t m = 0; m < n_world; ++m) {
+        if (n_layer_window_cur[m] == 0) {
+            continue;
+        }
+        if (perf[m].n_evals == 0) {
+            return false; // nothing measured yet
+        }
+        ranks.push_back(m);
+        dev_infos.push_back(dev_info_set[m]);
+        measured.push_back(perf[m]);
+    }
+
+    const uint32_t n_worker = ranks.size();
+    std::vector<uint32_t> w(n_worker, 0), e(n_worker, 0), n(n_worker, 0);
+    const llama_context_params cparams = llama_context_params_from_gpt_params(params);
+    if (!assign_layers_to_device(n_worker, dev_infos.data(), w.data(), e.data(), n.data(), model, cparams, nullptr, 0.1f, measured.data())) {
+        LOG_WRN("%s: no valid allocation for the measured latency\n", __func__);
+        return false;
+    }
+
+    uint32_t n_layer_window[32] = {0}, n_layer_extra[32] = {0}, n_gpu_layers[32] = {0};
+    for (uint32_t i = 0; i < n_worker; ++i) {
+        n_layer_window[ranks[i]] = w[i];
+        n_layer_extra [ranks[i]] = e[i];
+        n_gpu_layers  [ranks[i]] = n[i];
+    }
+    if (std::equal(n_layer_window, n_layer_window + n_world, n_layer_window_cur) && 
+        std::equal(n_layer_extra,  n_layer_extra  + n_world, n_layer_extra_cur)) {
+        return false;
+    }
+
+    const uint32_t n_layer = llama_model_n_layers(model);
+    const uint32_t W       = std::accumulate(w.begin(), w.end(), 0u);
+    const uint32_t k       = (n_layer - std::accumulate(e.begin(), e.end(), 0u)) / W;
+    const uint32_t W_cur   = std::accumulate(n_layer_window_cur, n_layer_window_cur + n_world, 0u);
+    const uint32_t k_cur   = (n_layer - std::accumulate(n_layer_extra_cur, n_layer_extra_cur + n_world, 0u)) / W_cur;
+
+    // each device receives the activations over its link once per cycle, more cycles cost more link time
+    const double nb_act = ggml_row_size(cparams.comm_type, llama_n_embd(model));
+    double t_link = 0.0; // in ms per cycle
+    for (const auto & dev : dev_infos) {
+        if (dev.net.link_bw > 0.0f) {
+            t_link += dev.net.link_latency + nb_act / (dev.net.link_bw * 1e6) * 1000;
+        }
+    }
+
+    double t_cur = t_link * k_cur, t_new = t_link * k; // in ms per token
+    for (uint32_t i = 0; i < n_worker; ++i) {
+        const llama_rank_perf & p = measured[i];
+        const double t_layer = (p.t_compute_ms + p.t_prefetch_ms) / p.n_evals / p.n_layers;
+        t_cur += t_layer * p.n_layers;
+        t_new += t_layer * (w[i] * k + e[i]);
+    }
+    if (t_new > (1.0 - min_gain) * t_cur) {
+        LOG_INF("%s: keeping the layer windows, moving them would give %.2f ms instead of %.2f ms per token\n", __func__, t_new, t_cur);
+        return false;
+    }
+
+    LOG_INF("%s: moving layers to windows %s with extra layers %s, estimated %.2f ms instead of %.2f ms per token\n", __func__,
+        vec_to_str(std::vector<uint32_t>(n_layer_window, n_layer_window + n_world)).c_str(),
+        vec_to_str(std::vector<uint32_t>(n_layer_extra,  n_layer_extra  + n_world)).c_str(), t_new, t_cur);
+
+    if (llama_reshard(lctx, n_layer_window, n_layer_extra, n_gpu_layers) < 0) {
+        LOG_ERR("%s: failed to move the layer windows\n", __func__);
+        return false;
+    }
+    return true;
+}
+
+bool llama_recover_ring_failure(
+                   struct llama_context * lctx,
+              std::vector<device_info>  & dev_info_set,
+                             gpt_params & params) {
+    const int32_t  failed_rank = llama_failed_rank(lctx);
+    const uint32_t n_world     = params.n_world;
+    if (failed_rank <= 0 || params.rank != 0 || n_world <= 2) {
+        return false;
+    }
+
+    const uint32_t * n_layer_window_cur = llama_context_n_layer_window(lctx);
+    const uint32_t * n_layer_extra_cur  = llama_context_n_layer_extra(lctx);
+    const uint32_t n_layer = llama_model_n_layers(llama_get_model(lctx));
+    const uint32_t W = std::accumulate(n_layer_window_cur, n_layer_window_cur + n_world, 0u);
+    const uint32_t k = (n_layer - std::accumulate(n_layer_extra_cur, n_layer_extra_cur + n_world, 0u)) / W;
+
+    // the survivors take the layers of the failed rank in proportion to what they hold already,
+    // so the split the scheduler found stays roughly in place
+    std::vector<uint32_t> n_layers;
+    for (uint32_t m = 0; m < n_world; ++m) {
+        if (m != (uint32_t) failed_rank) {
+            n_layers.push_back(n_layer_window_cur[m] * k + n_layer_extra_cur[m]);
+        }
+    }
+    const uint32_t n_held = std::accumulate(n_layers.begin(), n_layers.end(), 0u);
+    const uint32_t n_lost = n_layer - n_held;
+    uint32_t n_given = 0;
+    for (auto & n : n_layers) {
+        const uint32_t d = (uint32_t) ((uint64_t) n_lost * n / n_held);
+        n       += d;
+        n_given += d;
+    }
+    *std::max_element(n_layers.begin(), n_layers.end()) += n_lost - n_given;
+
+    // keep the number of cycles unless a device ends up with less than a layer per cycle
+    const uint32_t n_cycles = *std::min_element(n_layers.begin(), n_layers.end()) >= k ? k : 1;
+    uint32_t n_layer_window[32] = {0}, n_layer_extra[32] = {0};
+    for (uint32_t i = 0; i < n_world - 1; ++i) {
+        n_layer_window[i] = n_layers[i] / n_cycles;
+        n_layer_extra [i] = n_layers[i] % n_cycles;
+    }
+
+    LOG_INF("%s: rank %d failed, continuing with windows %s and extra layers %s\n", __func__, failed_rank,
+        vec_to_str(std::vector<uint32_t>(n_layer_window, n_layer_window + n_world - 1)).c_str(),
+        vec_to_str(std::vector<uint32_t>(n_layer_extra,  n_layer_extra  + n_world - 1)).c_str());
+
+    if (llama_recover_ring(lctx, failed_rank, n_layer_window, n_layer_extra) < 0) {
+        LOG_ERR("%s: failed to rebuild the ring without rank %d\n", __func__, failed_rank);
+        return false;
+    }
+
+    params.n_world = n_world - 1;
+    std::copy(std::begin(n_layer_window), std::end(n_layer_window), params.n_layer_window);
+    std::copy(std::begin(n_layer_extra),  std::end(n_layer_extra),  params.n_layer_extra);
+    if (dev_info_set.size() == n_world) {
+        dev_info_set.erase(dev_info_set.begin() + failed_rank);
+    }
+    return true;
+}
+
+bool llama_accept_join(
+                   struct llama_context * lctx,
+                     struct llama_model * model,
+              std::vector<device_info>  & dev_info_set,
+                             gpt_params & params) {
+    llama_join_request req;
+    device_info        dev_info;
+    if (params.rank != 0 || !llama_poll_join(lctx, 0, &req, &dev_info)) {
+        return false;
+    }
+
+    const uint32_t n_world = params.n_world;
+    if (dev_info_set.size() != n_world) {
+        LOG_WRN("%s: the layer windows were not scheduled automatically, there is no profile to plan the device at %s in\n", __func__, req.ip);
+        llama_admit_device(lctx, &req, nullptr, nullptr, nullptr);
+        return false;
+    }
+    if (!params.lora_adapters.empty() || !params.control_vectors.empty()) {
+        LOG_WRN("%s: layers cannot be moved with LoRA adapters or control vectors applied\n", __func__);
+        llama_admit_device(lctx, &req, nullptr, nullptr, nullptr);
+        return false;
+    }
+
+    // plan the larger ring from scratch, the new device comes after the last rank
+    std::vector<device_info> dev_infos = dev_info_set;
+    dev_infos.push_back(dev_info);
+    dev_infos.back().rank = n_world;
+
+    struct llama_context_params cparams = llama_context_params_from_gpt_params(params);
+    cparams.n_world = n_world + 1;
+
+    uint32_t n_layer_window[32] = {0}, n_layer_extra[32] = {0}, n_gpu_layers[32] = {0};
+    if (n_world + 1 > 32 || !assign_layers_to_device(n_world + 1, dev_infos.data(), n_layer_window, n_layer_extra, n_gpu_layers, model, cparams) ||
+        std::find(n_layer_window, n_layer_window + n_world + 1, 0u) != n_layer_window + n_world + 1) {
+        LOG_WRN("%s: no allocation gives layers to the device at %s and all devices in the ring, turning it away\n", __func__, req.ip);
+        llama_admit_device(lctx, &req, nullptr, nullptr, nullptr);
+        return false;
+    }
+
+    LOG_INF("%s: taking the device at %s in with windows %s and extra layers %s\n", __func__, req.ip,
+        vec_to_str(std::vector<uint32_t>(n_layer_window, n_layer_window + n_world + 1)).c_str(),
+        vec_to_str(std::vector<uint32_t>(n_layer_extra,  n_layer_extra  + n_world + 1)).c_str());
+
+    if (llama_admit_device(lctx, &req, n_layer_window, n_layer_extra, n_gpu_layers) < 0) {
+        LOG_ERR("%s: failed to take the device at %s into the ring\n", __func__, req.ip);
+        return false;
+    }
+
+    params.n_world = n_world + 1;
+    std::copy(std::begin(n_layer_window), std::end(n_layer_window), params.n_layer_window);
+    std::copy(std::begin(n_layer_extra),  std::end(n_layer_extra),  params.n_layer_extra);
+    dev_info_set.push_back(dev_infos.back());
+    return true;
+}
+
 void llama_lora_adapters_apply(struct llama_context * ctx, std::vector<llama_lora_adapter_container> & lora_adapters) {
     llama_lora_adapter_clear(ctx);
     for (auto & la : lora_adapters) {
@@ -2026,11 +2521,14 @@ struct llama_model_params llama_model_params_from_gpt_params(const gpt_params &
     mparams.tensor_split      = params.tensor_split;
     mparams.use_mmap          = params.use_mmap;
     mparams.use_mlock         = params.use_mlock;
+    mparams.stream_weights    = params.stream_weights;
+    mparams.repack            = params.repack;
     mparams.check_tensors     = params.check_tensors;
     mparams.keep_out_in_metal = params.keep_out_in_metal;
     mparams.keep_out_in_cuda  = params.keep_out_in_cuda;
 
     std::copy(std::begin(params.n_layer_window), std::end(params.n_layer_window), mparams.n_layer_window);
+    std::copy(std::begin(params.n_layer_extra),  std::end(params.n_layer_extra),  mparams.n_layer_extra);
     if (params.kv_overrides.empty()) {
         mparams.kv_overrides = NULL;
     } else {
@@ -2062,6 +2560,22 @@ static ggml_type kv_cache_type_from_str(const std::string & s) {
     throw std::runtime_error("Unsupported cache type: " + s);
 }
 
+static const std::vector<ggml_type> comm_types = {
+    GGML_TYPE_F32,
+    GGML_TYPE_F16,
+    GGML_TYPE_BF16,
+    GGML_TYPE_Q8_0,
+};
+
+static ggml_type comm_type_from_str(const std::string & s) {
+    for (const auto & type : comm_types) {
+        if (ggml_type_name(type) == s) {
+            return type;
+        }
+    }
+    throw std::runtime_error("Unsupported comm type: " + s);
+}
+
 struct llama_context_params llama_context_params_from_gpt_params(const gpt_params & params) {
     auto cparams = llama_context_default_params();
 
@@ -2069,12 +2583,16 @@ struct llama_context_params llama_context_params_from_gpt_params(const gpt_param
     cparams.rank              = params.rank;
     cparams.prefetch          = params.prefetch;
     cparams.force             = params.force;
+    cparams.release_policy    = params.release_policy;
+    cparams.async_comm        = params.async_comm;
+    cparams.residency_stats   = params.residency_stats || params.endpoint_metrics;
     cparams.master_priority   = params.master_priority;
     cparams.keep_out_in_metal = params.keep_out_in_metal;
     cparams.keep_out_in_cuda  = params.keep_out_in_cuda;
     cparams.n_gpu_layers      = params.n_gpu_layers;
     cparams.n_cycles          = params.n_cycles;
     std::copy(std::begin(params.n_layer_window), std::end(params.n_layer_window), cparams.n_layer_window);
+    std::copy(std::begin(params.n_layer_extra),  std::end(params.n_layer_extra),  cparams.n_layer_extra);
 
     if (cparams.master_ip != nullptr) {
         delete[] cparams.master_ip;
@@ -2083,6 +2601,9 @@ struct llama_context_params llama_context_params_from_gpt_params(const gpt_param
     std::strcpy(cparams.master_ip, params.master_ip.c_str());
     cparams.data_port         = params.data_port;
     cparams.signal_port       = params.signal_port;
+    cparams.tp_port           = params.tp_port;
+    cparams.fail_timeout      = params.fail_timeout * 1000;
+    cparams.kv_replicate      = params.kv_replicate;
 
     if (cparams.next_node_ip != nullptr) {
         delete[] cparams.next_node_ip;
@@ -2095,6 +2616,7 @@ struct llama_context_params llama_context_params_from_gpt_params(const gpt_param
     cparams.n_seq_max         = params.n_parallel;
     cparams.n_batch           = params.n_batch;
     cparams.n_ubatch          = params.n_ubatch;
+    cparams.n_micro_batch     = params.n_micro_batch;
     cparams.n_threads         = params.cpuparams.n_threads;
     cparams.n_threads_batch   = params.cpuparams_batch.n_threads == -1 ?
                                     params.cpuparams.n_threads : params.cpuparams_batch.n_threads;
@@ -2125,6 +2647,8 @@ struct llama_context_params llama_context_params_from_gpt_params(const gpt_param
     cparams.type_k = kv_cache_type_from_str(params.cache_type_k);
     cparams.type_v = kv_cache_type_from_str(params.cache_type_v);
 
+    cparams.comm_type = comm_type_from_str(params.comm_type);
+
     return cparams;
 }
 
@@ -150,6 +150,8 @@ struct common_params_speculative {
     int32_t n_gpu_layers =    -1; // number of layers to store in VRAM for the draft model (-1 - use default)
     float   p_split      =  0.1f; // speculative decoding split probability
     float   p_min        =  0.9f; // minimum speculative decoding probability (greedy)
+    bool    adaptive     = false; // pick the draft length from measured verify cost and acceptance rate
+    bool    ahead        = false; // keep drafting while the target model verifies the previous draft
 
     struct cpu_params cpuparams;
     struct cpu_params cpuparams_batch;
@@ -161,21 +163,35 @@ struct gpt_params {
     int32_t n_world               =     1; // number of devices to use
     int32_t rank                  =     0; // my rank for distributed inference
     uint32_t n_layer_window[32]   =   {0}; // layer window size on each node
+    uint32_t n_layer_extra[32]    =   {0}; // number of leading cycles in which a node holds one more layer
     std::string master_ip         = "127.0.0.1"; // ip address of the master node
     std::string next_node_ip      = "127.0.0.1"; // ip address of my next node
     uint32_t data_port            =  9000;  // data port for distributed inference
     uint32_t signal_port          =  10000; // signal port for distributed inference
+    uint32_t tp_port              =  11000; // port to serve the FFN rows split off by the previous device on
+    int32_t fail_timeout          =     0; // seconds without a heartbeat before a rank is dropped from the ring (0 = disabled)
+    bool    accept_join           = false; // master: take in devices that ask to join the running ring
+    bool    kv_replicate          = false; // keep a replica of the kv cache of the previous device for failover
+    bool    tensor_parallel       = false; // master: let the scheduler split the FFN of a device with its next device
+    bool    join                  = false; // join the running ring of the master instead of starting with it
     bool    prefetch              = false; // prefetch layer weights
     bool    keep_out_in_metal     =  true; // whether to keep output weights in metal memory, true by default
     bool    keep_out_in_cuda      = false; // whether to run the output layer on CUDA, false by default
     bool    force                 = false; // force to start prefetching after computation
+    bool    async_comm            = false; // overlap sending and receiving activations with compute
+    bool    residency_stats       = false; // sample the residency of each layer window at compute start
     float   master_priority       =  1.01; // priority to assign workload to the master (set 1.01 to use master first, and 0.99 to offload to other devices)
     int32_t gpu_mem               = 999.0; // gpu memory to use, in GiB
     int32_t n_cycles              =     0; // number of cycles to output one token
+    int32_t rebalance_interval    =     0; // re-solve the layer windows from measured latency every N tokens (0 = disabled)
+    bool    profile_cache         =  true; // reuse the device profile measured by an earlier run
+    bool    profile_refresh       = false; // ignore the cached device profile and measure again
+    std::string profile_cache_path =   ""; // device profile cache file (default: <cache dir>/device-profiles.bin)
     int32_t n_predict             =    -1; // new tokens to predict
     int32_t n_ctx                 =     0; // context size
     int32_t n_batch               =  2048; // logical batch size for prompt processing (must be >=32 to use BLAS)
     int32_t n_ubatch              =   512; // physical batch size for prompt processing (must be >=32 to use BLAS)
+    int32_t n_micro_batch         =     0; // micro-batch size to pipeline prefill across devices (0 = disabled)
     int32_t n_keep                =     0; // number of tokens to keep from initial prompt
     int32_t n_chunks              =    -1; // max number of chunks to process (-1 = unlimited)
     int32_t n_parallel            =     1; // number of parallel sequences to decode
@@ -211,6 +227,7 @@ struct gpt_params {
     enum llama_rope_scaling_type rope_scaling_type = LLAMA_ROPE_SCALING_TYPE_UNSPECIFIED;
     enum llama_pooling_type      pooling_type      = LLAMA_POOLING_TYPE_UNSPECIFIED; // pooling type for embeddings
     enum llama_attention_type    attention_type    = LLAMA_ATTENTION_TYPE_UNSPECIFIED; // attention type for embeddings
+    enum llama_release_policy    release_policy    = LLAMA_RELEASE_POLICY_OFF; // release the pages of computed layer windows
 
     struct gpt_sampler_params sparams;
     struct common_params_speculative speculative;
@@ -280,6 +297,8 @@ struct gpt_params {
     bool logits_all        = false; // return logits for all tokens in the batch
     bool use_mmap          = true;  // use mmap for faster loads
     bool use_mlock         = false; // use mlock to keep model in memory
+    bool stream_weights    = false; // stream CPU layer windows from disk into staging buffers
+    bool repack            = false; // repack Q4_K/Q6_K weights into interleaved rows at load time
     bool verbose_prompt    = false; // print prompt tokens before generation
     bool display_prompt    = true;  // print prompt before generation
     bool dump_kv_cache     = false; // dump the KV cache contents for debugging purposes
@@ -289,6 +308,7 @@ struct gpt_params {
 
     std::string cache_type_k = "f16"; // KV cache data type for the K
     std::string cache_type_v = "f16"; // KV cache data type for the V
+    std::string comm_type    = "f32"; // data type of activations sent to the next device
 
     // multimodal models (see examples/llava)
     std::string mmproj = "";        // path to multimodal projector                                         // NOLINT
@@ -433,10 +453,36 @@ struct llama_init_result {
     struct llama_model   * model   = nullptr;
     struct llama_context * context = nullptr;
     std::vector<llama_lora_adapter_container> lora_adapters;
+    std::vector<device_info> dev_info_set; // profiles of the ranks in the ring, on the master if scheduled automatically
 };
 
 struct llama_init_result    llama_init_from_gpt_params(gpt_params & params);
 
+// master only: collect the latency measured on each device since the last call, re-solve the layer windows with it
+// and move layers between the devices if that pays off. returns true if layers were moved, their kv cache moves
+// along unless llama_get_kv_cache_used_cells drops to 0
+bool llama_rebalance_layer_windows(
+                   struct llama_context * lctx,
+                     struct llama_model * model,
+        const std::vector<device_info>  & dev_info_set,
+                       const gpt_params & params);
+
+// master only: take in a device that asked to join, with the layers re-planned for the larger ring.
+// returns true if it joined, the kv cache is kept as with llama_rebalance_layer_windows
+bool llama_accept_join(
+                   struct llama_context * lctx,
+                     struct llama_model * model,
+              std::vector<device_info>  & dev_info_set,
+                             gpt_params & params);
+
+// master only: rebuild the ring without the rank llama_decode found failed, its layers go to the other devices.
+// returns true if the ring is usable again. with kv_replicate the kv cache is kept, including the cells of the
+// aborted batch, otherwise it is empty
+bool llama_recover_ring_failure(
+                   struct llama_context * lctx,
+              std::vector<device_info>  & dev_info_set,
+                             gpt_params & params);
+
 struct llama_model_params     llama_model_params_from_gpt_params    (const gpt_params & params);
 struct llama_context_params   llama_context_params_from_gpt_params  (const gpt_params & params);
 struct ggml_threadpool_params ggml_threadpool_params_from_cpu_params(const cpu_params & params);
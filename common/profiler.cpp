@@ -162,6 +162,39 @@ uint32_t device_cpu_cores() {
     return core_count;
 }
 
+// time a benchmark until the 95% confidence interval of its mean is tight enough or the
+// sampling budget runs out, returns the mean time of one run in microseconds
+template <typename F>
+static double bench_time_us(F run) {
+    const int64_t t_begin = ggml_time_us();
+    double sum    = 0.0;
+    double sum_sq = 0.0;
+    int    n      = 0;
+
+    while (n < BENCH_MAX_ITERS) {
+        const int64_t t_start = ggml_time_us();
+        run();
+        const double dt = (double)(ggml_time_us() - t_start);
+
+        sum    += dt;
+        sum_sq += dt * dt;
+        n      += 1;
+
+        if (ggml_time_us() - t_begin >= BENCH_BUDGET_US) {
+            break;
+        }
+        if (n >= BENCH_MIN_ITERS) {
+            const double mean = sum / n;
+            const double var  = std::max(0.0, (sum_sq - n * mean * mean) / (n - 1));
+            if (1.96 * std::sqrt(var / n) <= BENCH_CI_TARGET * mean) {
+                break;
+            }
+        }
+    }
+
+    return sum / n;
+}
+
 static float device_flops(struct llama_model * model, enum ggml_type src0t, enum ggml_type src1t, enum profiler_backend_type btype, int n_threads) {
     int n_repeat = 1;
     int n_embd   = std::min(llama_n_embd(model), 4096);
@@ -285,11 +318,7 @@ static float device_flops(struct llama_model * model, enum ggml_type src0t, enum
     // warm-up
     ggml_backend_graph_compute(backend, gf);
 
-    const int64_t t_start = ggml_time_us();
-    ggml_backend_graph_compute(backend, gf);
-    const int64_t t_end = ggml_time_us();
-
-    double elapsed_seconds = ((double)t_end - (double)t_start) / 1e6; // convert to seconds
+    double elapsed_seconds = bench_time_us([&]() { ggml_backend_graph_compute(backend, gf); }) / 1e6; // convert to seconds
     double flops = (2.0 * (double)n_embd * (double)n_embd * (double)n_embd * n_repeat) / elapsed_seconds / 1e9; // convert to GFLOPS
 
     ggml_free(ctx_cgraph);
@@ -441,11 +470,7 @@ float device_inp_embd_delay(struct llama_model * model, enum ggml_type src0t, in
     // warm-up
     ggml_backend_graph_compute(backend, gf);
 
-    const int64_t t_start = ggml_time_us();
-    ggml_backend_graph_compute(backend, gf);
-    const int64_t t_end = ggml_time_us();
-
-    double elapsed_ms = ((double)t_end - (double)t_start) / 1e3; // convert to ms
+    double elapsed_ms = bench_time_us([&]() { ggml_backend_graph_compute(backend, gf); }) / 1e3; // convert to ms
 
     ggml_free(ctx_cgraph);
     ggml_gallocr_free(allocr);
@@ -1175,11 +1200,10 @@ static float device_read_vram_bw(enum profiler_backend_type btype) {
     ggml_gallocr_t allocr = ggml_gallocr_new(ggml_backend_get_default_buffer_type(backend));
     ggml_gallocr_alloc_graph(allocr, gf);
 
-    const int64_t t_start = ggml_time_us();
+    // warm-up
     ggml_backend_graph_compute(backend, gf);
-    const int64_t t_end = ggml_time_us();
 
-    double elapsed_s = ((double)t_end - (double)t_start) / 1e6;
+    double elapsed_s = bench_time_us([&]() { ggml_backend_graph_compute(backend, gf); }) / 1e6;
     size_t total_bytes = n_embd * n_embd * sizeof(float);
     float bandwidth = (total_bytes / elapsed_s) / 1e9; // GB/s
 
@@ -1291,11 +1315,7 @@ static float device_mem_copy(struct llama_model * model, enum profiler_backend_t
     // warm-up 
     ggml_backend_graph_compute(backend, gf);
 
-    const int64_t t_start = ggml_time_us();
-    ggml_backend_graph_compute(backend, gf);
-    const int64_t t_end = ggml_time_us();
-
-    double elapsed_ms = ((double)t_end - (double)t_start) / 1e3; // ms
+    double elapsed_ms = bench_time_us([&]() { ggml_backend_graph_compute(backend, gf); }) / 1e3; // ms
 
     ggml_free(ctx_cgraph);
     ggml_gallocr_free(allocr);
@@ -1454,6 +1474,14 @@ static float device_compute_delay(struct device_info & dev_info, int n_layers, c
     return static_cast<float>(total_latency);
 }
 
+int64_t model_layers_bytes(const struct llama_model * model, const struct model_bytes & n_bytes, int il0, int il1) {
+    const int64_t nb = llama_model_layers_nbytes(model, il0, il1);
+    if (nb < 0) {
+        return n_bytes.nb_layer * std::max(0, il1 - il0);
+    }
+    return nb;
+}
+
 // estimate the memory access delay, except for the input embedding because it has been considered in n_flops.inp_embd_ms
 static float device_memory_access_delay(struct device_info & dev_info, struct llama_model * model, const struct llama_context_params cparams, int n_layers) {
     auto n_bytes     = dev_info.model_bytes;
@@ -1465,8 +1493,9 @@ static float device_memory_access_delay(struct device_info & dev_info, struct ll
 #if defined(GGML_USE_METAL) || defined(GGML_USE_CUDA)
     llama_kv_size(&cpu_kv_size, &gpu_kv_size, model, cparams, true);
 
-    int64_t vram_bytes = n_bytes.nb_layer * n_gpu_layers + gpu_kv_size;
-    int64_t ram_bytes  = n_bytes.nb_layer * (n_layers - n_gpu_layers) + n_bytes.nb_output + cpu_kv_size;
+    // the last n_gpu_layers layers run on the GPU
+    int64_t vram_bytes = model_layers_bytes(model, n_bytes, n_layers - n_gpu_layers, n_layers) + gpu_kv_size;
+    int64_t ram_bytes  = model_layers_bytes(model, n_bytes, 0, n_layers - n_gpu_layers) + n_bytes.nb_output + cpu_kv_size;
 
 #ifdef GGML_USE_CUDA
     double vram_access_delay = (double)(vram_bytes) / 1e6 / dev_info.gpu_props.cuda_read_vram_bw;
@@ -1482,7 +1511,7 @@ static float device_memory_access_delay(struct device_info & dev_info, struct ll
 
     (void)n_gpu_layers;
     (void)gpu_kv_size;
-    int64_t ram_bytes = n_bytes.nb_layer * n_layers + n_bytes.nb_output + cpu_kv_size;
+    int64_t ram_bytes = model_layers_bytes(model, n_bytes, 0, n_layers) + n_bytes.nb_output + cpu_kv_size;
     double ram_access_delay = (double)(ram_bytes) / 1e6 / dev_info.memory.cpu_read_ram_bw;
     return static_cast<float>(ram_access_delay); // ms
 #endif
@@ -1585,13 +1614,13 @@ static float device_disk_access_delay(struct device_info & dev_info, struct llam
     cpu_total_bytes += input_bytes;
 
 #if defined(GGML_USE_METAL) || defined(GGML_USE_CUDA)
-    cpu_total_bytes += n_bytes.nb_layer * (n_layers - n_gpu_layers);
+    cpu_total_bytes += model_layers_bytes(model, n_bytes, 0, n_layers - n_gpu_layers);
 #if defined(GGML_USE_METAL)
-    int64_t gpu_total_bytes = n_bytes.nb_layer * n_gpu_layers;
+    int64_t gpu_total_bytes = model_layers_bytes(model, n_bytes, n_layers - n_gpu_layers, n_layers);
 #endif
 #else
     (void)n_gpu_layers;
-    cpu_total_bytes += n_bytes.nb_layer * n_layers;
+    cpu_total_bytes += model_layers_bytes(model, n_bytes, 0, n_layers);
 #endif
 
     cpu_total_bytes += n_bytes.nb_output;
@@ -1886,6 +1915,18 @@ void device_print_props(struct device_info * dev_info_set, int n, struct llama_m
     }
     LOG_INF("\n");
 
+    LOG_INF("| Link Throughput (MB/s)          ");
+    for (int i = 0; i < n; ++i) {
+        LOG_INF("| %-10.2f   ", dev_info_set[i].net.link_bw);
+    }
+    LOG_INF("\n");
+
+    LOG_INF("| Link Latency (ms)               ");
+    for (int i = 0; i < n; ++i) {
+        LOG_INF("| %-10.2f   ", dev_info_set[i].net.link_latency);
+    }
+    LOG_INF("\n");
+
     LOG_INF("| GPU Metal                       ");
     for (int i = 0; i < n; ++i) {
         LOG_INF("| %-10d   ", dev_info_set[i].gpu_support.metal);
@@ -2410,6 +2451,7 @@ size_t serialize(const struct device_info * dev_info, char ** buffer) {
                       + gpu_name_len
                       + gpu_description_len
                       + sizeof(struct disk_props)
+                      + sizeof(struct net_props)
                       + sizeof(uint32_t)    // cpu_props.cores
                       + sizeof(float) * 12  // - cpu_props.flops_f32_f32,   cpu_props.flops_f16_f32,
                                             // - cpu_props.flops_q2k_f32,   cpu_props.flops_q4k_f32, cpu_props.flops_q5k_f32, cpu_props.flops_q6k_f32
@@ -2493,6 +2535,9 @@ size_t serialize(const struct device_info * dev_info, char ** buffer) {
     memcpy(ptr, &dev_info->disk, sizeof(struct disk_props));
     ptr += sizeof(struct disk_props);
 
+    memcpy(ptr, &dev_info->net, sizeof(struct net_props));
+    ptr += sizeof(struct net_props);
+
     memcpy(ptr, &dev_info->cpu_props.cores, sizeof(uint32_t));
     ptr += sizeof(uint32_t);
 
@@ -2698,6 +2743,9 @@ size_t deserialize(const char * buffer, struct device_info * dev_info) {
     memcpy(&dev_info->disk, ptr, sizeof(struct disk_props));
     ptr += sizeof(struct disk_props);
 
+    memcpy(&dev_info->net, ptr, sizeof(struct net_props));
+    ptr += sizeof(struct net_props);
+
     memcpy(&dev_info->cpu_props.cores, ptr, sizeof(uint32_t));
     ptr += sizeof(uint32_t);
 
@@ -2862,3 +2910,203 @@ size_t TopoRebuildHelperInfo::serialize(char ** buffer) const{
     *buffer = buffer_;
     return buffer_size + 1;
 }
+
+#define PROFILE_CACHE_MAGIC   0x46525050u // "PPRF"
+#define PROFILE_CACHE_VERSION 1u
+#define PROFILE_MODEL_HASH_BYTES (4L * 1024 * 1024)
+
+static uint64_t fnv1a(uint64_t hash, const void * data, size_t size) {
+    const uint8_t * p = (const uint8_t *)data;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= p[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+static uint64_t fnv1a(uint64_t hash, const char * str) {
+    return fnv1a(hash, str, strlen(str) + 1);
+}
+
+uint64_t device_profile_key(struct llama_model * model, const char * model_path, int n_threads) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+    // hardware identity
+    hash = fnv1a(hash, device_name());
+    hash = fnv1a(hash, device_os());
+
+    uint32_t cores  = device_cpu_cores();
+    uint64_t ram_gb = device_physical_memory(false) >> 30;
+    hash = fnv1a(hash, &cores,  sizeof(cores));
+    hash = fnv1a(hash, &ram_gb, sizeof(ram_gb));
+
+    ggml_backend_dev_props cpu_props;
+    device_get_props(model, -1, &cpu_props);
+    hash = fnv1a(hash, cpu_props.name);
+    hash = fnv1a(hash, cpu_props.description);
+
+#if defined(GGML_USE_METAL) || defined(GGML_USE_CUDA)
+    ggml_backend_dev_props gpu_props;
+    device_get_props(model, 0, &gpu_props);
+    uint64_t vram_gb = gpu_props.memory_total >> 30;
+    hash = fnv1a(hash, gpu_props.name);
+    hash = fnv1a(hash, gpu_props.description);
+    hash = fnv1a(hash, &vram_gb, sizeof(vram_gb));
+#endif
+
+    // build flags and the thread count the benchmarks run with
+    hash = fnv1a(hash, llama_print_system_info());
+    hash = fnv1a(hash, &n_threads, sizeof(n_threads));
+
+    // the model decides which dtypes are benchmarked and at what size, the gguf header
+    // and tensor infos sit at the front of the file, so hash the first few MiB and its size
+    std::ifstream file(model_path, std::ios::binary | std::ios::ate);
+    if (file) {
+        int64_t file_size = file.tellg();
+        hash = fnv1a(hash, &file_size, sizeof(file_size));
+
+        std::vector<char> head(std::min<int64_t>(file_size, PROFILE_MODEL_HASH_BYTES));
+        file.seekg(0);
+        file.read(head.data(), head.size());
+        hash = fnv1a(hash, head.data(), file.gcount());
+    } else {
+        hash = fnv1a(hash, model_path);
+    }
+
+    return hash;
+}
+
+struct profile_cache_entry {
+    uint64_t          key;
+    std::vector<char> data;
+};
+
+// free the strings deserialize allocated for a device_info
+static void device_info_free_strings(struct device_info & dev_info) {
+    free(const_cast<char *>(dev_info.device_name));
+    free(const_cast<char *>(dev_info.device_os));
+    free(const_cast<char *>(dev_info.next_ip));
+    free(const_cast<char *>(dev_info.cpu_props.name));
+    free(const_cast<char *>(dev_info.cpu_props.description));
+    free(const_cast<char *>(dev_info.gpu_props.name));
+    free(const_cast<char *>(dev_info.gpu_props.description));
+}
+
+static bool profile_cache_read(const char * path, std::vector<profile_cache_entry> & entries) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    uint32_t magic = 0, version = 0, n_entries = 0;
+    file.read((char *)&magic,     sizeof(magic));
+    file.read((char *)&version,   sizeof(version));
+    file.read((char *)&n_entries, sizeof(n_entries));
+    if (!file || magic != PROFILE_CACHE_MAGIC || version != PROFILE_CACHE_VERSION) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < n_entries; ++i) {
+        profile_cache_entry entry;
+        uint64_t size = 0;
+        file.read((char *)&entry.key, sizeof(entry.key));
+        file.read((char *)&size,      sizeof(size));
+        if (!file || size > (1u << 20)) {
+            return false;
+        }
+        entry.data.resize(size);
+        file.read(entry.data.data(), size);
+        if (!file) {
+            return false;
+        }
+        entries.push_back(std::move(entry));
+    }
+
+    return true;
+}
+
+bool device_profile_cache_load(const char * path, uint64_t key, struct device_info * dev_info) {
+    std::vector<profile_cache_entry> entries;
+    if (!profile_cache_read(path, entries)) {
+        return false;
+    }
+
+    for (const auto & entry : entries) {
+        if (entry.key != key) {
+            continue;
+        }
+
+        // only the measurements are of interest, drop the strings deserialize allocated
+        device_info cached;
+        if (deserialize(entry.data.data(), &cached) != entry.data.size()) {
+            return false;
+        }
+        device_info_free_strings(cached);
+
+        dev_info->disk                   = cached.disk;
+        dev_info->cpu_props              = cached.cpu_props;
+        dev_info->gpu_props              = cached.gpu_props;
+        dev_info->memory.cpu_read_ram_bw = cached.memory.cpu_read_ram_bw;
+        dev_info->memory.mem_cpy_delay   = cached.memory.mem_cpy_delay;
+
+        dev_info->cpu_props.name        = "";
+        dev_info->cpu_props.description = "";
+        dev_info->gpu_props.name        = "";
+        dev_info->gpu_props.description = "";
+        return true;
+    }
+
+    return false;
+}
+
+bool device_profile_cache_save(const char * path, uint64_t key, const struct device_info * dev_info) {
+    // keep the entries of other devices and models, the file may live on a shared home directory
+    std::vector<profile_cache_entry> entries;
+    if (!profile_cache_read(path, entries)) {
+        entries.clear();
+    }
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+        [key](const profile_cache_entry & entry) { return entry.key == key; }), entries.end());
+
+    char * buffer = nullptr;
+    size_t size   = serialize(dev_info, &buffer);
+    if (size == 0) {
+        return false;
+    }
+    profile_cache_entry entry;
+    entry.key = key;
+    entry.data.assign(buffer, buffer + size);
+    free(buffer);
+    entries.push_back(std::move(entry));
+
+    // write to a temporary file first so that concurrent readers never see a partial cache
+    const std::string tmp_path = std::string(path) + ".tmp";
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+
+        const uint32_t magic     = PROFILE_CACHE_MAGIC;
+        const uint32_t version   = PROFILE_CACHE_VERSION;
+        const uint32_t n_entries = entries.size();
+        file.write((const char *)&magic,     sizeof(magic));
+        file.write((const char *)&version,   sizeof(version));
+        file.write((const char *)&n_entries, sizeof(n_entries));
+        for (const auto & e : entries) {
+            const uint64_t e_size = e.data.size();
+            file.write((const char *)&e.key,  sizeof(e.key));
+            file.write((const char *)&e_size, sizeof(e_size));
+            file.write(e.data.data(), e_size);
+        }
+        if (!file) {
+            return false;
+        }
+    }
+
+    if (std::rename(tmp_path.c_str(), path) != 0) {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
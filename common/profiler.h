@@ -9,6 +9,10 @@
 #define DISK_TEST_SEQ_BLOCK  100L * 1024 * 1024
 #define DISK_TEST_RND_BLOCK  4096
 #define MEM_TEST_BLOCK_SIZE  64 * 1024
+#define BENCH_MIN_ITERS      3
+#define BENCH_MAX_ITERS      32
+#define BENCH_BUDGET_US      200000 // stop sampling a benchmark after 200 ms
+#define BENCH_CI_TARGET      0.05f  // or once the 95% confidence interval is within 5% of the mean
 
 
 struct cpu_props {
@@ -290,7 +294,7 @@ struct model_params {
 
 struct model_bytes {
     int64_t nb_input;
-    int64_t nb_layer;
+    int64_t nb_layer;  // average over the layers
     int64_t nb_output;
 
     // used to estimate the compute buffer size 
@@ -326,6 +330,19 @@ struct disk_props {
         write_rnd_bw(0.0f) {}
 };
 
+// the ring is unidirectional and the clocks of the devices are not synchronized, 
+// so each rank measures the link from its previous rank on the receiving side
+struct net_props {
+    float link_bw;      // in MB/s, throughput of the link from the previous rank
+    float link_latency; // in ms, one-way latency share of that link
+    float ring_rtt;     // in ms, round-trip time of a small message over the whole ring (master only)
+
+    net_props() :
+        link_bw     (0.0f),
+        link_latency(0.0f),
+        ring_rtt    (0.0f) {}
+};
+
 struct startup_args{
     bool     should_profile;
     uint32_t n_ctx;
@@ -337,6 +354,7 @@ struct device_info {
     const char *        device_os;
     const char *        next_ip;
     struct disk_props   disk;
+    struct net_props    net;
     struct cpu_props    cpu_props;
     struct memory_info  memory;
     struct gpu_support  gpu_support;
@@ -351,6 +369,7 @@ struct device_info {
         device_os(""),
         next_ip(""),
         disk(),
+        net(),
         cpu_props(), 
         memory(), 
         gpu_support(), 
@@ -414,7 +433,16 @@ int      device_has_gpublas(void);
 int      device_has_blas   (void);
 int      device_has_sycl   (void);
 
+// bytes of layers [il0, il1), from the average if the sizes of the layers are unknown
+int64_t  model_layers_bytes(const struct llama_model * model, const struct model_bytes & n_bytes, int il0, int il1);
+
 size_t   serialize  (const struct device_info * dev_info, char ** buffer);
 size_t   deserialize(const char * buffer, struct device_info * dev_info);
 
+// device profiles are cached on disk so that a restart can skip the slow benchmarks,
+// entries are keyed by the hardware, the build and the model file
+uint64_t device_profile_key       (struct llama_model * model, const char * model_path, int n_threads);
+bool     device_profile_cache_load(const char * path, uint64_t key, struct device_info * dev_info);
+bool     device_profile_cache_save(const char * path, uint64_t key, const struct device_info * dev_info);
+
 #endif // PROFILER_H
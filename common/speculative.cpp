@@ -4,27 +4,51 @@
 #include "common.h"
 #include "sampling.h"
 
+#include <atomic>
+#include <cmath>
 #include <cstring>
+#include <thread>
 
 #define SPEC_VOCAB_MAX_SIZE_DIFFERENCE  128
 #define SPEC_VOCAB_CHECK_START_TOKEN_ID 5
 
+// weight kept by the draft length statistics after each verification pass
+#define SPEC_ADAPT_DECAY 0.9f
+
 struct common_speculative {
     struct llama_context * ctx;
     struct gpt_sampler * smpl;
 
     llama_batch batch;
     llama_tokens prompt;
+
+    // drafted token that follows prompt.back() but has not been evaluated on the draft model yet
+    llama_token tail = LLAMA_TOKEN_NULL;
+
+    // decayed statistics used by common_speculative_n_draft
+    float n_accept   = 0.0f; // accepted draft tokens
+    float n_reject   = 0.0f; // verification passes that rejected a draft token
+    float n_drafted  = 0.0f; // tokens returned by common_speculative_gen_draft
+    float t_draft_us = 0.0f; // time spent in common_speculative_gen_draft
+
+    // weighted sums for the least squares fit t_verify = a + b*n_batch
+    float v_w  = 0.0f;
+    float v_n  = 0.0f;
+    float v_t  = 0.0f;
+    float v_nn = 0.0f;
+    float v_nt = 0.0f;
+
+    std::thread       ahead;
+    std::atomic<bool> ahead_stop{false};
 };
 
 struct common_speculative * common_speculative_init(
         struct llama_context * ctx_dft) {
-    auto * result = new common_speculative {
-        /* .ctx    = */ ctx_dft,
-        /* .smpl   = */ nullptr,
-        /* .batch  = */ llama_batch_init(llama_n_batch(ctx_dft), 0, 1),
-        /* .prompt = */ {},
-    };
+    auto * result = new common_speculative;
+
+    result->ctx   = ctx_dft;
+    result->smpl  = nullptr;
+    result->batch = llama_batch_init(llama_n_batch(ctx_dft), 0, 1);
 
     // TODO: optimize or pass from outside?
 #if 0
@@ -64,6 +88,8 @@ struct common_speculative * common_speculative_init(
 }
 
 void common_speculative_free(struct common_speculative * spec) {
+    common_speculative_ahead_end(spec);
+
     gpt_sampler_free(spec->smpl);
 
     llama_batch_free(spec->batch);
@@ -132,6 +158,10 @@ llama_tokens common_speculative_gen_draft(
         struct common_speculative_params params,
         const llama_tokens & prompt_tgt,
         llama_token id_last) {
+    common_speculative_ahead_end(spec);
+
+    const int64_t t_start_us = ggml_time_us();
+
     auto & batch  = spec->batch;
     auto & ctx    = spec->ctx;
     auto & smpl   = spec->smpl;
@@ -181,6 +211,14 @@ llama_tokens common_speculative_gen_draft(
                 }
             }
 
+            if (spec->tail != LLAMA_TOKEN_NULL && (int) result.size() < params.n_draft &&
+                reuse_i + reuse_n + 1 + (int) result.size() == (int) prompt.size()) {
+                result.push_back(spec->tail);
+            }
+
+            spec->n_drafted  += result.size();
+            spec->t_draft_us += ggml_time_us() - t_start_us;
+
             return result;
         }
 
@@ -198,6 +236,8 @@ llama_tokens common_speculative_gen_draft(
         }
     }
 
+    spec->tail = LLAMA_TOKEN_NULL;
+
     // prepare a batch to evaluate any new tokens in the prompt
     llama_batch_clear(batch);
 
@@ -256,6 +296,7 @@ llama_tokens common_speculative_gen_draft(
         result.push_back(id);
 
         if (params.n_draft <= (int) result.size()) {
+            spec->tail = id;
             break;
         }
 
@@ -267,5 +308,134 @@ llama_tokens common_speculative_gen_draft(
         prompt.push_back(id);
     }
 
+    spec->n_drafted  += result.size();
+    spec->t_draft_us += ggml_time_us() - t_start_us;
+
     return result;
+}
+
+void common_speculative_update(
+        struct common_speculative * spec,
+        int n_draft,
+        int n_accept,
+        int64_t t_verify_us) {
+    const float d = SPEC_ADAPT_DECAY;
+
+    // each draft token is modelled as accepted with the same probability, so a pass contributes
+    // its accepted tokens as successes and at most one rejection
+    spec->n_accept   = d*spec->n_accept + n_accept;
+    spec->n_reject   = d*spec->n_reject + (n_accept < n_draft ? 1.0f : 0.0f);
+    spec->n_drafted  = d*spec->n_drafted;
+    spec->t_draft_us = d*spec->t_draft_us;
+
+    // the verification batch holds the last sampled token followed by the draft
+    const float n = n_draft + 1;
+    const float t = t_verify_us;
+
+    spec->v_w  = d*spec->v_w  + 1.0f;
+    spec->v_n  = d*spec->v_n  + n;
+    spec->v_t  = d*spec->v_t  + t;
+    spec->v_nn = d*spec->v_nn + n*n;
+    spec->v_nt = d*spec->v_nt + n*t;
+}
+
+int common_speculative_n_draft(
+        const struct common_speculative * spec,
+        int n_min,
+        int n_max) {
+    n_min = std::max(1, std::min(n_min, n_max));
+
+    if (spec->v_w == 0.0f) {
+        return n_max;
+    }
+
+    const float alpha = std::min(0.99f, (spec->n_accept + 1.0f) / (spec->n_accept + spec->n_reject + 2.0f));
+
+    // on a ring the verification cost is dominated by the fixed round trip (a), the
+    // per-token part (b) only shows once the draft length has varied a little
+    const float mean_n = spec->v_n / spec->v_w;
+    const float mean_t = spec->v_t / spec->v_w;
+    const float var_n  = spec->v_nn / spec->v_w - mean_n*mean_n;
+
+    float b = 0.0f;
+    if (var_n > 0.25f) {
+        b = std::max(0.0f, (spec->v_nt / spec->v_w - mean_n*mean_t) / var_n);
+    }
+    const float a = std::max(1.0f, mean_t - b*mean_n);
+
+    const float t_draft = spec->n_drafted > 0.0f ? spec->t_draft_us / spec->n_drafted : 0.0f;
+
+    int   best      = n_max;
+    float best_rate = 0.0f;
+
+    for (int n = n_min; n <= n_max; ++n) {
+        // expected accepted tokens plus the token sampled from the target after them
+        const float n_gen = (1.0f - std::pow(alpha, n + 1)) / (1.0f - alpha);
+        const float rate  = n_gen / (a + b*(n + 1) + t_draft*n);
+
+        if (rate > best_rate) {
+            best      = n;
+            best_rate = rate;
+        }
+    }
+
+    LOG_DBG("%s: alpha = %.3f, a = %.1f us, b = %.1f us, t_draft = %.1f us, n_draft = %d\n",
+            __func__, alpha, a, b, t_draft, best);
+
+    return best;
+}
+
+void common_speculative_ahead_begin(
+        struct common_speculative * spec,
+        struct common_speculative_params params) {
+    common_speculative_ahead_end(spec);
+
+    spec->ahead_stop = false;
+    spec->ahead = std::thread([spec, params]() {
+        auto & batch  = spec->batch;
+        auto & ctx    = spec->ctx;
+        auto & smpl   = spec->smpl;
+        auto & prompt = spec->prompt;
+
+        const int n_ctx = llama_n_ctx(ctx);
+
+        for (int i = 0; i < params.n_draft && !spec->ahead_stop; ++i) {
+            if (spec->tail != LLAMA_TOKEN_NULL) {
+                if ((int) prompt.size() >= n_ctx) {
+                    break;
+                }
+
+                llama_batch_clear(batch);
+                llama_batch_add  (batch, spec->tail, prompt.size(), { 0 }, true);
+
+                if (llama_decode(ctx, batch) != 0) {
+                    break;
+                }
+
+                prompt.push_back(spec->tail);
+                spec->tail = LLAMA_TOKEN_NULL;
+            }
+
+            gpt_sampler_sample(smpl, ctx, 0, true);
+
+            const auto * cur_p = gpt_sampler_get_candidates(smpl);
+
+            // the first token guesses what the target samples after an accepted draft, keep it
+            // regardless of confidence, the rest must be as confident as a regular draft
+            if (i > 0 && cur_p->data[0].p < params.p_min) {
+                break;
+            }
+
+            gpt_sampler_accept(smpl, cur_p->data[0].id, true);
+
+            spec->tail = cur_p->data[0].id;
+        }
+    });
+}
+
+void common_speculative_ahead_end(struct common_speculative * spec) {
+    if (spec->ahead.joinable()) {
+        spec->ahead_stop = true;
+        spec->ahead.join();
+    }
 }
\ No newline at end of file
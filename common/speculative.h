@@ -25,4 +25,26 @@ llama_tokens common_speculative_gen_draft(
                struct common_speculative * spec,
         struct common_speculative_params   params,
                       const llama_tokens & prompt,
-                             llama_token   id_last);
\ No newline at end of file
+                             llama_token   id_last);
+
+// record the outcome of verifying n_draft tokens, of which n_accept were accepted, in t_verify_us
+void common_speculative_update(
+        struct common_speculative * spec,
+                              int   n_draft,
+                              int   n_accept,
+                          int64_t   t_verify_us);
+
+// draft length in [n_min, n_max] that maximizes the expected number of generated tokens per unit of time,
+// given the acceptance rate and the verification cost measured so far
+int common_speculative_n_draft(
+        const struct common_speculative * spec,
+                                    int   n_min,
+                                    int   n_max);
+
+// keep extending the last draft on a background thread until common_speculative_ahead_end is called
+// if the target model accepts the whole draft, the next common_speculative_gen_draft reuses these tokens
+void common_speculative_ahead_begin(
+               struct common_speculative * spec,
+        struct common_speculative_params   params);
+
+void common_speculative_ahead_end(struct common_speculative * spec);
@@ -145,10 +145,10 @@ int main(int argc, char ** argv) {
 
     uint32_t n_world  = params.n_world;
     uint32_t my_rank  = params.rank;
-    GGML_ASSERT(!(n_world == 1 && my_rank > 0));
+    GGML_ASSERT(!(n_world == 1 && my_rank > 0) || params.join);
 
     // check if --n-layer-window and --world is matched
-    if (my_rank == 0) {
+    if (my_rank == 0 && !params.join) {
         uint32_t non_zero_count = 0;
         size_t size = sizeof(params.n_layer_window) / sizeof(params.n_layer_window[0]);
         for (size_t i = 0; i < size; ++i) {
@@ -511,6 +511,10 @@ int main(int argc, char ** argv) {
     int n_remain           = params.n_predict;
     int n_consumed         = 0;
     int n_session_consumed = 0;
+    int n_since_rebalance  = 0;
+
+    // tokens held in the kv cache, evaluated again after layers were moved between devices
+    std::vector<llama_token> tokens_in_kv;
 
     std::vector<int>   input_tokens;  g_input_tokens  = &input_tokens;
     std::vector<int>   output_tokens; g_output_tokens = &output_tokens;
@@ -607,6 +611,10 @@ int main(int argc, char ** argv) {
 
                         n_past -= n_discard;
 
+                        if ((int) tokens_in_kv.size() >= params.n_keep + n_discard) {
+                            tokens_in_kv.erase(tokens_in_kv.begin() + params.n_keep, tokens_in_kv.begin() + params.n_keep + n_discard);
+                        }
+
                         LOG_DBG("after swap: n_past = %d\n", n_past);
 
                         LOG_DBG("embd: %s\n", string_from(ctx, embd).c_str());
@@ -657,21 +665,63 @@ int main(int argc, char ** argv) {
                     }
                 }
                 if (i > 0) {
+                    tokens_in_kv.insert(tokens_in_kv.end(), embd.begin(), embd.begin() + i);
                     embd.erase(embd.begin(), embd.begin() + i);
                 }
             }
 
+            // move layers between the devices if the measured latency says the split is off, or take in
+            // devices that asked to join. the kv cache moves with the layers, if it was lost its tokens are evaluated again
+            bool resharded = false;
+            if (my_rank == 0 && ga_n == 1 && params.rebalance_interval > 0 && n_since_rebalance >= params.rebalance_interval) {
+                n_since_rebalance = 0;
+                resharded = llama_rebalance_layer_windows(ctx, model, llama_init.dev_info_set, params);
+            }
+            if (my_rank == 0 && ga_n == 1 && params.accept_join) {
+                resharded = llama_accept_join(ctx, model, llama_init.dev_info_set, params) || resharded;
+            }
+            if (resharded && llama_get_kv_cache_used_cells(ctx) == 0) {
+                embd.insert(embd.begin(), tokens_in_kv.begin(), tokens_in_kv.end());
+                tokens_in_kv.clear();
+                n_past = 0;
+
+                LOG_DBG("clear session path\n");
+                path_session.clear();
+            }
+
             if (my_rank == 0) {
-                for (int i = 0; i < (int) embd.size(); i += params.n_batch) {
+                for (int i = 0; i < (int) embd.size(); ) {
                     int n_eval = (int) embd.size() - i;
                     if (n_eval > params.n_batch) {
                         n_eval = params.n_batch;
                     }
-                    if (llama_decode(ctx, llama_batch_get_one(&embd[i], n_eval, n_past, 0)) != 0) {
+                    const int ret = llama_decode(ctx, llama_batch_get_one(&embd[i], n_eval, n_past, 0));
+                    if (ret == -3 && ga_n == 1 && llama_recover_ring_failure(ctx, llama_init.dev_info_set, params)) {
+                        if (llama_get_kv_cache_used_cells(ctx) > 0) {
+                            // the layers of the failed rank were restored from its replica, drop the aborted batch and retry it
+                            llama_kv_cache_seq_rm     (ctx, 0, n_past, -1);
+                            llama_send_kv_cache_seq_rm(ctx, 0, n_past, -1);
+                            continue;
+                        }
+
+                        // the kv cache went with the failed rank, evaluate everything again on the new ring
+                        embd.erase(embd.begin(), embd.begin() + i);
+                        embd.insert(embd.begin(), tokens_in_kv.begin(), tokens_in_kv.end());
+                        tokens_in_kv.clear();
+                        n_past = 0;
+                        i      = 0;
+
+                        LOG_DBG("clear session path\n");
+                        path_session.clear();
+                        continue;
+                    }
+                    if (ret != 0) {
                         LOG_ERR("%s : failed to eval\n", __func__);
                         return 1;
                     }
                     n_past += n_eval;
+                    tokens_in_kv.insert(tokens_in_kv.end(), embd.begin() + i, embd.begin() + i + n_eval);
+                    i += n_eval;
                 }
             } else {
                 llama_decode(ctx, llama_batch_get_one(embd.data(), 0, 0, 0));
@@ -708,6 +758,7 @@ int main(int argc, char ** argv) {
 
                 // decrement remaining sampling budget
                 --n_remain;
+                ++n_since_rebalance;
 
                 LOG_DBG("n_remain: %d\n", n_remain);
             } else {
@@ -107,7 +107,7 @@ static bool try_parse_ftype(const std::string & ftype_str_in, llama_ftype & ftyp
 //
 [[noreturn]]
 static void usage(const char * executable) {
-    printf("usage: %s [--help] [--allow-requantize] [--leave-output-tensor] [--pure] [--imatrix] [--include-weights] [--exclude-weights] [--output-tensor-type] [--token-embedding-type] [--override-kv] model-f32.gguf [model-quant.gguf] type [nthreads]\n\n", executable);
+    printf("usage: %s [--help] [--allow-requantize] [--leave-output-tensor] [--pure] [--imatrix] [--include-weights] [--exclude-weights] [--output-tensor-type] [--token-embedding-type] [--override-kv] [--layer-types] [--hybrid-type] [--hybrid-budget] [--hybrid-window] model-f32.gguf [model-quant.gguf] type [nthreads]\n\n", executable);
     printf("  --allow-requantize: Allows requantizing tensors that have already been quantized. Warning: This can severely reduce quality compared to quantizing from 16bit or 32bit\n");
     printf("  --leave-output-tensor: Will leave output.weight un(re)quantized. Increases model size but may also increase quality, especially when requantizing\n");
     printf("  --pure: Disable k-quant mixtures and quantize all tensors to the same type\n");
@@ -119,7 +119,12 @@ static void usage(const char * executable) {
     printf("  --keep-split: will generate quantized model in the same shards as input\n");
     printf("  --override-kv KEY=TYPE:VALUE\n");
     printf("      Advanced option to override model metadata by key in the quantized model. May be specified multiple times.\n");
+    printf("  --layer-types FIRST-LAST:type,...: quantize the layers FIRST..LAST (inclusive) with this type instead of the main type\n");
+    printf("  --hybrid-type type: quantize the least important layers with this type, the rest keep the main type. Requires --imatrix\n");
+    printf("  --hybrid-budget N: target size in GiB of the repeating layers for --hybrid-type, e.g. the memory that holds them\n");
+    printf("  --hybrid-window N: number of consecutive layers that share the same type for --hybrid-type (default: 1)\n");
     printf("Note: --include-weights and --exclude-weights cannot be used together\n");
+    printf("Note: --layer-types and --hybrid-type cannot be used together\n");
     printf("\nAllowed quantization types:\n");
     for (auto & it : QUANT_OPTIONS) {
         if (it.name != "COPY") {
@@ -234,6 +239,60 @@ static int prepare_imatrix(const std::string & imatrix_file,
     return m_last_call;
 }
 
+// parse a per-layer plan such as "0-19:Q4_K_M,20-79:IQ1_M", layers that are not listed keep the main type
+static bool parse_layer_ftypes(const char * arg, std::vector<llama_ftype> & layer_ftypes) {
+    std::string spec = arg;
+    size_t pos = 0;
+    while (pos < spec.size()) {
+        size_t end = spec.find(',', pos);
+        if (end == std::string::npos) {
+            end = spec.size();
+        }
+        const std::string item = spec.substr(pos, end - pos);
+        pos = end + 1;
+
+        const size_t sep = item.find(':');
+        if (sep == std::string::npos) {
+            fprintf(stderr, "%s: missing type in '%s'\n", __func__, item.c_str());
+            return false;
+        }
+
+        int first = -1;
+        int last  = -1;
+        const std::string range = item.substr(0, sep);
+        if (sscanf(range.c_str(), "%d-%d", &first, &last) == 1) {
+            last = first;
+        }
+        if (first < 0 || last < first) {
+            fprintf(stderr, "%s: invalid layer range '%s'\n", __func__, range.c_str());
+            return false;
+        }
+
+        llama_ftype ftype;
+        std::string ftype_str;
+        if (!try_parse_ftype(item.substr(sep + 1), ftype, ftype_str) || ftype_str == "COPY") {
+            fprintf(stderr, "%s: invalid ftype '%s'\n", __func__, item.substr(sep + 1).c_str());
+            return false;
+        }
+
+        if ((int) layer_ftypes.size() <= last) {
+            layer_ftypes.resize(last + 1, LLAMA_FTYPE_GUESSED);
+        }
+        for (int il = first; il <= last; ++il) {
+            layer_ftypes[il] = ftype;
+        }
+    }
+    return !layer_ftypes.empty();
+}
+
+static bool ftype_needs_imatrix(llama_ftype ftype) {
+    return ftype == LLAMA_FTYPE_MOSTLY_IQ2_XS || ftype == LLAMA_FTYPE_MOSTLY_IQ2_XXS ||
+           ftype == LLAMA_FTYPE_MOSTLY_IQ2_S  ||
+           ftype == LLAMA_FTYPE_MOSTLY_Q2_K_S ||
+           ftype == LLAMA_FTYPE_MOSTLY_IQ1_S  ||
+           ftype == LLAMA_FTYPE_MOSTLY_IQ1_M;
+}
+
 static ggml_type parse_ggml_type(const char * arg) {
     for (int i = 0; i < GGML_TYPE_COUNT; ++i) {
         auto type = (ggml_type)i;
@@ -257,6 +316,7 @@ int main(int argc, char ** argv) {
     std::string imatrix_file;
     std::vector<std::string> included_weights, excluded_weights;
     std::vector<llama_model_kv_override> kv_overrides;
+    std::vector<llama_ftype> layer_ftypes;
 
     for (; arg_idx < argc && strncmp(argv[arg_idx], "--", 2) == 0; arg_idx++) {
         if (strcmp(argv[arg_idx], "--leave-output-tensor") == 0) {
@@ -307,6 +367,27 @@ int main(int argc, char ** argv) {
             }
         } else if (strcmp(argv[arg_idx], "--keep-split") == 0) {
             params.keep_split = true;
+        } else if (strcmp(argv[arg_idx], "--layer-types") == 0) {
+            if (arg_idx == argc-1 || !parse_layer_ftypes(argv[++arg_idx], layer_ftypes)) {
+                usage(argv[0]);
+            }
+        } else if (strcmp(argv[arg_idx], "--hybrid-type") == 0) {
+            std::string ftype_str;
+            if (arg_idx == argc-1 || !try_parse_ftype(argv[++arg_idx], params.hybrid_ftype, ftype_str) || ftype_str == "COPY") {
+                usage(argv[0]);
+            }
+        } else if (strcmp(argv[arg_idx], "--hybrid-budget") == 0) {
+            if (arg_idx < argc-1) {
+                params.hybrid_budget = std::stof(argv[++arg_idx]);
+            } else {
+                usage(argv[0]);
+            }
+        } else if (strcmp(argv[arg_idx], "--hybrid-window") == 0) {
+            if (arg_idx < argc-1) {
+                params.hybrid_window = std::stoi(argv[++arg_idx]);
+            } else {
+                usage(argv[0]);
+            }
         } else {
             usage(argv[0]);
         }
@@ -319,6 +400,16 @@ int main(int argc, char ** argv) {
     if (!included_weights.empty() && !excluded_weights.empty()) {
         usage(argv[0]);
     }
+    if (!layer_ftypes.empty() && params.hybrid_ftype != LLAMA_FTYPE_GUESSED) {
+        usage(argv[0]);
+    }
+    if (params.hybrid_ftype != LLAMA_FTYPE_GUESSED && params.hybrid_budget <= 0.0f) {
+        fprintf(stderr, "%s: --hybrid-type needs a positive --hybrid-budget\n", __func__);
+        return 1;
+    }
+    if (!layer_ftypes.empty()) {
+        params.layer_ftypes = &layer_ftypes;
+    }
 
     std::string imatrix_dataset;
     std::unordered_map<std::string, std::vector<float>> imatrix_data;
@@ -421,11 +512,11 @@ int main(int argc, char ** argv) {
         }
     }
 
-    if ((params.ftype == LLAMA_FTYPE_MOSTLY_IQ2_XS || params.ftype == LLAMA_FTYPE_MOSTLY_IQ2_XXS ||
-         params.ftype == LLAMA_FTYPE_MOSTLY_IQ2_S  ||
-         params.ftype == LLAMA_FTYPE_MOSTLY_Q2_K_S ||
-         params.ftype == LLAMA_FTYPE_MOSTLY_IQ1_S  ||
-         params.ftype == LLAMA_FTYPE_MOSTLY_IQ1_M) && imatrix_data.empty()) {
+    bool needs_imatrix = ftype_needs_imatrix(params.ftype) || ftype_needs_imatrix(params.hybrid_ftype);
+    for (llama_ftype ftype : layer_ftypes) {
+        needs_imatrix |= ftype_needs_imatrix(ftype);
+    }
+    if (needs_imatrix && imatrix_data.empty()) {
         fprintf(stderr, "\n==========================================================================================================\n");
         fprintf(stderr, "Please do not use IQ1_S, IQ1_M, IQ2_S, IQ2_XXS, IQ2_XS or Q2_K_S quantization without an importance matrix\n");
         fprintf(stderr, "==========================================================================================================\n\n\n");
@@ -435,6 +526,9 @@ int main(int argc, char ** argv) {
     print_build_info();
 
     fprintf(stderr, "%s: quantizing '%s' to '%s' as %s", __func__, fname_inp.c_str(), fname_out.c_str(), ftype_str.c_str());
+    if (params.hybrid_ftype != LLAMA_FTYPE_GUESSED) {
+        fprintf(stderr, " with hybrid layers in a %.2f GiB budget", params.hybrid_budget);
+    }
     if (params.nthread > 0) {
         fprintf(stderr, " using %d threads", params.nthread);
     }
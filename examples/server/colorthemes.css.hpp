@@ -0,0 +1,715 @@
+unsigned char colorthemes_css[] = {
+ 0x40,  0x69,  0x6d,  0x70,  0x6f,  0x72,  0x74,  0x20,  0x75,  0x72,  0x6c,  0x28,  0x22,  0x74,  0x68,  0x65, 
+ 0x6d,  0x65,  0x2d,  0x73,  0x6e,  0x6f,  0x77,  0x73,  0x74,  0x6f,  0x72,  0x6d,  0x2e,  0x63,  0x73,  0x73, 
+ 0x22,  0x29,  0x3b,  0x0a,  0x40,  0x69,  0x6d,  0x70,  0x6f,  0x72,  0x74,  0x20,  0x75,  0x72,  0x6c,  0x28, 
+ 0x22,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x70,  0x6f,  0x6c,  0x61,  0x72,  0x6e,  0x69,  0x67,  0x68, 
+ 0x74,  0x2e,  0x63,  0x73,  0x73,  0x22,  0x29,  0x3b,  0x0a,  0x40,  0x69,  0x6d,  0x70,  0x6f,  0x72,  0x74, 
+ 0x20,  0x75,  0x72,  0x6c,  0x28,  0x22,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6b,  0x65,  0x74,  0x69, 
+ 0x76,  0x61,  0x68,  0x2e,  0x63,  0x73,  0x73,  0x22,  0x29,  0x3b,  0x0a,  0x40,  0x69,  0x6d,  0x70,  0x6f, 
+ 0x72,  0x74,  0x20,  0x75,  0x72,  0x6c,  0x28,  0x22,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6d,  0x61, 
+ 0x6e,  0x67,  0x6f,  0x74,  0x61,  0x6e,  0x67,  0x6f,  0x2e,  0x63,  0x73,  0x73,  0x22,  0x29,  0x3b,  0x0a, 
+ 0x40,  0x69,  0x6d,  0x70,  0x6f,  0x72,  0x74,  0x20,  0x75,  0x72,  0x6c,  0x28,  0x22,  0x74,  0x68,  0x65, 
+ 0x6d,  0x65,  0x2d,  0x70,  0x6c,  0x61,  0x79,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2e,  0x63,  0x73, 
+ 0x73,  0x22,  0x29,  0x3b,  0x0a,  0x40,  0x69,  0x6d,  0x70,  0x6f,  0x72,  0x74,  0x20,  0x75,  0x72,  0x6c, 
+ 0x28,  0x22,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x62,  0x65,  0x65,  0x6e,  0x69,  0x6e,  0x6f,  0x72, 
+ 0x64,  0x65,  0x72,  0x2e,  0x63,  0x73,  0x73,  0x22,  0x29,  0x3b,  0x0a,  0x0a,  0x3a,  0x72,  0x6f,  0x6f, 
+ 0x74,  0x20,  0x7b,  0x0a,  0x2f,  0x2a,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x20,  0x50,  0x52,  0x49,  0x4d,  0x41,  0x52,  0x59,  0x20,  0x43,  0x4f,  0x4c,  0x4f,  0x52,  0x53, 
+ 0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x3a,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x31,  0x37, 
+ 0x2e,  0x35,  0x2c,  0x20,  0x32,  0x36,  0x2e,  0x37,  0x25,  0x2c,  0x20,  0x39,  0x34,  0x2e,  0x31,  0x25, 
+ 0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x2d,  0x68,  0x75,  0x65,  0x3a,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x32,  0x31,  0x37,  0x2e,  0x35,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f, 
+ 0x6e,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x32,  0x36,  0x2e,  0x37,  0x25,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x20,  0x20,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x2d,  0x31,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x3a,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x39,  0x34,  0x2e,  0x31,  0x25,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d, 
+ 0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x3a, 
+ 0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x31,  0x38,  0x2e,  0x32,  0x2c,  0x20,  0x32,  0x36,  0x2e,  0x38, 
+ 0x25,  0x2c,  0x20,  0x39,  0x32,  0x2e,  0x30,  0x25,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d, 
+ 0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32, 
+ 0x2d,  0x68,  0x75,  0x65,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x32,  0x31,  0x38,  0x2e,  0x32,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x70, 
+ 0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x2d,  0x73, 
+ 0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x32,  0x36,  0x2e,  0x38,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x70,  0x72,  0x69, 
+ 0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x2d,  0x6c,  0x69,  0x67, 
+ 0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x39,  0x32, 
+ 0x2e,  0x30,  0x25,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x3a,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x31,  0x38, 
+ 0x2e,  0x38,  0x2c,  0x20,  0x32,  0x37,  0x2e,  0x39,  0x25,  0x2c,  0x20,  0x38,  0x38,  0x2e,  0x30,  0x25, 
+ 0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x68,  0x75,  0x65,  0x3a,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x32,  0x31,  0x38,  0x2e,  0x38,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f, 
+ 0x6e,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x32,  0x37,  0x2e,  0x39,  0x25,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x20,  0x20,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x3a,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x38,  0x38,  0x2e,  0x30,  0x25,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d, 
+ 0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x3a, 
+ 0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x31,  0x38,  0x2e,  0x38,  0x2c,  0x20,  0x31,  0x38,  0x2e,  0x33, 
+ 0x25,  0x2c,  0x20,  0x38,  0x31,  0x2e,  0x38,  0x25,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d, 
+ 0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34, 
+ 0x2d,  0x68,  0x75,  0x65,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x32,  0x31,  0x38,  0x2e,  0x38,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x70, 
+ 0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x2d,  0x73, 
+ 0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x31,  0x38,  0x2e,  0x33,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x70,  0x72,  0x69, 
+ 0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x2d,  0x6c,  0x69,  0x67, 
+ 0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x38,  0x31, 
+ 0x2e,  0x38,  0x25,  0x3b,  0x0a,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x53,  0x45,  0x43,  0x4f,  0x4e,  0x44,  0x41,  0x52,  0x59,  0x20,  0x43, 
+ 0x4f,  0x4c,  0x4f,  0x52,  0x53,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e, 
+ 0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x3a,  0x20,  0x68,  0x73, 
+ 0x6c,  0x28,  0x32,  0x32,  0x30,  0x2e,  0x30,  0x2c,  0x20,  0x31,  0x36,  0x2e,  0x34,  0x25,  0x2c,  0x20, 
+ 0x32,  0x31,  0x2e,  0x36,  0x25,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x73,  0x65, 
+ 0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x2d, 
+ 0x68,  0x75,  0x65,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x32,  0x32,  0x30,  0x2e,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x73,  0x65, 
+ 0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x2d, 
+ 0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x31,  0x36,  0x2e,  0x34,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x73,  0x65, 
+ 0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x2d, 
+ 0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x32,  0x31,  0x2e,  0x36,  0x25,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e, 
+ 0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x3a,  0x20,  0x68,  0x73, 
+ 0x6c,  0x28,  0x32,  0x32,  0x31,  0x2e,  0x37,  0x2c,  0x20,  0x31,  0x36,  0x2e,  0x33,  0x25,  0x2c,  0x20, 
+ 0x32,  0x37,  0x2e,  0x36,  0x25,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x73,  0x65, 
+ 0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x2d, 
+ 0x68,  0x75,  0x65,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x32,  0x32,  0x31,  0x2e,  0x37,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x73,  0x65, 
+ 0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x2d, 
+ 0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x31,  0x36,  0x2e,  0x33,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x73,  0x65, 
+ 0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x2d, 
+ 0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x32,  0x37,  0x2e,  0x36,  0x25,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e, 
+ 0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x3a,  0x20,  0x68,  0x73, 
+ 0x6c,  0x28,  0x32,  0x32,  0x30,  0x2e,  0x30,  0x2c,  0x20,  0x31,  0x36,  0x2e,  0x38,  0x25,  0x2c,  0x20, 
+ 0x33,  0x31,  0x2e,  0x36,  0x25,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x73,  0x65, 
+ 0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d, 
+ 0x68,  0x75,  0x65,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x32,  0x32,  0x30,  0x2e,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x73,  0x65, 
+ 0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d, 
+ 0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x31,  0x36,  0x2e,  0x38,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x73,  0x65, 
+ 0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d, 
+ 0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x33,  0x31,  0x2e,  0x36,  0x25,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e, 
+ 0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x3a,  0x20,  0x68,  0x73, 
+ 0x6c,  0x28,  0x32,  0x32,  0x30,  0x2e,  0x30,  0x2c,  0x20,  0x31,  0x36,  0x2e,  0x35,  0x25,  0x2c,  0x20, 
+ 0x33,  0x35,  0x2e,  0x37,  0x25,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x73,  0x65, 
+ 0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x2d, 
+ 0x68,  0x75,  0x65,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x32,  0x32,  0x30,  0x2e,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x73,  0x65, 
+ 0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x2d, 
+ 0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x31,  0x36,  0x2e,  0x35,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x73,  0x65, 
+ 0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x2d, 
+ 0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x33,  0x35,  0x2e,  0x37,  0x25,  0x3b,  0x0a,  0x0a,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x4e,  0x55,  0x41,  0x4e,  0x43,  0x45, 
+ 0x53,  0x20,  0x43,  0x4f,  0x4c,  0x4f,  0x52,  0x53,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2d,  0x2d,  0x74, 
+ 0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x31,  0x3a,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x31,  0x37,  0x38,  0x2e,  0x37,  0x2c,  0x20, 
+ 0x32,  0x35,  0x2e,  0x31,  0x25,  0x2c,  0x20,  0x36,  0x34,  0x2e,  0x39,  0x25,  0x29,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63, 
+ 0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x2d,  0x68,  0x75,  0x65,  0x3a,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x31,  0x37,  0x38,  0x2e,  0x37, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75, 
+ 0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x2d,  0x73,  0x61,  0x74, 
+ 0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x32,  0x35, 
+ 0x2e,  0x31,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65, 
+ 0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x2d, 
+ 0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x36,  0x34,  0x2e,  0x39,  0x25,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65, 
+ 0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x3a, 
+ 0x20,  0x68,  0x73,  0x6c,  0x28,  0x31,  0x39,  0x33,  0x2e,  0x33,  0x2c,  0x20,  0x34,  0x33,  0x2e,  0x34, 
+ 0x25,  0x2c,  0x20,  0x36,  0x37,  0x2e,  0x35,  0x25,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d, 
+ 0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x2d,  0x68,  0x75,  0x65,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x31,  0x39,  0x33,  0x2e,  0x33,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74, 
+ 0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x34,  0x33,  0x2e,  0x34,  0x25,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61, 
+ 0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x2d,  0x6c,  0x69,  0x67,  0x68, 
+ 0x74,  0x6e,  0x65,  0x73,  0x73,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x36,  0x37,  0x2e, 
+ 0x35,  0x25,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61, 
+ 0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x3a,  0x20,  0x68,  0x73,  0x6c, 
+ 0x28,  0x32,  0x31,  0x30,  0x2e,  0x30,  0x2c,  0x20,  0x33,  0x34,  0x2e,  0x30,  0x25,  0x2c,  0x20,  0x36, 
+ 0x33,  0x2e,  0x31,  0x25,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65, 
+ 0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d, 
+ 0x33,  0x2d,  0x68,  0x75,  0x65,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x32,  0x31,  0x30,  0x2e,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d, 
+ 0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x33,  0x34,  0x2e,  0x30,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73, 
+ 0x73,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x36,  0x33,  0x2e,  0x31,  0x25,  0x3b,  0x0a, 
+ 0x0a,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x3a,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x31,  0x33, 
+ 0x2e,  0x31,  0x2c,  0x20,  0x33,  0x32,  0x2e,  0x30,  0x25,  0x2c,  0x20,  0x35,  0x32,  0x2e,  0x32,  0x25, 
+ 0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e, 
+ 0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x2d,  0x68,  0x75, 
+ 0x65,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x32, 
+ 0x31,  0x33,  0x2e,  0x31,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d, 
+ 0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34, 
+ 0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x33,  0x32,  0x2e,  0x30,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74, 
+ 0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x34,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x3a,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x35,  0x32,  0x2e,  0x32,  0x25,  0x3b,  0x0a,  0x0a,  0x0a,  0x0a,  0x2f, 
+ 0x2a,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x52,  0x4f, 
+ 0x59,  0x47,  0x50,  0x20,  0x43,  0x4f,  0x4c,  0x4f,  0x52,  0x53,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x2a,  0x2f, 
+ 0x0a,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x72,  0x65,  0x64,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x33,  0x32,  0x2e,  0x35,  0x2c, 
+ 0x20,  0x38,  0x30,  0x25,  0x2c,  0x20,  0x35,  0x30,  0x25,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x74,  0x68, 
+ 0x65,  0x6d,  0x65,  0x2d,  0x6f,  0x72,  0x61,  0x6e,  0x67,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x3a,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x33,  0x32,  0x2e,  0x35,  0x2c,  0x20,  0x37,  0x30,  0x25,  0x2c, 
+ 0x20,  0x34,  0x35,  0x25,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x79, 
+ 0x65,  0x6c,  0x6c,  0x6f,  0x77,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x68,  0x73,  0x6c, 
+ 0x28,  0x34,  0x30,  0x2e,  0x30,  0x2c,  0x20,  0x20,  0x20,  0x30,  0x2e,  0x36,  0x25,  0x2c,  0x20,  0x37, 
+ 0x33,  0x2e,  0x33,  0x25,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x67, 
+ 0x72,  0x65,  0x65,  0x6e,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x20,  0x68,  0x73,  0x6c, 
+ 0x28,  0x39,  0x32,  0x2e,  0x34,  0x2c,  0x20,  0x20,  0x32,  0x37,  0x2e,  0x38,  0x25,  0x2c,  0x20,  0x36, 
+ 0x34,  0x2e,  0x37,  0x25,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x70, 
+ 0x75,  0x72,  0x70,  0x6c,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x68,  0x73,  0x6c, 
+ 0x28,  0x33,  0x31,  0x31,  0x2e,  0x31,  0x2c,  0x20,  0x32,  0x30,  0x2e,  0x32,  0x25,  0x2c,  0x20,  0x36, 
+ 0x33,  0x2e,  0x31,  0x25,  0x29,  0x3b,  0x0a,  0x0a,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2d,  0x2d,  0x62,  0x61, 
+ 0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31, 
+ 0x3a,  0x20,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61, 
+ 0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x62, 
+ 0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d, 
+ 0x32,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d, 
+ 0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29,  0x3b,  0x0a,  0x2d,  0x2d, 
+ 0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x2d,  0x33,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69, 
+ 0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x29,  0x3b,  0x0a,  0x2d, 
+ 0x2d,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x34,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72, 
+ 0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x29,  0x3b,  0x0a, 
+ 0x0a,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d, 
+ 0x31,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d, 
+ 0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29, 
+ 0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x2d,  0x32,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d, 
+ 0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33, 
+ 0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x33,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28, 
+ 0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d, 
+ 0x34,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x66,  0x6f, 
+ 0x63,  0x75,  0x73,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x76,  0x61, 
+ 0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x6f,  0x72, 
+ 0x64,  0x65,  0x72,  0x2d,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77, 
+ 0x3a,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d, 
+ 0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x29,  0x3b, 
+ 0x0a,  0x0a,  0x2d,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x70, 
+ 0x6c,  0x61,  0x69,  0x6e,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d, 
+ 0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x2d,  0x31,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x73,  0x75,  0x62,  0x74,  0x69,  0x6c,  0x65,  0x2d,  0x31,  0x3a,  0x20,  0x20,  0x76,  0x61, 
+ 0x72,  0x28,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x73,  0x75,  0x62,  0x74,  0x69,  0x6c,  0x65,  0x2d,  0x32,  0x3a,  0x20, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x63,  0x6f, 
+ 0x64,  0x65,  0x2d,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e, 
+ 0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29,  0x3b,  0x0a,  0x2d, 
+ 0x2d,  0x63,  0x6f,  0x64,  0x65,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72, 
+ 0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29,  0x3b,  0x0a, 
+ 0x0a,  0x2d,  0x2d,  0x75,  0x69,  0x2d,  0x72,  0x61,  0x6e,  0x67,  0x65,  0x2d,  0x74,  0x68,  0x75,  0x6d, 
+ 0x62,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d, 
+ 0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x2d,  0x33,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x75,  0x69,  0x2d,  0x72,  0x61,  0x6e,  0x67, 
+ 0x65,  0x2d,  0x74,  0x68,  0x75,  0x6d,  0x62,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20, 
+ 0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x75,  0x69,  0x2d,  0x72,  0x61,  0x6e,  0x67,  0x65,  0x72,  0x2d, 
+ 0x74,  0x68,  0x75,  0x6d,  0x62,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x0a,  0x2d, 
+ 0x2d,  0x74,  0x65,  0x78,  0x74,  0x61,  0x72,  0x65,  0x61,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x73,  0x65, 
+ 0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x29, 
+ 0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x63,  0x68,  0x61,  0x74,  0x2d,  0x69,  0x64,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28, 
+ 0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x29,  0x3b,  0x0a,  0x0a,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2d,  0x2d, 
+ 0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x61,  0x6c,  0x65,  0x72,  0x74,  0x2d,  0x74,  0x65,  0x78, 
+ 0x74,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x76, 
+ 0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x2d,  0x31,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d, 
+ 0x61,  0x6c,  0x65,  0x72,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x68,  0x6f,  0x76,  0x65, 
+ 0x72,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68, 
+ 0x65,  0x6d,  0x65,  0x2d,  0x6f,  0x72,  0x61,  0x6e,  0x67,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x61,  0x6c,  0x65,  0x72, 
+ 0x74,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x3a,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d, 
+ 0x6f,  0x72,  0x61,  0x6e,  0x67,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x0a, 
+ 0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x61,  0x6c,  0x65,  0x72,  0x74,  0x2d,  0x74, 
+ 0x65,  0x78,  0x74,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f, 
+ 0x6e,  0x2d,  0x61,  0x6c,  0x65,  0x72,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x61,  0x63, 
+ 0x74,  0x69,  0x76,  0x65,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d, 
+ 0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x72,  0x65,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29, 
+ 0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x61,  0x6c,  0x65,  0x72,  0x74, 
+ 0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x3a,  0x20, 
+ 0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x72, 
+ 0x65,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x0a,  0x0a,  0x0a,  0x2f,  0x2a, 
+ 0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x50,  0x52,  0x49, 
+ 0x4d,  0x41,  0x52,  0x59,  0x20,  0x42,  0x55,  0x54,  0x54,  0x4f,  0x4e,  0x53,  0x20,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a, 
+ 0x2f,  0x2a,  0x20,  0x2d,  0x20,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x20,  0x73,  0x68,  0x6f,  0x75, 
+ 0x6c,  0x64,  0x20,  0x69,  0x6d,  0x6d,  0x65,  0x64,  0x69,  0x61,  0x74,  0x65,  0x6c,  0x79,  0x20,  0x63, 
+ 0x61,  0x74,  0x63,  0x68,  0x20,  0x74,  0x68,  0x65,  0x20,  0x65,  0x79,  0x65,  0x20,  0x2d,  0x20,  0x2a, 
+ 0x2f,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61, 
+ 0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x3a,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d, 
+ 0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x2d,  0x31,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72, 
+ 0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x20,  0x76,  0x61, 
+ 0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74, 
+ 0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64, 
+ 0x65,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d, 
+ 0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x29,  0x3b, 
+ 0x0a,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x68, 
+ 0x6f,  0x76,  0x65,  0x72,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x2a, 
+ 0x2f,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61, 
+ 0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x3a,  0x0a,  0x20, 
+ 0x20,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x31,  0x37,  0x2e,  0x35,  0x2c,  0x0a,  0x20,  0x20, 
+ 0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x73,  0x65,  0x63, 
+ 0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x2d,  0x73, 
+ 0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2b,  0x20,  0x33,  0x35,  0x25, 
+ 0x29,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28, 
+ 0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x31,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x29,  0x20,  0x20, 
+ 0x2d,  0x20,  0x33,  0x30,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74, 
+ 0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x3a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28, 
+ 0x32,  0x31,  0x30,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61, 
+ 0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74, 
+ 0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2d,  0x20,  0x20,  0x32,  0x25,  0x29,  0x2c,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d, 
+ 0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33, 
+ 0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x29,  0x20,  0x20,  0x2d,  0x20,  0x31, 
+ 0x30,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d, 
+ 0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x68, 
+ 0x6f,  0x76,  0x65,  0x72,  0x3a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x31, 
+ 0x30,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28, 
+ 0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f, 
+ 0x6e,  0x29,  0x20,  0x2d,  0x20,  0x20,  0x32,  0x25,  0x29,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63, 
+ 0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d, 
+ 0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c, 
+ 0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x29,  0x20,  0x20,  0x2d,  0x20,  0x31,  0x30,  0x25, 
+ 0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72, 
+ 0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76, 
+ 0x65,  0x3a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x31,  0x30,  0x2c,  0x0a, 
+ 0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74, 
+ 0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x33,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20, 
+ 0x2d,  0x20,  0x32,  0x30,  0x25,  0x29,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63, 
+ 0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61, 
+ 0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68, 
+ 0x74,  0x6e,  0x65,  0x73,  0x73,  0x29,  0x20,  0x20,  0x2b,  0x20,  0x33,  0x35,  0x25,  0x29,  0x29,  0x3b, 
+ 0x0a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61, 
+ 0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x3a, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x31,  0x30,  0x2c,  0x0a,  0x20,  0x20, 
+ 0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65, 
+ 0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d, 
+ 0x33,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2d,  0x20, 
+ 0x31,  0x30,  0x25,  0x29,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76, 
+ 0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63, 
+ 0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e, 
+ 0x65,  0x73,  0x73,  0x29,  0x20,  0x20,  0x2d,  0x20,  0x32,  0x35,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a, 
+ 0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79, 
+ 0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x3a,  0x0a, 
+ 0x20,  0x20,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x31,  0x30,  0x2c,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d, 
+ 0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33, 
+ 0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2d,  0x20,  0x31, 
+ 0x30,  0x25,  0x29,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61, 
+ 0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65, 
+ 0x73,  0x73,  0x29,  0x20,  0x20,  0x2d,  0x20,  0x32,  0x35,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x0a, 
+ 0x0a,  0x2f,  0x2a,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x53, 
+ 0x45,  0x43,  0x4f,  0x4e,  0x44,  0x41,  0x52,  0x59,  0x20,  0x42,  0x55,  0x54,  0x54,  0x4f,  0x4e,  0x53, 
+ 0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20, 
+ 0x2a,  0x2f,  0x0a,  0x2f,  0x2a,  0x20,  0x74,  0x68,  0x65,  0x73,  0x65,  0x20,  0x73,  0x68,  0x6f,  0x75, 
+ 0x6c,  0x64,  0x20,  0x4e,  0x4f,  0x54,  0x20,  0x69,  0x6d,  0x6d,  0x65,  0x64,  0x69,  0x61,  0x74,  0x65, 
+ 0x6c,  0x79,  0x20,  0x63,  0x61,  0x74,  0x63,  0x68,  0x20,  0x74,  0x68,  0x65,  0x20,  0x65,  0x79,  0x65, 
+ 0x20,  0x20,  0x2a,  0x2f,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65, 
+ 0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x3a,  0x0a,  0x20,  0x20, 
+ 0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x31,  0x30,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63, 
+ 0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d, 
+ 0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73, 
+ 0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2d,  0x20,  0x32,  0x30,  0x25, 
+ 0x29,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28, 
+ 0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73, 
+ 0x29,  0x20,  0x20,  0x2d,  0x20,  0x35,  0x30,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x62, 
+ 0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32, 
+ 0x31,  0x30,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72, 
+ 0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69, 
+ 0x6f,  0x6e,  0x29,  0x20,  0x2d,  0x20,  0x32,  0x30,  0x25,  0x29,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20, 
+ 0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65, 
+ 0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d, 
+ 0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x29,  0x20,  0x20,  0x2b,  0x20,  0x31,  0x30, 
+ 0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73, 
+ 0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x31,  0x30,  0x2c,  0x0a,  0x20,  0x20, 
+ 0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65, 
+ 0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d, 
+ 0x33,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2d,  0x20, 
+ 0x32,  0x30,  0x25,  0x29,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76, 
+ 0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63, 
+ 0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e, 
+ 0x65,  0x73,  0x73,  0x29,  0x20,  0x20,  0x2b,  0x20,  0x31,  0x30,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a, 
+ 0x0a,  0x2f,  0x2a,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x68,  0x6f,  0x76, 
+ 0x65,  0x72,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a, 
+ 0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61, 
+ 0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x3a,  0x0a,  0x20, 
+ 0x20,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x31,  0x30,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20, 
+ 0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65, 
+ 0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d, 
+ 0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2d,  0x20,  0x32,  0x30, 
+ 0x25,  0x29,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72, 
+ 0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73, 
+ 0x73,  0x29,  0x20,  0x20,  0x2d,  0x20,  0x38,  0x30,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d, 
+ 0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x3a,  0x0a,  0x20,  0x20, 
+ 0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x31,  0x30,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63, 
+ 0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d, 
+ 0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73, 
+ 0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2d,  0x20,  0x32,  0x32,  0x25, 
+ 0x29,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28, 
+ 0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73, 
+ 0x29,  0x20,  0x20,  0x2b,  0x20,  0x20,  0x31,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x62, 
+ 0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d, 
+ 0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x3a,  0x0a,  0x20,  0x20, 
+ 0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x31,  0x30,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63, 
+ 0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d, 
+ 0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73, 
+ 0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2d,  0x20,  0x32,  0x32,  0x25, 
+ 0x29,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28, 
+ 0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73, 
+ 0x29,  0x20,  0x20,  0x2b,  0x20,  0x20,  0x31,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x0a,  0x2f,  0x2a, 
+ 0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2d,  0x2d,  0x62, 
+ 0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d, 
+ 0x74,  0x65,  0x78,  0x74,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x3a,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x31,  0x30,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61, 
+ 0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e, 
+ 0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73,  0x61, 
+ 0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2b,  0x20,  0x34,  0x30,  0x25,  0x29, 
+ 0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d, 
+ 0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x29, 
+ 0x20,  0x20,  0x2d,  0x20,  0x35,  0x35,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x62,  0x75, 
+ 0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x3a,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x31,  0x30,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61, 
+ 0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e, 
+ 0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73,  0x61, 
+ 0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2d,  0x20,  0x33,  0x30,  0x25,  0x29, 
+ 0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d, 
+ 0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x29, 
+ 0x20,  0x20,  0x2d,  0x20,  0x20,  0x35,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x62,  0x75, 
+ 0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x62, 
+ 0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x3a,  0x0a,  0x20,  0x20, 
+ 0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x31,  0x30,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63, 
+ 0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d, 
+ 0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73, 
+ 0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2d,  0x20,  0x33,  0x30,  0x25, 
+ 0x29,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28, 
+ 0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73, 
+ 0x29,  0x20,  0x20,  0x2d,  0x20,  0x20,  0x35,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x0a,  0x0a,  0x2f, 
+ 0x2a,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x54,  0x45,  0x52, 
+ 0x54,  0x49,  0x41,  0x52,  0x59,  0x20,  0x42,  0x55,  0x54,  0x54,  0x4f,  0x4e,  0x53,  0x20,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x2a,  0x2f, 
+ 0x0a,  0x2f,  0x2a,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x64, 
+ 0x69,  0x73,  0x61,  0x62,  0x6c,  0x65,  0x64,  0x20,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x73,  0x20, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20, 
+ 0x2a,  0x2f,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x74,  0x65,  0x72,  0x74, 
+ 0x69,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x3a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x68, 
+ 0x73,  0x6c,  0x28,  0x32,  0x31,  0x30,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63, 
+ 0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61, 
+ 0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73,  0x61,  0x74,  0x75, 
+ 0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2d,  0x20,  0x34,  0x30,  0x25,  0x29,  0x2c,  0x0a, 
+ 0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74, 
+ 0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x29,  0x20,  0x20, 
+ 0x2d,  0x20,  0x20,  0x35,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74, 
+ 0x6f,  0x6e,  0x2d,  0x74,  0x65,  0x72,  0x74,  0x69,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x3a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x31,  0x30,  0x2c,  0x0a, 
+ 0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74, 
+ 0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x33,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20, 
+ 0x2d,  0x20,  0x34,  0x30,  0x25,  0x29,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63, 
+ 0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61, 
+ 0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68, 
+ 0x74,  0x6e,  0x65,  0x73,  0x73,  0x29,  0x20,  0x20,  0x2b,  0x20,  0x32,  0x30,  0x25,  0x29,  0x29,  0x3b, 
+ 0x0a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x74,  0x65,  0x72,  0x74,  0x69, 
+ 0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x0a,  0x20,  0x20,  0x20,  0x20, 
+ 0x68,  0x73,  0x6c,  0x28,  0x32,  0x31,  0x30,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c, 
+ 0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75, 
+ 0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73,  0x61,  0x74, 
+ 0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2d,  0x20,  0x34,  0x30,  0x25,  0x29,  0x2c, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d, 
+ 0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x29,  0x20, 
+ 0x20,  0x2b,  0x20,  0x32,  0x30,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74, 
+ 0x6f,  0x6e,  0x2d,  0x74,  0x65,  0x72,  0x74,  0x69,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74, 
+ 0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x3a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28, 
+ 0x32,  0x31,  0x30,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61, 
+ 0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74, 
+ 0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2d,  0x20,  0x34,  0x30,  0x25,  0x29,  0x2c,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d, 
+ 0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33, 
+ 0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x29,  0x20,  0x20,  0x2d,  0x20,  0x20, 
+ 0x35,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d, 
+ 0x74,  0x65,  0x72,  0x74,  0x69,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x68, 
+ 0x6f,  0x76,  0x65,  0x72,  0x3a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x31, 
+ 0x30,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28, 
+ 0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f, 
+ 0x6e,  0x29,  0x20,  0x2d,  0x20,  0x34,  0x30,  0x25,  0x29,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63, 
+ 0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d, 
+ 0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c, 
+ 0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x29,  0x20,  0x20,  0x2b,  0x20,  0x32,  0x30,  0x25, 
+ 0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x74,  0x65, 
+ 0x72,  0x74,  0x69,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x68,  0x6f, 
+ 0x76,  0x65,  0x72,  0x3a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x31,  0x30, 
+ 0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d, 
+ 0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e, 
+ 0x29,  0x20,  0x2d,  0x20,  0x34,  0x30,  0x25,  0x29,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61, 
+ 0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e, 
+ 0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69, 
+ 0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x29,  0x20,  0x20,  0x2b,  0x20,  0x32,  0x30,  0x25,  0x29, 
+ 0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2f,  0x2a,  0x0a,  0x0a,  0x2e,  0x74,  0x68,  0x65,  0x6d,  0x65, 
+ 0x2d,  0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x20,  0x7b,  0x0a,  0x0a,  0x0a,  0x20,  0x20, 
+ 0x20,  0x20,  0x49,  0x66,  0x20,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x20,  0x74,  0x68,  0x65,  0x6d,  0x65, 
+ 0x3a,  0x20,  0x73,  0x68,  0x6f,  0x75,  0x6c,  0x64,  0x20,  0x67,  0x6f,  0x20,  0x66,  0x72,  0x6f,  0x6d, 
+ 0x20,  0x62,  0x72,  0x69,  0x67,  0x68,  0x74,  0x20,  0x74,  0x6f,  0x20,  0x64,  0x61,  0x72,  0x6b,  0x65, 
+ 0x72,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x49,  0x66,  0x20,  0x64,  0x61,  0x72,  0x6b,  0x20,  0x74,  0x68, 
+ 0x65,  0x6d,  0x65,  0x3a,  0x20,  0x73,  0x68,  0x6f,  0x75,  0x6c,  0x64,  0x20,  0x67,  0x6f,  0x20,  0x66, 
+ 0x72,  0x6f,  0x6d,  0x20,  0x64,  0x61,  0x72,  0x6b,  0x20,  0x74,  0x6f,  0x20,  0x62,  0x72,  0x69,  0x67, 
+ 0x68,  0x74,  0x65,  0x72,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x69,  0x64,  0x65,  0x61,  0x6c,  0x6c,  0x79, 
+ 0x20,  0x74,  0x68,  0x69,  0x73,  0x20,  0x73,  0x68,  0x6f,  0x75,  0x6c,  0x64,  0x20,  0x6e,  0x6f,  0x74, 
+ 0x20,  0x62,  0x65,  0x20,  0x61,  0x6e,  0x79,  0x74,  0x68,  0x69,  0x6e,  0x67,  0x20,  0x62,  0x75,  0x74, 
+ 0x20,  0x73,  0x74,  0x65,  0x70,  0x73,  0x20,  0x6f,  0x66,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x67,  0x72, 
+ 0x61,  0x79,  0x20,  0x6f,  0x72,  0x20,  0x73,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6c,  0x79,  0x20,  0x76, 
+ 0x61,  0x72,  0x69,  0x61,  0x6e,  0x74,  0x73,  0x20,  0x66,  0x72,  0x6f,  0x6d,  0x20,  0x69,  0x74,  0x0a, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x3a,  0x20,  0x23,  0x32,  0x45,  0x33,  0x34,  0x34,  0x30,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x3a,  0x20,  0x23,  0x33,  0x42,  0x34,  0x32,  0x35,  0x32,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x3a,  0x20,  0x23,  0x34,  0x33,  0x34,  0x43,  0x35,  0x45,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x3a,  0x20,  0x23,  0x34,  0x43,  0x35,  0x36,  0x36,  0x41,  0x3b, 
+ 0x0a,  0x0a,  0x0a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x49,  0x66,  0x20,  0x6c,  0x69,  0x67,  0x68,  0x74, 
+ 0x20,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x3a,  0x20,  0x73,  0x68,  0x6f,  0x75,  0x6c,  0x64,  0x20,  0x67, 
+ 0x6f,  0x20,  0x66,  0x72,  0x6f,  0x6d,  0x20,  0x64,  0x61,  0x72,  0x6b,  0x20,  0x74,  0x6f,  0x20,  0x62, 
+ 0x72,  0x69,  0x67,  0x68,  0x74,  0x65,  0x72,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x49,  0x66,  0x20,  0x64, 
+ 0x61,  0x72,  0x6b,  0x20,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x3a,  0x20,  0x73,  0x68,  0x6f,  0x75,  0x6c, 
+ 0x64,  0x20,  0x67,  0x6f,  0x20,  0x66,  0x72,  0x6f,  0x6d,  0x20,  0x62,  0x72,  0x69,  0x67,  0x68,  0x74, 
+ 0x20,  0x74,  0x6f,  0x20,  0x64,  0x61,  0x72,  0x6b,  0x65,  0x72,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x69, 
+ 0x64,  0x65,  0x61,  0x6c,  0x6c,  0x79,  0x20,  0x74,  0x68,  0x69,  0x73,  0x20,  0x73,  0x68,  0x6f,  0x75, 
+ 0x6c,  0x64,  0x20,  0x6e,  0x6f,  0x74,  0x20,  0x62,  0x65,  0x20,  0x61,  0x6e,  0x79,  0x74,  0x68,  0x69, 
+ 0x6e,  0x67,  0x20,  0x62,  0x75,  0x74,  0x20,  0x73,  0x74,  0x65,  0x70,  0x73,  0x20,  0x6f,  0x66,  0x0a, 
+ 0x20,  0x20,  0x20,  0x20,  0x67,  0x72,  0x61,  0x79,  0x20,  0x6f,  0x72,  0x20,  0x73,  0x6c,  0x69,  0x67, 
+ 0x68,  0x74,  0x6c,  0x79,  0x20,  0x76,  0x61,  0x72,  0x69,  0x61,  0x6e,  0x74,  0x73,  0x20,  0x66,  0x72, 
+ 0x6f,  0x6d,  0x20,  0x69,  0x74,  0x0a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x73,  0x65,  0x63, 
+ 0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x3a,  0x20, 
+ 0x23,  0x45,  0x43,  0x45,  0x46,  0x46,  0x34,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x73, 
+ 0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32, 
+ 0x3a,  0x20,  0x23,  0x45,  0x35,  0x45,  0x39,  0x46,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d, 
+ 0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x2d,  0x33,  0x3a,  0x20,  0x23,  0x44,  0x38,  0x44,  0x45,  0x45,  0x39,  0x3b,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x2d,  0x34,  0x3a,  0x20,  0x23,  0x43,  0x38,  0x43,  0x45,  0x44,  0x39,  0x3b,  0x0a,  0x0a, 
+ 0x0a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x43,  0x68,  0x6f,  0x6f,  0x73,  0x65,  0x20,  0x77,  0x69,  0x73, 
+ 0x65,  0x6c,  0x79,  0x20,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x73,  0x2e,  0x20,  0x49,  0x74,  0x20,  0x69,  0x73,  0x20,  0x6e,  0x6f,  0x74,  0x20,  0x65,  0x61,  0x73, 
+ 0x79,  0x20,  0x74,  0x6f,  0x20,  0x66,  0x69,  0x6e,  0x64,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x34,  0x20, 
+ 0x68,  0x61,  0x72,  0x6d,  0x6f,  0x6e,  0x69,  0x7a,  0x69,  0x6e,  0x67,  0x20,  0x6e,  0x75,  0x61,  0x6e, 
+ 0x63,  0x65,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x73,  0x2e,  0x20,  0x42,  0x75,  0x74,  0x20,  0x6b, 
+ 0x65,  0x65,  0x70,  0x20,  0x69,  0x6e,  0x20,  0x6d,  0x69,  0x6e,  0x64,  0x2c,  0x20,  0x74,  0x68,  0x61, 
+ 0x74,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x6f,  0x6e,  0x6c,  0x79,  0x20,  0x6f,  0x6e,  0x65,  0x20,  0x61, 
+ 0x63,  0x63,  0x65,  0x6e,  0x74,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x20,  0x63,  0x6f,  0x75,  0x6c, 
+ 0x64,  0x20,  0x77,  0x6f,  0x72,  0x6b,  0x20,  0x74,  0x6f,  0x6f,  0x2e,  0x0a,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x3a,  0x20,  0x23,  0x38,  0x46,  0x42,  0x43,  0x42,  0x42, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75, 
+ 0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x3a,  0x20,  0x23,  0x38, 
+ 0x38,  0x43,  0x30,  0x44,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65, 
+ 0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d, 
+ 0x33,  0x3a,  0x20,  0x23,  0x38,  0x31,  0x41,  0x31,  0x43,  0x31,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20, 
+ 0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x3a,  0x20,  0x23,  0x35,  0x45,  0x38,  0x31,  0x41,  0x43,  0x3b, 
+ 0x0a,  0x0a,  0x0a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x61,  0x64,  0x61,  0x70,  0x74,  0x20,  0x74,  0x68, 
+ 0x65,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x20,  0x72,  0x65,  0x64,  0x2c,  0x20,  0x6f,  0x72,  0x61, 
+ 0x6e,  0x67,  0x65,  0x2c,  0x20,  0x79,  0x65,  0x6c,  0x6c,  0x6f,  0x77,  0x2c,  0x20,  0x67,  0x72,  0x65, 
+ 0x65,  0x6e,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x70,  0x75,  0x72,  0x70,  0x6c,  0x65,  0x20,  0x74, 
+ 0x6f,  0x20,  0x74,  0x68,  0x65,  0x20,  0x27,  0x6d,  0x6f,  0x6f,  0x64,  0x27,  0x20,  0x6f,  0x66,  0x20, 
+ 0x79,  0x6f,  0x75,  0x72,  0x20,  0x6f,  0x76,  0x65,  0x72,  0x61,  0x6c,  0x6c,  0x20,  0x64,  0x65,  0x73, 
+ 0x69,  0x67,  0x6e,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x65,  0x2e,  0x67,  0x20,  0x69,  0x73,  0x20,  0x69, 
+ 0x74,  0x20,  0x6c,  0x6f,  0x77,  0x2d,  0x63,  0x6f,  0x6e,  0x74,  0x72,  0x61,  0x73,  0x74,  0x3f,  0x20, 
+ 0x76,  0x69,  0x62,  0x72,  0x61,  0x6e,  0x74,  0x3f,  0x20,  0x64,  0x79,  0x6e,  0x61,  0x6d,  0x69,  0x63, 
+ 0x3f,  0x20,  0x65,  0x74,  0x63,  0x0a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65, 
+ 0x6d,  0x65,  0x2d,  0x72,  0x65,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x20,  0x20, 
+ 0x20,  0x23,  0x42,  0x46,  0x36,  0x31,  0x36,  0x41,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d, 
+ 0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6f,  0x72,  0x61,  0x6e,  0x67,  0x65,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x3a,  0x20,  0x23,  0x44,  0x30,  0x38,  0x37,  0x37,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x79,  0x65,  0x6c,  0x6c,  0x6f,  0x77,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x23,  0x45,  0x42,  0x43,  0x42,  0x38,  0x42,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x67,  0x72,  0x65,  0x65, 
+ 0x6e,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x20,  0x23,  0x41,  0x33,  0x42,  0x45,  0x38, 
+ 0x43,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x70, 
+ 0x75,  0x72,  0x70,  0x6c,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x23,  0x42,  0x34, 
+ 0x38,  0x45,  0x41,  0x44,  0x3b,  0x0a,  0x0a,  0x0a,  0x0a,  0x4e,  0x4f,  0x54,  0x45,  0x3a,  0x20,  0x63, 
+ 0x6f,  0x6d,  0x6d,  0x65,  0x6e,  0x74,  0x20,  0x61,  0x6c,  0x6c,  0x20,  0x74,  0x68,  0x6f,  0x73,  0x65, 
+ 0x20,  0x6c,  0x69,  0x6e,  0x65,  0x20,  0x60,  0x2d,  0x2d,  0x2d,  0x20,  0x2e,  0x2e,  0x2e,  0x60,  0x20, 
+ 0x6f,  0x75,  0x74,  0x0a,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x0a,  0x2d,  0x2d,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e, 
+ 0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x3a,  0x0a,  0x2d,  0x2d,  0x62,  0x61,  0x63, 
+ 0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x3a, 
+ 0x0a,  0x2d,  0x2d,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x3a,  0x0a,  0x2d,  0x2d,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f, 
+ 0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x3a,  0x0a,  0x0a,  0x2d,  0x2d, 
+ 0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x3a,  0x0a, 
+ 0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32, 
+ 0x3a,  0x0a,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x2d,  0x33,  0x3a,  0x0a,  0x0a,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x66,  0x6f, 
+ 0x63,  0x75,  0x73,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x0a,  0x2d,  0x2d,  0x62,  0x6f,  0x72, 
+ 0x64,  0x65,  0x72,  0x2d,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77, 
+ 0x3a,  0x0a,  0x0a,  0x2d,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d, 
+ 0x70,  0x6c,  0x61,  0x69,  0x6e,  0x3a,  0x0a,  0x2d,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x73,  0x75,  0x62,  0x74,  0x69,  0x6c,  0x65,  0x2d,  0x31,  0x3a,  0x0a,  0x2d, 
+ 0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x73,  0x75,  0x62,  0x74, 
+ 0x69,  0x6c,  0x65,  0x2d,  0x32,  0x3a,  0x0a,  0x0a,  0x2d,  0x2d,  0x63,  0x6f,  0x64,  0x65,  0x2d,  0x62, 
+ 0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a, 
+ 0x0a,  0x2d,  0x2d,  0x63,  0x6f,  0x64,  0x65,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x3a,  0x0a,  0x0a,  0x2d,  0x2d,  0x75,  0x69,  0x2d,  0x72,  0x61,  0x6e,  0x67,  0x65,  0x2d, 
+ 0x74,  0x68,  0x75,  0x6d,  0x62,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x0a,  0x2d,  0x2d,  0x75, 
+ 0x69,  0x2d,  0x72,  0x61,  0x6e,  0x67,  0x65,  0x2d,  0x74,  0x68,  0x75,  0x6d,  0x62,  0x2d,  0x62,  0x6f, 
+ 0x72,  0x64,  0x65,  0x72,  0x3a,  0x0a,  0x0a,  0x2d,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x61,  0x72,  0x65, 
+ 0x61,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x0a, 
+ 0x0a,  0x0a,  0x0a,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x0a,  0x2d, 
+ 0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x61,  0x6c,  0x65,  0x72,  0x74,  0x2d,  0x74,  0x65, 
+ 0x78,  0x74,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x3a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74, 
+ 0x6f,  0x6e,  0x2d,  0x61,  0x6c,  0x65,  0x72,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x68, 
+ 0x6f,  0x76,  0x65,  0x72,  0x3a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x61, 
+ 0x6c,  0x65,  0x72,  0x74,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x68,  0x6f,  0x76,  0x65, 
+ 0x72,  0x3a,  0x0a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x61,  0x6c,  0x65, 
+ 0x72,  0x74,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x3a,  0x0a, 
+ 0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x61,  0x6c,  0x65,  0x72,  0x74,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x3a,  0x0a,  0x2d,  0x2d,  0x62, 
+ 0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x61,  0x6c,  0x65,  0x72,  0x74,  0x2d,  0x62,  0x6f,  0x72,  0x64, 
+ 0x65,  0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x3a,  0x0a,  0x0a,  0x0a,  0x0a,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x50,  0x52,  0x49,  0x4d,  0x41,  0x52, 
+ 0x59,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74, 
+ 0x6f,  0x6e,  0x20,  0x73,  0x68,  0x6f,  0x75,  0x6c,  0x64,  0x20,  0x69,  0x6d,  0x6d,  0x65,  0x64,  0x69, 
+ 0x61,  0x74,  0x65,  0x6c,  0x79,  0x20,  0x63,  0x61,  0x74,  0x63,  0x68,  0x20,  0x74,  0x68,  0x65,  0x20, 
+ 0x65,  0x79,  0x65,  0x2d,  0x2d,  0x0a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d, 
+ 0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x3a,  0x0a,  0x2d,  0x2d, 
+ 0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70, 
+ 0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x0a,  0x0a, 
+ 0x0a,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74, 
+ 0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d, 
+ 0x68,  0x6f,  0x76,  0x65,  0x72,  0x3a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d, 
+ 0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x68,  0x6f, 
+ 0x76,  0x65,  0x72,  0x3a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72, 
+ 0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x68,  0x6f,  0x76, 
+ 0x65,  0x72,  0x3a,  0x0a,  0x0a,  0x0a,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x61, 
+ 0x63,  0x74,  0x69,  0x76,  0x65,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x0a,  0x2d, 
+ 0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d, 
+ 0x74,  0x65,  0x78,  0x74,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x3a,  0x0a,  0x2d,  0x2d,  0x62, 
+ 0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x3a,  0x0a,  0x2d,  0x2d,  0x62,  0x75, 
+ 0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72, 
+ 0x64,  0x65,  0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x3a,  0x0a,  0x0a,  0x0a,  0x0a,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x53,  0x45,  0x43,  0x4f, 
+ 0x4e,  0x44,  0x41,  0x52,  0x59,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x0a,  0x2d, 
+ 0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x20,  0x73,  0x68,  0x6f,  0x75,  0x6c,  0x64,  0x20,  0x4e, 
+ 0x4f,  0x54,  0x20,  0x69,  0x6d,  0x6d,  0x65,  0x64,  0x69,  0x61,  0x74,  0x65,  0x6c,  0x79,  0x20,  0x63, 
+ 0x61,  0x74,  0x63,  0x68,  0x20,  0x74,  0x68,  0x65,  0x20,  0x65,  0x79,  0x65,  0x2d,  0x2d,  0x0a,  0x0a, 
+ 0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61, 
+ 0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x3a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f, 
+ 0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x3a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f, 
+ 0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x0a,  0x0a,  0x0a, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f, 
+ 0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74, 
+ 0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x3a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e, 
+ 0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x3a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e, 
+ 0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65, 
+ 0x72,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x3a,  0x0a,  0x0a,  0x0a,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63, 
+ 0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x61,  0x63,  0x74,  0x69, 
+ 0x76,  0x65,  0x3a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63, 
+ 0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x61,  0x63,  0x74, 
+ 0x69,  0x76,  0x65,  0x3a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65, 
+ 0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x61, 
+ 0x63,  0x74,  0x69,  0x76,  0x65,  0x3a,  0x0a,  0x0a,  0x0a,  0x0a,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x54,  0x45,  0x52,  0x54,  0x49,  0x41,  0x52,  0x59,  0x20,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x0a,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x20,  0x64,  0x69,  0x73,  0x61,  0x62,  0x6c,  0x65,  0x64,  0x20,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e, 
+ 0x73,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x74,  0x65,  0x72,  0x74,  0x69, 
+ 0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x3a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74, 
+ 0x6f,  0x6e,  0x2d,  0x74,  0x65,  0x72,  0x74,  0x69,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x3a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x74,  0x65,  0x72,  0x74, 
+ 0x69,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x0a,  0x0a,  0x0a,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e, 
+ 0x2d,  0x74,  0x65,  0x72,  0x74,  0x69,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x3a,  0x0a, 
+ 0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x74,  0x65,  0x72,  0x74,  0x69,  0x61,  0x72, 
+ 0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f, 
+ 0x6e,  0x2d,  0x74,  0x65,  0x72,  0x74,  0x69,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65, 
+ 0x72,  0x3a,  0x0a,  0x0a,  0x7d,  0x0a,  0x0a,  0x2a,  0x2f,  0x0a, 
+};
+unsigned int colorthemes_css_len = 11386;
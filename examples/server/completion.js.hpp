@@ -0,0 +1,375 @@
+unsigned char completion_js[] = {
+ 0x63,  0x6f,  0x6e,  0x73,  0x74,  0x20,  0x70,  0x61,  0x72,  0x61,  0x6d,  0x44,  0x65,  0x66,  0x61,  0x75, 
+ 0x6c,  0x74,  0x73,  0x20,  0x3d,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x73,  0x74,  0x72,  0x65,  0x61,  0x6d, 
+ 0x3a,  0x20,  0x74,  0x72,  0x75,  0x65,  0x2c,  0x0a,  0x20,  0x20,  0x6e,  0x5f,  0x70,  0x72,  0x65,  0x64, 
+ 0x69,  0x63,  0x74,  0x3a,  0x20,  0x35,  0x30,  0x30,  0x2c,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x6d,  0x70, 
+ 0x65,  0x72,  0x61,  0x74,  0x75,  0x72,  0x65,  0x3a,  0x20,  0x30,  0x2e,  0x32,  0x2c,  0x0a,  0x20,  0x20, 
+ 0x73,  0x74,  0x6f,  0x70,  0x3a,  0x20,  0x5b,  0x22,  0x3c,  0x2f,  0x73,  0x3e,  0x22,  0x5d,  0x0a,  0x7d, 
+ 0x3b,  0x0a,  0x0a,  0x6c,  0x65,  0x74,  0x20,  0x67,  0x65,  0x6e,  0x65,  0x72,  0x61,  0x74,  0x69,  0x6f, 
+ 0x6e,  0x5f,  0x73,  0x65,  0x74,  0x74,  0x69,  0x6e,  0x67,  0x73,  0x20,  0x3d,  0x20,  0x6e,  0x75,  0x6c, 
+ 0x6c,  0x3b,  0x0a,  0x0a,  0x0a,  0x2f,  0x2f,  0x20,  0x43,  0x6f,  0x6d,  0x70,  0x6c,  0x65,  0x74,  0x65, 
+ 0x73,  0x20,  0x74,  0x68,  0x65,  0x20,  0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x20,  0x61,  0x73,  0x20, 
+ 0x61,  0x20,  0x67,  0x65,  0x6e,  0x65,  0x72,  0x61,  0x74,  0x6f,  0x72,  0x2e,  0x20,  0x52,  0x65,  0x63, 
+ 0x6f,  0x6d,  0x6d,  0x65,  0x6e,  0x64,  0x65,  0x64,  0x20,  0x66,  0x6f,  0x72,  0x20,  0x6d,  0x6f,  0x73, 
+ 0x74,  0x20,  0x75,  0x73,  0x65,  0x20,  0x63,  0x61,  0x73,  0x65,  0x73,  0x2e,  0x0a,  0x2f,  0x2f,  0x0a, 
+ 0x2f,  0x2f,  0x20,  0x45,  0x78,  0x61,  0x6d,  0x70,  0x6c,  0x65,  0x3a,  0x0a,  0x2f,  0x2f,  0x0a,  0x2f, 
+ 0x2f,  0x20,  0x20,  0x20,  0x20,  0x69,  0x6d,  0x70,  0x6f,  0x72,  0x74,  0x20,  0x7b,  0x20,  0x6c,  0x6c, 
+ 0x61,  0x6d,  0x61,  0x20,  0x7d,  0x20,  0x66,  0x72,  0x6f,  0x6d,  0x20,  0x27,  0x2f,  0x63,  0x6f,  0x6d, 
+ 0x70,  0x6c,  0x65,  0x74,  0x69,  0x6f,  0x6e,  0x2e,  0x6a,  0x73,  0x27,  0x0a,  0x2f,  0x2f,  0x0a,  0x2f, 
+ 0x2f,  0x20,  0x20,  0x20,  0x20,  0x63,  0x6f,  0x6e,  0x73,  0x74,  0x20,  0x72,  0x65,  0x71,  0x75,  0x65, 
+ 0x73,  0x74,  0x20,  0x3d,  0x20,  0x6c,  0x6c,  0x61,  0x6d,  0x61,  0x28,  0x22,  0x54,  0x65,  0x6c,  0x6c, 
+ 0x20,  0x6d,  0x65,  0x20,  0x61,  0x20,  0x6a,  0x6f,  0x6b,  0x65,  0x22,  0x2c,  0x20,  0x7b,  0x6e,  0x5f, 
+ 0x70,  0x72,  0x65,  0x64,  0x69,  0x63,  0x74,  0x3a,  0x20,  0x38,  0x30,  0x30,  0x7d,  0x29,  0x0a,  0x2f, 
+ 0x2f,  0x20,  0x20,  0x20,  0x20,  0x66,  0x6f,  0x72,  0x20,  0x61,  0x77,  0x61,  0x69,  0x74,  0x20,  0x28, 
+ 0x63,  0x6f,  0x6e,  0x73,  0x74,  0x20,  0x63,  0x68,  0x75,  0x6e,  0x6b,  0x20,  0x6f,  0x66,  0x20,  0x72, 
+ 0x65,  0x71,  0x75,  0x65,  0x73,  0x74,  0x29,  0x20,  0x7b,  0x0a,  0x2f,  0x2f,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x64,  0x6f,  0x63,  0x75,  0x6d,  0x65,  0x6e,  0x74,  0x2e,  0x77,  0x72,  0x69,  0x74,  0x65, 
+ 0x28,  0x63,  0x68,  0x75,  0x6e,  0x6b,  0x2e,  0x64,  0x61,  0x74,  0x61,  0x2e,  0x63,  0x6f,  0x6e,  0x74, 
+ 0x65,  0x6e,  0x74,  0x29,  0x0a,  0x2f,  0x2f,  0x20,  0x20,  0x20,  0x20,  0x7d,  0x0a,  0x2f,  0x2f,  0x0a, 
+ 0x65,  0x78,  0x70,  0x6f,  0x72,  0x74,  0x20,  0x61,  0x73,  0x79,  0x6e,  0x63,  0x20,  0x66,  0x75,  0x6e, 
+ 0x63,  0x74,  0x69,  0x6f,  0x6e,  0x2a,  0x20,  0x6c,  0x6c,  0x61,  0x6d,  0x61,  0x28,  0x70,  0x72,  0x6f, 
+ 0x6d,  0x70,  0x74,  0x2c,  0x20,  0x70,  0x61,  0x72,  0x61,  0x6d,  0x73,  0x20,  0x3d,  0x20,  0x7b,  0x7d, 
+ 0x2c,  0x20,  0x63,  0x6f,  0x6e,  0x66,  0x69,  0x67,  0x20,  0x3d,  0x20,  0x7b,  0x7d,  0x29,  0x20,  0x7b, 
+ 0x0a,  0x20,  0x20,  0x6c,  0x65,  0x74,  0x20,  0x63,  0x6f,  0x6e,  0x74,  0x72,  0x6f,  0x6c,  0x6c,  0x65, 
+ 0x72,  0x20,  0x3d,  0x20,  0x63,  0x6f,  0x6e,  0x66,  0x69,  0x67,  0x2e,  0x63,  0x6f,  0x6e,  0x74,  0x72, 
+ 0x6f,  0x6c,  0x6c,  0x65,  0x72,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6e,  0x73,  0x74,  0x20,  0x61, 
+ 0x70,  0x69,  0x5f,  0x75,  0x72,  0x6c,  0x20,  0x3d,  0x20,  0x63,  0x6f,  0x6e,  0x66,  0x69,  0x67,  0x2e, 
+ 0x61,  0x70,  0x69,  0x5f,  0x75,  0x72,  0x6c,  0x3f,  0x2e,  0x72,  0x65,  0x70,  0x6c,  0x61,  0x63,  0x65, 
+ 0x28,  0x2f,  0x5c,  0x2f,  0x2b,  0x24,  0x2f,  0x2c,  0x20,  0x27,  0x27,  0x29,  0x20,  0x7c,  0x7c,  0x20, 
+ 0x22,  0x22,  0x3b,  0x0a,  0x0a,  0x20,  0x20,  0x69,  0x66,  0x20,  0x28,  0x21,  0x63,  0x6f,  0x6e,  0x74, 
+ 0x72,  0x6f,  0x6c,  0x6c,  0x65,  0x72,  0x29,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x6f, 
+ 0x6e,  0x74,  0x72,  0x6f,  0x6c,  0x6c,  0x65,  0x72,  0x20,  0x3d,  0x20,  0x6e,  0x65,  0x77,  0x20,  0x41, 
+ 0x62,  0x6f,  0x72,  0x74,  0x43,  0x6f,  0x6e,  0x74,  0x72,  0x6f,  0x6c,  0x6c,  0x65,  0x72,  0x28,  0x29, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x7d,  0x0a,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6e,  0x73,  0x74,  0x20,  0x63, 
+ 0x6f,  0x6d,  0x70,  0x6c,  0x65,  0x74,  0x69,  0x6f,  0x6e,  0x50,  0x61,  0x72,  0x61,  0x6d,  0x73,  0x20, 
+ 0x3d,  0x20,  0x7b,  0x20,  0x2e,  0x2e,  0x2e,  0x70,  0x61,  0x72,  0x61,  0x6d,  0x44,  0x65,  0x66,  0x61, 
+ 0x75,  0x6c,  0x74,  0x73,  0x2c,  0x20,  0x2e,  0x2e,  0x2e,  0x70,  0x61,  0x72,  0x61,  0x6d,  0x73,  0x2c, 
+ 0x20,  0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x20,  0x7d,  0x3b,  0x0a,  0x0a,  0x20,  0x20,  0x63,  0x6f, 
+ 0x6e,  0x73,  0x74,  0x20,  0x72,  0x65,  0x73,  0x70,  0x6f,  0x6e,  0x73,  0x65,  0x20,  0x3d,  0x20,  0x61, 
+ 0x77,  0x61,  0x69,  0x74,  0x20,  0x66,  0x65,  0x74,  0x63,  0x68,  0x28,  0x60,  0x24,  0x7b,  0x61,  0x70, 
+ 0x69,  0x5f,  0x75,  0x72,  0x6c,  0x7d,  0x2f,  0x63,  0x6f,  0x6d,  0x70,  0x6c,  0x65,  0x74,  0x69,  0x6f, 
+ 0x6e,  0x60,  0x2c,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x6d,  0x65,  0x74,  0x68,  0x6f,  0x64, 
+ 0x3a,  0x20,  0x27,  0x50,  0x4f,  0x53,  0x54,  0x27,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x62,  0x6f, 
+ 0x64,  0x79,  0x3a,  0x20,  0x4a,  0x53,  0x4f,  0x4e,  0x2e,  0x73,  0x74,  0x72,  0x69,  0x6e,  0x67,  0x69, 
+ 0x66,  0x79,  0x28,  0x63,  0x6f,  0x6d,  0x70,  0x6c,  0x65,  0x74,  0x69,  0x6f,  0x6e,  0x50,  0x61,  0x72, 
+ 0x61,  0x6d,  0x73,  0x29,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x68,  0x65,  0x61,  0x64,  0x65,  0x72, 
+ 0x73,  0x3a,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x27,  0x43,  0x6f,  0x6e,  0x6e, 
+ 0x65,  0x63,  0x74,  0x69,  0x6f,  0x6e,  0x27,  0x3a,  0x20,  0x27,  0x6b,  0x65,  0x65,  0x70,  0x2d,  0x61, 
+ 0x6c,  0x69,  0x76,  0x65,  0x27,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x27,  0x43,  0x6f, 
+ 0x6e,  0x74,  0x65,  0x6e,  0x74,  0x2d,  0x54,  0x79,  0x70,  0x65,  0x27,  0x3a,  0x20,  0x27,  0x61,  0x70, 
+ 0x70,  0x6c,  0x69,  0x63,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x2f,  0x6a,  0x73,  0x6f,  0x6e,  0x27,  0x2c, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x27,  0x41,  0x63,  0x63,  0x65,  0x70,  0x74,  0x27,  0x3a, 
+ 0x20,  0x27,  0x74,  0x65,  0x78,  0x74,  0x2f,  0x65,  0x76,  0x65,  0x6e,  0x74,  0x2d,  0x73,  0x74,  0x72, 
+ 0x65,  0x61,  0x6d,  0x27,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x2e,  0x2e,  0x2e,  0x28, 
+ 0x70,  0x61,  0x72,  0x61,  0x6d,  0x73,  0x2e,  0x61,  0x70,  0x69,  0x5f,  0x6b,  0x65,  0x79,  0x20,  0x3f, 
+ 0x20,  0x7b,  0x27,  0x41,  0x75,  0x74,  0x68,  0x6f,  0x72,  0x69,  0x7a,  0x61,  0x74,  0x69,  0x6f,  0x6e, 
+ 0x27,  0x3a,  0x20,  0x60,  0x42,  0x65,  0x61,  0x72,  0x65,  0x72,  0x20,  0x24,  0x7b,  0x70,  0x61,  0x72, 
+ 0x61,  0x6d,  0x73,  0x2e,  0x61,  0x70,  0x69,  0x5f,  0x6b,  0x65,  0x79,  0x7d,  0x60,  0x7d,  0x20,  0x3a, 
+ 0x20,  0x7b,  0x7d,  0x29,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x7d,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20, 
+ 0x73,  0x69,  0x67,  0x6e,  0x61,  0x6c,  0x3a,  0x20,  0x63,  0x6f,  0x6e,  0x74,  0x72,  0x6f,  0x6c,  0x6c, 
+ 0x65,  0x72,  0x2e,  0x73,  0x69,  0x67,  0x6e,  0x61,  0x6c,  0x2c,  0x0a,  0x20,  0x20,  0x7d,  0x29,  0x3b, 
+ 0x0a,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6e,  0x73,  0x74,  0x20,  0x72,  0x65,  0x61,  0x64,  0x65,  0x72, 
+ 0x20,  0x3d,  0x20,  0x72,  0x65,  0x73,  0x70,  0x6f,  0x6e,  0x73,  0x65,  0x2e,  0x62,  0x6f,  0x64,  0x79, 
+ 0x2e,  0x67,  0x65,  0x74,  0x52,  0x65,  0x61,  0x64,  0x65,  0x72,  0x28,  0x29,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x63,  0x6f,  0x6e,  0x73,  0x74,  0x20,  0x64,  0x65,  0x63,  0x6f,  0x64,  0x65,  0x72,  0x20,  0x3d,  0x20, 
+ 0x6e,  0x65,  0x77,  0x20,  0x54,  0x65,  0x78,  0x74,  0x44,  0x65,  0x63,  0x6f,  0x64,  0x65,  0x72,  0x28, 
+ 0x29,  0x3b,  0x0a,  0x0a,  0x20,  0x20,  0x6c,  0x65,  0x74,  0x20,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e, 
+ 0x74,  0x20,  0x3d,  0x20,  0x22,  0x22,  0x3b,  0x0a,  0x20,  0x20,  0x6c,  0x65,  0x74,  0x20,  0x6c,  0x65, 
+ 0x66,  0x74,  0x6f,  0x76,  0x65,  0x72,  0x20,  0x3d,  0x20,  0x22,  0x22,  0x3b,  0x20,  0x2f,  0x2f,  0x20, 
+ 0x42,  0x75,  0x66,  0x66,  0x65,  0x72,  0x20,  0x66,  0x6f,  0x72,  0x20,  0x70,  0x61,  0x72,  0x74,  0x69, 
+ 0x61,  0x6c,  0x6c,  0x79,  0x20,  0x72,  0x65,  0x61,  0x64,  0x20,  0x6c,  0x69,  0x6e,  0x65,  0x73,  0x0a, 
+ 0x0a,  0x20,  0x20,  0x74,  0x72,  0x79,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x6c,  0x65,  0x74, 
+ 0x20,  0x63,  0x6f,  0x6e,  0x74,  0x20,  0x3d,  0x20,  0x74,  0x72,  0x75,  0x65,  0x3b,  0x0a,  0x0a,  0x20, 
+ 0x20,  0x20,  0x20,  0x77,  0x68,  0x69,  0x6c,  0x65,  0x20,  0x28,  0x63,  0x6f,  0x6e,  0x74,  0x29,  0x20, 
+ 0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x63,  0x6f,  0x6e,  0x73,  0x74,  0x20,  0x72,  0x65, 
+ 0x73,  0x75,  0x6c,  0x74,  0x20,  0x3d,  0x20,  0x61,  0x77,  0x61,  0x69,  0x74,  0x20,  0x72,  0x65,  0x61, 
+ 0x64,  0x65,  0x72,  0x2e,  0x72,  0x65,  0x61,  0x64,  0x28,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x69,  0x66,  0x20,  0x28,  0x72,  0x65,  0x73,  0x75,  0x6c,  0x74,  0x2e,  0x64,  0x6f,  0x6e, 
+ 0x65,  0x29,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x62,  0x72,  0x65, 
+ 0x61,  0x6b,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x7d,  0x0a,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x2f,  0x2f,  0x20,  0x41,  0x64,  0x64,  0x20,  0x61,  0x6e,  0x79,  0x20,  0x6c,  0x65, 
+ 0x66,  0x74,  0x6f,  0x76,  0x65,  0x72,  0x20,  0x64,  0x61,  0x74,  0x61,  0x20,  0x74,  0x6f,  0x20,  0x74, 
+ 0x68,  0x65,  0x20,  0x63,  0x75,  0x72,  0x72,  0x65,  0x6e,  0x74,  0x20,  0x63,  0x68,  0x75,  0x6e,  0x6b, 
+ 0x20,  0x6f,  0x66,  0x20,  0x64,  0x61,  0x74,  0x61,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x63, 
+ 0x6f,  0x6e,  0x73,  0x74,  0x20,  0x74,  0x65,  0x78,  0x74,  0x20,  0x3d,  0x20,  0x6c,  0x65,  0x66,  0x74, 
+ 0x6f,  0x76,  0x65,  0x72,  0x20,  0x2b,  0x20,  0x64,  0x65,  0x63,  0x6f,  0x64,  0x65,  0x72,  0x2e,  0x64, 
+ 0x65,  0x63,  0x6f,  0x64,  0x65,  0x28,  0x72,  0x65,  0x73,  0x75,  0x6c,  0x74,  0x2e,  0x76,  0x61,  0x6c, 
+ 0x75,  0x65,  0x29,  0x3b,  0x0a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x2f,  0x2f,  0x20,  0x43, 
+ 0x68,  0x65,  0x63,  0x6b,  0x20,  0x69,  0x66,  0x20,  0x74,  0x68,  0x65,  0x20,  0x6c,  0x61,  0x73,  0x74, 
+ 0x20,  0x63,  0x68,  0x61,  0x72,  0x61,  0x63,  0x74,  0x65,  0x72,  0x20,  0x69,  0x73,  0x20,  0x61,  0x20, 
+ 0x6c,  0x69,  0x6e,  0x65,  0x20,  0x62,  0x72,  0x65,  0x61,  0x6b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x63,  0x6f,  0x6e,  0x73,  0x74,  0x20,  0x65,  0x6e,  0x64,  0x73,  0x57,  0x69,  0x74,  0x68,  0x4c, 
+ 0x69,  0x6e,  0x65,  0x42,  0x72,  0x65,  0x61,  0x6b,  0x20,  0x3d,  0x20,  0x74,  0x65,  0x78,  0x74,  0x2e, 
+ 0x65,  0x6e,  0x64,  0x73,  0x57,  0x69,  0x74,  0x68,  0x28,  0x27,  0x5c,  0x6e,  0x27,  0x29,  0x3b,  0x0a, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x2f,  0x2f,  0x20,  0x53,  0x70,  0x6c,  0x69,  0x74,  0x20, 
+ 0x74,  0x68,  0x65,  0x20,  0x74,  0x65,  0x78,  0x74,  0x20,  0x69,  0x6e,  0x74,  0x6f,  0x20,  0x6c,  0x69, 
+ 0x6e,  0x65,  0x73,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x6c,  0x65,  0x74,  0x20,  0x6c,  0x69, 
+ 0x6e,  0x65,  0x73,  0x20,  0x3d,  0x20,  0x74,  0x65,  0x78,  0x74,  0x2e,  0x73,  0x70,  0x6c,  0x69,  0x74, 
+ 0x28,  0x27,  0x5c,  0x6e,  0x27,  0x29,  0x3b,  0x0a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x2f, 
+ 0x2f,  0x20,  0x49,  0x66,  0x20,  0x74,  0x68,  0x65,  0x20,  0x74,  0x65,  0x78,  0x74,  0x20,  0x64,  0x6f, 
+ 0x65,  0x73,  0x6e,  0x27,  0x74,  0x20,  0x65,  0x6e,  0x64,  0x20,  0x77,  0x69,  0x74,  0x68,  0x20,  0x61, 
+ 0x20,  0x6c,  0x69,  0x6e,  0x65,  0x20,  0x62,  0x72,  0x65,  0x61,  0x6b,  0x2c,  0x20,  0x74,  0x68,  0x65, 
+ 0x6e,  0x20,  0x74,  0x68,  0x65,  0x20,  0x6c,  0x61,  0x73,  0x74,  0x20,  0x6c,  0x69,  0x6e,  0x65,  0x20, 
+ 0x69,  0x73,  0x20,  0x69,  0x6e,  0x63,  0x6f,  0x6d,  0x70,  0x6c,  0x65,  0x74,  0x65,  0x0a,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x2f,  0x2f,  0x20,  0x53,  0x74,  0x6f,  0x72,  0x65,  0x20,  0x69,  0x74,  0x20, 
+ 0x69,  0x6e,  0x20,  0x6c,  0x65,  0x66,  0x74,  0x6f,  0x76,  0x65,  0x72,  0x20,  0x74,  0x6f,  0x20,  0x62, 
+ 0x65,  0x20,  0x61,  0x64,  0x64,  0x65,  0x64,  0x20,  0x74,  0x6f,  0x20,  0x74,  0x68,  0x65,  0x20,  0x6e, 
+ 0x65,  0x78,  0x74,  0x20,  0x63,  0x68,  0x75,  0x6e,  0x6b,  0x20,  0x6f,  0x66,  0x20,  0x64,  0x61,  0x74, 
+ 0x61,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x69,  0x66,  0x20,  0x28,  0x21,  0x65,  0x6e,  0x64, 
+ 0x73,  0x57,  0x69,  0x74,  0x68,  0x4c,  0x69,  0x6e,  0x65,  0x42,  0x72,  0x65,  0x61,  0x6b,  0x29,  0x20, 
+ 0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x6c,  0x65,  0x66,  0x74,  0x6f,  0x76, 
+ 0x65,  0x72,  0x20,  0x3d,  0x20,  0x6c,  0x69,  0x6e,  0x65,  0x73,  0x2e,  0x70,  0x6f,  0x70,  0x28,  0x29, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x7d,  0x20,  0x65,  0x6c,  0x73,  0x65,  0x20,  0x7b, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x6c,  0x65,  0x66,  0x74,  0x6f,  0x76,  0x65, 
+ 0x72,  0x20,  0x3d,  0x20,  0x22,  0x22,  0x3b,  0x20,  0x2f,  0x2f,  0x20,  0x52,  0x65,  0x73,  0x65,  0x74, 
+ 0x20,  0x6c,  0x65,  0x66,  0x74,  0x6f,  0x76,  0x65,  0x72,  0x20,  0x69,  0x66,  0x20,  0x77,  0x65,  0x20, 
+ 0x68,  0x61,  0x76,  0x65,  0x20,  0x61,  0x20,  0x6c,  0x69,  0x6e,  0x65,  0x20,  0x62,  0x72,  0x65,  0x61, 
+ 0x6b,  0x20,  0x61,  0x74,  0x20,  0x74,  0x68,  0x65,  0x20,  0x65,  0x6e,  0x64,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x7d,  0x0a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x2f,  0x2f,  0x20,  0x50, 
+ 0x61,  0x72,  0x73,  0x65,  0x20,  0x61,  0x6c,  0x6c,  0x20,  0x73,  0x73,  0x65,  0x20,  0x65,  0x76,  0x65, 
+ 0x6e,  0x74,  0x73,  0x20,  0x61,  0x6e,  0x64,  0x20,  0x61,  0x64,  0x64,  0x20,  0x74,  0x68,  0x65,  0x6d, 
+ 0x20,  0x74,  0x6f,  0x20,  0x72,  0x65,  0x73,  0x75,  0x6c,  0x74,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x63,  0x6f,  0x6e,  0x73,  0x74,  0x20,  0x72,  0x65,  0x67,  0x65,  0x78,  0x20,  0x3d,  0x20,  0x2f, 
+ 0x5e,  0x28,  0x5c,  0x53,  0x2b,  0x29,  0x3a,  0x5c,  0x73,  0x28,  0x2e,  0x2a,  0x29,  0x24,  0x2f,  0x67, 
+ 0x6d,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x66,  0x6f,  0x72,  0x20,  0x28,  0x63,  0x6f, 
+ 0x6e,  0x73,  0x74,  0x20,  0x6c,  0x69,  0x6e,  0x65,  0x20,  0x6f,  0x66,  0x20,  0x6c,  0x69,  0x6e,  0x65, 
+ 0x73,  0x29,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x63,  0x6f,  0x6e, 
+ 0x73,  0x74,  0x20,  0x6d,  0x61,  0x74,  0x63,  0x68,  0x20,  0x3d,  0x20,  0x72,  0x65,  0x67,  0x65,  0x78, 
+ 0x2e,  0x65,  0x78,  0x65,  0x63,  0x28,  0x6c,  0x69,  0x6e,  0x65,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x69,  0x66,  0x20,  0x28,  0x6d,  0x61,  0x74,  0x63,  0x68,  0x29,  0x20, 
+ 0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x72,  0x65,  0x73,  0x75, 
+ 0x6c,  0x74,  0x5b,  0x6d,  0x61,  0x74,  0x63,  0x68,  0x5b,  0x31,  0x5d,  0x5d,  0x20,  0x3d,  0x20,  0x6d, 
+ 0x61,  0x74,  0x63,  0x68,  0x5b,  0x32,  0x5d,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x2f,  0x2f,  0x20,  0x73,  0x69,  0x6e,  0x63,  0x65,  0x20,  0x77,  0x65,  0x20,  0x6b,  0x6e, 
+ 0x6f,  0x77,  0x20,  0x74,  0x68,  0x69,  0x73,  0x20,  0x69,  0x73,  0x20,  0x6c,  0x6c,  0x61,  0x6d,  0x61, 
+ 0x2e,  0x63,  0x70,  0x70,  0x2c,  0x20,  0x6c,  0x65,  0x74,  0x27,  0x73,  0x20,  0x6a,  0x75,  0x73,  0x74, 
+ 0x20,  0x64,  0x65,  0x63,  0x6f,  0x64,  0x65,  0x20,  0x74,  0x68,  0x65,  0x20,  0x6a,  0x73,  0x6f,  0x6e, 
+ 0x20,  0x69,  0x6e,  0x20,  0x64,  0x61,  0x74,  0x61,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x69,  0x66,  0x20,  0x28,  0x72,  0x65,  0x73,  0x75,  0x6c,  0x74,  0x2e,  0x64,  0x61, 
+ 0x74,  0x61,  0x29,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x72,  0x65,  0x73,  0x75,  0x6c,  0x74,  0x2e,  0x64,  0x61,  0x74,  0x61,  0x20,  0x3d,  0x20, 
+ 0x4a,  0x53,  0x4f,  0x4e,  0x2e,  0x70,  0x61,  0x72,  0x73,  0x65,  0x28,  0x72,  0x65,  0x73,  0x75,  0x6c, 
+ 0x74,  0x2e,  0x64,  0x61,  0x74,  0x61,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x20,  0x2b,  0x3d,  0x20, 
+ 0x72,  0x65,  0x73,  0x75,  0x6c,  0x74,  0x2e,  0x64,  0x61,  0x74,  0x61,  0x2e,  0x63,  0x6f,  0x6e,  0x74, 
+ 0x65,  0x6e,  0x74,  0x3b,  0x0a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x2f,  0x2f,  0x20,  0x79,  0x69,  0x65,  0x6c,  0x64,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x79,  0x69,  0x65,  0x6c,  0x64,  0x20,  0x72,  0x65,  0x73, 
+ 0x75,  0x6c,  0x74,  0x3b,  0x0a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x2f,  0x2f,  0x20,  0x69,  0x66,  0x20,  0x77,  0x65,  0x20,  0x67,  0x6f,  0x74,  0x20,  0x61, 
+ 0x20,  0x73,  0x74,  0x6f,  0x70,  0x20,  0x74,  0x6f,  0x6b,  0x65,  0x6e,  0x20,  0x66,  0x72,  0x6f,  0x6d, 
+ 0x20,  0x73,  0x65,  0x72,  0x76,  0x65,  0x72,  0x2c,  0x20,  0x77,  0x65,  0x20,  0x77,  0x69,  0x6c,  0x6c, 
+ 0x20,  0x62,  0x72,  0x65,  0x61,  0x6b,  0x20,  0x68,  0x65,  0x72,  0x65,  0x0a,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x69,  0x66,  0x20,  0x28,  0x72,  0x65,  0x73,  0x75, 
+ 0x6c,  0x74,  0x2e,  0x64,  0x61,  0x74,  0x61,  0x2e,  0x73,  0x74,  0x6f,  0x70,  0x29,  0x20,  0x7b,  0x0a, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x69,  0x66, 
+ 0x20,  0x28,  0x72,  0x65,  0x73,  0x75,  0x6c,  0x74,  0x2e,  0x64,  0x61,  0x74,  0x61,  0x2e,  0x67,  0x65, 
+ 0x6e,  0x65,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x5f,  0x73,  0x65,  0x74,  0x74,  0x69,  0x6e,  0x67, 
+ 0x73,  0x29,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x67,  0x65,  0x6e,  0x65,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x5f, 
+ 0x73,  0x65,  0x74,  0x74,  0x69,  0x6e,  0x67,  0x73,  0x20,  0x3d,  0x20,  0x72,  0x65,  0x73,  0x75,  0x6c, 
+ 0x74,  0x2e,  0x64,  0x61,  0x74,  0x61,  0x2e,  0x67,  0x65,  0x6e,  0x65,  0x72,  0x61,  0x74,  0x69,  0x6f, 
+ 0x6e,  0x5f,  0x73,  0x65,  0x74,  0x74,  0x69,  0x6e,  0x67,  0x73,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x7d,  0x0a,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x63,  0x6f,  0x6e,  0x74,  0x20,  0x3d, 
+ 0x20,  0x66,  0x61,  0x6c,  0x73,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x62,  0x72,  0x65,  0x61,  0x6b,  0x3b,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x7d,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x7d,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x69,  0x66,  0x20,  0x28,  0x72,  0x65,  0x73,  0x75,  0x6c,  0x74,  0x2e,  0x65,  0x72,  0x72,  0x6f, 
+ 0x72,  0x29,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x74,  0x72,  0x79,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x72,  0x65,  0x73,  0x75,  0x6c,  0x74,  0x2e,  0x65,  0x72,  0x72,  0x6f, 
+ 0x72,  0x20,  0x3d,  0x20,  0x4a,  0x53,  0x4f,  0x4e,  0x2e,  0x70,  0x61,  0x72,  0x73,  0x65,  0x28,  0x72, 
+ 0x65,  0x73,  0x75,  0x6c,  0x74,  0x2e,  0x65,  0x72,  0x72,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x69,  0x66,  0x20,  0x28, 
+ 0x72,  0x65,  0x73,  0x75,  0x6c,  0x74,  0x2e,  0x65,  0x72,  0x72,  0x6f,  0x72,  0x2e,  0x6d,  0x65,  0x73, 
+ 0x73,  0x61,  0x67,  0x65,  0x2e,  0x69,  0x6e,  0x63,  0x6c,  0x75,  0x64,  0x65,  0x73,  0x28,  0x27,  0x73, 
+ 0x6c,  0x6f,  0x74,  0x20,  0x75,  0x6e,  0x61,  0x76,  0x61,  0x69,  0x6c,  0x61,  0x62,  0x6c,  0x65,  0x27, 
+ 0x29,  0x29,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x2f,  0x2f,  0x20,  0x54,  0x68,  0x72,  0x6f,  0x77,  0x20,  0x61,  0x6e, 
+ 0x20,  0x65,  0x72,  0x72,  0x6f,  0x72,  0x20,  0x74,  0x6f,  0x20,  0x62,  0x65,  0x20,  0x63,  0x61,  0x75, 
+ 0x67,  0x68,  0x74,  0x20,  0x62,  0x79,  0x20,  0x75,  0x70,  0x73,  0x74,  0x72,  0x65,  0x61,  0x6d,  0x20, 
+ 0x63,  0x61,  0x6c,  0x6c,  0x65,  0x72,  0x73,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x74,  0x68,  0x72,  0x6f,  0x77,  0x20,  0x6e,  0x65, 
+ 0x77,  0x20,  0x45,  0x72,  0x72,  0x6f,  0x72,  0x28,  0x27,  0x73,  0x6c,  0x6f,  0x74,  0x20,  0x75,  0x6e, 
+ 0x61,  0x76,  0x61,  0x69,  0x6c,  0x61,  0x62,  0x6c,  0x65,  0x27,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x7d,  0x20,  0x65,  0x6c,  0x73, 
+ 0x65,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x63,  0x6f,  0x6e,  0x73,  0x6f,  0x6c,  0x65,  0x2e,  0x65,  0x72,  0x72,  0x6f, 
+ 0x72,  0x28,  0x60,  0x6c,  0x6c,  0x61,  0x6d,  0x61,  0x2e,  0x63,  0x70,  0x70,  0x20,  0x65,  0x72,  0x72, 
+ 0x6f,  0x72,  0x20,  0x5b,  0x24,  0x7b,  0x72,  0x65,  0x73,  0x75,  0x6c,  0x74,  0x2e,  0x65,  0x72,  0x72, 
+ 0x6f,  0x72,  0x2e,  0x63,  0x6f,  0x64,  0x65,  0x7d,  0x20,  0x2d,  0x20,  0x24,  0x7b,  0x72,  0x65,  0x73, 
+ 0x75,  0x6c,  0x74,  0x2e,  0x65,  0x72,  0x72,  0x6f,  0x72,  0x2e,  0x74,  0x79,  0x70,  0x65,  0x7d,  0x5d, 
+ 0x3a,  0x20,  0x24,  0x7b,  0x72,  0x65,  0x73,  0x75,  0x6c,  0x74,  0x2e,  0x65,  0x72,  0x72,  0x6f,  0x72, 
+ 0x2e,  0x6d,  0x65,  0x73,  0x73,  0x61,  0x67,  0x65,  0x7d,  0x60,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x7d,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x7d,  0x20,  0x63,  0x61,  0x74,  0x63,  0x68, 
+ 0x28,  0x65,  0x29,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x63,  0x6f,  0x6e,  0x73,  0x6f,  0x6c,  0x65,  0x2e,  0x65,  0x72,  0x72,  0x6f, 
+ 0x72,  0x28,  0x60,  0x6c,  0x6c,  0x61,  0x6d,  0x61,  0x2e,  0x63,  0x70,  0x70,  0x20,  0x65,  0x72,  0x72, 
+ 0x6f,  0x72,  0x20,  0x24,  0x7b,  0x72,  0x65,  0x73,  0x75,  0x6c,  0x74,  0x2e,  0x65,  0x72,  0x72,  0x6f, 
+ 0x72,  0x7d,  0x60,  0x29,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x7d,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x7d,  0x0a,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x7d,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x7d, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x7d,  0x0a,  0x20,  0x20,  0x7d,  0x20,  0x63,  0x61,  0x74,  0x63,  0x68, 
+ 0x20,  0x28,  0x65,  0x29,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x69,  0x66,  0x20,  0x28,  0x65, 
+ 0x2e,  0x6e,  0x61,  0x6d,  0x65,  0x20,  0x21,  0x3d,  0x3d,  0x20,  0x27,  0x41,  0x62,  0x6f,  0x72,  0x74, 
+ 0x45,  0x72,  0x72,  0x6f,  0x72,  0x27,  0x29,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x63,  0x6f,  0x6e,  0x73,  0x6f,  0x6c,  0x65,  0x2e,  0x65,  0x72,  0x72,  0x6f,  0x72,  0x28,  0x22,  0x6c, 
+ 0x6c,  0x61,  0x6d,  0x61,  0x20,  0x65,  0x72,  0x72,  0x6f,  0x72,  0x3a,  0x20,  0x22,  0x2c,  0x20,  0x65, 
+ 0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x7d,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x74,  0x68,  0x72, 
+ 0x6f,  0x77,  0x20,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x7d,  0x0a,  0x20,  0x20,  0x66,  0x69,  0x6e,  0x61, 
+ 0x6c,  0x6c,  0x79,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x6f,  0x6e,  0x74,  0x72,  0x6f, 
+ 0x6c,  0x6c,  0x65,  0x72,  0x2e,  0x61,  0x62,  0x6f,  0x72,  0x74,  0x28,  0x29,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x7d,  0x0a,  0x0a,  0x20,  0x20,  0x72,  0x65,  0x74,  0x75,  0x72,  0x6e,  0x20,  0x63,  0x6f,  0x6e,  0x74, 
+ 0x65,  0x6e,  0x74,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2f,  0x2f,  0x20,  0x43,  0x61,  0x6c,  0x6c,  0x20, 
+ 0x6c,  0x6c,  0x61,  0x6d,  0x61,  0x2c,  0x20,  0x72,  0x65,  0x74,  0x75,  0x72,  0x6e,  0x20,  0x61,  0x6e, 
+ 0x20,  0x65,  0x76,  0x65,  0x6e,  0x74,  0x20,  0x74,  0x61,  0x72,  0x67,  0x65,  0x74,  0x20,  0x74,  0x68, 
+ 0x61,  0x74,  0x20,  0x79,  0x6f,  0x75,  0x20,  0x63,  0x61,  0x6e,  0x20,  0x73,  0x75,  0x62,  0x73,  0x63, 
+ 0x72,  0x69,  0x62,  0x65,  0x20,  0x74,  0x6f,  0x0a,  0x2f,  0x2f,  0x0a,  0x2f,  0x2f,  0x20,  0x45,  0x78, 
+ 0x61,  0x6d,  0x70,  0x6c,  0x65,  0x3a,  0x0a,  0x2f,  0x2f,  0x0a,  0x2f,  0x2f,  0x20,  0x20,  0x20,  0x20, 
+ 0x69,  0x6d,  0x70,  0x6f,  0x72,  0x74,  0x20,  0x7b,  0x20,  0x6c,  0x6c,  0x61,  0x6d,  0x61,  0x45,  0x76, 
+ 0x65,  0x6e,  0x74,  0x54,  0x61,  0x72,  0x67,  0x65,  0x74,  0x20,  0x7d,  0x20,  0x66,  0x72,  0x6f,  0x6d, 
+ 0x20,  0x27,  0x2f,  0x63,  0x6f,  0x6d,  0x70,  0x6c,  0x65,  0x74,  0x69,  0x6f,  0x6e,  0x2e,  0x6a,  0x73, 
+ 0x27,  0x0a,  0x2f,  0x2f,  0x0a,  0x2f,  0x2f,  0x20,  0x20,  0x20,  0x20,  0x63,  0x6f,  0x6e,  0x73,  0x74, 
+ 0x20,  0x63,  0x6f,  0x6e,  0x6e,  0x20,  0x3d,  0x20,  0x6c,  0x6c,  0x61,  0x6d,  0x61,  0x45,  0x76,  0x65, 
+ 0x6e,  0x74,  0x54,  0x61,  0x72,  0x67,  0x65,  0x74,  0x28,  0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x29, 
+ 0x0a,  0x2f,  0x2f,  0x20,  0x20,  0x20,  0x20,  0x63,  0x6f,  0x6e,  0x6e,  0x2e,  0x61,  0x64,  0x64,  0x45, 
+ 0x76,  0x65,  0x6e,  0x74,  0x4c,  0x69,  0x73,  0x74,  0x65,  0x6e,  0x65,  0x72,  0x28,  0x22,  0x6d,  0x65, 
+ 0x73,  0x73,  0x61,  0x67,  0x65,  0x22,  0x2c,  0x20,  0x28,  0x63,  0x68,  0x75,  0x6e,  0x6b,  0x29,  0x20, 
+ 0x3d,  0x3e,  0x20,  0x7b,  0x0a,  0x2f,  0x2f,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x64,  0x6f,  0x63, 
+ 0x75,  0x6d,  0x65,  0x6e,  0x74,  0x2e,  0x77,  0x72,  0x69,  0x74,  0x65,  0x28,  0x63,  0x68,  0x75,  0x6e, 
+ 0x6b,  0x2e,  0x64,  0x65,  0x74,  0x61,  0x69,  0x6c,  0x2e,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74, 
+ 0x29,  0x0a,  0x2f,  0x2f,  0x20,  0x20,  0x20,  0x20,  0x7d,  0x29,  0x0a,  0x2f,  0x2f,  0x0a,  0x65,  0x78, 
+ 0x70,  0x6f,  0x72,  0x74,  0x20,  0x63,  0x6f,  0x6e,  0x73,  0x74,  0x20,  0x6c,  0x6c,  0x61,  0x6d,  0x61, 
+ 0x45,  0x76,  0x65,  0x6e,  0x74,  0x54,  0x61,  0x72,  0x67,  0x65,  0x74,  0x20,  0x3d,  0x20,  0x28,  0x70, 
+ 0x72,  0x6f,  0x6d,  0x70,  0x74,  0x2c,  0x20,  0x70,  0x61,  0x72,  0x61,  0x6d,  0x73,  0x20,  0x3d,  0x20, 
+ 0x7b,  0x7d,  0x2c,  0x20,  0x63,  0x6f,  0x6e,  0x66,  0x69,  0x67,  0x20,  0x3d,  0x20,  0x7b,  0x7d,  0x29, 
+ 0x20,  0x3d,  0x3e,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6e,  0x73,  0x74,  0x20,  0x65,  0x76, 
+ 0x65,  0x6e,  0x74,  0x54,  0x61,  0x72,  0x67,  0x65,  0x74,  0x20,  0x3d,  0x20,  0x6e,  0x65,  0x77,  0x20, 
+ 0x45,  0x76,  0x65,  0x6e,  0x74,  0x54,  0x61,  0x72,  0x67,  0x65,  0x74,  0x28,  0x29,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x28,  0x61,  0x73,  0x79,  0x6e,  0x63,  0x20,  0x28,  0x29,  0x20,  0x3d,  0x3e,  0x20,  0x7b,  0x0a, 
+ 0x20,  0x20,  0x20,  0x20,  0x6c,  0x65,  0x74,  0x20,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x20, 
+ 0x3d,  0x20,  0x22,  0x22,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x66,  0x6f,  0x72,  0x20,  0x61,  0x77, 
+ 0x61,  0x69,  0x74,  0x20,  0x28,  0x63,  0x6f,  0x6e,  0x73,  0x74,  0x20,  0x63,  0x68,  0x75,  0x6e,  0x6b, 
+ 0x20,  0x6f,  0x66,  0x20,  0x6c,  0x6c,  0x61,  0x6d,  0x61,  0x28,  0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74, 
+ 0x2c,  0x20,  0x70,  0x61,  0x72,  0x61,  0x6d,  0x73,  0x2c,  0x20,  0x63,  0x6f,  0x6e,  0x66,  0x69,  0x67, 
+ 0x29,  0x29,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x69,  0x66,  0x20,  0x28,  0x63, 
+ 0x68,  0x75,  0x6e,  0x6b,  0x2e,  0x64,  0x61,  0x74,  0x61,  0x29,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x20,  0x2b,  0x3d,  0x20, 
+ 0x63,  0x68,  0x75,  0x6e,  0x6b,  0x2e,  0x64,  0x61,  0x74,  0x61,  0x2e,  0x63,  0x6f,  0x6e,  0x74,  0x65, 
+ 0x6e,  0x74,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x65,  0x76,  0x65,  0x6e, 
+ 0x74,  0x54,  0x61,  0x72,  0x67,  0x65,  0x74,  0x2e,  0x64,  0x69,  0x73,  0x70,  0x61,  0x74,  0x63,  0x68, 
+ 0x45,  0x76,  0x65,  0x6e,  0x74,  0x28,  0x6e,  0x65,  0x77,  0x20,  0x43,  0x75,  0x73,  0x74,  0x6f,  0x6d, 
+ 0x45,  0x76,  0x65,  0x6e,  0x74,  0x28,  0x22,  0x6d,  0x65,  0x73,  0x73,  0x61,  0x67,  0x65,  0x22,  0x2c, 
+ 0x20,  0x7b,  0x20,  0x64,  0x65,  0x74,  0x61,  0x69,  0x6c,  0x3a,  0x20,  0x63,  0x68,  0x75,  0x6e,  0x6b, 
+ 0x2e,  0x64,  0x61,  0x74,  0x61,  0x20,  0x7d,  0x29,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x7d,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x69,  0x66,  0x20,  0x28,  0x63,  0x68,  0x75, 
+ 0x6e,  0x6b,  0x2e,  0x64,  0x61,  0x74,  0x61,  0x2e,  0x67,  0x65,  0x6e,  0x65,  0x72,  0x61,  0x74,  0x69, 
+ 0x6f,  0x6e,  0x5f,  0x73,  0x65,  0x74,  0x74,  0x69,  0x6e,  0x67,  0x73,  0x29,  0x20,  0x7b,  0x0a,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x65,  0x76,  0x65,  0x6e,  0x74,  0x54,  0x61,  0x72,  0x67, 
+ 0x65,  0x74,  0x2e,  0x64,  0x69,  0x73,  0x70,  0x61,  0x74,  0x63,  0x68,  0x45,  0x76,  0x65,  0x6e,  0x74, 
+ 0x28,  0x6e,  0x65,  0x77,  0x20,  0x43,  0x75,  0x73,  0x74,  0x6f,  0x6d,  0x45,  0x76,  0x65,  0x6e,  0x74, 
+ 0x28,  0x22,  0x67,  0x65,  0x6e,  0x65,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x5f,  0x73,  0x65,  0x74, 
+ 0x74,  0x69,  0x6e,  0x67,  0x73,  0x22,  0x2c,  0x20,  0x7b,  0x20,  0x64,  0x65,  0x74,  0x61,  0x69,  0x6c, 
+ 0x3a,  0x20,  0x63,  0x68,  0x75,  0x6e,  0x6b,  0x2e,  0x64,  0x61,  0x74,  0x61,  0x2e,  0x67,  0x65,  0x6e, 
+ 0x65,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x5f,  0x73,  0x65,  0x74,  0x74,  0x69,  0x6e,  0x67,  0x73, 
+ 0x20,  0x7d,  0x29,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x7d,  0x0a,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x69,  0x66,  0x20,  0x28,  0x63,  0x68,  0x75,  0x6e,  0x6b,  0x2e,  0x64,  0x61, 
+ 0x74,  0x61,  0x2e,  0x74,  0x69,  0x6d,  0x69,  0x6e,  0x67,  0x73,  0x29,  0x20,  0x7b,  0x0a,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x65,  0x76,  0x65,  0x6e,  0x74,  0x54,  0x61,  0x72,  0x67,  0x65, 
+ 0x74,  0x2e,  0x64,  0x69,  0x73,  0x70,  0x61,  0x74,  0x63,  0x68,  0x45,  0x76,  0x65,  0x6e,  0x74,  0x28, 
+ 0x6e,  0x65,  0x77,  0x20,  0x43,  0x75,  0x73,  0x74,  0x6f,  0x6d,  0x45,  0x76,  0x65,  0x6e,  0x74,  0x28, 
+ 0x22,  0x74,  0x69,  0x6d,  0x69,  0x6e,  0x67,  0x73,  0x22,  0x2c,  0x20,  0x7b,  0x20,  0x64,  0x65,  0x74, 
+ 0x61,  0x69,  0x6c,  0x3a,  0x20,  0x63,  0x68,  0x75,  0x6e,  0x6b,  0x2e,  0x64,  0x61,  0x74,  0x61,  0x2e, 
+ 0x74,  0x69,  0x6d,  0x69,  0x6e,  0x67,  0x73,  0x20,  0x7d,  0x29,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x7d,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x7d,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x65, 
+ 0x76,  0x65,  0x6e,  0x74,  0x54,  0x61,  0x72,  0x67,  0x65,  0x74,  0x2e,  0x64,  0x69,  0x73,  0x70,  0x61, 
+ 0x74,  0x63,  0x68,  0x45,  0x76,  0x65,  0x6e,  0x74,  0x28,  0x6e,  0x65,  0x77,  0x20,  0x43,  0x75,  0x73, 
+ 0x74,  0x6f,  0x6d,  0x45,  0x76,  0x65,  0x6e,  0x74,  0x28,  0x22,  0x64,  0x6f,  0x6e,  0x65,  0x22,  0x2c, 
+ 0x20,  0x7b,  0x20,  0x64,  0x65,  0x74,  0x61,  0x69,  0x6c,  0x3a,  0x20,  0x7b,  0x20,  0x63,  0x6f,  0x6e, 
+ 0x74,  0x65,  0x6e,  0x74,  0x20,  0x7d,  0x20,  0x7d,  0x29,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x7d,  0x29, 
+ 0x28,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x72,  0x65,  0x74,  0x75,  0x72,  0x6e,  0x20,  0x65,  0x76,  0x65, 
+ 0x6e,  0x74,  0x54,  0x61,  0x72,  0x67,  0x65,  0x74,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2f,  0x2f,  0x20, 
+ 0x43,  0x61,  0x6c,  0x6c,  0x20,  0x6c,  0x6c,  0x61,  0x6d,  0x61,  0x2c,  0x20,  0x72,  0x65,  0x74,  0x75, 
+ 0x72,  0x6e,  0x20,  0x61,  0x20,  0x70,  0x72,  0x6f,  0x6d,  0x69,  0x73,  0x65,  0x20,  0x74,  0x68,  0x61, 
+ 0x74,  0x20,  0x72,  0x65,  0x73,  0x6f,  0x6c,  0x76,  0x65,  0x73,  0x20,  0x74,  0x6f,  0x20,  0x74,  0x68, 
+ 0x65,  0x20,  0x63,  0x6f,  0x6d,  0x70,  0x6c,  0x65,  0x74,  0x65,  0x64,  0x20,  0x74,  0x65,  0x78,  0x74, 
+ 0x2e,  0x20,  0x54,  0x68,  0x69,  0x73,  0x20,  0x64,  0x6f,  0x65,  0x73,  0x20,  0x6e,  0x6f,  0x74,  0x20, 
+ 0x73,  0x75,  0x70,  0x70,  0x6f,  0x72,  0x74,  0x20,  0x73,  0x74,  0x72,  0x65,  0x61,  0x6d,  0x69,  0x6e, 
+ 0x67,  0x0a,  0x2f,  0x2f,  0x0a,  0x2f,  0x2f,  0x20,  0x45,  0x78,  0x61,  0x6d,  0x70,  0x6c,  0x65,  0x3a, 
+ 0x0a,  0x2f,  0x2f,  0x0a,  0x2f,  0x2f,  0x20,  0x20,  0x20,  0x20,  0x20,  0x6c,  0x6c,  0x61,  0x6d,  0x61, 
+ 0x50,  0x72,  0x6f,  0x6d,  0x69,  0x73,  0x65,  0x28,  0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x29,  0x2e, 
+ 0x74,  0x68,  0x65,  0x6e,  0x28,  0x28,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x29,  0x20,  0x3d, 
+ 0x3e,  0x20,  0x7b,  0x0a,  0x2f,  0x2f,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x64,  0x6f,  0x63, 
+ 0x75,  0x6d,  0x65,  0x6e,  0x74,  0x2e,  0x77,  0x72,  0x69,  0x74,  0x65,  0x28,  0x63,  0x6f,  0x6e,  0x74, 
+ 0x65,  0x6e,  0x74,  0x29,  0x0a,  0x2f,  0x2f,  0x20,  0x20,  0x20,  0x20,  0x20,  0x7d,  0x29,  0x0a,  0x2f, 
+ 0x2f,  0x0a,  0x2f,  0x2f,  0x20,  0x20,  0x20,  0x20,  0x20,  0x6f,  0x72,  0x0a,  0x2f,  0x2f,  0x0a,  0x2f, 
+ 0x2f,  0x20,  0x20,  0x20,  0x20,  0x20,  0x63,  0x6f,  0x6e,  0x73,  0x74,  0x20,  0x63,  0x6f,  0x6e,  0x74, 
+ 0x65,  0x6e,  0x74,  0x20,  0x3d,  0x20,  0x61,  0x77,  0x61,  0x69,  0x74,  0x20,  0x6c,  0x6c,  0x61,  0x6d, 
+ 0x61,  0x50,  0x72,  0x6f,  0x6d,  0x69,  0x73,  0x65,  0x28,  0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x29, 
+ 0x0a,  0x2f,  0x2f,  0x20,  0x20,  0x20,  0x20,  0x20,  0x64,  0x6f,  0x63,  0x75,  0x6d,  0x65,  0x6e,  0x74, 
+ 0x2e,  0x77,  0x72,  0x69,  0x74,  0x65,  0x28,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x29,  0x0a, 
+ 0x2f,  0x2f,  0x0a,  0x65,  0x78,  0x70,  0x6f,  0x72,  0x74,  0x20,  0x63,  0x6f,  0x6e,  0x73,  0x74,  0x20, 
+ 0x6c,  0x6c,  0x61,  0x6d,  0x61,  0x50,  0x72,  0x6f,  0x6d,  0x69,  0x73,  0x65,  0x20,  0x3d,  0x20,  0x28, 
+ 0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x2c,  0x20,  0x70,  0x61,  0x72,  0x61,  0x6d,  0x73,  0x20,  0x3d, 
+ 0x20,  0x7b,  0x7d,  0x2c,  0x20,  0x63,  0x6f,  0x6e,  0x66,  0x69,  0x67,  0x20,  0x3d,  0x20,  0x7b,  0x7d, 
+ 0x29,  0x20,  0x3d,  0x3e,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x72,  0x65,  0x74,  0x75,  0x72,  0x6e,  0x20, 
+ 0x6e,  0x65,  0x77,  0x20,  0x50,  0x72,  0x6f,  0x6d,  0x69,  0x73,  0x65,  0x28,  0x61,  0x73,  0x79,  0x6e, 
+ 0x63,  0x20,  0x28,  0x72,  0x65,  0x73,  0x6f,  0x6c,  0x76,  0x65,  0x2c,  0x20,  0x72,  0x65,  0x6a,  0x65, 
+ 0x63,  0x74,  0x29,  0x20,  0x3d,  0x3e,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x6c,  0x65,  0x74, 
+ 0x20,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x20,  0x3d,  0x20,  0x22,  0x22,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x20,  0x20,  0x74,  0x72,  0x79,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x66, 
+ 0x6f,  0x72,  0x20,  0x61,  0x77,  0x61,  0x69,  0x74,  0x20,  0x28,  0x63,  0x6f,  0x6e,  0x73,  0x74,  0x20, 
+ 0x63,  0x68,  0x75,  0x6e,  0x6b,  0x20,  0x6f,  0x66,  0x20,  0x6c,  0x6c,  0x61,  0x6d,  0x61,  0x28,  0x70, 
+ 0x72,  0x6f,  0x6d,  0x70,  0x74,  0x2c,  0x20,  0x70,  0x61,  0x72,  0x61,  0x6d,  0x73,  0x2c,  0x20,  0x63, 
+ 0x6f,  0x6e,  0x66,  0x69,  0x67,  0x29,  0x29,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x20,  0x2b,  0x3d,  0x20,  0x63,  0x68,  0x75, 
+ 0x6e,  0x6b,  0x2e,  0x64,  0x61,  0x74,  0x61,  0x2e,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x7d,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x72, 
+ 0x65,  0x73,  0x6f,  0x6c,  0x76,  0x65,  0x28,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x29,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x7d,  0x20,  0x63,  0x61,  0x74,  0x63,  0x68,  0x20,  0x28,  0x65,  0x72, 
+ 0x72,  0x6f,  0x72,  0x29,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x72,  0x65,  0x6a, 
+ 0x65,  0x63,  0x74,  0x28,  0x65,  0x72,  0x72,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20, 
+ 0x7d,  0x0a,  0x20,  0x20,  0x7d,  0x29,  0x3b,  0x0a,  0x7d,  0x3b,  0x0a,  0x0a,  0x2f,  0x2a,  0x2a,  0x0a, 
+ 0x20,  0x2a,  0x20,  0x28,  0x64,  0x65,  0x70,  0x72,  0x65,  0x63,  0x61,  0x74,  0x65,  0x64,  0x29,  0x0a, 
+ 0x20,  0x2a,  0x2f,  0x0a,  0x65,  0x78,  0x70,  0x6f,  0x72,  0x74,  0x20,  0x63,  0x6f,  0x6e,  0x73,  0x74, 
+ 0x20,  0x6c,  0x6c,  0x61,  0x6d,  0x61,  0x43,  0x6f,  0x6d,  0x70,  0x6c,  0x65,  0x74,  0x65,  0x20,  0x3d, 
+ 0x20,  0x61,  0x73,  0x79,  0x6e,  0x63,  0x20,  0x28,  0x70,  0x61,  0x72,  0x61,  0x6d,  0x73,  0x2c,  0x20, 
+ 0x63,  0x6f,  0x6e,  0x74,  0x72,  0x6f,  0x6c,  0x6c,  0x65,  0x72,  0x2c,  0x20,  0x63,  0x61,  0x6c,  0x6c, 
+ 0x62,  0x61,  0x63,  0x6b,  0x29,  0x20,  0x3d,  0x3e,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x72, 
+ 0x20,  0x61,  0x77,  0x61,  0x69,  0x74,  0x20,  0x28,  0x63,  0x6f,  0x6e,  0x73,  0x74,  0x20,  0x63,  0x68, 
+ 0x75,  0x6e,  0x6b,  0x20,  0x6f,  0x66,  0x20,  0x6c,  0x6c,  0x61,  0x6d,  0x61,  0x28,  0x70,  0x61,  0x72, 
+ 0x61,  0x6d,  0x73,  0x2e,  0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x2c,  0x20,  0x70,  0x61,  0x72,  0x61, 
+ 0x6d,  0x73,  0x2c,  0x20,  0x7b,  0x20,  0x63,  0x6f,  0x6e,  0x74,  0x72,  0x6f,  0x6c,  0x6c,  0x65,  0x72, 
+ 0x20,  0x7d,  0x29,  0x29,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x6c,  0x62, 
+ 0x61,  0x63,  0x6b,  0x28,  0x63,  0x68,  0x75,  0x6e,  0x6b,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x7d,  0x0a, 
+ 0x7d,  0x0a,  0x0a,  0x2f,  0x2f,  0x20,  0x47,  0x65,  0x74,  0x20,  0x74,  0x68,  0x65,  0x20,  0x6d,  0x6f, 
+ 0x64,  0x65,  0x6c,  0x20,  0x69,  0x6e,  0x66,  0x6f,  0x20,  0x66,  0x72,  0x6f,  0x6d,  0x20,  0x74,  0x68, 
+ 0x65,  0x20,  0x73,  0x65,  0x72,  0x76,  0x65,  0x72,  0x2e,  0x20,  0x54,  0x68,  0x69,  0x73,  0x20,  0x69, 
+ 0x73,  0x20,  0x75,  0x73,  0x65,  0x66,  0x75,  0x6c,  0x20,  0x66,  0x6f,  0x72,  0x20,  0x67,  0x65,  0x74, 
+ 0x74,  0x69,  0x6e,  0x67,  0x20,  0x74,  0x68,  0x65,  0x20,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x78,  0x74, 
+ 0x20,  0x77,  0x69,  0x6e,  0x64,  0x6f,  0x77,  0x20,  0x61,  0x6e,  0x64,  0x20,  0x73,  0x6f,  0x20,  0x6f, 
+ 0x6e,  0x2e,  0x0a,  0x65,  0x78,  0x70,  0x6f,  0x72,  0x74,  0x20,  0x63,  0x6f,  0x6e,  0x73,  0x74,  0x20, 
+ 0x6c,  0x6c,  0x61,  0x6d,  0x61,  0x4d,  0x6f,  0x64,  0x65,  0x6c,  0x49,  0x6e,  0x66,  0x6f,  0x20,  0x3d, 
+ 0x20,  0x61,  0x73,  0x79,  0x6e,  0x63,  0x20,  0x28,  0x63,  0x6f,  0x6e,  0x66,  0x69,  0x67,  0x20,  0x3d, 
+ 0x20,  0x7b,  0x7d,  0x29,  0x20,  0x3d,  0x3e,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x69,  0x66,  0x20,  0x28, 
+ 0x21,  0x67,  0x65,  0x6e,  0x65,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x5f,  0x73,  0x65,  0x74,  0x74, 
+ 0x69,  0x6e,  0x67,  0x73,  0x29,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x6f,  0x6e,  0x73, 
+ 0x74,  0x20,  0x61,  0x70,  0x69,  0x5f,  0x75,  0x72,  0x6c,  0x20,  0x3d,  0x20,  0x63,  0x6f,  0x6e,  0x66, 
+ 0x69,  0x67,  0x2e,  0x61,  0x70,  0x69,  0x5f,  0x75,  0x72,  0x6c,  0x3f,  0x2e,  0x72,  0x65,  0x70,  0x6c, 
+ 0x61,  0x63,  0x65,  0x28,  0x2f,  0x5c,  0x2f,  0x2b,  0x24,  0x2f,  0x2c,  0x20,  0x27,  0x27,  0x29,  0x20, 
+ 0x7c,  0x7c,  0x20,  0x22,  0x22,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x6f,  0x6e,  0x73,  0x74, 
+ 0x20,  0x70,  0x72,  0x6f,  0x70,  0x73,  0x20,  0x3d,  0x20,  0x61,  0x77,  0x61,  0x69,  0x74,  0x20,  0x66, 
+ 0x65,  0x74,  0x63,  0x68,  0x28,  0x60,  0x24,  0x7b,  0x61,  0x70,  0x69,  0x5f,  0x75,  0x72,  0x6c,  0x7d, 
+ 0x2f,  0x70,  0x72,  0x6f,  0x70,  0x73,  0x60,  0x29,  0x2e,  0x74,  0x68,  0x65,  0x6e,  0x28,  0x72,  0x20, 
+ 0x3d,  0x3e,  0x20,  0x72,  0x2e,  0x6a,  0x73,  0x6f,  0x6e,  0x28,  0x29,  0x29,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x20,  0x20,  0x67,  0x65,  0x6e,  0x65,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x5f,  0x73,  0x65,  0x74, 
+ 0x74,  0x69,  0x6e,  0x67,  0x73,  0x20,  0x3d,  0x20,  0x70,  0x72,  0x6f,  0x70,  0x73,  0x2e,  0x64,  0x65, 
+ 0x66,  0x61,  0x75,  0x6c,  0x74,  0x5f,  0x67,  0x65,  0x6e,  0x65,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e, 
+ 0x5f,  0x73,  0x65,  0x74,  0x74,  0x69,  0x6e,  0x67,  0x73,  0x3b,  0x0a,  0x20,  0x20,  0x7d,  0x0a,  0x20, 
+ 0x20,  0x72,  0x65,  0x74,  0x75,  0x72,  0x6e,  0x20,  0x67,  0x65,  0x6e,  0x65,  0x72,  0x61,  0x74,  0x69, 
+ 0x6f,  0x6e,  0x5f,  0x73,  0x65,  0x74,  0x74,  0x69,  0x6e,  0x67,  0x73,  0x3b,  0x0a,  0x7d,  0x0a, 
+};
+unsigned int completion_js_len = 5951;
@@ -0,0 +1,20 @@
+unsigned char loading_html[] = {
+ 0x3c,  0x21,  0x44,  0x4f,  0x43,  0x54,  0x59,  0x50,  0x45,  0x20,  0x68,  0x74,  0x6d,  0x6c,  0x3e,  0x0a, 
+ 0x3c,  0x68,  0x74,  0x6d,  0x6c,  0x3e,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x3c,  0x68,  0x65,  0x61,  0x64, 
+ 0x3e,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x3c,  0x6d,  0x65,  0x74,  0x61,  0x20, 
+ 0x68,  0x74,  0x74,  0x70,  0x2d,  0x65,  0x71,  0x75,  0x69,  0x76,  0x3d,  0x22,  0x72,  0x65,  0x66,  0x72, 
+ 0x65,  0x73,  0x68,  0x22,  0x20,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x3d,  0x22,  0x35,  0x22, 
+ 0x3e,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x3c,  0x2f,  0x68,  0x65,  0x61,  0x64,  0x3e,  0x0a,  0x20,  0x20, 
+ 0x20,  0x20,  0x3c,  0x62,  0x6f,  0x64,  0x79,  0x3e,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x3c,  0x64,  0x69,  0x76,  0x20,  0x69,  0x64,  0x3d,  0x22,  0x6c,  0x6f,  0x61,  0x64,  0x69,  0x6e, 
+ 0x67,  0x22,  0x3e,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x54,  0x68,  0x65,  0x20,  0x6d,  0x6f,  0x64,  0x65,  0x6c,  0x20,  0x69,  0x73,  0x20,  0x6c,  0x6f,  0x61, 
+ 0x64,  0x69,  0x6e,  0x67,  0x2e,  0x20,  0x50,  0x6c,  0x65,  0x61,  0x73,  0x65,  0x20,  0x77,  0x61,  0x69, 
+ 0x74,  0x2e,  0x3c,  0x62,  0x72,  0x2f,  0x3e,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x54,  0x68,  0x65,  0x20,  0x75,  0x73,  0x65,  0x72,  0x20,  0x69,  0x6e,  0x74, 
+ 0x65,  0x72,  0x66,  0x61,  0x63,  0x65,  0x20,  0x77,  0x69,  0x6c,  0x6c,  0x20,  0x61,  0x70,  0x70,  0x65, 
+ 0x61,  0x72,  0x20,  0x73,  0x6f,  0x6f,  0x6e,  0x2e,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x3c,  0x2f,  0x64,  0x69,  0x76,  0x3e,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x3c,  0x2f,  0x62,  0x6f, 
+ 0x64,  0x79,  0x3e,  0x0a,  0x3c,  0x2f,  0x68,  0x74,  0x6d,  0x6c,  0x3e,  0x0a, 
+};
+unsigned int loading_html_len = 268;
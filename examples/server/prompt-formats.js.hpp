@@ -0,0 +1,389 @@
+unsigned char prompt_formats_js[] = {
+ 0x2f,  0x2f,  0x20,  0x65,  0x78,  0x74,  0x65,  0x6e,  0x64,  0x65,  0x64,  0x20,  0x6c,  0x69,  0x73,  0x74, 
+ 0x0a,  0x65,  0x78,  0x70,  0x6f,  0x72,  0x74,  0x20,  0x63,  0x6f,  0x6e,  0x73,  0x74,  0x20,  0x70,  0x72, 
+ 0x6f,  0x6d,  0x70,  0x74,  0x46,  0x6f,  0x72,  0x6d,  0x61,  0x74,  0x73,  0x20,  0x3d,  0x20,  0x7b,  0x0a, 
+ 0x20,  0x20,  0x22,  0x61,  0x6c,  0x70,  0x61,  0x63,  0x61,  0x22,  0x3a,  0x20,  0x7b,  0x0a,  0x20,  0x20, 
+ 0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x7b,  0x7b,  0x70,  0x72,  0x6f, 
+ 0x6d,  0x70,  0x74,  0x7d,  0x7d,  0x5c,  0x6e,  0x5c,  0x6e,  0x7b,  0x7b,  0x68,  0x69,  0x73,  0x74,  0x6f, 
+ 0x72,  0x79,  0x7d,  0x7d,  0x5c,  0x6e,  0x5c,  0x6e,  0x7b,  0x7b,  0x63,  0x68,  0x61,  0x72,  0x7d,  0x7d, 
+ 0x3a,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x54,  0x65, 
+ 0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x23,  0x23,  0x23,  0x20,  0x7b,  0x7b,  0x6e, 
+ 0x61,  0x6d,  0x65,  0x7d,  0x7d,  0x3a,  0x5c,  0x6e,  0x7b,  0x7b,  0x6d,  0x65,  0x73,  0x73,  0x61,  0x67, 
+ 0x65,  0x7d,  0x7d,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x3a,  0x20,  0x22, 
+ 0x52,  0x65,  0x73,  0x70,  0x6f,  0x6e,  0x73,  0x65,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61, 
+ 0x72,  0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a, 
+ 0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a, 
+ 0x20,  0x22,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x3a,  0x20,  0x22,  0x49, 
+ 0x6e,  0x73,  0x74,  0x72,  0x75,  0x63,  0x74,  0x69,  0x6f,  0x6e,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75, 
+ 0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22, 
+ 0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69, 
+ 0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x73,  0x74,  0x6f,  0x70,  0x73,  0x3a, 
+ 0x20,  0x22,  0x22,  0x0a,  0x20,  0x20,  0x7d,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x2f,  0x2f,  0x20,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x0a,  0x0a,  0x20,  0x20,  0x22, 
+ 0x63,  0x68,  0x61,  0x74,  0x6d,  0x6c,  0x22,  0x3a,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x6d, 
+ 0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x3c,  0x7c,  0x69,  0x6d,  0x5f,  0x73,  0x74,  0x61, 
+ 0x72,  0x74,  0x7c,  0x3e,  0x73,  0x79,  0x73,  0x74,  0x65,  0x6d,  0x5c,  0x6e,  0x7b,  0x7b,  0x70,  0x72, 
+ 0x6f,  0x6d,  0x70,  0x74,  0x7d,  0x7d,  0x3c,  0x7c,  0x69,  0x6d,  0x5f,  0x65,  0x6e,  0x64,  0x7c,  0x3e, 
+ 0x5c,  0x6e,  0x7b,  0x7b,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x7d,  0x7d,  0x7b,  0x7b,  0x63, 
+ 0x68,  0x61,  0x72,  0x7d,  0x7d,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x68,  0x69,  0x73,  0x74,  0x6f, 
+ 0x72,  0x79,  0x54,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x3c,  0x7c,  0x69, 
+ 0x6d,  0x5f,  0x73,  0x74,  0x61,  0x72,  0x74,  0x7c,  0x3e,  0x7b,  0x7b,  0x6e,  0x61,  0x6d,  0x65,  0x7d, 
+ 0x7d,  0x5c,  0x6e,  0x7b,  0x7b,  0x6d,  0x65,  0x73,  0x73,  0x61,  0x67,  0x65,  0x7d,  0x7d,  0x60,  0x2c, 
+ 0x0a,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x3a,  0x20,  0x22,  0x61,  0x73,  0x73,  0x69,  0x73, 
+ 0x74,  0x61,  0x6e,  0x74,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73,  0x67, 
+ 0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68, 
+ 0x61,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c, 
+ 0x0a,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x3a,  0x20,  0x22,  0x75,  0x73,  0x65,  0x72,  0x22, 
+ 0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66,  0x69, 
+ 0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73,  0x67, 
+ 0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x3c,  0x7c,  0x69,  0x6d,  0x5f,  0x65,  0x6e, 
+ 0x64,  0x7c,  0x3e,  0x5c,  0x6e,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x73,  0x74,  0x6f,  0x70,  0x73, 
+ 0x3a,  0x20,  0x22,  0x22,  0x0a,  0x20,  0x20,  0x7d,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x2f,  0x2f,  0x20, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x0a,  0x0a,  0x20,  0x20, 
+ 0x22,  0x63,  0x6f,  0x6d,  0x6d,  0x61,  0x6e,  0x64,  0x72,  0x22,  0x3a,  0x20,  0x7b,  0x0a,  0x20,  0x20, 
+ 0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x3c,  0x42,  0x4f,  0x53,  0x5f, 
+ 0x54,  0x4f,  0x4b,  0x45,  0x4e,  0x3e,  0x3c,  0x7c,  0x53,  0x54,  0x41,  0x52,  0x54,  0x5f,  0x4f,  0x46, 
+ 0x5f,  0x54,  0x55,  0x52,  0x4e,  0x5f,  0x54,  0x4f,  0x4b,  0x45,  0x4e,  0x7c,  0x3e,  0x3c,  0x7c,  0x53, 
+ 0x59,  0x53,  0x54,  0x45,  0x4d,  0x5f,  0x54,  0x4f,  0x4b,  0x45,  0x4e,  0x7c,  0x3e,  0x7b,  0x7b,  0x70, 
+ 0x72,  0x6f,  0x6d,  0x70,  0x74,  0x7d,  0x7d,  0x5c,  0x6e,  0x3c,  0x7c,  0x45,  0x4e,  0x44,  0x5f,  0x4f, 
+ 0x46,  0x5f,  0x54,  0x55,  0x52,  0x4e,  0x5f,  0x54,  0x4f,  0x4b,  0x45,  0x4e,  0x7c,  0x3e,  0x7b,  0x7b, 
+ 0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x7d,  0x7d,  0x7b,  0x7b,  0x63,  0x68,  0x61,  0x72,  0x7d, 
+ 0x7d,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x54,  0x65, 
+ 0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x3c,  0x7c,  0x53,  0x54,  0x41,  0x52,  0x54, 
+ 0x5f,  0x4f,  0x46,  0x5f,  0x54,  0x55,  0x52,  0x4e,  0x5f,  0x54,  0x4f,  0x4b,  0x45,  0x4e,  0x7c,  0x3e, 
+ 0x3c,  0x7c,  0x7b,  0x7b,  0x6e,  0x61,  0x6d,  0x65,  0x7d,  0x7d,  0x7c,  0x3e,  0x20,  0x7b,  0x7b,  0x6d, 
+ 0x65,  0x73,  0x73,  0x61,  0x67,  0x65,  0x7d,  0x7d,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x63,  0x68, 
+ 0x61,  0x72,  0x3a,  0x20,  0x22,  0x43,  0x48,  0x41,  0x54,  0x42,  0x4f,  0x54,  0x5f,  0x54,  0x4f,  0x4b, 
+ 0x45,  0x4e,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x50,  0x72, 
+ 0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72, 
+ 0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x0a, 
+ 0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x3a,  0x20,  0x22,  0x55,  0x53,  0x45,  0x52,  0x5f,  0x54,  0x4f, 
+ 0x4b,  0x45,  0x4e,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x50, 
+ 0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65, 
+ 0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x3c,  0x7c,  0x45, 
+ 0x4e,  0x44,  0x5f,  0x4f,  0x46,  0x5f,  0x54,  0x55,  0x52,  0x4e,  0x5f,  0x54,  0x4f,  0x4b,  0x45,  0x4e, 
+ 0x7c,  0x3e,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x73,  0x74,  0x6f,  0x70,  0x73,  0x3a,  0x20,  0x22, 
+ 0x22,  0x0a,  0x20,  0x20,  0x7d,  0x2c,  0x0a,  0x20,  0x20,  0x2f,  0x2f,  0x20,  0x72,  0x65,  0x66,  0x3a, 
+ 0x20,  0x68,  0x74,  0x74,  0x70,  0x73,  0x3a,  0x2f,  0x2f,  0x64,  0x6f,  0x63,  0x73,  0x2e,  0x63,  0x6f, 
+ 0x68,  0x65,  0x72,  0x65,  0x2e,  0x63,  0x6f,  0x6d,  0x2f,  0x64,  0x6f,  0x63,  0x73,  0x2f,  0x70,  0x72, 
+ 0x6f,  0x6d,  0x70,  0x74,  0x69,  0x6e,  0x67,  0x2d,  0x63,  0x6f,  0x6d,  0x6d,  0x61,  0x6e,  0x64,  0x2d, 
+ 0x72,  0x0a,  0x0a,  0x20,  0x20,  0x2f,  0x2f,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x0a,  0x0a,  0x20,  0x20,  0x22,  0x6c,  0x6c,  0x61,  0x6d,  0x61,  0x32,  0x22, 
+ 0x3a,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20, 
+ 0x60,  0x3c,  0x73,  0x3e,  0x5b,  0x49,  0x4e,  0x53,  0x54,  0x5d,  0x20,  0x3c,  0x3c,  0x53,  0x59,  0x53, 
+ 0x3e,  0x3e,  0x5c,  0x6e,  0x7b,  0x7b,  0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x7d,  0x7d,  0x5c,  0x6e, 
+ 0x3c,  0x3c,  0x2f,  0x53,  0x59,  0x53,  0x3e,  0x3e,  0x5c,  0x6e,  0x5c,  0x6e,  0x54,  0x65,  0x73,  0x74, 
+ 0x20,  0x4d,  0x65,  0x73,  0x73,  0x61,  0x67,  0x65,  0x20,  0x5b,  0x2f,  0x49,  0x4e,  0x53,  0x54,  0x5d, 
+ 0x20,  0x54,  0x65,  0x73,  0x74,  0x20,  0x53,  0x75,  0x63,  0x63,  0x65,  0x73,  0x73,  0x66,  0x75,  0x6c, 
+ 0x6c,  0x20,  0x3c,  0x2f,  0x73,  0x3e,  0x7b,  0x7b,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x7d, 
+ 0x7d,  0x7b,  0x7b,  0x63,  0x68,  0x61,  0x72,  0x7d,  0x7d,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x68, 
+ 0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x54,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20, 
+ 0x60,  0x7b,  0x7b,  0x6e,  0x61,  0x6d,  0x65,  0x7d,  0x7d,  0x3a,  0x20,  0x7b,  0x7b,  0x6d,  0x65,  0x73, 
+ 0x73,  0x61,  0x67,  0x65,  0x7d,  0x7d,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72, 
+ 0x3a,  0x20,  0x22,  0x41,  0x73,  0x73,  0x69,  0x73,  0x74,  0x61,  0x6e,  0x74,  0x22,  0x2c,  0x0a,  0x20, 
+ 0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20, 
+ 0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66, 
+ 0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x3c,  0x2f,  0x73,  0x3e,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20, 
+ 0x75,  0x73,  0x65,  0x72,  0x3a,  0x20,  0x22,  0x55,  0x73,  0x65,  0x72,  0x22,  0x2c,  0x0a,  0x20,  0x20, 
+ 0x75,  0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22, 
+ 0x3c,  0x73,  0x3e,  0x5b,  0x49,  0x4e,  0x53,  0x54,  0x5d,  0x20,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75, 
+ 0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x20, 
+ 0x5b,  0x2f,  0x49,  0x4e,  0x53,  0x54,  0x5d,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x73,  0x74,  0x6f, 
+ 0x70,  0x73,  0x3a,  0x20,  0x22,  0x22,  0x0a,  0x20,  0x20,  0x7d,  0x2c,  0x0a,  0x20,  0x20,  0x2f,  0x2f, 
+ 0x20,  0x72,  0x65,  0x66,  0x3a,  0x20,  0x68,  0x74,  0x74,  0x70,  0x73,  0x3a,  0x2f,  0x2f,  0x68,  0x75, 
+ 0x67,  0x67,  0x69,  0x6e,  0x67,  0x66,  0x61,  0x63,  0x65,  0x2e,  0x63,  0x6f,  0x2f,  0x62,  0x6c,  0x6f, 
+ 0x67,  0x2f,  0x6c,  0x6c,  0x61,  0x6d,  0x61,  0x32,  0x23,  0x68,  0x6f,  0x77,  0x2d,  0x74,  0x6f,  0x2d, 
+ 0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x2d,  0x6c,  0x6c,  0x61,  0x6d,  0x61,  0x2d,  0x32,  0x0a,  0x0a, 
+ 0x20,  0x20,  0x2f,  0x2f,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x0a,  0x0a,  0x20,  0x20,  0x22,  0x6c,  0x6c,  0x61,  0x6d,  0x61,  0x33,  0x22,  0x3a,  0x20,  0x7b, 
+ 0x0a,  0x20,  0x20,  0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x3c,  0x7c, 
+ 0x62,  0x65,  0x67,  0x69,  0x6e,  0x5f,  0x6f,  0x66,  0x5f,  0x74,  0x65,  0x78,  0x74,  0x7c,  0x3e,  0x3c, 
+ 0x7c,  0x73,  0x74,  0x61,  0x72,  0x74,  0x5f,  0x68,  0x65,  0x61,  0x64,  0x65,  0x72,  0x5f,  0x69,  0x64, 
+ 0x7c,  0x3e,  0x73,  0x79,  0x73,  0x74,  0x65,  0x6d,  0x3c,  0x7c,  0x65,  0x6e,  0x64,  0x5f,  0x68,  0x65, 
+ 0x61,  0x64,  0x65,  0x72,  0x5f,  0x69,  0x64,  0x7c,  0x3e,  0x5c,  0x6e,  0x5c,  0x6e,  0x7b,  0x7b,  0x70, 
+ 0x72,  0x6f,  0x6d,  0x70,  0x74,  0x7d,  0x7d,  0x7b,  0x7b,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79, 
+ 0x7d,  0x7d,  0x7b,  0x7b,  0x63,  0x68,  0x61,  0x72,  0x7d,  0x7d,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20, 
+ 0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x54,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a, 
+ 0x20,  0x60,  0x3c,  0x7c,  0x73,  0x74,  0x61,  0x72,  0x74,  0x5f,  0x68,  0x65,  0x61,  0x64,  0x65,  0x72, 
+ 0x5f,  0x69,  0x64,  0x7c,  0x3e,  0x7b,  0x7b,  0x6e,  0x61,  0x6d,  0x65,  0x7d,  0x7d,  0x3c,  0x7c,  0x65, 
+ 0x6e,  0x64,  0x5f,  0x68,  0x65,  0x61,  0x64,  0x65,  0x72,  0x5f,  0x69,  0x64,  0x7c,  0x3e,  0x5c,  0x6e, 
+ 0x5c,  0x6e,  0x7b,  0x7b,  0x6d,  0x65,  0x73,  0x73,  0x61,  0x67,  0x65,  0x7d,  0x7d,  0x3c,  0x7c,  0x65, 
+ 0x6f,  0x74,  0x5f,  0x69,  0x64,  0x7c,  0x3e,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61, 
+ 0x72,  0x3a,  0x20,  0x22,  0x61,  0x73,  0x73,  0x69,  0x73,  0x74,  0x61,  0x6e,  0x74,  0x22,  0x2c,  0x0a, 
+ 0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a, 
+ 0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75, 
+ 0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65, 
+ 0x72,  0x3a,  0x20,  0x22,  0x75,  0x73,  0x65,  0x72,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65, 
+ 0x72,  0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a, 
+ 0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a, 
+ 0x20,  0x22,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x73,  0x74,  0x6f,  0x70,  0x73,  0x3a,  0x20,  0x22, 
+ 0x3c,  0x7c,  0x65,  0x6f,  0x74,  0x5f,  0x69,  0x64,  0x7c,  0x3e,  0x22,  0x0a,  0x20,  0x20,  0x7d,  0x2c, 
+ 0x0a,  0x20,  0x20,  0x2f,  0x2f,  0x20,  0x72,  0x65,  0x66,  0x3a,  0x20,  0x68,  0x74,  0x74,  0x70,  0x73, 
+ 0x3a,  0x2f,  0x2f,  0x6c,  0x6c,  0x61,  0x6d,  0x61,  0x2e,  0x6d,  0x65,  0x74,  0x61,  0x2e,  0x63,  0x6f, 
+ 0x6d,  0x2f,  0x64,  0x6f,  0x63,  0x73,  0x2f,  0x6d,  0x6f,  0x64,  0x65,  0x6c,  0x2d,  0x63,  0x61,  0x72, 
+ 0x64,  0x73,  0x2d,  0x61,  0x6e,  0x64,  0x2d,  0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x2d,  0x66,  0x6f, 
+ 0x72,  0x6d,  0x61,  0x74,  0x73,  0x2f,  0x6d,  0x65,  0x74,  0x61,  0x2d,  0x6c,  0x6c,  0x61,  0x6d,  0x61, 
+ 0x2d,  0x33,  0x2f,  0x23,  0x73,  0x70,  0x65,  0x63,  0x69,  0x61,  0x6c,  0x2d,  0x74,  0x6f,  0x6b,  0x65, 
+ 0x6e,  0x73,  0x2d,  0x75,  0x73,  0x65,  0x64,  0x2d,  0x77,  0x69,  0x74,  0x68,  0x2d,  0x6d,  0x65,  0x74, 
+ 0x61,  0x2d,  0x6c,  0x6c,  0x61,  0x6d,  0x61,  0x2d,  0x33,  0x0a,  0x0a,  0x20,  0x20,  0x2f,  0x2f,  0x20, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x0a,  0x0a,  0x20,  0x20, 
+ 0x22,  0x6f,  0x70,  0x65,  0x6e,  0x63,  0x68,  0x61,  0x74,  0x22,  0x3a,  0x20,  0x7b,  0x0a,  0x20,  0x20, 
+ 0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x7b,  0x7b,  0x68,  0x69,  0x73, 
+ 0x74,  0x6f,  0x72,  0x79,  0x7d,  0x7d,  0x7b,  0x7b,  0x63,  0x68,  0x61,  0x72,  0x7d,  0x7d,  0x60,  0x2c, 
+ 0x0a,  0x0a,  0x20,  0x20,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x54,  0x65,  0x6d,  0x70,  0x6c, 
+ 0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x47,  0x50,  0x54,  0x34,  0x20,  0x43,  0x6f,  0x72,  0x72,  0x65, 
+ 0x63,  0x74,  0x20,  0x7b,  0x7b,  0x6e,  0x61,  0x6d,  0x65,  0x7d,  0x7d,  0x3a,  0x20,  0x7b,  0x7b,  0x6d, 
+ 0x65,  0x73,  0x73,  0x61,  0x67,  0x65,  0x7d,  0x7d,  0x3c,  0x7c,  0x65,  0x6e,  0x64,  0x5f,  0x6f,  0x66, 
+ 0x5f,  0x74,  0x75,  0x72,  0x6e,  0x7c,  0x3e,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61, 
+ 0x72,  0x3a,  0x20,  0x22,  0x41,  0x73,  0x73,  0x69,  0x73,  0x74,  0x61,  0x6e,  0x74,  0x22,  0x2c,  0x0a, 
+ 0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a, 
+ 0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75, 
+ 0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65, 
+ 0x72,  0x3a,  0x20,  0x22,  0x55,  0x73,  0x65,  0x72,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65, 
+ 0x72,  0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a, 
+ 0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a, 
+ 0x20,  0x22,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x73,  0x74,  0x6f,  0x70,  0x73,  0x3a,  0x20,  0x22, 
+ 0x22,  0x0a,  0x20,  0x20,  0x7d,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x2f,  0x2f,  0x20,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x0a,  0x0a,  0x20,  0x20,  0x22,  0x70,  0x68, 
+ 0x69,  0x33,  0x22,  0x3a,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74, 
+ 0x65,  0x3a,  0x20,  0x60,  0x7b,  0x7b,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x7d,  0x7d,  0x7b, 
+ 0x7b,  0x63,  0x68,  0x61,  0x72,  0x7d,  0x7d,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x68,  0x69,  0x73, 
+ 0x74,  0x6f,  0x72,  0x79,  0x54,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x3c, 
+ 0x7c,  0x7b,  0x7b,  0x6e,  0x61,  0x6d,  0x65,  0x7d,  0x7d,  0x7c,  0x3e,  0x5c,  0x6e,  0x7b,  0x7b,  0x6d, 
+ 0x65,  0x73,  0x73,  0x61,  0x67,  0x65,  0x7d,  0x7d,  0x3c,  0x7c,  0x65,  0x6e,  0x64,  0x7c,  0x3e,  0x5c, 
+ 0x6e,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x3a,  0x20,  0x22,  0x61,  0x73, 
+ 0x73,  0x69,  0x73,  0x74,  0x61,  0x6e,  0x74,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72, 
+ 0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20, 
+ 0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20, 
+ 0x22,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x3a,  0x20,  0x22,  0x75,  0x73, 
+ 0x65,  0x72,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x50,  0x72, 
+ 0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72, 
+ 0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x0a, 
+ 0x20,  0x20,  0x73,  0x74,  0x6f,  0x70,  0x73,  0x3a,  0x20,  0x22,  0x3c,  0x7c,  0x65,  0x6e,  0x64,  0x7c, 
+ 0x3e,  0x22,  0x0a,  0x20,  0x20,  0x7d,  0x2c,  0x0a,  0x20,  0x20,  0x2f,  0x2f,  0x20,  0x72,  0x65,  0x66, 
+ 0x3a,  0x20,  0x68,  0x74,  0x74,  0x70,  0x73,  0x3a,  0x2f,  0x2f,  0x68,  0x75,  0x67,  0x67,  0x69,  0x6e, 
+ 0x67,  0x66,  0x61,  0x63,  0x65,  0x2e,  0x63,  0x6f,  0x2f,  0x6d,  0x69,  0x63,  0x72,  0x6f,  0x73,  0x6f, 
+ 0x66,  0x74,  0x2f,  0x50,  0x68,  0x69,  0x2d,  0x33,  0x2d,  0x6d,  0x69,  0x6e,  0x69,  0x2d,  0x34,  0x6b, 
+ 0x2d,  0x69,  0x6e,  0x73,  0x74,  0x72,  0x75,  0x63,  0x74,  0x23,  0x63,  0x68,  0x61,  0x74,  0x2d,  0x66, 
+ 0x6f,  0x72,  0x6d,  0x61,  0x74,  0x0a,  0x0a,  0x20,  0x20,  0x2f,  0x2f,  0x20,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x0a,  0x0a,  0x20,  0x20,  0x22,  0x76,  0x69,  0x63, 
+ 0x75,  0x6e,  0x61,  0x22,  0x3a,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61, 
+ 0x74,  0x65,  0x3a,  0x20,  0x60,  0x7b,  0x7b,  0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x7d,  0x7d,  0x5c, 
+ 0x6e,  0x7b,  0x7b,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x7d,  0x7d,  0x7b,  0x7b,  0x63,  0x68, 
+ 0x61,  0x72,  0x7d,  0x7d,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72, 
+ 0x79,  0x54,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x7b,  0x7b,  0x6e,  0x61, 
+ 0x6d,  0x65,  0x7d,  0x7d,  0x3a,  0x20,  0x7b,  0x7b,  0x6d,  0x65,  0x73,  0x73,  0x61,  0x67,  0x65,  0x7d, 
+ 0x7d,  0x5c,  0x6e,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x3a,  0x20,  0x22, 
+ 0x41,  0x53,  0x53,  0x49,  0x53,  0x54,  0x41,  0x4e,  0x54,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68, 
+ 0x61,  0x72,  0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c, 
+ 0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78, 
+ 0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x3a,  0x20,  0x22, 
+ 0x55,  0x53,  0x45,  0x52,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73,  0x67, 
+ 0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73, 
+ 0x65,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c, 
+ 0x0a,  0x0a,  0x20,  0x20,  0x73,  0x74,  0x6f,  0x70,  0x73,  0x3a,  0x20,  0x22,  0x22,  0x0a,  0x20,  0x20, 
+ 0x7d,  0x2c,  0x0a,  0x20,  0x20,  0x2f,  0x2f,  0x20,  0x72,  0x65,  0x66,  0x3a,  0x20,  0x68,  0x74,  0x74, 
+ 0x70,  0x73,  0x3a,  0x2f,  0x2f,  0x68,  0x75,  0x67,  0x67,  0x69,  0x6e,  0x67,  0x66,  0x61,  0x63,  0x65, 
+ 0x2e,  0x63,  0x6f,  0x2f,  0x6c,  0x6d,  0x73,  0x79,  0x73,  0x2f,  0x76,  0x69,  0x63,  0x75,  0x6e,  0x61, 
+ 0x2d,  0x33,  0x33,  0x62,  0x2d,  0x76,  0x31,  0x2e,  0x33,  0x2f,  0x64,  0x69,  0x73,  0x63,  0x75,  0x73, 
+ 0x73,  0x69,  0x6f,  0x6e,  0x73,  0x2f,  0x31,  0x0a,  0x0a,  0x20,  0x20,  0x2f,  0x2f,  0x20,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x0a,  0x0a,  0x20,  0x20,  0x22,  0x64, 
+ 0x65,  0x65,  0x70,  0x73,  0x65,  0x65,  0x6b,  0x43,  0x6f,  0x64,  0x65,  0x72,  0x22,  0x3a,  0x20,  0x7b, 
+ 0x0a,  0x20,  0x20,  0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x7b,  0x7b, 
+ 0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x7d,  0x7d,  0x7b,  0x7b,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72, 
+ 0x79,  0x7d,  0x7d,  0x7b,  0x7b,  0x63,  0x68,  0x61,  0x72,  0x7d,  0x7d,  0x3a,  0x60,  0x2c,  0x0a,  0x0a, 
+ 0x20,  0x20,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x54,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74, 
+ 0x65,  0x3a,  0x20,  0x60,  0x23,  0x23,  0x23,  0x20,  0x7b,  0x7b,  0x6e,  0x61,  0x6d,  0x65,  0x7d,  0x7d, 
+ 0x3a,  0x5c,  0x6e,  0x7b,  0x7b,  0x6d,  0x65,  0x73,  0x73,  0x61,  0x67,  0x65,  0x7d,  0x7d,  0x60,  0x2c, 
+ 0x0a,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x3a,  0x20,  0x22,  0x52,  0x65,  0x73,  0x70,  0x6f, 
+ 0x6e,  0x73,  0x65,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x50, 
+ 0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61, 
+ 0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a, 
+ 0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x3a,  0x20,  0x22,  0x49,  0x6e,  0x73,  0x74,  0x72,  0x75, 
+ 0x63,  0x74,  0x69,  0x6f,  0x6e,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73, 
+ 0x67,  0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75, 
+ 0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22, 
+ 0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x73,  0x74,  0x6f,  0x70,  0x73,  0x3a,  0x20,  0x22,  0x3c,  0x7c,  0x45, 
+ 0x4f,  0x54,  0x7c,  0x3e,  0x22,  0x0a,  0x20,  0x20,  0x7d,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x2f,  0x2f, 
+ 0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x0a,  0x0a,  0x20, 
+ 0x20,  0x22,  0x6d,  0x65,  0x64,  0x34,  0x32,  0x22,  0x3a,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x74,  0x65, 
+ 0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x3c,  0x7c,  0x73,  0x79,  0x73,  0x74,  0x65, 
+ 0x6d,  0x7c,  0x3e,  0x3a,  0x20,  0x7b,  0x7b,  0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x7d,  0x7d,  0x5c, 
+ 0x6e,  0x7b,  0x7b,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x7d,  0x7d,  0x7b,  0x7b,  0x63,  0x68, 
+ 0x61,  0x72,  0x7d,  0x7d,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72, 
+ 0x79,  0x54,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x3c,  0x7c,  0x7b,  0x7b, 
+ 0x6e,  0x61,  0x6d,  0x65,  0x7d,  0x7d,  0x7c,  0x3e,  0x3a,  0x20,  0x7b,  0x7b,  0x6d,  0x65,  0x73,  0x73, 
+ 0x61,  0x67,  0x65,  0x7d,  0x7d,  0x5c,  0x6e,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61, 
+ 0x72,  0x3a,  0x20,  0x22,  0x61,  0x73,  0x73,  0x69,  0x73,  0x74,  0x61,  0x6e,  0x74,  0x22,  0x2c,  0x0a, 
+ 0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a, 
+ 0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75, 
+ 0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65, 
+ 0x72,  0x3a,  0x20,  0x22,  0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x65,  0x72,  0x22,  0x2c,  0x0a,  0x20, 
+ 0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20, 
+ 0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66, 
+ 0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x73,  0x74,  0x6f,  0x70, 
+ 0x73,  0x3a,  0x20,  0x22,  0x22,  0x0a,  0x20,  0x20,  0x7d,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x2f,  0x2f, 
+ 0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x0a,  0x0a,  0x20, 
+ 0x20,  0x22,  0x6e,  0x65,  0x75,  0x72,  0x61,  0x6c,  0x63,  0x68,  0x61,  0x74,  0x22,  0x3a,  0x20,  0x7b, 
+ 0x0a,  0x20,  0x20,  0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x23,  0x23, 
+ 0x23,  0x20,  0x53,  0x79,  0x73,  0x74,  0x65,  0x6d,  0x3a,  0x5c,  0x6e,  0x7b,  0x7b,  0x70,  0x72,  0x6f, 
+ 0x6d,  0x70,  0x74,  0x7d,  0x7d,  0x5c,  0x6e,  0x7b,  0x7b,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79, 
+ 0x7d,  0x7d,  0x7b,  0x7b,  0x63,  0x68,  0x61,  0x72,  0x7d,  0x7d,  0x3a,  0x60,  0x2c,  0x0a,  0x0a,  0x20, 
+ 0x20,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x54,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65, 
+ 0x3a,  0x20,  0x60,  0x23,  0x23,  0x23,  0x20,  0x7b,  0x7b,  0x6e,  0x61,  0x6d,  0x65,  0x7d,  0x7d,  0x3a, 
+ 0x5c,  0x6e,  0x7b,  0x7b,  0x6d,  0x65,  0x73,  0x73,  0x61,  0x67,  0x65,  0x7d,  0x7d,  0x5c,  0x6e,  0x60, 
+ 0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x3a,  0x20,  0x22,  0x41,  0x73,  0x73,  0x69, 
+ 0x73,  0x74,  0x61,  0x6e,  0x74,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73, 
+ 0x67,  0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63, 
+ 0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22, 
+ 0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x3a,  0x20,  0x22,  0x55,  0x73,  0x65,  0x72, 
+ 0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66, 
+ 0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73, 
+ 0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20, 
+ 0x73,  0x74,  0x6f,  0x70,  0x73,  0x3a,  0x20,  0x22,  0x22,  0x0a,  0x20,  0x20,  0x7d,  0x2c,  0x0a,  0x0a, 
+ 0x20,  0x20,  0x2f,  0x2f,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x0a,  0x0a,  0x20,  0x20,  0x22,  0x6e,  0x6f,  0x75,  0x73,  0x48,  0x65,  0x72,  0x6d,  0x65,  0x73, 
+ 0x22,  0x3a,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a, 
+ 0x20,  0x60,  0x23,  0x23,  0x23,  0x20,  0x49,  0x6e,  0x73,  0x74,  0x72,  0x75,  0x63,  0x74,  0x69,  0x6f, 
+ 0x6e,  0x3a,  0x20,  0x7b,  0x7b,  0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x7d,  0x7d,  0x5c,  0x6e,  0x5c, 
+ 0x6e,  0x7b,  0x7b,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x7d,  0x7d,  0x5c,  0x6e,  0x5c,  0x6e, 
+ 0x7b,  0x7b,  0x63,  0x68,  0x61,  0x72,  0x7d,  0x7d,  0x3a,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x68, 
+ 0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x54,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20, 
+ 0x60,  0x23,  0x23,  0x23,  0x20,  0x7b,  0x7b,  0x6e,  0x61,  0x6d,  0x65,  0x7d,  0x7d,  0x3a,  0x5c,  0x6e, 
+ 0x7b,  0x7b,  0x6d,  0x65,  0x73,  0x73,  0x61,  0x67,  0x65,  0x7d,  0x7d,  0x60,  0x2c,  0x0a,  0x0a,  0x20, 
+ 0x20,  0x63,  0x68,  0x61,  0x72,  0x3a,  0x20,  0x22,  0x52,  0x65,  0x73,  0x70,  0x6f,  0x6e,  0x73,  0x65, 
+ 0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66, 
+ 0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73, 
+ 0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20, 
+ 0x75,  0x73,  0x65,  0x72,  0x3a,  0x20,  0x22,  0x49,  0x6e,  0x70,  0x75,  0x74,  0x22,  0x2c,  0x0a,  0x20, 
+ 0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20, 
+ 0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66, 
+ 0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x73,  0x74,  0x6f,  0x70, 
+ 0x73,  0x3a,  0x20,  0x22,  0x22,  0x0a,  0x20,  0x20,  0x7d,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x2f,  0x2f, 
+ 0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x0a,  0x0a,  0x20, 
+ 0x20,  0x22,  0x6f,  0x70,  0x65,  0x6e,  0x63,  0x68,  0x61,  0x74,  0x4d,  0x61,  0x74,  0x68,  0x22,  0x3a, 
+ 0x20,  0x7b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60, 
+ 0x7b,  0x7b,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x7d,  0x7d,  0x7b,  0x7b,  0x63,  0x68,  0x61, 
+ 0x72,  0x7d,  0x7d,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79, 
+ 0x54,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x4d,  0x61,  0x74,  0x68,  0x20, 
+ 0x43,  0x6f,  0x72,  0x72,  0x65,  0x63,  0x74,  0x20,  0x7b,  0x7b,  0x6e,  0x61,  0x6d,  0x65,  0x7d,  0x7d, 
+ 0x3a,  0x20,  0x7b,  0x7b,  0x6d,  0x65,  0x73,  0x73,  0x61,  0x67,  0x65,  0x7d,  0x7d,  0x3c,  0x7c,  0x65, 
+ 0x6e,  0x64,  0x5f,  0x6f,  0x66,  0x5f,  0x74,  0x75,  0x72,  0x6e,  0x7c,  0x3e,  0x60,  0x2c,  0x0a,  0x0a, 
+ 0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x3a,  0x20,  0x22,  0x41,  0x73,  0x73,  0x69,  0x73,  0x74,  0x61, 
+ 0x6e,  0x74,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x50,  0x72, 
+ 0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72, 
+ 0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x0a, 
+ 0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x3a,  0x20,  0x22,  0x55,  0x73,  0x65,  0x72,  0x22,  0x2c, 
+ 0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66,  0x69,  0x78, 
+ 0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x53, 
+ 0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x73,  0x74, 
+ 0x6f,  0x70,  0x73,  0x3a,  0x20,  0x22,  0x22,  0x0a,  0x20,  0x20,  0x7d,  0x2c,  0x0a,  0x0a,  0x20,  0x20, 
+ 0x2f,  0x2f,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x0a, 
+ 0x0a,  0x20,  0x20,  0x22,  0x6f,  0x72,  0x69,  0x6f,  0x6e,  0x22,  0x3a,  0x20,  0x7b,  0x0a,  0x20,  0x20, 
+ 0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x3c,  0x73,  0x3e,  0x48,  0x75, 
+ 0x6d,  0x61,  0x6e,  0x3a,  0x20,  0x54,  0x65,  0x73,  0x74,  0x20,  0x4d,  0x65,  0x73,  0x73,  0x61,  0x67, 
+ 0x65,  0x5c,  0x6e,  0x5c,  0x6e,  0x41,  0x73,  0x73,  0x69,  0x73,  0x74,  0x61,  0x6e,  0x74,  0x3a,  0x20, 
+ 0x3c,  0x2f,  0x73,  0x3e,  0x54,  0x65,  0x73,  0x74,  0x20,  0x53,  0x75,  0x63,  0x63,  0x65,  0x73,  0x73, 
+ 0x66,  0x75,  0x6c,  0x3c,  0x2f,  0x73,  0x3e,  0x7b,  0x7b,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79, 
+ 0x7d,  0x7d,  0x7b,  0x7b,  0x63,  0x68,  0x61,  0x72,  0x7d,  0x7d,  0x3a,  0x60,  0x2c,  0x0a,  0x0a,  0x20, 
+ 0x20,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x54,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65, 
+ 0x3a,  0x20,  0x60,  0x7b,  0x7b,  0x6e,  0x61,  0x6d,  0x65,  0x7d,  0x7d,  0x3a,  0x20,  0x7b,  0x7b,  0x6d, 
+ 0x65,  0x73,  0x73,  0x61,  0x67,  0x65,  0x7d,  0x7d,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x63,  0x68, 
+ 0x61,  0x72,  0x3a,  0x20,  0x22,  0x41,  0x73,  0x73,  0x69,  0x73,  0x74,  0x61,  0x6e,  0x74,  0x20,  0x3c, 
+ 0x2f,  0x73,  0x3e,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x50, 
+ 0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61, 
+ 0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a, 
+ 0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x3a,  0x20,  0x22,  0x48,  0x75,  0x6d,  0x61,  0x6e,  0x22, 
+ 0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66,  0x69, 
+ 0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73,  0x67, 
+ 0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x5c,  0x6e,  0x5c,  0x6e,  0x22,  0x2c,  0x0a, 
+ 0x0a,  0x20,  0x20,  0x73,  0x74,  0x6f,  0x70,  0x73,  0x3a,  0x20,  0x22,  0x22,  0x0a,  0x20,  0x20,  0x7d, 
+ 0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x2f,  0x2f,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x0a,  0x0a,  0x20,  0x20,  0x22,  0x73,  0x61,  0x75,  0x65,  0x72,  0x6b,  0x72, 
+ 0x61,  0x75,  0x74,  0x22,  0x3a,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61, 
+ 0x74,  0x65,  0x3a,  0x20,  0x60,  0x7b,  0x7b,  0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x7d,  0x7d,  0x5c, 
+ 0x6e,  0x7b,  0x7b,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x7d,  0x7d,  0x7b,  0x7b,  0x63,  0x68, 
+ 0x61,  0x72,  0x7d,  0x7d,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72, 
+ 0x79,  0x54,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x0a,  0x20,  0x20,  0x7b, 
+ 0x7b,  0x6e,  0x61,  0x6d,  0x65,  0x7d,  0x7d,  0x3a,  0x20,  0x7b,  0x7b,  0x6d,  0x65,  0x73,  0x73,  0x61, 
+ 0x67,  0x65,  0x7d,  0x7d,  0x5c,  0x6e,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72, 
+ 0x3a,  0x20,  0x22,  0x41,  0x73,  0x73,  0x69,  0x73,  0x74,  0x61,  0x6e,  0x74,  0x22,  0x2c,  0x0a,  0x20, 
+ 0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20, 
+ 0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66, 
+ 0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72, 
+ 0x3a,  0x20,  0x22,  0x55,  0x73,  0x65,  0x72,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72, 
+ 0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20, 
+ 0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20, 
+ 0x22,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x73,  0x74,  0x6f,  0x70,  0x73,  0x3a,  0x20,  0x22,  0x22, 
+ 0x0a,  0x20,  0x20,  0x7d,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x2f,  0x2f,  0x20,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x0a,  0x0a,  0x20,  0x20,  0x22,  0x73,  0x74,  0x61, 
+ 0x72,  0x6c,  0x69,  0x6e,  0x67,  0x43,  0x6f,  0x64,  0x65,  0x22,  0x3a,  0x20,  0x7b,  0x0a,  0x20,  0x20, 
+ 0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x7b,  0x7b,  0x68,  0x69,  0x73, 
+ 0x74,  0x6f,  0x72,  0x79,  0x7d,  0x7d,  0x7b,  0x7b,  0x63,  0x68,  0x61,  0x72,  0x7d,  0x7d,  0x60,  0x2c, 
+ 0x0a,  0x0a,  0x20,  0x20,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x54,  0x65,  0x6d,  0x70,  0x6c, 
+ 0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x43,  0x6f,  0x64,  0x65,  0x20,  0x7b,  0x7b,  0x6e,  0x61,  0x6d, 
+ 0x65,  0x7d,  0x7d,  0x3a,  0x20,  0x7b,  0x7b,  0x6d,  0x65,  0x73,  0x73,  0x61,  0x67,  0x65,  0x7d,  0x7d, 
+ 0x3c,  0x7c,  0x65,  0x6e,  0x64,  0x5f,  0x6f,  0x66,  0x5f,  0x74,  0x75,  0x72,  0x6e,  0x7c,  0x3e,  0x60, 
+ 0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x3a,  0x20,  0x22,  0x41,  0x73,  0x73,  0x69, 
+ 0x73,  0x74,  0x61,  0x6e,  0x74,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73, 
+ 0x67,  0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63, 
+ 0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22, 
+ 0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x3a,  0x20,  0x22,  0x55,  0x73,  0x65,  0x72, 
+ 0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66, 
+ 0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73, 
+ 0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20, 
+ 0x73,  0x74,  0x6f,  0x70,  0x73,  0x3a,  0x20,  0x22,  0x22,  0x0a,  0x20,  0x20,  0x7d,  0x2c,  0x0a,  0x0a, 
+ 0x20,  0x20,  0x2f,  0x2f,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x0a,  0x0a,  0x20,  0x20,  0x22,  0x79,  0x69,  0x33,  0x34,  0x62,  0x22,  0x3a,  0x20,  0x7b,  0x0a, 
+ 0x20,  0x20,  0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x7b,  0x7b,  0x68, 
+ 0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x7d,  0x7d,  0x20,  0x7b,  0x7b,  0x63,  0x68,  0x61,  0x72,  0x7d, 
+ 0x7d,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x54,  0x65, 
+ 0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x7b,  0x7b,  0x6e,  0x61,  0x6d,  0x65,  0x7d, 
+ 0x7d,  0x3a,  0x20,  0x7b,  0x7b,  0x6d,  0x65,  0x73,  0x73,  0x61,  0x67,  0x65,  0x7d,  0x7d,  0x60,  0x2c, 
+ 0x0a,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x3a,  0x20,  0x22,  0x41,  0x73,  0x73,  0x69,  0x73, 
+ 0x74,  0x61,  0x6e,  0x74,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73,  0x67, 
+ 0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68, 
+ 0x61,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c, 
+ 0x0a,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x3a,  0x20,  0x22,  0x48,  0x75,  0x6d,  0x61,  0x6e, 
+ 0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66, 
+ 0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73, 
+ 0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20, 
+ 0x73,  0x74,  0x6f,  0x70,  0x73,  0x3a,  0x20,  0x22,  0x22,  0x0a,  0x20,  0x20,  0x7d,  0x2c,  0x0a,  0x0a, 
+ 0x20,  0x20,  0x2f,  0x2f,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x0a,  0x0a,  0x20,  0x20,  0x22,  0x7a,  0x65,  0x70,  0x68,  0x79,  0x72,  0x22,  0x3a,  0x20,  0x7b, 
+ 0x0a,  0x20,  0x20,  0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x60,  0x3c,  0x7c, 
+ 0x73,  0x79,  0x73,  0x74,  0x65,  0x6d,  0x7c,  0x3e,  0x5c,  0x6e,  0x7b,  0x7b,  0x70,  0x72,  0x6f,  0x6d, 
+ 0x70,  0x74,  0x7d,  0x7d,  0x3c,  0x2f,  0x73,  0x3e,  0x5c,  0x6e,  0x7b,  0x7b,  0x68,  0x69,  0x73,  0x74, 
+ 0x6f,  0x72,  0x79,  0x7d,  0x7d,  0x7b,  0x7b,  0x63,  0x68,  0x61,  0x72,  0x7d,  0x7d,  0x60,  0x2c,  0x0a, 
+ 0x0a,  0x20,  0x20,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x54,  0x65,  0x6d,  0x70,  0x6c,  0x61, 
+ 0x74,  0x65,  0x3a,  0x20,  0x60,  0x3c,  0x7c,  0x7b,  0x7b,  0x6e,  0x61,  0x6d,  0x65,  0x7d,  0x7d,  0x7c, 
+ 0x3e,  0x5c,  0x6e,  0x7b,  0x7b,  0x6d,  0x65,  0x73,  0x73,  0x61,  0x67,  0x65,  0x7d,  0x7d,  0x3c,  0x2f, 
+ 0x73,  0x3e,  0x5c,  0x6e,  0x60,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x3a,  0x20, 
+ 0x22,  0x61,  0x73,  0x73,  0x69,  0x73,  0x74,  0x61,  0x6e,  0x74,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x63, 
+ 0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22, 
+ 0x2c,  0x0a,  0x20,  0x20,  0x63,  0x68,  0x61,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69, 
+ 0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x3a,  0x20, 
+ 0x22,  0x75,  0x73,  0x65,  0x72,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75,  0x73,  0x65,  0x72,  0x4d,  0x73, 
+ 0x67,  0x50,  0x72,  0x65,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22,  0x2c,  0x0a,  0x20,  0x20,  0x75, 
+ 0x73,  0x65,  0x72,  0x4d,  0x73,  0x67,  0x53,  0x75,  0x66,  0x66,  0x69,  0x78,  0x3a,  0x20,  0x22,  0x22, 
+ 0x2c,  0x0a,  0x0a,  0x20,  0x20,  0x73,  0x74,  0x6f,  0x70,  0x73,  0x3a,  0x20,  0x22,  0x22,  0x0a,  0x20, 
+ 0x20,  0x7d,  0x0a,  0x20,  0x20,  0x7d,  0x3b,  0x0a, 
+};
+unsigned int prompt_formats_js_len = 6168;
@@ -88,6 +88,7 @@ enum server_task_type {
     SERVER_TASK_TYPE_SLOT_RESTORE,
     SERVER_TASK_TYPE_SLOT_ERASE,
     SERVER_TASK_TYPE_SET_LORA,
+    SERVER_TASK_TYPE_JOIN,
 };
 
 enum server_task_cmpl_type {
@@ -627,6 +628,9 @@ struct server_context {
     llama_context * ctx = nullptr;
     std::vector<llama_lora_adapter_container> loras;
 
+    // profiles of the devices in the ring, to plan joining devices in
+    std::vector<device_info> dev_info_set;
+
     gpt_params params;
 
     llama_model * model_dft = nullptr;
@@ -716,6 +720,7 @@ struct server_context {
             params_dft.rank         = 0;  // always load the draft model on the head device
 
             std::fill_n(params_dft.n_layer_window, params.n_world, 0);
+            std::fill_n(params_dft.n_layer_extra,  params.n_world, 0);
             
             llama_init_dft = llama_init_from_gpt_params(params_dft);
 
@@ -731,6 +736,7 @@ struct server_context {
             cparams_dft.n_world = 1;
             cparams_dft.rank    = 0;
             std::fill_n(cparams_dft.n_layer_window, 32, 0);
+            std::fill_n(cparams_dft.n_layer_extra,  32, 0);
             cparams_dft.n_layer_window[0] = llama_n_layer(model_dft);
             cparams_dft.n_gpu_layers      = params.speculative.n_gpu_layers;
         }
@@ -740,6 +746,7 @@ struct server_context {
         model = llama_init.model;
         ctx   = llama_init.context;
         loras = llama_init.lora_adapters;
+        dev_info_set = llama_init.dev_info_set;
 
         params.n_parallel -= 1; // but be sneaky about it
 
@@ -1827,6 +1834,20 @@ struct server_context {
                     }
                     SRV_DBG("n_idle_slots = %d, n_processing_slots = %d\n", n_idle_slots, n_processing_slots);
 
+                    const auto perf_data = llama_perf_context(ctx);
+
+                    json windows_data = json::array();
+                    for (int32_t i = 0; i < llama_perf_context_n_windows(ctx); ++i) {
+                        const auto wdata = llama_perf_context_window(ctx, i);
+                        windows_data.push_back({
+                            { "resident_pct",   wdata.resident_pct   },
+                            { "n_major_faults", wdata.n_major_faults },
+                            { "t_compute_ms",   wdata.t_compute_ms   },
+                            { "t_prefetch_ms",  wdata.t_prefetch_ms  },
+                            { "n_runs",         wdata.n_runs         },
+                        });
+                    }
+
                     server_task_result res;
                     res.id       = task.id;
                     res.stop     = true;
@@ -1853,6 +1874,12 @@ struct server_context {
                         { "kv_cache_tokens_count",           llama_get_kv_cache_token_count(ctx)},
                         { "kv_cache_used_cells",             llama_get_kv_cache_used_cells(ctx)},
 
+                        { "resident_pct",                    perf_data.resident_pct},
+                        { "n_major_faults",                  perf_data.n_major_faults},
+                        { "t_compute_ms",                    perf_data.t_compute_ms},
+                        { "t_prefetch_ms",                   perf_data.t_prefetch_ms},
+                        { "windows",                         windows_data },
+
                         { "slots",                           slots_data },
                     };
 
@@ -1990,6 +2017,23 @@ struct server_context {
                     result.data = json{{ "success", true }};
                     queue_results.send(result);
                 } break;
+            case SERVER_TASK_TYPE_JOIN:
+                {
+                    // layers move between the devices, so wait until no slot is generating
+                    for (const server_slot & slot : slots) {
+                        if (slot.is_processing()) {
+                            queue_tasks.defer(task);
+                            return;
+                        }
+                    }
+                    if (llama_accept_join(ctx, model, dev_info_set, params) && llama_get_kv_cache_used_cells(ctx) == 0) {
+                        // the kv cache did not survive the move, the slots keep their sessions and evaluate them again
+                        for (server_slot & slot : slots) {
+                            slot.cache_tokens.clear();
+                        }
+                        system_need_update = !system_prompt.empty();
+                    }
+                } break;
         }
     }
 
@@ -2431,6 +2475,38 @@ struct server_context {
             const int ret = llama_decode(ctx, batch_view, true);
             metrics.on_decoded(slots);
 
+            if (ret == -3 && llama_recover_ring_failure(ctx, dev_info_set, params)) {
+                // the ring goes on without the failed device. the requests with tokens left in the batch are aborted,
+                // and if the kv cache went with the device, the idle slots evaluate their sessions again as well
+                const bool kv_lost = llama_get_kv_cache_used_cells(ctx) == 0;
+
+                std::unordered_set<llama_seq_id> seq_aborted;
+                for (int32_t k = i; k < batch.n_tokens; ++k) {
+                    seq_aborted.insert(batch.seq_id[k][0]);
+                }
+
+                for (auto & slot : slots) {
+                    if (!kv_lost && seq_aborted.count(slot.id + 1) == 0) {
+                        continue; // continue loop of slots
+                    }
+
+                    if (!kv_lost) {
+                        llama_kv_cache_seq_rm     (ctx, slot.id + 1, -1, -1);
+                        llama_send_kv_cache_seq_rm(ctx, slot.id    , -1, -1);
+                    }
+                    slot.cache_tokens.clear();
+
+                    if (slot.is_processing()) {
+                        slot.release();
+                        send_error(slot, "A device of the ring failed, the request was aborted. Please retry.");
+                    }
+                }
+                system_need_update = kv_lost && !system_prompt.empty();
+
+                SRV_WRN("a device of the ring failed, continuing with %d devices, kv cache %s\n", (int) params.n_world, kv_lost ? "lost" : "kept");
+                break; // break loop of n_batch
+            }
+
             if (ret != 0) {
                 if (n_batch == 1 || ret < 0) {
                     // if you get here, it means the KV cache is full - try increasing it via the context size
@@ -2524,6 +2600,9 @@ struct server_context {
 
                 struct common_speculative_params params_spec;
                 params_spec.n_draft   = slot.params.speculative.n_max;
+                if (slot.params.speculative.adaptive) {
+                    params_spec.n_draft = common_speculative_n_draft(slot.spec, slot.params.speculative.n_min, slot.params.speculative.n_max);
+                }
                 params_spec.n_reuse   = llama_n_ctx(slot.ctx_dft) - slot.params.speculative.n_max;
                 params_spec.p_min     = slot.params.speculative.p_min;
 
@@ -2542,11 +2621,24 @@ struct server_context {
                     llama_batch_add(slot.batch_spec, draft[i], slot.n_past + 1 + i, { slot.id + 1 }, true);
                 }
 
+                // the verification travels the whole ring, meanwhile the head device drafts past it
+                if (slot.params.speculative.ahead) {
+                    common_speculative_ahead_begin(slot.spec, params_spec);
+                }
+
+                const int64_t t_verify_start = ggml_time_us();
+
                 llama_decode(ctx, slot.batch_spec, true);
 
+                const int64_t t_verify_us = ggml_time_us() - t_verify_start;
+
+                common_speculative_ahead_end(slot.spec);
+
                 // the accepted tokens from the speculation
                 const auto ids = gpt_sampler_sample_and_accept_n(slot.smpl, ctx, draft);
 
+                common_speculative_update(slot.spec, draft.size(), ids.size() - 1, t_verify_us);
+
                 slot.n_past    += ids.size();
                 slot.n_decoded += ids.size();
 
@@ -2931,6 +3023,18 @@ int main(int argc, char ** argv) {
                     {"name",  "n_busy_slots_per_decode"},
                     {"help",  "Average number of busy slots per llama_decode() call"},
                     {"value",  (float) n_busy_slots_total / (float) n_decode_total}
+            }, {
+                    {"name",  "major_page_faults_total"},
+                    {"help",  "Major page faults taken while computing layer windows."},
+                    {"value",  (int64_t) data.at("n_major_faults")}
+            }, {
+                    {"name",  "compute_seconds_total"},
+                    {"help",  "Time spent computing layer windows."},
+                    {"value",  (double) data.at("t_compute_ms") / 1.e3}
+            }, {
+                    {"name",  "prefetch_seconds_total"},
+                    {"help",  "Time blocked on weight streaming, page release and prefetch."},
+                    {"value",  (double) data.at("t_prefetch_ms") / 1.e3}
             }}},
             {"gauge", {{
                     {"name",  "prompt_tokens_seconds"},
@@ -2956,6 +3060,10 @@ int main(int argc, char ** argv) {
                     {"name",  "requests_deferred"},
                     {"help",  "Number of request deferred."},
                     {"value",  (uint64_t) data.at("deferred")}
+            },{
+                    {"name",  "window_resident_ratio"},
+                    {"help",  "Share of layer window weights resident at compute start, averaged over windows."},
+                    {"value",  (double) data.at("resident_pct") / 100.}
             }}}
         };
 
@@ -2976,6 +3084,35 @@ int main(int argc, char ** argv) {
             }
         }
 
+        // per-window breakdown, one labeled sample per local layer window
+        const json & windows = data.at("windows");
+        if (!windows.empty()) {
+            const struct {
+                const char * name;
+                const char * type;
+                const char * help;
+                const char * key;
+                double       scale;
+            } window_metrics[] = {
+                { "window_resident_ratio_by_window",    "gauge",   "Share of the window weights resident at compute start.", "resident_pct",   1.e-2 },
+                { "window_major_page_faults_total",     "counter", "Major page faults taken while computing the window.",    "n_major_faults", 1.    },
+                { "window_compute_seconds_total",       "counter", "Time spent computing the window.",                       "t_compute_ms",   1.e-3 },
+                { "window_prefetch_seconds_total",      "counter", "Time blocked on prefetching around the window.",         "t_prefetch_ms",  1.e-3 },
+            };
+
+            for (const auto & wm : window_metrics) {
+                prometheus << "# HELP llamacpp:" << wm.name << " " << wm.help << "\n"
+                           << "# TYPE llamacpp:" << wm.name << " " << wm.type << "\n";
+                for (size_t i = 0; i < windows.size(); ++i) {
+                    if (windows[i].at("n_runs").get<int32_t>() == 0) {
+                        continue;
+                    }
+                    prometheus << "llamacpp:" << wm.name << "{window=\"" << i << "\"} "
+                               << windows[i].at(wm.key).get<double>() * wm.scale << "\n";
+                }
+            }
+        }
+
         const int64_t t_start = data.at("t_start");
         res.set_header("Process-Start-Time-Unix", std::to_string(t_start));
 
@@ -3615,10 +3752,36 @@ int main(int argc, char ** argv) {
     SetConsoleCtrlHandler(reinterpret_cast<PHANDLER_ROUTINE>(console_ctrl_handler), true);
 #endif
 
+    // devices that ask to join are taken in by the main loop, between the tasks
+    std::atomic<bool> join_watcher_stop{false};
+    std::thread join_watcher;
+    if (params.accept_join && ctx_server.params.n_world > 1) {
+        join_watcher = std::thread([&]() {
+            while (!join_watcher_stop) {
+                if (!llama_poll_join(ctx_server.ctx, 500, nullptr, nullptr)) {
+                    continue;
+                }
+                server_task task;
+                task.type = SERVER_TASK_TYPE_JOIN;
+                ctx_server.queue_tasks.post(task);
+
+                // one task per request, wait until the main loop took it
+                while (!join_watcher_stop && llama_poll_join(ctx_server.ctx, 0, nullptr, nullptr)) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+                }
+            }
+        });
+    }
+
     LOG_INF("%s: server is listening on %s:%d - starting the main loop\n", __func__, params.hostname.c_str(), params.port);
 
     ctx_server.queue_tasks.start_loop();
 
+    join_watcher_stop = true;
+    if (join_watcher.joinable()) {
+        join_watcher.join();
+    }
+
     char * stop_signal = nullptr;
     llama_free_sockets(ctx_server.ctx, &stop_signal);
 
@@ -0,0 +1,1258 @@
+unsigned char style_css[] = {
+ 0x40,  0x69,  0x6d,  0x70,  0x6f,  0x72,  0x74,  0x20,  0x75,  0x72,  0x6c,  0x28,  0x22,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x73,  0x2e,  0x63,  0x73,  0x73,  0x22,  0x29,  0x3b,  0x0a, 
+ 0x0a,  0x62,  0x6f,  0x64,  0x79,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x66, 
+ 0x61,  0x6d,  0x69,  0x6c,  0x79,  0x3a,  0x20,  0x27,  0x41,  0x72,  0x69,  0x61,  0x6c,  0x27,  0x2c,  0x20, 
+ 0x73,  0x61,  0x6e,  0x73,  0x2d,  0x73,  0x65,  0x72,  0x69,  0x66,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f, 
+ 0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x39,  0x30,  0x25,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75, 
+ 0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x65,  0x78,  0x74, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x73,  0x75,  0x62,  0x74,  0x69,  0x6c,  0x65,  0x2d,  0x31, 
+ 0x29,  0x3b,  0x20,  0x2f,  0x2a,  0x20,  0x68,  0x65,  0x61,  0x64,  0x20,  0x31,  0x20,  0x6c,  0x6c,  0x61, 
+ 0x6d,  0x61,  0x2e,  0x63,  0x70,  0x70,  0x20,  0x26,  0x20,  0x74,  0x72,  0x69,  0x61,  0x6e,  0x67,  0x6c, 
+ 0x65,  0x20,  0x6f,  0x70,  0x74,  0x69,  0x6f,  0x6e,  0x73,  0x20,  0x66,  0x6f,  0x72,  0x20,  0x73,  0x6f, 
+ 0x6d,  0x65,  0x20,  0x72,  0x65,  0x61,  0x73,  0x6f,  0x6e,  0x20,  0x2a,  0x2f,  0x0a,  0x20,  0x20,  0x6d, 
+ 0x61,  0x78,  0x2d,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20,  0x36,  0x30,  0x30,  0x70,  0x78,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x6d,  0x69,  0x6e,  0x2d,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20,  0x33,  0x30, 
+ 0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x6c,  0x69,  0x6e,  0x65,  0x2d,  0x68,  0x65,  0x69,  0x67, 
+ 0x68,  0x74,  0x3a,  0x20,  0x31,  0x2e,  0x32,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x72,  0x67,  0x69, 
+ 0x6e,  0x3a,  0x20,  0x30,  0x20,  0x61,  0x75,  0x74,  0x6f,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64, 
+ 0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x30,  0x20,  0x30,  0x2e,  0x35,  0x65,  0x6d,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x74,  0x72,  0x61,  0x6e,  0x73,  0x69,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x62,  0x61,  0x63, 
+ 0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x20,  0x30,  0x2e, 
+ 0x33,  0x73,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x3a,  0x3a,  0x73,  0x65,  0x6c,  0x65,  0x63,  0x74,  0x69, 
+ 0x6f,  0x6e,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61, 
+ 0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61, 
+ 0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x29,  0x20,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63, 
+ 0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62, 
+ 0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x63,  0x6f,  0x64,  0x65,  0x2c,  0x20,  0x70, 
+ 0x72,  0x65,  0x20,  0x63,  0x6f,  0x64,  0x65,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74, 
+ 0x2d,  0x66,  0x61,  0x6d,  0x69,  0x6c,  0x79,  0x3a,  0x20,  0x27,  0x43,  0x6f,  0x75,  0x72,  0x69,  0x65, 
+ 0x72,  0x20,  0x4e,  0x65,  0x77,  0x27,  0x2c,  0x20,  0x6d,  0x6f,  0x6e,  0x6f,  0x73,  0x70,  0x61,  0x63, 
+ 0x65,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x23,  0x63,  0x6f,  0x6e,  0x74,  0x61,  0x69,  0x6e,  0x65,  0x72, 
+ 0x20,  0x7b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x3a,  0x20,  0x30,  0x65,  0x6d, 
+ 0x20,  0x61,  0x75,  0x74,  0x6f,  0x3b,  0x0a,  0x20,  0x20,  0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79, 
+ 0x3a,  0x20,  0x66,  0x6c,  0x65,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6c,  0x65,  0x78,  0x2d,  0x64, 
+ 0x69,  0x72,  0x65,  0x63,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x63,  0x6f,  0x6c,  0x75,  0x6d,  0x6e, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x6a,  0x75,  0x73,  0x74,  0x69,  0x66,  0x79,  0x2d,  0x63,  0x6f,  0x6e,  0x74, 
+ 0x65,  0x6e,  0x74,  0x3a,  0x20,  0x73,  0x70,  0x61,  0x63,  0x65,  0x2d,  0x62,  0x65,  0x74,  0x77,  0x65, 
+ 0x65,  0x6e,  0x3b,  0x0a,  0x20,  0x20,  0x68,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x31,  0x30, 
+ 0x30,  0x25,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x6d,  0x61,  0x69,  0x6e,  0x20,  0x7b,  0x0a,  0x20,  0x20, 
+ 0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x3a,  0x20,  0x33,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x64, 
+ 0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x66,  0x6c,  0x65,  0x78,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x66,  0x6c,  0x65,  0x78,  0x2d,  0x64,  0x69,  0x72,  0x65,  0x63,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20, 
+ 0x63,  0x6f,  0x6c,  0x75,  0x6d,  0x6e,  0x3b,  0x0a,  0x20,  0x20,  0x6a,  0x75,  0x73,  0x74,  0x69,  0x66, 
+ 0x79,  0x2d,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x3a,  0x20,  0x73,  0x70,  0x61,  0x63,  0x65, 
+ 0x2d,  0x62,  0x65,  0x74,  0x77,  0x65,  0x65,  0x6e,  0x3b,  0x0a,  0x20,  0x20,  0x67,  0x61,  0x70,  0x3a, 
+ 0x20,  0x31,  0x65,  0x6d,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6c,  0x65,  0x78,  0x2d,  0x67,  0x72,  0x6f, 
+ 0x77,  0x3a,  0x20,  0x31,  0x3b,  0x0a,  0x20,  0x20,  0x6f,  0x76,  0x65,  0x72,  0x66,  0x6c,  0x6f,  0x77, 
+ 0x2d,  0x79,  0x3a,  0x20,  0x61,  0x75,  0x74,  0x6f,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64, 
+ 0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61, 
+ 0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x2d,  0x33,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x72,  0x61, 
+ 0x64,  0x69,  0x75,  0x73,  0x3a,  0x20,  0x35,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64, 
+ 0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x30,  0x2e,  0x35,  0x65,  0x6d,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a, 
+ 0x70,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x6f,  0x76,  0x65,  0x72,  0x66,  0x6c,  0x6f,  0x77,  0x2d,  0x77, 
+ 0x72,  0x61,  0x70,  0x3a,  0x20,  0x62,  0x72,  0x65,  0x61,  0x6b,  0x2d,  0x77,  0x6f,  0x72,  0x64,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x77,  0x6f,  0x72,  0x64,  0x2d,  0x77,  0x72,  0x61,  0x70,  0x3a,  0x20,  0x62,  0x72, 
+ 0x65,  0x61,  0x6b,  0x2d,  0x77,  0x6f,  0x72,  0x64,  0x3b,  0x0a,  0x20,  0x20,  0x68,  0x79,  0x70,  0x68, 
+ 0x65,  0x6e,  0x73,  0x3a,  0x20,  0x61,  0x75,  0x74,  0x6f,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x72, 
+ 0x67,  0x69,  0x6e,  0x2d,  0x74,  0x6f,  0x70,  0x3a,  0x20,  0x30,  0x2e,  0x35,  0x65,  0x6d,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x2d,  0x62,  0x6f,  0x74,  0x74,  0x6f,  0x6d,  0x3a, 
+ 0x20,  0x30,  0x2e,  0x35,  0x65,  0x6d,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x23,  0x77,  0x72,  0x69,  0x74, 
+ 0x65,  0x20,  0x66,  0x6f,  0x72,  0x6d,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x72,  0x67,  0x69, 
+ 0x6e,  0x3a,  0x20,  0x31,  0x65,  0x6d,  0x20,  0x30,  0x20,  0x30,  0x20,  0x30,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x66,  0x6c,  0x65,  0x78,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x66,  0x6c,  0x65,  0x78,  0x2d,  0x64,  0x69,  0x72,  0x65,  0x63,  0x74,  0x69,  0x6f,  0x6e,  0x3a, 
+ 0x20,  0x63,  0x6f,  0x6c,  0x75,  0x6d,  0x6e,  0x3b,  0x0a,  0x20,  0x20,  0x67,  0x61,  0x70,  0x3a,  0x20, 
+ 0x30,  0x2e,  0x35,  0x65,  0x6d,  0x3b,  0x0a,  0x20,  0x20,  0x61,  0x6c,  0x69,  0x67,  0x6e,  0x2d,  0x69, 
+ 0x74,  0x65,  0x6d,  0x73,  0x3a,  0x20,  0x73,  0x74,  0x72,  0x65,  0x74,  0x63,  0x68,  0x3b,  0x0a,  0x7d, 
+ 0x0a,  0x0a,  0x2e,  0x72,  0x69,  0x67,  0x68,  0x74,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x64,  0x69,  0x73, 
+ 0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x66,  0x6c,  0x65,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6c, 
+ 0x65,  0x78,  0x2d,  0x64,  0x69,  0x72,  0x65,  0x63,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x72,  0x6f, 
+ 0x77,  0x3b,  0x0a,  0x20,  0x20,  0x67,  0x61,  0x70,  0x3a,  0x20,  0x30,  0x2e,  0x35,  0x65,  0x6d,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x6a,  0x75,  0x73,  0x74,  0x69,  0x66,  0x79,  0x2d,  0x63,  0x6f,  0x6e,  0x74,  0x65, 
+ 0x6e,  0x74,  0x3a,  0x20,  0x66,  0x6c,  0x65,  0x78,  0x2d,  0x65,  0x6e,  0x64,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x2d,  0x62,  0x6f,  0x74,  0x74,  0x6f,  0x6d,  0x3a,  0x20,  0x33, 
+ 0x30,  0x70,  0x78,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x74,  0x77,  0x6f,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x75,  0x6d,  0x6e,  0x73,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20, 
+ 0x39,  0x37,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x78,  0x2d,  0x77,  0x69,  0x64,  0x74,  0x68, 
+ 0x3a,  0x20,  0x39,  0x37,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79, 
+ 0x3a,  0x20,  0x67,  0x72,  0x69,  0x64,  0x3b,  0x0a,  0x20,  0x20,  0x67,  0x72,  0x69,  0x64,  0x2d,  0x74, 
+ 0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x75,  0x6d,  0x6e,  0x73,  0x3a, 
+ 0x20,  0x31,  0x66,  0x72,  0x20,  0x31,  0x66,  0x72,  0x3b,  0x0a,  0x20,  0x20,  0x67,  0x61,  0x70,  0x3a, 
+ 0x20,  0x31,  0x65,  0x6d,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x6f,  0x73,  0x69,  0x74,  0x69,  0x6f,  0x6e, 
+ 0x3a,  0x20,  0x72,  0x65,  0x6c,  0x61,  0x74,  0x69,  0x76,  0x65,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e, 
+ 0x6a,  0x73,  0x6f,  0x6e,  0x2d,  0x73,  0x63,  0x68,  0x65,  0x6d,  0x61,  0x2d,  0x63,  0x6f,  0x6e,  0x74, 
+ 0x72,  0x6f,  0x6c,  0x73,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x2d, 
+ 0x74,  0x6f,  0x70,  0x3a,  0x20,  0x31,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x77,  0x69,  0x64, 
+ 0x74,  0x68,  0x3a,  0x20,  0x31,  0x30,  0x30,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x78,  0x2d, 
+ 0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20,  0x31,  0x30,  0x30,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x64, 
+ 0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x67,  0x72,  0x69,  0x64,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x67,  0x72,  0x69,  0x64,  0x2d,  0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x22, 
+ 0x61,  0x20,  0x61,  0x22,  0x3b,  0x0a,  0x20,  0x20,  0x67,  0x61,  0x70,  0x3a,  0x20,  0x31,  0x65,  0x6d, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x78, 
+ 0x2d,  0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61, 
+ 0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x29,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x74,  0x6f,  0x70,  0x3a,  0x20,  0x31,  0x36,  0x70, 
+ 0x78,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x62,  0x6f,  0x74, 
+ 0x74,  0x6f,  0x6d,  0x3a,  0x20,  0x31,  0x36,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78, 
+ 0x74,  0x2d,  0x74,  0x72,  0x61,  0x6e,  0x73,  0x66,  0x6f,  0x72,  0x6d,  0x3a,  0x20,  0x75,  0x70,  0x70, 
+ 0x65,  0x72,  0x63,  0x61,  0x73,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77, 
+ 0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x36,  0x30,  0x30,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e, 
+ 0x6a,  0x73,  0x6f,  0x6e,  0x2d,  0x73,  0x63,  0x68,  0x65,  0x6d,  0x61,  0x2d,  0x63,  0x6f,  0x6e,  0x74, 
+ 0x72,  0x6f,  0x6c,  0x73,  0x20,  0x3e,  0x20,  0x2a,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x66,  0x6c,  0x65, 
+ 0x78,  0x3a,  0x20,  0x31,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x74,  0x69,  0x74,  0x6c, 
+ 0x65,  0x73,  0x20,  0x6f,  0x66,  0x20,  0x74,  0x68,  0x65,  0x20,  0x64,  0x65,  0x74,  0x61,  0x69,  0x6c, 
+ 0x73,  0x2d,  0x73,  0x75,  0x6d,  0x6d,  0x61,  0x72,  0x79,  0x20,  0x62,  0x6f,  0x78,  0x65,  0x73,  0x20, 
+ 0x2a,  0x2f,  0x0a,  0x2e,  0x73,  0x75,  0x6d,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x69,  0x74,  0x6c, 
+ 0x65,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77,  0x65,  0x69,  0x67,  0x68, 
+ 0x74,  0x3a,  0x20,  0x36,  0x30,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73, 
+ 0x69,  0x7a,  0x65,  0x3a,  0x20,  0x78,  0x2d,  0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x65,  0x78, 
+ 0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x73,  0x75,  0x62,  0x74,  0x69,  0x6c,  0x65,  0x2d, 
+ 0x31,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x74,  0x72,  0x61,  0x6e,  0x73, 
+ 0x66,  0x6f,  0x72,  0x6d,  0x3a,  0x20,  0x75,  0x70,  0x70,  0x65,  0x72,  0x63,  0x61,  0x73,  0x65,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x2f,  0x2a,  0x20,  0x74,  0x72,  0x61,  0x6e,  0x73,  0x69,  0x74,  0x69,  0x6f,  0x6e, 
+ 0x3a,  0x20,  0x3b,  0x20,  0x2a,  0x2f,  0x0a,  0x7d,  0x0a,  0x0a,  0x66,  0x69,  0x65,  0x6c,  0x64,  0x73, 
+ 0x65,  0x74,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x6e, 
+ 0x6f,  0x6e,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20, 
+ 0x30,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x3a,  0x20,  0x30,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74, 
+ 0x65,  0x78,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x70,  0x6c,  0x61,  0x69,  0x6e,  0x29, 
+ 0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x66,  0x69,  0x65,  0x6c,  0x64,  0x73,  0x65,  0x74,  0x2e,  0x74,  0x77, 
+ 0x6f,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x67, 
+ 0x72,  0x69,  0x64,  0x3b,  0x0a,  0x20,  0x20,  0x67,  0x72,  0x69,  0x64,  0x2d,  0x74,  0x65,  0x6d,  0x70, 
+ 0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x22,  0x61,  0x20,  0x61,  0x20,  0x61,  0x22,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x67,  0x61,  0x70,  0x3a,  0x20,  0x31,  0x65,  0x6d,  0x3b,  0x0a,  0x20,  0x20,  0x61,  0x6c,  0x69, 
+ 0x67,  0x6e,  0x2d,  0x69,  0x74,  0x65,  0x6d,  0x73,  0x3a,  0x20,  0x63,  0x65,  0x6e,  0x74,  0x65,  0x72, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x78, 
+ 0x2d,  0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x70,  0x6c,  0x61,  0x69,  0x6e,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x66,  0x69,  0x65, 
+ 0x6c,  0x64,  0x73,  0x65,  0x74,  0x2e,  0x74,  0x68,  0x72,  0x65,  0x65,  0x20,  0x7b,  0x0a,  0x20,  0x20, 
+ 0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x67,  0x72,  0x69,  0x64,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x67,  0x72,  0x69,  0x64,  0x2d,  0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20, 
+ 0x22,  0x61,  0x20,  0x61,  0x20,  0x61,  0x22,  0x3b,  0x0a,  0x20,  0x20,  0x67,  0x61,  0x70,  0x3a,  0x20, 
+ 0x31,  0x65,  0x6d,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65, 
+ 0x3a,  0x20,  0x78,  0x2d,  0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x70,  0x6c,  0x61,  0x69,  0x6e,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a, 
+ 0x2f,  0x2a,  0x20,  0x74,  0x69,  0x74,  0x6c,  0x65,  0x73,  0x20,  0x6f,  0x66,  0x20,  0x6e,  0x61,  0x6d, 
+ 0x65,  0x20,  0x66,  0x69,  0x65,  0x6c,  0x64,  0x73,  0x2a,  0x2f,  0x0a,  0x66,  0x69,  0x65,  0x6c,  0x64, 
+ 0x73,  0x65,  0x74,  0x2e,  0x6e,  0x61,  0x6d,  0x65,  0x73,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x64,  0x69, 
+ 0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x67,  0x72,  0x69,  0x64,  0x3b,  0x0a,  0x20,  0x20,  0x67, 
+ 0x72,  0x69,  0x64,  0x2d,  0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x22,  0x61, 
+ 0x20,  0x61,  0x22,  0x3b,  0x0a,  0x20,  0x20,  0x67,  0x61,  0x70,  0x3a,  0x20,  0x31,  0x65,  0x6d,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x78,  0x2d, 
+ 0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20, 
+ 0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e, 
+ 0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x70, 
+ 0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x74,  0x6f,  0x70,  0x3a,  0x20,  0x31,  0x36,  0x70,  0x78, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x62,  0x6f,  0x74,  0x74, 
+ 0x6f,  0x6d,  0x3a,  0x20,  0x31,  0x36,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78,  0x74, 
+ 0x2d,  0x74,  0x72,  0x61,  0x6e,  0x73,  0x66,  0x6f,  0x72,  0x6d,  0x3a,  0x20,  0x75,  0x70,  0x70,  0x65, 
+ 0x72,  0x63,  0x61,  0x73,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77,  0x65, 
+ 0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x36,  0x30,  0x30,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2f,  0x2a, 
+ 0x20,  0x74,  0x69,  0x74,  0x6c,  0x65,  0x73,  0x20,  0x6f,  0x66,  0x20,  0x70,  0x61,  0x72,  0x61,  0x6d, 
+ 0x73,  0x20,  0x66,  0x69,  0x65,  0x6c,  0x64,  0x73,  0x2a,  0x2f,  0x0a,  0x66,  0x69,  0x65,  0x6c,  0x64, 
+ 0x73,  0x65,  0x74,  0x2e,  0x70,  0x61,  0x72,  0x61,  0x6d,  0x73,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x64, 
+ 0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x67,  0x72,  0x69,  0x64,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x67,  0x72,  0x69,  0x64,  0x2d,  0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x22, 
+ 0x61,  0x20,  0x61,  0x22,  0x3b,  0x0a,  0x20,  0x20,  0x67,  0x61,  0x70,  0x3a,  0x20,  0x31,  0x65,  0x6d, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x78, 
+ 0x2d,  0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61, 
+ 0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x29,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x74,  0x6f,  0x70,  0x3a,  0x20,  0x31,  0x36,  0x70, 
+ 0x78,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x62,  0x6f,  0x74, 
+ 0x74,  0x6f,  0x6d,  0x3a,  0x20,  0x31,  0x36,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78, 
+ 0x74,  0x2d,  0x74,  0x72,  0x61,  0x6e,  0x73,  0x66,  0x6f,  0x72,  0x6d,  0x3a,  0x20,  0x75,  0x70,  0x70, 
+ 0x65,  0x72,  0x63,  0x61,  0x73,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77, 
+ 0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x36,  0x30,  0x30,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x66, 
+ 0x69,  0x65,  0x6c,  0x64,  0x73,  0x65,  0x74,  0x2e,  0x64,  0x72,  0x6f,  0x70,  0x64,  0x6f,  0x77,  0x6e, 
+ 0x73,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x2d,  0x77,  0x65,  0x62,  0x6b,  0x69,  0x74,  0x2d,  0x61,  0x70, 
+ 0x70,  0x65,  0x61,  0x72,  0x61,  0x6e,  0x63,  0x65,  0x3a,  0x20,  0x6e,  0x6f,  0x6e,  0x65,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x66,  0x6c,  0x65,  0x78,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x67,  0x72,  0x69,  0x64,  0x2d,  0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65, 
+ 0x3a,  0x20,  0x22,  0x61,  0x20,  0x61,  0x22,  0x3b,  0x0a,  0x20,  0x20,  0x67,  0x61,  0x70,  0x3a,  0x20, 
+ 0x31,  0x65,  0x6d,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65, 
+ 0x3a,  0x20,  0x78,  0x2d,  0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x3a,  0x20,  0x72,  0x65,  0x64,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69, 
+ 0x6e,  0x67,  0x2d,  0x74,  0x6f,  0x70,  0x3a,  0x20,  0x31,  0x36,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x62,  0x6f,  0x74,  0x74,  0x6f,  0x6d,  0x3a,  0x20, 
+ 0x31,  0x36,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x74,  0x72,  0x61, 
+ 0x6e,  0x73,  0x66,  0x6f,  0x72,  0x6d,  0x3a,  0x20,  0x75,  0x70,  0x70,  0x65,  0x72,  0x63,  0x61,  0x73, 
+ 0x65,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77,  0x65,  0x69,  0x67,  0x68,  0x74, 
+ 0x3a,  0x20,  0x36,  0x30,  0x30,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x69,  0x6e,  0x70, 
+ 0x75,  0x74,  0x20,  0x6f,  0x66,  0x20,  0x6e,  0x61,  0x6d,  0x65,  0x20,  0x66,  0x69,  0x65,  0x6c,  0x64, 
+ 0x73,  0x2a,  0x2f,  0x0a,  0x2e,  0x6e,  0x61,  0x6d,  0x65,  0x73,  0x20,  0x69,  0x6e,  0x70,  0x75,  0x74, 
+ 0x5b,  0x74,  0x79,  0x70,  0x65,  0x3d,  0x22,  0x74,  0x65,  0x78,  0x74,  0x22,  0x5d,  0x20,  0x7b,  0x0a, 
+ 0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x66,  0x61,  0x6d,  0x69,  0x6c,  0x79,  0x3a,  0x20,  0x41, 
+ 0x72,  0x69,  0x61,  0x6c,  0x2c,  0x20,  0x73,  0x61,  0x6e,  0x73,  0x2d,  0x73,  0x65,  0x72,  0x69,  0x66, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x6d, 
+ 0x65,  0x64,  0x69,  0x75,  0x6d,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77,  0x65, 
+ 0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x35,  0x30,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64, 
+ 0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x35,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72, 
+ 0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76, 
+ 0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x32,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x63,  0x68,  0x61,  0x74,  0x2d,  0x69, 
+ 0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x63,  0x68,  0x61,  0x74,  0x2d,  0x69,  0x64, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x64,  0x65,  0x74,  0x61, 
+ 0x69,  0x6c,  0x73,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20, 
+ 0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d, 
+ 0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x72,  0x61,  0x64,  0x69,  0x75,  0x73, 
+ 0x3a,  0x20,  0x35,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67, 
+ 0x3a,  0x20,  0x30,  0x2e,  0x35,  0x65,  0x6d,  0x20,  0x30,  0x2e,  0x35,  0x65,  0x6d,  0x20,  0x30,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x2d,  0x74,  0x6f,  0x70,  0x3a,  0x20,  0x30, 
+ 0x2e,  0x35,  0x65,  0x6d,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x73,  0x75,  0x6d,  0x6d,  0x61,  0x72,  0x79, 
+ 0x20,  0x7b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77,  0x65,  0x69,  0x67,  0x68,  0x74, 
+ 0x3a,  0x20,  0x62,  0x6f,  0x6c,  0x64,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e, 
+ 0x3a,  0x20,  0x2d,  0x30,  0x2e,  0x35,  0x65,  0x6d,  0x20,  0x2d,  0x30,  0x2e,  0x35,  0x65,  0x6d,  0x20, 
+ 0x30,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x30,  0x2e, 
+ 0x35,  0x65,  0x6d,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x75,  0x72,  0x73,  0x6f,  0x72,  0x3a,  0x20,  0x70, 
+ 0x6f,  0x69,  0x6e,  0x74,  0x65,  0x72,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x64,  0x65,  0x74,  0x61,  0x69, 
+ 0x6c,  0x73,  0x5b,  0x6f,  0x70,  0x65,  0x6e,  0x5d,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64, 
+ 0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x30,  0x2e,  0x35,  0x65,  0x6d,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a, 
+ 0x74,  0x65,  0x78,  0x74,  0x61,  0x72,  0x65,  0x61,  0x2d,  0x73,  0x65,  0x63,  0x2c,  0x20,  0x69,  0x6e, 
+ 0x70,  0x75,  0x74,  0x2d,  0x73,  0x65,  0x63,  0x2c,  0x20,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d, 
+ 0x73,  0x65,  0x63,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x3a, 
+ 0x20,  0x31,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x68,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a, 
+ 0x20,  0x34,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x61,  0x6c,  0x69,  0x67,  0x6e,  0x2d,  0x69, 
+ 0x74,  0x65,  0x6d,  0x73,  0x3a,  0x20,  0x63,  0x65,  0x6e,  0x74,  0x65,  0x72,  0x3b,  0x0a,  0x7d,  0x0a, 
+ 0x0a,  0x74,  0x65,  0x78,  0x74,  0x61,  0x72,  0x65,  0x61,  0x2d,  0x73,  0x65,  0x63,  0x3a,  0x3a,  0x70, 
+ 0x6c,  0x61,  0x63,  0x65,  0x68,  0x6f,  0x6c,  0x64,  0x65,  0x72,  0x2c,  0x20,  0x69,  0x6e,  0x70,  0x75, 
+ 0x74,  0x2d,  0x73,  0x65,  0x63,  0x3a,  0x3a,  0x70,  0x6c,  0x61,  0x63,  0x65,  0x68,  0x6f,  0x6c,  0x64, 
+ 0x65,  0x72,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x6c, 
+ 0x65,  0x66,  0x74,  0x3a,  0x20,  0x31,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x74, 
+ 0x6f,  0x67,  0x67,  0x6c,  0x65,  0x43,  0x68,  0x65,  0x63,  0x6b,  0x62,  0x6f,  0x78,  0x20,  0x7b,  0x0a, 
+ 0x20,  0x20,  0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x6e,  0x6f,  0x6e,  0x65,  0x3b, 
+ 0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x74,  0x6f,  0x67,  0x67,  0x6c,  0x65,  0x43,  0x6f,  0x6e,  0x74,  0x61, 
+ 0x69,  0x6e,  0x65,  0x72,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x70,  0x6f,  0x73,  0x69,  0x74,  0x69,  0x6f, 
+ 0x6e,  0x3a,  0x20,  0x72,  0x65,  0x6c,  0x61,  0x74,  0x69,  0x76,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x64, 
+ 0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x67,  0x72,  0x69,  0x64,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x67,  0x72,  0x69,  0x64,  0x2d,  0x74,  0x65,  0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x75,  0x6d,  0x6e,  0x73,  0x3a,  0x20,  0x72,  0x65,  0x70,  0x65,  0x61,  0x74,  0x28,  0x32,  0x2c, 
+ 0x20,  0x31,  0x66,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20, 
+ 0x66,  0x69,  0x74,  0x2d,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x3b,  0x0a,  0x20,  0x20,  0x62, 
+ 0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x33,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72, 
+ 0x2d,  0x72,  0x61,  0x64,  0x69,  0x75,  0x73,  0x3a,  0x20,  0x32,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x3a,  0x20,  0x76,  0x61,  0x72, 
+ 0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d, 
+ 0x32,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a, 
+ 0x20,  0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x75,  0x72,  0x73,  0x6f,  0x72, 
+ 0x3a,  0x20,  0x70,  0x6f,  0x69,  0x6e,  0x74,  0x65,  0x72,  0x3b,  0x0a,  0x20,  0x20,  0x6f,  0x76,  0x65, 
+ 0x72,  0x66,  0x6c,  0x6f,  0x77,  0x3a,  0x20,  0x68,  0x69,  0x64,  0x64,  0x65,  0x6e,  0x3b,  0x0a,  0x7d, 
+ 0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x74,  0x6f,  0x67,  0x67,  0x6c,  0x65,  0x20,  0x62,  0x75,  0x74,  0x74, 
+ 0x6f,  0x6e,  0x20,  0x63,  0x75,  0x72,  0x72,  0x65,  0x6e,  0x74,  0x20,  0x73,  0x74,  0x61,  0x74,  0x65, 
+ 0x20,  0x2a,  0x2f,  0x0a,  0x2e,  0x74,  0x6f,  0x67,  0x67,  0x6c,  0x65,  0x43,  0x6f,  0x6e,  0x74,  0x61, 
+ 0x69,  0x6e,  0x65,  0x72,  0x3a,  0x3a,  0x62,  0x65,  0x66,  0x6f,  0x72,  0x65,  0x20,  0x7b,  0x0a,  0x20, 
+ 0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75, 
+ 0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78, 
+ 0x74,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75, 
+ 0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x3a,  0x20, 
+ 0x27,  0x27,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x6f,  0x73,  0x69,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20, 
+ 0x61,  0x62,  0x73,  0x6f,  0x6c,  0x75,  0x74,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x77,  0x69,  0x64,  0x74, 
+ 0x68,  0x3a,  0x20,  0x35,  0x30,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x68,  0x65,  0x69,  0x67,  0x68,  0x74, 
+ 0x3a,  0x20,  0x31,  0x30,  0x30,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x6c,  0x65,  0x66,  0x74,  0x3a,  0x20, 
+ 0x30,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x72,  0x61,  0x64, 
+ 0x69,  0x75,  0x73,  0x3a,  0x20,  0x32,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x72,  0x61, 
+ 0x6e,  0x73,  0x69,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x61,  0x6c,  0x6c,  0x20,  0x30,  0x2e,  0x33, 
+ 0x73,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x74,  0x6f,  0x67,  0x67,  0x6c,  0x65,  0x43,  0x6f,  0x6e, 
+ 0x74,  0x61,  0x69,  0x6e,  0x65,  0x72,  0x20,  0x64,  0x69,  0x76,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x70, 
+ 0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x36,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x74, 
+ 0x65,  0x78,  0x74,  0x2d,  0x61,  0x6c,  0x69,  0x67,  0x6e,  0x3a,  0x20,  0x63,  0x65,  0x6e,  0x74,  0x65, 
+ 0x72,  0x3b,  0x0a,  0x20,  0x20,  0x7a,  0x2d,  0x69,  0x6e,  0x64,  0x65,  0x78,  0x3a,  0x20,  0x31,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x74,  0x72,  0x61,  0x6e,  0x73,  0x69,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x20,  0x30,  0x2e,  0x33,  0x73,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x74, 
+ 0x6f,  0x67,  0x67,  0x6c,  0x65,  0x43,  0x68,  0x65,  0x63,  0x6b,  0x62,  0x6f,  0x78,  0x3a,  0x63,  0x68, 
+ 0x65,  0x63,  0x6b,  0x65,  0x64,  0x20,  0x2b,  0x20,  0x2e,  0x74,  0x6f,  0x67,  0x67,  0x6c,  0x65,  0x43, 
+ 0x6f,  0x6e,  0x74,  0x61,  0x69,  0x6e,  0x65,  0x72,  0x3a,  0x3a,  0x62,  0x65,  0x66,  0x6f,  0x72,  0x65, 
+ 0x20,  0x7b,  0x0a,  0x20,  0x20,  0x6c,  0x65,  0x66,  0x74,  0x3a,  0x20,  0x35,  0x30,  0x25,  0x3b,  0x0a, 
+ 0x7d,  0x0a,  0x0a,  0x2e,  0x74,  0x6f,  0x67,  0x67,  0x6c,  0x65,  0x43,  0x68,  0x65,  0x63,  0x6b,  0x62, 
+ 0x6f,  0x78,  0x3a,  0x63,  0x68,  0x65,  0x63,  0x6b,  0x65,  0x64,  0x20,  0x2b,  0x20,  0x2e,  0x74,  0x6f, 
+ 0x67,  0x67,  0x6c,  0x65,  0x43,  0x6f,  0x6e,  0x74,  0x61,  0x69,  0x6e,  0x65,  0x72,  0x20,  0x64,  0x69, 
+ 0x76,  0x3a,  0x66,  0x69,  0x72,  0x73,  0x74,  0x2d,  0x63,  0x68,  0x69,  0x6c,  0x64,  0x20,  0x7b,  0x0a, 
+ 0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74, 
+ 0x65,  0x78,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x73,  0x75,  0x62,  0x74,  0x69,  0x6c, 
+ 0x65,  0x2d,  0x32,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x74,  0x6f,  0x67,  0x67,  0x6c,  0x65, 
+ 0x43,  0x68,  0x65,  0x63,  0x6b,  0x62,  0x6f,  0x78,  0x3a,  0x63,  0x68,  0x65,  0x63,  0x6b,  0x65,  0x64, 
+ 0x20,  0x2b,  0x20,  0x2e,  0x74,  0x6f,  0x67,  0x67,  0x6c,  0x65,  0x43,  0x6f,  0x6e,  0x74,  0x61,  0x69, 
+ 0x6e,  0x65,  0x72,  0x20,  0x64,  0x69,  0x76,  0x3a,  0x6c,  0x61,  0x73,  0x74,  0x2d,  0x63,  0x68,  0x69, 
+ 0x6c,  0x64,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61, 
+ 0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61, 
+ 0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x74,  0x6f, 
+ 0x67,  0x67,  0x6c,  0x65,  0x43,  0x68,  0x65,  0x63,  0x6b,  0x62,  0x6f,  0x78,  0x20,  0x2b,  0x20,  0x2e, 
+ 0x74,  0x6f,  0x67,  0x67,  0x6c,  0x65,  0x43,  0x6f,  0x6e,  0x74,  0x61,  0x69,  0x6e,  0x65,  0x72,  0x20, 
+ 0x64,  0x69,  0x76,  0x3a,  0x66,  0x69,  0x72,  0x73,  0x74,  0x2d,  0x63,  0x68,  0x69,  0x6c,  0x64,  0x20, 
+ 0x7b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d, 
+ 0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d, 
+ 0x74,  0x65,  0x78,  0x74,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x74,  0x6f,  0x67,  0x67,  0x6c, 
+ 0x65,  0x43,  0x68,  0x65,  0x63,  0x6b,  0x62,  0x6f,  0x78,  0x20,  0x2b,  0x20,  0x2e,  0x74,  0x6f,  0x67, 
+ 0x67,  0x6c,  0x65,  0x43,  0x6f,  0x6e,  0x74,  0x61,  0x69,  0x6e,  0x65,  0x72,  0x20,  0x64,  0x69,  0x76, 
+ 0x3a,  0x6c,  0x61,  0x73,  0x74,  0x2d,  0x63,  0x68,  0x69,  0x6c,  0x64,  0x20,  0x7b,  0x0a,  0x20,  0x20, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x65,  0x78, 
+ 0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x73,  0x75,  0x62,  0x74,  0x69,  0x6c,  0x65,  0x2d, 
+ 0x32,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x73,  0x65,  0x6c,  0x65,  0x63,  0x74,  0x20,  0x7b,  0x0a, 
+ 0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x35,  0x70,  0x78,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x2d,  0x72,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20, 
+ 0x35,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x72,  0x61, 
+ 0x64,  0x69,  0x75,  0x73,  0x3a,  0x20,  0x34,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72, 
+ 0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76, 
+ 0x61,  0x72,  0x28,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67, 
+ 0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72, 
+ 0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x2d,  0x33,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61, 
+ 0x72,  0x28,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x75,  0x72,  0x73,  0x6f,  0x72, 
+ 0x3a,  0x20,  0x70,  0x6f,  0x69,  0x6e,  0x74,  0x65,  0x72,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x73,  0x65, 
+ 0x6c,  0x65,  0x63,  0x74,  0x3a,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x62, 
+ 0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x66,  0x6f, 
+ 0x63,  0x75,  0x73,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f, 
+ 0x78,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x3a,  0x20,  0x30,  0x20,  0x30,  0x20,  0x31,  0x70, 
+ 0x78,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x66, 
+ 0x6f,  0x63,  0x75,  0x73,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x29,  0x3b,  0x0a,  0x7d,  0x0a, 
+ 0x0a,  0x2e,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x63,  0x6f,  0x6e,  0x74,  0x61,  0x69,  0x6e, 
+ 0x65,  0x72,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20, 
+ 0x66,  0x6c,  0x65,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x6a,  0x75,  0x73,  0x74,  0x69,  0x66,  0x79,  0x2d, 
+ 0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x3a,  0x20,  0x66,  0x6c,  0x65,  0x78,  0x2d,  0x65,  0x6e, 
+ 0x64,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x20,  0x7b,  0x0a,  0x20, 
+ 0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75, 
+ 0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78, 
+ 0x74,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75, 
+ 0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31, 
+ 0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62, 
+ 0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f, 
+ 0x72,  0x64,  0x65,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x72,  0x61,  0x6e,  0x73,  0x69,  0x74, 
+ 0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x20,  0x30,  0x2e,  0x31,  0x73,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f, 
+ 0x72,  0x64,  0x65,  0x72,  0x2d,  0x72,  0x61,  0x64,  0x69,  0x75,  0x73,  0x3a,  0x20,  0x31,  0x32,  0x70, 
+ 0x78,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20, 
+ 0x78,  0x2d,  0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d, 
+ 0x77,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x36,  0x30,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x74, 
+ 0x65,  0x78,  0x74,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x3a,  0x20,  0x30,  0x70,  0x78,  0x20, 
+ 0x30,  0x70,  0x78,  0x20,  0x33,  0x30,  0x70,  0x78,  0x20,  0x23,  0x66,  0x66,  0x66,  0x66,  0x66,  0x66, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x61,  0x6c,  0x69,  0x67,  0x6e,  0x3a,  0x20, 
+ 0x63,  0x65,  0x6e,  0x74,  0x65,  0x72,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x64, 
+ 0x65,  0x63,  0x6f,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x6e,  0x6f,  0x6e,  0x65,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x3a,  0x20,  0x34,  0x70,  0x78,  0x20,  0x32, 
+ 0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x31, 
+ 0x30,  0x70,  0x78,  0x20,  0x32,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x64,  0x69,  0x73,  0x70, 
+ 0x6c,  0x61,  0x79,  0x3a,  0x20,  0x69,  0x6e,  0x6c,  0x69,  0x6e,  0x65,  0x2d,  0x62,  0x6c,  0x6f,  0x63, 
+ 0x6b,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x75,  0x72,  0x73,  0x6f,  0x72,  0x3a,  0x20,  0x70,  0x6f,  0x69, 
+ 0x6e,  0x74,  0x65,  0x72,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x3a, 
+ 0x68,  0x6f,  0x76,  0x65,  0x72,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72, 
+ 0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72, 
+ 0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74, 
+ 0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64, 
+ 0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61, 
+ 0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61, 
+ 0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x29, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x78, 
+ 0x2d,  0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77, 
+ 0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x36,  0x30,  0x30,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x62, 
+ 0x75,  0x74,  0x74,  0x6f,  0x6e,  0x3a,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x20,  0x7b,  0x0a,  0x20, 
+ 0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75, 
+ 0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78, 
+ 0x74,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63, 
+ 0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76, 
+ 0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d, 
+ 0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65, 
+ 0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78, 
+ 0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74, 
+ 0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64, 
+ 0x65,  0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f, 
+ 0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x78,  0x2d,  0x73,  0x6d,  0x61,  0x6c,  0x6c, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a, 
+ 0x20,  0x36,  0x30,  0x30,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x3a, 
+ 0x64,  0x69,  0x73,  0x61,  0x62,  0x6c,  0x65,  0x64,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e, 
+ 0x2d,  0x74,  0x65,  0x72,  0x74,  0x69,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x29,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f, 
+ 0x6e,  0x2d,  0x74,  0x65,  0x72,  0x74,  0x69,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78, 
+ 0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74, 
+ 0x74,  0x6f,  0x6e,  0x2d,  0x74,  0x65,  0x72,  0x74,  0x69,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72, 
+ 0x64,  0x65,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a, 
+ 0x65,  0x3a,  0x20,  0x78,  0x2d,  0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f, 
+ 0x6e,  0x74,  0x2d,  0x77,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x36,  0x30,  0x30,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x63,  0x75,  0x72,  0x73,  0x6f,  0x72,  0x3a,  0x20,  0x6e,  0x6f,  0x74,  0x2d,  0x61,  0x6c, 
+ 0x6c,  0x6f,  0x77,  0x65,  0x64,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x72,  0x65,  0x73,  0x65,  0x74, 
+ 0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b, 
+ 0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61, 
+ 0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e, 
+ 0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62, 
+ 0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65, 
+ 0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62, 
+ 0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d, 
+ 0x74,  0x65,  0x78,  0x74,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20, 
+ 0x66,  0x69,  0x74,  0x2d,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x3b,  0x0a,  0x20,  0x20,  0x68, 
+ 0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x66,  0x69,  0x74,  0x2d,  0x63,  0x6f,  0x6e,  0x74,  0x65, 
+ 0x6e,  0x74,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a, 
+ 0x20,  0x78,  0x2d,  0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74, 
+ 0x2d,  0x77,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x36,  0x30,  0x30,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x72,  0x61,  0x64,  0x69,  0x75,  0x73,  0x3a,  0x20,  0x35, 
+ 0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x6f,  0x76,  0x65,  0x72,  0x66,  0x6c,  0x6f,  0x77,  0x3a, 
+ 0x20,  0x68,  0x69,  0x64,  0x64,  0x65,  0x6e,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x72,  0x65,  0x73, 
+ 0x65,  0x74,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x3a,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x20, 
+ 0x7b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d, 
+ 0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x61,  0x6c,  0x65,  0x72,  0x74,  0x2d,  0x74,  0x65, 
+ 0x78,  0x74,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63, 
+ 0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76, 
+ 0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x61,  0x6c,  0x65,  0x72, 
+ 0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x29,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f, 
+ 0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e, 
+ 0x2d,  0x61,  0x6c,  0x65,  0x72,  0x74,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x68,  0x6f, 
+ 0x76,  0x65,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a, 
+ 0x65,  0x3a,  0x20,  0x78,  0x2d,  0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f, 
+ 0x6e,  0x74,  0x2d,  0x77,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x36,  0x30,  0x30,  0x3b,  0x0a, 
+ 0x7d,  0x0a,  0x0a,  0x2e,  0x72,  0x65,  0x73,  0x65,  0x74,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e, 
+ 0x3a,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d, 
+ 0x61,  0x6c,  0x65,  0x72,  0x74,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76, 
+ 0x65,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75, 
+ 0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x61,  0x6c,  0x65,  0x72,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64, 
+ 0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61, 
+ 0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x61,  0x6c,  0x65,  0x72,  0x74, 
+ 0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x29,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x78,  0x2d, 
+ 0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77,  0x65, 
+ 0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x36,  0x30,  0x30,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x62, 
+ 0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x67,  0x72,  0x61,  0x6d,  0x6d,  0x61,  0x72,  0x20,  0x7b,  0x0a, 
+ 0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62, 
+ 0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65, 
+ 0x78,  0x74,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e, 
+ 0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62, 
+ 0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20, 
+ 0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d, 
+ 0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x62, 
+ 0x6f,  0x72,  0x64,  0x65,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72, 
+ 0x2d,  0x72,  0x61,  0x64,  0x69,  0x75,  0x73,  0x3a,  0x20,  0x31,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x31,  0x30,  0x70,  0x78,  0x20,  0x32, 
+ 0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x61,  0x6c,  0x69,  0x67, 
+ 0x6e,  0x3a,  0x20,  0x63,  0x65,  0x6e,  0x74,  0x65,  0x72,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78, 
+ 0x74,  0x2d,  0x64,  0x65,  0x63,  0x6f,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x6e,  0x6f, 
+ 0x6e,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x69, 
+ 0x6e,  0x6c,  0x69,  0x6e,  0x65,  0x2d,  0x62,  0x6c,  0x6f,  0x63,  0x6b,  0x3b,  0x0a,  0x20,  0x20,  0x66, 
+ 0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x78,  0x2d,  0x73,  0x6d,  0x61,  0x6c, 
+ 0x6c,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77,  0x65,  0x69,  0x67,  0x68,  0x74, 
+ 0x3a,  0x20,  0x36,  0x30,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x3a, 
+ 0x20,  0x32,  0x70,  0x78,  0x20,  0x32,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x72,  0x61,  0x6e, 
+ 0x73,  0x69,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75, 
+ 0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x20,  0x30,  0x2e,  0x31,  0x73,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x63,  0x75,  0x72,  0x73,  0x6f,  0x72,  0x3a,  0x20,  0x70,  0x6f,  0x69,  0x6e,  0x74,  0x65,  0x72, 
+ 0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x67,  0x72,  0x61, 
+ 0x6d,  0x6d,  0x61,  0x72,  0x3a,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74, 
+ 0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d, 
+ 0x68,  0x6f,  0x76,  0x65,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72, 
+ 0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28, 
+ 0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x29,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c, 
+ 0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d, 
+ 0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x68, 
+ 0x6f,  0x76,  0x65,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d, 
+ 0x72,  0x61,  0x64,  0x69,  0x75,  0x73,  0x3a,  0x20,  0x31,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x31,  0x30,  0x70,  0x78,  0x20,  0x32,  0x30, 
+ 0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x61,  0x6c,  0x69,  0x67,  0x6e, 
+ 0x3a,  0x20,  0x63,  0x65,  0x6e,  0x74,  0x65,  0x72,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78,  0x74, 
+ 0x2d,  0x64,  0x65,  0x63,  0x6f,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x6e,  0x6f,  0x6e, 
+ 0x65,  0x3b,  0x0a,  0x20,  0x20,  0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x69,  0x6e, 
+ 0x6c,  0x69,  0x6e,  0x65,  0x2d,  0x62,  0x6c,  0x6f,  0x63,  0x6b,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f, 
+ 0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x78,  0x2d,  0x73,  0x6d,  0x61,  0x6c,  0x6c, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a, 
+ 0x20,  0x36,  0x30,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x3a,  0x20, 
+ 0x32,  0x70,  0x78,  0x20,  0x32,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x72,  0x61,  0x6e,  0x73, 
+ 0x69,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e, 
+ 0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x20,  0x30,  0x2e,  0x31,  0x73,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x63,  0x75,  0x72,  0x73,  0x6f,  0x72,  0x3a,  0x20,  0x70,  0x6f,  0x69,  0x6e,  0x74,  0x65,  0x72,  0x3b, 
+ 0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x67,  0x72,  0x61,  0x6d, 
+ 0x6d,  0x61,  0x72,  0x3a,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74, 
+ 0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d, 
+ 0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67, 
+ 0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72, 
+ 0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72, 
+ 0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x29,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73, 
+ 0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f, 
+ 0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72, 
+ 0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74, 
+ 0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x78,  0x2d,  0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x36, 
+ 0x30,  0x30,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x62, 
+ 0x61,  0x63,  0x6b,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75, 
+ 0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d, 
+ 0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65, 
+ 0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72, 
+ 0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64, 
+ 0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f, 
+ 0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74, 
+ 0x29,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x72,  0x61,  0x6e,  0x73,  0x69,  0x74,  0x69,  0x6f,  0x6e,  0x3a, 
+ 0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x20,  0x30,  0x2e,  0x31,  0x73,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72, 
+ 0x2d,  0x72,  0x61,  0x64,  0x69,  0x75,  0x73,  0x3a,  0x20,  0x31,  0x32,  0x70,  0x78,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x78,  0x2d,  0x73,  0x6d, 
+ 0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77,  0x65,  0x69,  0x67, 
+ 0x68,  0x74,  0x3a,  0x20,  0x36,  0x30,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78,  0x74,  0x2d, 
+ 0x61,  0x6c,  0x69,  0x67,  0x6e,  0x3a,  0x20,  0x63,  0x65,  0x6e,  0x74,  0x65,  0x72,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x64,  0x65,  0x63,  0x6f,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e, 
+ 0x3a,  0x20,  0x6e,  0x6f,  0x6e,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e, 
+ 0x3a,  0x20,  0x34,  0x70,  0x78,  0x20,  0x32,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64, 
+ 0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x31,  0x30,  0x70,  0x78,  0x20,  0x32,  0x30,  0x70,  0x78,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x69,  0x6e,  0x6c,  0x69, 
+ 0x6e,  0x65,  0x2d,  0x62,  0x6c,  0x6f,  0x63,  0x6b,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x75,  0x72,  0x73, 
+ 0x6f,  0x72,  0x3a,  0x20,  0x70,  0x6f,  0x69,  0x6e,  0x74,  0x65,  0x72,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a, 
+ 0x2e,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x62,  0x61,  0x63,  0x6b,  0x3a,  0x68,  0x6f,  0x76, 
+ 0x65,  0x72,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61, 
+ 0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e, 
+ 0x64,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x29, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74, 
+ 0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72, 
+ 0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76, 
+ 0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f, 
+ 0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x68,  0x6f,  0x76, 
+ 0x65,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20, 
+ 0x31,  0x30,  0x70,  0x78,  0x20,  0x32,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78, 
+ 0x74,  0x2d,  0x61,  0x6c,  0x69,  0x67,  0x6e,  0x3a,  0x20,  0x63,  0x65,  0x6e,  0x74,  0x65,  0x72,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x64,  0x65,  0x63,  0x6f,  0x72,  0x61,  0x74,  0x69, 
+ 0x6f,  0x6e,  0x3a,  0x20,  0x6e,  0x6f,  0x6e,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x64,  0x69,  0x73,  0x70, 
+ 0x6c,  0x61,  0x79,  0x3a,  0x20,  0x69,  0x6e,  0x6c,  0x69,  0x6e,  0x65,  0x2d,  0x62,  0x6c,  0x6f,  0x63, 
+ 0x6b,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20, 
+ 0x78,  0x2d,  0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d, 
+ 0x77,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x36,  0x30,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x6d, 
+ 0x61,  0x72,  0x67,  0x69,  0x6e,  0x3a,  0x20,  0x34,  0x70,  0x78,  0x20,  0x32,  0x70,  0x78,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x74,  0x72,  0x61,  0x6e,  0x73,  0x69,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x62,  0x61, 
+ 0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x20,  0x30, 
+ 0x2e,  0x31,  0x73,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x75,  0x72,  0x73,  0x6f,  0x72,  0x3a,  0x20,  0x70, 
+ 0x6f,  0x69,  0x6e,  0x74,  0x65,  0x72,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72, 
+ 0x2d,  0x72,  0x61,  0x64,  0x69,  0x75,  0x73,  0x3a,  0x20,  0x31,  0x32,  0x70,  0x78,  0x3b,  0x0a,  0x7d, 
+ 0x0a,  0x0a,  0x2e,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x62,  0x61,  0x63,  0x6b,  0x3a,  0x61, 
+ 0x63,  0x74,  0x69,  0x76,  0x65,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65, 
+ 0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x61,  0x63,  0x74, 
+ 0x69,  0x76,  0x65,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75, 
+ 0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d, 
+ 0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x29,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f, 
+ 0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e, 
+ 0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65, 
+ 0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e, 
+ 0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x78,  0x2d,  0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20, 
+ 0x36,  0x30,  0x30,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x70,  0x72,  0x6f,  0x62,  0x2d,  0x73,  0x65, 
+ 0x74,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x30, 
+ 0x2e,  0x33,  0x65,  0x6d,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x62, 
+ 0x6f,  0x74,  0x74,  0x6f,  0x6d,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64, 
+ 0x20,  0x72,  0x65,  0x64,  0x3b,  0x20,  0x2f,  0x2a,  0x20,  0x75,  0x6e,  0x6b,  0x6e,  0x6f,  0x77,  0x6e, 
+ 0x20,  0x2a,  0x2f,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x70,  0x6f,  0x70,  0x6f,  0x76,  0x65,  0x72,  0x2d, 
+ 0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x70,  0x6f,  0x73,  0x69, 
+ 0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x61,  0x62,  0x73,  0x6f,  0x6c,  0x75,  0x74,  0x65,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x3a,  0x20,  0x77,  0x68,  0x69,  0x74,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64, 
+ 0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x30,  0x2e,  0x32,  0x65,  0x6d,  0x3b,  0x0a,  0x20,  0x20,  0x62, 
+ 0x6f,  0x78,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x3a,  0x20,  0x30,  0x20,  0x30,  0x20,  0x31, 
+ 0x33,  0x70,  0x78,  0x20,  0x72,  0x67,  0x62,  0x61,  0x28,  0x30,  0x2c,  0x20,  0x30,  0x2c,  0x20,  0x30, 
+ 0x2c,  0x20,  0x30,  0x2e,  0x31,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x67,  0x72,  0x61,  0x6d, 
+ 0x6d,  0x61,  0x72,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20,  0x39, 
+ 0x37,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x78,  0x2d,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a, 
+ 0x20,  0x39,  0x37,  0x25,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x74,  0x65,  0x78,  0x74,  0x61,  0x72,  0x65, 
+ 0x61,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x35, 
+ 0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6c,  0x65,  0x78,  0x2d,  0x67,  0x72,  0x6f,  0x77,  0x3a, 
+ 0x20,  0x31,  0x3b,  0x0a,  0x20,  0x20,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20,  0x31,  0x30,  0x30, 
+ 0x25,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x78,  0x2d,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20, 
+ 0x31,  0x30,  0x30,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x72, 
+ 0x61,  0x64,  0x69,  0x75,  0x73,  0x3a,  0x20,  0x38,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f, 
+ 0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20, 
+ 0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x2d,  0x31,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x72,  0x65,  0x73,  0x69,  0x7a,  0x65,  0x3a, 
+ 0x20,  0x6e,  0x6f,  0x6e,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x68,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a, 
+ 0x20,  0x36,  0x65,  0x6d,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x74,  0x65,  0x78,  0x74,  0x61,  0x72,  0x65, 
+ 0x61,  0x3a,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x6f,  0x75,  0x74,  0x6c, 
+ 0x69,  0x6e,  0x65,  0x3a,  0x20,  0x6e,  0x6f,  0x6e,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72, 
+ 0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76, 
+ 0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x66,  0x6f,  0x63,  0x75, 
+ 0x73,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x78,  0x2d, 
+ 0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x3a,  0x20,  0x30,  0x20,  0x30,  0x20,  0x33,  0x70,  0x78,  0x20, 
+ 0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x66,  0x6f,  0x63, 
+ 0x75,  0x73,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2f, 
+ 0x2a,  0x20,  0x22,  0x70,  0x72,  0x6f,  0x70,  0x73,  0x22,  0x20,  0x66,  0x72,  0x61,  0x6d,  0x65,  0x20, 
+ 0x2a,  0x2f,  0x0a,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x5b,  0x74,  0x79,  0x70,  0x65,  0x3d,  0x22,  0x74, 
+ 0x65,  0x78,  0x74,  0x22,  0x5d,  0x2c,  0x0a,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x5b,  0x74,  0x79,  0x70, 
+ 0x65,  0x3d,  0x22,  0x72,  0x61,  0x6e,  0x67,  0x65,  0x22,  0x5d,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x70, 
+ 0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x35,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x62, 
+ 0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x72,  0x61,  0x64,  0x69,  0x75,  0x73,  0x3a,  0x20,  0x38,  0x70, 
+ 0x78,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78, 
+ 0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72, 
+ 0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x29,  0x3b,  0x0a,  0x7d,  0x0a, 
+ 0x0a,  0x2f,  0x2a,  0x20,  0x22,  0x6e,  0x61,  0x6d,  0x65,  0x73,  0x20,  0x61,  0x6e,  0x64,  0x20,  0x70, 
+ 0x72,  0x6f,  0x70,  0x73,  0x22,  0x20,  0x66,  0x72,  0x61,  0x6d,  0x65,  0x20,  0x66,  0x6f,  0x63,  0x75, 
+ 0x73,  0x65,  0x64,  0x2a,  0x2f,  0x0a,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x5b,  0x74,  0x79,  0x70,  0x65, 
+ 0x3d,  0x22,  0x74,  0x65,  0x78,  0x74,  0x22,  0x5d,  0x3a,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x20,  0x7b, 
+ 0x0a,  0x20,  0x20,  0x6f,  0x75,  0x74,  0x6c,  0x69,  0x6e,  0x65,  0x3a,  0x20,  0x6e,  0x6f,  0x6e,  0x65, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20, 
+ 0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64, 
+ 0x65,  0x72,  0x2d,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x62,  0x6f,  0x78,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x3a,  0x20,  0x30, 
+ 0x20,  0x30,  0x20,  0x33,  0x70,  0x78,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72, 
+ 0x64,  0x65,  0x72,  0x2d,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77, 
+ 0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x5b,  0x74,  0x79,  0x70,  0x65, 
+ 0x3d,  0x22,  0x72,  0x61,  0x6e,  0x67,  0x65,  0x22,  0x5d,  0x3a,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x20, 
+ 0x7b,  0x0a,  0x20,  0x20,  0x6f,  0x70,  0x61,  0x63,  0x69,  0x74,  0x79,  0x3a,  0x20,  0x31,  0x3b,  0x0a, 
+ 0x7d,  0x0a,  0x0a,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x5b,  0x74,  0x79,  0x70,  0x65,  0x3d,  0x22,  0x72, 
+ 0x61,  0x6e,  0x67,  0x65,  0x22,  0x5d,  0x3a,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x20,  0x7b,  0x0a,  0x20, 
+ 0x20,  0x6f,  0x75,  0x74,  0x6c,  0x69,  0x6e,  0x65,  0x3a,  0x20,  0x6e,  0x6f,  0x6e,  0x65,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f, 
+ 0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72, 
+ 0x2d,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x62,  0x6f,  0x78,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x3a,  0x20,  0x30,  0x20,  0x30, 
+ 0x20,  0x33,  0x70,  0x78,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65, 
+ 0x72,  0x2d,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x29,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x73,  0x69, 
+ 0x7a,  0x65,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x73,  0x6c,  0x69,  0x64,  0x65,  0x72, 
+ 0x2d,  0x74,  0x72,  0x61,  0x63,  0x6b,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x2d,  0x66,  0x6f,  0x63,  0x75, 
+ 0x73,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x5b,  0x74,  0x79,  0x70, 
+ 0x65,  0x3d,  0x22,  0x72,  0x61,  0x6e,  0x67,  0x65,  0x22,  0x5d,  0x3a,  0x3a,  0x2d,  0x6d,  0x6f,  0x7a, 
+ 0x2d,  0x72,  0x61,  0x6e,  0x67,  0x65,  0x2d,  0x74,  0x68,  0x75,  0x6d,  0x62,  0x20,  0x7b,  0x0a,  0x20, 
+ 0x20,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20,  0x36,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x68, 
+ 0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x32,  0x35,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x62, 
+ 0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x75,  0x69,  0x2d,  0x72,  0x61,  0x6e,  0x67,  0x65,  0x2d, 
+ 0x74,  0x68,  0x75,  0x6d,  0x62,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x29,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x72,  0x61,  0x64,  0x69,  0x75,  0x73,  0x3a,  0x20, 
+ 0x35,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e, 
+ 0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x75, 
+ 0x69,  0x2d,  0x72,  0x61,  0x6e,  0x67,  0x65,  0x2d,  0x74,  0x68,  0x75,  0x6d,  0x62,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x75,  0x72,  0x73,  0x6f,  0x72,  0x3a,  0x20, 
+ 0x70,  0x6f,  0x69,  0x6e,  0x74,  0x65,  0x72,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x69,  0x6e,  0x70,  0x75, 
+ 0x74,  0x5b,  0x74,  0x79,  0x70,  0x65,  0x3d,  0x22,  0x72,  0x61,  0x6e,  0x67,  0x65,  0x22,  0x5d,  0x20, 
+ 0x7b,  0x0a,  0x20,  0x20,  0x2d,  0x77,  0x65,  0x62,  0x6b,  0x69,  0x74,  0x2d,  0x61,  0x70,  0x70,  0x65, 
+ 0x61,  0x72,  0x61,  0x6e,  0x63,  0x65,  0x3a,  0x20,  0x6e,  0x6f,  0x6e,  0x65,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20,  0x38,  0x30,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x68,  0x65, 
+ 0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72, 
+ 0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76, 
+ 0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x31,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x72, 
+ 0x61,  0x64,  0x69,  0x75,  0x73,  0x3a,  0x20,  0x38,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61, 
+ 0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d, 
+ 0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x6f,  0x75,  0x74,  0x6c,  0x69,  0x6e,  0x65,  0x3a,  0x20,  0x6e,  0x6f,  0x6e,  0x65, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x6f,  0x70,  0x61,  0x63,  0x69,  0x74,  0x79,  0x3a,  0x20,  0x30,  0x2e,  0x37, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x2d,  0x77,  0x65,  0x62,  0x6b,  0x69,  0x74,  0x2d,  0x74,  0x72,  0x61,  0x6e, 
+ 0x73,  0x69,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x2e,  0x32,  0x73,  0x3b,  0x0a,  0x20,  0x20,  0x74, 
+ 0x72,  0x61,  0x6e,  0x73,  0x69,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x6f,  0x70,  0x61,  0x63,  0x69, 
+ 0x74,  0x79,  0x20,  0x2e,  0x32,  0x73,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x69,  0x6e,  0x70,  0x75,  0x74, 
+ 0x5b,  0x74,  0x79,  0x70,  0x65,  0x3d,  0x22,  0x72,  0x61,  0x6e,  0x67,  0x65,  0x22,  0x5d,  0x3a,  0x3a, 
+ 0x2d,  0x77,  0x65,  0x62,  0x6b,  0x69,  0x74,  0x2d,  0x73,  0x6c,  0x69,  0x64,  0x65,  0x72,  0x2d,  0x74, 
+ 0x68,  0x75,  0x6d,  0x62,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x2d,  0x77,  0x65,  0x62,  0x6b,  0x69,  0x74, 
+ 0x2d,  0x61,  0x70,  0x70,  0x65,  0x61,  0x72,  0x61,  0x6e,  0x63,  0x65,  0x3a,  0x20,  0x6e,  0x6f,  0x6e, 
+ 0x65,  0x3b,  0x0a,  0x20,  0x20,  0x61,  0x70,  0x70,  0x65,  0x61,  0x72,  0x61,  0x6e,  0x63,  0x65,  0x3a, 
+ 0x20,  0x6e,  0x6f,  0x6e,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20, 
+ 0x36,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x68,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x32, 
+ 0x35,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31, 
+ 0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x75, 
+ 0x69,  0x2d,  0x72,  0x61,  0x6e,  0x67,  0x65,  0x2d,  0x74,  0x68,  0x75,  0x6d,  0x62,  0x2d,  0x62,  0x6f, 
+ 0x72,  0x64,  0x65,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d, 
+ 0x72,  0x61,  0x64,  0x69,  0x75,  0x73,  0x3a,  0x20,  0x35,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x62, 
+ 0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x75,  0x69,  0x2d,  0x72,  0x61,  0x6e,  0x67,  0x65,  0x2d, 
+ 0x74,  0x68,  0x75,  0x6d,  0x62,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x63,  0x75,  0x72,  0x73,  0x6f,  0x72,  0x3a,  0x20,  0x70,  0x6f,  0x69,  0x6e,  0x74,  0x65,  0x72,  0x3b, 
+ 0x0a,  0x7d,  0x0a,  0x0a,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x5b,  0x74,  0x79,  0x70,  0x65,  0x3d,  0x22, 
+ 0x72,  0x61,  0x6e,  0x67,  0x65,  0x22,  0x5d,  0x3a,  0x3a,  0x2d,  0x77,  0x65,  0x62,  0x6b,  0x69,  0x74, 
+ 0x2d,  0x73,  0x6c,  0x69,  0x64,  0x65,  0x72,  0x2d,  0x72,  0x75,  0x6e,  0x6e,  0x61,  0x62,  0x6c,  0x65, 
+ 0x2d,  0x74,  0x72,  0x61,  0x63,  0x6b,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67, 
+ 0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28, 
+ 0x2d,  0x2d,  0x73,  0x6c,  0x69,  0x64,  0x65,  0x72,  0x2d,  0x74,  0x72,  0x61,  0x63,  0x6b,  0x2d,  0x73, 
+ 0x69,  0x7a,  0x65,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x5b,  0x74, 
+ 0x79,  0x70,  0x65,  0x3d,  0x22,  0x72,  0x61,  0x64,  0x69,  0x6f,  0x22,  0x5d,  0x20,  0x7b,  0x0a,  0x20, 
+ 0x20,  0x61,  0x63,  0x63,  0x65,  0x6e,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x20, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61, 
+ 0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29,  0x3b,  0x0a,  0x7d,  0x0a, 
+ 0x0a,  0x2e,  0x63,  0x68,  0x61,  0x74,  0x2d,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x2d,  0x63,  0x6f,  0x6e, 
+ 0x74,  0x61,  0x69,  0x6e,  0x65,  0x72,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x70,  0x6f,  0x73,  0x69,  0x74, 
+ 0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x72,  0x65,  0x6c,  0x61,  0x74,  0x69,  0x76,  0x65,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x6d,  0x61,  0x78,  0x2d,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20,  0x39,  0x37,  0x25,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x6d,  0x69,  0x6e,  0x2d,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20,  0x39,  0x37, 
+ 0x25,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x63,  0x68,  0x61,  0x74,  0x2d,  0x69,  0x6e,  0x70,  0x75, 
+ 0x74,  0x2d,  0x6c,  0x61,  0x62,  0x65,  0x6c,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x70,  0x6f,  0x73,  0x69, 
+ 0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x61,  0x62,  0x73,  0x6f,  0x6c,  0x75,  0x74,  0x65,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x74,  0x6f,  0x70,  0x3a,  0x20,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x6c,  0x65,  0x66,  0x74, 
+ 0x3a,  0x20,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61, 
+ 0x72,  0x28,  0x2d,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x70, 
+ 0x6c,  0x61,  0x69,  0x6e,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x6f,  0x69,  0x6e,  0x74,  0x65,  0x72, 
+ 0x2d,  0x65,  0x76,  0x65,  0x6e,  0x74,  0x73,  0x3a,  0x20,  0x6e,  0x6f,  0x6e,  0x65,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x2d,  0x6c,  0x65,  0x66,  0x74,  0x3a,  0x20,  0x35,  0x70, 
+ 0x78,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x2d,  0x74,  0x6f,  0x70,  0x3a, 
+ 0x20,  0x35,  0x70,  0x78,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x74,  0x65,  0x78,  0x74,  0x61,  0x72,  0x65, 
+ 0x61,  0x23,  0x63,  0x68,  0x61,  0x74,  0x2d,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x20,  0x7b,  0x0a,  0x20, 
+ 0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x74,  0x6f,  0x70,  0x3a,  0x20,  0x31,  0x30, 
+ 0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x6c,  0x65, 
+ 0x66,  0x74,  0x3a,  0x20,  0x31,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74, 
+ 0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x6d,  0x65,  0x64,  0x69,  0x75,  0x6d,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c, 
+ 0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x72,  0x65,  0x73,  0x69, 
+ 0x7a,  0x65,  0x3a,  0x20,  0x76,  0x65,  0x72,  0x74,  0x69,  0x63,  0x61,  0x6c,  0x3b,  0x0a,  0x7d,  0x0a, 
+ 0x0a,  0x74,  0x65,  0x78,  0x74,  0x61,  0x72,  0x65,  0x61,  0x23,  0x63,  0x68,  0x61,  0x74,  0x2d,  0x69, 
+ 0x6e,  0x70,  0x75,  0x74,  0x3a,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x62, 
+ 0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x66,  0x6f, 
+ 0x63,  0x75,  0x73,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f, 
+ 0x78,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x3a,  0x20,  0x30,  0x20,  0x30,  0x20,  0x33,  0x70, 
+ 0x78,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x66, 
+ 0x6f,  0x63,  0x75,  0x73,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x29,  0x3b,  0x0a,  0x7d,  0x0a, 
+ 0x0a,  0x2e,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x2d,  0x63,  0x6f,  0x6e,  0x74,  0x61,  0x69,  0x6e,  0x65, 
+ 0x72,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x70,  0x6f,  0x73,  0x69,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20, 
+ 0x72,  0x65,  0x6c,  0x61,  0x74,  0x69,  0x76,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x78,  0x2d, 
+ 0x73,  0x69,  0x7a,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x62, 
+ 0x6f,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20,  0x31,  0x30,  0x30, 
+ 0x25,  0x3b,  0x20,  0x2f,  0x2a,  0x20,  0x53,  0x65,  0x74,  0x7a,  0x74,  0x20,  0x64,  0x69,  0x65,  0x20, 
+ 0x42,  0x72,  0x65,  0x69,  0x74,  0x65,  0x20,  0x61,  0x75,  0x66,  0x20,  0x31,  0x30,  0x30,  0x25,  0x20, 
+ 0x2a,  0x2f,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x78,  0x2d,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20, 
+ 0x31,  0x30,  0x30,  0x25,  0x3b,  0x20,  0x2f,  0x2a,  0x20,  0x53,  0x74,  0x65,  0x6c,  0x6c,  0x74,  0x20, 
+ 0x73,  0x69,  0x63,  0x68,  0x65,  0x72,  0x2c,  0x20,  0x64,  0x61,  0x73,  0x73,  0x20,  0x64,  0x69,  0x65, 
+ 0x20,  0x42,  0x72,  0x65,  0x69,  0x74,  0x65,  0x20,  0x6e,  0x69,  0x63,  0x68,  0x74,  0x20,  0x67,  0x72, 
+ 0xc3,  0xb6,  0xc3,  0x9f,  0x65,  0x72,  0x20,  0x61,  0x6c,  0x73,  0x20,  0x31,  0x30,  0x30,  0x25,  0x20, 
+ 0x77,  0x69,  0x72,  0x64,  0x20,  0x2a,  0x2f,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x69,  0x6e,  0x70,  0x75, 
+ 0x74,  0x2d,  0x63,  0x6f,  0x6e,  0x74,  0x61,  0x69,  0x6e,  0x65,  0x72,  0x3a,  0x66,  0x6f,  0x63,  0x75, 
+ 0x73,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70, 
+ 0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f, 
+ 0x72,  0x64,  0x65,  0x72,  0x2d,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x78,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x3a, 
+ 0x20,  0x30,  0x20,  0x30,  0x20,  0x33,  0x70,  0x78,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62, 
+ 0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x2d,  0x73,  0x68,  0x61,  0x64, 
+ 0x6f,  0x77,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x2f,  0x2a,  0x20,  0x74,  0x69,  0x74,  0x6c,  0x65,  0x73, 
+ 0x20,  0x6f,  0x66,  0x20,  0x6e,  0x61,  0x6d,  0x65,  0x20,  0x66,  0x69,  0x65,  0x6c,  0x64,  0x73,  0x2a, 
+ 0x2f,  0x0a,  0x2f,  0x2a,  0x20,  0x66,  0x69,  0x65,  0x6c,  0x64,  0x73,  0x65,  0x74,  0x2e,  0x6e,  0x61, 
+ 0x6d,  0x65,  0x73,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a, 
+ 0x20,  0x67,  0x72,  0x69,  0x64,  0x3b,  0x0a,  0x20,  0x20,  0x67,  0x72,  0x69,  0x64,  0x2d,  0x74,  0x65, 
+ 0x6d,  0x70,  0x6c,  0x61,  0x74,  0x65,  0x3a,  0x20,  0x22,  0x61,  0x20,  0x61,  0x22,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x67,  0x61,  0x70,  0x3a,  0x20,  0x31,  0x65,  0x6d,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e, 
+ 0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x78,  0x2d,  0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d, 
+ 0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x2d,  0x33,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67, 
+ 0x2d,  0x74,  0x6f,  0x70,  0x3a,  0x20,  0x31,  0x36,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61, 
+ 0x64,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x62,  0x6f,  0x74,  0x74,  0x6f,  0x6d,  0x3a,  0x20,  0x31,  0x36, 
+ 0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x74,  0x72,  0x61,  0x6e,  0x73, 
+ 0x66,  0x6f,  0x72,  0x6d,  0x3a,  0x20,  0x75,  0x70,  0x70,  0x65,  0x72,  0x63,  0x61,  0x73,  0x65,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20, 
+ 0x36,  0x30,  0x30,  0x3b,  0x0a,  0x7d,  0x20,  0x2a,  0x2f,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x69,  0x6e, 
+ 0x70,  0x75,  0x74,  0x20,  0x6f,  0x66,  0x20,  0x6e,  0x61,  0x6d,  0x65,  0x20,  0x66,  0x69,  0x65,  0x6c, 
+ 0x64,  0x73,  0x2a,  0x2f,  0x0a,  0x2f,  0x2a,  0x20,  0x2e,  0x6e,  0x61,  0x6d,  0x65,  0x73,  0x20,  0x69, 
+ 0x6e,  0x70,  0x75,  0x74,  0x5b,  0x74,  0x79,  0x70,  0x65,  0x3d,  0x22,  0x74,  0x65,  0x78,  0x74,  0x22, 
+ 0x5d,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x66,  0x61,  0x6d,  0x69,  0x6c, 
+ 0x79,  0x3a,  0x20,  0x41,  0x72,  0x69,  0x61,  0x6c,  0x2c,  0x20,  0x73,  0x61,  0x6e,  0x73,  0x2d,  0x73, 
+ 0x65,  0x72,  0x69,  0x66,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a, 
+ 0x65,  0x3a,  0x20,  0x6d,  0x65,  0x64,  0x69,  0x75,  0x6d,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e, 
+ 0x74,  0x2d,  0x77,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x35,  0x30,  0x30,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x35,  0x70,  0x78,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c, 
+ 0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29,  0x3b,  0x0a,  0x7d,  0x20,  0x2a,  0x2f,  0x0a,  0x0a, 
+ 0x66,  0x69,  0x65,  0x6c,  0x64,  0x73,  0x65,  0x74,  0x2e,  0x61,  0x70,  0x69,  0x4b,  0x65,  0x79,  0x20, 
+ 0x7b,  0x0a,  0x20,  0x20,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20,  0x31,  0x30,  0x30,  0x25,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x78,  0x2d, 
+ 0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20, 
+ 0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e, 
+ 0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x70, 
+ 0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x74,  0x6f,  0x70,  0x3a,  0x20,  0x31,  0x36,  0x70,  0x78, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x62,  0x6f,  0x74,  0x74, 
+ 0x6f,  0x6d,  0x3a,  0x20,  0x31,  0x36,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78,  0x74, 
+ 0x2d,  0x74,  0x72,  0x61,  0x6e,  0x73,  0x66,  0x6f,  0x72,  0x6d,  0x3a,  0x20,  0x75,  0x70,  0x70,  0x65, 
+ 0x72,  0x63,  0x61,  0x73,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77,  0x65, 
+ 0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x36,  0x30,  0x30,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x61, 
+ 0x70,  0x69,  0x4b,  0x65,  0x79,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x66, 
+ 0x61,  0x6d,  0x69,  0x6c,  0x79,  0x3a,  0x20,  0x41,  0x72,  0x69,  0x61,  0x6c,  0x2c,  0x20,  0x73,  0x61, 
+ 0x6e,  0x73,  0x2d,  0x73,  0x65,  0x72,  0x69,  0x66,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74, 
+ 0x2d,  0x77,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x35,  0x30,  0x30,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x35,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69, 
+ 0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x61,  0x70,  0x69, 
+ 0x4b,  0x65,  0x79,  0x3a,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x62,  0x6f, 
+ 0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20, 
+ 0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x66,  0x6f,  0x63, 
+ 0x75,  0x73,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x78, 
+ 0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x3a,  0x20,  0x30,  0x20,  0x30,  0x20,  0x33,  0x70,  0x78, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x66,  0x6f, 
+ 0x63,  0x75,  0x73,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a, 
+ 0x2e,  0x61,  0x70,  0x69,  0x4b,  0x65,  0x79,  0x20,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x5b,  0x74,  0x79, 
+ 0x70,  0x65,  0x3d,  0x22,  0x74,  0x65,  0x78,  0x74,  0x22,  0x5d,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x66, 
+ 0x6f,  0x6e,  0x74,  0x2d,  0x66,  0x61,  0x6d,  0x69,  0x6c,  0x79,  0x3a,  0x20,  0x41,  0x72,  0x69,  0x61, 
+ 0x6c,  0x2c,  0x20,  0x73,  0x61,  0x6e,  0x73,  0x2d,  0x73,  0x65,  0x72,  0x69,  0x66,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x6d,  0x65,  0x64,  0x69, 
+ 0x75,  0x6d,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77,  0x65,  0x69,  0x67,  0x68, 
+ 0x74,  0x3a,  0x20,  0x35,  0x30,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e, 
+ 0x67,  0x3a,  0x20,  0x35,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72, 
+ 0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28, 
+ 0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32, 
+ 0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x61,  0x70,  0x69,  0x4b,  0x65,  0x79,  0x20,  0x6c,  0x61, 
+ 0x62,  0x65,  0x6c,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a, 
+ 0x20,  0x69,  0x6e,  0x6c,  0x69,  0x6e,  0x65,  0x2d,  0x62,  0x6c,  0x6f,  0x63,  0x6b,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20,  0x61,  0x75,  0x74,  0x6f,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x2d,  0x72,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x35,  0x70, 
+ 0x78,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x74,  0x65,  0x78,  0x74,  0x61,  0x72,  0x65,  0x61,  0x23,  0x61, 
+ 0x70,  0x69,  0x5f,  0x6b,  0x65,  0x79,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69, 
+ 0x6e,  0x67,  0x2d,  0x74,  0x6f,  0x70,  0x3a,  0x20,  0x31,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x6c,  0x65,  0x66,  0x74,  0x3a,  0x20,  0x31,  0x30, 
+ 0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a, 
+ 0x20,  0x6d,  0x65,  0x64,  0x69,  0x75,  0x6d,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65, 
+ 0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72, 
+ 0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d, 
+ 0x32,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x72,  0x65,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x76,  0x65, 
+ 0x72,  0x74,  0x69,  0x63,  0x61,  0x6c,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x74,  0x65,  0x78,  0x74,  0x61, 
+ 0x72,  0x65,  0x61,  0x23,  0x61,  0x70,  0x69,  0x5f,  0x6b,  0x65,  0x79,  0x3a,  0x66,  0x6f,  0x63,  0x75, 
+ 0x73,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70, 
+ 0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f, 
+ 0x72,  0x64,  0x65,  0x72,  0x2d,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x78,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x3a, 
+ 0x20,  0x30,  0x20,  0x30,  0x20,  0x33,  0x70,  0x78,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62, 
+ 0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x2d,  0x73,  0x68,  0x61,  0x64, 
+ 0x6f,  0x77,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x65,  0x6d,  0x62,  0x65,  0x64, 
+ 0x64,  0x65,  0x64,  0x20,  0x74,  0x69,  0x74,  0x6c,  0x65,  0x20,  0x6f,  0x66,  0x20,  0x74,  0x68,  0x65, 
+ 0x20,  0x73,  0x79,  0x73,  0x74,  0x65,  0x6d,  0x20,  0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x20,  0x74, 
+ 0x65,  0x78,  0x74,  0x20,  0x61,  0x72,  0x65,  0x61,  0x20,  0x2a,  0x2f,  0x0a,  0x2e,  0x69,  0x6e,  0x70, 
+ 0x75,  0x74,  0x2d,  0x6c,  0x61,  0x62,  0x65,  0x6c,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x70,  0x6f,  0x73, 
+ 0x69,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x61,  0x62,  0x73,  0x6f,  0x6c,  0x75,  0x74,  0x65,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x74,  0x6f,  0x70,  0x3a,  0x20,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x6c,  0x65,  0x66, 
+ 0x74,  0x3a,  0x20,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76, 
+ 0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63, 
+ 0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x6f, 
+ 0x69,  0x6e,  0x74,  0x65,  0x72,  0x2d,  0x65,  0x76,  0x65,  0x6e,  0x74,  0x73,  0x3a,  0x20,  0x6e,  0x6f, 
+ 0x6e,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x72,  0x61,  0x64, 
+ 0x69,  0x75,  0x73,  0x3a,  0x20,  0x38,  0x70,  0x78,  0x20,  0x38,  0x70,  0x78,  0x20,  0x30,  0x70,  0x78, 
+ 0x20,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x2d, 
+ 0x74,  0x6f,  0x70,  0x3a,  0x20,  0x31,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64, 
+ 0x64,  0x69,  0x6e,  0x67,  0x2d,  0x6c,  0x65,  0x66,  0x74,  0x3a,  0x20,  0x31,  0x33,  0x70,  0x78,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x72,  0x69,  0x67,  0x68,  0x74, 
+ 0x3a,  0x20,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x2d, 
+ 0x74,  0x6f,  0x70,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x72,  0x67, 
+ 0x69,  0x6e,  0x2d,  0x6c,  0x65,  0x66,  0x74,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x2d,  0x72,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x32,  0x30, 
+ 0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x74,  0x72,  0x61,  0x6e,  0x73, 
+ 0x66,  0x6f,  0x72,  0x6d,  0x3a,  0x20,  0x75,  0x70,  0x70,  0x65,  0x72,  0x63,  0x61,  0x73,  0x65,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20, 
+ 0x36,  0x30,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65, 
+ 0x3a,  0x20,  0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67, 
+ 0x72,  0x6f,  0x75,  0x6e,  0x64,  0x3a,  0x20,  0x72,  0x67,  0x62,  0x61,  0x28,  0x32,  0x35,  0x35,  0x2c, 
+ 0x20,  0x32,  0x35,  0x35,  0x2c,  0x20,  0x32,  0x35,  0x35,  0x2c,  0x20,  0x30,  0x2e,  0x35,  0x29,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x64,  0x72,  0x6f,  0x70,  0x2d,  0x66,  0x69,  0x6c,  0x74, 
+ 0x65,  0x72,  0x3a,  0x20,  0x62,  0x6c,  0x75,  0x72,  0x28,  0x31,  0x30,  0x70,  0x78,  0x29,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x2d,  0x77,  0x65,  0x62,  0x6b,  0x69,  0x74,  0x2d,  0x62,  0x61,  0x63,  0x6b,  0x64,  0x72, 
+ 0x6f,  0x70,  0x2d,  0x66,  0x69,  0x6c,  0x74,  0x65,  0x72,  0x3a,  0x20,  0x62,  0x6c,  0x75,  0x72,  0x28, 
+ 0x31,  0x30,  0x70,  0x78,  0x29,  0x3b,  0x20,  0x2f,  0x2a,  0x20,  0x66,  0x6f,  0x72,  0x20,  0x73,  0x61, 
+ 0x66,  0x61,  0x72,  0x69,  0x20,  0x2a,  0x2f,  0x0a,  0x20,  0x20,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a, 
+ 0x20,  0x39,  0x37,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x2f,  0x2a,  0x20,  0x64,  0x69,  0x73,  0x70,  0x6c, 
+ 0x61,  0x79,  0x3a,  0x20,  0x62,  0x6c,  0x6f,  0x63,  0x6b,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x78, 
+ 0x2d,  0x73,  0x69,  0x7a,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d, 
+ 0x62,  0x6f,  0x78,  0x3b,  0x20,  0x2a,  0x2f,  0x0a,  0x7d,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x65,  0x6d, 
+ 0x62,  0x65,  0x64,  0x64,  0x65,  0x64,  0x20,  0x74,  0x69,  0x74,  0x6c,  0x65,  0x20,  0x6f,  0x66,  0x20, 
+ 0x74,  0x68,  0x65,  0x20,  0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x20,  0x73,  0x74,  0x79,  0x6c,  0x65, 
+ 0x20,  0x61,  0x72,  0x65,  0x61,  0x73,  0x20,  0x2a,  0x2f,  0x0a,  0x2e,  0x69,  0x6e,  0x70,  0x75,  0x74, 
+ 0x2d,  0x6c,  0x61,  0x62,  0x65,  0x6c,  0x2d,  0x73,  0x65,  0x63,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x70, 
+ 0x6f,  0x73,  0x69,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x61,  0x62,  0x73,  0x6f,  0x6c,  0x75,  0x74, 
+ 0x65,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x6f,  0x70,  0x3a,  0x20,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x6c, 
+ 0x65,  0x66,  0x74,  0x3a,  0x20,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61, 
+ 0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x29,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x70,  0x6f,  0x69,  0x6e,  0x74,  0x65,  0x72,  0x2d,  0x65,  0x76,  0x65,  0x6e,  0x74,  0x73,  0x3a,  0x20, 
+ 0x6e,  0x6f,  0x6e,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x2d,  0x6c, 
+ 0x65,  0x66,  0x74,  0x3a,  0x20,  0x31,  0x33,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x72, 
+ 0x67,  0x69,  0x6e,  0x2d,  0x74,  0x6f,  0x70,  0x3a,  0x20,  0x31,  0x36,  0x70,  0x78,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x74,  0x72,  0x61,  0x6e,  0x73,  0x66,  0x6f,  0x72,  0x6d,  0x3a, 
+ 0x20,  0x75,  0x70,  0x70,  0x65,  0x72,  0x63,  0x61,  0x73,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f, 
+ 0x6e,  0x74,  0x2d,  0x77,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x36,  0x30,  0x30,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x78,  0x2d,  0x73, 
+ 0x6d,  0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x73,  0x79,  0x73,  0x74, 
+ 0x65,  0x6d,  0x20,  0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x20,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x20, 
+ 0x61,  0x72,  0x65,  0x61,  0x20,  0x2a,  0x2f,  0x0a,  0x74,  0x65,  0x78,  0x74,  0x61,  0x72,  0x65,  0x61, 
+ 0x2e,  0x70,  0x65,  0x72,  0x73,  0x69,  0x73,  0x74,  0x65,  0x6e,  0x74,  0x2d,  0x69,  0x6e,  0x70,  0x75, 
+ 0x74,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x74,  0x6f, 
+ 0x70,  0x3a,  0x20,  0x34,  0x32,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69, 
+ 0x6e,  0x67,  0x2d,  0x6c,  0x65,  0x66,  0x74,  0x3a,  0x20,  0x31,  0x31,  0x70,  0x78,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20,  0x39,  0x37,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x6d, 
+ 0x61,  0x78,  0x2d,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20,  0x39,  0x37,  0x25,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x68,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x35,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x6d,  0x65,  0x64,  0x69, 
+ 0x75,  0x6d,  0x3b,  0x0a,  0x20,  0x20,  0x6f,  0x76,  0x65,  0x72,  0x73,  0x63,  0x72,  0x6f,  0x6c,  0x6c, 
+ 0x2d,  0x62,  0x65,  0x68,  0x61,  0x76,  0x69,  0x6f,  0x72,  0x3a,  0x20,  0x63,  0x6f,  0x6e,  0x74,  0x61, 
+ 0x69,  0x6e,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x73,  0x79,  0x73,  0x74,  0x65,  0x6d, 
+ 0x20,  0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x20,  0x62,  0x6f,  0x78,  0x20,  0x2a,  0x2f,  0x0a,  0x2e, 
+ 0x70,  0x65,  0x72,  0x73,  0x69,  0x73,  0x74,  0x65,  0x6e,  0x74,  0x2d,  0x69,  0x6e,  0x70,  0x75,  0x74, 
+ 0x20,  0x7b,  0x0a,  0x20,  0x20,  0x68,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x61,  0x75,  0x74, 
+ 0x6f,  0x3b,  0x0a,  0x20,  0x20,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20,  0x31,  0x30,  0x30,  0x25, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x78,  0x2d,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20,  0x31, 
+ 0x30,  0x30,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x69,  0x6e,  0x2d,  0x68,  0x65,  0x69,  0x67,  0x68, 
+ 0x74,  0x3a,  0x20,  0x35,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69, 
+ 0x6e,  0x67,  0x3a,  0x20,  0x33,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x72,  0x61,  0x6e,  0x73, 
+ 0x69,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x6d,  0x69,  0x6e,  0x2d,  0x68,  0x65,  0x69,  0x67,  0x68, 
+ 0x74,  0x20,  0x30,  0x2e,  0x33,  0x73,  0x20,  0x65,  0x61,  0x73,  0x65,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a, 
+ 0x2f,  0x2a,  0x20,  0x63,  0x68,  0x61,  0x74,  0x20,  0x68,  0x69,  0x73,  0x74,  0x6f,  0x72,  0x79,  0x20, 
+ 0x62,  0x6f,  0x78,  0x20,  0x2a,  0x2f,  0x0a,  0x2e,  0x70,  0x65,  0x72,  0x73,  0x69,  0x73,  0x74,  0x65, 
+ 0x6e,  0x74,  0x2d,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x3a,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x20,  0x7b, 
+ 0x0a,  0x20,  0x20,  0x68,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x61,  0x75,  0x74,  0x6f,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x6d,  0x69,  0x6e,  0x2d,  0x68,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x31, 
+ 0x35,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20, 
+ 0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d, 
+ 0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x78,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f, 
+ 0x77,  0x3a,  0x20,  0x30,  0x20,  0x30,  0x20,  0x33,  0x70,  0x78,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d, 
+ 0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x2d,  0x73,  0x68, 
+ 0x61,  0x64,  0x6f,  0x77,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x74,  0x65,  0x78,  0x74,  0x61,  0x72, 
+ 0x65,  0x61,  0x2e,  0x70,  0x65,  0x72,  0x73,  0x69,  0x73,  0x74,  0x65,  0x6e,  0x74,  0x2d,  0x69,  0x6e, 
+ 0x70,  0x75,  0x74,  0x3a,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x62,  0x6f, 
+ 0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20, 
+ 0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x66,  0x6f,  0x63, 
+ 0x75,  0x73,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x78, 
+ 0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x3a,  0x20,  0x30,  0x20,  0x30,  0x20,  0x33,  0x70,  0x78, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x66,  0x6f, 
+ 0x63,  0x75,  0x73,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a, 
+ 0x2f,  0x2a,  0x20,  0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x20,  0x73,  0x74,  0x79,  0x6c,  0x65,  0x20, 
+ 0x69,  0x6e,  0x70,  0x75,  0x74,  0x20,  0x61,  0x72,  0x65,  0x61,  0x20,  0x2a,  0x2f,  0x0a,  0x74,  0x65, 
+ 0x78,  0x74,  0x61,  0x72,  0x65,  0x61,  0x2e,  0x70,  0x65,  0x72,  0x73,  0x69,  0x73,  0x74,  0x65,  0x6e, 
+ 0x74,  0x2d,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x2d,  0x73,  0x65,  0x63,  0x20,  0x7b,  0x0a,  0x20,  0x20, 
+ 0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20,  0x39,  0x37,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x61, 
+ 0x78,  0x2d,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20,  0x39,  0x37,  0x25,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x74,  0x6f,  0x70,  0x3a,  0x20,  0x34,  0x32,  0x70, 
+ 0x78,  0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x6c,  0x65,  0x66, 
+ 0x74,  0x3a,  0x20,  0x31,  0x31,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d, 
+ 0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x20,  0x20,  0x62, 
+ 0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x6f,  0x76,  0x65,  0x72,  0x73,  0x63, 
+ 0x72,  0x6f,  0x6c,  0x6c,  0x2d,  0x62,  0x65,  0x68,  0x61,  0x76,  0x69,  0x6f,  0x72,  0x3a,  0x20,  0x63, 
+ 0x6f,  0x6e,  0x74,  0x61,  0x69,  0x6e,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x74,  0x65,  0x78,  0x74,  0x61, 
+ 0x72,  0x65,  0x61,  0x2e,  0x70,  0x65,  0x72,  0x73,  0x69,  0x73,  0x74,  0x65,  0x6e,  0x74,  0x2d,  0x69, 
+ 0x6e,  0x70,  0x75,  0x74,  0x2d,  0x73,  0x65,  0x63,  0x3a,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x20,  0x7b, 
+ 0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73, 
+ 0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65, 
+ 0x72,  0x2d,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x62,  0x6f,  0x78,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x3a,  0x20,  0x30,  0x20, 
+ 0x30,  0x20,  0x33,  0x70,  0x78,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64, 
+ 0x65,  0x72,  0x2d,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x29, 
+ 0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x63,  0x68,  0x61,  0x74,  0x20,  0x68,  0x69,  0x73, 
+ 0x74,  0x6f,  0x72,  0x79,  0x20,  0x62,  0x6f,  0x78,  0x20,  0x2a,  0x2f,  0x0a,  0x2e,  0x70,  0x65,  0x72, 
+ 0x73,  0x69,  0x73,  0x74,  0x65,  0x6e,  0x74,  0x2d,  0x69,  0x6e,  0x70,  0x75,  0x74,  0x2d,  0x73,  0x65, 
+ 0x63,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x68,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x61,  0x75, 
+ 0x74,  0x6f,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x69,  0x6e,  0x2d,  0x68,  0x65,  0x69,  0x67,  0x68,  0x74, 
+ 0x3a,  0x20,  0x31,  0x35,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x69,  0x6d,  0x67,  0x20, 
+ 0x7b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x72,  0x61,  0x64,  0x69,  0x75, 
+ 0x73,  0x3a,  0x20,  0x38,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x64,  0x69,  0x73,  0x70,  0x6c,  0x61, 
+ 0x79,  0x3a,  0x20,  0x62,  0x6c,  0x6f,  0x63,  0x6b,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x72,  0x67, 
+ 0x69,  0x6e,  0x2d,  0x6c,  0x65,  0x66,  0x74,  0x3a,  0x20,  0x61,  0x75,  0x74,  0x6f,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x2d,  0x72,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x61, 
+ 0x75,  0x74,  0x6f,  0x3b,  0x0a,  0x20,  0x20,  0x77,  0x69,  0x64,  0x74,  0x68,  0x3a,  0x20,  0x35,  0x30, 
+ 0x25,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x63,  0x6f,  0x64,  0x65,  0x20,  0x61,  0x72, 
+ 0x65,  0x61,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x20,  0x2a,  0x2f, 
+ 0x0a,  0x70,  0x72,  0x65,  0x20,  0x63,  0x6f,  0x64,  0x65,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x64,  0x69, 
+ 0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x62,  0x6c,  0x6f,  0x63,  0x6b,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x63,  0x6f,  0x64,  0x65,  0x2d,  0x62,  0x61,  0x63, 
+ 0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x63, 
+ 0x6f,  0x64,  0x65,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x30,  0x2e,  0x32,  0x65, 
+ 0x6d,  0x20,  0x30,  0x2e,  0x32,  0x65,  0x6d,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65, 
+ 0x72,  0x2d,  0x72,  0x61,  0x64,  0x69,  0x75,  0x73,  0x3a,  0x20,  0x35,  0x70,  0x78,  0x3b,  0x0a,  0x7d, 
+ 0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x63,  0x6f,  0x64,  0x65,  0x20,  0x61,  0x72,  0x65,  0x61,  0x20,  0x74, 
+ 0x65,  0x78,  0x74,  0x20,  0x2a,  0x2f,  0x0a,  0x63,  0x6f,  0x64,  0x65,  0x20,  0x7b,  0x0a,  0x20,  0x20, 
+ 0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x66,  0x61,  0x6d,  0x69,  0x6c,  0x79,  0x3a,  0x20,  0x6d,  0x6f,  0x6e, 
+ 0x6f,  0x73,  0x70,  0x61,  0x63,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77, 
+ 0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x62,  0x6f,  0x6c,  0x64,  0x3b,  0x0a,  0x20,  0x20,  0x70, 
+ 0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x30,  0x2e,  0x31,  0x65,  0x6d,  0x20,  0x30,  0x2e, 
+ 0x33,  0x65,  0x6d,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x72,  0x61, 
+ 0x64,  0x69,  0x75,  0x73,  0x3a,  0x20,  0x35,  0x70,  0x78,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x66,  0x69, 
+ 0x65,  0x6c,  0x64,  0x73,  0x65,  0x74,  0x20,  0x6c,  0x61,  0x62,  0x65,  0x6c,  0x20,  0x7b,  0x0a,  0x20, 
+ 0x20,  0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x3a,  0x20,  0x30,  0x2e,  0x35,  0x65,  0x6d,  0x20,  0x30, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x62,  0x6c,  0x6f, 
+ 0x63,  0x6b,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x66,  0x69,  0x65,  0x6c,  0x64,  0x73,  0x65,  0x74,  0x20, 
+ 0x6c,  0x61,  0x62,  0x65,  0x6c,  0x2e,  0x73,  0x6c,  0x69,  0x6d,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x6d, 
+ 0x61,  0x72,  0x67,  0x69,  0x6e,  0x3a,  0x20,  0x30,  0x20,  0x30,  0x2e,  0x35,  0x65,  0x6d,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x69,  0x6e,  0x6c,  0x69,  0x6e, 
+ 0x65,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x68,  0x65,  0x61,  0x64,  0x65,  0x72,  0x20,  0x7b,  0x0a,  0x20, 
+ 0x20,  0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x66,  0x6c,  0x65,  0x78,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x6a,  0x75,  0x73,  0x74,  0x69,  0x66,  0x79,  0x2d,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e, 
+ 0x74,  0x3a,  0x20,  0x73,  0x70,  0x61,  0x63,  0x65,  0x2d,  0x62,  0x65,  0x74,  0x77,  0x65,  0x65,  0x6e, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x61,  0x6c,  0x69,  0x67,  0x6e,  0x2d,  0x69,  0x74,  0x65,  0x6d,  0x73,  0x3a, 
+ 0x20,  0x63,  0x65,  0x6e,  0x74,  0x65,  0x72,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78,  0x74,  0x2d, 
+ 0x61,  0x6c,  0x69,  0x67,  0x6e,  0x3a,  0x20,  0x63,  0x65,  0x6e,  0x74,  0x65,  0x72,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x6c,  0x65,  0x66,  0x74,  0x3a,  0x20,  0x31, 
+ 0x35,  0x70,  0x78,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x67,  0x65,  0x6e,  0x65,  0x72,  0x61,  0x74, 
+ 0x69,  0x6f,  0x6e,  0x2d,  0x73,  0x74,  0x61,  0x74,  0x69,  0x73,  0x74,  0x69,  0x63,  0x73,  0x3a,  0x68, 
+ 0x6f,  0x76,  0x65,  0x72,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20, 
+ 0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e, 
+ 0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x63, 
+ 0x75,  0x72,  0x73,  0x6f,  0x72,  0x3a,  0x20,  0x64,  0x65,  0x66,  0x61,  0x75,  0x6c,  0x74,  0x3b,  0x0a, 
+ 0x7d,  0x0a,  0x0a,  0x66,  0x6f,  0x6f,  0x74,  0x65,  0x72,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x66,  0x6f, 
+ 0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x38,  0x30,  0x25,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x61,  0x63, 
+ 0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x29, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x61,  0x6c,  0x69,  0x67,  0x6e,  0x3a,  0x20, 
+ 0x63,  0x65,  0x6e,  0x74,  0x65,  0x72,  0x3b,  0x0a,  0x20,  0x20,  0x63,  0x75,  0x72,  0x73,  0x6f,  0x72, 
+ 0x3a,  0x20,  0x64,  0x65,  0x66,  0x61,  0x75,  0x6c,  0x74,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x66,  0x6f, 
+ 0x6f,  0x74,  0x65,  0x72,  0x20,  0x61,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75, 
+ 0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x29,  0x3b,  0x20,  0x2f,  0x2a,  0x20, 
+ 0x43,  0x6f,  0x6c,  0x6f,  0x72,  0x20,  0x6f,  0x66,  0x20,  0x74,  0x68,  0x65,  0x20,  0x6c,  0x69,  0x6e, 
+ 0x6b,  0x20,  0x2a,  0x2f,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x64,  0x65,  0x63,  0x6f, 
+ 0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x6e,  0x6f,  0x6e,  0x65,  0x3b,  0x20,  0x2f,  0x2a, 
+ 0x20,  0x4e,  0x6f,  0x20,  0x75,  0x6e,  0x64,  0x65,  0x72,  0x6c,  0x69,  0x6e,  0x69,  0x6e,  0x67,  0x20, 
+ 0x2a,  0x2f,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77,  0x65,  0x69,  0x67,  0x68,  0x74, 
+ 0x3a,  0x20,  0x62,  0x6f,  0x6c,  0x64,  0x3b,  0x20,  0x2f,  0x2a,  0x20,  0x42,  0x6f,  0x6c,  0x64,  0x20, 
+ 0x70,  0x72,  0x69,  0x6e,  0x74,  0x20,  0x2a,  0x2f,  0x0a,  0x7d,  0x0a,  0x0a,  0x66,  0x6f,  0x6f,  0x74, 
+ 0x65,  0x72,  0x20,  0x61,  0x3a,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d, 
+ 0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34, 
+ 0x29,  0x3b,  0x20,  0x2f,  0x2a,  0x20,  0x43,  0x6f,  0x6c,  0x6f,  0x72,  0x20,  0x6f,  0x66,  0x20,  0x74, 
+ 0x68,  0x65,  0x20,  0x6c,  0x69,  0x6e,  0x6b,  0x20,  0x77,  0x68,  0x65,  0x6e,  0x20,  0x68,  0x6f,  0x76, 
+ 0x65,  0x72,  0x69,  0x6e,  0x67,  0x20,  0x2a,  0x2f,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78,  0x74,  0x2d, 
+ 0x64,  0x65,  0x63,  0x6f,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x75,  0x6e,  0x64,  0x65, 
+ 0x72,  0x6c,  0x69,  0x6e,  0x65,  0x3b,  0x20,  0x2f,  0x2a,  0x20,  0x55,  0x6e,  0x64,  0x65,  0x72,  0x6c, 
+ 0x69,  0x6e,  0x69,  0x6e,  0x67,  0x20,  0x77,  0x68,  0x65,  0x6e,  0x20,  0x68,  0x6f,  0x76,  0x65,  0x72, 
+ 0x69,  0x6e,  0x67,  0x20,  0x2a,  0x2f,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x6d,  0x6f,  0x64,  0x65,  0x2d, 
+ 0x63,  0x68,  0x61,  0x74,  0x20,  0x74,  0x65,  0x78,  0x74,  0x61,  0x72,  0x65,  0x61,  0x5b,  0x6e,  0x61, 
+ 0x6d,  0x65,  0x3d,  0x70,  0x72,  0x6f,  0x6d,  0x70,  0x74,  0x5d,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x68, 
+ 0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x38,  0x2e,  0x35,  0x65,  0x6d,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69, 
+ 0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x6d,  0x6f, 
+ 0x64,  0x65,  0x2d,  0x63,  0x6f,  0x6d,  0x70,  0x6c,  0x65,  0x74,  0x69,  0x6f,  0x6e,  0x20,  0x74,  0x65, 
+ 0x78,  0x74,  0x61,  0x72,  0x65,  0x61,  0x5b,  0x6e,  0x61,  0x6d,  0x65,  0x3d,  0x70,  0x72,  0x6f,  0x6d, 
+ 0x70,  0x74,  0x5d,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x68,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20, 
+ 0x33,  0x30,  0x65,  0x6d,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20, 
+ 0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d, 
+ 0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x29, 
+ 0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x40,  0x6b,  0x65,  0x79,  0x66,  0x72,  0x61,  0x6d,  0x65,  0x73,  0x20, 
+ 0x6c,  0x6f,  0x61,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x62,  0x67,  0x2d,  0x77,  0x69,  0x70,  0x65,  0x20, 
+ 0x7b,  0x0a,  0x20,  0x20,  0x30,  0x25,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x62,  0x61,  0x63, 
+ 0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x70,  0x6f,  0x73,  0x69,  0x74,  0x69,  0x6f,  0x6e, 
+ 0x3a,  0x20,  0x30,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x7d,  0x0a,  0x20,  0x20,  0x31,  0x30,  0x30,  0x25, 
+ 0x20,  0x7b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e, 
+ 0x64,  0x2d,  0x70,  0x6f,  0x73,  0x69,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x31,  0x30,  0x30,  0x25, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x7d,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x6c,  0x6f,  0x61,  0x64,  0x69,  0x6e, 
+ 0x67,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64, 
+ 0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x35,  0x30,  0x25,  0x20,  0x31,  0x30,  0x30,  0x25,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x69,  0x6d, 
+ 0x61,  0x67,  0x65,  0x3a,  0x20,  0x6c,  0x69,  0x6e,  0x65,  0x61,  0x72,  0x2d,  0x67,  0x72,  0x61,  0x64, 
+ 0x69,  0x65,  0x6e,  0x74,  0x28,  0x39,  0x30,  0x64,  0x65,  0x67,  0x2c,  0x20,  0x76,  0x61,  0x72,  0x28, 
+ 0x2d,  0x2d,  0x6c,  0x6f,  0x61,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d, 
+ 0x31,  0x29,  0x2c,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x6c,  0x6f,  0x61,  0x64,  0x69,  0x6e, 
+ 0x67,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29,  0x2c,  0x20,  0x76,  0x61,  0x72,  0x28, 
+ 0x2d,  0x2d,  0x6c,  0x6f,  0x61,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d, 
+ 0x31,  0x29,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x61,  0x6e,  0x69,  0x6d,  0x61,  0x74,  0x69,  0x6f,  0x6e, 
+ 0x3a,  0x20,  0x6c,  0x6f,  0x61,  0x64,  0x69,  0x6e,  0x67,  0x2d,  0x62,  0x67,  0x2d,  0x77,  0x69,  0x70, 
+ 0x65,  0x20,  0x32,  0x73,  0x20,  0x6c,  0x69,  0x6e,  0x65,  0x61,  0x72,  0x20,  0x69,  0x6e,  0x66,  0x69, 
+ 0x6e,  0x69,  0x74,  0x65,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x64,  0x72,  0x6f,  0x70,  0x62,  0x74, 
+ 0x6e,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72, 
+ 0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72, 
+ 0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b, 
+ 0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61, 
+ 0x72,  0x28,  0x2d,  0x2d,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65, 
+ 0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72, 
+ 0x28,  0x2d,  0x2d,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x72,  0x61,  0x6e,  0x73,  0x69, 
+ 0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x20,  0x30,  0x2e,  0x31,  0x73,  0x3b,  0x0a,  0x20,  0x20,  0x62, 
+ 0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x72,  0x61,  0x64,  0x69,  0x75,  0x73,  0x3a,  0x20,  0x34,  0x70, 
+ 0x78,  0x20,  0x34,  0x70,  0x78,  0x20,  0x30,  0x70,  0x78,  0x20,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x78,  0x2d,  0x73,  0x6d, 
+ 0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77,  0x65,  0x69,  0x67, 
+ 0x68,  0x74,  0x3a,  0x20,  0x36,  0x30,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78,  0x74,  0x2d, 
+ 0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x3a,  0x20,  0x30,  0x70,  0x78,  0x20,  0x30,  0x70,  0x78,  0x20, 
+ 0x32,  0x70,  0x78,  0x20,  0x23,  0x39,  0x39,  0x39,  0x39,  0x39,  0x39,  0x39,  0x30,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x61,  0x6c,  0x69,  0x67,  0x6e,  0x3a,  0x20,  0x63,  0x65,  0x6e, 
+ 0x74,  0x65,  0x72,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x64,  0x65,  0x63,  0x6f, 
+ 0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x6e,  0x6f,  0x6e,  0x65,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x3a,  0x20,  0x34,  0x70,  0x78,  0x20,  0x32,  0x70,  0x78,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x35,  0x70,  0x78,  0x20, 
+ 0x32,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a, 
+ 0x20,  0x69,  0x6e,  0x6c,  0x69,  0x6e,  0x65,  0x2d,  0x62,  0x6c,  0x6f,  0x63,  0x6b,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x63,  0x75,  0x72,  0x73,  0x6f,  0x72,  0x3a,  0x20,  0x70,  0x6f,  0x69,  0x6e,  0x74,  0x65,  0x72, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x74,  0x6f,  0x70,  0x3a,  0x20,  0x30,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e, 
+ 0x64,  0x72,  0x6f,  0x70,  0x62,  0x74,  0x6e,  0x20,  0x73,  0x76,  0x67,  0x20,  0x7b,  0x0a,  0x20,  0x20, 
+ 0x76,  0x65,  0x72,  0x74,  0x69,  0x63,  0x61,  0x6c,  0x2d,  0x61,  0x6c,  0x69,  0x67,  0x6e,  0x3a,  0x20, 
+ 0x6d,  0x69,  0x64,  0x64,  0x6c,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e, 
+ 0x2d,  0x72,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x73, 
+ 0x74,  0x72,  0x6f,  0x6b,  0x65,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74, 
+ 0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x64,  0x72,  0x6f,  0x70,  0x62,  0x74,  0x6e,  0x3a, 
+ 0x68,  0x6f,  0x76,  0x65,  0x72,  0x20,  0x73,  0x76,  0x67,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x76,  0x65, 
+ 0x72,  0x74,  0x69,  0x63,  0x61,  0x6c,  0x2d,  0x61,  0x6c,  0x69,  0x67,  0x6e,  0x3a,  0x20,  0x6d,  0x69, 
+ 0x64,  0x64,  0x6c,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x2d,  0x72, 
+ 0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x73,  0x74,  0x72, 
+ 0x6f,  0x6b,  0x65,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f, 
+ 0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x29,  0x3b, 
+ 0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x64,  0x72,  0x6f,  0x70,  0x62,  0x74,  0x6e,  0x3a,  0x66,  0x6f,  0x63, 
+ 0x75,  0x73,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x6f,  0x75,  0x74,  0x6c,  0x69,  0x6e,  0x65,  0x3a,  0x20, 
+ 0x6e,  0x6f,  0x6e,  0x65,  0x3b,  0x20,  0x2f,  0x2a,  0x20,  0x52,  0x65,  0x6d,  0x6f,  0x76,  0x65,  0x73, 
+ 0x20,  0x74,  0x68,  0x65,  0x20,  0x62,  0x6c,  0x75,  0x65,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72, 
+ 0x20,  0x74,  0x68,  0x61,  0x74,  0x20,  0x61,  0x70,  0x70,  0x65,  0x61,  0x72,  0x73,  0x20,  0x77,  0x68, 
+ 0x65,  0x6e,  0x20,  0x74,  0x68,  0x65,  0x20,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x20,  0x69,  0x73, 
+ 0x20,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x65,  0x64,  0x20,  0x2a,  0x2f,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e, 
+ 0x64,  0x72,  0x6f,  0x70,  0x64,  0x6f,  0x77,  0x6e,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x70,  0x6f,  0x73, 
+ 0x69,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x72,  0x65,  0x6c,  0x61,  0x74,  0x69,  0x76,  0x65,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x69,  0x6e,  0x6c,  0x69, 
+ 0x6e,  0x65,  0x2d,  0x62,  0x6c,  0x6f,  0x63,  0x6b,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x64,  0x72, 
+ 0x6f,  0x70,  0x64,  0x6f,  0x77,  0x6e,  0x2d,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x20,  0x7b, 
+ 0x0a,  0x20,  0x20,  0x2f,  0x2a,  0x20,  0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x6e, 
+ 0x6f,  0x6e,  0x65,  0x3b,  0x20,  0x2a,  0x2f,  0x0a,  0x20,  0x20,  0x70,  0x6f,  0x73,  0x69,  0x74,  0x69, 
+ 0x6f,  0x6e,  0x3a,  0x20,  0x61,  0x62,  0x73,  0x6f,  0x6c,  0x75,  0x74,  0x65,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x72,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78,  0x74, 
+ 0x2d,  0x61,  0x6c,  0x69,  0x67,  0x6e,  0x3a,  0x20,  0x65,  0x6e,  0x64,  0x3b,  0x0a,  0x20,  0x20,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74, 
+ 0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e, 
+ 0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74, 
+ 0x65,  0x78,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x73,  0x75,  0x62,  0x74,  0x69,  0x6c, 
+ 0x65,  0x2d,  0x32,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x72, 
+ 0x61,  0x64,  0x69,  0x75,  0x73,  0x3a,  0x20,  0x34,  0x70,  0x78,  0x20,  0x34,  0x70,  0x78,  0x20,  0x34, 
+ 0x70,  0x78,  0x20,  0x34,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x6d,  0x69,  0x6e,  0x2d,  0x77,  0x69, 
+ 0x64,  0x74,  0x68,  0x3a,  0x20,  0x31,  0x36,  0x30,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f, 
+ 0x78,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x3a,  0x20,  0x30,  0x70,  0x78,  0x20,  0x38,  0x70, 
+ 0x78,  0x20,  0x31,  0x36,  0x70,  0x78,  0x20,  0x30,  0x70,  0x78,  0x20,  0x72,  0x67,  0x62,  0x61,  0x28, 
+ 0x30,  0x2c,  0x30,  0x2c,  0x30,  0x2c,  0x30,  0x2e,  0x32,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x7a,  0x2d, 
+ 0x69,  0x6e,  0x64,  0x65,  0x78,  0x3a,  0x20,  0x31,  0x3b,  0x0a,  0x20,  0x20,  0x2f,  0x2a,  0x20,  0x56, 
+ 0x65,  0x72,  0x73,  0x74,  0x65,  0x63,  0x6b,  0x65,  0x20,  0x64,  0x65,  0x6e,  0x20,  0x49,  0x6e,  0x68, 
+ 0x61,  0x6c,  0x74,  0x20,  0x73,  0x6f,  0x66,  0x6f,  0x72,  0x74,  0x20,  0x2a,  0x2f,  0x0a,  0x20,  0x20, 
+ 0x6f,  0x70,  0x61,  0x63,  0x69,  0x74,  0x79,  0x3a,  0x20,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x76,  0x69, 
+ 0x73,  0x69,  0x62,  0x69,  0x6c,  0x69,  0x74,  0x79,  0x3a,  0x20,  0x68,  0x69,  0x64,  0x64,  0x65,  0x6e, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x2f,  0x2a,  0x20,  0xc3,  0xbc,  0x62,  0x65,  0x72,  0x67,  0x61,  0x6e,  0x67, 
+ 0x73,  0x76,  0x65,  0x72,  0x7a,  0xc3,  0xb6,  0x67,  0x65,  0x72,  0x75,  0x6e,  0x67,  0x20,  0x66,  0xc3, 
+ 0xbc,  0x72,  0x20,  0x64,  0x61,  0x73,  0x20,  0x56,  0x65,  0x72,  0x73,  0x63,  0x68,  0x77,  0x69,  0x6e, 
+ 0x64,  0x65,  0x6e,  0x20,  0x2a,  0x2f,  0x0a,  0x20,  0x20,  0x74,  0x72,  0x61,  0x6e,  0x73,  0x69,  0x74, 
+ 0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x76,  0x69,  0x73,  0x69,  0x62,  0x69,  0x6c,  0x69,  0x74,  0x79,  0x20, 
+ 0x30,  0x2e,  0x34,  0x73,  0x20,  0x6c,  0x69,  0x6e,  0x65,  0x61,  0x72,  0x20,  0x30,  0x73,  0x2c,  0x20, 
+ 0x6f,  0x70,  0x61,  0x63,  0x69,  0x74,  0x79,  0x20,  0x30,  0x2e,  0x32,  0x73,  0x20,  0x65,  0x61,  0x73, 
+ 0x65,  0x2d,  0x69,  0x6e,  0x2d,  0x6f,  0x75,  0x74,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x72,  0x61,  0x6e, 
+ 0x73,  0x69,  0x74,  0x69,  0x6f,  0x6e,  0x2d,  0x64,  0x65,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x30,  0x2e, 
+ 0x32,  0x73,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x23,  0x64,  0x72,  0x6f,  0x70,  0x64,  0x6f,  0x77,  0x6e, 
+ 0x2d,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x20,  0x7b,  0x74,  0x72,  0x61,  0x6e,  0x73,  0x69, 
+ 0x74,  0x69,  0x6f,  0x6e,  0x2d,  0x74,  0x69,  0x6d,  0x69,  0x6e,  0x67,  0x2d,  0x66,  0x75,  0x6e,  0x63, 
+ 0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x65,  0x61,  0x73,  0x65,  0x3b,  0x7d,  0x0a,  0x0a,  0x2e,  0x64, 
+ 0x72,  0x6f,  0x70,  0x64,  0x6f,  0x77,  0x6e,  0x2d,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x3a, 
+ 0x68,  0x6f,  0x76,  0x65,  0x72,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72, 
+ 0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28, 
+ 0x2d,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x73,  0x75,  0x62, 
+ 0x74,  0x69,  0x6c,  0x65,  0x2d,  0x32,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x64,  0x72,  0x6f, 
+ 0x70,  0x64,  0x6f,  0x77,  0x6e,  0x2d,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x20,  0x61,  0x20, 
+ 0x7b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d, 
+ 0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x31,  0x32,  0x70, 
+ 0x78,  0x20,  0x31,  0x36,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72, 
+ 0x2d,  0x72,  0x61,  0x64,  0x69,  0x75,  0x73,  0x3a,  0x20,  0x34,  0x70,  0x78,  0x20,  0x34,  0x70,  0x78, 
+ 0x20,  0x34,  0x70,  0x78,  0x20,  0x34,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x65,  0x78,  0x74, 
+ 0x2d,  0x64,  0x65,  0x63,  0x6f,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x6e,  0x6f,  0x6e, 
+ 0x65,  0x3b,  0x0a,  0x20,  0x20,  0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x62,  0x6c, 
+ 0x6f,  0x63,  0x6b,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e, 
+ 0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74, 
+ 0x65,  0x78,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x73,  0x75,  0x62,  0x74,  0x69,  0x6c, 
+ 0x65,  0x2d,  0x32,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x64,  0x72,  0x6f,  0x70,  0x64,  0x6f, 
+ 0x77,  0x6e,  0x2d,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x20,  0x61,  0x3a,  0x68,  0x6f,  0x76, 
+ 0x65,  0x72,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61, 
+ 0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x2d,  0x32,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e, 
+ 0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74, 
+ 0x65,  0x78,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x73,  0x75,  0x62,  0x74,  0x69,  0x6c, 
+ 0x65,  0x2d,  0x31,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77,  0x65,  0x69, 
+ 0x67,  0x68,  0x74,  0x3a,  0x20,  0x36,  0x30,  0x30,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x64,  0x72, 
+ 0x6f,  0x70,  0x64,  0x6f,  0x77,  0x6e,  0x3a,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x20,  0x2e,  0x64,  0x72, 
+ 0x6f,  0x70,  0x64,  0x6f,  0x77,  0x6e,  0x2d,  0x63,  0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x20,  0x7b, 
+ 0x0a,  0x20,  0x20,  0x2f,  0x2a,  0x20,  0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x62, 
+ 0x6c,  0x6f,  0x63,  0x6b,  0x3b,  0x20,  0x2a,  0x2f,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65, 
+ 0x72,  0x2d,  0x72,  0x61,  0x64,  0x69,  0x75,  0x73,  0x3a,  0x20,  0x34,  0x70,  0x78,  0x20,  0x34,  0x70, 
+ 0x78,  0x20,  0x34,  0x70,  0x78,  0x20,  0x34,  0x70,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x2f,  0x2a,  0x20, 
+ 0xc3,  0x9c,  0x62,  0x65,  0x72,  0x67,  0x61,  0x6e,  0x67,  0x20,  0x6f,  0x68,  0x6e,  0x65,  0x20,  0x56, 
+ 0x65,  0x72,  0x7a,  0xc3,  0xb6,  0x67,  0x65,  0x72,  0x75,  0x6e,  0x67,  0x20,  0x66,  0xc3,  0xbc,  0x72, 
+ 0x20,  0x64,  0x61,  0x73,  0x20,  0x45,  0x72,  0x73,  0x63,  0x68,  0x65,  0x69,  0x6e,  0x65,  0x6e,  0x20, 
+ 0x2a,  0x2f,  0x0a,  0x20,  0x20,  0x6f,  0x70,  0x61,  0x63,  0x69,  0x74,  0x79,  0x3a,  0x20,  0x31,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x76,  0x69,  0x73,  0x69,  0x62,  0x69,  0x6c,  0x69,  0x74,  0x79,  0x3a,  0x20,  0x76, 
+ 0x69,  0x73,  0x69,  0x62,  0x6c,  0x65,  0x3b,  0x0a,  0x20,  0x20,  0x74,  0x72,  0x61,  0x6e,  0x73,  0x69, 
+ 0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x76,  0x69,  0x73,  0x69,  0x62,  0x69,  0x6c,  0x69,  0x74,  0x79, 
+ 0x20,  0x30,  0x73,  0x20,  0x6c,  0x69,  0x6e,  0x65,  0x61,  0x72,  0x20,  0x30,  0x73,  0x2c,  0x20,  0x6f, 
+ 0x70,  0x61,  0x63,  0x69,  0x74,  0x79,  0x20,  0x30,  0x2e,  0x31,  0x73,  0x20,  0x6c,  0x69,  0x6e,  0x65, 
+ 0x61,  0x72,  0x2c,  0x20,  0x68,  0x65,  0x69,  0x67,  0x68,  0x74,  0x20,  0x31,  0x73,  0x3b,  0x0a,  0x7d, 
+ 0x0a,  0x0a,  0x2e,  0x64,  0x72,  0x6f,  0x70,  0x64,  0x6f,  0x77,  0x6e,  0x3a,  0x68,  0x6f,  0x76,  0x65, 
+ 0x72,  0x20,  0x2e,  0x64,  0x72,  0x6f,  0x70,  0x62,  0x74,  0x6e,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74, 
+ 0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x29, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74, 
+ 0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78, 
+ 0x20,  0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74, 
+ 0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64, 
+ 0x65,  0x72,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65, 
+ 0x3a,  0x20,  0x78,  0x2d,  0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e, 
+ 0x74,  0x2d,  0x77,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20,  0x36,  0x30,  0x30,  0x3b,  0x0a,  0x20, 
+ 0x20,  0x73,  0x74,  0x72,  0x6f,  0x6b,  0x65,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62, 
+ 0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65, 
+ 0x78,  0x74,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2e,  0x64,  0x72,  0x6f,  0x70,  0x64,  0x6f,  0x77, 
+ 0x6e,  0x3a,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x20,  0x2e,  0x64,  0x72,  0x6f,  0x70,  0x62,  0x74,  0x6e, 
+ 0x20,  0x73,  0x76,  0x67,  0x7b,  0x0a,  0x20,  0x20,  0x73,  0x74,  0x72,  0x6f,  0x6b,  0x65,  0x3a,  0x20, 
+ 0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69, 
+ 0x6d,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x29,  0x3b,  0x0a,  0x7d,  0x0a,  0x0a,  0x2f, 
+ 0x2a,  0x20,  0x2e,  0x64,  0x72,  0x6f,  0x70,  0x64,  0x6f,  0x77,  0x6e,  0x3a,  0x61,  0x63,  0x74,  0x69, 
+ 0x76,  0x65,  0x20,  0x2e,  0x64,  0x72,  0x6f,  0x70,  0x62,  0x74,  0x6e,  0x20,  0x7b,  0x0a,  0x20,  0x20, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74, 
+ 0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74, 
+ 0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b, 
+ 0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61, 
+ 0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61, 
+ 0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x29, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20, 
+ 0x73,  0x6f,  0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74, 
+ 0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65, 
+ 0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e, 
+ 0x74,  0x2d,  0x73,  0x69,  0x7a,  0x65,  0x3a,  0x20,  0x78,  0x2d,  0x73,  0x6d,  0x61,  0x6c,  0x6c,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x66,  0x6f,  0x6e,  0x74,  0x2d,  0x77,  0x65,  0x69,  0x67,  0x68,  0x74,  0x3a,  0x20, 
+ 0x36,  0x30,  0x30,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e, 
+ 0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x62,  0x61, 
+ 0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34, 
+ 0x29,  0x3b,  0x0a,  0x7d,  0x20,  0x2a,  0x2f,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x2e,  0x6f,  0x6d,  0x6e, 
+ 0x69,  0x20,  0x7b,  0x0a,  0x20,  0x20,  0x64,  0x69,  0x73,  0x70,  0x6c,  0x61,  0x79,  0x3a,  0x20,  0x66, 
+ 0x6c,  0x65,  0x78,  0x3b,  0x0a,  0x20,  0x20,  0x6a,  0x75,  0x73,  0x74,  0x69,  0x66,  0x79,  0x2d,  0x63, 
+ 0x6f,  0x6e,  0x74,  0x65,  0x6e,  0x74,  0x3a,  0x20,  0x73,  0x70,  0x61,  0x63,  0x65,  0x2d,  0x62,  0x65, 
+ 0x74,  0x77,  0x65,  0x65,  0x6e,  0x3b,  0x0a,  0x20,  0x20,  0x61,  0x6c,  0x69,  0x67,  0x6e,  0x2d,  0x69, 
+ 0x74,  0x65,  0x6d,  0x73,  0x3a,  0x20,  0x63,  0x65,  0x6e,  0x74,  0x65,  0x72,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x70,  0x61,  0x64,  0x64,  0x69,  0x6e,  0x67,  0x3a,  0x20,  0x30,  0x2e,  0x35,  0x65,  0x6d,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x31,  0x70,  0x78,  0x20,  0x73,  0x6f, 
+ 0x6c,  0x69,  0x64,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x62,  0x6f,  0x72, 
+ 0x64,  0x65,  0x72,  0x2d,  0x72,  0x61,  0x64,  0x69,  0x75,  0x73,  0x3a,  0x20,  0x35,  0x70,  0x78,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x6d,  0x61,  0x72,  0x67,  0x69,  0x6e,  0x3a,  0x20,  0x30,  0x2e,  0x35,  0x65,  0x6d, 
+ 0x20,  0x30,  0x3b,  0x0a,  0x7d,  0x20,  0x2a,  0x2f,  0x0a, 
+};
+unsigned int style_css_len = 20073;
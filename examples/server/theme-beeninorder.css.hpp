@@ -0,0 +1,448 @@
+unsigned char theme_beeninorder_css[] = {
+ 0x2f,  0x2a,  0x20,  0x41,  0x75,  0x74,  0x68,  0x6f,  0x72,  0x3a,  0x20,  0x59,  0x61,  0x7a,  0x61,  0x6e, 
+ 0x20,  0x41,  0x67,  0x68,  0x61,  0x2d,  0x53,  0x63,  0x68,  0x72,  0x61,  0x64,  0x65,  0x72,  0x20,  0x2a, 
+ 0x2f,  0x0a,  0x2f,  0x2a,  0x20,  0x49,  0x6e,  0x73,  0x70,  0x69,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e, 
+ 0x20,  0x77,  0x61,  0x73,  0x20,  0x61,  0x20,  0x62,  0x61,  0x74,  0x6d,  0x61,  0x6e,  0x20,  0x77,  0x61, 
+ 0x6c,  0x6c,  0x70,  0x61,  0x70,  0x65,  0x72,  0x20,  0x74,  0x68,  0x61,  0x74,  0x20,  0x69,  0x20,  0x68, 
+ 0x61,  0x76,  0x65,  0x20,  0x6f,  0x6e,  0x20,  0x6d,  0x79,  0x20,  0x70,  0x68,  0x6f,  0x6e,  0x65,  0x20, 
+ 0x2a,  0x2f,  0x0a,  0x0a,  0x2e,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x62,  0x65,  0x65,  0x6e,  0x69, 
+ 0x6e,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x20,  0x7b,  0x0a,  0x0a,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d, 
+ 0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x3a,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x30,  0x32,  0x2c,  0x20,  0x31,  0x31,  0x25,  0x2c,  0x20, 
+ 0x31,  0x39,  0x25,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x68,  0x73, 
+ 0x6c,  0x28,  0x32,  0x30,  0x32,  0x2c,  0x20,  0x31,  0x31,  0x25,  0x2c,  0x20,  0x32,  0x33,  0x25,  0x29, 
+ 0x3b,  0x0a,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x33,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x30, 
+ 0x31,  0x2c,  0x20,  0x31,  0x31,  0x25,  0x2c,  0x20,  0x32,  0x38,  0x25,  0x29,  0x3b,  0x0a,  0x2d,  0x2d, 
+ 0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x3a, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x30,  0x31,  0x2c,  0x20,  0x31, 
+ 0x31,  0x25,  0x2c,  0x20,  0x34,  0x30,  0x25,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x73,  0x65,  0x63, 
+ 0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x3a,  0x20, 
+ 0x20,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x30,  0x31,  0x2c,  0x20,  0x31,  0x31,  0x25,  0x2c, 
+ 0x20,  0x38,  0x30,  0x25,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61, 
+ 0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x68, 
+ 0x73,  0x6c,  0x28,  0x32,  0x30,  0x31,  0x2c,  0x20,  0x31,  0x31,  0x25,  0x2c,  0x20,  0x37,  0x34,  0x25, 
+ 0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32, 
+ 0x30,  0x31,  0x2c,  0x20,  0x31,  0x31,  0x25,  0x2c,  0x20,  0x36,  0x37,  0x25,  0x29,  0x3b,  0x0a,  0x2d, 
+ 0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x2d,  0x34,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x30,  0x31,  0x2c,  0x20, 
+ 0x31,  0x31,  0x25,  0x2c,  0x20,  0x36,  0x30,  0x25,  0x29,  0x3b,  0x0a,  0x0a,  0x0a,  0x2d,  0x2d,  0x74, 
+ 0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x31,  0x3a,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x34,  0x34,  0x2e,  0x35,  0x2c,  0x20,  0x39, 
+ 0x36,  0x2e,  0x37,  0x25,  0x2c,  0x20,  0x35,  0x32,  0x2e,  0x39,  0x25,  0x29,  0x3b,  0x0a,  0x2d,  0x2d, 
+ 0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x2d,  0x32,  0x3a,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x34,  0x34,  0x2e,  0x35,  0x2c,  0x20, 
+ 0x39,  0x36,  0x2e,  0x37,  0x25,  0x2c,  0x20,  0x35,  0x32,  0x2e,  0x39,  0x25,  0x29,  0x3b,  0x0a,  0x2d, 
+ 0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x3a,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x34,  0x34,  0x2e,  0x35,  0x2c, 
+ 0x20,  0x39,  0x36,  0x2e,  0x37,  0x25,  0x2c,  0x20,  0x35,  0x32,  0x2e,  0x39,  0x25,  0x29,  0x3b,  0x0a, 
+ 0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x3a,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x34,  0x34,  0x2e,  0x35, 
+ 0x2c,  0x20,  0x39,  0x36,  0x2e,  0x37,  0x25,  0x2c,  0x20,  0x35,  0x32,  0x2e,  0x39,  0x25,  0x29,  0x3b, 
+ 0x0a,  0x0a,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x20,  0x50,  0x52,  0x49,  0x4d,  0x41,  0x52,  0x59,  0x20,  0x43,  0x4f,  0x4c,  0x4f,  0x52,  0x53, 
+ 0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x3a,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x30,  0x31, 
+ 0x2c,  0x20,  0x31,  0x31,  0x25,  0x2c,  0x20,  0x31,  0x39,  0x25,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x2d,  0x31,  0x2d,  0x68,  0x75,  0x65,  0x3a,  0x20,  0x32,  0x30,  0x31,  0x3b,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x2d,  0x31,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x31, 
+ 0x31,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72, 
+ 0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e, 
+ 0x65,  0x73,  0x73,  0x3a,  0x20,  0x31,  0x39,  0x25,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x70,  0x72,  0x69, 
+ 0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x3a,  0x20,  0x68,  0x73, 
+ 0x6c,  0x28,  0x32,  0x30,  0x31,  0x2c,  0x20,  0x31,  0x31,  0x25,  0x2c,  0x20,  0x32,  0x33,  0x25,  0x29, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x2d,  0x68,  0x75,  0x65,  0x3a,  0x20,  0x32,  0x30,  0x31, 
+ 0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69, 
+ 0x6f,  0x6e,  0x3a,  0x20,  0x31,  0x31,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x70, 
+ 0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x2d,  0x6c, 
+ 0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x3a,  0x20,  0x32,  0x33,  0x25,  0x3b,  0x0a,  0x0a, 
+ 0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d, 
+ 0x33,  0x3a,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x30,  0x31,  0x2c,  0x20,  0x31,  0x31,  0x25,  0x2c, 
+ 0x20,  0x32,  0x38,  0x25,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x70,  0x72,  0x69, 
+ 0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x68,  0x75,  0x65, 
+ 0x3a,  0x20,  0x32,  0x30,  0x31,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x70,  0x72,  0x69, 
+ 0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73,  0x61,  0x74, 
+ 0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x31,  0x31,  0x25,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x20,  0x20,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x3a,  0x20,  0x32, 
+ 0x38,  0x25,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x3a,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x30,  0x31,  0x2c, 
+ 0x20,  0x31,  0x31,  0x25,  0x2c,  0x20,  0x34,  0x30,  0x25,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20, 
+ 0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d, 
+ 0x34,  0x2d,  0x68,  0x75,  0x65,  0x3a,  0x20,  0x32,  0x30,  0x31,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20, 
+ 0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d, 
+ 0x34,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x31,  0x31, 
+ 0x25,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65, 
+ 0x73,  0x73,  0x3a,  0x20,  0x34,  0x30,  0x25,  0x3b,  0x0a,  0x0a,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x53,  0x45,  0x43,  0x4f,  0x4e,  0x44, 
+ 0x41,  0x52,  0x59,  0x20,  0x43,  0x4f,  0x4c,  0x4f,  0x52,  0x53,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2d,  0x2d, 
+ 0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d, 
+ 0x31,  0x3a,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x30,  0x31,  0x2c,  0x20,  0x31,  0x31,  0x25,  0x2c, 
+ 0x20,  0x38,  0x30,  0x25,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61, 
+ 0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x2d,  0x68,  0x75,  0x65,  0x3a,  0x20, 
+ 0x32,  0x30,  0x31,  0x3b,  0x0a,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74, 
+ 0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x31,  0x31,  0x25,  0x3b,  0x0a,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f, 
+ 0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x2d,  0x6c,  0x69, 
+ 0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x3a,  0x20,  0x38,  0x30,  0x25,  0x3b,  0x0a,  0x0a,  0x2d, 
+ 0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x2d,  0x32,  0x3a,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x30,  0x31,  0x2c,  0x20,  0x31,  0x31,  0x25, 
+ 0x2c,  0x20,  0x37,  0x34,  0x25,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64, 
+ 0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x2d,  0x68,  0x75,  0x65,  0x3a, 
+ 0x20,  0x32,  0x30,  0x31,  0x3b,  0x0a,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72, 
+ 0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61, 
+ 0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x31,  0x31,  0x25,  0x3b,  0x0a,  0x2d,  0x2d,  0x73,  0x65,  0x63, 
+ 0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x2d,  0x6c, 
+ 0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x3a,  0x20,  0x37,  0x34,  0x25,  0x3b,  0x0a,  0x0a, 
+ 0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x33,  0x3a,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x30,  0x31,  0x2c,  0x20,  0x31,  0x31, 
+ 0x25,  0x2c,  0x20,  0x36,  0x37,  0x25,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e, 
+ 0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x68,  0x75,  0x65, 
+ 0x3a,  0x20,  0x32,  0x30,  0x31,  0x3b,  0x0a,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61, 
+ 0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72, 
+ 0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x31,  0x31,  0x25,  0x3b,  0x0a,  0x2d,  0x2d,  0x73,  0x65, 
+ 0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d, 
+ 0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x3a,  0x20,  0x36,  0x37,  0x25,  0x3b,  0x0a, 
+ 0x0a,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x2d,  0x34,  0x3a,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x30,  0x31,  0x2c,  0x20,  0x31, 
+ 0x31,  0x25,  0x2c,  0x20,  0x36,  0x30,  0x25,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f, 
+ 0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x2d,  0x68,  0x75, 
+ 0x65,  0x3a,  0x20,  0x32,  0x30,  0x31,  0x3b,  0x0a,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64, 
+ 0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x2d,  0x73,  0x61,  0x74,  0x75, 
+ 0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x31,  0x31,  0x25,  0x3b,  0x0a,  0x2d,  0x2d,  0x73, 
+ 0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34, 
+ 0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x3a,  0x20,  0x36,  0x30,  0x25,  0x3b, 
+ 0x0a,  0x0a,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x20,  0x4e,  0x55,  0x41,  0x4e,  0x43,  0x45,  0x53,  0x20,  0x43,  0x4f,  0x4c,  0x4f,  0x52, 
+ 0x53,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75, 
+ 0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x3a,  0x20,  0x68,  0x73, 
+ 0x6c,  0x28,  0x34,  0x34,  0x2e,  0x35,  0x2c,  0x20,  0x39,  0x36,  0x2e,  0x37,  0x25,  0x2c,  0x20,  0x20, 
+ 0x35,  0x32,  0x2e,  0x39,  0x25,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68, 
+ 0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x2d,  0x31,  0x2d,  0x68,  0x75,  0x65,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x34,  0x34,  0x2e,  0x35,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d, 
+ 0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x2d,  0x31,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x39,  0x36,  0x2e,  0x37,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73, 
+ 0x73,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x35,  0x32,  0x2e,  0x39,  0x25,  0x3b,  0x0a, 
+ 0x0a,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x3a,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x34,  0x34,  0x2e, 
+ 0x35,  0x2c,  0x20,  0x39,  0x36,  0x2e,  0x37,  0x25,  0x2c,  0x20,  0x20,  0x35,  0x32,  0x2e,  0x39,  0x25, 
+ 0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e, 
+ 0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x2d,  0x68,  0x75, 
+ 0x65,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x34, 
+ 0x34,  0x2e,  0x35,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65, 
+ 0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x2d, 
+ 0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x39,  0x36,  0x2e,  0x37,  0x25,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68, 
+ 0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x2d,  0x32,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x3a,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x35,  0x32,  0x2e,  0x39,  0x25,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x74,  0x68, 
+ 0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x2d,  0x32,  0x3a,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x34,  0x34,  0x2e,  0x35,  0x2c,  0x20,  0x39,  0x36, 
+ 0x2e,  0x37,  0x25,  0x2c,  0x20,  0x20,  0x35,  0x32,  0x2e,  0x39,  0x25,  0x29,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x68,  0x75,  0x65,  0x3a,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x34,  0x34,  0x2e,  0x35,  0x3b,  0x0a, 
+ 0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e, 
+ 0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72, 
+ 0x61,  0x74,  0x69,  0x6f,  0x6e,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x39,  0x36,  0x2e,  0x37, 
+ 0x25,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e, 
+ 0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69, 
+ 0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x35, 
+ 0x32,  0x2e,  0x39,  0x25,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e, 
+ 0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x3a,  0x20,  0x68, 
+ 0x73,  0x6c,  0x28,  0x34,  0x34,  0x2e,  0x35,  0x2c,  0x20,  0x39,  0x36,  0x2e,  0x37,  0x25,  0x2c,  0x20, 
+ 0x20,  0x35,  0x32,  0x2e,  0x39,  0x25,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74, 
+ 0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x34,  0x2d,  0x68,  0x75,  0x65,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x34,  0x34,  0x2e,  0x35,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d, 
+ 0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e, 
+ 0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x39,  0x36,  0x2e,  0x37,  0x25,  0x3b,  0x0a,  0x20,  0x20, 
+ 0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65, 
+ 0x73,  0x73,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x35,  0x32,  0x2e,  0x39,  0x25,  0x3b, 
+ 0x0a,  0x0a,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x20,  0x52,  0x4f,  0x59,  0x47,  0x50,  0x20,  0x43,  0x4f,  0x4c,  0x4f,  0x52,  0x53,  0x20, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d, 
+ 0x65,  0x2d,  0x72,  0x65,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x33,  0x32,  0x2c,  0x20,  0x34,  0x30,  0x25,  0x2c,  0x20,  0x34, 
+ 0x35,  0x25,  0x29,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65, 
+ 0x2d,  0x6f,  0x72,  0x61,  0x6e,  0x67,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x20, 
+ 0x23,  0x65,  0x37,  0x36,  0x66,  0x35,  0x31,  0x3b,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74, 
+ 0x68,  0x65,  0x6d,  0x65,  0x2d,  0x79,  0x65,  0x6c,  0x6c,  0x6f,  0x77,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x3a,  0x20,  0x20,  0x23,  0x66,  0x66,  0x64,  0x39,  0x35,  0x66,  0x3b,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x67,  0x72,  0x65,  0x65,  0x6e,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x20,  0x20,  0x23,  0x41,  0x33,  0x42,  0x45,  0x38,  0x43,  0x3b, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x70,  0x75,  0x72, 
+ 0x70,  0x6c,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28, 
+ 0x32,  0x33,  0x32,  0x2c,  0x20,  0x33,  0x30,  0x25,  0x2c,  0x20,  0x34,  0x30,  0x25,  0x29,  0x3b,  0x0a, 
+ 0x0a,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2d,  0x2d,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75,  0x6e, 
+ 0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x76,  0x61, 
+ 0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x31,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f,  0x75, 
+ 0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x76, 
+ 0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x2d,  0x32,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72,  0x6f, 
+ 0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x3a,  0x20,  0x20,  0x20,  0x20, 
+ 0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x61,  0x63,  0x6b,  0x67,  0x72, 
+ 0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x3a,  0x20,  0x20,  0x20, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64, 
+ 0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x6f,  0x72, 
+ 0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x3a,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72, 
+ 0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x6f, 
+ 0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x3a,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61, 
+ 0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d, 
+ 0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x66,  0x6f,  0x63,  0x75,  0x73,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65, 
+ 0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d, 
+ 0x32,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x66,  0x6f,  0x63, 
+ 0x75,  0x73,  0x2d,  0x73,  0x68,  0x61,  0x64,  0x6f,  0x77,  0x3a,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72, 
+ 0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x74,  0x65,  0x78, 
+ 0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x70,  0x6c,  0x61,  0x69,  0x6e,  0x3a,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64, 
+ 0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x29,  0x3b,  0x0a,  0x2d,  0x2d, 
+ 0x74,  0x65,  0x78,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x73,  0x75,  0x62,  0x74,  0x69, 
+ 0x6c,  0x65,  0x2d,  0x31,  0x3a,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x73,  0x65,  0x63, 
+ 0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29,  0x3b, 
+ 0x0a,  0x2d,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x73,  0x75, 
+ 0x62,  0x74,  0x69,  0x6c,  0x65,  0x2d,  0x32,  0x3a,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d, 
+ 0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d, 
+ 0x33,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x63,  0x6f,  0x64,  0x65,  0x2d,  0x62,  0x61,  0x63,  0x6b, 
+ 0x67,  0x72,  0x6f,  0x75,  0x6e,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x76,  0x61, 
+ 0x72,  0x28,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x63,  0x6f,  0x64,  0x65,  0x2d,  0x74, 
+ 0x65,  0x78,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x75,  0x69,  0x2d,  0x72, 
+ 0x61,  0x6e,  0x67,  0x65,  0x2d,  0x74,  0x68,  0x75,  0x6d,  0x62,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x3a,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e, 
+ 0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x29,  0x3b,  0x0a, 
+ 0x2d,  0x2d,  0x75,  0x69,  0x2d,  0x72,  0x61,  0x6e,  0x67,  0x65,  0x2d,  0x74,  0x68,  0x75,  0x6d,  0x62, 
+ 0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x75, 
+ 0x69,  0x2d,  0x72,  0x61,  0x6e,  0x67,  0x65,  0x72,  0x2d,  0x74,  0x68,  0x75,  0x6d,  0x62,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x61,  0x72, 
+ 0x65,  0x61,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x63,  0x68, 
+ 0x61,  0x74,  0x2d,  0x69,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65, 
+ 0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x29, 
+ 0x3b,  0x0a,  0x0a,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d, 
+ 0x61,  0x6c,  0x65,  0x72,  0x74,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72, 
+ 0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x73,  0x65, 
+ 0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x29, 
+ 0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x61,  0x6c,  0x65,  0x72,  0x74, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x3a,  0x20,  0x20,  0x20, 
+ 0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x70, 
+ 0x75,  0x72,  0x70,  0x6c,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x2d,  0x2d, 
+ 0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x61,  0x6c,  0x65,  0x72,  0x74,  0x2d,  0x62,  0x6f,  0x72, 
+ 0x64,  0x65,  0x72,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x76, 
+ 0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x70,  0x75,  0x72,  0x70,  0x6c, 
+ 0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74, 
+ 0x74,  0x6f,  0x6e,  0x2d,  0x61,  0x6c,  0x65,  0x72,  0x74,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x61, 
+ 0x63,  0x74,  0x69,  0x76,  0x65,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28, 
+ 0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x31,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x61, 
+ 0x6c,  0x65,  0x72,  0x74,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76, 
+ 0x65,  0x3a,  0x20,  0x20,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65, 
+ 0x6d,  0x65,  0x2d,  0x72,  0x65,  0x64,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x2d, 
+ 0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x61,  0x6c,  0x65,  0x72,  0x74,  0x2d,  0x62,  0x6f, 
+ 0x72,  0x64,  0x65,  0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x3a,  0x20,  0x20,  0x20,  0x20, 
+ 0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x72,  0x65,  0x64,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x29,  0x3b,  0x0a,  0x0a,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x50,  0x52,  0x49,  0x4d,  0x41,  0x52, 
+ 0x59,  0x20,  0x42,  0x55,  0x54,  0x54,  0x4f,  0x4e,  0x53,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2f,  0x2a,  0x20, 
+ 0x2d,  0x20,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x20,  0x73,  0x68,  0x6f,  0x75,  0x6c,  0x64,  0x20, 
+ 0x69,  0x6d,  0x6d,  0x65,  0x64,  0x69,  0x61,  0x74,  0x65,  0x6c,  0x79,  0x20,  0x63,  0x61,  0x74,  0x63, 
+ 0x68,  0x20,  0x74,  0x68,  0x65,  0x20,  0x65,  0x79,  0x65,  0x20,  0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2d, 
+ 0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d, 
+ 0x74,  0x65,  0x78,  0x74,  0x3a,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72, 
+ 0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x29,  0x3b,  0x0a, 
+ 0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74, 
+ 0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x33,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70, 
+ 0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x76, 
+ 0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63, 
+ 0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x29,  0x3b,  0x0a,  0x0a,  0x0a,  0x2f,  0x2a, 
+ 0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2d,  0x2d,  0x62, 
+ 0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65, 
+ 0x78,  0x74,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x3a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x68,  0x73, 
+ 0x6c,  0x28,  0x32,  0x30,  0x31,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28, 
+ 0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e, 
+ 0x29,  0x20,  0x2d,  0x20,  0x31,  0x30,  0x30,  0x25,  0x29,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63, 
+ 0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72, 
+ 0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e, 
+ 0x65,  0x73,  0x73,  0x29,  0x20,  0x20,  0x2b,  0x20,  0x31,  0x30,  0x30,  0x25,  0x29,  0x29,  0x3b,  0x0a, 
+ 0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72, 
+ 0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x3a,  0x0a,  0x20, 
+ 0x20,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x34,  0x34,  0x2e,  0x35,  0x2c,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d, 
+ 0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33, 
+ 0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2d,  0x20,  0x32, 
+ 0x25,  0x29,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72, 
+ 0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73, 
+ 0x73,  0x29,  0x20,  0x20,  0x2d,  0x20,  0x31,  0x30,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d, 
+ 0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x62, 
+ 0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x3a,  0x0a,  0x20,  0x20,  0x20, 
+ 0x20,  0x68,  0x73,  0x6c,  0x28,  0x34,  0x34,  0x2e,  0x35,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63, 
+ 0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d, 
+ 0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73, 
+ 0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2d,  0x20,  0x32,  0x25,  0x29, 
+ 0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d, 
+ 0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x29, 
+ 0x20,  0x20,  0x2d,  0x20,  0x31,  0x30,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x0a,  0x2f,  0x2a,  0x20, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2d,  0x2d,  0x62,  0x75, 
+ 0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78, 
+ 0x74,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x3a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x68,  0x73, 
+ 0x6c,  0x28,  0x34,  0x34,  0x2e,  0x35,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63, 
+ 0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61, 
+ 0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73,  0x61,  0x74,  0x75, 
+ 0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2d,  0x20,  0x31,  0x30,  0x30,  0x25,  0x29,  0x2c, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d, 
+ 0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x29,  0x20, 
+ 0x20,  0x2b,  0x20,  0x31,  0x30,  0x30,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x62,  0x75, 
+ 0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x3a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x68, 
+ 0x73,  0x6c,  0x28,  0x34,  0x34,  0x2e,  0x35,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c, 
+ 0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75, 
+ 0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73,  0x61,  0x74, 
+ 0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2d,  0x20,  0x31,  0x30,  0x25,  0x29,  0x2c, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d, 
+ 0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x29,  0x20, 
+ 0x20,  0x2d,  0x20,  0x31,  0x35,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74, 
+ 0x74,  0x6f,  0x6e,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64, 
+ 0x65,  0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x3a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x68, 
+ 0x73,  0x6c,  0x28,  0x34,  0x34,  0x2e,  0x35,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c, 
+ 0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75, 
+ 0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73,  0x61,  0x74, 
+ 0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2d,  0x20,  0x32,  0x25,  0x29,  0x2c,  0x0a, 
+ 0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74, 
+ 0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x29,  0x20,  0x20, 
+ 0x2b,  0x20,  0x31,  0x30,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x53,  0x45,  0x43,  0x4f,  0x4e,  0x44, 
+ 0x41,  0x52,  0x59,  0x20,  0x42,  0x55,  0x54,  0x54,  0x4f,  0x4e,  0x53,  0x20,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2f,  0x2a, 
+ 0x20,  0x74,  0x68,  0x65,  0x73,  0x65,  0x20,  0x73,  0x68,  0x6f,  0x75,  0x6c,  0x64,  0x20,  0x4e,  0x4f, 
+ 0x54,  0x20,  0x69,  0x6d,  0x6d,  0x65,  0x64,  0x69,  0x61,  0x74,  0x65,  0x6c,  0x79,  0x20,  0x63,  0x61, 
+ 0x74,  0x63,  0x68,  0x20,  0x74,  0x68,  0x65,  0x20,  0x65,  0x79,  0x65,  0x20,  0x20,  0x2a,  0x2f,  0x0a, 
+ 0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61, 
+ 0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x3a,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d, 
+ 0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x2d,  0x31,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65, 
+ 0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x20, 
+ 0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e, 
+ 0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65, 
+ 0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x29,  0x3b,  0x0a,  0x0a,  0x0a,  0x2f,  0x2a,  0x20, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2d,  0x2d,  0x62,  0x75, 
+ 0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x74, 
+ 0x65,  0x78,  0x74,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x3a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x68, 
+ 0x73,  0x6c,  0x28,  0x34,  0x34,  0x2e,  0x35,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c, 
+ 0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75, 
+ 0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x73,  0x61,  0x74, 
+ 0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2d,  0x20,  0x32,  0x30,  0x25,  0x29,  0x2c, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d, 
+ 0x74,  0x68,  0x65,  0x6d,  0x65,  0x2d,  0x6e,  0x75,  0x61,  0x6e,  0x63,  0x65,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x2d,  0x33,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x29,  0x20, 
+ 0x20,  0x2d,  0x20,  0x38,  0x30,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74, 
+ 0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x68,  0x6f,  0x76,  0x65,  0x72,  0x3a,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28, 
+ 0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d, 
+ 0x34,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63, 
+ 0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x68,  0x6f, 
+ 0x76,  0x65,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61, 
+ 0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x29,  0x3b,  0x0a,  0x0a,  0x0a,  0x2f, 
+ 0x2a,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76, 
+ 0x65,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2d,  0x2d, 
+ 0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79, 
+ 0x2d,  0x74,  0x65,  0x78,  0x74,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x3a,  0x20,  0x76,  0x61, 
+ 0x72,  0x28,  0x2d,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x31,  0x29,  0x3b,  0x0a,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f, 
+ 0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f, 
+ 0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x3a,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x68,  0x73, 
+ 0x6c,  0x28,  0x32,  0x30,  0x31,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28, 
+ 0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f, 
+ 0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x2d,  0x73,  0x61,  0x74,  0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e, 
+ 0x29,  0x20,  0x2d,  0x20,  0x33,  0x30,  0x25,  0x29,  0x2c,  0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61, 
+ 0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79, 
+ 0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x2d,  0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65, 
+ 0x73,  0x73,  0x29,  0x20,  0x20,  0x2d,  0x20,  0x31,  0x35,  0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x2d, 
+ 0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x73,  0x65,  0x63,  0x6f,  0x6e,  0x64,  0x61,  0x72, 
+ 0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x2d,  0x61,  0x63,  0x74,  0x69,  0x76,  0x65,  0x3a, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x68,  0x73,  0x6c,  0x28,  0x32,  0x30,  0x31,  0x2c,  0x0a,  0x20,  0x20, 
+ 0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69, 
+ 0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x2d,  0x73,  0x61,  0x74, 
+ 0x75,  0x72,  0x61,  0x74,  0x69,  0x6f,  0x6e,  0x29,  0x20,  0x2d,  0x20,  0x33,  0x30,  0x25,  0x29,  0x2c, 
+ 0x0a,  0x20,  0x20,  0x20,  0x20,  0x63,  0x61,  0x6c,  0x63,  0x28,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d, 
+ 0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x2d, 
+ 0x6c,  0x69,  0x67,  0x68,  0x74,  0x6e,  0x65,  0x73,  0x73,  0x29,  0x20,  0x20,  0x2d,  0x20,  0x31,  0x35, 
+ 0x25,  0x29,  0x29,  0x3b,  0x0a,  0x0a,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x54,  0x45,  0x52,  0x54,  0x49,  0x41,  0x52,  0x59,  0x20,  0x42, 
+ 0x55,  0x54,  0x54,  0x4f,  0x4e,  0x53,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2f,  0x2a,  0x20,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x64,  0x69,  0x73,  0x61,  0x62,  0x6c,  0x65,  0x64, 
+ 0x20,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x73,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20,  0x2a,  0x2f,  0x0a,  0x2d,  0x2d,  0x62,  0x75, 
+ 0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x74,  0x65,  0x72,  0x74,  0x69,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65, 
+ 0x78,  0x74,  0x3a,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d, 
+ 0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x34,  0x29,  0x3b,  0x0a,  0x2d,  0x2d, 
+ 0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x74,  0x65,  0x72,  0x74,  0x69,  0x61,  0x72,  0x79,  0x2d, 
+ 0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72, 
+ 0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29,  0x3b,  0x0a, 
+ 0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x74,  0x65,  0x72,  0x74,  0x69,  0x61,  0x72, 
+ 0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a,  0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d, 
+ 0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29, 
+ 0x3b,  0x0a,  0x0a,  0x0a,  0x2f,  0x2a,  0x20,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d, 
+ 0x68,  0x6f,  0x76,  0x65,  0x72,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x2d,  0x20, 
+ 0x2a,  0x2f,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x74,  0x65,  0x72,  0x74, 
+ 0x69,  0x61,  0x72,  0x79,  0x2d,  0x74,  0x65,  0x78,  0x74,  0x3a,  0x20,  0x20,  0x20,  0x76,  0x61,  0x72, 
+ 0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72, 
+ 0x2d,  0x34,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d,  0x74,  0x65, 
+ 0x72,  0x74,  0x69,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c,  0x6f,  0x72,  0x3a,  0x20,  0x20,  0x76, 
+ 0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63,  0x6f,  0x6c, 
+ 0x6f,  0x72,  0x2d,  0x32,  0x29,  0x3b,  0x0a,  0x2d,  0x2d,  0x62,  0x75,  0x74,  0x74,  0x6f,  0x6e,  0x2d, 
+ 0x74,  0x65,  0x72,  0x74,  0x69,  0x61,  0x72,  0x79,  0x2d,  0x62,  0x6f,  0x72,  0x64,  0x65,  0x72,  0x3a, 
+ 0x20,  0x76,  0x61,  0x72,  0x28,  0x2d,  0x2d,  0x70,  0x72,  0x69,  0x6d,  0x61,  0x72,  0x79,  0x2d,  0x63, 
+ 0x6f,  0x6c,  0x6f,  0x72,  0x2d,  0x32,  0x29,  0x3b,  0x0a,  0x0a,  0x7d,  0x0a, 
+};
+unsigned int theme_beeninorder_css_len = 7116;
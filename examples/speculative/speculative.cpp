@@ -74,6 +74,7 @@ int main(int argc, char ** argv) {
     params_draft.rank         = 0;    // always load the draft model on the head device
     params_draft.use_mlock    = true; // always use mlock for the draft model
     std::fill_n(params_draft.n_layer_window, params.n_world, 0);
+    std::fill_n(params_draft.n_layer_extra,  params.n_world, 0);
 
     if (params_draft.draft_cpuparams.n_threads > 0) {
         params_draft.cpuparams.n_threads = params_draft.draft_cpuparams.n_threads;
@@ -390,7 +390,9 @@ extern "C" {
         // GGML_TYPE_Q4_0_8_8 = 33,
         GGML_TYPE_TQ1_0   = 34,
         GGML_TYPE_TQ2_0   = 35,
-        GGML_TYPE_COUNT   = 39,
+        GGML_TYPE_Q4_K_R4 = 39, // Q4_K with 4 rows interleaved, created at load time by ggml_repack
+        GGML_TYPE_Q6_K_R4 = 40, // Q6_K with 4 rows interleaved, created at load time by ggml_repack
+        GGML_TYPE_COUNT   = 41,
     };
 
     // precision
@@ -2351,6 +2353,13 @@ extern "C" {
                    int64_t   n_per_row,
                const float * imatrix);
 
+    // row-interleaved layouts for the CPU gemm/gemv kernels
+    // ggml_repack_type returns the interleaved type for a matrix of nrows x n_per_row, or GGML_TYPE_COUNT if there is none
+    // ggml_repack converts such a matrix in place, the size of the data does not change
+    GGML_API enum ggml_type ggml_repack_type(enum ggml_type type, int64_t nrows, int64_t n_per_row);
+    GGML_API void           ggml_repack     (enum ggml_type type, void * data, int64_t nrows, int64_t n_per_row);
+    GGML_API bool           ggml_is_repacked(enum ggml_type type);
+
     //
     // gguf
     //
@@ -3207,3 +3207,685 @@ void ggml_gemm_q4_0_8x8_q8_0(int n, float * restrict s, size_t bs, const void *
         }
     }
 }
+
+// Row-interleaved Q4_K and Q6_K
+//
+// block_q4_Kx4 / block_q6_Kx4 hold the same super-block of 4 consecutive rows, so the kernels below
+// unpack the weights of a super-block once and use them for up to 4 rows of q8_K activations, and
+// load every activation block once for 4 weight rows. The activations are plain q8_K rows.
+
+static block_q4_Kx4 make_block_q4_Kx4(const block_q4_K * in, int64_t stride) {
+    block_q4_Kx4 out;
+
+    for (int i = 0; i < 4; i++) {
+        const block_q4_K * b = in + i * stride;
+
+        out.d[i]    = b->d;
+        out.dmin[i] = b->dmin;
+        memcpy(out.scales + i * K_SCALE_SIZE, b->scales, K_SCALE_SIZE);
+        memcpy(out.qs     + i * QK_K/2,       b->qs,     QK_K/2);
+    }
+
+    return out;
+}
+
+static block_q6_Kx4 make_block_q6_Kx4(const block_q6_K * in, int64_t stride) {
+    block_q6_Kx4 out;
+
+    for (int i = 0; i < 4; i++) {
+        const block_q6_K * b = in + i * stride;
+
+        out.d[i] = b->d;
+        memcpy(out.ql     + i * QK_K/2,  b->ql,     QK_K/2);
+        memcpy(out.qh     + i * QK_K/4,  b->qh,     QK_K/4);
+        memcpy(out.scales + i * QK_K/16, b->scales, QK_K/16);
+    }
+
+    return out;
+}
+
+void repack_q4_K_r4(void * restrict data, int64_t nrow, int64_t n_per_row) {
+    assert(nrow % 4 == 0 && n_per_row % QK_K == 0);
+    const int64_t nb = n_per_row / QK_K;
+
+    block_q4_K * tmp = (block_q4_K *) malloc(4 * nb * sizeof(block_q4_K));
+    GGML_ASSERT(tmp != NULL);
+
+    for (int64_t r = 0; r < nrow; r += 4) {
+        block_q4_K   * src = (block_q4_K *) data + r * nb;
+        block_q4_Kx4 * dst = (block_q4_Kx4 *) src;
+
+        memcpy(tmp, src, 4 * nb * sizeof(block_q4_K));
+        for (int64_t x = 0; x < nb; x++) {
+            dst[x] = make_block_q4_Kx4(tmp + x, nb);
+        }
+    }
+
+    free(tmp);
+}
+
+void repack_q6_K_r4(void * restrict data, int64_t nrow, int64_t n_per_row) {
+    assert(nrow % 4 == 0 && n_per_row % QK_K == 0);
+    const int64_t nb = n_per_row / QK_K;
+
+    block_q6_K * tmp = (block_q6_K *) malloc(4 * nb * sizeof(block_q6_K));
+    GGML_ASSERT(tmp != NULL);
+
+    for (int64_t r = 0; r < nrow; r += 4) {
+        block_q6_K   * src = (block_q6_K *) data + r * nb;
+        block_q6_Kx4 * dst = (block_q6_Kx4 *) src;
+
+        memcpy(tmp, src, 4 * nb * sizeof(block_q6_K));
+        for (int64_t x = 0; x < nb; x++) {
+            dst[x] = make_block_q6_Kx4(tmp + x, nb);
+        }
+    }
+
+    free(tmp);
+}
+
+size_t quantize_q4_K_r4(const float * restrict src, void * restrict dst, int64_t nrow, int64_t n_per_row, const float * quant_weights) {
+    const size_t size = quantize_q4_K(src, dst, nrow, n_per_row, quant_weights);
+    repack_q4_K_r4(dst, nrow, n_per_row);
+    return size;
+}
+
+size_t quantize_q6_K_r4(const float * restrict src, void * restrict dst, int64_t nrow, int64_t n_per_row, const float * quant_weights) {
+    const size_t size = quantize_q6_K(src, dst, nrow, n_per_row, quant_weights);
+    repack_q6_K_r4(dst, nrow, n_per_row);
+    return size;
+}
+
+// unpack the 6-bit scales and mins of a q4_K block, bytes 0..7 of utmp are the scales, 8..15 the mins
+static inline void unpack_scales_mins_k4(const uint8_t * restrict scales, uint32_t * restrict utmp) {
+    const uint32_t kmask1 = 0x3f3f3f3f;
+    const uint32_t kmask2 = 0x0f0f0f0f;
+    const uint32_t kmask3 = 0x03030303;
+
+    memcpy(utmp, scales, K_SCALE_SIZE);
+    utmp[3] = ((utmp[2] >> 4) & kmask2) | (((utmp[1] >> 6) & kmask3) << 4);
+    const uint32_t uaux = utmp[1] & kmask1;
+    utmp[1] = (utmp[2] & kmask2) | (((utmp[0] >> 6) & kmask3) << 4);
+    utmp[2] = uaux;
+    utmp[0] &= kmask1;
+}
+
+// reference kernels, s[i * bs + j] = dot(row j of vx, row i of vy) for i < nr, j < nc
+static void ggml_gemm_q4_K_r4_q8_K_generic(int n, float * restrict s, size_t bs, const void * restrict vx, const void * restrict vy, int nr, int nc) {
+    const int nb = n / QK_K;
+
+    uint32_t utmp[4];
+
+    for (int y = 0; y < nr; y++) {
+        const block_q8_K * a_ptr = (const block_q8_K *) vy + y * nb;
+
+        for (int x = 0; x < nc / 4; x++) {
+            const block_q4_Kx4 * b_ptr = (const block_q4_Kx4 *) vx + x * nb;
+
+            float sumf[4] = { 0 };
+
+            for (int l = 0; l < nb; l++) {
+                for (int j = 0; j < 4; j++) {
+                    unpack_scales_mins_k4(b_ptr[l].scales + j * K_SCALE_SIZE, utmp);
+                    const uint8_t * sc   = (const uint8_t *) utmp;
+                    const uint8_t * mins = sc + 8;
+                    const uint8_t * q4   = b_ptr[l].qs + j * QK_K/2;
+                    const int8_t  * q8   = a_ptr[l].qs;
+
+                    int sumi = 0;
+                    int summ = 0;
+                    for (int k = 0; k < QK_K/64; k++) {
+                        int sum_l = 0;
+                        int sum_h = 0;
+                        for (int t = 0; t < 32; t++) {
+                            sum_l += (q4[32 * k + t] & 0xF) * q8[64 * k + t];
+                            sum_h += (q4[32 * k + t] >>  4) * q8[64 * k + 32 + t];
+                        }
+                        sumi += sum_l * sc[2*k + 0] + sum_h * sc[2*k + 1];
+                    }
+                    for (int k = 0; k < QK_K/32; k++) {
+                        summ += mins[k] * (a_ptr[l].bsums[2*k + 0] + a_ptr[l].bsums[2*k + 1]);
+                    }
+
+                    sumf[j] += a_ptr[l].d * (GGML_FP16_TO_FP32(b_ptr[l].d[j]) * sumi - GGML_FP16_TO_FP32(b_ptr[l].dmin[j]) * summ);
+                }
+            }
+
+            for (int j = 0; j < 4; j++) {
+                s[y * bs + x * 4 + j] = sumf[j];
+            }
+        }
+    }
+}
+
+static void ggml_gemm_q6_K_r4_q8_K_generic(int n, float * restrict s, size_t bs, const void * restrict vx, const void * restrict vy, int nr, int nc) {
+    const int nb = n / QK_K;
+
+    for (int y = 0; y < nr; y++) {
+        const block_q8_K * a_ptr = (const block_q8_K *) vy + y * nb;
+
+        for (int x = 0; x < nc / 4; x++) {
+            const block_q6_Kx4 * b_ptr = (const block_q6_Kx4 *) vx + x * nb;
+
+            float sumf[4] = { 0 };
+
+            for (int l = 0; l < nb; l++) {
+                for (int j = 0; j < 4; j++) {
+                    const int8_t  * sc = b_ptr[l].scales + j * QK_K/16;
+                    const uint8_t * ql = b_ptr[l].ql     + j * QK_K/2;
+                    const uint8_t * qh = b_ptr[l].qh     + j * QK_K/4;
+
+                    int sumi = 0;
+                    for (int h = 0; h < QK_K/128; h++) {
+                        int sums[8] = { 0 };
+                        for (int t = 0; t < 32; t++) {
+                            const int8_t * q8 = a_ptr[l].qs + 128 * h + t;
+                            const int q1 = (int) ((ql[64 * h + t]      & 0xF) | (((qh[32 * h + t] >> 0) & 3) << 4)) - 32;
+                            const int q2 = (int) ((ql[64 * h + t + 32] & 0xF) | (((qh[32 * h + t] >> 2) & 3) << 4)) - 32;
+                            const int q3 = (int) ((ql[64 * h + t]      >>  4) | (((qh[32 * h + t] >> 4) & 3) << 4)) - 32;
+                            const int q4 = (int) ((ql[64 * h + t + 32] >>  4) | (((qh[32 * h + t] >> 6) & 3) << 4)) - 32;
+                            sums[0 + t / 16] += q1 * q8[0];
+                            sums[2 + t / 16] += q2 * q8[32];
+                            sums[4 + t / 16] += q3 * q8[64];
+                            sums[6 + t / 16] += q4 * q8[96];
+                        }
+                        for (int k = 0; k < 8; k++) {
+                            sumi += sums[k] * sc[8 * h + k];
+                        }
+                    }
+
+                    sumf[j] += GGML_FP16_TO_FP32(b_ptr[l].d[j]) * a_ptr[l].d * sumi;
+                }
+            }
+
+            for (int j = 0; j < 4; j++) {
+                s[y * bs + x * 4 + j] = sumf[j];
+            }
+        }
+    }
+}
+
+#if defined(__AVX2__)
+static inline float hsum_float_8_r4(const __m256 x) {
+    __m128 res = _mm256_extractf128_ps(x, 1);
+    res = _mm_add_ps(res, _mm256_castps256_ps128(x));
+    res = _mm_add_ps(res, _mm_movehl_ps(res, res));
+    res = _mm_add_ss(res, _mm_movehdup_ps(res));
+    return _mm_cvtss_f32(res);
+}
+
+static inline float hsum_float_4_r4(const __m128 x) {
+    __m128 res = _mm_add_ps(x, _mm_movehl_ps(x, x));
+    res = _mm_add_ss(res, _mm_movehdup_ps(res));
+    return _mm_cvtss_f32(res);
+}
+
+// 16-bit lanes of the unpacked q4_K scales broadcast for sub-block i
+static inline __m256i scale_shuffle_k4_r4(int i) {
+    return _mm256_set1_epi16((short) (((2*i + 1) << 8) | (2*i)));
+}
+
+// bytes of the q6_K scales for sub-blocks 2*i and 2*i + 1, 8 of each
+static inline __m128i scale_shuffle_k6_r4(int i) {
+    return _mm_set_epi64x(0x0101010101010101LL * (2*i + 1), 0x0101010101010101LL * (2*i));
+}
+#endif
+
+#if defined(__ARM_NEON)
+// ny rows of vy against 4 rows of vx
+static void ggml_gemm_q4_K_r4_q8_K_neon(int nb, int ny, float * restrict s, size_t bs, const block_q4_Kx4 * restrict b_ptr, const block_q8_K * restrict a_ptr) {
+    const uint8x16_t m4b   = vdupq_n_u8(0xF);
+    const int32x4_t  mzero = vdupq_n_s32(0);
+
+    uint32_t utmp[4];
+
+    float sumf[4][4] = {{ 0 }};
+
+    for (int l = 0; l < nb; l++) {
+        for (int j = 0; j < 4; j++) {
+            unpack_scales_mins_k4(b_ptr[l].scales + j * K_SCALE_SIZE, utmp);
+            const uint8_t * sc = (const uint8_t *) utmp;
+
+            const int16x8_t mins = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(sc + 8)));
+            const float     d    = GGML_FP16_TO_FP32(b_ptr[l].d[j]);
+            const float     dmin = GGML_FP16_TO_FP32(b_ptr[l].dmin[j]);
+
+            // q4[2*k] and q4[2*k + 1] hold the 32 values of sub-block k
+            int8x16_t q4[16];
+            for (int k = 0; k < QK_K/64; k++) {
+                const ggml_uint8x16x2_t bits = ggml_vld1q_u8_x2(b_ptr[l].qs + j * QK_K/2 + 32 * k);
+                q4[4*k + 0] = vreinterpretq_s8_u8(vandq_u8  (bits.val[0], m4b));
+                q4[4*k + 1] = vreinterpretq_s8_u8(vandq_u8  (bits.val[1], m4b));
+                q4[4*k + 2] = vreinterpretq_s8_u8(vshrq_n_u8(bits.val[0], 4));
+                q4[4*k + 3] = vreinterpretq_s8_u8(vshrq_n_u8(bits.val[1], 4));
+            }
+
+            for (int i = 0; i < ny; i++) {
+                const block_q8_K * a = a_ptr + i * nb + l;
+
+                int32x4_t sumi = mzero;
+                for (int k = 0; k < QK_K/32; k++) {
+                    const ggml_int8x16x2_t q8 = ggml_vld1q_s8_x2(a->qs + 32 * k);
+                    const int32x4_t p = ggml_vdotq_s32(ggml_vdotq_s32(mzero, q4[2*k + 0], q8.val[0]), q4[2*k + 1], q8.val[1]);
+                    sumi = vmlaq_n_s32(sumi, p, sc[k]);
+                }
+
+                const int16x8_t q8sums = vpaddq_s16(vld1q_s16(a->bsums), vld1q_s16(a->bsums + 8));
+                const int32x4_t prod   = vaddq_s32(vmull_s16(vget_low_s16 (q8sums), vget_low_s16 (mins)),
+                                                   vmull_s16(vget_high_s16(q8sums), vget_high_s16(mins)));
+
+                sumf[i][j] += a->d * (d * vaddvq_s32(sumi) - dmin * vaddvq_s32(prod));
+            }
+        }
+    }
+
+    for (int i = 0; i < ny; i++) {
+        for (int j = 0; j < 4; j++) {
+            s[i * bs + j] = sumf[i][j];
+        }
+    }
+}
+
+static void ggml_gemm_q6_K_r4_q8_K_neon(int nb, int ny, float * restrict s, size_t bs, const block_q6_Kx4 * restrict b_ptr, const block_q8_K * restrict a_ptr) {
+    const uint8x16_t m4b   = vdupq_n_u8(0xF);
+    const uint8x16_t m2b   = vdupq_n_u8(3);
+    const int32x4_t  mzero = vdupq_n_s32(0);
+
+    float sumf[4][4] = {{ 0 }};
+
+    for (int l = 0; l < nb; l++) {
+        for (int j = 0; j < 4; j++) {
+            const int8_t  * sc = b_ptr[l].scales + j * QK_K/16;
+            const uint8_t * ql = b_ptr[l].ql     + j * QK_K/2;
+            const uint8_t * qh = b_ptr[l].qh     + j * QK_K/4;
+            const float     d  = GGML_FP16_TO_FP32(b_ptr[l].d[j]);
+
+            const int8x16_t scales = vld1q_s8(sc);
+            const int16x8_t sc_0   = vmovl_s8(vget_low_s8 (scales));
+            const int16x8_t sc_1   = vmovl_s8(vget_high_s8(scales));
+
+            // q6[k] holds the 16 values of sub-block k, without the offset of 32
+            int8x16_t q6[16];
+            for (int h = 0; h < QK_K/128; h++) {
+                const ggml_uint8x16x4_t bits  = ggml_vld1q_u8_x4(ql + 64 * h);
+                const ggml_uint8x16x2_t bitsH = ggml_vld1q_u8_x2(qh + 32 * h);
+
+                for (int t = 0; t < 2; t++) {
+                    q6[8*h + 0 + t] = vreinterpretq_s8_u8(vorrq_u8(vandq_u8  (bits.val[0 + t], m4b), vshlq_n_u8(vandq_u8(bitsH.val[t], m2b), 4)));
+                    q6[8*h + 2 + t] = vreinterpretq_s8_u8(vorrq_u8(vandq_u8  (bits.val[2 + t], m4b), vshlq_n_u8(vandq_u8(vshrq_n_u8(bitsH.val[t], 2), m2b), 4)));
+                    q6[8*h + 4 + t] = vreinterpretq_s8_u8(vorrq_u8(vshrq_n_u8(bits.val[0 + t], 4),   vshlq_n_u8(vandq_u8(vshrq_n_u8(bitsH.val[t], 4), m2b), 4)));
+                    q6[8*h + 6 + t] = vreinterpretq_s8_u8(vorrq_u8(vshrq_n_u8(bits.val[2 + t], 4),   vshlq_n_u8(vshrq_n_u8(bitsH.val[t], 6), 4)));
+                }
+            }
+
+            for (int i = 0; i < ny; i++) {
+                const block_q8_K * a = a_ptr + i * nb + l;
+
+                int32x4_t sumi = mzero;
+                for (int k = 0; k < QK_K/16; k++) {
+                    sumi = vmlaq_n_s32(sumi, ggml_vdotq_s32(mzero, q6[k], vld1q_s8(a->qs + 16 * k)), sc[k]);
+                }
+
+                const ggml_int16x8x2_t q8sums = ggml_vld1q_s16_x2(a->bsums);
+                const int32x4_t prod = vaddq_s32(vaddq_s32(vmull_s16(vget_low_s16 (q8sums.val[0]), vget_low_s16 (sc_0)),
+                                                           vmull_s16(vget_high_s16(q8sums.val[0]), vget_high_s16(sc_0))),
+                                                 vaddq_s32(vmull_s16(vget_low_s16 (q8sums.val[1]), vget_low_s16 (sc_1)),
+                                                           vmull_s16(vget_high_s16(q8sums.val[1]), vget_high_s16(sc_1))));
+
+                sumf[i][j] += d * a->d * (vaddvq_s32(sumi) - 32 * vaddvq_s32(prod));
+            }
+        }
+    }
+
+    for (int i = 0; i < ny; i++) {
+        for (int j = 0; j < 4; j++) {
+            s[i * bs + j] = sumf[i][j];
+        }
+    }
+}
+#endif
+
+void ggml_gemv_q4_K_r4_q8_K(int n, float * restrict s, size_t bs, const void * restrict vx, const void * restrict vy, int nr, int nc) {
+    const int nb = n / QK_K;
+    const int ncols_interleaved = 4;
+
+    assert (n % QK_K == 0);
+    assert (nc % ncols_interleaved == 0);
+
+    UNUSED(nr);
+
+#if defined(__AVX2__)
+    {
+        const __m256i m4 = _mm256_set1_epi8(0xF);
+
+        const block_q8_K * a_ptr = (const block_q8_K *) vy;
+
+        uint32_t utmp[4];
+
+        for (int x = 0; x < nc / ncols_interleaved; x++) {
+            const block_q4_Kx4 * b_ptr = (const block_q4_Kx4 *) vx + x * nb;
+
+            __m256 acc  [4] = { _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps() };
+            __m128 acc_m[4] = { _mm_setzero_ps(),    _mm_setzero_ps(),    _mm_setzero_ps(),    _mm_setzero_ps()    };
+
+            for (int l = 0; l < nb; l++) {
+                const __m128i q8s = _mm_hadd_epi16(_mm_loadu_si128((const __m128i *) a_ptr[l].bsums), _mm_loadu_si128((const __m128i *) a_ptr[l].bsums + 1));
+
+                for (int j = 0; j < 4; j++) {
+                    unpack_scales_mins_k4(b_ptr[l].scales + j * K_SCALE_SIZE, utmp);
+
+                    const __m256i mins_and_scales = _mm256_cvtepu8_epi16(_mm_set_epi32(utmp[3], utmp[2], utmp[1], utmp[0]));
+                    const __m128i sc128  = _mm256_extracti128_si256(mins_and_scales, 0);
+                    const __m256i scales = _mm256_set_m128i(sc128, sc128);
+
+                    const uint8_t * q4 = b_ptr[l].qs + j * QK_K/2;
+                    const int8_t  * q8 = a_ptr[l].qs;
+
+                    __m256i sumi = _mm256_setzero_si256();
+                    for (int k = 0; k < QK_K/64; k++) {
+                        const __m256i bits = _mm256_loadu_si256((const __m256i *)(q4 + 32 * k));
+                        const __m256i q4l  = _mm256_and_si256(bits, m4);
+                        const __m256i q4h  = _mm256_and_si256(_mm256_srli_epi16(bits, 4), m4);
+
+                        const __m256i p16l = _mm256_madd_epi16(_mm256_shuffle_epi8(scales, scale_shuffle_k4_r4(2*k + 0)),
+                                                               _mm256_maddubs_epi16(q4l, _mm256_loadu_si256((const __m256i *)(q8 + 64 * k))));
+                        const __m256i p16h = _mm256_madd_epi16(_mm256_shuffle_epi8(scales, scale_shuffle_k4_r4(2*k + 1)),
+                                                               _mm256_maddubs_epi16(q4h, _mm256_loadu_si256((const __m256i *)(q8 + 64 * k + 32))));
+                        sumi = _mm256_add_epi32(sumi, _mm256_add_epi32(p16l, p16h));
+                    }
+
+                    const __m128i prod = _mm_madd_epi16(_mm256_extracti128_si256(mins_and_scales, 1), q8s);
+
+                    acc  [j] = _mm256_fmadd_ps(_mm256_set1_ps( a_ptr[l].d * GGML_FP16_TO_FP32(b_ptr[l].d[j])),    _mm256_cvtepi32_ps(sumi), acc[j]);
+                    acc_m[j] = _mm_fmadd_ps   (_mm_set1_ps   (-a_ptr[l].d * GGML_FP16_TO_FP32(b_ptr[l].dmin[j])), _mm_cvtepi32_ps(prod),    acc_m[j]);
+                }
+            }
+
+            for (int j = 0; j < 4; j++) {
+                s[x * ncols_interleaved + j] = hsum_float_8_r4(acc[j]) + hsum_float_4_r4(acc_m[j]);
+            }
+        }
+        return;
+    }
+#elif defined(__ARM_NEON)
+    {
+        for (int x = 0; x < nc / ncols_interleaved; x++) {
+            ggml_gemm_q4_K_r4_q8_K_neon(nb, 1, s + x * ncols_interleaved, bs, (const block_q4_Kx4 *) vx + x * nb, (const block_q8_K *) vy);
+        }
+        return;
+    }
+#endif
+    ggml_gemm_q4_K_r4_q8_K_generic(n, s, bs, vx, vy, 1, nc);
+}
+
+void ggml_gemm_q4_K_r4_q8_K(int n, float * restrict s, size_t bs, const void * restrict vx, const void * restrict vy, int nr, int nc) {
+    const int nb = n / QK_K;
+    const int ncols_interleaved = 4;
+
+    assert (n % QK_K == 0);
+    assert (nc % ncols_interleaved == 0);
+
+#if defined(__AVX2__)
+    {
+        const __m256i m4 = _mm256_set1_epi8(0xF);
+
+        uint32_t utmp[4];
+
+        int y = 0;
+        for (; y + 4 <= nr; y += 4) {
+            const block_q8_K * a_ptr = (const block_q8_K *) vy + y * nb;
+
+            for (int x = 0; x < nc / ncols_interleaved; x++) {
+                const block_q4_Kx4 * b_ptr = (const block_q4_Kx4 *) vx + x * nb;
+
+                __m256 acc  [4][4];
+                __m128 acc_m[4][4];
+                for (int i = 0; i < 4; i++) {
+                    for (int j = 0; j < 4; j++) {
+                        acc  [i][j] = _mm256_setzero_ps();
+                        acc_m[i][j] = _mm_setzero_ps();
+                    }
+                }
+
+                for (int l = 0; l < nb; l++) {
+                    for (int j = 0; j < 4; j++) {
+                        unpack_scales_mins_k4(b_ptr[l].scales + j * K_SCALE_SIZE, utmp);
+
+                        const __m256i mins_and_scales = _mm256_cvtepu8_epi16(_mm_set_epi32(utmp[3], utmp[2], utmp[1], utmp[0]));
+                        const __m128i sc128  = _mm256_extracti128_si256(mins_and_scales, 0);
+                        const __m128i mins   = _mm256_extracti128_si256(mins_and_scales, 1);
+                        const __m256i scales = _mm256_set_m128i(sc128, sc128);
+
+                        const uint8_t * q4 = b_ptr[l].qs + j * QK_K/2;
+
+                        // the unpacked weights of one sub-block pair are used for all 4 rows of vy
+                        __m256i sumi[4] = { _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256() };
+                        for (int k = 0; k < QK_K/64; k++) {
+                            const __m256i bits    = _mm256_loadu_si256((const __m256i *)(q4 + 32 * k));
+                            const __m256i q4l     = _mm256_and_si256(bits, m4);
+                            const __m256i q4h     = _mm256_and_si256(_mm256_srli_epi16(bits, 4), m4);
+                            const __m256i scale_l = _mm256_shuffle_epi8(scales, scale_shuffle_k4_r4(2*k + 0));
+                            const __m256i scale_h = _mm256_shuffle_epi8(scales, scale_shuffle_k4_r4(2*k + 1));
+
+                            for (int i = 0; i < 4; i++) {
+                                const int8_t * q8 = a_ptr[i * nb + l].qs + 64 * k;
+                                const __m256i p16l = _mm256_madd_epi16(scale_l, _mm256_maddubs_epi16(q4l, _mm256_loadu_si256((const __m256i *)(q8 +  0))));
+                                const __m256i p16h = _mm256_madd_epi16(scale_h, _mm256_maddubs_epi16(q4h, _mm256_loadu_si256((const __m256i *)(q8 + 32))));
+                                sumi[i] = _mm256_add_epi32(sumi[i], _mm256_add_epi32(p16l, p16h));
+                            }
+                        }
+
+                        const float d    = GGML_FP16_TO_FP32(b_ptr[l].d[j]);
+                        const float dmin = GGML_FP16_TO_FP32(b_ptr[l].dmin[j]);
+
+                        for (int i = 0; i < 4; i++) {
+                            const block_q8_K * a = a_ptr + i * nb + l;
+                            const __m128i q8s  = _mm_hadd_epi16(_mm_loadu_si128((const __m128i *) a->bsums), _mm_loadu_si128((const __m128i *) a->bsums + 1));
+                            const __m128i prod = _mm_madd_epi16(mins, q8s);
+
+                            acc  [i][j] = _mm256_fmadd_ps(_mm256_set1_ps( a->d * d),    _mm256_cvtepi32_ps(sumi[i]), acc[i][j]);
+                            acc_m[i][j] = _mm_fmadd_ps   (_mm_set1_ps   (-a->d * dmin), _mm_cvtepi32_ps(prod),       acc_m[i][j]);
+                        }
+                    }
+                }
+
+                for (int i = 0; i < 4; i++) {
+                    for (int j = 0; j < 4; j++) {
+                        s[(y + i) * bs + x * ncols_interleaved + j] = hsum_float_8_r4(acc[i][j]) + hsum_float_4_r4(acc_m[i][j]);
+                    }
+                }
+            }
+        }
+        for (; y < nr; y++) {
+            ggml_gemv_q4_K_r4_q8_K(n, s + y * bs, bs, vx, (const block_q8_K *) vy + y * nb, 1, nc);
+        }
+        return;
+    }
+#elif defined(__ARM_NEON)
+    {
+        for (int y = 0; y < nr; y += 4) {
+            for (int x = 0; x < nc / ncols_interleaved; x++) {
+                ggml_gemm_q4_K_r4_q8_K_neon(nb, MIN(4, nr - y), s + y * bs + x * ncols_interleaved, bs,
+                                            (const block_q4_Kx4 *) vx + x * nb, (const block_q8_K *) vy + y * nb);
+            }
+        }
+        return;
+    }
+#endif
+    ggml_gemm_q4_K_r4_q8_K_generic(n, s, bs, vx, vy, nr, nc);
+}
+
+void ggml_gemv_q6_K_r4_q8_K(int n, float * restrict s, size_t bs, const void * restrict vx, const void * restrict vy, int nr, int nc) {
+    const int nb = n / QK_K;
+    const int ncols_interleaved = 4;
+
+    assert (n % QK_K == 0);
+    assert (nc % ncols_interleaved == 0);
+
+    UNUSED(nr);
+
+#if defined(__AVX2__)
+    {
+        const __m256i m4 = _mm256_set1_epi8(0xF);
+        const __m256i m2 = _mm256_set1_epi8(3);
+
+        const block_q8_K * a_ptr = (const block_q8_K *) vy;
+
+        for (int x = 0; x < nc / ncols_interleaved; x++) {
+            const block_q6_Kx4 * b_ptr = (const block_q6_Kx4 *) vx + x * nb;
+
+            __m256 acc[4] = { _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps() };
+
+            for (int l = 0; l < nb; l++) {
+                const __m256i q8sums = _mm256_loadu_si256((const __m256i *) a_ptr[l].bsums);
+
+                for (int j = 0; j < 4; j++) {
+                    const uint8_t * ql = b_ptr[l].ql + j * QK_K/2;
+                    const uint8_t * qh = b_ptr[l].qh + j * QK_K/4;
+                    const int8_t  * q8 = a_ptr[l].qs;
+
+                    const __m128i scales = _mm_loadu_si128((const __m128i *)(b_ptr[l].scales + j * QK_K/16));
+
+                    // the values are kept unsigned, the offset of 32 is removed through the block sums
+                    __m256i sumi = _mm256_sub_epi32(_mm256_setzero_si256(), _mm256_slli_epi32(_mm256_madd_epi16(_mm256_cvtepi8_epi16(scales), q8sums), 5));
+
+                    for (int h = 0; h < QK_K/128; h++) {
+                        const __m256i bits1 = _mm256_loadu_si256((const __m256i *)(ql + 64 * h));
+                        const __m256i bits2 = _mm256_loadu_si256((const __m256i *)(ql + 64 * h + 32));
+                        const __m256i bitsH = _mm256_loadu_si256((const __m256i *)(qh + 32 * h));
+
+                        const __m256i q6_0 = _mm256_or_si256(_mm256_and_si256(bits1, m4),                      _mm256_slli_epi16(_mm256_and_si256(bitsH, m2), 4));
+                        const __m256i q6_1 = _mm256_or_si256(_mm256_and_si256(bits2, m4),                      _mm256_slli_epi16(_mm256_and_si256(_mm256_srli_epi16(bitsH, 2), m2), 4));
+                        const __m256i q6_2 = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(bits1, 4), m4), _mm256_slli_epi16(_mm256_and_si256(_mm256_srli_epi16(bitsH, 4), m2), 4));
+                        const __m256i q6_3 = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(bits2, 4), m4), _mm256_slli_epi16(_mm256_and_si256(_mm256_srli_epi16(bitsH, 6), m2), 4));
+
+                        const __m256i p16_0 = _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_shuffle_epi8(scales, scale_shuffle_k6_r4(4*h + 0))),
+                                                                _mm256_maddubs_epi16(q6_0, _mm256_loadu_si256((const __m256i *)(q8 + 128 * h +  0))));
+                        const __m256i p16_1 = _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_shuffle_epi8(scales, scale_shuffle_k6_r4(4*h + 1))),
+                                                                _mm256_maddubs_epi16(q6_1, _mm256_loadu_si256((const __m256i *)(q8 + 128 * h + 32))));
+                        const __m256i p16_2 = _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_shuffle_epi8(scales, scale_shuffle_k6_r4(4*h + 2))),
+                                                                _mm256_maddubs_epi16(q6_2, _mm256_loadu_si256((const __m256i *)(q8 + 128 * h + 64))));
+                        const __m256i p16_3 = _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_shuffle_epi8(scales, scale_shuffle_k6_r4(4*h + 3))),
+                                                                _mm256_maddubs_epi16(q6_3, _mm256_loadu_si256((const __m256i *)(q8 + 128 * h + 96))));
+
+                        sumi = _mm256_add_epi32(sumi, _mm256_add_epi32(_mm256_add_epi32(p16_0, p16_1), _mm256_add_epi32(p16_2, p16_3)));
+                    }
+
+                    acc[j] = _mm256_fmadd_ps(_mm256_set1_ps(a_ptr[l].d * GGML_FP16_TO_FP32(b_ptr[l].d[j])), _mm256_cvtepi32_ps(sumi), acc[j]);
+                }
+            }
+
+            for (int j = 0; j < 4; j++) {
+                s[x * ncols_interleaved + j] = hsum_float_8_r4(acc[j]);
+            }
+        }
+        return;
+    }
+#elif defined(__ARM_NEON)
+    {
+        for (int x = 0; x < nc / ncols_interleaved; x++) {
+            ggml_gemm_q6_K_r4_q8_K_neon(nb, 1, s + x * ncols_interleaved, bs, (const block_q6_Kx4 *) vx + x * nb, (const block_q8_K *) vy);
+        }
+        return;
+    }
+#endif
+    ggml_gemm_q6_K_r4_q8_K_generic(n, s, bs, vx, vy, 1, nc);
+}
+
+void ggml_gemm_q6_K_r4_q8_K(int n, float * restrict s, size_t bs, const void * restrict vx, const void * restrict vy, int nr, int nc) {
+    const int nb = n / QK_K;
+    const int ncols_interleaved = 4;
+
+    assert (n % QK_K == 0);
+    assert (nc % ncols_interleaved == 0);
+
+#if defined(__AVX2__)
+    {
+        const __m256i m4 = _mm256_set1_epi8(0xF);
+        const __m256i m2 = _mm256_set1_epi8(3);
+
+        int y = 0;
+        for (; y + 4 <= nr; y += 4) {
+            const block_q8_K * a_ptr = (const block_q8_K *) vy + y * nb;
+
+            for (int x = 0; x < nc / ncols_interleaved; x++) {
+                const block_q6_Kx4 * b_ptr = (const block_q6_Kx4 *) vx + x * nb;
+
+                __m256 acc[4][4];
+                for (int i = 0; i < 4; i++) {
+                    for (int j = 0; j < 4; j++) {
+                        acc[i][j] = _mm256_setzero_ps();
+                    }
+                }
+
+                for (int l = 0; l < nb; l++) {
+                    for (int j = 0; j < 4; j++) {
+                        const uint8_t * ql = b_ptr[l].ql + j * QK_K/2;
+                        const uint8_t * qh = b_ptr[l].qh + j * QK_K/4;
+
+                        const __m128i scales   = _mm_loadu_si128((const __m128i *)(b_ptr[l].scales + j * QK_K/16));
+                        const __m256i scales16 = _mm256_cvtepi8_epi16(scales);
+
+                        // the values are kept unsigned, the offset of 32 is removed through the block sums
+                        __m256i sumi[4];
+                        for (int i = 0; i < 4; i++) {
+                            const __m256i q8sums = _mm256_loadu_si256((const __m256i *) a_ptr[i * nb + l].bsums);
+                            sumi[i] = _mm256_sub_epi32(_mm256_setzero_si256(), _mm256_slli_epi32(_mm256_madd_epi16(scales16, q8sums), 5));
+                        }
+
+                        for (int h = 0; h < QK_K/128; h++) {
+                            const __m256i bits1 = _mm256_loadu_si256((const __m256i *)(ql + 64 * h));
+                            const __m256i bits2 = _mm256_loadu_si256((const __m256i *)(ql + 64 * h + 32));
+                            const __m256i bitsH = _mm256_loadu_si256((const __m256i *)(qh + 32 * h));
+
+                            const __m256i q6[4] = {
+                                _mm256_or_si256(_mm256_and_si256(bits1, m4),                      _mm256_slli_epi16(_mm256_and_si256(bitsH, m2), 4)),
+                                _mm256_or_si256(_mm256_and_si256(bits2, m4),                      _mm256_slli_epi16(_mm256_and_si256(_mm256_srli_epi16(bitsH, 2), m2), 4)),
+                                _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(bits1, 4), m4), _mm256_slli_epi16(_mm256_and_si256(_mm256_srli_epi16(bitsH, 4), m2), 4)),
+                                _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(bits2, 4), m4), _mm256_slli_epi16(_mm256_and_si256(_mm256_srli_epi16(bitsH, 6), m2), 4)),
+                            };
+
+                            // the unpacked weights of one sub-block pair are used for all 4 rows of vy
+                            for (int t = 0; t < 4; t++) {
+                                const __m256i scale = _mm256_cvtepi8_epi16(_mm_shuffle_epi8(scales, scale_shuffle_k6_r4(4*h + t)));
+
+                                for (int i = 0; i < 4; i++) {
+                                    const __m256i q8 = _mm256_loadu_si256((const __m256i *)(a_ptr[i * nb + l].qs + 128 * h + 32 * t));
+                                    sumi[i] = _mm256_add_epi32(sumi[i], _mm256_madd_epi16(scale, _mm256_maddubs_epi16(q6[t], q8)));
+                                }
+                            }
+                        }
+
+                        const float d = GGML_FP16_TO_FP32(b_ptr[l].d[j]);
+
+                        for (int i = 0; i < 4; i++) {
+                            acc[i][j] = _mm256_fmadd_ps(_mm256_set1_ps(a_ptr[i * nb + l].d * d), _mm256_cvtepi32_ps(sumi[i]), acc[i][j]);
+                        }
+                    }
+                }
+
+                for (int i = 0; i < 4; i++) {
+                    for (int j = 0; j < 4; j++) {
+                        s[(y + i) * bs + x * ncols_interleaved + j] = hsum_float_8_r4(acc[i][j]);
+                    }
+                }
+            }
+        }
+        for (; y < nr; y++) {
+            ggml_gemv_q6_K_r4_q8_K(n, s + y * bs, bs, vx, (const block_q8_K *) vy + y * nb, 1, nc);
+        }
+        return;
+    }
+#elif defined(__ARM_NEON)
+    {
+        for (int y = 0; y < nr; y += 4) {
+            for (int x = 0; x < nc / ncols_interleaved; x++) {
+                ggml_gemm_q6_K_r4_q8_K_neon(nb, MIN(4, nr - y), s + y * bs + x * ncols_interleaved, bs,
+                                            (const block_q6_Kx4 *) vx + x * nb, (const block_q8_K *) vy + y * nb);
+            }
+        }
+        return;
+    }
+#endif
+    ggml_gemm_q6_K_r4_q8_K_generic(n, s, bs, vx, vy, nr, nc);
+}
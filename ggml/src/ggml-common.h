@@ -334,6 +334,22 @@ typedef struct {
 } block_q8_K;
 static_assert(sizeof(block_q8_K) == sizeof(float) + QK_K + QK_K/16*sizeof(int16_t), "wrong q8_K block size/padding");
 
+typedef struct {
+    ggml_half d[4];                   // super-block scales for 4 q4_K blocks
+    ggml_half dmin[4];                // super-block mins for 4 q4_K blocks
+    uint8_t scales[4 * K_SCALE_SIZE]; // scales and mins of 4 q4_K blocks, one after the other
+    uint8_t qs[4 * QK_K/2];           // nibbles of 4 q4_K blocks, one after the other
+} block_q4_Kx4;
+static_assert(sizeof(block_q4_Kx4) == 4 * sizeof(block_q4_K), "wrong q4_Kx4 block size/padding");
+
+typedef struct {
+    uint8_t ql[4 * QK_K/2];      // lower 4 bits of 4 q6_K blocks
+    uint8_t qh[4 * QK_K/4];      // upper 2 bits of 4 q6_K blocks
+    int8_t  scales[4 * QK_K/16]; // scales of 4 q6_K blocks
+    ggml_half d[4];              // super-block scales for 4 q6_K blocks
+} block_q6_Kx4;
+static_assert(sizeof(block_q6_Kx4) == 4 * sizeof(block_q6_K), "wrong q6_Kx4 block size/padding");
+
 // (Almost) "true" 2-bit quantization.
 // Due to the need to use blocks as per ggml design, it ends up using
 // 2.0625 bpw because of the 16-bit scale for each block of 256.
@@ -11832,6 +11832,15 @@ static inline __m256i mul_add_epi8(const __m256i x, const __m256i y) {
     const __m256i sy = _mm256_sign_epi8(y, x);
     return _mm256_maddubs_epi16(ax, sy);
 }
+
+// multiply the unsigned x with y and accumulate the pairwise sums weighted by the 16-bit scales
+static inline __m256i mul_add_scaled_u8(const __m256i acc, const __m256i x, const __m256i y, const __m256i scales) {
+#if defined(__AVXVNNI__) || (defined(__AVX512VNNI__) && defined(__AVX512VL__))
+    return _mm256_dpwssd_epi32(acc, _mm256_maddubs_epi16(x, y), scales);
+#else
+    return _mm256_add_epi32(acc, _mm256_madd_epi16(_mm256_maddubs_epi16(x, y), scales));
+#endif
+}
 #elif defined(__loongarch_asx)
 static inline __m256i mul_add_epi8(const __m256i x, const __m256i y) {
     const __m256i ax = __lasx_xvsigncov_b(x, x);
@@ -12465,6 +12474,319 @@ void ggml_vec_dot_iq1_m_q8_K  (int n, float * restrict s, size_t bs, const void
 #endif
 }
 
+// 4 rows of vx at a time against one row of vy, the loads of vy and the sums of q8 are shared by the rows
+void ggml_gemv_iq1_s_q8_K(int n, float * restrict s, size_t bs, const void * restrict vx, const void * restrict vy, int nr, int nc) {
+    assert(n % QK_K == 0);
+    assert(nc % 4 == 0);
+    UNUSED(bs);
+    UNUSED(nr);
+
+    const block_iq1_s * restrict x = vx;
+    const block_q8_K  * restrict y = vy;
+
+    const int nb = n / QK_K;
+
+#if defined __ARM_NEON
+
+    ggml_int8x16x4_t q1b;
+    ggml_int8x16x4_t q8b;
+
+    const uint16x8_t m7   = vdupq_n_u16(7);
+    const uint16x8_t mone = vdupq_n_u16(1);
+    const uint16x8_t msgn = vdupq_n_u16(0x8000);
+
+    for (int ix = 0; ix < nc; ix += 4) {
+        float sumf[4] = { 0 };
+
+        for (int i = 0; i < nb; ++i) {
+            const int8_t * q8 = y[i].qs;
+
+            int32x4_t sumi[4] = { vdupq_n_s32(0), vdupq_n_s32(0), vdupq_n_s32(0), vdupq_n_s32(0) };
+
+            for (int ib = 0; ib < QK_K/32; ib += 2) {
+                q8b = ggml_vld1q_s8_x4(q8); q8 += 64;
+
+                for (int r = 0; r < 4; ++r) {
+                    const uint8_t  * qs = x[(ix + r)*nb + i].qs + 4*ib;
+                    const uint16_t * qh = x[(ix + r)*nb + i].qh;
+
+                    q1b.val[0] = vcombine_s8(vld1_s8((const int8_t *)(iq1s_grid + (qs[0] | ((qh[ib+0] << 8) & 0x700)))),
+                                             vld1_s8((const int8_t *)(iq1s_grid + (qs[1] | ((qh[ib+0] << 5) & 0x700)))));
+                    q1b.val[1] = vcombine_s8(vld1_s8((const int8_t *)(iq1s_grid + (qs[2] | ((qh[ib+0] << 2) & 0x700)))),
+                                             vld1_s8((const int8_t *)(iq1s_grid + (qs[3] | ((qh[ib+0] >> 1) & 0x700)))));
+                    q1b.val[2] = vcombine_s8(vld1_s8((const int8_t *)(iq1s_grid + (qs[4] | ((qh[ib+1] << 8) & 0x700)))),
+                                             vld1_s8((const int8_t *)(iq1s_grid + (qs[5] | ((qh[ib+1] << 5) & 0x700)))));
+                    q1b.val[3] = vcombine_s8(vld1_s8((const int8_t *)(iq1s_grid + (qs[6] | ((qh[ib+1] << 2) & 0x700)))),
+                                             vld1_s8((const int8_t *)(iq1s_grid + (qs[7] | ((qh[ib+1] >> 1) & 0x700)))));
+
+                    const int32x4_t p1 = ggml_vdotq_s32(ggml_vdotq_s32(vdupq_n_s32(0), q1b.val[0], q8b.val[0]), q1b.val[1], q8b.val[1]);
+                    const int32x4_t p2 = ggml_vdotq_s32(ggml_vdotq_s32(vdupq_n_s32(0), q1b.val[2], q8b.val[2]), q1b.val[3], q8b.val[3]);
+
+                    const int ls1 = 2*((qh[ib+0] >> 12) & 7) + 1;
+                    const int ls2 = 2*((qh[ib+1] >> 12) & 7) + 1;
+                    sumi[r] = vmlaq_n_s32(vmlaq_n_s32(sumi[r], p1, ls1), p2, ls2);
+                }
+            }
+
+            // the shifts of the grid go through the sums of q8 over each 32 values
+            const int16x8_t bsums = vpaddq_s16(vld1q_s16(y[i].bsums), vld1q_s16(y[i].bsums + 8));
+
+            for (int r = 0; r < 4; ++r) {
+                const uint16x8_t qh  = vld1q_u16(x[(ix + r)*nb + i].qh);
+                const int16x8_t  ls  = vreinterpretq_s16_u16(vorrq_u16(vshlq_n_u16(vandq_u16(vshrq_n_u16(qh, 12), m7), 1), mone));
+                const int16x8_t  lsd = vbslq_s16(vtstq_u16(qh, msgn), vnegq_s16(ls), ls);
+                const int32x4_t  sumd = vaddq_s32(vmull_s16(vget_low_s16 (lsd), vget_low_s16 (bsums)),
+                                                  vmull_s16(vget_high_s16(lsd), vget_high_s16(bsums)));
+
+                sumf[r] += y[i].d * GGML_FP16_TO_FP32(x[(ix + r)*nb + i].d) * (vaddvq_s32(sumi[r]) + IQ1S_DELTA * vaddvq_s32(sumd));
+            }
+        }
+
+        for (int r = 0; r < 4; ++r) {
+            s[ix + r] = sumf[r];
+        }
+    }
+
+#elif defined __AVX2__
+
+    const __m256i mone = _mm256_set1_epi8(1);
+    const __m128i m7   = _mm_set1_epi16(7);
+    const __m128i one  = _mm_set1_epi16(1);
+
+    for (int ix = 0; ix < nc; ix += 4) {
+        __m256 accum [4] = { _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps() };
+        __m128 accum1[4] = { _mm_setzero_ps(),    _mm_setzero_ps(),    _mm_setzero_ps(),    _mm_setzero_ps()    };
+
+        for (int i = 0; i < nb; ++i) {
+            const __m128i bsums = _mm_hadd_epi16(_mm_loadu_si128((const __m128i *) y[i].bsums), _mm_loadu_si128((const __m128i *) y[i].bsums + 1));
+
+            for (int r = 0; r < 4; ++r) {
+                const int8_t   * q8 = y[i].qs;
+                const uint8_t  * qs = x[(ix + r)*nb + i].qs;
+                const uint16_t * qh = x[(ix + r)*nb + i].qh;
+
+                const __m128i qh16   = _mm_loadu_si128((const __m128i *) qh);
+                const __m128i ls     = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(_mm_srli_epi16(qh16, 12), m7), 1), one);
+                const __m256i scales = MM256_SET_M128I(ls, ls);
+
+                // the grid values are shifted to 0..2 for maddubs
+                __m256i sumi = _mm256_setzero_si256();
+                for (int ib = 0; ib < QK_K/32; ib += 2) {
+                    const __m256i q1b_1 = _mm256_set_epi64x(iq1s_grid[qs[3] | ((qh[ib+0] >> 1) & 0x700)], iq1s_grid[qs[2] | ((qh[ib+0] << 2) & 0x700)],
+                                                            iq1s_grid[qs[1] | ((qh[ib+0] << 5) & 0x700)], iq1s_grid[qs[0] | ((qh[ib+0] << 8) & 0x700)]);
+                    const __m256i q1b_2 = _mm256_set_epi64x(iq1s_grid[qs[7] | ((qh[ib+1] >> 1) & 0x700)], iq1s_grid[qs[6] | ((qh[ib+1] << 2) & 0x700)],
+                                                            iq1s_grid[qs[5] | ((qh[ib+1] << 5) & 0x700)], iq1s_grid[qs[4] | ((qh[ib+1] << 8) & 0x700)]);
+                    qs += 8;
+                    const __m256i q8b_1 = _mm256_loadu_si256((const __m256i*)q8); q8 += 32;
+                    const __m256i q8b_2 = _mm256_loadu_si256((const __m256i*)q8); q8 += 32;
+
+                    sumi = mul_add_scaled_u8(sumi, _mm256_add_epi8(q1b_1, mone), q8b_1, _mm256_shuffle_epi8(scales, get_scale_shuffle_k4(ib + 0)));
+                    sumi = mul_add_scaled_u8(sumi, _mm256_add_epi8(q1b_2, mone), q8b_2, _mm256_shuffle_epi8(scales, get_scale_shuffle_k4(ib + 1)));
+                }
+
+                // the shift by one and the IQ1S_DELTA shift, signed by the top bit of qh, go through the sums of q8
+                const __m128i lsd  = _mm_sign_epi16(ls, _mm_or_si128(qh16, one));
+                const __m128  corr = _mm_fmsub_ps(_mm_set1_ps(IQ1S_DELTA), _mm_cvtepi32_ps(_mm_madd_epi16(lsd, bsums)), _mm_cvtepi32_ps(_mm_madd_epi16(ls, bsums)));
+
+                const float d = y[i].d * GGML_FP16_TO_FP32(x[(ix + r)*nb + i].d);
+                accum [r] = _mm256_fmadd_ps(_mm256_set1_ps(d), _mm256_cvtepi32_ps(sumi), accum[r]);
+                accum1[r] = _mm_fmadd_ps(_mm_set1_ps(d), corr, accum1[r]);
+            }
+        }
+
+        for (int r = 0; r < 4; ++r) {
+            const __m128 h = _mm_add_ps(accum1[r], _mm_movehl_ps(accum1[r], accum1[r]));
+            s[ix + r] = hsum_float_8(accum[r]) + _mm_cvtss_f32(_mm_add_ss(h, _mm_movehdup_ps(h)));
+        }
+    }
+
+#else
+
+    for (int ix = 0; ix < nc; ++ix) {
+        ggml_vec_dot_iq1_s_q8_K(n, s + ix, 0, x + ix*nb, 0, y, 0, 1);
+    }
+
+#endif
+}
+
+void ggml_gemv_iq1_m_q8_K(int n, float * restrict s, size_t bs, const void * restrict vx, const void * restrict vy, int nr, int nc) {
+    assert(n % QK_K == 0);
+    assert(nc % 4 == 0);
+    UNUSED(bs);
+    UNUSED(nr);
+
+    const block_iq1_m * restrict x = vx;
+    const block_q8_K  * restrict y = vy;
+
+    const int nb = n / QK_K;
+
+    iq1m_scale_t scale;
+
+#if defined __ARM_NEON
+    const int32x4_t mask  = vdupq_n_s32(0x7);
+    const int32x4_t mone  = vdupq_n_s32(1);
+    const int32x4_t mzero = vdupq_n_s32(0);
+
+    ggml_int8x16x4_t deltas;
+    deltas.val[0] = vcombine_s8(vdup_n_s8(+1), vdup_n_s8(+1));
+    deltas.val[1] = vcombine_s8(vdup_n_s8(-1), vdup_n_s8(+1));
+    deltas.val[2] = vcombine_s8(vdup_n_s8(+1), vdup_n_s8(-1));
+    deltas.val[3] = vcombine_s8(vdup_n_s8(-1), vdup_n_s8(-1));
+
+    ggml_int8x16x4_t q1b;
+    ggml_int8x16x4_t q8b;
+
+    uint32_t aux32;
+    const uint8_t * aux8 = (const uint8_t *)&aux32;
+
+    for (int ix = 0; ix < nc; ix += 4) {
+        float sumf[4] = { 0 };
+
+        for (int i = 0; i < nb; ++i) {
+            const int8_t * q8 = y[i].qs;
+
+            int32x4_t sumi1[4] = { mzero, mzero, mzero, mzero };
+            int32x4_t sumi2[4] = { mzero, mzero, mzero, mzero };
+
+            for (int ib = 0; ib < QK_K/32; ib += 2) {
+                q8b = ggml_vld1q_s8_x4(q8); q8 += 64;
+
+                for (int r = 0; r < 4; ++r) {
+                    const uint8_t  * qs = x[(ix + r)*nb + i].qs + 4*ib;
+                    const uint8_t  * qh = x[(ix + r)*nb + i].qh + 2*ib;
+                    const uint16_t * sc = (const uint16_t *)x[(ix + r)*nb + i].scales;
+
+                    q1b.val[0] = vcombine_s8(vld1_s8((const int8_t *)(iq1s_grid + (qs[0] | ((qh[0] << 8) & 0x700)))),
+                                             vld1_s8((const int8_t *)(iq1s_grid + (qs[1] | ((qh[0] << 4) & 0x700)))));
+                    q1b.val[1] = vcombine_s8(vld1_s8((const int8_t *)(iq1s_grid + (qs[2] | ((qh[1] << 8) & 0x700)))),
+                                             vld1_s8((const int8_t *)(iq1s_grid + (qs[3] | ((qh[1] << 4) & 0x700)))));
+                    q1b.val[2] = vcombine_s8(vld1_s8((const int8_t *)(iq1s_grid + (qs[4] | ((qh[2] << 8) & 0x700)))),
+                                             vld1_s8((const int8_t *)(iq1s_grid + (qs[5] | ((qh[2] << 4) & 0x700)))));
+                    q1b.val[3] = vcombine_s8(vld1_s8((const int8_t *)(iq1s_grid + (qs[6] | ((qh[3] << 8) & 0x700)))),
+                                             vld1_s8((const int8_t *)(iq1s_grid + (qs[7] | ((qh[3] << 4) & 0x700)))));
+
+                    const int32x4_t p1 = vpaddq_s32(ggml_vdotq_s32(mzero, q1b.val[0], q8b.val[0]), ggml_vdotq_s32(mzero, q1b.val[1], q8b.val[1]));
+                    const int32x4_t p2 = vpaddq_s32(ggml_vdotq_s32(mzero, q1b.val[2], q8b.val[2]), ggml_vdotq_s32(mzero, q1b.val[3], q8b.val[3]));
+                    const int32x4_t p12 = vpaddq_s32(p1, p2);
+
+                    const uint32_t * qh32 = (const uint32_t *)qh; // we are 4-byte aligned, so we can do that
+                    aux32 = ((qh32[0] >> 3) & 0x01010101) | ((qh32[0] >> 6) & 0x02020202);
+
+                    const int32x4_t p3 = vpaddq_s32(ggml_vdotq_s32(mzero, deltas.val[aux8[0]], q8b.val[0]), ggml_vdotq_s32(mzero, deltas.val[aux8[1]], q8b.val[1]));
+                    const int32x4_t p4 = vpaddq_s32(ggml_vdotq_s32(mzero, deltas.val[aux8[2]], q8b.val[2]), ggml_vdotq_s32(mzero, deltas.val[aux8[3]], q8b.val[3]));
+                    const int32x4_t p34 = vpaddq_s32(p3, p4);
+
+                    int32x4_t scales_4 = ggml_vld1q_u32(sc[ib/2] >> 0, sc[ib/2] >> 3, sc[ib/2] >> 6, sc[ib/2] >> 9);
+
+                    scales_4 = vaddq_s32(vshlq_n_s32(vandq_s32(scales_4, mask), 1), mone);
+
+                    sumi1[r] = vmlaq_s32(sumi1[r], scales_4, p12);
+                    sumi2[r] = vmlaq_s32(sumi2[r], scales_4, p34);
+                }
+            }
+
+            for (int r = 0; r < 4; ++r) {
+                const uint16_t * sc = (const uint16_t *)x[(ix + r)*nb + i].scales;
+                scale.u16 = (sc[0] >> 12) | ((sc[1] >> 8) & 0x00f0) | ((sc[2] >> 4) & 0x0f00) | (sc[3] & 0xf000);
+
+                sumf[r] += y[i].d * GGML_FP16_TO_FP32(scale.f16) * (vaddvq_s32(sumi1[r]) + IQ1M_DELTA * vaddvq_s32(sumi2[r]));
+            }
+        }
+
+        for (int r = 0; r < 4; ++r) {
+            s[ix + r] = sumf[r];
+        }
+    }
+
+#elif defined __AVX2__
+
+    // with IQ1M_DELTA = 1/8 a grid value and its shift are one byte, 8*q + delta, offset by 9 to be unsigned
+    const __m256i m8     = _mm256_set1_epi8(8);
+    const __m256i m10    = _mm256_set1_epi8(10);
+    const __m256i m2     = _mm256_set1_epi8(2);
+    const __m256i mask_d = _mm256_set_epi64x(0x8080808080808080, 0x0808080808080808, 0x8080808080808080, 0x0808080808080808);
+    const __m256i shuf_1 = _mm256_set_epi64x(0x0101010101010101, 0x0101010101010101, 0x0000000000000000, 0x0000000000000000);
+    const __m256i shuf_2 = _mm256_set_epi64x(0x0303030303030303, 0x0303030303030303, 0x0202020202020202, 0x0202020202020202);
+
+    // the 3-bit scale k of a block is at bit 3*(k%4) of sc[k/4], the multiplies move it to bit 12
+    const __m256i shuf_s = _mm256_set_epi64x(0x0706070607060706, 0x0504050405040504, 0x0302030203020302, 0x0100010001000100);
+    const __m256i mul_s  = _mm256_set_epi16(8, 64, 512, 4096, 8, 64, 512, 4096, 8, 64, 512, 4096, 8, 64, 512, 4096);
+    const __m256i m7     = _mm256_set1_epi16(7);
+    const __m256i one    = _mm256_set1_epi16(1);
+
+    for (int ix = 0; ix < nc; ix += 4) {
+        __m256 accum[4] = { _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps() };
+
+        for (int i = 0; i < nb; ++i) {
+            const __m256i bsums = _mm256_loadu_si256((const __m256i *) y[i].bsums);
+
+            for (int r = 0; r < 4; ++r) {
+                const int8_t   * q8 = y[i].qs;
+                const uint8_t  * qs = x[(ix + r)*nb + i].qs;
+                const uint8_t  * qh = x[(ix + r)*nb + i].qh;
+                const uint16_t * sc = (const uint16_t *)x[(ix + r)*nb + i].scales;
+
+                scale.u16 = (sc[0] >> 12) | ((sc[1] >> 8) & 0x00f0) | ((sc[2] >> 4) & 0x0f00) | (sc[3] & 0xf000);
+
+                uint64_t sc64;
+                memcpy(&sc64, sc, sizeof(sc64));
+                const __m256i ls  = _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(_mm256_srli_epi16(
+                                        _mm256_mullo_epi16(_mm256_shuffle_epi8(_mm256_set1_epi64x(sc64), shuf_s), mul_s), 12), m7), 1), one);
+                const __m256i lsA = _mm256_permute2x128_si256(ls, ls, 0x00);
+                const __m256i lsB = _mm256_permute2x128_si256(ls, ls, 0x11);
+
+                __m256i sumi = _mm256_setzero_si256();
+                for (int ib = 0; ib < QK_K/32; ib += 2) {
+                    const __m256i q1b_1 = _mm256_set_epi64x(
+                            iq1s_grid[qs[3] | (((uint16_t)qh[1] << 4) & 0x700)], iq1s_grid[qs[2] | (((uint16_t)qh[1] << 8) & 0x700)],
+                            iq1s_grid[qs[1] | (((uint16_t)qh[0] << 4) & 0x700)], iq1s_grid[qs[0] | (((uint16_t)qh[0] << 8) & 0x700)]
+                    );
+                    const __m256i q1b_2 = _mm256_set_epi64x(
+                            iq1s_grid[qs[7] | (((uint16_t)qh[3] << 4) & 0x700)], iq1s_grid[qs[6] | (((uint16_t)qh[3] << 8) & 0x700)],
+                            iq1s_grid[qs[5] | (((uint16_t)qh[2] << 4) & 0x700)], iq1s_grid[qs[4] | (((uint16_t)qh[2] << 8) & 0x700)]
+                    );
+                    const __m256i q8b_1 = _mm256_loadu_si256((const __m256i*)q8); q8 += 32;
+                    const __m256i q8b_2 = _mm256_loadu_si256((const __m256i*)q8); q8 += 32;
+
+                    // the shift of each 8 values is negative when bit 3 (or 7) of its qh byte is set
+                    uint32_t qh32;
+                    memcpy(&qh32, qh, sizeof(qh32));
+                    const __m256i qhv = _mm256_set1_epi32(qh32);
+                    const __m256i d9_1 = _mm256_sub_epi8(m10, _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_and_si256(_mm256_shuffle_epi8(qhv, shuf_1), mask_d), mask_d), m2));
+                    const __m256i d9_2 = _mm256_sub_epi8(m10, _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_and_si256(_mm256_shuffle_epi8(qhv, shuf_2), mask_d), mask_d), m2));
+
+                    const __m256i lsv = ib < 4 ? lsA : lsB;
+
+                    sumi = mul_add_scaled_u8(sumi, _mm256_add_epi8(_mm256_sign_epi8(m8, q1b_1), d9_1), q8b_1, _mm256_shuffle_epi8(lsv, get_scale_shuffle_q3k(ib % 4 + 0)));
+                    sumi = mul_add_scaled_u8(sumi, _mm256_add_epi8(_mm256_sign_epi8(m8, q1b_2), d9_2), q8b_2, _mm256_shuffle_epi8(lsv, get_scale_shuffle_q3k(ib % 4 + 1)));
+
+                    qs += 8; qh += 4;
+                }
+
+                // remove the offset of 9 through the sums of q8 over each 16 values
+                const __m256i sumo = _mm256_madd_epi16(ls, bsums);
+                sumi = _mm256_sub_epi32(sumi, _mm256_add_epi32(_mm256_slli_epi32(sumo, 3), sumo));
+
+                accum[r] = _mm256_fmadd_ps(_mm256_set1_ps(y[i].d * GGML_FP16_TO_FP32(scale.f16) * IQ1M_DELTA), _mm256_cvtepi32_ps(sumi), accum[r]);
+            }
+        }
+
+        for (int r = 0; r < 4; ++r) {
+            s[ix + r] = hsum_float_8(accum[r]);
+        }
+    }
+
+#else
+
+    UNUSED(scale);
+
+    for (int ix = 0; ix < nc; ++ix) {
+        ggml_vec_dot_iq1_m_q8_K(n, s + ix, 0, x + ix*nb, 0, y, 0, 1);
+    }
+
+#endif
+}
+
 void ggml_vec_dot_iq4_nl_q8_0(int n, float * restrict s, size_t bs, const void * restrict vx, size_t bx, const void * restrict vy, size_t by, int nrc) {
     assert(nrc == 1);
     UNUSED(nrc);
@@ -15725,6 +16047,14 @@ bool ggml_validate_row_data(enum ggml_type type, const void * data, size_t nbyte
             {
                 VALIDATE_ROW_DATA_D_F16_IMPL(block_iq4_nl, data, nb);
             } break;
+        case GGML_TYPE_Q4_K_R4:
+            {
+                VALIDATE_ROW_DATA_DVEC_F16_IMPL(block_q4_Kx4, data, nb / 4, 4);
+            } break;
+        case GGML_TYPE_Q6_K_R4:
+            {
+                VALIDATE_ROW_DATA_DVEC_F16_IMPL(block_q6_Kx4, data, nb / 4, 4);
+            } break;
 
         case GGML_TYPE_I8:
         case GGML_TYPE_I16:
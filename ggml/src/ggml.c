@@ -1020,6 +1020,8 @@ static const ggml_type_traits_t type_traits[GGML_TYPE_COUNT] = {
         .vec_dot                  = ggml_vec_dot_iq1_s_q8_K,
         .vec_dot_type             = GGML_TYPE_Q8_K,
         .nrows                    = 1,
+        .ncols                    = 4,
+        .gemv                     = ggml_gemv_iq1_s_q8_K,
     },
     [GGML_TYPE_IQ1_M] = {
         .type_name                = "iq1_m",
@@ -1032,6 +1034,8 @@ static const ggml_type_traits_t type_traits[GGML_TYPE_COUNT] = {
         .vec_dot                  = ggml_vec_dot_iq1_m_q8_K,
         .vec_dot_type             = GGML_TYPE_Q8_K,
         .nrows                    = 1,
+        .ncols                    = 4,
+        .gemv                     = ggml_gemv_iq1_m_q8_K,
     },
     [GGML_TYPE_IQ4_NL] = {
         .type_name                = "iq4_nl",
@@ -1100,6 +1104,36 @@ static const ggml_type_traits_t type_traits[GGML_TYPE_COUNT] = {
         .vec_dot_type             = GGML_TYPE_Q8_K,
         .nrows                    = 1,
     },
+    [GGML_TYPE_Q4_K_R4] = {
+        .type_name                = "q4_K_r4",
+        .blck_size                = QK_K,
+        .type_size                = sizeof(block_q4_K),
+        .is_quantized             = true,
+        .to_float                 = NULL,
+        .from_float               = NULL,
+        .from_float_ref           = NULL,
+        .vec_dot                  = NULL,
+        .vec_dot_type             = GGML_TYPE_Q8_K,
+        .nrows                    = 1,
+        .ncols                    = 4,
+        .gemv                     = ggml_gemv_q4_K_r4_q8_K,
+        .gemm                     = ggml_gemm_q4_K_r4_q8_K,
+    },
+    [GGML_TYPE_Q6_K_R4] = {
+        .type_name                = "q6_K_r4",
+        .blck_size                = QK_K,
+        .type_size                = sizeof(block_q6_K),
+        .is_quantized             = true,
+        .to_float                 = NULL,
+        .from_float               = NULL,
+        .from_float_ref           = NULL,
+        .vec_dot                  = NULL,
+        .vec_dot_type             = GGML_TYPE_Q8_K,
+        .nrows                    = 1,
+        .ncols                    = 4,
+        .gemv                     = ggml_gemv_q6_K_r4_q8_K,
+        .gemm                     = ggml_gemm_q6_K_r4_q8_K,
+    },
 };
 
 // For internal test use
@@ -8966,6 +9000,78 @@ static void ggml_compute_forward_dup_bytes(
     }
 }
 
+// dequantize src0 into a F32 or F16 dst of any strides
+// the blocks of src0 run along dim 0, or along dim 1 when src0 is a transposed view
+static void ggml_compute_forward_dup_q(
+        const struct ggml_compute_params * params,
+        struct ggml_tensor * dst) {
+
+    const struct ggml_tensor * src0 = dst->src[0];
+
+    GGML_ASSERT(ggml_are_same_shape(src0, dst));
+    GGML_ASSERT(dst->type == GGML_TYPE_F32 || dst->type == GGML_TYPE_F16);
+
+    GGML_TENSOR_UNARY_OP_LOCALS
+
+    const enum ggml_type type = src0->type;
+    ggml_to_float_t const dequantize_row_q = type_traits[type].to_float;
+    GGML_ASSERT(dequantize_row_q != NULL);
+
+    const size_t type_size  = ggml_type_size(type);
+    const bool   transposed = nb00 != type_size;
+    GGML_ASSERT(!transposed || nb01 == type_size);
+
+    // each row is a run of blocks of src0, nq elements long
+    const int64_t nq     = transposed ? ne01 : ne00;
+    const int64_t nr     = transposed ? ne00 : ne01;
+    const size_t  nb_r   = transposed ? nb00 : nb01;
+    const size_t  nbd_q  = transposed ? nb1  : nb0;
+    const size_t  nbd_r  = transposed ? nb0  : nb1;
+    GGML_ASSERT(nq % ggml_blck_size(type) == 0);
+
+    const int ith = params->ith;
+    const int nth = params->nth;
+
+    const int64_t n_rows = nr*ne02*ne03;
+
+    // rows per thread
+    const int64_t dr = (n_rows + nth - 1)/nth;
+
+    // row range for this thread
+    const int64_t ir0 = dr*ith;
+    const int64_t ir1 = MIN(ir0 + dr, n_rows);
+
+    float * wdata = (float *) params->wdata + (nq + CACHE_LINE_SIZE_F32) * ith;
+
+    for (int64_t ir = ir0; ir < ir1; ++ir) {
+        const int64_t i3 = ir/(ne02*nr);
+        const int64_t i2 = (ir - i3*ne02*nr)/nr;
+        const int64_t i1 = (ir - i3*ne02*nr - i2*nr);
+
+        const char * src0_row = (const char *) src0->data + i1*nb_r  + i2*nb02 + i3*nb03;
+              char * dst_row  = (char *)        dst->data + i1*nbd_r + i2*nb2  + i3*nb3;
+
+        if (dst->type == GGML_TYPE_F32 && nbd_q == sizeof(float)) {
+            dequantize_row_q(src0_row, (float *) dst_row, nq);
+            continue;
+        }
+
+        dequantize_row_q(src0_row, wdata, nq);
+
+        if (dst->type == GGML_TYPE_F32) {
+            for (int64_t i = 0; i < nq; i++) {
+                *(float *) (dst_row + i*nbd_q) = wdata[i];
+            }
+        } else if (nbd_q == sizeof(ggml_fp16_t)) {
+            ggml_fp32_to_fp16_row(wdata, (ggml_fp16_t *) dst_row, nq);
+        } else {
+            for (int64_t i = 0; i < nq; i++) {
+                *(ggml_fp16_t *) (dst_row + i*nbd_q) = GGML_FP32_TO_FP16(wdata[i]);
+            }
+        }
+    }
+}
+
 static void ggml_compute_forward_dup(
         const struct ggml_compute_params * params,
         struct ggml_tensor * dst) {
@@ -8977,6 +9083,11 @@ static void ggml_compute_forward_dup(
         return;
     }
 
+    if (ggml_is_quantized(src0->type)) {
+        ggml_compute_forward_dup_q(params, dst);
+        return;
+    }
+
     switch (src0->type) {
         case GGML_TYPE_F16:
             {
@@ -12544,7 +12655,10 @@ UseGgmlGemm2:;
     const int64_t dr0 = (nr0 + nchunk0 - 1) / nchunk0;
     const int64_t dr1 = (nr1 + nchunk1 - 1) / nchunk1;
 
-    if ((ggml_n_dims(src0) == 2) && gemv) {
+    // types without a gemm only take the gemv path for decoding, and their gemv reads whole rows of src0
+    const bool use_gemv = gemv && (gemm || (ne11 < 4 && ne01 % matmul_num_cols == 0 && nb01 == ggml_row_size(type, ne00)));
+
+    if ((ggml_n_dims(src0) == 2) && use_gemv) {
         const void * src1_wdata      = (src1->type == vec_dot_type) ? src1->data : params->wdata;
         const size_t src1_col_stride = ggml_is_contiguous(src1) || src1->type != vec_dot_type ? ggml_row_size(vec_dot_type, ne10) : nb11;
         int64_t src0_start = (ith * ne01) / nth;
@@ -12553,15 +12667,23 @@ UseGgmlGemm2:;
         src0_end   = (src0_end   % matmul_num_cols) ? src0_end   + matmul_num_cols - (src0_end   % matmul_num_cols): src0_end;
         if (src0_start >= src0_end) return;
 
-        // If there are more than three rows in src1, use gemm; otherwise, use gemv.
-        if (gemm && (ne11 > 3)) {
-            gemm(ne00, (float *)((char *) dst->data) + src0_start, ne01, (const char *) src0->data + src0_start * nb01,
-                 (const char *) src1_wdata, ne11 - ne11 % 4, src0_end - src0_start);
-        }
-        for (int iter = gemm ? ne11 - ne11 % 4 : 0; iter < ne11; iter++) {
-            gemv(ne00, (float *)((char *) dst->data + (iter * nb1)) + src0_start, ne01,
-                 (const char *) src0->data + src0_start * nb01, (const char *) src1_wdata + (src1_col_stride * iter), 1,
-                 src0_end - src0_start);
+        // the 2D src0 is broadcast over the matrices of src1
+        for (int64_t i13 = 0; i13 < ne13; i13++) {
+            for (int64_t i12 = 0; i12 < ne12; i12++) {
+                const char * src1_mat = (const char *) src1_wdata + (src1->type == vec_dot_type ? i12*nb12 + i13*nb13 : (i12 + i13*ne12)*ne11*src1_col_stride);
+                char       * dst_mat  = (char *) dst->data + i12*nb2 + i13*nb3;
+
+                // If there are more than three rows in src1, use gemm; otherwise, use gemv.
+                if (gemm && (ne11 > 3)) {
+                    gemm(ne00, (float *) dst_mat + src0_start, ne01, (const char *) src0->data + src0_start * nb01,
+                         src1_mat, ne11 - ne11 % 4, src0_end - src0_start);
+                }
+                for (int iter = gemm ? ne11 - ne11 % 4 : 0; iter < ne11; iter++) {
+                    gemv(ne00, (float *)(dst_mat + (iter * nb1)) + src0_start, ne01,
+                         (const char *) src0->data + src0_start * nb01, src1_mat + (src1_col_stride * iter), 1,
+                         src0_end - src0_start);
+                }
+            }
         }
         return;
     }
@@ -12613,6 +12735,7 @@ static void ggml_compute_forward_mul_mat_id(
     ggml_from_float_t const from_float      = type_traits[vec_dot_type].from_float;
     int64_t           const matmul_num_cols = type_traits[type].ncols;
     ggml_gemv_t       const gemv            = type_traits[type].gemv;
+    ggml_gemm_t       const gemm            = type_traits[type].gemm;
 
     // we don't support permuted src0 or src1
     GGML_ASSERT(nb00 == ggml_type_size(type));
@@ -12698,7 +12821,7 @@ static void ggml_compute_forward_mul_mat_id(
         const int64_t nr0 = ne01; // src0 rows
         const int64_t nr1 = cne1; // src1 rows
 
-        if (((ggml_n_dims(src0) - 1) == 2) && gemv) {
+        if (((ggml_n_dims(src0) - 1) == 2) && gemv && (gemm || (nr1 < 4 && ne01 % matmul_num_cols == 0))) {
             int64_t src0_cur_start = (ith * ne01) / nth;
             int64_t src0_cur_end   = ((ith + 1) * ne01) / nth;
             src0_cur_start = (src0_cur_start % matmul_num_cols) ? src0_cur_start + matmul_num_cols - (src0_cur_start % matmul_num_cols): src0_cur_start;
@@ -14070,6 +14193,8 @@ static void ggml_compute_forward_clamp(
         case GGML_TYPE_IQ3_S:
         case GGML_TYPE_IQ2_S:
         case GGML_TYPE_Q8_K:
+        case GGML_TYPE_Q4_K_R4:
+        case GGML_TYPE_Q6_K_R4:
         case GGML_TYPE_I8:
         case GGML_TYPE_I16:
         case GGML_TYPE_I32:
@@ -19653,6 +19778,10 @@ struct ggml_cplan ggml_graph_plan(
                         (node->src[0]->type == GGML_TYPE_F16  && node->src[1] && node->src[1]->type == GGML_TYPE_BF16) ||
                         (node->src[0]->type == GGML_TYPE_BF16 && node->src[1] && node->src[1]->type == GGML_TYPE_F16)) {
                         cur = ggml_type_size(GGML_TYPE_F32) * node->ne[0] * n_tasks;
+                    } else if (ggml_is_quantized(node->src[0]->type)) {
+                        // rows are dequantized along dim 0, or dim 1 of a transposed view
+                        const int64_t nq = MAX(node->src[0]->ne[0], node->src[0]->ne[1]);
+                        cur = ggml_type_size(GGML_TYPE_F32) * (nq + CACHE_LINE_SIZE_F32) * n_tasks;
                     }
                 } break;
             case GGML_OP_ADD:
@@ -21869,6 +21998,8 @@ size_t ggml_quantize_chunk(
         case GGML_TYPE_IQ1_M:   result = quantize_iq1_m  (src + start, (char *) dst + start_row * row_size, nrows, n_per_row, imatrix); break;
         case GGML_TYPE_IQ4_NL:  result = quantize_iq4_nl (src + start, (char *) dst + start_row * row_size, nrows, n_per_row, imatrix); break;
         case GGML_TYPE_IQ4_XS:  result = quantize_iq4_xs (src + start, (char *) dst + start_row * row_size, nrows, n_per_row, imatrix); break;
+        case GGML_TYPE_Q4_K_R4: result = quantize_q4_K_r4(src + start, (char *) dst + start_row * row_size, nrows, n_per_row, imatrix); break;
+        case GGML_TYPE_Q6_K_R4: result = quantize_q6_K_r4(src + start, (char *) dst + start_row * row_size, nrows, n_per_row, imatrix); break;
         case GGML_TYPE_F16:
             {
                 size_t elemsize = sizeof(ggml_fp16_t);
@@ -21896,6 +22027,34 @@ size_t ggml_quantize_chunk(
     return result;
 }
 
+enum ggml_type ggml_repack_type(enum ggml_type type, int64_t nrows, int64_t n_per_row) {
+    if (nrows % 4 != 0 || n_per_row % QK_K != 0) {
+        return GGML_TYPE_COUNT;
+    }
+
+    switch (type) {
+        case GGML_TYPE_Q4_K: return GGML_TYPE_Q4_K_R4;
+        case GGML_TYPE_Q6_K: return GGML_TYPE_Q6_K_R4;
+        default:             return GGML_TYPE_COUNT;
+    }
+}
+
+void ggml_repack(enum ggml_type type, void * data, int64_t nrows, int64_t n_per_row) {
+    GGML_ASSERT(ggml_repack_type(type, nrows, n_per_row) != GGML_TYPE_COUNT);
+
+    switch (type) {
+        case GGML_TYPE_Q4_K: repack_q4_K_r4(data, nrows, n_per_row); break;
+        case GGML_TYPE_Q6_K: repack_q6_K_r4(data, nrows, n_per_row); break;
+        default:
+            GGML_ABORT("fatal error");
+    }
+}
+
+bool ggml_is_repacked(enum ggml_type type) {
+    // the rows of these types are only usable together with their neighbours
+    return type == GGML_TYPE_Q4_K_R4 || type == GGML_TYPE_Q6_K_R4;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 struct gguf_str {
@@ -210,6 +210,13 @@ extern "C" {
         LLAMA_POOLING_TYPE_RANK = 4, // used by reranking models to attach the classification head to the graph
     };
 
+    // what to do with the mmap pages of a layer window once it has been computed
+    enum llama_release_policy {
+        LLAMA_RELEASE_POLICY_OFF    = 0, // leave eviction to the kernel
+        LLAMA_RELEASE_POLICY_ADVISE = 1, // unmap the pages from this process (MADV_DONTNEED), no memory is freed until the kernel reclaims the page cache
+        LLAMA_RELEASE_POLICY_FORCE  = 2, // evict the pages from the page cache right away (MADV_PAGEOUT where available)
+    };
+
     enum llama_attention_type {
         LLAMA_ATTENTION_TYPE_UNSPECIFIED = -1,
         LLAMA_ATTENTION_TYPE_CAUSAL      = 0,
@@ -293,6 +300,7 @@ extern "C" {
         uint32_t n_world; // number of nodes
         uint32_t rank; // my node rank
         uint32_t n_layer_window[32]; // number of layers to kept each time
+        uint32_t n_layer_extra[32];  // number of leading cycles in which a node keeps one more layer
         int32_t  n_gpu_layers; // number of layers to store in VRAM
         enum llama_split_mode split_mode; // how to split the model across multiple GPUs
 
@@ -326,6 +334,8 @@ extern "C" {
         bool check_tensors; // validate model tensor data
         bool keep_out_in_metal; // whether to keep output weights in metal memory
         bool keep_out_in_cuda;  // whether to run the output layer on CUDA
+        bool stream_weights;    // read CPU layer windows from disk into two staging buffers instead of faulting in the mmap
+        bool repack;            // repack Q4_K/Q6_K weights of CPU layers into 4-row interleaved blocks, needs use_mmap off
     };
 
     // NOTE: changing the default values of parameters marked as [EXPERIMENTAL] may cause crashes or incorrect results in certain configurations
@@ -334,10 +344,15 @@ extern "C" {
         uint32_t    n_world;           // world size
         uint32_t    rank;              // my rank
         uint32_t    n_layer_window[32];// number of layers to process in each compute
+        uint32_t    n_layer_extra[32]; // number of leading cycles in which a node processes one more layer
+        uint32_t    tp_ffn_share[32];  // per mille of the FFN rows of its CPU layers a node computes, the rest runs on its next node, 0 = no split
         uint32_t    n_gpu_layers;      // number of layers to process on GPU
         uint32_t    n_cycles;          // number of cycles to output one token
         bool        prefetch;          // whether to prefetch layer weights
         bool        force;             // force to start prefetching after computation
+        enum llama_release_policy release_policy; // release the pages of computed layer windows when memory runs short
+        bool        async_comm;        // overlap sending and receiving activations with compute on dedicated threads
+        bool        residency_stats;   // sample how much of each layer window is resident at compute start, a mincore scan per window and token
         float       master_priority;   // priority to assign workload to the master (set 1.01 to use master first, and 0.99 to offload to other devices)
         bool        keep_out_in_metal; // whether to keep output weights in metal memory
         bool        keep_out_in_cuda;  // whether to run the output layer on CUDA
@@ -345,10 +360,14 @@ extern "C" {
         char *      next_node_ip;      // ip address of the next node
         uint32_t    data_port;         // data port for distributed inference
         uint32_t    signal_port;       // signal port for distributed inference
+        uint32_t    tp_port;           // port a node serves the FFN rows split off by its previous node on
+        uint32_t    fail_timeout;      // ms without a heartbeat before a rank is considered failed, 0 = disabled
+        bool        kv_replicate;      // keep a replica of the kv cache of the previous device, to take over its layers when it fails
         uint32_t    n_ctx;             // text context, 0 = from model
         uint32_t    n_predict;         // number of tokens to predict
         uint32_t    n_batch;           // logical maximum batch size that can be submitted to llama_decode
         uint32_t    n_ubatch;          // physical maximum batch size
+        uint32_t    n_micro_batch;     // micro-batch size to pipeline prefill across devices, 0 = disabled
         uint32_t    n_seq_max;         // max number of sequences (i.e. distinct states for recurrent models)
         int32_t     n_threads;         // number of threads to use for generation
         int32_t     n_threads_batch;   // number of threads to use for batch processing
@@ -373,6 +392,8 @@ extern "C" {
         enum ggml_type type_k; // data type for K cache [EXPERIMENTAL]
         enum ggml_type type_v; // data type for V cache [EXPERIMENTAL]
 
+        enum ggml_type comm_type; // data type of activations sent to the next device (f32, f16, bf16 or q8_0) [EXPERIMENTAL]
+
         // Keep the booleans together and at the end of the struct to avoid misalignment during copy-by-value.
         // TODO: move at the end of the struct
         bool logits_all;  // the llama_decode() call computes all logits, not just the last one (DEPRECATED - set llama_batch.logits instead)
@@ -401,6 +422,10 @@ extern "C" {
         bool keep_split;                     // quantize to the same number of shards
         void * imatrix;                      // pointer to importance matrix data
         void * kv_overrides;                 // pointer to vector containing overrides
+        void * layer_ftypes;                 // pointer to vector containing a llama_ftype per layer (LLAMA_FTYPE_GUESSED = use ftype)
+        enum llama_ftype hybrid_ftype;       // quantize the least important layers with this llama_ftype (LLAMA_FTYPE_GUESSED = disabled)
+        float hybrid_budget;                 // target size of the repeating layers in GiB, layers above it use hybrid_ftype
+        int32_t hybrid_window;               // number of consecutive layers that share the same precision
     } llama_model_quantize_params;
 
     typedef struct llama_logit_bias {
@@ -433,6 +458,8 @@ extern "C" {
     // Call once at the start of the program
     LLAMA_API void llama_backend_init(void);
 
+    // If cached is not NULL, its disk, memory bandwidth, copy delay and flops measurements are
+    // reused instead of running the benchmarks again, the rest of dev_info is always probed
     LLAMA_API void llama_profile_device(
                        struct device_info * dev_info, 
                        struct llama_model * model, 
@@ -441,7 +468,8 @@ extern "C" {
                                       int   n_predict,
                                       int   n_ctx,
                                       int   n_threads,
-                                     bool   flash_attn);
+                                     bool   flash_attn,
+                 const struct device_info * cached);
 
     LLAMA_API ggml_backend_buffer_type_t llama_dev_buffer_type(struct llama_model * model, int device);
 
@@ -470,19 +498,103 @@ extern "C" {
         NODE_TYPE_EXIT,
     };
 
+    // cost of a rank measured while decoding, accumulated since the previous llama_gather_rank_perf
+    struct llama_rank_perf {
+        uint32_t n_layers;       // layers held by the rank, 0 for forwarders
+        uint32_t n_gpu_layers;   // of which offloaded to the GPU
+        uint32_t n_cycles;       // windows held, each one receives and sends activations once per pass
+        uint32_t n_evals;        // passes through the layer windows
+        double   t_compute_ms;   // time computing the layer windows, page faults included
+        double   t_prefetch_ms;  // time blocked on weight streaming, page release and prefetch advice
+        double   t_send_ms;      // time encoding and queueing activations for the next rank, not the transfer itself
+        int64_t  n_major_faults;
+    };
+
     LLAMA_API void llama_init_sockets      (struct llama_context * ctx, uint32_t n_world, uint32_t my_rank);
     LLAMA_API void llama_free_sockets      (struct llama_context * ctx, char ** msg);
     LLAMA_API int  llama_gather_device_info(struct llama_context * ctx, struct device_info * dev_info_set);
     LLAMA_API int  llama_send_device_info  (struct llama_context * ctx, struct device_info * dev_info);
     LLAMA_API int  llama_bcast_startup_args(struct llama_context * ctx, uint32_t rank, struct startup_args * args);
-    LLAMA_API int  llama_bcast_layer_setup (struct llama_context * ctx, uint32_t * n_layer_window, uint32_t * n_gpu_layers);
+    LLAMA_API int  llama_profile_links     (struct llama_context * ctx, struct device_info * dev_info);
+    LLAMA_API int  llama_bcast_layer_setup (struct llama_context * ctx, uint32_t * n_layer_window, uint32_t * n_layer_extra, uint32_t * n_gpu_layers, uint32_t * tp_ffn_share);
     LLAMA_API int  llama_rebuild_topo      (struct llama_context * ctx, 
                                                         uint32_t * n_layer_window, 
                                               struct device_info * desv_info_set, 
                                                          NodeType* node_type,
                                                          char    * is_forwarder);
     LLAMA_API int  llama_forward_messages   (struct llama_context * ctx);
-    LLAMA_API int  llama_recv_layer_setup  (struct llama_context * ctx, uint32_t * n_layer_window, uint32_t * n_gpu_layers);
+    LLAMA_API int  llama_recv_layer_setup  (struct llama_context * ctx, uint32_t * n_layer_window, uint32_t * n_layer_extra, uint32_t * n_gpu_layers, uint32_t * tp_ffn_share);
+
+    // master only: collect the measured cost of every rank around the ring into perf_set[n_world]
+    LLAMA_API int  llama_gather_rank_perf  (struct llama_context * ctx, struct llama_rank_perf * perf_set);
+
+    // master only: move the layer windows between ranks at a token boundary, n_layer_extra and n_gpu_layers may be NULL.
+    // only the ranks whose layers change reload their weights and rebuild their context, the kv cache of the moved
+    // layers is sent to their new ranks. returns 0 if the kv cache was kept, 1 if it was cleared on all ranks and the
+    // sequence has to be evaluated again. the set of ranks holding layers cannot change. FFN splits between
+    // neighbouring ranks (tp_ffn_share) end with the old windows
+    LLAMA_API int  llama_reshard           (struct llama_context * ctx, 
+                                                  const uint32_t * n_layer_window, 
+                                                  const uint32_t * n_layer_extra, 
+                                                  const uint32_t * n_gpu_layers);
+
+    // start the heartbeat of this device, on the master start watching its signal port for the heartbeats
+    // of the others and for join requests. no-op on the other devices unless fail_timeout is set
+    LLAMA_API void    llama_start_heartbeat(struct llama_context * ctx);
+
+    // master only: the rank that stopped sending heartbeats, -1 if the ring is healthy
+    LLAMA_API int32_t llama_failed_rank    (struct llama_context * ctx);
+
+    // master only: rebuild the ring without failed_rank, the ranks after it move down by one.
+    // n_layer_window and n_layer_extra have n_world - 1 entries and take the layers of the failed rank.
+    // with kv_replicate set on all devices, the kv cache of the failed rank is restored from the replica of the
+    // rank after it and 0 is returned; the cells of the aborted batch are still in use then. otherwise, or when the
+    // replica is out of date after a K-shift or defrag, the kv cache is cleared on all ranks, 1 is returned
+    // and the sequence has to be evaluated again
+    LLAMA_API int     llama_recover_ring   (struct llama_context * ctx,
+                                                        uint32_t   failed_rank,
+                                                  const uint32_t * n_layer_window,
+                                                  const uint32_t * n_layer_extra);
+
+    // a device asking to join a running ring, as seen by the master
+    struct llama_join_request {
+        uint32_t bind_rank; // the device listens on the ports of this rank
+        char     ip[64];
+    };
+
+    // what the master tells a device it takes into the ring
+    struct llama_join_setup {
+        uint32_t rank;
+        uint32_t n_world;
+        uint32_t n_ctx;
+        uint32_t n_layer_window[32];
+        uint32_t n_layer_extra[32];
+        uint32_t n_gpu_layers[32];
+    };
+
+    // new device: bind the ports of bind_rank, send dev_info to the master and wait until it is taken into the ring
+    // after the last rank. returns non-zero if the master turned it away
+    LLAMA_API int     llama_join_ring      (struct llama_context * ctx,
+                                                        uint32_t   bind_rank,
+                                       const struct device_info * dev_info,
+                                         struct llama_join_setup * setup);
+
+    // master only: wait up to timeout_ms for a device asking to join and take its request, with req NULL only
+    // check for one. needs llama_start_heartbeat
+    LLAMA_API bool    llama_poll_join      (struct llama_context * ctx,
+                                                         int32_t   timeout_ms,
+                                       struct llama_join_request * req,
+                                              struct device_info * dev_info);
+
+    // master only: take the device of req into the ring as rank n_world, only the last rank reconnects.
+    // n_layer_window and n_layer_extra have n_world + 1 entries, n_layer_extra and n_gpu_layers may be NULL,
+    // with n_layer_window NULL the device is turned away. the kv cache of the moved layers is sent to their
+    // new ranks, returns 0 if it was kept and 1 if it was cleared on all ranks, as llama_reshard
+    LLAMA_API int     llama_admit_device   (struct llama_context * ctx,
+                                 const struct llama_join_request * req,
+                                                  const uint32_t * n_layer_window,
+                                                  const uint32_t * n_layer_extra,
+                                                  const uint32_t * n_gpu_layers);
 
     LLAMA_API int llm_load_tensors(
               struct llama_model_loader * ml,
@@ -506,6 +618,8 @@ extern "C" {
                    struct llama_context * ctx);
     
     LLAMA_API uint32_t * llama_context_n_layer_window(struct llama_context * ctx);
+    LLAMA_API uint32_t * llama_context_n_layer_extra (struct llama_context * ctx);
+    LLAMA_API uint32_t * llama_context_tp_ffn_share  (struct llama_context * ctx);
 
     // Frees all allocated memory
     LLAMA_API void llama_free(struct llama_context * ctx);
@@ -567,6 +681,9 @@ extern "C" {
     // Returns the number of model layers in the model
     LLAMA_API uint32_t llama_model_n_layers(const struct llama_model * model);
 
+    // Returns the bytes of the weights of layers [il0, il1), -1 if llama_model_n_flops has not counted them
+    LLAMA_API int64_t  llama_model_layers_nbytes(const struct llama_model * model, int32_t il0, int32_t il1);
+
     // Retrieve or set the number of GPU layers
     LLAMA_API uint32_t llama_model_n_gpu_layers(const struct llama_model * model);
     LLAMA_API void     llama_model_set_n_gpu_layers(struct llama_model * model, uint32_t value);
@@ -988,6 +1105,7 @@ extern "C" {
     // Positive return values does not mean a fatal error, but rather a warning.
     //   0 - success
     //   1 - could not find a KV slot for the batch (try reducing the size of the batch or increase the context)
+    //  -3 - a rank of the ring failed, see llama_failed_rank and llama_recover_ring
     // < 0 - error
     LLAMA_API int32_t llama_decode(
             struct llama_context * ctx,
@@ -1366,11 +1484,29 @@ extern "C" {
         double t_load_ms;
         double t_p_eval_ms;
         double t_eval_ms;
+        double t_comm_ms;      // time spent sending and receiving activations
+        double t_comm_wait_ms; // part of t_comm_ms the compute thread was blocked on
+        double mb_released;    // MiB of layer window pages evicted from the page cache after their compute
+        double mb_refaulted;   // MiB of evicted pages still out of the page cache when their window was computed again
+        double resident_pct;   // share of window weights resident at compute start, averaged over windows, 0 without residency_stats
+        double t_compute_ms;   // time spent computing layer windows
+        double t_prefetch_ms;  // time blocked on weight streaming, page release and prefetch advice
+
+        int64_t n_major_faults; // major page faults taken while computing layer windows
 
         int32_t n_p_eval;
         int32_t n_eval;
     };
 
+    // per-subgraph breakdown of the telemetry above, indexed by the local layer window
+    struct llama_perf_window_data {
+        double  resident_pct;
+        double  t_compute_ms;
+        double  t_prefetch_ms;
+        int64_t n_major_faults;
+        int32_t n_runs;
+    };
+
     struct llama_perf_sampler_data {
         double t_sample_ms;
 
@@ -1382,6 +1518,9 @@ extern "C" {
     LLAMA_API void                           llama_perf_context_reset(      struct llama_context * ctx);
     LLAMA_API void                           llama_perf_context_sync (      struct llama_context * ctx, const struct llama_model * model);
 
+    LLAMA_API int32_t                        llama_perf_context_n_windows(const struct llama_context * ctx);
+    LLAMA_API struct llama_perf_window_data  llama_perf_context_window   (const struct llama_context * ctx, int32_t i);
+
     // NOTE: the following work only with samplers constructed via llama_sampler_chain_init
     LLAMA_API struct llama_perf_sampler_data llama_perf_sampler      (const struct llama_sampler * chain);
     LLAMA_API void                           llama_perf_sampler_print(const struct llama_sampler * chain);
@@ -0,0 +1,7 @@
+#pragma once
+
+#include "llama-impl.h"
+
+// encode n f32 activations into the wire type of the ring (f32, f16, bf16 or q8_0), return the number of bytes written
+size_t llama_comm_encode(ggml_type type, const float * src, int64_t n, uint8_t * dst);
+void   llama_comm_decode(ggml_type type, const void * src, int64_t n, float * dst);
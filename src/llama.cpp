@@ -1,6 +1,7 @@
 #include "zmq_addon.hpp"
 
 #include "llama-impl.h"
+#include "llama-comm.h"
 #include "llama-vocab.h"
 #include "llama-sampling.h"
 
@@ -64,18 +65,21 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <cctype>
 #include <cfloat>
 #include <cinttypes>
 #include <climits>
 #include <cmath>
+#include <condition_variable>
 #include <cstdarg>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <ctime>
+#include <deque>
 #include <fstream>
 #include <functional>
 #include <future>
@@ -101,6 +105,9 @@
 // bump if necessary
 #define LLAMA_MAX_LAYERS  512
 #define LLAMA_MAX_EXPERTS 160  // DeepSeekV2
+#define LLAMA_TP_MAX_TOKENS 8  // larger batches split the FFN with a next node that is busy with its own window
+#define LLAMA_KV_PAGE_SIZE  16 // cells per page of the KV cache of transformer models
+#define LLAMA_KV_MAX_RUNS   32 // ubatches spread over more runs of cells are split further by the caller
 
 #define timer(name) auto _timer_##name = Timer(#name)
 
@@ -2290,6 +2297,250 @@ struct llama_mlock {
 };
 using llama_mlocks = std::vector<std::unique_ptr<llama_mlock>>;
 
+// streams the weights of the CPU-resident layer windows from the model files into a ring of two staging
+// slots, so that the read of window w + 1 overlaps the compute of window w, and the memory used by these
+// weights stays bounded by two windows whatever the page cache does
+struct llama_weight_stream {
+    // a page-aligned file range and where it lands in its slot
+    struct extent {
+        int       fd;
+        size_t    offs;
+        size_t    size;
+        uint8_t * dst;
+    };
+
+    // where the data of a streamed tensor lives in the model files
+    struct source {
+        struct ggml_tensor * tensor;
+        int                  fd;
+        size_t               offs;
+    };
+
+    static constexpr size_t ALIGNMENT  = 4096;            // O_DIRECT requires aligned offsets, sizes and buffers
+    static constexpr size_t CHUNK_SIZE = 4 * 1024 * 1024; // granularity at which reads are spread over the threads
+
+    std::vector<int>                 fds;
+    std::vector<std::vector<extent>> win_extents;       // extents of each window, pointing into slot (w % 2)
+    std::unordered_map<const struct ggml_tensor *, int> tensor_win;
+
+    uint8_t * slots[2]        = {nullptr, nullptr};
+    size_t    slot_size       = 0;
+    int       slot_win[2]     = {-1, -1}; // window held by, or being read into, each slot
+    int       slot_pending[2] = {0, 0};   // chunks of that window not read yet
+
+    std::deque<std::pair<int, extent>> queue; // (slot, chunk)
+    std::vector<std::thread>           workers;
+    std::mutex                         mutex;
+    std::condition_variable            cond_work;
+    std::condition_variable            cond_done;
+    bool                               stop   = false;
+    int                                error  = 0;
+
+    int64_t  t_wait_us    = 0; // time the compute thread was blocked on reads
+    uint64_t n_bytes_read = 0;
+
+    llama_weight_stream() = default;
+    llama_weight_stream(const llama_weight_stream &) = delete;
+
+#ifdef _POSIX_MAPPED_FILES
+    static constexpr bool SUPPORTED = true;
+
+    ~llama_weight_stream() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        cond_work.notify_all();
+        for (auto & t : workers) {
+            t.join();
+        }
+        for (int fd : fds) {
+            close(fd);
+        }
+        free(slots[0]);
+        free(slots[1]);
+    }
+
+    // open a private descriptor on the same file, bypassing the page cache if the file system allows it
+    static int open_file(int fd_src) {
+        char path[64];
+        snprintf(path, sizeof(path), "/proc/self/fd/%d", fd_src);
+#if defined(O_DIRECT)
+        int fd = open(path, O_RDONLY | O_DIRECT);
+        if (fd >= 0) {
+            void * probe = nullptr;
+            bool   ok    = posix_memalign(&probe, ALIGNMENT, ALIGNMENT) == 0 && pread(fd, probe, ALIGNMENT, 0) >= 0;
+            free(probe);
+            if (ok) {
+                return fd;
+            }
+            close(fd);
+        }
+#endif
+        int fd_buf = open(path, O_RDONLY);
+        if (fd_buf < 0) {
+            fd_buf = dup(fd_src); // no procfs
+        }
+#if defined(F_NOCACHE)
+        fcntl(fd_buf, F_NOCACHE, 1);
+#endif
+        return fd_buf;
+    }
+
+    // lay out the file ranges of the given tensors in a slot and point the tensors at them
+    void add_window(int w, std::vector<source> sources) {
+        if ((int) win_extents.size() <= w) {
+            win_extents.resize(w + 1);
+        }
+
+        // tensors of a window are mostly contiguous in the file, merge them into few large reads
+        std::sort(sources.begin(), sources.end(), [](const source & a, const source & b) {
+            return a.fd < b.fd || (a.fd == b.fd && a.offs < b.offs);
+        });
+
+        auto & extents = win_extents[w];
+        size_t used    = 0;
+        for (const auto & src : sources) {
+            struct ggml_tensor * cur = src.tensor;
+            const int    fd    = src.fd;
+            const size_t first = src.offs - src.offs % ALIGNMENT;
+            const size_t last  = GGML_PAD(src.offs + ggml_nbytes(cur), ALIGNMENT);
+
+            if (extents.empty() || extents.back().fd != fd || first > extents.back().offs + extents.back().size) {
+                extents.push_back({fd, first, 0, (uint8_t *) used});
+            }
+            extent & e = extents.back();
+            e.size = std::max(e.size, last - e.offs);
+            used   = (size_t) e.dst + e.size;
+
+            // the slot is allocated later, keep the offset in it for now
+            cur->data = (uint8_t *) e.dst + (src.offs - e.offs);
+            tensor_win[cur] = w;
+        }
+        slot_size = std::max(slot_size, used);
+    }
+
+    bool start() {
+        for (int s = 0; s < 2; ++s) {
+            void * ptr = nullptr;
+            if (posix_memalign(&ptr, ALIGNMENT, std::max(slot_size, ALIGNMENT)) != 0) {
+                return false;
+            }
+            slots[s] = (uint8_t *) ptr;
+        }
+        for (size_t w = 0; w < win_extents.size(); ++w) {
+            uint8_t * base = slots[w % 2];
+            for (auto & e : win_extents[w]) {
+                e.dst = base + (size_t) e.dst;
+            }
+        }
+        for (auto & it : tensor_win) {
+            struct ggml_tensor * cur = const_cast<struct ggml_tensor *>(it.first);
+            cur->data = slots[it.second % 2] + (size_t) cur->data;
+        }
+        return true;
+    }
+
+    // the reads are issued by the threads of the context that computes the windows
+    void spawn(int n_threads) {
+        if (!workers.empty()) return;
+        for (int i = 0; i < std::max(1, n_threads); ++i) {
+            workers.emplace_back([this] { worker(); });
+        }
+    }
+
+    void worker() {
+        while (true) {
+            std::pair<int, extent> job;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cond_work.wait(lock, [this] { return stop || !queue.empty(); });
+                if (stop) return;
+                job = queue.front();
+                queue.pop_front();
+            }
+
+            const extent & e = job.second;
+            size_t done = 0;
+            int    err  = 0;
+            while (done < e.size) {
+                ssize_t ret = pread(e.fd, e.dst + done, e.size - done, e.offs + done);
+                if (ret < 0 && errno == EINTR) continue;
+                if (ret < 0) { err = errno; break; }
+                if (ret == 0) break; // the last extent may run past the end of the file
+                done += ret;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                n_bytes_read += done;
+                if (err != 0) error = err;
+                if (--slot_pending[job.first] == 0) {
+                    cond_done.notify_all();
+                }
+            }
+        }
+    }
+
+    // start reading window w into its slot, unless it is already there
+    void request(int w) {
+        const int s = w % 2;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (slot_win[s] == w) return;
+            GGML_ASSERT(slot_pending[s] == 0 && "slot is still being read");
+
+            slot_win[s] = w;
+            for (const auto & e : win_extents[w]) {
+                for (size_t off = 0; off < e.size; off += CHUNK_SIZE) {
+                    queue.push_back({s, {e.fd, e.offs + off, std::min(CHUNK_SIZE, e.size - off), e.dst + off}});
+                    slot_pending[s]++;
+                }
+            }
+        }
+        cond_work.notify_all();
+    }
+
+    // block until window w is in its slot, then start reading the window that follows it
+    void acquire(int w) {
+        request(w);
+        {
+            const int64_t t_start_us = ggml_time_us();
+            std::unique_lock<std::mutex> lock(mutex);
+            cond_done.wait(lock, [&] { return slot_pending[w % 2] == 0; });
+            t_wait_us += ggml_time_us() - t_start_us;
+            if (error != 0) {
+                throw std::runtime_error(format("failed to stream layer weights: %s", strerror(error)));
+            }
+        }
+        // with an odd number of windows the last and the first one share a slot, that read cannot be overlapped
+        const int w_next = (w + 1) % win_extents.size();
+        if (w_next % 2 != w % 2) {
+            request(w_next);
+        }
+    }
+#else
+    static constexpr bool SUPPORTED = false;
+
+    static int open_file(int) { return -1; }
+    void add_window(int, std::vector<source>) {}
+    bool start() { return false; }
+    void spawn(int) {}
+    void acquire(int) {}
+#endif
+
+    // window whose weights a subgraph uses, -1 if it does not use streamed weights
+    int window_of(struct ggml_cgraph * gf) const {
+        for (int i = 0; i < ggml_graph_n_leafs(gf); i++) {
+            auto it = tensor_win.find(ggml_graph_leaf(gf, i));
+            if (it != tensor_win.end()) {
+                return it->second;
+            }
+        }
+        return -1;
+    }
+};
+
 // NOTE: avoid ever using this except for building the token_to_piece caches
 static std::string llama_token_to_piece(const struct llama_model * model, llama_token token, bool special) {
     std::string piece;
@@ -2602,11 +2853,19 @@ struct llama_cparams {
     uint32_t  worker_rank;
     uint32_t  original_next_rank; // original rank of the next node
     uint32_t  n_layer_window[32];
+    uint32_t  n_layer_extra[32];
+    uint32_t  tp_ffn_share[32]; // per mille of the FFN rows of its CPU layers each rank computes, see llama_tp
     bool      prefetch;
     bool      force;
+    enum llama_release_policy release_policy; // release the pages of computed layer windows under memory pressure
+    bool      async_comm;      // overlap activation transfers with compute on dedicated threads
+    bool      residency_stats; // sample the residency of each layer window at compute start
+    bool      kv_replicate;    // send the kv cache cells written by each pass along to the next device
+    ggml_type comm_type;       // data type of activations sent to the next device
     uint32_t  n_ctx;           // context size used during inference
     uint32_t  n_batch;
     uint32_t  n_ubatch;
+    uint32_t  n_micro_batch;   // micro-batch size to pipeline prefill across devices, 0 = disabled
     uint32_t  n_seq_max;
     int       n_threads;       // number of threads to use for generation
     int       n_threads_batch; // number of threads to use for batch processing
@@ -2825,6 +3084,21 @@ struct llama_kv_cell {
     }
 };
 
+// a fixed-size block of cells, the unit in which the KV cache hands out cells to sequences
+struct llama_kv_page {
+    uint32_t n_used = 0; // the next token of the owners goes to cell n_used of the page
+
+    // sequences that hold the page in their block table, more than one for a shared prefix
+    std::set<llama_seq_id> seq_id;
+};
+
+// cells of a ubatch that are stored in one piece, tokens [i_token, i_token + n) go to cells [cell, cell + n)
+struct llama_kv_run {
+    uint32_t i_token;
+    uint32_t cell;
+    uint32_t n;
+};
+
 // ring-buffer of cached KV data
 struct llama_kv_cache {
     bool has_shift = false;
@@ -2847,6 +3121,18 @@ struct llama_kv_cache {
 
     std::vector<llama_kv_cell> cells;
 
+    // the cells of transformer models are handed out a page at a time, so a new token never searches the
+    // cache and freed pages are reused as they are, without defragmentation. each sequence lists its pages
+    // in a block table, a page shared by several sequences is freed with its last one. the pages follow
+    // from the cells, every rank replays the same kv commands and ends up with the same layout
+    uint32_t page_size = 0; // 0 for recurrent models
+    std::vector<llama_kv_page> pages;
+    std::set<uint32_t> free_pages; // the lowest page is taken first, which keeps the attended range short
+    std::map<llama_seq_id, std::vector<uint32_t>> block_tables;
+
+    // placement of the current ubatch when it does not fit one run of cells from head on, empty otherwise
+    std::vector<llama_kv_run> runs;
+
     std::vector<struct ggml_tensor *> k_l; // per layer
     std::vector<struct ggml_tensor *> v_l;
 
@@ -2935,6 +3221,9 @@ struct llama_model {
 
     std::vector<llama_layer> layers;
 
+    // bytes of the weights of each layer, the layers of a hybrid quantized model differ in size
+    std::vector<int64_t> layer_nbytes;
+
     // gguf metadata
     std::unordered_map<std::string, std::string> gguf_kv;
 
@@ -2970,6 +3259,13 @@ struct llama_model {
     // model memory mapped files
     llama_mmaps mappings;
 
+    // reads the CPU-resident layer windows into staging slots, if weight streaming is enabled
+    std::unique_ptr<llama_weight_stream> stream;
+
+    // where the weights were loaded from, to load another layer window when the ring is resharded
+    std::string               path;
+    struct llama_model_params load_params = {};
+
     // objects representing data potentially being locked in memory
     llama_mlocks mlock_bufs;
     llama_mlocks mlock_mmaps;
@@ -3045,7 +3341,8 @@ struct llama_sbatch {
         }
         ubatch_token.resize(!has_embd ? n_ubatch : 0);
         ubatch_embd.resize(has_embd ? n_embd * n_ubatch : 0);
-        ubatch_backend_embd.resize(n_embd * n_tokens);
+        // the second half takes a receive posted while the first one backs the running subgraph
+        ubatch_backend_embd.resize(2 * n_embd * n_tokens);
         ubatch_out_embd.resize(n_embd * n_tokens);
         ubatch_pos.resize(n_ubatch);
         ubatch_n_seq_id.resize(n_ubatch);
@@ -3334,6 +3631,308 @@ struct llama_sbatch {
     }
 };
 
+// copy of the kv cache of the previous device in the ring, kept up to date from the cells its passes write,
+// so that its layers can be taken over without evaluating the sequence again when it fails
+struct llama_kv_replica {
+    struct layer {
+        ggml_type            type_k = GGML_TYPE_F16;
+        ggml_type            type_v = GGML_TYPE_F16;
+        std::vector<uint8_t> k; // laid out like the tensors of the kv cache
+        std::vector<uint8_t> v;
+    };
+
+    std::mutex                  mutex;  // guards deltas, the receiving thread queues them
+    std::vector<zmq::message_t> deltas; // received but not applied yet, see llama_kv_replica_delta
+
+    bool                      valid = true; // false after a K-shift or defrag, until the next full copy arrives
+    std::map<uint32_t, layer> layers;       // by layer id
+};
+
+// activation transfers of a context. with async comm, sends and receives run on one thread per socket
+// direction, so that encoding and sending the output of a subgraph, and receiving the input of the next
+// one, overlap with graph compute and weight prefetching on the compute thread
+struct llama_ring;
+
+struct llama_comm {
+    struct send_job {
+        zmq::socket_t *        socket    = nullptr;
+        float *                embd      = nullptr; // staging buffer taken from the pool
+        int64_t                ne[2]     = {0, 0};
+        std::vector<llama_pos> pos;
+        bool                   to_master = false;
+        std::vector<uint8_t>   kv_delta;          // kv cells written for this output, for the replica of the next device
+        std::vector<zmq::message_t> frames;       // activations of another device passed on as they are, see pass_on
+    };
+
+    struct recv_job {
+        zmq::socket_t *        socket      = nullptr;
+        float *                embd        = nullptr; // destination of the decoded activations
+        std::vector<llama_pos> pos;
+        int64_t                n_pos       = 0;
+        bool                   is_out_embd = false;
+    };
+
+    ggml_type comm_type = GGML_TYPE_F32;
+
+    // staging buffer to encode outgoing activations into comm_type
+    std::vector<uint8_t> buf;
+
+    // final-layer activations that reached the master while it was still receiving
+    // earlier micro-batches from its predecessor
+    std::deque<std::vector<zmq::message_t>> pending;
+
+    // pinned staging buffers for outgoing activations, bounded so that a slow link
+    // applies back-pressure to the compute thread
+    std::vector<ggml_backend_buffer_t> bufs_send;
+    std::vector<float *>               bufs_free;
+
+    std::deque<send_job> send_queue;
+    std::deque<recv_job> recv_queue;
+    std::deque<recv_job> recv_done;
+    size_t               n_sending = 0;
+    size_t               n_pos_max = 0;
+    std::atomic<bool>    stop{false}; // read without the mutex by a receive that waits for its socket
+
+    // a receive wakes up this often to see whether the comm is stopped, see llama_recv_tensors
+    static constexpr int recv_poll_ms = 100;
+
+    std::mutex              mutex;
+    std::condition_variable cond;
+
+    std::thread send_thread;
+    std::thread recv_thread;
+
+    // bumped whenever the ring is rebuilt, activations sent on an older ring are dropped
+    std::atomic<uint32_t> epoch{0};
+
+    // set while fault tolerance is enabled, lets a receive give up on a broken ring
+    llama_ring * ring = nullptr;
+
+    // set with kv_replicate, receives the kv cells sent along with the activations
+    llama_kv_replica * replica = nullptr;
+
+    // set on the devices other than the master to their master_socket, outputs for the master that reach
+    // a device because a previous one cannot connect to the master go on through it, see llama_route_master
+    zmq::socket_t * const * relay = nullptr;
+
+    std::atomic<int64_t> t_comm_us{0};      // time spent transferring activations
+    std::atomic<int64_t> t_send_us{0};      // part of it spent sending, never reset
+    int64_t              t_comm_wait_us = 0; // part of it the compute thread was blocked on
+
+    ~llama_comm() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        cond.notify_all();
+
+        if (send_thread.joinable()) {
+            send_thread.join();
+        }
+        if (recv_thread.joinable()) {
+            recv_thread.join();
+        }
+
+        for (ggml_backend_buffer_t b : bufs_send) {
+            ggml_backend_buffer_free(b);
+        }
+    }
+
+    bool is_async() const {
+        return send_thread.joinable();
+    }
+
+    void start(ggml_backend_buffer_type_t buft, size_t n_bufs, size_t n_embd, size_t n_tokens) {
+        GGML_ASSERT(!is_async());
+
+        for (size_t i = 0; i < n_bufs; ++i) {
+            ggml_backend_buffer_t b = ggml_backend_buft_alloc_buffer(buft, n_embd * n_tokens * sizeof(float));
+            GGML_ASSERT(b != nullptr && "failed to allocate comm buffer");
+            bufs_send.push_back(b);
+            bufs_free.push_back((float *) ggml_backend_buffer_get_base(b));
+        }
+        n_pos_max = n_tokens;
+
+        send_thread = std::thread(&llama_comm::send_loop, this);
+        recv_thread = std::thread(&llama_comm::recv_loop, this);
+    }
+
+    // take a free staging buffer, blocks while all of them are in flight
+    float * acquire() {
+        const int64_t t_start_us = ggml_time_us();
+        std::unique_lock<std::mutex> lock(mutex);
+        cond.wait(lock, [&]{ return !bufs_free.empty(); });
+        float * b = bufs_free.back();
+        bufs_free.pop_back();
+        t_comm_wait_us += ggml_time_us() - t_start_us;
+        return b;
+    }
+
+    void send(send_job && job) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            send_queue.push_back(std::move(job));
+        }
+        cond.notify_all();
+    }
+
+    void post_recv(zmq::socket_t * socket, float * embd, bool is_out_embd) {
+        recv_job job;
+        job.socket      = socket;
+        job.embd        = embd;
+        job.is_out_embd = is_out_embd;
+        job.pos.resize(n_pos_max);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            recv_queue.push_back(std::move(job));
+        }
+        cond.notify_all();
+    }
+
+    // wait for the oldest posted receive and copy the positions that came with it, return where the activations landed
+    float * wait_recv(llama_pos * pos, size_t n_pos) {
+        const int64_t t_start_us = ggml_time_us();
+        std::unique_lock<std::mutex> lock(mutex);
+        cond.wait(lock, [&]{ return !recv_done.empty(); });
+        recv_job job = std::move(recv_done.front());
+        recv_done.pop_front();
+        lock.unlock();
+
+        t_comm_wait_us += ggml_time_us() - t_start_us;
+        if (job.n_pos < 0) {
+            return nullptr; // the pass was aborted, see llama_recv_tensors
+        }
+        std::memcpy(pos, job.pos.data(), std::min(n_pos, (size_t) job.n_pos) * sizeof(llama_pos));
+        return job.embd;
+    }
+
+    // forget the receives of an aborted pass, the queued sends still go out
+    void reset() {
+        flush();
+        std::lock_guard<std::mutex> lock(mutex);
+        recv_queue.clear();
+        recv_done.clear();
+        pending.clear();
+    }
+
+    // wait until all queued sends are on the wire, the sockets can be used by the caller afterwards
+    void flush() {
+        const int64_t t_start_us = ggml_time_us();
+        std::unique_lock<std::mutex> lock(mutex);
+        cond.wait(lock, [&]{ return send_queue.empty() && n_sending == 0; });
+        t_comm_wait_us += ggml_time_us() - t_start_us;
+    }
+
+    // pass activations for the master on, through the send thread if there is one as zmq sockets are not thread-safe
+    void pass_on(std::vector<zmq::message_t> && msgs);
+
+    void send_loop();
+    void recv_loop();
+};
+
+// fault tolerance of the ring: the devices heartbeat the master on its signal port, the master
+// declares a rank dead once it stays silent for fail_timeout_ms and rebuilds the ring without it
+struct llama_ring {
+    uint32_t fail_timeout_ms = 0; // 0 = disabled
+
+    std::thread       thread; // heartbeat sender on the devices, heartbeat monitor on the master
+    std::atomic<bool> stop{false};
+
+    // first rank the master found dead, -1 while all ranks are alive
+    std::atomic<int32_t> failed_rank{-1};
+
+    // what the master heard from each rank, the address of rank r is the next node reported by rank r - 1
+    struct peer {
+        int64_t     t_last_us = 0;
+        uint32_t    next_bind_rank = 0; // ports are derived from the rank a device had when it bound them
+        std::string next_ip;
+    };
+    std::mutex        mutex; // guards the fields below, and next_node_ip and original_next_rank of the context
+    std::vector<peer> peers;
+    uint32_t          rank  = 0; // rank and epoch the heartbeats carry
+    uint32_t          epoch = 0;
+
+    // a recovery command that arrived while this device waited for activations
+    std::vector<uint8_t> recover_frame;
+
+    // on the master, devices that asked to join with their serialized device_info, guarded by mutex
+    struct join_entry {
+        llama_join_request   req;
+        std::vector<uint8_t> dev_info;
+    };
+    std::deque<join_entry>  joins;
+    std::condition_variable joins_cv;
+
+    ~llama_ring() {
+        halt();
+    }
+
+    bool enabled() const {
+        return fail_timeout_ms > 0;
+    }
+
+    uint32_t heartbeat_ms() const {
+        return std::max<uint32_t>(100, fail_timeout_ms / 5);
+    }
+
+    void halt() {
+        stop = true;
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+};
+
+// tensor parallelism of the FFN between a node and its next node: the node keeps the first rows of ffn_gate and
+// ffn_up with the matching columns of ffn_down, and hands the input of the FFN to its next node, which computes the
+// partial output of the other rows while it waits for activations anyway. the node adds it to its own
+struct llama_tp {
+    // the FFN input of a layer sent to the next node, followed by the activations in f32
+    struct request {
+        uint32_t il;
+        uint32_t n_keep; // rows computed by the sender
+        int64_t  n_tokens;
+    };
+
+    // userdata of the graph nodes that exchange the FFN input and output of a layer
+    struct layer {
+        llama_tp * tp     = nullptr;
+        uint32_t   il     = 0;
+        uint32_t   n_keep = 0;
+    };
+
+    // on a node that splits its FFN
+    zmq::socket_t *    socket     = nullptr; // REQ to the next node
+    uint32_t           timeout_ms = 0;
+    bool               broken     = false;   // the next node did not answer, the split is dropped before the next pass
+    std::vector<layer> layers;               // by layer id, sized once as the graphs point into it
+
+    // on the next node, serves the rows split off by the previous node from its own mapping of the model file
+    std::thread       thread;
+    std::atomic<bool> stop{false};
+
+    bool started = false; // set up on the first pass, when the ring is final
+
+    ~llama_tp() {
+        halt();
+    }
+
+    void halt() {
+        stop = true;
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+    void close() {
+        if (socket != nullptr) {
+            socket->close();
+            delete socket;
+            socket = nullptr;
+        }
+    }
+};
+
 struct llama_context {
     llama_context(const llama_model & model)
         : model(model)
@@ -3415,6 +4014,58 @@ struct llama_context {
     std::vector<uint8_t> buf_compute_meta;
     std::vector<ggml_backend_sched_t> sched = {};
 
+    // subgraphs of the last decode graphs that are not allocated on their scheduler yet, a scheduler
+    // is allocated right before its subgraph runs, so a rebuild only costs the schedulers that are used
+    std::vector<bool> sched_pending;
+
+    // decode graphs of the last two shapes, reused while the shape is the same. the full micro-batches of a ubatch
+    // and its shorter last one each keep their graphs, so both are built once instead of once per subgraph
+    struct graph_cache {
+        struct entry {
+            bool     valid     = false;
+            uint32_t n_tokens  = 0;
+            uint32_t n_kv      = 0;
+            int32_t  n_outputs = 0;
+            bool     inp_embd  = false;
+
+            // tokens in each run of cells of a ubatch stored in several runs, see llama_kv_cache::runs
+            std::vector<uint32_t> run_n;
+
+            std::vector<ggml_cgraph *> gf;
+
+            // KV store views and the copies into them, their offsets follow the KV head or the cell of their run
+            std::vector<ggml_tensor *> kv_stores;
+            std::vector<uint32_t>      kv_store_runs;
+
+            // the lctx.inp_* tensors of these graphs, see llama_graph_inputs
+            std::vector<ggml_tensor *> inputs;
+
+            // tensors the build placed on a backend, placed again when a scheduler is reset for these graphs
+            struct pin {
+                int            sub_gf_id;
+                ggml_tensor  * tensor;
+                ggml_backend_t backend;
+            };
+            std::vector<pin> pins;
+
+            // the graphs and their tensor meta data, buf_compute_meta holds any graph that is not cached
+            std::vector<uint8_t> buf_meta;
+        };
+
+        std::array<entry, 2> entries;
+
+        int cur  = -1;      // entry the schedulers are set up for, -1 after any other graph took them
+        int last = -1;      // entry used last, the other one is replaced by a new shape
+        entry * building = nullptr; // entry whose graphs llama_build_graph is building
+
+        void clear() {
+            for (auto & e : entries) {
+                e.valid = false;
+            }
+            cur = -1;
+        }
+    } graph_cache;
+
     ggml_abort_callback abort_callback      = nullptr;
     void *              abort_callback_data = nullptr;
 
@@ -3442,11 +4093,64 @@ struct llama_context {
     std::string      next_node_ip  = "127.0.0.1";
     uint32_t         data_port     = 9000;
     uint32_t         signal_port   = 10000;
+    uint32_t         tp_port       = 11000;
     zmq::context_t * sock_context  = nullptr;
     zmq::socket_t  * send_socket   = nullptr; 
     zmq::socket_t  * recv_socket   = nullptr; 
     zmq::socket_t  * master_socket = nullptr; 
     zmq::socket_t  * signal_socket = nullptr;
+    uint32_t         bind_rank     = 0; // rank when the sockets were bound, the ports stay with it
+    bool             master_direct = false; // master_socket is a link of its own to the master, see llama_route_master
+
+    // activation transfers to and from the neighbouring devices
+    struct llama_comm comm;
+
+    // heartbeats and failure detection
+    struct llama_ring ring;
+
+    // FFN rows computed on the next node, and the rows of the previous node computed here
+    struct llama_tp tp;
+
+    // reused buffers of the control messages (batch metadata and KV cache commands), the
+    // batch arrays of a received message point into recv_buf until the next one arrives
+    struct meta_buffers {
+        std::vector<uint8_t>        send_buf;
+        std::vector<uint8_t>        recv_buf;
+        std::vector<llama_seq_id *> seq_id;
+        std::vector<zmq::message_t> handoff; // parts of a received META_CMD_KV_HANDOFF after its header
+    } meta_arena;
+
+    // kv cache of the layers that change hands when the layer windows change, see llama_kv_handoff
+    struct kv_handoff_state {
+        std::vector<int32_t> src;          // by layer, rank that sends its cells, -1 if the layer stays where it is
+        std::vector<int32_t> dst;          // by layer, rank that holds it afterwards
+        std::vector<bool>    from_replica; // the layer belonged to a failed rank, its cells come from the replica
+        std::map<uint32_t, std::vector<uint8_t>> saved; // layers of this rank saved before its context was rebuilt
+        bool                 lost = false; // cells of a layer could not be kept
+    } kv_handoff;
+
+    struct llama_kv_replica kv_replica;
+
+    // per-subgraph residency and fault telemetry
+    struct window_perf {
+        double  resident_pct  = 0.0; // summed over runs, only sampled with residency_stats
+        int64_t n_maj_faults  = 0;
+        int64_t t_compute_us  = 0;
+        int64_t t_prefetch_us = 0;
+        int32_t n_runs        = 0;
+    };
+    std::vector<window_perf> win_perf;
+
+    // totals at the previous llama_gather_rank_perf, the next one reports the difference
+    struct llama_rank_perf perf_mark = {};
+
+    // parameters of the last llama_context_setup_backend, to rebuild the context when the ring is resharded
+    struct llama_context_params setup_params = {};
+
+    // bytes of each layer window given up after its last compute, 0 if still mapped
+    std::vector<size_t> win_released;
+    uint64_t            n_bytes_released  = 0;
+    uint64_t            n_bytes_refaulted = 0;
 };
 
 struct llama_lora_weight {
@@ -3626,7 +4330,27 @@ void llama_profile_device(
                         int   n_predict,
                         int   n_ctx, 
                         int   n_threads,
-                       bool   flash_attn) {
+                       bool   flash_attn,
+          const device_info * cached) {
+    const bool measure = cached == nullptr;
+    if (!measure) {
+        dev_info->disk                   = cached->disk;
+        dev_info->cpu_props              = cached->cpu_props;
+        dev_info->gpu_props              = cached->gpu_props;
+        dev_info->memory.cpu_read_ram_bw = cached->memory.cpu_read_ram_bw;
+        dev_info->memory.mem_cpy_delay   = cached->memory.mem_cpy_delay;
+    }
+
+    // the disk probes spend their time waiting on fio, so run them in the background while
+    // the GPU is profiled, the CPU probes wait for them to avoid competing for the cores
+    std::future<void> disk_probe;
+    if (measure) {
+        disk_probe = std::async(std::launch::async, [dev_info, n_threads]() {
+            device_disk_seq_bw(&dev_info->disk.read_seq_bw, &dev_info->disk.write_seq_bw, n_threads);
+            device_disk_rnd_bw(&dev_info->disk.read_rnd_bw, &dev_info->disk.write_rnd_bw, n_threads);
+        });
+    }
+
     dev_info->device_name               = device_name();
     dev_info->device_os                 = device_os();
     dev_info->cpu_props.cores           = device_cpu_cores();
@@ -3640,8 +4364,6 @@ void llama_profile_device(
     dev_info->memory.used_can_swap      = round(device_swappable_memory()     / (double)(1 << 30) * 100) / 100;
     dev_info->memory.total_swap         = round(device_swap_memory(false)     / (double)(1 << 30) * 100) / 100;
     dev_info->memory.available_swap     = round(device_swap_memory(true)      / (double)(1 << 30) * 100) / 100;
-    dev_info->memory.cpu_read_ram_bw    = device_memory_bw(n_threads);
-    dev_info->memory.mem_cpy_delay      = device_cpu_mem_copy(model, n_threads);
 
     struct model_flops  * n_flops  = &dev_info->model_flops;
     struct model_params * n_params = &dev_info->model_params;
@@ -3649,10 +4371,6 @@ void llama_profile_device(
 
     enum ggml_type inp_embd_dtype  = GGML_TYPE_F32;
     llama_model_n_flops(model, ml, n_flops, n_params, n_bytes, n_predict, n_ctx, &inp_embd_dtype, flash_attn);
-    n_flops->inp_embd_ms = device_inp_embd_delay(model, inp_embd_dtype, 1, n_threads);
-
-    device_disk_seq_bw(&dev_info->disk.read_seq_bw, &dev_info->disk.write_seq_bw, n_threads);
-    device_disk_rnd_bw(&dev_info->disk.read_rnd_bw, &dev_info->disk.write_rnd_bw, n_threads);
 
     dev_info->gpu_support.metal         = device_has_metal();
     dev_info->gpu_support.cuda          = device_has_cuda();
@@ -3670,91 +4388,70 @@ void llama_profile_device(
     dev_info->cpu_props.name                = cpu_props.name;
     dev_info->cpu_props.description         = cpu_props.description;
 
+    // only the dtypes the model actually stores are benchmarked
+    struct flops_probe {
+        enum ggml_type type;
+        float * cpu;
+        float * metal;
+        float * cuda;
+    };
+    struct cpu_props * cpu = &dev_info->cpu_props;
+    struct gpu_props * gpu = &dev_info->gpu_props;
+    const flops_probe flops_probes[] = {
+        {GGML_TYPE_F32,     &cpu->flops_f32_f32,    &gpu->metal_flops_f32_f32,    &gpu->cuda_flops_f32_f32   },
+        {GGML_TYPE_F16,     &cpu->flops_f16_f32,    &gpu->metal_flops_f16_f32,    &gpu->cuda_flops_f16_f32   },
+        {GGML_TYPE_Q2_K,    &cpu->flops_q2k_f32,    &gpu->metal_flops_q2k_f32,    &gpu->cuda_flops_q2k_f32   },
+        {GGML_TYPE_Q4_K,    &cpu->flops_q4k_f32,    &gpu->metal_flops_q4k_f32,    &gpu->cuda_flops_q4k_f32   },
+        {GGML_TYPE_Q5_K,    &cpu->flops_q5k_f32,    &gpu->metal_flops_q5k_f32,    &gpu->cuda_flops_q5k_f32   },
+        {GGML_TYPE_Q6_K,    &cpu->flops_q6k_f32,    &gpu->metal_flops_q6k_f32,    &gpu->cuda_flops_q6k_f32   },
+        {GGML_TYPE_IQ2_XXS, &cpu->flops_iq2xxs_f32, &gpu->metal_flops_iq2xxs_f32, &gpu->cuda_flops_iq2xxs_f32},
+        {GGML_TYPE_Q5_0,    &cpu->flops_q50_f32,    &gpu->metal_flops_q50_f32,    &gpu->cuda_flops_q50_f32   },
+        {GGML_TYPE_Q8_0,    &cpu->flops_q80_f32,    &gpu->metal_flops_q80_f32,    &gpu->cuda_flops_q80_f32   },
+        {GGML_TYPE_IQ1_S,   &cpu->flops_iq1s_f32,   &gpu->metal_flops_iq1s_f32,   &gpu->cuda_flops_iq1s_f32  },
+        {GGML_TYPE_IQ4_NL,  &cpu->flops_iq4nl_f32,  &gpu->metal_flops_iq4nl_f32,  &gpu->cuda_flops_iq4nl_f32 },
+        {GGML_TYPE_IQ1_M,   &cpu->flops_iq1m_f32,   &gpu->metal_flops_iq1m_f32,   &gpu->cuda_flops_iq1m_f32  },
+    };
+
 #if defined(GGML_USE_METAL) || defined(GGML_USE_CUDA)
     dev_info->gpu_props.name                = gpu_props.name;
     dev_info->gpu_props.description         = gpu_props.description;
     dev_info->gpu_props.memory_free         = round(gpu_props.memory_free / (double)(1 << 30) * 100) / 100;
     dev_info->gpu_props.memory_free         = std::min((float)gpu_mem, dev_info->gpu_props.memory_free);
     dev_info->gpu_props.memory_total        = round(gpu_props.memory_total / (double)(1 << 30) * 100) / 100;
-    dev_info->gpu_props.metal_read_vram_bw  = device_metal_read_vram_bw();
-    dev_info->gpu_props.cuda_read_vram_bw   = device_cuda_read_vram_bw();
-    dev_info->gpu_props.metal_mem_cpy_delay = device_metal_mem_copy(model);
-    dev_info->gpu_props.cuda_mem_cpy_delay  = device_cuda_mem_copy(model);
+    if (measure) {
+        dev_info->gpu_props.metal_read_vram_bw  = device_metal_read_vram_bw();
+        dev_info->gpu_props.cuda_read_vram_bw   = device_cuda_read_vram_bw();
+        dev_info->gpu_props.metal_mem_cpy_delay = device_metal_mem_copy(model);
+        dev_info->gpu_props.cuda_mem_cpy_delay  = device_cuda_mem_copy(model);
+
+        for (const auto & probe : flops_probes) {
+            if (is_dtype_exist(n_params, probe.type)) {
+                *probe.metal = device_metal_flops(model, probe.type, GGML_TYPE_F32);
+                *probe.cuda  = device_cuda_flops (model, probe.type, GGML_TYPE_F32);
+            }
+        }
+    }
 #else
     (void)gpu_mem;
 #endif
 
-    if (is_dtype_exist(n_params, GGML_TYPE_F32)) {
-        dev_info->cpu_props.flops_f32_f32         = device_cpu_flops  (model, GGML_TYPE_F32,  GGML_TYPE_F32, n_threads);
-        dev_info->gpu_props.metal_flops_f32_f32   = device_metal_flops(model, GGML_TYPE_F32,  GGML_TYPE_F32);
-        dev_info->gpu_props.cuda_flops_f32_f32    = device_cuda_flops (model, GGML_TYPE_F32,  GGML_TYPE_F32);
-    }
-
-    if (is_dtype_exist(n_params, GGML_TYPE_F16)) {
-        dev_info->cpu_props.flops_f16_f32         = device_cpu_flops  (model, GGML_TYPE_F16,  GGML_TYPE_F32, n_threads);
-        dev_info->gpu_props.metal_flops_f16_f32   = device_metal_flops(model, GGML_TYPE_F16,  GGML_TYPE_F32);
-        dev_info->gpu_props.cuda_flops_f16_f32    = device_cuda_flops (model, GGML_TYPE_F16,  GGML_TYPE_F32);
-    }
-
-    if (is_dtype_exist(n_params, GGML_TYPE_Q2_K)) {
-        dev_info->cpu_props.flops_q2k_f32         = device_cpu_flops  (model, GGML_TYPE_Q2_K, GGML_TYPE_F32, n_threads);
-        dev_info->gpu_props.metal_flops_q2k_f32   = device_metal_flops(model, GGML_TYPE_Q2_K, GGML_TYPE_F32);
-        dev_info->gpu_props.cuda_flops_q2k_f32    = device_cuda_flops (model, GGML_TYPE_Q2_K, GGML_TYPE_F32);
-    }
-
-    if (is_dtype_exist(n_params, GGML_TYPE_Q4_K)) {
-        dev_info->cpu_props.flops_q4k_f32         = device_cpu_flops  (model, GGML_TYPE_Q4_K, GGML_TYPE_F32, n_threads);
-        dev_info->gpu_props.metal_flops_q4k_f32   = device_metal_flops(model, GGML_TYPE_Q4_K, GGML_TYPE_F32);
-        dev_info->gpu_props.cuda_flops_q4k_f32    = device_cuda_flops (model, GGML_TYPE_Q4_K, GGML_TYPE_F32);
-    }
-
-    if (is_dtype_exist(n_params, GGML_TYPE_Q5_K)) {
-        dev_info->cpu_props.flops_q5k_f32         = device_cpu_flops  (model, GGML_TYPE_Q5_K, GGML_TYPE_F32, n_threads);
-        dev_info->gpu_props.metal_flops_q5k_f32   = device_metal_flops(model, GGML_TYPE_Q5_K, GGML_TYPE_F32);
-        dev_info->gpu_props.cuda_flops_q5k_f32    = device_cuda_flops (model, GGML_TYPE_Q5_K, GGML_TYPE_F32);
-    }
-
-    if (is_dtype_exist(n_params, GGML_TYPE_Q6_K)) {
-        dev_info->cpu_props.flops_q6k_f32         = device_cpu_flops  (model, GGML_TYPE_Q6_K, GGML_TYPE_F32, n_threads);
-        dev_info->gpu_props.metal_flops_q6k_f32   = device_metal_flops(model, GGML_TYPE_Q6_K, GGML_TYPE_F32);
-        dev_info->gpu_props.cuda_flops_q6k_f32    = device_cuda_flops (model, GGML_TYPE_Q6_K, GGML_TYPE_F32);
-    }
-
-    if (is_dtype_exist(n_params, GGML_TYPE_IQ2_XXS)) {
-        dev_info->cpu_props.flops_iq2xxs_f32      = device_cpu_flops  (model, GGML_TYPE_IQ2_XXS, GGML_TYPE_F32, n_threads);
-        dev_info->gpu_props.metal_flops_iq2xxs_f32= device_metal_flops(model, GGML_TYPE_IQ2_XXS, GGML_TYPE_F32);
-        dev_info->gpu_props.cuda_flops_iq2xxs_f32 = device_cuda_flops (model, GGML_TYPE_IQ2_XXS, GGML_TYPE_F32);
-    }
-
-    if (is_dtype_exist(n_params, GGML_TYPE_Q5_0)) {
-        dev_info->cpu_props.flops_q50_f32         = device_cpu_flops  (model, GGML_TYPE_Q5_0, GGML_TYPE_F32, n_threads);
-        dev_info->gpu_props.metal_flops_q50_f32   = device_metal_flops(model, GGML_TYPE_Q5_0, GGML_TYPE_F32);
-        dev_info->gpu_props.cuda_flops_q50_f32    = device_cuda_flops (model, GGML_TYPE_Q5_0, GGML_TYPE_F32);
+    if (measure) {
+        disk_probe.get(); // rethrows if fio failed
     }
 
+    n_flops->inp_embd_ms = device_inp_embd_delay(model, inp_embd_dtype, 1, n_threads);
 
-    if (is_dtype_exist(n_params, GGML_TYPE_Q8_0)) {
-        dev_info->cpu_props.flops_q80_f32         = device_cpu_flops  (model, GGML_TYPE_Q8_0, GGML_TYPE_F32, n_threads);
-        dev_info->gpu_props.metal_flops_q80_f32   = device_metal_flops(model, GGML_TYPE_Q8_0, GGML_TYPE_F32);
-        dev_info->gpu_props.cuda_flops_q80_f32    = device_cuda_flops (model, GGML_TYPE_Q8_0, GGML_TYPE_F32);
-    }
-
-    if (is_dtype_exist(n_params, GGML_TYPE_IQ1_S)) {
-        dev_info->cpu_props.flops_iq1s_f32        = device_cpu_flops  (model, GGML_TYPE_IQ1_S, GGML_TYPE_F32, n_threads);
-        dev_info->gpu_props.metal_flops_iq1s_f32  = device_metal_flops(model, GGML_TYPE_IQ1_S, GGML_TYPE_F32);
-        dev_info->gpu_props.cuda_flops_iq1s_f32   = device_cuda_flops (model, GGML_TYPE_IQ1_S, GGML_TYPE_F32);
+    if (!measure) {
+        return;
     }
 
-    if (is_dtype_exist(n_params, GGML_TYPE_IQ4_NL)) {
-        dev_info->cpu_props.flops_iq4nl_f32       = device_cpu_flops   (model, GGML_TYPE_IQ4_NL, GGML_TYPE_F32, n_threads);
-        dev_info->gpu_props.metal_flops_iq4nl_f32 = device_metal_flops(model, GGML_TYPE_IQ4_NL, GGML_TYPE_F32);
-        dev_info->gpu_props.cuda_flops_iq4nl_f32  = device_cuda_flops (model, GGML_TYPE_IQ4_NL, GGML_TYPE_F32);
-    }
+    dev_info->memory.cpu_read_ram_bw = device_memory_bw(n_threads);
+    dev_info->memory.mem_cpy_delay   = device_cpu_mem_copy(model, n_threads);
 
-    if (is_dtype_exist(n_params, GGML_TYPE_IQ1_M)) {
-        dev_info->cpu_props.flops_iq1m_f32        = device_cpu_flops  (model, GGML_TYPE_IQ1_M, GGML_TYPE_F32, n_threads);
-        dev_info->gpu_props.metal_flops_iq1m_f32  = device_metal_flops(model, GGML_TYPE_IQ1_M, GGML_TYPE_F32);
-        dev_info->gpu_props.cuda_flops_iq1m_f32   = device_cuda_flops (model, GGML_TYPE_IQ1_M, GGML_TYPE_F32);
+    for (const auto & probe : flops_probes) {
+        if (is_dtype_exist(n_params, probe.type)) {
+            *probe.cpu = device_cpu_flops(model, probe.type, GGML_TYPE_F32, n_threads);
+        }
     }
 }
 
@@ -3835,57 +4532,283 @@ static size_t llama_get_device_memory(const llama_model & model, int device) {
     GGML_UNUSED(device);
 }
 
+// the ring visits ranks 1, 2, ..., n_world - 1, 0 in every cycle. in cycle c, rank m holds n_layer_window[m] layers, 
+// plus one more while c < n_layer_extra[m], so the number of cycles does not have to divide the number of layers
+static void locate_layer(
+                         uint32_t   layer_id, 
+                         uint32_t   n_world, 
+                 const uint32_t   * n_layer_window, 
+                 const uint32_t   * n_layer_extra, 
+                         uint32_t * rank, 
+                         uint32_t * cycle, 
+                         uint32_t * offset) {
+    uint32_t n_cycle_size = 0;
+    uint32_t n_uneven     = 0; // leading cycles in which some windows hold an extra layer
+    for (uint32_t m = 0; m < n_world; ++m) {
+        n_cycle_size += n_layer_window[m];
+        if (n_layer_extra != nullptr) {
+            n_uneven = std::max(n_uneven, n_layer_extra[m]);
+        }
+    }
+    GGML_ASSERT(n_cycle_size > 0);
+
+    uint32_t c  = 0;
+    uint32_t il = layer_id;
+    for (; c < n_uneven; ++c) {
+        for (uint32_t i = 1; i <= n_world; ++i) {
+            const uint32_t m    = i % n_world;
+            const uint32_t size = n_layer_window[m] + (c < n_layer_extra[m] ? 1 : 0);
+            if (il < size) {
+                *rank   = m;
+                *cycle  = c;
+                *offset = il;
+                return;
+            }
+            il -= size;
+        }
+    }
+
+    // the remaining cycles are all alike
+    c  += il / n_cycle_size;
+    il %= n_cycle_size;
+    for (uint32_t i = 1; ; ++i) {
+        const uint32_t m = i % n_world;
+        if (il < n_layer_window[m]) {
+            *rank   = m;
+            *cycle  = c;
+            *offset = il;
+            return;
+        }
+        il -= n_layer_window[m];
+    }
+}
+
 static bool this_layer_is_mine(
                          uint32_t layer_id, 
                          uint32_t n_world, 
                          uint32_t my_rank, 
-                 const uint32_t * n_layer_window) {
-    uint32_t cumulative_layers = 0;
-    uint32_t rank = 1;
-    while (true) {
-        cumulative_layers += n_layer_window[rank];
-        if (layer_id < cumulative_layers) {
-            return rank == my_rank;
-        }
-        rank = (rank + 1) % n_world;
-    }
+                 const uint32_t * n_layer_window, 
+                 const uint32_t * n_layer_extra) {
+    uint32_t rank, cycle, offset;
+    locate_layer(layer_id, n_world, n_layer_window, n_layer_extra, &rank, &cycle, &offset);
+    return rank == my_rank;
 }
 
 static int32_t map_layer_to_local_id(
     uint32_t layer_id, 
     uint32_t n_world, 
     uint32_t my_rank, 
-    const uint32_t* n_layer_window) {
-    if (!this_layer_is_mine(layer_id, n_world, my_rank, n_layer_window)) {
+    const uint32_t* n_layer_window, 
+    const uint32_t* n_layer_extra) {
+    uint32_t rank, cycle, offset;
+    locate_layer(layer_id, n_world, n_layer_window, n_layer_extra, &rank, &cycle, &offset);
+    if (rank != my_rank) {
         return -1;
     }
-    
-    uint32_t cycle_size = 0;
-    for (uint32_t i = 0; i < n_world; ++i) {
-        cycle_size += n_layer_window[i];
-    }
 
-    uint32_t cycle_offset = layer_id % cycle_size;
-    uint32_t cumulative_layers = 0;
-    uint32_t local_offset = (layer_id / cycle_size) * n_layer_window[my_rank];
+    // the windows of the previous cycles come first
+    const uint32_t extra = n_layer_extra != nullptr ? n_layer_extra[my_rank] : 0;
+    return cycle * n_layer_window[my_rank] + std::min(cycle, extra) + offset;
+}
+
+// index of the window of my_rank that holds the layer, -1 if the layer is not mine
+static int32_t map_layer_to_window_id(
+    uint32_t layer_id, 
+    uint32_t n_world, 
+    uint32_t my_rank, 
+    const uint32_t* n_layer_window, 
+    const uint32_t* n_layer_extra) {
+    uint32_t rank, cycle, offset;
+    locate_layer(layer_id, n_world, n_layer_window, n_layer_extra, &rank, &cycle, &offset);
+    return rank == my_rank ? (int32_t) cycle : -1;
+}
 
-    for (uint32_t rank = 1; rank < n_world; ++rank) {
-        uint32_t window_size = n_layer_window[rank];
-        if (cycle_offset < cumulative_layers + window_size) {
-            if (rank == my_rank) {
-                return cycle_offset - cumulative_layers + local_offset;
+// whether the windows cover n_layer layers in whole cycles, with each extra layer in a cycle of its own
+static bool llama_layer_windows_valid(
+    uint32_t n_layer, 
+    uint32_t n_world, 
+    const uint32_t* n_layer_window, 
+    const uint32_t* n_layer_extra) {
+    uint32_t n_window_sum = 0, n_extra_sum = 0, n_extra_max = 0;
+    for (uint32_t m = 0; m < n_world; ++m) {
+        n_window_sum += n_layer_window[m];
+        if (n_layer_extra != nullptr) {
+            if (n_layer_extra[m] > 0 && n_layer_window[m] == 0) {
+                return false; // a rank holds layers in every cycle or in none
             }
+            n_extra_sum += n_layer_extra[m];
+            n_extra_max  = std::max(n_extra_max, n_layer_extra[m]);
         }
-        cumulative_layers += window_size;
     }
+    return n_window_sum > 0 && n_extra_sum <= n_layer && (n_layer - n_extra_sum) % n_window_sum == 0 && 
+           n_extra_max < (n_layer - n_extra_sum) / n_window_sum;
+}
 
-    return cycle_offset - cumulative_layers + local_offset;
+// number of cycles needed to pass through all layers once
+static uint32_t llama_n_cycles(
+    uint32_t n_layer, 
+    uint32_t n_world, 
+    const uint32_t* n_layer_window, 
+    const uint32_t* n_layer_extra) {
+    if (n_layer == 0) {
+        return 0;
+    }
+    uint32_t rank, cycle, offset;
+    locate_layer(n_layer - 1, n_world, n_layer_window, n_layer_extra, &rank, &cycle, &offset);
+    return cycle + 1;
 }
 
 //
 // kv cache helpers
 //
 
+// position of the newest token of seq_id in page ip
+static llama_pos llama_kv_cache_page_pos_max(const struct llama_kv_cache & cache, uint32_t ip, llama_seq_id seq_id) {
+    llama_pos pos_max = -1;
+    for (uint32_t i = ip*cache.page_size; i < (ip + 1)*cache.page_size; ++i) {
+        const llama_kv_cell & cell = cache.cells[i];
+        if (cell.has_seq_id(seq_id)) {
+            pos_max = std::max(pos_max, cell.pos);
+        }
+    }
+    return pos_max;
+}
+
+// recompute the owners and the fill of the pages that hold cells [c0, c1) and update the block tables
+static void llama_kv_cache_pages_sync(struct llama_kv_cache & cache, uint32_t c0, uint32_t c1) {
+    if (cache.page_size == 0 || c0 >= c1) {
+        return;
+    }
+
+    std::set<llama_seq_id> seq_grown; // sequences that got a page
+
+    const uint32_t ip1 = std::min((uint32_t) cache.pages.size(), (c1 + cache.page_size - 1) / cache.page_size);
+    for (uint32_t ip = c0 / cache.page_size; ip < ip1; ++ip) {
+        llama_kv_page & page = cache.pages[ip];
+
+        std::set<llama_seq_id> seq_id;
+        uint32_t n_used = 0;
+        for (uint32_t i = 0; i < cache.page_size; ++i) {
+            const llama_kv_cell & cell = cache.cells[ip*cache.page_size + i];
+            if (!cell.is_empty()) {
+                seq_id.insert(cell.seq_id.begin(), cell.seq_id.end());
+                n_used = i + 1;
+            }
+        }
+
+        for (const llama_seq_id id : page.seq_id) {
+            if (seq_id.find(id) != seq_id.end()) {
+                continue;
+            }
+            auto & table = cache.block_tables[id];
+            auto it = std::find(table.begin(), table.end(), ip);
+            if (it != table.end()) {
+                table.erase(it);
+            }
+            if (table.empty()) {
+                cache.block_tables.erase(id);
+            }
+        }
+        for (const llama_seq_id id : seq_id) {
+            if (page.seq_id.find(id) == page.seq_id.end()) {
+                cache.block_tables[id].push_back(ip);
+                seq_grown.insert(id);
+            }
+        }
+
+        if (seq_id.empty()) {
+            cache.free_pages.insert(ip);
+        } else {
+            cache.free_pages.erase(ip);
+        }
+
+        page.seq_id = std::move(seq_id);
+        page.n_used = n_used;
+    }
+
+    // page_next continues the last page of a table, so the pages are listed in the order of their tokens and
+    // not in the order of their index, which differ once a freed lower page was taken or the cells were restored
+    for (const llama_seq_id id : seq_grown) {
+        auto & table = cache.block_tables[id];
+
+        std::vector<std::pair<llama_pos, uint32_t>> order;
+        order.reserve(table.size());
+        for (const uint32_t ip : table) {
+            order.emplace_back(llama_kv_cache_page_pos_max(cache, ip, id), ip);
+        }
+        std::sort(order.begin(), order.end());
+
+        for (size_t i = 0; i < order.size(); ++i) {
+            table[i] = order[i].second;
+        }
+    }
+}
+
+// rebuild the pages from the cells, for when the cells were replaced as a whole
+static void llama_kv_cache_pages_reset(struct llama_kv_cache & cache) {
+    cache.pages.clear();
+    cache.free_pages.clear();
+    cache.block_tables.clear();
+    cache.runs.clear();
+
+    if (cache.page_size == 0) {
+        return;
+    }
+
+    cache.pages.resize(cache.size / cache.page_size);
+    llama_kv_cache_pages_sync(cache, 0, cache.size);
+}
+
+// hand out the cell for the next token of the sequences seq_id[0, n_seq_id), the token continues the last
+// page of its first sequence if that page belongs to exactly these sequences, otherwise it opens a new page
+static bool llama_kv_cache_page_next(
+        struct llama_kv_cache & cache,
+                      int32_t   n_seq_id,
+         const llama_seq_id   * seq_id,
+                     uint32_t & cell_id) {
+    auto it = cache.block_tables.find(seq_id[0]);
+    if (it != cache.block_tables.end()) {
+        const uint32_t ip = it->second.back();
+        llama_kv_page & page = cache.pages[ip];
+
+        if (page.n_used > 0 && page.n_used < cache.page_size && page.seq_id.size() == (size_t) n_seq_id) {
+            // a shared prefix page only grows with tokens that are shared the same way
+            const llama_kv_cell & tail = cache.cells[ip*cache.page_size + page.n_used - 1];
+            bool same = tail.seq_id.size() == (size_t) n_seq_id;
+            for (int32_t j = 0; same && j < n_seq_id; ++j) {
+                same = tail.has_seq_id(seq_id[j]);
+            }
+            if (same) {
+                cell_id = ip*cache.page_size + page.n_used++;
+                return true;
+            }
+        }
+    }
+
+    if (cache.free_pages.empty()) {
+        return false;
+    }
+
+    // the page right after the last one of the sequence keeps its cells in one run, else the lowest page
+    uint32_t ip = *cache.free_pages.begin();
+    if (it != cache.block_tables.end() && cache.free_pages.count(it->second.back() + 1) > 0) {
+        ip = it->second.back() + 1;
+    }
+    cache.free_pages.erase(ip);
+
+    llama_kv_page & page = cache.pages[ip];
+    page.n_used = 1;
+    page.seq_id.clear();
+    for (int32_t j = 0; j < n_seq_id; ++j) {
+        if (page.seq_id.insert(seq_id[j]).second) {
+            cache.block_tables[seq_id[j]].push_back(ip);
+        }
+    }
+
+    cell_id = ip*cache.page_size;
+    return true;
+}
+
 static bool llama_kv_cache_init(
              struct llama_kv_cache & cache,
                const llama_context * ctx,
@@ -3900,10 +4823,11 @@ static bool llama_kv_cache_init(
     const uint32_t n_world               = cparams.n_world;
     const uint32_t my_rank               = cparams.rank;
     const uint32_t * n_layer_window      = cparams.n_layer_window;
+    const uint32_t * n_layer_extra       = cparams.n_layer_extra;
 
     cache.has_shift = false;
     cache.recurrent = llama_model_is_recurrent(&model);
-    cache.v_trans   = !cache.recurrent && !cparams.flash_attn;
+    cache.v_trans   = !cache.recurrent && !cparams.flash_attn && !ggml_is_quantized(type_v); // quantized blocks can't be split across cells
     cache.head = 0;
     cache.size = kv_size;
     cache.used = 0;
@@ -3911,6 +4835,8 @@ static bool llama_kv_cache_init(
     cache.type_v = type_v;
     cache.cells.clear();
     cache.cells.resize(kv_size);
+    cache.page_size = cache.recurrent ? 0 : LLAMA_KV_PAGE_SIZE;
+    llama_kv_cache_pages_reset(cache);
 
     // count used buffer types
     std::map<ggml_backend_buffer_type_t, int> buft_layer_count;
@@ -3918,11 +4844,11 @@ static bool llama_kv_cache_init(
     uint32_t my_layers = 0;
 
     for (int64_t i = 0; i < n_layer; ++i) {
-        if (!this_layer_is_mine(i, n_world, my_rank, n_layer_window)) {
+        if (!this_layer_is_mine(i, n_world, my_rank, n_layer_window, n_layer_extra)) {
             continue;
         }
         
-        local_i = map_layer_to_local_id(i, n_world, my_rank, n_layer_window);
+        local_i = map_layer_to_local_id(i, n_world, my_rank, n_layer_window, n_layer_extra);
         GGML_ASSERT(local_i != -1);
 
         if (offload) {
@@ -3956,10 +4882,10 @@ static bool llama_kv_cache_init(
     cache.v_l.reserve(my_layers);
 
     for (int i = 0; i < (int) n_layer; i++) {
-        if (!this_layer_is_mine(i, n_world, my_rank, n_layer_window)) {
+        if (!this_layer_is_mine(i, n_world, my_rank, n_layer_window, n_layer_extra)) {
             continue;
         }
-        int local_i = map_layer_to_local_id(i, n_world, my_rank, n_layer_window);
+        int local_i = map_layer_to_local_id(i, n_world, my_rank, n_layer_window, n_layer_extra);
         GGML_ASSERT(local_i != -1);
         
         const uint32_t n_embd_k_gqa = hparams.n_embd_k_gqa(i) + hparams.n_embd_k_s();
@@ -4169,6 +5095,60 @@ static bool llama_kv_cache_find_slot(
         return false;
     }
 
+    if (cache.page_size > 0) {
+        std::vector<uint32_t> cell_ids;
+        cell_ids.reserve(n_tokens);
+
+        // give back the cells taken so far
+        auto release = [&]() {
+            for (uint32_t id : cell_ids) {
+                cache.cells[id].pos = -1;
+                cache.cells[id].seq_id.clear();
+                llama_kv_cache_pages_sync(cache, id, id + 1);
+            }
+            cache.used -= cell_ids.size();
+            cache.runs.clear();
+        };
+
+        for (uint32_t s = 0; s < n_seqs; s++) {
+            for (uint32_t i = 0; i < n_seq_tokens; ++i) {
+                uint32_t k = s*n_seq_tokens + i;
+                uint32_t cell_id;
+
+                if (!llama_kv_cache_page_next(cache, batch.n_seq_id[s], batch.seq_id[s], cell_id)) {
+                    LLAMA_LOG_ERROR("%s: no free page left for %d tokens\n", __func__, n_tokens);
+                    release();
+                    return false;
+                }
+
+                llama_kv_cell & cell = cache.cells[cell_id];
+                cell.pos = batch.pos[k];
+                for (int32_t j = 0; j < batch.n_seq_id[s]; j++) {
+                    cell.seq_id.insert(batch.seq_id[s][j]);
+                }
+
+                cell_ids.push_back(cell_id);
+                cache.used++;
+            }
+        }
+
+        // the tokens of a ubatch are stored run by run, a single run needs nothing but the head
+        cache.runs.clear();
+        for (uint32_t k = 0; k < n_tokens; ++k) {
+            if (!cache.runs.empty() && cache.runs.back().cell + cache.runs.back().n == cell_ids[k]) {
+                cache.runs.back().n++;
+            } else {
+                cache.runs.push_back({ k, cell_ids[k], 1 });
+            }
+        }
+        if (cache.runs.size() == 1) {
+            cache.runs.clear();
+        }
+        cache.head = cell_ids[0];
+
+        return true;
+    }
+
     uint32_t n_tested = 0;
 
     while (true) {
@@ -4214,6 +5194,21 @@ static bool llama_kv_cache_find_slot(
     return true;
 }
 
+// give back the cells that llama_kv_cache_find_slot took for a ubatch stored in several runs
+static void llama_kv_cache_release_runs(struct llama_kv_cache & cache) {
+    for (const llama_kv_run & run : cache.runs) {
+        for (uint32_t i = run.cell; i < run.cell + run.n; ++i) {
+            cache.cells[i].pos = -1;
+            cache.cells[i].seq_id.clear();
+        }
+        cache.used -= run.n;
+    }
+    for (const llama_kv_run & run : cache.runs) {
+        llama_kv_cache_pages_sync(cache, run.cell, run.cell + run.n);
+    }
+    cache.runs.clear();
+}
+
 // find how many cells are currently in use
 static uint32_t llama_kv_cache_cell_max(const struct llama_kv_cache & cache) {
     for (uint32_t i = cache.size; i > 0; --i) {
@@ -4236,6 +5231,7 @@ static void llama_kv_cache_clear(struct llama_kv_cache & cache) {
     }
     cache.head = 0;
     cache.used = 0;
+    llama_kv_cache_pages_reset(cache);
 
     for (auto & buf : cache.bufs) {
         ggml_backend_buffer_clear(buf, 0);
@@ -4279,6 +5275,9 @@ static bool llama_kv_cache_seq_rm(
         }
     }
 
+    uint32_t c0 = cache.size;
+    uint32_t c1 = 0;
+
     for (uint32_t i = 0; i < cache.size; ++i) {
         if (cache.cells[i].pos >= p0 && cache.cells[i].pos < p1) {
             if (seq_id < 0) {
@@ -4296,9 +5295,13 @@ static bool llama_kv_cache_seq_rm(
                 cache.cells[i].src = -1;
                 if (new_head == cache.size) new_head = i;
             }
+            c0 = std::min(c0, i);
+            c1 = i + 1;
         }
     }
 
+    llama_kv_cache_pages_sync(cache, c0, c1);
+
     // If we freed up a slot, set head to it so searching can start there.
     if (new_head != cache.size && new_head < cache.head) cache.head = new_head;
 
@@ -4345,11 +5348,19 @@ static void llama_kv_cache_seq_cp(
 
     cache.head = 0;
 
+    uint32_t c0 = cache.size;
+    uint32_t c1 = 0;
+
     for (uint32_t i = 0; i < cache.size; ++i) {
         if (cache.cells[i].has_seq_id(seq_id_src) && cache.cells[i].pos >= p0 && cache.cells[i].pos < p1) {
             cache.cells[i].seq_id.insert(seq_id_dst);
+            c0 = std::min(c0, i);
+            c1 = i + 1;
         }
     }
+
+    // the pages of the source are shared with the destination, nothing is copied
+    llama_kv_cache_pages_sync(cache, c0, c1);
 }
 
 static void llama_kv_cache_seq_keep(struct llama_kv_cache & cache, llama_seq_id seq_id) {
@@ -4371,6 +5382,8 @@ static void llama_kv_cache_seq_keep(struct llama_kv_cache & cache, llama_seq_id
         }
     }
 
+    llama_kv_cache_pages_sync(cache, 0, cache.size);
+
     // If we freed up a slot, set head to it so searching can start there.
     if (new_head != cache.size && new_head < cache.head) cache.head = new_head;
 }
@@ -4402,6 +5415,9 @@ static void llama_kv_cache_seq_add(
         return;
     }
 
+    uint32_t c0 = cache.size;
+    uint32_t c1 = 0;
+
     for (uint32_t i = 0; i < cache.size; ++i) {
         if (cache.cells[i].has_seq_id(seq_id) && cache.cells[i].pos >= p0 && cache.cells[i].pos < p1) {
             cache.has_shift = true;
@@ -4417,10 +5433,14 @@ static void llama_kv_cache_seq_add(
                 if (new_head == cache.size) {
                     new_head = i;
                 }
+                c0 = std::min(c0, i);
+                c1 = i + 1;
             }
         }
     }
 
+    llama_kv_cache_pages_sync(cache, c0, c1);
+
     // If we freed up a slot, set head to it so searching can start there.
     // Otherwise we just start the next search from the beginning.
     cache.head = new_head != cache.size ? new_head : 0;
@@ -4477,7 +5497,8 @@ static llama_pos llama_kv_cache_seq_pos_max(struct llama_kv_cache & cache, llama
 }
 
 static void llama_kv_cache_defrag(struct llama_kv_cache & cache) {
-    if (!cache.recurrent) {
+    // paged caches reuse freed pages in place and never need to move cells
+    if (!cache.recurrent && cache.page_size == 0) {
         cache.do_defrag = true;
     }
 }
@@ -4694,8 +5715,11 @@ namespace GGUFMeta {
 using llama_buf_map   = std::multimap<uint32_t, ggml_backend_buffer_t>; // <file_idx, buffer_map>
 using llama_buf_range = std::map<ggml_context *, std::map<uint32_t, std::vector<std::pair<size_t, size_t>>>>; // <ggml_context, file_idx, [<first, last>]>
 
-static size_t llama_model_max_nodes(const llama_model & model) {
-    return std::max<size_t>(8192, model.tensors_by_name.size()*5);
+// n_kv_runs is the number of runs of cells the tokens of a ubatch are stored in, 0 or 1 for a single run
+static size_t llama_model_max_nodes(const llama_model & model, size_t n_kv_runs) {
+    // a KV store takes up to 8 nodes per run of cells when there is more than one, see llm_build_kv_store
+    const size_t n_kv_store = n_kv_runs > 1 ? (size_t) model.hparams.n_layer*n_kv_runs*8 : 0;
+    return std::max<size_t>(8192, model.tensors_by_name.size()*5) + n_kv_store;
 }
 
 static int get_layer_id(const ggml_tensor * tensor) {
@@ -4720,6 +5744,7 @@ struct llama_model_loader {
 
     bool use_mmap = false;
     bool check_tensors;
+    bool repack = false; // repack weights read into CPU buffers, see load_all_data
 
     llama_files files;
     llama_ftype ftype;
@@ -5594,7 +6619,18 @@ struct llama_model_loader {
                 if (ggml_backend_buffer_is_host(cur->buffer)) {
                     file->seek(weight->offs, SEEK_SET);
                     file->read_raw(cur->data, n_size);
-                    if (check_tensors) {
+                    // the token embeddings are read by get_rows, which needs the rows as stored
+                    const enum ggml_type type_repack = repack && ggml_n_dims(cur) == 2 &&
+                        ggml_backend_buffer_get_type(cur->buffer) == ggml_backend_cpu_buffer_type() &&
+                        strcmp(ggml_get_name(cur), "token_embd.weight") != 0 ?
+                        ggml_repack_type(cur->type, cur->ne[1], cur->ne[0]) : GGML_TYPE_COUNT;
+                    if (type_repack != GGML_TYPE_COUNT) {
+                        if (check_tensors && !ggml_validate_row_data(cur->type, cur->data, n_size)) {
+                            throw std::runtime_error(format("tensor '%s' has invalid data", ggml_get_name(cur)));
+                        }
+                        ggml_repack(cur->type, cur->data, cur->ne[1], cur->ne[0]);
+                        cur->type = type_repack;
+                    } else if (check_tensors) {
                         validation_result.emplace_back(std::async(std::launch::async, [cur, n_size] {
                             return std::make_pair(cur, ggml_validate_row_data(cur->type, cur->data, n_size));
                         }));
@@ -7360,6 +8396,7 @@ static void llm_load_llama_tensors(
         uint32_t             n_world, 
         uint32_t             my_rank, 
         const uint32_t     * n_layer_window,
+        const uint32_t     * n_layer_extra,
         bool               * use_mmap_buffer,
         bool                 set_needed) {
     const auto tn = LLM_TN(model.arch);
@@ -7403,11 +8440,11 @@ static void llm_load_llama_tensors(
     }
 
     for (int i = 0; i < n_layer; ++i) {
-        if (!this_layer_is_mine(i, n_world, my_rank, n_layer_window)) {
+        if (!this_layer_is_mine(i, n_world, my_rank, n_layer_window, n_layer_extra)) {
             continue;
         }
 
-        int local_i = map_layer_to_local_id(i, n_world, my_rank, n_layer_window);
+        int local_i = map_layer_to_local_id(i, n_world, my_rank, n_layer_window, n_layer_extra);
         ggml_context * ctx_layer = ctx_for_layer(local_i);
         ggml_context * ctx_split = ctx_for_layer_split(local_i);
         
@@ -7479,6 +8516,7 @@ static void llm_load_qwen2_tensors(
     uint32_t             n_world, 
     uint32_t             my_rank, 
     const uint32_t     * n_layer_window,
+    const uint32_t     * n_layer_extra,
     bool                 set_needed) {
     const auto tn = LLM_TN(model.arch);
 
@@ -7517,11 +8555,11 @@ static void llm_load_qwen2_tensors(
     }    
 
     for (int i = 0; i < n_layer; ++i) {
-        if (!this_layer_is_mine(i, n_world, my_rank, n_layer_window)) {
+        if (!this_layer_is_mine(i, n_world, my_rank, n_layer_window, n_layer_extra)) {
             continue;
         }
 
-        int local_i = map_layer_to_local_id(i, n_world, my_rank, n_layer_window);
+        int local_i = map_layer_to_local_id(i, n_world, my_rank, n_layer_window, n_layer_extra);
         ggml_context * ctx_layer = ctx_for_layer(local_i);
         ggml_context * ctx_split = ctx_for_layer_split(local_i);
         
@@ -7550,6 +8588,77 @@ static void llm_load_qwen2_tensors(
     }
 }
 
+// point the weights of the CPU-resident layers at the slots of a weight stream instead of the file mapping
+static void llm_init_weight_stream(
+        llama_model_loader   &  ml,
+        llama_model          &  model,
+        uint32_t                n_world,
+        uint32_t                my_rank,
+        const uint32_t       *  n_layer_window,
+        const uint32_t       *  n_layer_extra) {
+    if (!llama_weight_stream::SUPPORTED || !ml.use_mmap || n_world == 1) {
+        LLAMA_LOG_WARN("%s: weight streaming requires mmap support and more than one device, ignored\n", __func__);
+        return;
+    }
+
+    std::unique_ptr<llama_weight_stream> stream(new llama_weight_stream());
+    for (const auto & file : ml.files) {
+        stream->fds.push_back(llama_weight_stream::open_file(fileno(file->fp)));
+        if (stream->fds.back() < 0) {
+            LLAMA_LOG_WARN("%s: failed to open the model file for streaming, ignored\n", __func__);
+            return;
+        }
+    }
+
+    std::vector<std::vector<llama_weight_stream::source>> windows;
+    std::vector<std::pair<struct ggml_tensor *, void *>>  orig_data;
+
+    for (const auto & it : model.tensors_by_name) {
+        struct ggml_tensor * cur = it.second;
+        int il = -1;
+        if (sscanf(it.first.c_str(), "blk.%d.", &il) != 1 || !this_layer_is_mine(il, n_world, my_rank, n_layer_window, n_layer_extra)) {
+            continue;
+        }
+        if (cur->buffer == nullptr || ggml_backend_buffer_get_type(cur->buffer) != ggml_backend_cpu_buffer_type()) {
+            continue; // offloaded layers are already resident
+        }
+
+        const auto * weight = ml.get_weight(it.first.c_str());
+        if (weight == nullptr) {
+            continue;
+        }
+
+        const size_t w = map_layer_to_window_id(il, n_world, my_rank, n_layer_window, n_layer_extra);
+        if (windows.size() <= w) {
+            windows.resize(w + 1);
+        }
+        windows[w].push_back({cur, stream->fds[weight->idx], weight->offs});
+        orig_data.emplace_back(cur, cur->data);
+    }
+
+    if (windows.empty()) {
+        return;
+    }
+
+    for (size_t w = 0; w < windows.size(); ++w) {
+        stream->add_window(w, windows[w]);
+    }
+
+    if (!stream->start()) {
+        LLAMA_LOG_WARN("%s: failed to allocate %.2f MiB of staging buffers, weight streaming disabled\n",
+            __func__, 2 * stream->slot_size / 1024.0 / 1024.0);
+        for (auto & it : orig_data) {
+            it.first->data = it.second;
+        }
+        return;
+    }
+
+    LLAMA_LOG_INFO("%s: streaming %zu layer windows through 2 x %.2f MiB staging buffers\n",
+        __func__, windows.size(), stream->slot_size / 1024.0 / 1024.0);
+
+    model.stream = std::move(stream);
+}
+
 // Returns false if cancelled by progress_callback
 static bool llm_load_tensors_impl(
         llama_model_loader   &  ml,
@@ -7557,12 +8666,15 @@ static bool llm_load_tensors_impl(
         uint32_t                n_world,
         uint32_t                my_rank,
         const uint32_t       *  n_layer_window,
+        const uint32_t       *  n_layer_extra,
         int                     n_gpu_layers,
         enum llama_split_mode   split_mode,
         int                     main_gpu,
         bool                    use_mlock,
         bool                    keep_out_in_metal,
         bool                    keep_out_in_cuda,
+        bool                    stream_weights,
+        bool                    repack,
         llama_progress_callback progress_callback,
         void                  * progress_callback_user_data) {
     auto & hparams = model.hparams;
@@ -7580,21 +8692,38 @@ static bool llm_load_tensors_impl(
     int n_layer          = hparams.n_layer;
     bool use_mmap_buffer = true;
 
+    // repacked weights no longer match the file, so they cannot live in a shared read-only mapping
+    if (repack && ml.use_mmap) {
+        LLAMA_LOG_WARN("%s: repacking weights needs --no-mmap, weights are used as stored\n", __func__);
+    }
+    ml.repack = repack && !ml.use_mmap;
+
     int my_layers = 0;
     for (int i = 0; i < n_layer; ++i) {
-        if (this_layer_is_mine(i, n_world, my_rank, n_layer_window)) {
+        if (this_layer_is_mine(i, n_world, my_rank, n_layer_window, n_layer_extra)) {
             my_layers++;
         }
     }
     model.buft_layer.resize(my_layers);
 
+    // the n_gpu_layers of this rank are spread over its windows like its layers, the first n_gpu_layers % n_cycles
+    // windows take one more
+    const int32_t n_cycles = (int32_t) llama_n_cycles(n_layer, n_world, n_layer_window, n_layer_extra);
+
     for (int i = 0; i < n_layer; ++i) {
-        if (this_layer_is_mine(i, n_world, my_rank, n_layer_window)) {
-            int32_t local_i = map_layer_to_local_id(i, n_world, my_rank, n_layer_window);
+        uint32_t rank, cycle, offset;
+        locate_layer(i, n_world, n_layer_window, n_layer_extra, &rank, &cycle, &offset);
+        if (rank == my_rank) {
+            int32_t local_i = map_layer_to_local_id(i, n_world, my_rank, n_layer_window, n_layer_extra);
             int32_t window_size = static_cast<int32_t>(n_layer_window[my_rank]);
+            if (n_layer_extra != nullptr && cycle < n_layer_extra[my_rank]) {
+                window_size++;
+            }
             GGML_ASSERT(local_i != -1);
 
-            if (local_i % window_size >= window_size - n_gpu_layers) {
+            // the last layers of each window run on the GPU
+            const int32_t n_gpu_window = n_gpu_layers / n_cycles + ((int32_t) cycle < n_gpu_layers % n_cycles ? 1 : 0);
+            if ((int32_t) offset >= window_size - n_gpu_window) {
                 LLAMA_LOG_DEBUG("Layer %i assigned to gpu (cache index %i)\n", i, local_i);
                 model.buft_layer[local_i] = llama_default_buffer_type_offload(model, main_gpu);
             } else {
@@ -7697,7 +8826,7 @@ static bool llm_load_tensors_impl(
             case LLM_ARCH_MINICPM:
             case LLM_ARCH_GRANITE:
             case LLM_ARCH_GRANITE_MOE:
-                llm_load_llama_tensors(ml, model, ctx_map, n_world, my_rank, n_layer_window, &use_mmap_buffer, true);
+                llm_load_llama_tensors(ml, model, ctx_map, n_world, my_rank, n_layer_window, n_layer_extra, &use_mmap_buffer, true);
                 break;
             case LLM_ARCH_MINICPM3:
                 {
@@ -8223,7 +9352,7 @@ static bool llm_load_tensors_impl(
                     }
                 } break;
             case LLM_ARCH_QWEN2:
-                llm_load_qwen2_tensors(ml, model, ctx_map, n_world, my_rank, n_layer_window, true);
+                llm_load_qwen2_tensors(ml, model, ctx_map, n_world, my_rank, n_layer_window, n_layer_extra, true);
                 break;
             case LLM_ARCH_QWEN2MOE:
                 {
@@ -9524,6 +10653,10 @@ static bool llm_load_tensors_impl(
         }
     }
 
+    if (stream_weights) {
+        llm_init_weight_stream(ml, model, n_world, my_rank, n_layer_window, n_layer_extra);
+    }
+
     if (use_mmap_buffer) {
         for (auto & mapping : ml.mappings) {
             model.mappings.emplace_back(std::move(mapping));
@@ -9538,12 +10671,13 @@ int llm_load_tensors(
     struct llama_model        * model,
     struct llama_model_params   params) {
     model->t_start_us = ggml_time_us();
+    model->load_params = params;
 
     try {
         if (!llm_load_tensors_impl(
-            *ml, *model, params.n_world, params.rank, params.n_layer_window, params.n_gpu_layers, params.split_mode, 
-            params.main_gpu, params.use_mlock, params.keep_out_in_metal, params.keep_out_in_cuda, params.progress_callback, 
-            params.progress_callback_user_data
+            *ml, *model, params.n_world, params.rank, params.n_layer_window, params.n_layer_extra, params.n_gpu_layers, params.split_mode, 
+            params.main_gpu, params.use_mlock, params.keep_out_in_metal, params.keep_out_in_cuda, params.stream_weights, 
+            params.repack, params.progress_callback, params.progress_callback_user_data
         )) {
             return -2;
         }
@@ -9561,6 +10695,7 @@ static llama_model_loader * llama_model_load_impl(const std::string & fname, lla
     try {
         llama_model_loader * ml = new llama_model_loader(fname, params.use_mmap, params.check_tensors, params.kv_overrides);
 
+        model.path               = fname;
         model.hparams.vocab_only = params.vocab_only;
 
         try {
@@ -9686,12 +10821,48 @@ static void llm_build_kv_store(
     const uint32_t   n_world        = cparams.n_world;
     const uint32_t   my_rank        = cparams.rank;
     const uint32_t * n_layer_window = cparams.n_layer_window;
-    const int        local_il       = map_layer_to_local_id(il, n_world, my_rank, n_layer_window);
+    const uint32_t * n_layer_extra  = cparams.n_layer_extra;
+    const int        local_il       = map_layer_to_local_id(il, n_world, my_rank, n_layer_window, n_layer_extra);
     const int64_t    n_embd_k_gqa   = hparams.n_embd_k_gqa(il);
     const int64_t    n_embd_v_gqa   = hparams.n_embd_v_gqa(il);
 
     GGML_ASSERT(kv.size == n_ctx);
 
+    // a ubatch spread over several pages is stored run by run
+    if (!kv.runs.empty()) {
+        if (!ggml_is_contiguous(k_cur)) {
+            k_cur = ggml_cont(ctx, k_cur);
+        }
+        k_cur = ggml_reshape_2d(ctx, k_cur, n_embd_k_gqa, n_tokens);
+
+        assert(v_cur->ne[0] == n_embd_v_gqa && v_cur->ne[1] == n_tokens);
+
+        for (const llama_kv_run & run : kv.runs) {
+            struct ggml_tensor * k_cache_view = ggml_view_1d(ctx, kv.k_l[local_il], run.n*n_embd_k_gqa, ggml_row_size(kv.k_l[local_il]->type, n_embd_k_gqa)*run.cell);
+            cb(k_cache_view, "k_cache_view", il);
+
+            struct ggml_tensor * k_run = ggml_view_2d(ctx, k_cur, n_embd_k_gqa, run.n, k_cur->nb[1], k_cur->nb[1]*run.i_token);
+            ggml_build_forward_expand(graph, ggml_cpy(ctx, k_run, k_cache_view));
+
+            struct ggml_tensor * v_run = ggml_view_2d(ctx, v_cur, n_embd_v_gqa, run.n, v_cur->nb[1], v_cur->nb[1]*run.i_token);
+            struct ggml_tensor * v_cache_view = nullptr;
+
+            if (!kv.v_trans) {
+                v_cache_view = ggml_view_1d(ctx, kv.v_l[local_il], run.n*n_embd_v_gqa, ggml_row_size(kv.v_l[local_il]->type, n_embd_v_gqa)*run.cell);
+            } else {
+                v_cache_view = ggml_view_2d(ctx, kv.v_l[local_il], run.n, n_embd_v_gqa,
+                        (   n_ctx)*ggml_element_size(kv.v_l[local_il]),
+                        (run.cell)*ggml_element_size(kv.v_l[local_il]));
+
+                v_run = ggml_transpose(ctx, v_run);
+            }
+            cb(v_cache_view, "v_cache_view", il);
+
+            ggml_build_forward_expand(graph, ggml_cpy(ctx, v_run, v_cache_view));
+        }
+        return;
+    }
+
     struct ggml_tensor * k_cache_view = ggml_view_1d(ctx, kv.k_l[local_il], n_tokens*n_embd_k_gqa, ggml_row_size(kv.k_l[local_il]->type, n_embd_k_gqa)*kv_head);
     cb(k_cache_view, "k_cache_view", il);
 
@@ -9702,10 +10873,10 @@ static void llm_build_kv_store(
 
     struct ggml_tensor * v_cache_view = nullptr;
 
-    if (cparams.flash_attn) {
+    if (!kv.v_trans) {
         v_cache_view = ggml_view_1d(ctx, kv.v_l[local_il], n_tokens*n_embd_v_gqa, ggml_row_size(kv.v_l[local_il]->type, n_embd_v_gqa)*kv_head);
     } else {
-        // note: the V cache is transposed when not using flash attention
+        // note: the V cache is transposed when not using flash attention, unless it is quantized
         v_cache_view = ggml_view_2d(ctx, kv.v_l[local_il], n_tokens, n_embd_v_gqa,
                 (  n_ctx)*ggml_element_size(kv.v_l[local_il]),
                 (kv_head)*ggml_element_size(kv.v_l[local_il]));
@@ -9801,6 +10972,150 @@ static struct ggml_tensor * llm_build_norm(
     return cur;
 }
 
+// graph node that hands the input of the FFN to the next node and passes it on, see llama_tp
+static void llama_tp_send_op(struct ggml_tensor * dst, const struct ggml_tensor * x, int ith, int nth, void * userdata) {
+    GGML_UNUSED(nth);
+    if (ith != 0) {
+        return;
+    }
+
+    auto * l  = (llama_tp::layer *) userdata;
+    auto & tp = *l->tp;
+
+    memcpy(dst->data, x->data, ggml_nbytes(x));
+    if (tp.broken) {
+        return;
+    }
+
+    const llama_tp::request req = {l->il, l->n_keep, x->ne[1]};
+    try {
+        tp.socket->send(zmq::buffer(&req, sizeof(req)), zmq::send_flags::sndmore);
+        tp.socket->send(zmq::buffer(x->data, ggml_nbytes(x)), zmq::send_flags::none);
+    } catch (const zmq::error_t & e) {
+        LLAMA_LOG_ERROR("%s: failed to send the FFN input of layer %u: %s\n", __func__, l->il, e.what());
+        tp.broken = true;
+    }
+}
+
+// graph node that adds the partial FFN output of the next node to the one computed here
+static void llama_tp_recv_op(struct ggml_tensor * dst, const struct ggml_tensor * x, const struct ggml_tensor * part, int ith, int nth, void * userdata) {
+    GGML_UNUSED(x);
+    GGML_UNUSED(nth);
+    if (ith != 0) {
+        return;
+    }
+
+    auto * l  = (llama_tp::layer *) userdata;
+    auto & tp = *l->tp;
+
+    const int64_t n   = ggml_nelements(part);
+    float *       out = (float *) dst->data;
+    memcpy(out, part->data, n * sizeof(float));
+    if (tp.broken) {
+        return;
+    }
+
+    zmq::message_t reply;
+    bool ok = false;
+    try {
+        ok = tp.socket->recv(reply, zmq::recv_flags::none).has_value();
+    } catch (const zmq::error_t & e) {
+        LLAMA_LOG_ERROR("%s: %s\n", __func__, e.what());
+    }
+    if (!ok || reply.size() != n * sizeof(float)) {
+        // the output of this pass misses the rows of the next node, it is about to be dropped from the ring anyway
+        LLAMA_LOG_ERROR("%s: no FFN output of layer %u from the next node, continuing without the split\n", __func__, l->il);
+        tp.broken = true;
+        return;
+    }
+
+    const float * rest = (const float *) reply.data();
+    for (int64_t i = 0; i < n; ++i) {
+        out[i] += rest[i];
+    }
+}
+
+// the rows of the FFN of layer il this node computes when it splits the FFN with its next node, nullptr to compute all
+static llama_tp::layer * llama_tp_split(llama_context & lctx, const ggml_tensor * cur, const ggml_tensor * gate, const ggml_tensor * down, int il) {
+    auto       & tp      = lctx.tp;
+    const auto & cparams = lctx.cparams;
+
+    const uint32_t share = cparams.tp_ffn_share[cparams.rank];
+    if (tp.socket == nullptr || tp.broken || share == 0 || share >= 1000 || il < 0 || (size_t) il >= tp.layers.size()) {
+        return nullptr;
+    }
+    if (cur->ne[1] > LLAMA_TP_MAX_TOKENS || !lctx.lora_adapters.empty() || lctx.model.stream) {
+        return nullptr;
+    }
+    // the rows are views of the weights, GPU layers are not split
+    if (gate->buffer == nullptr || !ggml_backend_buffer_is_host(gate->buffer) ||
+        down->buffer == nullptr || !ggml_backend_buffer_is_host(down->buffer)) {
+        return nullptr;
+    }
+
+    // repacked rows are interleaved by 4, so ffn_down cannot be viewed by columns
+    if (ggml_is_repacked(down->type)) {
+        return nullptr;
+    }
+
+    // the columns of ffn_down are split at a block boundary
+    const int64_t n_ff   = gate->ne[1];
+    const int64_t blck   = ggml_blck_size(down->type);
+    const int64_t n_keep = std::llround(n_ff * share / 1000.0 / blck) * blck;
+    if (n_keep <= 0 || n_keep >= n_ff) {
+        return nullptr;
+    }
+
+    llama_tp::layer & l = tp.layers[il];
+    l.tp     = &tp;
+    l.il     = il;
+    l.n_keep = n_keep;
+    return &l;
+}
+
+// SiLU-gated FFN with the rows from n_keep on computed by the next node
+static struct ggml_tensor * llm_build_ffn_tp(
+        struct ggml_context * ctx,
+         struct ggml_tensor * cur,
+         struct ggml_tensor * up,
+         struct ggml_tensor * gate,
+         struct ggml_tensor * down,
+            llama_tp::layer * tpl,
+         const llm_build_cb & cb,
+                        int   il) {
+    const int64_t n_embd = cur->ne[0];
+    const int64_t n_keep = tpl->n_keep;
+
+    // sent first, the next node computes its rows while this one computes its own
+    struct ggml_tensor * sent = ggml_map_custom1(ctx, cur, llama_tp_send_op, 1, tpl);
+    cb(sent, "ffn_tp_send", il);
+
+    struct ggml_tensor * up_k   = ggml_view_2d(ctx, up,   n_embd, n_keep,      up->nb[1],   0);
+    struct ggml_tensor * gate_k = ggml_view_2d(ctx, gate, n_embd, n_keep,      gate->nb[1], 0);
+    struct ggml_tensor * down_k = ggml_view_2d(ctx, down, n_keep, down->ne[1], down->nb[1], 0);
+
+    struct ggml_tensor * tmp = ggml_mul_mat(ctx, up_k, cur);
+    cb(tmp, "ffn_up", il);
+
+    struct ggml_tensor * part = ggml_mul_mat(ctx, gate_k, cur);
+    cb(part, "ffn_gate", il);
+
+    part = ggml_silu(ctx, part);
+    cb(part, "ffn_silu", il);
+
+    part = ggml_mul(ctx, part, tmp);
+    cb(part, "ffn_gate_par", il);
+
+    part = ggml_mul_mat(ctx, down_k, part);
+    cb(part, "ffn_down", il);
+
+    // sent is the first source, so that the graph sends before it computes the rows of this node
+    cur = ggml_map_custom2(ctx, sent, part, llama_tp_recv_op, 1, tpl);
+    cb(cur, "ffn_tp_sum", il);
+
+    return cur;
+}
+
 static struct ggml_tensor * llm_build_ffn(
         struct ggml_context * ctx,
        struct llama_context & lctx,
@@ -9819,6 +11134,13 @@ static struct ggml_tensor * llm_build_ffn(
           llm_ffn_gate_type   type_gate,
          const llm_build_cb & cb,
                         int   il) {
+    if (type_op == LLM_FFN_SILU && type_gate == LLM_FFN_PAR && up && gate && down &&
+        !up_b && !up_s && !gate_b && !gate_s && !down_b && !down_s && !act_scales) {
+        if (llama_tp::layer * tpl = llama_tp_split(lctx, cur, gate, down, il)) {
+            return llm_build_ffn_tp(ctx, cur, up, gate, down, tpl, cb, il);
+        }
+    }
+
     struct ggml_tensor * tmp = up ? llm_build_lora_mm(lctx, ctx, up, cur) : cur;
     cb(tmp, "ffn_up", il);
 
@@ -10049,8 +11371,9 @@ static struct ggml_tensor * llm_build_kqv(
     const uint32_t        n_world        = cparams.n_world;
     const uint32_t        my_rank        = cparams.rank;
     const uint32_t      * n_layer_window = cparams.n_layer_window;
+    const uint32_t      * n_layer_extra  = cparams.n_layer_extra;
     
-    const int     local_il      = map_layer_to_local_id(il, n_world, my_rank, n_layer_window);
+    const int     local_il      = map_layer_to_local_id(il, n_world, my_rank, n_layer_window, n_layer_extra);
     const int64_t n_ctx         = cparams.n_ctx;
     const int64_t n_head        = hparams.n_head(il);
     const int64_t n_head_kv     = hparams.n_head_kv(il);
@@ -10129,12 +11452,22 @@ static struct ggml_tensor * llm_build_kqv(
         GGML_ASSERT(kv.size == n_ctx);
 
         // split cached v into n_head heads
-        struct ggml_tensor * v =
-            ggml_view_3d(ctx, kv.v_l[local_il],
+        struct ggml_tensor * v = nullptr;
+        if (kv.v_trans) {
+            v = ggml_view_3d(ctx, kv.v_l[local_il],
                     n_kv, n_embd_head_v, n_head_kv,
                     ggml_element_size(kv.v_l[local_il])*n_ctx,
                     ggml_element_size(kv.v_l[local_il])*n_ctx*n_embd_head_v,
                     0);
+        } else {
+            // quantized v is stored a row per cell, dequantize it straight into the transposed layout
+            v = ggml_view_3d(ctx, kv.v_l[local_il],
+                    n_embd_head_v, n_kv, n_head_kv,
+                    ggml_row_size(kv.v_l[local_il]->type, n_embd_v_gqa),
+                    ggml_row_size(kv.v_l[local_il]->type, n_embd_head_v),
+                    0);
+            v = ggml_cast(ctx, ggml_transpose(ctx, v), GGML_TYPE_F16);
+        }
         cb(v, "v", il);
 
         struct ggml_tensor * kqv = ggml_mul_mat(ctx, v, kq);
@@ -10636,6 +11969,9 @@ struct llm_build_context {
 
         ctx0 = ggml_init(params);
 
+        // the new graph takes the schedulers, the cached ones are allocated again before they run
+        lctx.graph_cache.cur = -1;
+
         lctx.inp_tokens      = nullptr;
         lctx.inp_embd        = nullptr;
         lctx.backend_embd    = nullptr;
@@ -10663,7 +11999,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_k_shift() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         GGML_ASSERT(kv_self.size == n_ctx);
 
@@ -10719,7 +12055,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_defrag(const std::vector<uint32_t> & ids) {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         for (uint32_t i = 0; i < ids.size(); ++i) {
             const uint32_t id = ids[i];
@@ -10751,8 +12087,8 @@ struct llm_build_context {
                 ggml_tensor * view_v_src;
                 ggml_tensor * view_v_dst;
 
-                if (flash_attn) {
-                    // NOTE: the V cache is not transposed when using flash attention
+                if (!kv_self.v_trans) {
+                    // NOTE: the V cache is not transposed when using flash attention or quantized
                     view_v_src = ggml_view_2d(ctx0, kv_self.v_l[il],
                             n_embd_v_gqa, nm,
                             ggml_row_size(kv_self.v_l[il]->type, n_embd_v_gqa),
@@ -11014,9 +12350,10 @@ struct llm_build_context {
         const  uint32_t      n_world = this->cparams.n_world;
         const  uint32_t      my_rank = this->cparams.rank;
         const  uint32_t    * n_layer_window = this->cparams.n_layer_window;
+        const  uint32_t    * n_layer_extra  = this->cparams.n_layer_extra;
 
         if (my_rank == 0) {
-            sub_gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+            sub_gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
             // inp_embd - contains the input embedding
             inpL = llm_build_inp_embd(ctx0, lctx, hparams, batch, model.tok_embd, cb);
@@ -11040,7 +12377,7 @@ struct llm_build_context {
 
         const float kq_scale = hparams.f_attention_scale == 0.0f ? 1.0f/sqrtf(float(n_embd_head)) : hparams.f_attention_scale;
         for (int il = 0; il < n_layer; ++il) {
-            if (!this_layer_is_mine(il, n_world, my_rank, n_layer_window)) {
+            if (!this_layer_is_mine(il, n_world, my_rank, n_layer_window, n_layer_extra)) {
                 // if we have an active sub-graph, add it to the list 
                 if (sub_gf != nullptr && inpL != nullptr) {
                     ggml_build_forward_expand(sub_gf, cur);
@@ -11059,11 +12396,11 @@ struct llm_build_context {
 
             // start a new sub-graph
             if (sub_gf == nullptr) {
-                sub_gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+                sub_gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
             }
 
             struct ggml_tensor * inpSA = inpL;  // use for shortcut
-            int local_il = map_layer_to_local_id(il, n_world, my_rank, n_layer_window);
+            int local_il = map_layer_to_local_id(il, n_world, my_rank, n_layer_window, n_layer_extra);
 
             // norm
             cur = llm_build_norm(ctx0, inpL, hparams,
@@ -11190,7 +12527,7 @@ struct llm_build_context {
         // output norm and lm_head
         if (my_rank == 0) {
             // start a new sub-graph for the output
-            sub_gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+            sub_gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
             cur = llm_build_out_embd(ctx0, lctx, hparams, cb);
 
@@ -11218,7 +12555,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_baichuan() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         GGML_ASSERT(n_embd_head == hparams.n_embd_head_k);
@@ -11333,7 +12670,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_xverse() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         GGML_ASSERT(n_embd_head == hparams.n_embd_head_k);
@@ -11436,7 +12773,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_falcon() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         const int64_t n_embd_gqa  = hparams.n_embd_v_gqa();
@@ -11556,7 +12893,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_grok() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         // mutable variable, needed during the last layer of the computation to skip unused tokens
         int32_t n_tokens = this->n_tokens;
@@ -11713,7 +13050,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_dbrx() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         // mutable variable, needed during the last layer of the computation to skip unused tokens
         int32_t n_tokens = this->n_tokens;
@@ -11839,7 +13176,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_starcoder() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         const int64_t n_embd_gqa  = hparams.n_embd_v_gqa();
@@ -11943,7 +13280,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_refact() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         GGML_ASSERT(n_embd_head == hparams.n_embd_head_k);
@@ -12037,7 +13374,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_bert() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         const int64_t n_embd_gqa  = hparams.n_embd_v_gqa();
@@ -12231,7 +13568,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_bloom() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         const int64_t n_embd_gqa  = hparams.n_embd_v_gqa();
@@ -12332,7 +13669,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_mpt() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         const int64_t n_embd_gqa  = hparams.n_embd_v_gqa();
@@ -12622,7 +13959,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_qwen() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         GGML_ASSERT(n_embd_head == hparams.n_embd_head_k);
@@ -12750,9 +14087,10 @@ struct llm_build_context {
         const  uint32_t      n_world = this->cparams.n_world;
         const  uint32_t      my_rank = this->cparams.rank;
         const  uint32_t    * n_layer_window = this->cparams.n_layer_window;
+        const  uint32_t    * n_layer_extra  = this->cparams.n_layer_extra;
 
         if (my_rank == 0) {
-            sub_gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+            sub_gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
             // inp_embd - contains the input embedding
             inpL = llm_build_inp_embd(ctx0, lctx, hparams, batch, model.tok_embd, cb);
@@ -12776,7 +14114,7 @@ struct llm_build_context {
 
         const float kq_scale = hparams.f_attention_scale == 0.0f ? 1.0f/sqrtf(float(n_embd_head)) : hparams.f_attention_scale;
         for (int il = 0; il < n_layer; ++il) {
-            if (!this_layer_is_mine(il, n_world, my_rank, n_layer_window)) {
+            if (!this_layer_is_mine(il, n_world, my_rank, n_layer_window, n_layer_extra)) {
                 // if we have an active sub-graph, add it to the list 
                 if (sub_gf != nullptr && inpL != nullptr) {
                     ggml_build_forward_expand(sub_gf, cur);
@@ -12795,11 +14133,11 @@ struct llm_build_context {
 
             // start a new sub-graph
             if (sub_gf == nullptr) {
-                sub_gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+                sub_gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
             }
 
             struct ggml_tensor * inpSA = inpL; // use for shortcut
-            int local_il = map_layer_to_local_id(il, n_world, my_rank, n_layer_window);
+            int local_il = map_layer_to_local_id(il, n_world, my_rank, n_layer_window, n_layer_extra);
             
             // norm
             cur = llm_build_norm(ctx0, inpL, hparams,
@@ -12894,7 +14232,7 @@ struct llm_build_context {
         // output norm and lm_head
         if (my_rank == 0) {
             // start a new sub-graph for the output
-            sub_gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+            sub_gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
             cur = llm_build_out_embd(ctx0, lctx, hparams, cb);
 
@@ -12916,7 +14254,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_qwen2moe() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         // mutable variable, needed during the last layer of the computation to skip unused tokens
         int32_t n_tokens = this->n_tokens;
@@ -13062,7 +14400,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_phi2() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         const int64_t n_embd_gqa  = hparams.n_embd_v_gqa();
@@ -13183,7 +14521,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_phi3() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         const int64_t n_embd_gqa = hparams.n_embd_v_gqa();
@@ -13415,7 +14753,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_gpt2() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         const int64_t n_embd_gqa  = hparams.n_embd_v_gqa();
@@ -13520,7 +14858,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_codeshell() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         const int64_t n_embd_gqa  = hparams.n_embd_v_gqa();
@@ -13631,7 +14969,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_orion() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         GGML_ASSERT(n_embd_head == hparams.n_embd_head_k);
@@ -13749,7 +15087,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_internlm2() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         GGML_ASSERT(n_embd_head == hparams.n_embd_head_k);
@@ -13870,7 +15208,7 @@ struct llm_build_context {
     //      https://github.com/ggerganov/llama.cpp/issues/5276#issuecomment-1925774738
     // based on the original build_llama() function
     struct ggml_cgraph * build_minicpm() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         GGML_ASSERT(n_embd_head == hparams.n_embd_head_k);
@@ -14014,7 +15352,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_minicpm3() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         //TODO: if the model varies, these parameters need to be read from the model
         const int64_t n_embd_base = 256;
@@ -14223,7 +15561,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_gemma() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head_k = hparams.n_embd_head_k;
 
@@ -14331,7 +15669,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_gemma2() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head_k = hparams.n_embd_head_k;
 
@@ -14467,7 +15805,7 @@ struct llm_build_context {
 
 
     struct ggml_cgraph * build_starcoder2() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         GGML_ASSERT(n_embd_head == hparams.n_embd_head_k);
@@ -14586,7 +15924,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_mamba() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         struct ggml_tensor * cur;
         struct ggml_tensor * inpL;
@@ -14641,7 +15979,7 @@ struct llm_build_context {
 
     struct ggml_cgraph * build_command_r() {
 
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         GGML_ASSERT(n_embd_head == hparams.n_embd_head_k);
@@ -14795,7 +16133,7 @@ struct llm_build_context {
     //   * removed bias
     //   * removed MoE
     struct ggml_cgraph * build_olmo() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         // mutable variable, needed during the last layer of the computation to skip unused tokens
         int32_t n_tokens = this->n_tokens;
@@ -14923,7 +16261,7 @@ struct llm_build_context {
     //   * removed bias
     //   * added q, k norm
     struct ggml_cgraph * build_olmoe() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         // mutable variable, needed during the last layer of the computation to skip unused tokens
         int32_t n_tokens = this->n_tokens;
@@ -15047,7 +16385,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_openelm() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         GGML_ASSERT(n_embd_head == hparams.n_embd_head_k);
@@ -15172,7 +16510,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_gptneox() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         const int64_t n_embd_gqa  = hparams.n_embd_v_gqa();
@@ -15314,7 +16652,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_arctic() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         // mutable variable, needed during the last layer of the computation to skip unused tokens
         int32_t n_tokens = this->n_tokens;
@@ -15446,7 +16784,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_deepseek2() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         // mutable variable, needed during the last layer of the computation to skip unused tokens
         int32_t n_tokens = this->n_tokens;
@@ -15674,7 +17012,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_bitnet() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         GGML_ASSERT(n_embd_head == hparams.n_embd_head_k);
@@ -15824,7 +17162,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_t5_encoder() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         // mutable variable, needed during the last layer of the computation to skip unused tokens
         int32_t n_tokens = this->n_tokens;
@@ -15956,7 +17294,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_t5_decoder() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         // mutable variable, needed during the last layer of the computation to skip unused tokens
         int32_t n_tokens = this->n_tokens;
@@ -16161,7 +17499,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_jais() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         const int64_t n_embd_gqa  = hparams.n_embd_v_gqa();
@@ -16253,7 +17591,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_chatglm() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         const int64_t n_embd_gqa  = hparams.n_embd_v_gqa();
@@ -16367,7 +17705,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_nemotron() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         const int64_t n_embd_head = hparams.n_embd_head_v;
         GGML_ASSERT(n_embd_head == hparams.n_embd_head_k);
@@ -16488,7 +17826,7 @@ struct llm_build_context {
     }
 
     struct ggml_cgraph * build_exaone() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         // mutable variable, needed during the last layer of the computation to skip unused tokens
         int32_t n_tokens = this->n_tokens;
@@ -16615,7 +17953,7 @@ struct llm_build_context {
     }
 
     ggml_cgraph * build_rwkv6() {
-        ggml_cgraph *gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        ggml_cgraph *gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         // Token shift state dimensions should be 2 * n_emb
         GGML_ASSERT(n_embd == hparams.n_embd_k_s() / 2);
@@ -16732,7 +18070,7 @@ struct llm_build_context {
     //   * removed bias
     //   * removed MoE
     struct ggml_cgraph * build_chameleon() {
-        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model), false);
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, llama_model_max_nodes(model, kv_self.runs.size()), false);
 
         // mutable variable, needed during the last layer of the computation to skip unused tokens
         int32_t n_tokens = this->n_tokens;
@@ -16938,16 +18276,13 @@ static struct ggml_cgraph * llama_build_graph_k_shift(llama_context & lctx) {
     return result;
 }
 
-static int32_t map_layer_to_subgf_id(uint32_t il, uint32_t my_rank, uint32_t n_world, const uint32_t * n_layer_window) {
-    if (!this_layer_is_mine(il, n_world, my_rank, n_layer_window)) {
+static int32_t map_layer_to_subgf_id(uint32_t il, uint32_t my_rank, uint32_t n_world, const uint32_t * n_layer_window, const uint32_t * n_layer_extra) {
+    const int32_t window_id = map_layer_to_window_id(il, n_world, my_rank, n_layer_window, n_layer_extra);
+    if (window_id < 0) {
         return -1;
     }
-
-    uint32_t total_window_size = 0;
-    for (uint32_t rank = 0; rank < n_world; ++rank) {
-        total_window_size += n_layer_window[rank];
-    }
-    return my_rank == 0 ? il / total_window_size + 1 : il / total_window_size;
+    // the master computes the input embedding in a subgraph of its own
+    return my_rank == 0 ? window_id + 1 : window_id;
 }
 
 static std::vector<struct ggml_cgraph *> llama_build_graph(
@@ -16958,13 +18293,22 @@ static std::vector<struct ggml_cgraph *> llama_build_graph(
     const uint32_t   n_world        = lctx.cparams.n_world;
     const uint32_t   my_rank        = lctx.cparams.rank;
     const uint32_t * n_layer_window = lctx.cparams.n_layer_window;
+    const uint32_t * n_layer_extra  = lctx.cparams.n_layer_extra;
+
+    // a graph built for the cache keeps its placements, they are lost when its scheduler is reset for another graph
+    auto set_backend = [&](int sub_gf_id, struct ggml_tensor * cur, ggml_backend_t backend) {
+        ggml_backend_sched_set_tensor_backend(lctx.sched[sub_gf_id], cur, backend);
+        if (lctx.graph_cache.building != nullptr) {
+            lctx.graph_cache.building->pins.push_back({ sub_gf_id, cur, backend });
+        }
+    };
 
     // this callback allows us to apply custom logic to each tensor (e.g. ggml-alloc, offloading, etc.)
     llm_build_cb cb = [&](struct ggml_tensor * cur, const char * name, int il) {
         int sub_gf_id = 0;
         if (il >= 0) {
             ggml_format_name(cur, "%s-%d", name, il);
-            sub_gf_id = map_layer_to_subgf_id(il, my_rank, n_world, n_layer_window);
+            sub_gf_id = map_layer_to_subgf_id(il, my_rank, n_world, n_layer_window, n_layer_extra);
             GGML_ASSERT(sub_gf_id != -1);
         } else {
             ggml_set_name(cur, name);
@@ -16973,7 +18317,7 @@ static std::vector<struct ggml_cgraph *> llama_build_graph(
         if (!lctx.cparams.offload_kqv) {
             if (strcmp(name, "kqv_merged_cont") == 0) {
                 // all nodes between the KV store and the attention output are run on the CPU
-                ggml_backend_sched_set_tensor_backend(lctx.sched[sub_gf_id], cur, lctx.backend_cpu);
+                set_backend(sub_gf_id, cur, lctx.backend_cpu);
             }
         }
 
@@ -16983,10 +18327,10 @@ static std::vector<struct ggml_cgraph *> llama_build_graph(
         if (batch.n_tokens < 32 || full_offload) {
             if (il != -1 && strcmp(name, "norm") == 0) {
                 for (auto * backend : lctx.backends) {
-                    int local_id = map_layer_to_local_id(il, n_world, my_rank, n_layer_window);
+                    int local_id = map_layer_to_local_id(il, n_world, my_rank, n_layer_window, n_layer_extra);
                     if (ggml_backend_supports_buft(backend, lctx.model.buft_layer[local_id].buft) &&
                         (ggml_backend_supports_op(backend, cur) || ggml_backend_offload_op(backend, cur))) {
-                        ggml_backend_sched_set_tensor_backend(lctx.sched[sub_gf_id], cur, backend);
+                        set_backend(sub_gf_id, cur, backend);
                         break;
                     }
                 }
@@ -16996,6 +18340,11 @@ static std::vector<struct ggml_cgraph *> llama_build_graph(
 
     std::vector<ggml_cgraph *> result = {};
 
+    // the worst case stores one run from the end of the cache, not the placement of the last ubatch
+    if (worst_case) {
+        lctx.kv_self.runs.clear();
+    }
+
     struct llm_build_context llm(lctx, batch, cb, worst_case);
 
     llm.init();
@@ -17273,6 +18622,17 @@ static void llama_view_tensor(struct ggml_tensor * tensor, int n=10, bool is_int
     }
 }
 
+// activations arrive in host memory, a host input tensor is pointed at them instead of copied.
+// the received data must stay untouched until the subgraph that reads it has run
+static void llama_set_input_embd(struct ggml_tensor * inp, float * src) {
+    GGML_ASSERT(inp->type == GGML_TYPE_F32);
+    if (inp->buffer != nullptr && ggml_backend_buffer_is_host(inp->buffer)) {
+        inp->data = src;
+    } else {
+        ggml_backend_tensor_set(inp, src, 0, ggml_nbytes(inp));
+    }
+}
+
 static void llama_set_inputs(llama_context & lctx, const llama_ubatch & batch) {
     //
     // set input data
@@ -17297,26 +18657,21 @@ static void llama_set_inputs(llama_context & lctx, const llama_ubatch & batch) {
         }
     } else if (batch.activate_output) {
         if (batch.out_embd && lctx.out_embd) {
-            const int64_t n_embd   = lctx.out_embd->ne[0];
-            const int64_t n_output = lctx.out_embd->ne[1];
-            const int64_t size_    = n_output * n_embd * ggml_element_size(lctx.out_embd);
-            ggml_backend_tensor_set(lctx.out_embd, batch.out_embd, 0, size_);
+            llama_set_input_embd(lctx.out_embd, batch.out_embd);
         }
     } else {
         GGML_ASSERT(batch.backend_embd && lctx.backend_embd && lctx.backend_embd->data != nullptr);
-        const int64_t n_embd   = lctx.backend_embd->ne[0];
-        const int64_t n_tokens = lctx.backend_embd->ne[1];
-        const int64_t size_    = n_tokens * n_embd * ggml_element_size(lctx.backend_embd);
-        ggml_backend_tensor_set(lctx.backend_embd, batch.backend_embd, 0, size_);
+        llama_set_input_embd(lctx.backend_embd, batch.backend_embd);
     }
 
-    if (batch.pos && lctx.inp_pos) {
+    // the inputs of subgraphs whose scheduler has not allocated them yet are set right before those run
+    if (batch.pos && lctx.inp_pos && lctx.inp_pos->buffer) {
         const int64_t n_tokens = batch.n_tokens;
 
         ggml_backend_tensor_set(lctx.inp_pos, batch.pos, 0, n_tokens*ggml_element_size(lctx.inp_pos));
     }
 
-    if (lctx.inp_out_ids && (hparams.causal_attn || cparams.pooling_type == LLAMA_POOLING_TYPE_NONE)) {
+    if (lctx.inp_out_ids && lctx.inp_out_ids->buffer && (hparams.causal_attn || cparams.pooling_type == LLAMA_POOLING_TYPE_NONE)) {
         GGML_ASSERT(lctx.inp_out_ids && "every model that can must skip unused outputs");
         const int64_t n_tokens = batch.n_tokens;
 
@@ -17363,12 +18718,12 @@ static void llama_set_inputs(llama_context & lctx, const llama_ubatch & batch) {
             float * data     = nullptr;
             float * data_swa = nullptr;
 
-            if (lctx.inp_KQ_mask) {
+            if (lctx.inp_KQ_mask && lctx.inp_KQ_mask->buffer) {
                 GGML_ASSERT(ggml_backend_buffer_is_host(lctx.inp_KQ_mask->buffer));
                 data = (float *) lctx.inp_KQ_mask->data;
             }
 
-            if (lctx.inp_KQ_mask_swa) {
+            if (lctx.inp_KQ_mask_swa && lctx.inp_KQ_mask_swa->buffer) {
                 GGML_ASSERT(ggml_backend_buffer_is_host(lctx.inp_KQ_mask_swa->buffer));
                 data_swa = (float *) lctx.inp_KQ_mask_swa->data;
             }
@@ -17817,29 +19172,148 @@ static void llama_graph_compute(
     }
 }
 
-struct input_tensors {
-    ggml_tensor * sub_gf_out;
-    ggml_tensor * inp_pos;
+// control messages travel down the ring as a single frame: a fixed header followed by the
+// packed [n_tokens] arrays of the batch, in the order pos, n_seq_id, seq_id, logits.
+// bump META_VERSION on any change of the layout
+#define META_MAGIC   0x4154454d // "META"
+#define META_VERSION 4
+
+#define META_HAS_POS    1
+#define META_HAS_SEQ_ID 2 // n_seq_id and a single seq_id per token
+#define META_HAS_LOGITS 4
+
+enum meta_cmd {
+    META_CMD_BATCH       = 0,
+    META_CMD_KV_CLEAR    = 1,
+    META_CMD_KV_SEQ_RM   = 2,
+    META_CMD_KV_SEQ_ADD  = 3,
+    META_CMD_KV_SEQ_CP   = 4,
+    META_CMD_KV_SEQ_KEEP = 5,
+    META_CMD_KV_SEQ_DIV  = 6,
+    META_CMD_PERF        = 7, // args[0] ranks, followed by one llama_rank_perf per rank
+    META_CMD_RESHARD     = 8, // args[0] set if n_gpu_layers is given, followed by n_layer_window[32], n_layer_extra[32] and n_gpu_layers[32]
+    META_CMD_RECOVER     = 9, // args[0] failed rank, args[1] ring epoch, args[2] set to reconnect to args[3], followed by meta_recover
+    META_CMD_JOIN        = 10, // args[0] rank of the new device (0 = turned away), args[1] its bind rank, args[2] ring epoch, args[3] n_ctx, args[4] set if n_gpu_layers is given, followed by meta_join
+    META_CMD_KV_HANDOFF  = 11, // args[0] lap, args[1] set while no layer is lost, args[2..4] head, used cells and size of the kv cache, followed by more parts, see llama_kv_handoff
 };
 
-struct sync_meta {
-    int32_t         n_tokens = 0;
-    llama_pos    *  pos      = nullptr;
-    int32_t      *  n_seq_id = nullptr;
-    llama_seq_id ** seq_id   = nullptr;
-    int8_t       *  logits   = nullptr;
+// the new ring after a rank failed, the master sends it to every device directly
+struct meta_recover {
+    uint32_t n_layer_window[32]; // without the failed rank
+    uint32_t n_layer_extra[32];
+    char     next_ip[64];        // next node of the device that reconnects
+};
+
+// the ring with a new device after the last rank, the master sends it around the ring and the last rank
+// passes it on to the new device
+struct meta_join {
+    uint32_t n_layer_window[32]; // with the new device
+    uint32_t n_layer_extra[32];
+    uint32_t n_gpu_layers[32];
+    char     ip[64];             // address of the new device
+};
+
+// a layer of the kv cache in a META_CMD_KV_HANDOFF message, the next part holds its cells
+struct meta_kv_part {
+    uint32_t il;
+    uint32_t dst;     // rank it goes to
+    uint32_t replica; // set if it refreshes the replica of dst rather than its kv cache
+    uint32_t reserved;
+};
 
+struct meta_header {
+    uint32_t  magic;
+    uint16_t  version;
+    uint16_t  cmd;           // meta_cmd
+    int32_t   n_tokens;
+    uint32_t  flags;         // META_HAS_*
     llama_pos all_pos_0;
     llama_pos all_pos_1;
-    uint32_t  n_ctx          = 0;
-    
-    // signal to clear the kv cache
-    bool clear_kv_cache        = false;
+    uint32_t  n_micro_batch;
+    int32_t   args[5];       // arguments of the KV cache commands
+};
 
-    // signal to remove a kv cache sequence
-    bool kv_seq_rm             = false;
-    llama_seq_id rm_seq_id     = 0;
-    llama_pos    rm_p0         = 0;
+static_assert(sizeof(meta_header) % sizeof(int32_t) == 0, "the batch arrays must stay aligned");
+static_assert(sizeof(meta_header) % sizeof(int64_t) == 0, "the rank reports must stay aligned");
+
+static size_t meta_frame_size(int32_t n_tokens, uint32_t flags) {
+    size_t size = sizeof(meta_header);
+    if (flags & META_HAS_POS) {
+        size += n_tokens * sizeof(llama_pos);
+    }
+    if (flags & META_HAS_SEQ_ID) {
+        size += n_tokens * (sizeof(int32_t) + sizeof(llama_seq_id));
+    }
+    if (flags & META_HAS_LOGITS) {
+        size += n_tokens * sizeof(int8_t);
+    }
+    return size;
+}
+
+static size_t meta_perf_frame_size(uint32_t n_world) {
+    return sizeof(meta_header) + n_world * sizeof(llama_rank_perf);
+}
+
+static size_t meta_reshard_frame_size() {
+    return sizeof(meta_header) + 3 * 32 * sizeof(uint32_t);
+}
+
+static size_t meta_recover_frame_size() {
+    return sizeof(meta_header) + sizeof(meta_recover);
+}
+
+static size_t meta_join_frame_size() {
+    return sizeof(meta_header) + sizeof(meta_join);
+}
+
+// the master announces a rebuilt ring on the data socket with a single frame
+static bool meta_is_recover_frame(const void * data, size_t size) {
+    const meta_header * hdr = (const meta_header *) data;
+    return size == meta_recover_frame_size() && hdr->magic == META_MAGIC && hdr->version == META_VERSION && hdr->cmd == META_CMD_RECOVER;
+}
+
+// the largest message a worker may receive
+static size_t meta_recv_capacity(uint32_t n_batch) {
+    return std::max({
+        meta_frame_size(n_batch, META_HAS_POS | META_HAS_SEQ_ID | META_HAS_LOGITS),
+        meta_perf_frame_size(32),
+        meta_reshard_frame_size(),
+        meta_recover_frame_size(),
+        meta_join_frame_size(),
+    });
+}
+
+static meta_header * meta_init_header(std::vector<uint8_t> & buf, size_t size, meta_cmd cmd) {
+    if (buf.size() < size) {
+        buf.resize(size);
+    }
+    meta_header * hdr = (meta_header *) buf.data();
+    std::memset(hdr, 0, sizeof(meta_header));
+    hdr->magic   = META_MAGIC;
+    hdr->version = META_VERSION;
+    hdr->cmd     = cmd;
+    return hdr;
+}
+
+struct sync_meta {
+    int32_t         n_tokens = 0;
+    llama_pos    *  pos      = nullptr;
+    int32_t      *  n_seq_id = nullptr;
+    llama_seq_id ** seq_id   = nullptr;
+    int8_t       *  logits   = nullptr;
+
+    llama_pos all_pos_0;
+    llama_pos all_pos_1;
+    uint32_t  n_ctx          = 0;
+    uint32_t  n_micro_batch  = 0; // micro-batch size chosen by the master, followed by all devices
+    
+    // signal to clear the kv cache
+    bool clear_kv_cache        = false;
+
+    // signal to remove a kv cache sequence
+    bool kv_seq_rm             = false;
+    llama_seq_id rm_seq_id     = 0;
+    llama_pos    rm_p0         = 0;
     llama_pos    rm_p1         = 0;
 
     // signal to add a kv cache sequence
@@ -17865,845 +19339,1367 @@ struct sync_meta {
     llama_pos    div_p0        = 0;
     llama_pos    div_p1        = 0;
     int          div_factor    = 1;
+
+    // signal to report the cost of this rank, the reports of all ranks travel in one frame
+    llama_rank_perf * perf_set    = nullptr;
+    uint32_t          perf_n_rank = 0;
+
+    // signal to move the layer windows
+    const uint32_t * reshard_window     = nullptr;
+    const uint32_t * reshard_extra      = nullptr;
+    const uint32_t * reshard_gpu_layers = nullptr;
+
+    // signal to continue on a ring without a failed rank
+    const uint8_t * recover_frame = nullptr;
+
+    // signal to continue on a ring with a new device
+    const uint8_t * join_frame = nullptr;
+
+    // signal to take and pass on the kv cache of moved layers, the parts are in the arena
+    const uint8_t * kv_handoff_frame = nullptr;
 };
 
-static void llama_send_meta(zmq::socket_t & socket, struct sync_meta * meta, bool align_seq_ids = false) {
+static void llama_send_meta(zmq::socket_t & socket, std::vector<uint8_t> & buf, struct sync_meta * meta, bool align_seq_ids = false) {
     GGML_ASSERT(meta != nullptr);
-    try {
-        std::vector<zmq::message_t> send_msgs;
+    GGML_ASSERT(meta->n_tokens > 0);
 
-        GGML_ASSERT(meta->n_tokens != 0);
-        send_msgs.emplace_back("n_tokens", strlen("n_tokens"));
-        send_msgs.emplace_back(&(meta->n_tokens), sizeof(meta->n_tokens));
+    const int32_t n_tokens = meta->n_tokens;
 
-        if (meta->pos != nullptr) {
-            send_msgs.emplace_back("pos", strlen("pos"));
-            send_msgs.emplace_back(meta->pos, meta->n_tokens * sizeof(llama_pos));
-        }
-
-        if (meta->n_seq_id != nullptr) {
-            GGML_ASSERT(meta->n_tokens > 0);
-            send_msgs.emplace_back("n_seq_id", strlen("n_seq_id"));
-            send_msgs.emplace_back(meta->n_seq_id, meta->n_tokens * sizeof(int32_t));
+    uint32_t flags = 0;
+    flags |= meta->pos      != nullptr ? META_HAS_POS    : 0;
+    flags |= meta->n_seq_id != nullptr ? META_HAS_SEQ_ID : 0;
+    flags |= meta->logits   != nullptr ? META_HAS_LOGITS : 0;
 
-            // here we assume only a single seq_id per token is needed
-            // pack all single seq_id values into a contiguous array
-            llama_seq_id * all_seq_ids = (llama_seq_id *) malloc(meta->n_tokens * sizeof(llama_seq_id));
-            int seq_id_offset = align_seq_ids ? 1 : 0;
-            for (int32_t i = 0; i < meta->n_tokens; ++i) {
-                all_seq_ids[i] = meta->seq_id[i][0] - seq_id_offset;
-            }
-            
-            send_msgs.emplace_back("seq_id", strlen("seq_id"));
-            send_msgs.emplace_back(all_seq_ids, meta->n_tokens * sizeof(llama_seq_id));
-            free(all_seq_ids);
-        }
+    const size_t size = meta_frame_size(n_tokens, flags);
 
-        if (meta->logits != nullptr) {
-            GGML_ASSERT(meta->n_tokens > 0);
-            send_msgs.emplace_back("logits", strlen("logits"));
-            send_msgs.emplace_back(meta->logits, meta->n_tokens * sizeof(int8_t));
-        }
+    meta_header * hdr = meta_init_header(buf, size, META_CMD_BATCH);
+    hdr->n_tokens      = n_tokens;
+    hdr->flags         = flags;
+    hdr->all_pos_0     = meta->all_pos_0;
+    hdr->all_pos_1     = meta->all_pos_1;
+    hdr->n_micro_batch = meta->n_micro_batch;
 
-        send_msgs.emplace_back("all_pos_0", strlen("all_pos_0"));
-        send_msgs.emplace_back(&(meta->all_pos_0), sizeof(meta->all_pos_0));
+    uint8_t * p = buf.data() + sizeof(meta_header);
+    if (flags & META_HAS_POS) {
+        std::memcpy(p, meta->pos, n_tokens * sizeof(llama_pos));
+        p += n_tokens * sizeof(llama_pos);
+    }
+    if (flags & META_HAS_SEQ_ID) {
+        std::memcpy(p, meta->n_seq_id, n_tokens * sizeof(int32_t));
+        p += n_tokens * sizeof(int32_t);
 
-        send_msgs.emplace_back("all_pos_1", strlen("all_pos_1"));
-        send_msgs.emplace_back(&(meta->all_pos_1), sizeof(meta->all_pos_1));
+        // here we assume only a single seq_id per token is needed
+        llama_seq_id * seq_ids = (llama_seq_id *) p;
+        const int seq_id_offset = align_seq_ids ? 1 : 0;
+        for (int32_t i = 0; i < n_tokens; ++i) {
+            seq_ids[i] = meta->seq_id[i][0] - seq_id_offset;
+        }
+        p += n_tokens * sizeof(llama_seq_id);
+    }
+    if (flags & META_HAS_LOGITS) {
+        std::memcpy(p, meta->logits, n_tokens * sizeof(int8_t));
+    }
 
-        zmq::send_multipart(socket, send_msgs);
+    try {
+        socket.send(zmq::buffer(buf.data(), size), zmq::send_flags::none);
     } catch (const zmq::error_t& e) {
         LLAMA_LOG_INFO("Failed to send meta data: %s\n", e.what());
     }
 }
 
-static int llama_recv_meta(zmq::socket_t & socket, struct sync_meta * meta) {
+static void llama_send_meta_cmd(struct llama_context * ctx, meta_cmd cmd, std::initializer_list<int32_t> args) {
+    if (ctx->send_socket == nullptr) {
+        return;
+    }
+
+    GGML_ASSERT(args.size() <= 5);
+
+    auto & buf = ctx->meta_arena.send_buf;
+    meta_header * hdr = meta_init_header(buf, sizeof(meta_header), cmd);
+    std::copy(args.begin(), args.end(), hdr->args);
+
+    try {
+        ctx->send_socket->send(zmq::buffer(buf.data(), sizeof(meta_header)), zmq::send_flags::none);
+    } catch (const zmq::error_t & e) {
+        LLAMA_LOG_WARN("Failed to send KV cache command %d: %s\n", (int) cmd, e.what());
+    }
+}
+
+// receive a control message into the arena, the batch arrays of meta point into it afterwards
+static bool comm_is_to_master(const std::vector<zmq::message_t> & msgs);
+
+// receive a control message, outputs for the master that arrive in between go on through relay
+static int llama_recv_meta(zmq::socket_t & socket, llama_context::meta_buffers & arena, struct sync_meta * meta, llama_comm * relay) {
     socket.set(zmq::sockopt::rcvtimeo, 1000);
 
-    std::vector<zmq::message_t> recv_msgs;
-    if (!zmq::recv_multipart(socket, std::back_inserter(recv_msgs))) {
+    auto & buf = arena.recv_buf;
+    const auto res = socket.recv(zmq::buffer(buf), zmq::recv_flags::none);
+    if (!res) {
         return -1;
     }
 
     socket.set(zmq::sockopt::rcvtimeo, -1);
 
-    const std::string cmd = recv_msgs[0].to_string();
-    size_t idx = 1;
+    if (socket.get(zmq::sockopt::rcvmore)) {
+        const meta_header * hdr = (const meta_header *) buf.data();
+        const bool is_handoff = res->size == sizeof(meta_header) && hdr->magic == META_MAGIC && hdr->version == META_VERSION &&
+                                hdr->cmd == META_CMD_KV_HANDOFF;
 
-    if (cmd == "clear_kv_cache" && recv_msgs.size() == 1) {
-        meta->clear_kv_cache = true;
-        return 0;
-    }
+        std::vector<zmq::message_t> msgs;
+        if (!is_handoff) {
+            msgs.emplace_back(buf.data(), std::min(res->size, buf.size()));
+        }
+        arena.handoff.clear();
+        while (socket.get(zmq::sockopt::rcvmore)) {
+            zmq::message_t part;
+            if (!socket.recv(part, zmq::recv_flags::none)) {
+                break;
+            }
+            (is_handoff ? arena.handoff : msgs).push_back(std::move(part));
+        }
+        if (is_handoff) {
+            meta->kv_handoff_frame = buf.data();
+            return 0;
+        }
 
-    if (cmd == "kv_seq_rm" && recv_msgs.size() == 4) {
-        meta->kv_seq_rm = true;
-        std::memcpy(&meta->rm_seq_id,     recv_msgs[idx++].data(), sizeof(meta->rm_seq_id));
-        std::memcpy(&meta->rm_p0,         recv_msgs[idx++].data(), sizeof(meta->rm_p0));
-        std::memcpy(&meta->rm_p1,         recv_msgs[idx++].data(), sizeof(meta->rm_p1));
-        return 0;
-    }
+        // the device holding the last layer finished while this one waits for the next batch
+        if (relay != nullptr && relay->relay != nullptr && comm_is_to_master(msgs)) {
+            relay->pass_on(std::move(msgs));
+            return -1;
+        }
 
-    if (cmd == "kv_seq_add" && recv_msgs.size() == 5) {
-        meta->kv_seq_add = true;
-        std::memcpy(&meta->add_seq_id,    recv_msgs[idx++].data(), sizeof(meta->add_seq_id));
-        std::memcpy(&meta->add_p0,        recv_msgs[idx++].data(), sizeof(meta->add_p0));
-        std::memcpy(&meta->add_p1,        recv_msgs[idx++].data(), sizeof(meta->add_p1));
-        std::memcpy(&meta->add_delta,     recv_msgs[idx++].data(), sizeof(meta->add_delta));
-        return 0;
+        // activations that were in flight when the ring was rebuilt, drop them
+        LLAMA_LOG_DEBUG("%s: dropped activations of an aborted pass\n", __func__);
+        return -1;
     }
 
-    if (cmd == "kv_seq_cp" && recv_msgs.size() == 5) {
-        meta->kv_seq_cp = true;
-        std::memcpy(&meta->cp_src_seq_id, recv_msgs[idx++].data(), sizeof(meta->cp_src_seq_id));
-        std::memcpy(&meta->cp_dst_seq_id, recv_msgs[idx++].data(), sizeof(meta->cp_dst_seq_id));
-        std::memcpy(&meta->cp_p0,         recv_msgs[idx++].data(), sizeof(meta->cp_p0));
-        std::memcpy(&meta->cp_p1,         recv_msgs[idx++].data(), sizeof(meta->cp_p1));
-        return 0;
+    if (res->truncated()) {
+        LLAMA_LOG_ERROR("%s: control message of %zu bytes does not fit in %zu bytes\n", __func__, res->untruncated_size, buf.size());
+        return -1;
+    }
+    if (res->size < sizeof(meta_header)) {
+        LLAMA_LOG_ERROR("%s: control message of %zu bytes is shorter than its header\n", __func__, res->size);
+        return -1;
     }
 
-    if (cmd == "kv_seq_keep" && recv_msgs.size() == 2) {
-        meta->kv_seq_keep = true;
-        std::memcpy(&meta->keep_seq_id,   recv_msgs[idx++].data(), sizeof(meta->keep_seq_id));
-        return 0;
+    const meta_header * hdr = (const meta_header *) buf.data();
+    if (hdr->magic != META_MAGIC || hdr->version != META_VERSION) {
+        LLAMA_LOG_ERROR("%s: control message version %u, expected %u\n", __func__,
+            hdr->magic == META_MAGIC ? (unsigned) hdr->version : 0u, (unsigned) META_VERSION);
+        return -1;
     }
 
-    if (cmd == "kv_seq_div" && recv_msgs.size() == 5) {
-        meta->kv_seq_div = true;
-        std::memcpy(&meta->div_seq_id,    recv_msgs[idx++].data(), sizeof(meta->div_seq_id));
-        std::memcpy(&meta->div_p0,        recv_msgs[idx++].data(), sizeof(meta->div_p0));
-        std::memcpy(&meta->div_p1,        recv_msgs[idx++].data(), sizeof(meta->div_p1));
-        std::memcpy(&meta->div_factor,    recv_msgs[idx++].data(), sizeof(meta->div_factor));
-        return 0;
+    const int32_t * args = hdr->args;
+    switch (hdr->cmd) {
+        case META_CMD_KV_CLEAR:
+            meta->clear_kv_cache = true;
+            return 0;
+        case META_CMD_KV_SEQ_RM:
+            meta->kv_seq_rm     = true;
+            meta->rm_seq_id     = args[0];
+            meta->rm_p0         = args[1];
+            meta->rm_p1         = args[2];
+            return 0;
+        case META_CMD_KV_SEQ_ADD:
+            meta->kv_seq_add    = true;
+            meta->add_seq_id    = args[0];
+            meta->add_p0        = args[1];
+            meta->add_p1        = args[2];
+            meta->add_delta     = args[3];
+            return 0;
+        case META_CMD_KV_SEQ_CP:
+            meta->kv_seq_cp     = true;
+            meta->cp_src_seq_id = args[0];
+            meta->cp_dst_seq_id = args[1];
+            meta->cp_p0         = args[2];
+            meta->cp_p1         = args[3];
+            return 0;
+        case META_CMD_KV_SEQ_KEEP:
+            meta->kv_seq_keep   = true;
+            meta->keep_seq_id   = args[0];
+            return 0;
+        case META_CMD_KV_SEQ_DIV:
+            meta->kv_seq_div    = true;
+            meta->div_seq_id    = args[0];
+            meta->div_p0        = args[1];
+            meta->div_p1        = args[2];
+            meta->div_factor    = args[3];
+            return 0;
+        case META_CMD_PERF:
+            if (args[0] <= 0 || args[0] > 32 || res->size != meta_perf_frame_size(args[0])) {
+                LLAMA_LOG_ERROR("%s: malformed rank report (%d ranks in %zu bytes)\n", __func__, args[0], res->size);
+                return -1;
+            }
+            meta->perf_set      = (llama_rank_perf *) (buf.data() + sizeof(meta_header));
+            meta->perf_n_rank   = args[0];
+            return 0;
+        case META_CMD_RESHARD:
+            if (res->size != meta_reshard_frame_size()) {
+                LLAMA_LOG_ERROR("%s: malformed reshard command (%zu bytes)\n", __func__, res->size);
+                return -1;
+            }
+            meta->reshard_window     = (const uint32_t *) (buf.data() + sizeof(meta_header));
+            meta->reshard_extra      = meta->reshard_window + 32;
+            meta->reshard_gpu_layers = args[0] ? meta->reshard_window + 64 : nullptr;
+            return 0;
+        case META_CMD_RECOVER:
+            if (res->size != meta_recover_frame_size()) {
+                LLAMA_LOG_ERROR("%s: malformed recover command (%zu bytes)\n", __func__, res->size);
+                return -1;
+            }
+            meta->recover_frame = buf.data();
+            return 0;
+        case META_CMD_JOIN:
+            if (res->size != meta_join_frame_size()) {
+                LLAMA_LOG_ERROR("%s: malformed join command (%zu bytes)\n", __func__, res->size);
+                return -1;
+            }
+            meta->join_frame = buf.data();
+            return 0;
+        case META_CMD_BATCH:
+            break;
+        default:
+            LLAMA_LOG_ERROR("%s: unknown control message %u\n", __func__, (unsigned) hdr->cmd);
+            return -1;
     }
 
-    for (size_t i = 0; i < recv_msgs.size(); i += 2) {
-        std::string key           = recv_msgs[i].to_string();
-        zmq::message_t & data_msg = recv_msgs[i + 1];
+    const int32_t n_tokens = hdr->n_tokens;
+    if (n_tokens <= 0 || res->size != meta_frame_size(n_tokens, hdr->flags)) {
+        LLAMA_LOG_ERROR("%s: malformed batch metadata (%d tokens in %zu bytes)\n", __func__, n_tokens, res->size);
+        return -1;
+    }
 
-        if (key == "n_tokens") {
-            GGML_ASSERT(data_msg.size() == sizeof(meta->n_tokens));
-            std::memcpy(&(meta->n_tokens), data_msg.data(), sizeof(meta->n_tokens));
-        }
+    meta->n_tokens      = n_tokens;
+    meta->all_pos_0     = hdr->all_pos_0;
+    meta->all_pos_1     = hdr->all_pos_1;
+    meta->n_micro_batch = hdr->n_micro_batch;
 
-        if (key == "pos") {
-            meta->pos = (llama_pos *) malloc(meta->n_tokens * sizeof(llama_pos));
-            std::memcpy(meta->pos, data_msg.data(), meta->n_tokens * sizeof(llama_pos));
-        }
+    uint8_t * p = buf.data() + sizeof(meta_header);
+    if (hdr->flags & META_HAS_POS) {
+        meta->pos = (llama_pos *) p;
+        p += n_tokens * sizeof(llama_pos);
+    }
+    if (hdr->flags & META_HAS_SEQ_ID) {
+        meta->n_seq_id = (int32_t *) p;
+        p += n_tokens * sizeof(int32_t);
 
-        if (key == "n_seq_id") {
-            GGML_ASSERT(meta->n_tokens > 0);
-            GGML_ASSERT(data_msg.size() == meta->n_tokens * sizeof(int32_t));
-            meta->n_seq_id = (int32_t *) malloc(meta->n_tokens * sizeof(int32_t));
-            std::memcpy(meta->n_seq_id, data_msg.data(), meta->n_tokens * sizeof(int32_t));
+        llama_seq_id * seq_ids = (llama_seq_id *) p;
+        arena.seq_id.resize(n_tokens);
+        for (int32_t i = 0; i < n_tokens; ++i) {
+            arena.seq_id[i] = seq_ids + i;
         }
+        meta->seq_id = arena.seq_id.data();
+        p += n_tokens * sizeof(llama_seq_id);
+    }
+    if (hdr->flags & META_HAS_LOGITS) {
+        meta->logits = (int8_t *) p;
+    }
+    return 0;
+}
 
-        if (key == "seq_id") {
-            GGML_ASSERT(meta->n_tokens > 0);
-            GGML_ASSERT(data_msg.size() == meta->n_tokens * sizeof(llama_seq_id));
-            const llama_seq_id * all_seq_ids = (llama_seq_id *) data_msg.data();
-            meta->seq_id = (llama_seq_id **) malloc(meta->n_tokens * sizeof(llama_seq_id *));
-            for (int32_t i = 0; i < meta->n_tokens; ++i) {
-                meta->seq_id[i] = (llama_seq_id *) malloc(sizeof(llama_seq_id));
-                meta->seq_id[i][0] = all_seq_ids[i];
-            }
-        }
+// pass the control message held in the arena on to the next rank unchanged
+static void llama_forward_meta(llama_context & lctx, size_t size) {
+    if (lctx.comm.is_async()) {
+        lctx.comm.flush();
+    }
+    try {
+        lctx.send_socket->send(zmq::buffer(lctx.meta_arena.recv_buf.data(), size), zmq::send_flags::none);
+    } catch (const zmq::error_t & e) {
+        LLAMA_LOG_WARN("Failed to forward control message: %s\n", e.what());
+    }
+}
 
-        if (key == "logits") {
-            GGML_ASSERT(meta->n_tokens > 0);
-            GGML_ASSERT(data_msg.size() == meta->n_tokens * sizeof(int8_t));
-            meta->logits = (int8_t *) malloc(meta->n_tokens * sizeof(int8_t));
-            std::memcpy(meta->logits, data_msg.data(), meta->n_tokens * sizeof(int8_t));
-        }
+// cost of this rank accumulated since the previous call
+static llama_rank_perf llama_rank_perf_take(llama_context & lctx) {
+    const auto & model   = lctx.model;
+    const auto & cparams = lctx.cparams;
 
-        if (key == "all_pos_0") {
-            GGML_ASSERT(data_msg.size() == sizeof(meta->all_pos_0));
-            std::memcpy(&(meta->all_pos_0), data_msg.data(), sizeof(meta->all_pos_0));
+    llama_rank_perf now = {};
+    now.n_layers = model.layers.size();
+    if (now.n_layers > 0) {
+        now.n_cycles = llama_n_cycles(model.hparams.n_layer, cparams.n_world, cparams.n_layer_window, cparams.n_layer_extra);
+        for (const auto & buft : model.buft_layer) {
+            now.n_gpu_layers += buft.buft != llama_default_buffer_type_cpu(model, true);
         }
+    }
+    for (const auto & w : lctx.win_perf) {
+        now.t_compute_ms   += 1e-3 * w.t_compute_us;
+        now.t_prefetch_ms  += 1e-3 * w.t_prefetch_us;
+        now.n_major_faults += w.n_maj_faults;
+    }
+    // every pass runs the first subgraph exactly once
+    now.n_evals   = lctx.win_perf.empty() ? 0 : lctx.win_perf[0].n_runs;
+    now.t_send_ms = 1e-3 * lctx.comm.t_send_us.load();
 
-        if (key == "all_pos_1") {
-            GGML_ASSERT(data_msg.size() == sizeof(meta->all_pos_1));
-            std::memcpy(&(meta->all_pos_1), data_msg.data(), sizeof(meta->all_pos_1));
-        }
+    llama_rank_perf & mark = lctx.perf_mark;
+    if (now.n_evals < mark.n_evals) {
+        // the window stats were reset in between
+        mark.n_evals        = 0;
+        mark.t_compute_ms   = 0.0;
+        mark.t_prefetch_ms  = 0.0;
+        mark.n_major_faults = 0;
     }
-    return 0;
-}
 
-static void llama_send_tensors(zmq::socket_t & socket, struct llama_ubatch * ubatch, struct input_tensors * tensors) {
-    try {
-        std::vector<zmq::message_t> send_msgs;
-        size_t buf_size = 0;
+    llama_rank_perf delta = now;
+    delta.n_evals        -= mark.n_evals;
+    delta.t_compute_ms   -= mark.t_compute_ms;
+    delta.t_prefetch_ms  -= mark.t_prefetch_ms;
+    delta.t_send_ms      -= mark.t_send_ms;
+    delta.n_major_faults -= mark.n_major_faults;
 
-        send_msgs.emplace_back("sub_gf_out", strlen("sub_gf_out"));
-        send_msgs.emplace_back(tensors->sub_gf_out->ne, sizeof(tensors->sub_gf_out->ne));
-        buf_size = tensors->sub_gf_out->ne[0] * tensors->sub_gf_out->ne[1] * sizeof(float);
-        send_msgs.emplace_back(ubatch->backend_embd, buf_size);
+    mark = now;
+    return delta;
+}
 
-        if (tensors->inp_pos) {
-            send_msgs.emplace_back("inp_pos", strlen("inp_pos"));
-            send_msgs.emplace_back(tensors->inp_pos->ne, sizeof(tensors->inp_pos->ne[0]));
-            buf_size = tensors->inp_pos->ne[0] * sizeof(int32_t);
-            send_msgs.emplace_back(ubatch->pos, buf_size);
-        }
+// drop the weights of this rank, another layer window is loaded in place afterwards
+static void llama_model_unload_tensors(llama_model & model) {
+    model.stream.reset();
 
-        zmq::send_multipart(socket, send_msgs);
-    } catch (const zmq::error_t& e) {
-        LLAMA_LOG_INFO("Failed to send tensor data: %s\n", e.what());
+    for (struct ggml_context * ctx : model.ctxs) {
+        ggml_free(ctx);
+    }
+    for (ggml_backend_buffer_t buf : model.bufs) {
+        ggml_backend_buffer_free(buf);
     }
+    model.ctxs.clear();
+    model.bufs.clear();
+    model.mlock_bufs.clear();
+    model.mlock_mmaps.clear();
+    model.mappings.clear();
+    model.tensors_by_name.clear();
+    model.layers.clear();
+    model.buft_layer.clear();
 }
 
-static void llama_recv_tensors(zmq::socket_t & socket, struct llama_ubatch * ubatch, const bool is_out_embd=false) {
-    std::vector<zmq::message_t> recv_msgs;
-    if (!zmq::recv_multipart(socket, std::back_inserter(recv_msgs))) {
-        LLAMA_LOG_INFO("Failed to receive tensor data.\n");
-        return;
+// release what llama_context_setup_backend allocated, except the output buffer which does not depend on the layers
+static void llama_context_free_backend(llama_context & lctx) {
+    for (ggml_backend_sched_t s : lctx.sched) {
+        ggml_backend_sched_free(s);
     }
+    for (ggml_backend_t backend : lctx.backends) {
+        ggml_backend_free(backend);
+    }
+    lctx.sched.clear();
+    lctx.backends.clear();
+    lctx.set_n_threads_fns.clear();
+    lctx.backend_cpu = nullptr;
 
-    for (size_t i = 0; i < recv_msgs.size(); i += 3) {
-        std::string key = recv_msgs[i].to_string();
-        zmq::message_t &dims_msg = recv_msgs[i + 1];
-        zmq::message_t &data_msg = recv_msgs[i + 2];
+    auto & kv = lctx.kv_self;
+    for (struct ggml_context * ctx : kv.ctxs) {
+        ggml_free(ctx);
+    }
+    for (ggml_backend_buffer_t buf : kv.bufs) {
+        ggml_backend_buffer_free(buf);
+    }
+    kv.ctxs.clear();
+    kv.bufs.clear();
+    kv.k_l.clear();
+    kv.v_l.clear();
+    kv.cells.clear();
+    kv.head = 0;
+    kv.size = 0;
+    kv.used = 0;
+    kv.n    = 0;
+
+    lctx.buf_compute_meta.clear();
+    lctx.graph_cache.clear();
+    for (auto & e : lctx.graph_cache.entries) {
+        e.buf_meta.clear();
+    }
+    lctx.win_perf.clear();
+    lctx.win_released.clear();
+    lctx.perf_mark = {};
+}
+
+static bool llama_kv_layer_save(const llama_context & lctx, uint32_t il, const llama_kv_replica::layer * replica, std::vector<uint8_t> & out);
+static bool llama_kv_layer_load(llama_context & lctx, uint32_t il, llama_kv_replica::layer * replica, const void * data, size_t size);
+static int  llama_kv_handoff   (llama_context & lctx);
+static void llama_tp_reset     (llama_context & lctx);
+
+// which layers change hands on the new split and which rank sends their kv cells. with failed_rank >= 0 the
+// ranks after it move down by one, and its layers come from the replica held by its successor
+static void llama_kv_handoff_plan(
+             llama_context & lctx,
+            const uint32_t * n_layer_window,
+            const uint32_t * n_layer_extra,
+                  uint32_t   n_world,
+                   int32_t   failed_rank) {
+    const auto & cparams = lctx.cparams;
+    const uint32_t n_layer = lctx.model.hparams.n_layer;
 
-        if (key == "sub_gf_out") {
-            int64_t * dims       = static_cast<int64_t *>(dims_msg.data());
-            size_t    buf_size   = dims[0] * dims[1] * sizeof(float);
-            float   * batch_embd = is_out_embd ? ubatch->out_embd : ubatch->backend_embd;
-            std::memcpy(batch_embd, data_msg.data(), buf_size);
-        } else if (key == "inp_pos") {
-            int64_t * dims  = static_cast<int64_t *>(dims_msg.data());
-            size_t buf_size = dims[0] * sizeof(int32_t);
-            std::memcpy(ubatch->pos, data_msg.data(), buf_size);
+    auto & handoff = lctx.kv_handoff;
+    handoff.src.assign(n_layer, -1);
+    handoff.dst.assign(n_layer, -1);
+    handoff.from_replica.assign(n_layer, false);
+    handoff.saved.clear();
+    handoff.lost = false;
+
+    for (uint32_t il = 0; il < n_layer; ++il) {
+        uint32_t owner, owner_new, cycle, offset;
+        locate_layer(il, cparams.n_world, cparams.n_layer_window, cparams.n_layer_extra, &owner, &cycle, &offset);
+        locate_layer(il, n_world, n_layer_window, n_layer_extra, &owner_new, &cycle, &offset);
+
+        int32_t src = owner;
+        if (failed_rank >= 0) {
+            if ((int32_t) owner == failed_rank) {
+                src = (owner + 1) % cparams.n_world == 0 ? 0 : failed_rank;
+                handoff.from_replica[il] = true;
+            } else {
+                src = owner - (owner > (uint32_t) failed_rank ? 1 : 0);
+            }
         }
+        handoff.dst[il] = owner_new;
+        handoff.src[il] = handoff.from_replica[il] || src != (int32_t) owner_new ? src : -1;
     }
 }
 
-static bool is_tensor_loaded(struct ggml_tensor * tensor) {
-    void * addr = (void *)tensor->data;
-    size_t size = ggml_nbytes(tensor);
+// apply a new layer split on this rank. a rank that keeps the same layers at the same local slots keeps
+// its context, the others reload their weights and rebuild the context around them. the kv cells of the
+// layers a rank keeps survive the rebuild, those of the layers it gives away wait for llama_kv_handoff.
+// my_rank and n_world differ from the current ones only when the ring is renumbered, after failed_rank
+// was removed or a device was added
+static int llama_reshard_local(
+             llama_context & lctx,
+            const uint32_t * n_layer_window,
+            const uint32_t * n_layer_extra,
+            const uint32_t * n_gpu_layers,
+                  uint32_t   my_rank,
+                  uint32_t   n_world,
+                   int32_t   failed_rank = -1) {
+    llama_model & model   = const_cast<llama_model &>(lctx.model);
+    auto        & cparams = lctx.cparams;
 
-    #ifdef _WIN32
-        MEMORY_BASIC_INFORMATION mbi;
-        size_t bytes_checked = 0;
-        while (bytes_checked < size) {
-            if (VirtualQuery((char *)addr + bytes_checked, &mbi, sizeof(mbi)) == 0) {
-                LLAMA_LOG_ERROR("VirtualQuery failed\n");
-                return false;
-            }
-            if (mbi.State != MEM_COMMIT) {
-                return false;  // memory not loaded
-            }
-            bytes_checked += mbi.RegionSize;
-        }
-        return true;
-    #else
-        size_t first     = (size_t)addr;
-        size_t last      = first + size;
-        long   page_size = sysconf(_SC_PAGESIZE);
+    const uint32_t n_layer = model.hparams.n_layer;
+    const uint32_t window  = n_layer_window[my_rank];
+    const uint32_t extra   = n_layer_extra[my_rank];
 
-        // align addr
-        llama_mmap::align_range(&first, &last, page_size);
-        size_t len = std::max(last - first, static_cast<size_t>(page_size));
-        size_t page_count = len / page_size;
+    // all the layers of this rank, over all of its windows
+    const uint32_t n_layer_mine = window * llama_n_cycles(n_layer, n_world, n_layer_window, n_layer_extra) + extra;
+    const int n_gpu_layers_new = n_gpu_layers != nullptr
+        ? (int) std::min(n_gpu_layers[my_rank], n_layer_mine)
+        : std::min(model.n_gpu_layers, (int) n_layer_mine);
 
-        #ifdef __APPLE__
-            char * mincore_res = new char[page_count];
-        #else
-            unsigned char * mincore_res = new unsigned char[page_count]; // use 'unsigned char' for Linux
-        #endif
+    bool affected = n_gpu_layers_new != model.n_gpu_layers;
+    if (llama_n_cycles(n_layer, n_world, n_layer_window, n_layer_extra) != llama_n_cycles(n_layer, cparams.n_world, cparams.n_layer_window, cparams.n_layer_extra)) {
+        affected = true; // the number of cycles changes the subgraphs and their schedulers
+    }
+    for (uint32_t il = 0; il < n_layer && !affected; ++il) {
+        affected = map_layer_to_local_id (il, n_world, my_rank, n_layer_window, n_layer_extra) != map_layer_to_local_id (il, cparams.n_world, cparams.rank, cparams.n_layer_window, cparams.n_layer_extra) ||
+                   map_layer_to_window_id(il, n_world, my_rank, n_layer_window, n_layer_extra) != map_layer_to_window_id(il, cparams.n_world, cparams.rank, cparams.n_layer_window, cparams.n_layer_extra);
+    }
 
-        // call mincore to check if pages are resident in memory
-        if (mincore((void *)first, len, mincore_res) == 0) {
-            for (size_t i = 0; i < page_count; ++i) {
-                if (!(mincore_res[i] & 1)) {
-                    delete[] mincore_res;
-                    return false; // page not loaded
-                }
-            }
-            delete[] mincore_res;
-            return true; // page loaded
-        } else {
-            LLAMA_LOG_ERROR("mincore failed\n");
-            delete[] mincore_res;
-            return false;
-        }
-    #endif
-}
+    if (affected && (!model.lora_adapters.empty() || !lctx.cvec.tensors.empty())) {
+        LLAMA_LOG_ERROR("%s: cannot move layers with LoRA adapters or control vectors applied\n", __func__);
+        return -1;
+    }
 
-static float is_graph_loaded(struct ggml_cgraph * cgraph) {
-    uint32_t n_loaded = 0;
-    uint32_t n_total  = 0;
-    for (int i = 0; i < ggml_graph_n_leafs(cgraph); i++) {
-        struct ggml_tensor * cur = ggml_graph_leaf(cgraph, i); 
-        if (strstr(cur->name, "weight") == nullptr || cur->data == nullptr) {
-            continue;
-        }
-        const char * backend_name = ggml_backend_buffer_name(cur->buffer);
-        if (backend_name) {
-            std::string lower_name(backend_name);
-            std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(), 
-                           [](unsigned char c) { return std::tolower(c); });
-            if (lower_name.find("cuda") != std::string::npos) continue;
+    // the activations in flight belong to the old split
+    if (lctx.comm.is_async()) {
+        lctx.comm.flush();
+    }
+
+    // the FFN split was chosen for the old windows and their neighbours
+    llama_tp_reset(lctx);
+
+    llama_kv_handoff_plan(lctx, n_layer_window, n_layer_extra, n_world, failed_rank);
+
+    // the kv cache goes with the context, keep the cells of all our layers until they are in their new place
+    auto & kv_self = lctx.kv_self;
+    std::vector<llama_kv_cell> kv_cells;
+    const uint32_t kv_head = kv_self.head;
+    const uint32_t kv_used = kv_self.used;
+    if (affected) {
+        for (uint32_t il = 0; il < n_layer; ++il) {
+            if (this_layer_is_mine(il, cparams.n_world, cparams.rank, cparams.n_layer_window, cparams.n_layer_extra) &&
+                !llama_kv_layer_save(lctx, il, nullptr, lctx.kv_handoff.saved[il])) {
+                lctx.kv_handoff.saved.erase(il);
+                lctx.kv_handoff.lost = true;
+            }
         }
-        if (is_tensor_loaded(cur)) n_loaded++;
-        n_total++;
+        kv_cells = kv_self.cells;
     }
-    return float(n_loaded) / float(n_total) * 100.0f;
-}
 
-static void manage_graph_tensors(struct ggml_cgraph * cgraph, int advice, bool force) {
-    long page_size = sysconf(_SC_PAGESIZE);
+    cparams.rank                 = my_rank;
+    cparams.n_world              = n_world;
+    lctx.setup_params.rank       = my_rank;
+    lctx.setup_params.n_world    = n_world;
+    model.load_params.rank       = my_rank;
+    model.load_params.n_world    = n_world;
 
-    struct Segment {
-        size_t start;
-        size_t end;
-    };
-    std::vector<Segment> segments;
+    std::copy(n_layer_window, n_layer_window + 32, cparams.n_layer_window);
+    std::copy(n_layer_window, n_layer_window + 32, lctx.setup_params.n_layer_window);
+    std::copy(n_layer_window, n_layer_window + 32, model.load_params.n_layer_window);
+    std::copy(n_layer_extra,  n_layer_extra  + 32, cparams.n_layer_extra);
+    std::copy(n_layer_extra,  n_layer_extra  + 32, lctx.setup_params.n_layer_extra);
+    std::copy(n_layer_extra,  n_layer_extra  + 32, model.load_params.n_layer_extra);
 
-    for (int i = 0; i < ggml_graph_n_leafs(cgraph); i++) {
-        struct ggml_tensor * cur = ggml_graph_leaf(cgraph, i);
+    if (!affected) {
+        lctx.graph_cache.clear();
+        LLAMA_LOG_INFO("%s: rank %u keeps its layers\n", __func__, my_rank);
+        return 0;
+    }
 
-        if (strstr(cur->name, "weight") == nullptr || cur->data == nullptr) {
-            continue;
-        }
+    const int64_t t_start_us = ggml_time_us();
 
-        const char * backend_name = ggml_backend_buffer_name(cur->buffer);
-        if (backend_name) {
-            std::string lower_name(backend_name);
-            std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(), 
-                           [](unsigned char c) { return std::tolower(c); });
-            if (lower_name.find("cuda") != std::string::npos) continue;
-        }
-
-        size_t size  = ggml_nbytes(cur);
-        size_t first = reinterpret_cast<size_t>(cur->data);
-        size_t last  = first + size;
-        
-        first = first - (first % page_size);
-        if (last % page_size != 0) {
-            last = last + (page_size - (last % page_size));
-        }
-        segments.push_back({first, last});
-    }
+    llama_context_free_backend(lctx);
+    llama_model_unload_tensors(model);
 
-    if (segments.empty()) return;
-
-    std::sort(segments.begin(), segments.end(), [](const Segment & a, const Segment & b) { 
-        return a.start < b.start; 
-    });
+    llama_model_params mparams = model.load_params;
+    mparams.n_gpu_layers       = n_gpu_layers_new;
+    mparams.progress_callback  = nullptr;
 
-    std::vector<Segment> merged_segments;
-    merged_segments.push_back(segments[0]);
-    for (size_t i = 1; i < segments.size(); i++) {
-        Segment & last = merged_segments.back();
-        if (segments[i].start <= last.end) {
-            last.end = std::max(last.end, segments[i].end);
-        } else {
-            merged_segments.push_back(segments[i]);
-        }
+    // the metadata was parsed at startup already, only the tensor index is needed again
+    std::unique_ptr<llama_model_loader> ml;
+    try {
+        ml.reset(new llama_model_loader(model.path, mparams.use_mmap, mparams.check_tensors, nullptr));
+    } catch (const std::exception & err) {
+        LLAMA_LOG_ERROR("%s: failed to reopen the model: %s\n", __func__, err.what());
+        return -1;
     }
-
-    for (const auto & segment : merged_segments) {
-        size_t prefetch_dense = 4;
-        size_t len = std::max(segment.end - segment.start, static_cast<size_t>(page_size));
-        posix_madvise(reinterpret_cast<void *>(segment.start), len, advice); // hint to load into memory
-        // force to prefetch data, disabled by default
-        if (advice == POSIX_MADV_WILLNEED && force) {
-            volatile char * ptr = reinterpret_cast<volatile char *>(segment.start);
-            for (size_t off = 0; off < len; off += prefetch_dense * page_size) {
-                for (size_t i = 0; i < prefetch_dense; i++) {
-                    if (off + i * page_size < len) (void)ptr[off + i * page_size];
-                }
-            }
-        }
+    if (llm_load_tensors(ml.get(), &model, mparams) < 0) {
+        LLAMA_LOG_ERROR("%s: failed to load the new layer window\n", __func__);
+        return -1;
     }
-}
-
-// decode a batch of tokens by evaluating the transformer
-//
-//   - lctx:      llama context
-//   - batch:     batch to evaluate
-//
-// return 0 on success
-// return positive int on warning
-// return negative int on error
-//
-static int llama_decode_internal(
-         llama_context & lctx,
-           llama_batch   batch_all,
-                  bool   server_mode) {
-    const auto   & model   = lctx.model;
-    const auto   & hparams = model.hparams;
-    const auto   & cparams = lctx.cparams;
-    const uint32_t n_world = cparams.n_world;
-    const uint32_t my_rank = cparams.rank;
 
-    const uint32_t n_worker    = cparams.n_worker;
-    const uint32_t worker_rank = cparams.worker_rank;
+    llama_context_params params = lctx.setup_params;
+    params.n_gpu_layers         = n_gpu_layers_new;
 
-    lctx.is_encoding = false;
-    const uint32_t n_tokens_all = batch_all.n_tokens;
-    if (my_rank != 0) {
-        batch_all.token = nullptr;
+    // on failure the context is freed, there is nothing left to continue with
+    if (llama_context_setup_backend(&model, params, &lctx) == nullptr) {
+        GGML_ABORT("%s: failed to rebuild the context of rank %u", __func__, my_rank);
     }
 
-    GGML_ASSERT(!(my_rank == 0 && n_tokens_all == 0) && "n_tokens == 0 on master node");
-
-    if (batch_all.token) {
-        for (uint32_t i = 0; i < n_tokens_all; ++i) {
-            if (batch_all.token[i] < 0 || (uint32_t)batch_all.token[i] >= model.vocab.n_vocab) {
-                LLAMA_LOG_ERROR("%s: invalid token[%d] = %d\n", __func__, i, batch_all.token[i]);
-                return -1;
+    if (kv_self.size == kv_cells.size()) {
+        kv_self.cells = std::move(kv_cells);
+        kv_self.head  = kv_head;
+        kv_self.used  = kv_used;
+        llama_kv_cache_pages_reset(kv_self);
+    }
+    for (auto it = lctx.kv_handoff.saved.begin(); it != lctx.kv_handoff.saved.end(); ) {
+        if (lctx.kv_handoff.src[it->first] < 0) {
+            if (!llama_kv_layer_load(lctx, it->first, nullptr, it->second.data(), it->second.size())) {
+                lctx.kv_handoff.lost = true;
             }
+            it = lctx.kv_handoff.saved.erase(it);
+        } else {
+            ++it;
         }
     }
 
-    GGML_ASSERT(n_tokens_all <= cparams.n_batch);
+    LLAMA_LOG_INFO("%s: rank %u now holds %u layers per window, %u more in the first %u cycles (%d on GPU), reloaded in %.2f s\n",
+        __func__, my_rank, window, extra > 0 ? 1 : 0, extra, n_gpu_layers_new, 1e-6 * (ggml_time_us() - t_start_us));
+    return 0;
+}
 
-    GGML_ASSERT((cparams.causal_attn || cparams.n_ubatch >= n_tokens_all) && "non-causal attention requires n_ubatch >= n_tokens");
+// header of an activation frame, the payload that follows is encoded with `type`
+struct comm_tensor_header {
+    int32_t  type;  // ggml_type of the payload
+    int32_t  flags; // COMM_FLAG_*
+    uint32_t epoch; // ring epoch of the sender, see llama_comm::epoch
+    uint32_t reserved;
+    int64_t  ne[2]; // [n_embd, n_tokens]
+};
 
-    if (lctx.t_compute_start_us == 0) {
-        lctx.t_compute_start_us = ggml_time_us();
+// the frame carries output of the last layer and is addressed to the master
+#define COMM_FLAG_TO_MASTER 1
+
+static bool comm_type_supported(ggml_type type) {
+    return type == GGML_TYPE_F32 || type == GGML_TYPE_F16 || type == GGML_TYPE_BF16 || type == GGML_TYPE_Q8_0;
+}
+
+size_t llama_comm_encode(ggml_type type, const float * src, int64_t n, uint8_t * dst) {
+    switch (type) {
+        case GGML_TYPE_F32:
+            std::memcpy(dst, src, n * sizeof(float));
+            break;
+        case GGML_TYPE_F16:
+            ggml_fp32_to_fp16_row(src, (ggml_fp16_t *) dst, n);
+            break;
+        case GGML_TYPE_BF16:
+            ggml_fp32_to_bf16_row(src, (ggml_bf16_t *) dst, n);
+            break;
+        case GGML_TYPE_Q8_0:
+            ggml_internal_get_type_traits(GGML_TYPE_Q8_0).from_float(src, dst, n);
+            break;
+        default:
+            GGML_ABORT("unsupported comm type %s", ggml_type_name(type));
     }
-    lctx.n_queued_tokens += n_tokens_all;
+    return ggml_row_size(type, n);
+}
 
-    auto & kv_self = lctx.kv_self;
+void llama_comm_decode(ggml_type type, const void * src, int64_t n, float * dst) {
+    switch (type) {
+        case GGML_TYPE_F32:
+            std::memcpy(dst, src, n * sizeof(float));
+            break;
+        case GGML_TYPE_F16:
+            ggml_fp16_to_fp32_row((const ggml_fp16_t *) src, dst, n);
+            break;
+        case GGML_TYPE_BF16:
+            ggml_bf16_to_fp32_row((const ggml_bf16_t *) src, dst, n);
+            break;
+        case GGML_TYPE_Q8_0:
+            ggml_internal_get_type_traits(GGML_TYPE_Q8_0).to_float(src, dst, n);
+            break;
+        default:
+            GGML_ABORT("unsupported comm type %d", (int) type);
+    }
+}
+
+// send activations [ne0, ne1] and the positions of their tokens, n_pos = 0 to omit the positions.
+// kv_delta holds the kv cells written by the pass for the replica of the receiver, if any
+static void llama_send_tensors(
+                zmq::socket_t & socket,
+                  const float * embd,
+                const int64_t * ne,
+              const llama_pos * pos,
+                      int64_t   n_pos,
+                    ggml_type   comm_type,
+        std::vector<uint8_t> & comm_buf,
+                         bool   to_master,
+                     uint32_t   epoch,
+  const std::vector<uint8_t> * kv_delta = nullptr) {
+    try {
+        std::vector<zmq::message_t> send_msgs;
+        size_t buf_size = 0;
 
-    const int64_t n_embd  = hparams.n_embd;
-    const int64_t n_vocab = hparams.n_vocab;
+        const int64_t ne0 = ne[0];
+        const int64_t ne1 = ne[1];
 
-    uint32_t n_outputs = 0;
-    uint32_t n_outputs_prev = 0;
+        // block-quantized payloads need whole blocks per row, otherwise fall back to f32
+        if (ne0 % ggml_blck_size(comm_type) != 0) {
+            comm_type = GGML_TYPE_F32;
+        }
 
-    const auto n_ubatch = cparams.n_ubatch;
+        comm_tensor_header header = {(int32_t) comm_type, to_master ? COMM_FLAG_TO_MASTER : 0, epoch, 0, {ne0, ne1}};
+        send_msgs.emplace_back("sub_gf_out", strlen("sub_gf_out"));
+        send_msgs.emplace_back(&header, sizeof(header));
 
-    // this indicates we are doing pooled embedding, so we ignore batch.logits and output all tokens
-    const bool embd_pooled = cparams.embeddings && cparams.pooling_type != LLAMA_POOLING_TYPE_NONE;
+        if (comm_type == GGML_TYPE_F32) {
+            buf_size = ne0 * ne1 * sizeof(float);
+            send_msgs.emplace_back(embd, buf_size);
+        } else {
+            comm_buf.resize(ggml_row_size(comm_type, ne0) * ne1);
+            buf_size = llama_comm_encode(comm_type, embd, ne0 * ne1, comm_buf.data());
+            send_msgs.emplace_back(comm_buf.data(), buf_size);
+        }
 
-    lctx.embd_seq.clear();
+        if (n_pos > 0) {
+            send_msgs.emplace_back("inp_pos", strlen("inp_pos"));
+            send_msgs.emplace_back(&n_pos, sizeof(n_pos));
+            buf_size = n_pos * sizeof(int32_t);
+            send_msgs.emplace_back(pos, buf_size);
+        }
 
-    // count outputs
-    if (batch_all.logits && !embd_pooled) {
-        for (uint32_t i = 0; i < n_tokens_all; ++i) {
-            n_outputs += batch_all.logits[i] != 0;
+        if (kv_delta != nullptr && !kv_delta->empty()) {
+            const int64_t n_bytes = kv_delta->size();
+            send_msgs.emplace_back("kv_delta", strlen("kv_delta"));
+            send_msgs.emplace_back(&n_bytes, sizeof(n_bytes));
+            send_msgs.emplace_back(kv_delta->data(), kv_delta->size());
         }
-    } else if (lctx.logits_all || embd_pooled) {
-        n_outputs = n_tokens_all;
-    } else {
-        // keep last output only
-        n_outputs = 1;
+
+        zmq::send_multipart(socket, send_msgs);
+    } catch (const zmq::error_t& e) {
+        LLAMA_LOG_INFO("Failed to send tensor data: %s\n", e.what());
     }
+}
 
-    sync_meta meta;
-    meta.n_ctx = cparams.n_ctx;
-    bool is_last_dev = (worker_rank == n_worker - 1);
+// send activations received from another device as they are
+static void llama_relay_tensors(zmq::socket_t & socket, std::vector<zmq::message_t> & msgs) {
+    try {
+        zmq::send_multipart(socket, msgs);
+    } catch (const zmq::error_t& e) {
+        LLAMA_LOG_INFO("Failed to relay tensor data: %s\n", e.what());
+    }
+}
 
-    if (my_rank != 0) {
-        if (llama_recv_meta(*lctx.recv_socket, &meta) == -1) {
-            return -1;
+static const comm_tensor_header * comm_header(const std::vector<zmq::message_t> & msgs) {
+    if (msgs.size() < 2 || msgs[0].to_string() != "sub_gf_out" || msgs[1].size() != sizeof(comm_tensor_header)) {
+        return nullptr;
+    }
+    return static_cast<const comm_tensor_header *>(msgs[1].data());
+}
+
+static bool comm_is_to_master(const std::vector<zmq::message_t> & msgs) {
+    const comm_tensor_header * header = comm_header(msgs);
+    return header != nullptr && (header->flags & COMM_FLAG_TO_MASTER) != 0;
+}
+
+// receive activations into embd and the positions of their tokens into pos, return the number of positions.
+// with fault tolerance, return -1 if the pass has to be aborted: on the master because a rank stopped
+// responding, on the other devices because the master sent a new ring, which is kept in ring->recover_frame.
+// kv cells sent along are queued on replica, see llama_kv_replica_apply. outputs for the master that reach
+// another device go on through relay
+static int64_t llama_recv_tensors(
+                                   zmq::socket_t & socket,
+                                           float * embd,
+                                       llama_pos * pos,
+        std::deque<std::vector<zmq::message_t>> & pending,
+                                      const bool   is_out_embd,
+                                        uint32_t   epoch,
+                                      llama_ring * ring,
+                                llama_kv_replica * replica,
+                                      llama_comm * relay) {
+    std::vector<zmq::message_t> recv_msgs;
+    if (is_out_embd && !pending.empty()) {
+        recv_msgs = std::move(pending.front());
+        pending.pop_front();
+    } else {
+        // wake up now and then, so that a comm being destroyed or a broken ring does not leave us waiting for good
+        if (relay != nullptr || ring != nullptr) {
+            socket.set(zmq::sockopt::rcvtimeo, relay != nullptr ? llama_comm::recv_poll_ms : (int) ring->heartbeat_ms());
         }
-
-        if (meta.n_tokens > 0) {
-            batch_all.n_tokens = meta.n_tokens;
-            if (meta.pos != nullptr) {
-                batch_all.pos = (llama_pos *) malloc(meta.n_tokens * sizeof(llama_pos));
-                std::memcpy(batch_all.pos, meta.pos, meta.n_tokens * sizeof(llama_pos));
-            }
-            if (meta.n_seq_id != nullptr) {
-                batch_all.n_seq_id = (int32_t *) malloc(meta.n_tokens * sizeof(int32_t));
-                std::memcpy(batch_all.n_seq_id, meta.n_seq_id, meta.n_tokens * sizeof(int32_t));
+        int64_t aborted = 0;
+        while (true) {
+            recv_msgs.clear();
+            if (!zmq::recv_multipart(socket, std::back_inserter(recv_msgs))) {
+                if (relay != nullptr && relay->stop) {
+                    aborted = -1;
+                    break;
+                }
+                if (ring != nullptr) {
+                    // nothing arrived within a heartbeat, keep waiting unless the ring is broken
+                    if (ring->failed_rank < 0) {
+                        continue;
+                    }
+                    aborted = -1;
+                    break;
+                }
+                if (relay != nullptr) {
+                    continue;
+                }
+                LLAMA_LOG_INFO("Failed to receive tensor data.\n");
+                return 0;
             }
-            if (meta.seq_id != nullptr) {
-                batch_all.seq_id = (llama_seq_id **) malloc(meta.n_tokens * sizeof(llama_seq_id *));
-                for (int32_t i = 0; i < meta.n_tokens; ++i) {
-                    batch_all.seq_id[i] = (llama_seq_id *) malloc(sizeof(llama_seq_id));
-                    batch_all.seq_id[i][0] = meta.seq_id[i][0];
+            if (ring != nullptr && recv_msgs.size() == 1) {
+                if (!meta_is_recover_frame(recv_msgs[0].data(), recv_msgs[0].size())) {
+                    LLAMA_LOG_WARN("%s: dropped a control message of %zu bytes in the middle of a pass\n", __func__, recv_msgs[0].size());
+                    continue;
                 }
+                ring->recover_frame.assign((const uint8_t *) recv_msgs[0].data(), (const uint8_t *) recv_msgs[0].data() + recv_msgs[0].size());
+                aborted = -1;
+                break;
             }
-            if (meta.logits != nullptr) {
-                batch_all.logits = (int8_t *) malloc(meta.n_tokens * sizeof(int8_t));
-                std::memcpy(batch_all.logits, meta.logits, meta.n_tokens * sizeof(int8_t));
+            const comm_tensor_header * header = comm_header(recv_msgs);
+            if (header != nullptr && header->epoch != epoch) {
+                LLAMA_LOG_DEBUG("%s: dropped activations of ring epoch %u\n", __func__, header->epoch);
+                continue;
             }
-            batch_all.all_pos_0 = meta.all_pos_0;
-            batch_all.all_pos_1 = meta.all_pos_1;
+            if (relay != nullptr && relay->relay != nullptr && comm_is_to_master(recv_msgs)) {
+                relay->pass_on(std::move(recv_msgs));
+                continue;
+            }
+            // with micro-batching, the device holding the last layer may finish a micro-batch
+            // before the master has drained the previous cycle, keep it for the output subgraph
+            if (is_out_embd || !comm_is_to_master(recv_msgs)) {
+                break;
+            }
+            pending.push_back(std::move(recv_msgs));
+        }
+        if (relay != nullptr || ring != nullptr) {
+            socket.set(zmq::sockopt::rcvtimeo, -1);
         }
+        if (aborted < 0) {
+            return aborted;
+        }
+    }
 
-        if (kv_cache_op(meta.clear_kv_cache,
-                    [&]{ llama_kv_cache_clear       (&lctx); },
-                    [&]{ llama_send_kv_cache_clear  (&lctx); },
-                    is_last_dev)) {
-            LLAMA_LOG_DEBUG("%s: received signal kv_cache_clear\n", __func__);
-            return -1;
+    int64_t n_pos = 0;
+    for (size_t i = 0; i < recv_msgs.size(); i += 3) {
+        std::string key = recv_msgs[i].to_string();
+        zmq::message_t &dims_msg = recv_msgs[i + 1];
+        zmq::message_t &data_msg = recv_msgs[i + 2];
+
+        if (key == "sub_gf_out") {
+            GGML_ASSERT(dims_msg.size() == sizeof(comm_tensor_header));
+            const comm_tensor_header * header = static_cast<const comm_tensor_header *>(dims_msg.data());
+            const ggml_type type = (ggml_type) header->type;
+            GGML_ASSERT(comm_type_supported(type) && "unsupported activation wire type");
+
+            const int64_t n = header->ne[0] * header->ne[1];
+            GGML_ASSERT(data_msg.size() == ggml_row_size(type, header->ne[0]) * header->ne[1]);
+
+            llama_comm_decode(type, data_msg.data(), n, embd);
+        } else if (key == "inp_pos") {
+            int64_t * dims  = static_cast<int64_t *>(dims_msg.data());
+            size_t buf_size = dims[0] * sizeof(int32_t);
+            std::memcpy(pos, data_msg.data(), buf_size);
+            n_pos = dims[0];
+        } else if (key == "kv_delta" && replica != nullptr) {
+            std::lock_guard<std::mutex> lock(replica->mutex);
+            replica->deltas.push_back(std::move(data_msg));
         }
+    }
+    return n_pos;
+}
 
-        if (kv_cache_op(meta.kv_seq_rm,
-                    [&]{ llama_kv_cache_seq_rm      (&lctx, meta.rm_seq_id, meta.rm_p0, meta.rm_p1); },
-                    [&]{ llama_send_kv_cache_seq_rm (&lctx, meta.rm_seq_id, meta.rm_p0, meta.rm_p1); },
-                    is_last_dev)) {
-            LLAMA_LOG_DEBUG("%s: received signal kv_cache_seq_rm\n", __func__);
-            return -1;
+void llama_comm::send_loop() {
+    while (true) {
+        send_job job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cond.wait(lock, [&]{ return stop || !send_queue.empty(); });
+            if (send_queue.empty()) {
+                return;
+            }
+            job = std::move(send_queue.front());
+            send_queue.pop_front();
+            n_sending++;
         }
 
-        if (kv_cache_op(meta.kv_seq_add,
-                    [&]{ llama_kv_cache_seq_add     (&lctx, meta.add_seq_id, meta.add_p0, meta.add_p1, meta.add_delta); },
-                    [&]{ llama_send_kv_cache_seq_add(&lctx, meta.add_seq_id, meta.add_p0, meta.add_p1, meta.add_delta); },
-                    is_last_dev)) {
-            LLAMA_LOG_DEBUG("%s: received signal kv_cache_seq_add\n", __func__);
-            return -1;
+        const int64_t t_start_us = ggml_time_us();
+        try {
+            if (!job.frames.empty()) {
+                llama_relay_tensors(*job.socket, job.frames);
+            } else {
+                llama_send_tensors(*job.socket, job.embd, job.ne, job.pos.data(), job.pos.size(), comm_type, buf, job.to_master, epoch, &job.kv_delta);
+            }
+        } catch (const zmq::error_t & e) {
+            // the context was terminated under us, the activations are lost either way
+            LLAMA_LOG_INFO("%s: failed to send tensor data: %s\n", __func__, e.what());
         }
+        t_comm_us += ggml_time_us() - t_start_us;
+        t_send_us += ggml_time_us() - t_start_us;
 
-        if (kv_cache_op(meta.kv_seq_cp,
-                    [&]{ llama_kv_cache_seq_cp      (&lctx, meta.cp_src_seq_id, meta.cp_dst_seq_id, meta.cp_p0, meta.cp_p1); },
-                    [&]{ llama_send_kv_cache_seq_cp (&lctx, meta.cp_src_seq_id, meta.cp_dst_seq_id, meta.cp_p0, meta.cp_p1); },
-                    is_last_dev)) {
-            LLAMA_LOG_DEBUG("%s: received signal kv_cache_seq_cp\n", __func__);
-            return -1;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (job.embd != nullptr) {
+                bufs_free.push_back(job.embd);
+            }
+            n_sending--;
         }
+        cond.notify_all();
+    }
+}
 
-        if (kv_cache_op(meta.kv_seq_keep,
-                    [&]{ llama_kv_cache_seq_keep     (&lctx, meta.keep_seq_id); },
-                    [&]{ llama_send_kv_cache_seq_keep(&lctx, meta.keep_seq_id); },
-                    is_last_dev)) {
-            LLAMA_LOG_DEBUG("%s: received signal kv_cache_seq_keep\n", __func__);
-            return -1;
+void llama_comm::pass_on(std::vector<zmq::message_t> && msgs) {
+    if (is_async()) {
+        send_job job;
+        job.socket = *relay;
+        job.frames = std::move(msgs);
+        send(std::move(job));
+        return;
+    }
+    llama_relay_tensors(**relay, msgs);
+}
+
+void llama_comm::recv_loop() {
+    while (true) {
+        recv_job job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cond.wait(lock, [&]{ return stop || !recv_queue.empty(); });
+            if (recv_queue.empty()) {
+                return;
+            }
+            job = std::move(recv_queue.front());
+            recv_queue.pop_front();
         }
 
-        if (kv_cache_op(meta.kv_seq_div,
-                    [&]{ llama_kv_cache_seq_div     (&lctx, meta.div_seq_id, meta.div_p0, meta.div_p1, meta.div_factor); },
-                    [&]{ llama_send_kv_cache_seq_div(&lctx, meta.div_seq_id, meta.div_p0, meta.div_p1, meta.div_factor); },
-                    is_last_dev)) {
-            LLAMA_LOG_DEBUG("%s: received signal kv_cache_seq_div\n", __func__);
-            return -1;
+        const int64_t t_start_us = ggml_time_us();
+        try {
+            job.n_pos = llama_recv_tensors(*job.socket, job.embd, job.pos.data(), pending, job.is_out_embd, epoch, ring, replica, this);
+        } catch (const zmq::error_t & e) {
+            // the context was terminated under us, the pass is aborted like a broken ring
+            LLAMA_LOG_INFO("%s: failed to receive tensor data: %s\n", __func__, e.what());
+            job.n_pos = -1;
         }
-    }
+        t_comm_us += ggml_time_us() - t_start_us;
 
-    if (!is_last_dev) {
-        meta.n_tokens  = batch_all.n_tokens;
-        meta.pos       = batch_all.pos;
-        meta.n_seq_id  = batch_all.n_seq_id;
-        meta.seq_id    = batch_all.seq_id;
-        meta.logits    = batch_all.logits;
-        meta.all_pos_0 = batch_all.all_pos_0;
-        meta.all_pos_1 = batch_all.all_pos_1;
-        llama_send_meta(*lctx.send_socket, &meta, server_mode);
-    } 
-    
-    lctx.sbatch.from_batch(batch_all, n_embd,
-        /* simple_split */ !kv_self.recurrent,
-        /* logits_all   */ n_outputs == n_tokens_all);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            recv_done.push_back(std::move(job));
+        }
+        cond.notify_all();
+    }
+}
 
-    // reserve output buffer
-    if (my_rank == 0 && llama_output_reserve(lctx, n_outputs) < n_outputs) {
-        LLAMA_LOG_ERROR("%s: could not reserve space for batch with %u outputs\n", __func__, n_outputs);
-        return -2;
-    };
+static bool is_tensor_loaded(struct ggml_tensor * tensor) {
+    void * addr = (void *)tensor->data;
+    size_t size = ggml_nbytes(tensor);
 
-    while (lctx.sbatch.n_tokens > 0) { // handle multiple batches
-        llama_ubatch ubatch;
-        if (kv_self.recurrent) {
-            if (embd_pooled) {
-                // Pooled embeddings cannot be split across ubatches (yet)
-                ubatch = lctx.sbatch.split_seq(n_ubatch);
-            } else {
-                // recurrent model architectures are easier to implement
-                // with equal-length sequences
-                ubatch = lctx.sbatch.split_equal(n_ubatch);
+    #ifdef _WIN32
+        MEMORY_BASIC_INFORMATION mbi;
+        size_t bytes_checked = 0;
+        while (bytes_checked < size) {
+            if (VirtualQuery((char *)addr + bytes_checked, &mbi, sizeof(mbi)) == 0) {
+                LLAMA_LOG_ERROR("VirtualQuery failed\n");
+                return false;
             }
-        } else {
-            ubatch = lctx.sbatch.split_simple(n_ubatch);
+            if (mbi.State != MEM_COMMIT) {
+                return false;  // memory not loaded
+            }
+            bytes_checked += mbi.RegionSize;
         }
-        const uint32_t n_tokens = ubatch.n_tokens;
+        return true;
+    #else
+        size_t first     = (size_t)addr;
+        size_t last      = first + size;
+        long   page_size = sysconf(_SC_PAGESIZE);
 
-        // count the outputs in this u_batch
-        int32_t n_outputs_new = 0;
-        if (n_outputs == n_tokens_all) {
-            n_outputs_new = n_tokens;
-        } else {
-            GGML_ASSERT(ubatch.output);
-            for (uint32_t i = 0; i < n_tokens; i++) {
-                n_outputs_new += (int32_t) (ubatch.output[i] != 0);
+        // align addr
+        llama_mmap::align_range(&first, &last, page_size);
+        size_t len = std::max(last - first, static_cast<size_t>(page_size));
+        size_t page_count = len / page_size;
+
+        #ifdef __APPLE__
+            char * mincore_res = new char[page_count];
+        #else
+            unsigned char * mincore_res = new unsigned char[page_count]; // use 'unsigned char' for Linux
+        #endif
+
+        // call mincore to check if pages are resident in memory
+        if (mincore((void *)first, len, mincore_res) == 0) {
+            for (size_t i = 0; i < page_count; ++i) {
+                if (!(mincore_res[i] & 1)) {
+                    delete[] mincore_res;
+                    return false; // page not loaded
+                }
             }
+            delete[] mincore_res;
+            return true; // page loaded
+        } else {
+            LLAMA_LOG_ERROR("mincore failed\n");
+            delete[] mincore_res;
+            return false;
         }
-        // needs to happen before the graph is built
-        lctx.n_outputs = n_outputs_new;
+    #endif
+}
+
+static float is_graph_loaded(struct ggml_cgraph * cgraph) {
+    uint32_t n_loaded = 0;
+    uint32_t n_total  = 0;
+    for (int i = 0; i < ggml_graph_n_leafs(cgraph); i++) {
+        struct ggml_tensor * cur = ggml_graph_leaf(cgraph, i); 
+        if (strstr(cur->name, "weight") == nullptr || cur->data == nullptr) {
+            continue;
+        }
+        const char * backend_name = ggml_backend_buffer_name(cur->buffer);
+        if (backend_name) {
+            std::string lower_name(backend_name);
+            std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(), 
+                           [](unsigned char c) { return std::tolower(c); });
+            if (lower_name.find("cuda") != std::string::npos) continue;
+        }
+        if (is_tensor_loaded(cur)) n_loaded++;
+        n_total++;
+    }
+    return n_total > 0 ? float(n_loaded) / float(n_total) * 100.0f : 100.0f;
+}
 
-        int n_threads = n_tokens == 1 ? cparams.n_threads : cparams.n_threads_batch;
-        ggml_threadpool_t threadpool = n_tokens == 1 ? lctx.threadpool : lctx.threadpool_batch;
-        GGML_ASSERT(n_threads > 0);
+struct Segment {
+    size_t start;
+    size_t end;
+};
 
-        // non-causal masks do not use the KV cache
-        if (hparams.causal_attn) {
-            llama_kv_cache_update(&lctx);
+// page-aligned and merged address ranges of the weights used by a subgraph,
+// if model is given, only the weights of CPU buffers that live in its file mappings are kept
+static std::vector<Segment> graph_weight_segments(struct ggml_cgraph * cgraph, const llama_model * model = nullptr) {
+    long page_size = sysconf(_SC_PAGESIZE);
 
-            // if we have enough unused cells before the current head ->
-            //   better to start searching from the beginning of the cache, hoping to fill it
-            if (kv_self.head > kv_self.used + 2 * n_tokens) {
-                kv_self.head = 0;
-            }
+    std::vector<Segment> segments;
 
-            if (!llama_kv_cache_find_slot(kv_self, ubatch)) {
-                return 1;
-            }
+    for (int i = 0; i < ggml_graph_n_leafs(cgraph); i++) {
+        struct ggml_tensor * cur = ggml_graph_leaf(cgraph, i);
 
-            if (!kv_self.recurrent) {
-                // a heuristic, to avoid attending the full cache if it is not yet utilized
-                // after enough generations, the benefit from this heuristic disappears
-                // if we start defragmenting the cache, the benefit from this will be more important
-                const uint32_t pad = llama_kv_cache_get_padding(cparams);
-                kv_self.n = std::min(kv_self.size, std::max(pad, GGML_PAD(llama_kv_cache_cell_max(kv_self), pad)));
-            }
+        if (strstr(cur->name, "weight") == nullptr || cur->data == nullptr) {
+            continue;
         }
 
-        for (size_t i = 0; i < lctx.sched.size(); i++) {
-            ggml_backend_sched_reset(lctx.sched[i]);
-            ggml_backend_sched_set_eval_callback(lctx.sched[i], lctx.cparams.cb_eval, lctx.cparams.cb_eval_user_data);
+        const char * backend_name = ggml_backend_buffer_name(cur->buffer);
+        if (backend_name) {
+            std::string lower_name(backend_name);
+            std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(), 
+                           [](unsigned char c) { return std::tolower(c); });
+            if (lower_name.find("cuda") != std::string::npos) continue;
         }
 
-        std::vector<ggml_cgraph *> gf = llama_build_graph(lctx, ubatch, false);
+        if (model != nullptr) {
+            if (ggml_backend_buffer_get_type(cur->buffer) != ggml_backend_cpu_buffer_type()) continue;
 
-        // the output is always the last tensor in the graph
-        struct ggml_tensor * res        = nullptr;
-        struct ggml_tensor * embd       = nullptr;
-        struct ggml_tensor * sub_gf_out = nullptr;
-        const  int64_t       n_embd     = hparams.n_embd;
-        if (my_rank == 0) {
-            res  = ggml_graph_node(gf.back(), -1);
-            embd = ggml_graph_node(gf.back(), -2);
-        }
-        
-        if (lctx.n_outputs == 0) {
-            // no output
-            res  = nullptr;
-            embd = nullptr;
-        } else if (cparams.embeddings) {
-            res  = nullptr; // do not extract logits for embedding case
-            embd = nullptr;
-            for (int i = ggml_graph_n_nodes(gf.back()) - 1; i >= 0; --i) {
-                if (strcmp(ggml_graph_node(gf.back(), i)->name, "result_embd_pooled") == 0) {
-                    embd = ggml_graph_node(gf.back(), i);
+            const uint8_t * data   = (const uint8_t *) cur->data;
+            bool            in_map = false;
+            for (const auto & mapping : model->mappings) {
+                const uint8_t * addr = (const uint8_t *) mapping->addr;
+                if (data >= addr && data + ggml_nbytes(cur) <= addr + mapping->size) {
+                    in_map = true;
                     break;
                 }
             }
-            GGML_ASSERT(embd != nullptr && "missing embeddings tensor");
-        } else {
-            embd = nullptr; // do not extract embeddings when not needed
-        }
-        
-        GGML_ASSERT(lctx.sched.size() == gf.size());
-        for (size_t i = 0; i < (size_t)lctx.sched.size(); ++i) {
-            ggml_backend_sched_alloc_graph(lctx.sched[i], gf[i]);
+            if (!in_map) continue;
         }
 
-        ggml_cgraph  * sub_gf    = nullptr;
-        const uint32_t n_layer   = hparams.n_layer;
-        const char   * layer_str = nullptr;
-        int            cur_l     = -1;
-        bool           is_output = false;
-        bool           is_last_l = false;
-        GGML_ASSERT(my_rank == 0 || n_world > 1);
+        size_t size  = ggml_nbytes(cur);
+        size_t first = reinterpret_cast<size_t>(cur->data);
+        size_t last  = first + size;
         
-        for (size_t i = 0; i < (size_t)gf.size(); ++i) {
-            const bool is_out_embd = my_rank == 0 && i == (size_t)gf.size() - 1;
-            sub_gf = gf[i];
+        first = first - (first % page_size);
+        if (last % page_size != 0) {
+            last = last + (page_size - (last % page_size));
+        }
+        segments.push_back({first, last});
+    }
 
-            // receive data from other nodes
-            if (n_world > 1 && !(my_rank == 0 && i == 0) && !(my_rank == 0 && is_last_l)) {
-                llama_recv_tensors(*lctx.recv_socket, &ubatch, is_out_embd);
-            }
+    if (segments.empty()) return segments;
 
-            // ensure ggml_backend_tensor_get_async of the previous subgraph has finished
-            if (i > 0 && (n_world == 1 || (my_rank == 0 && is_last_l))) {
-                ggml_backend_sched_synchronize(lctx.sched[i - 1]);
-            }
+    std::sort(segments.begin(), segments.end(), [](const Segment & a, const Segment & b) { 
+        return a.start < b.start; 
+    });
 
-            ubatch.activate_input  = (my_rank == 0 && i == 0);
-            ubatch.activate_output = (my_rank == 0 && is_out_embd);
-            GGML_ASSERT(!(ubatch.activate_input && ubatch.activate_output));
-            
-            llama_set_inputs(lctx, ubatch);
+    std::vector<Segment> merged_segments;
+    merged_segments.push_back(segments[0]);
+    for (size_t i = 1; i < segments.size(); i++) {
+        Segment & last = merged_segments.back();
+        if (segments[i].start <= last.end) {
+            last.end = std::max(last.end, segments[i].end);
+        } else {
+            merged_segments.push_back(segments[i]);
+        }
+    }
 
-            {   // compute graph
-                timer(llama_graph_compute);
-                llama_graph_compute(lctx, sub_gf, lctx.sched[i], n_threads, threadpool); 
-            }
+    return merged_segments;
+}
 
-            sub_gf_out = ggml_graph_node(sub_gf, -1);
-            is_output  = strcmp(sub_gf_out->name, "result_output") == 0;
-            if (is_output) {
-                break;
-            }
+static size_t segments_size(const std::vector<Segment> & segments) {
+    size_t size = 0;
+    for (const auto & segment : segments) {
+        size += segment.end - segment.start;
+    }
+    return size;
+}
 
-            if (strcmp(sub_gf_out->name, "inp_embd") == 0) {
-                is_last_l = false;
-            } else {
-                layer_str = strchr(sub_gf_out->name, '-') + 1;
-                cur_l = std::atoi(layer_str);
-                is_last_l = (cur_l == static_cast<int>(n_layer) - 1);
-            }
+// bytes of the segments whose pages are in the page cache
+static size_t segments_resident_size(const std::vector<Segment> & segments) {
+    const long page_size = sysconf(_SC_PAGESIZE);
 
-            float * embd_buf;
-            if (n_world == 1 || (my_rank == 0 && is_last_l)) {
-                embd_buf = is_last_l ? ubatch.out_embd : ubatch.backend_embd;
-            } else {
-                embd_buf = ubatch.backend_embd;
-            }
-            GGML_ASSERT(embd_buf != nullptr);
+    size_t n_resident = 0;
+#ifdef __APPLE__
+    std::vector<char> vec;
+#else
+    std::vector<unsigned char> vec;
+#endif
+    for (const auto & segment : segments) {
+        const size_t len = segment.end - segment.start;
+        vec.resize(len / page_size);
+        if (mincore(reinterpret_cast<void *>(segment.start), len, vec.data()) != 0) {
+            continue;
+        }
+        for (auto v : vec) {
+            n_resident += v & 1;
+        }
+    }
+    return n_resident * page_size;
+}
 
-            // copy device data to cpu memory
-            size_t         buf_size = sub_gf_out->ne[0] * sub_gf_out->ne[1] * sizeof(float);
-            ggml_backend_t backend  = ggml_backend_sched_get_tensor_backend(lctx.sched[i], sub_gf_out);
-            GGML_ASSERT(buf_size <= ggml_nbytes(sub_gf_out));
-            GGML_ASSERT(backend  != nullptr);
-            ggml_backend_tensor_get_async(backend, sub_gf_out, embd_buf, 0, buf_size);
-            ggml_backend_sched_synchronize(lctx.sched[i]);
+static int64_t llama_major_faults() {
+#if defined(_POSIX_MEMLOCK_RANGE)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        return usage.ru_majflt;
+    }
+#endif
+    return 0;
+}
 
-            // send the result to the next node or the master
-            if (!(n_world == 1 || (my_rank == 0 && is_last_l))) {
-                struct input_tensors tensors = {sub_gf_out, lctx.inp_pos};
-                const bool is_to_master = my_rank != 0 && is_last_l;
-                zmq::socket_t * s = is_to_master ? lctx.master_socket : lctx.send_socket;
-                llama_send_tensors(*s, &ubatch, &tensors);
-            }
+static void manage_graph_tensors(struct ggml_cgraph * cgraph, int advice, bool force) {
+    long page_size = sysconf(_SC_PAGESIZE);
 
-            // overlap memory scheduling with other nodes' communication and computing
-            if (cparams.prefetch && n_world > 1) {
-                timer(manage_graph_tensors);
-                
-                int next_gf_id = (i + 1) % gf.size();
-                manage_graph_tensors(gf[next_gf_id], POSIX_MADV_WILLNEED, cparams.force);
-                if (my_rank == 0 && (is_last_l || (next_gf_id == (int)gf.size() - 1))) {
-                    manage_graph_tensors(gf[0], POSIX_MADV_WILLNEED, cparams.force);
+    for (const auto & segment : graph_weight_segments(cgraph)) {
+        size_t prefetch_dense = 4;
+        size_t len = std::max(segment.end - segment.start, static_cast<size_t>(page_size));
+        posix_madvise(reinterpret_cast<void *>(segment.start), len, advice); // hint to load into memory
+        // force to prefetch data, disabled by default
+        if (advice == POSIX_MADV_WILLNEED && force) {
+            volatile char * ptr = reinterpret_cast<volatile char *>(segment.start);
+            for (size_t off = 0; off < len; off += prefetch_dense * page_size) {
+                for (size_t i = 0; i < prefetch_dense; i++) {
+                    if (off + i * page_size < len) (void)ptr[off + i * page_size];
                 }
             }
         }
+    }
+}
 
-        // update the kv ring buffer
-        {
-            kv_self.head += n_tokens;
+// give up the mmap pages of window cur_id once it has been computed, if the next window would not fit in the
+// available memory otherwise. the computed window is the one needed furthest in the future, so it is the best
+// victim. MADV_DONTNEED only unmaps the pages from this process, the file pages stay in the page cache and are
+// merely easier for the kernel to reclaim. only MADV_PAGEOUT evicts them, which is what is counted as released
+static void llama_release_window(llama_context & lctx, struct ggml_cgraph * gf_cur, size_t cur_id, struct ggml_cgraph * gf_next) {
+    const auto policy = lctx.cparams.release_policy;
+    if (policy == LLAMA_RELEASE_POLICY_OFF || !lctx.model.mlock_mmaps.empty()) {
+        return; // locked pages cannot be released
+    }
 
-            // Ensure kv cache head points to a valid index.
-            if (kv_self.head >= kv_self.size) {
-                kv_self.head = 0;
-            }
-        }
+    const size_t nb_next  = segments_size(graph_weight_segments(gf_next));
+    const size_t nb_avail = device_physical_memory(true);
+    if (nb_avail >= nb_next) {
+        return;
+    }
 
-        // extract logits
-        if (res) {
-            ggml_backend_t backend_res = ggml_backend_sched_get_tensor_backend(lctx.sched.back(), res);
-            GGML_ASSERT(backend_res != nullptr);
-            GGML_ASSERT(lctx.logits != nullptr);
+    const std::vector<Segment> segments = graph_weight_segments(gf_cur, &lctx.model);
+    const size_t nb_resident = segments_resident_size(segments);
 
-            float * logits_out = lctx.logits + n_outputs_prev * n_vocab;
-            const int32_t n_outputs_new = lctx.n_outputs;
+    for (const auto & segment : segments) {
+        void * addr = reinterpret_cast<void *>(segment.start);
+        size_t len  = segment.end - segment.start;
+        int    ret  = -1;
 
-            if (n_outputs_new) {
-                GGML_ASSERT( n_outputs_prev + n_outputs_new <= n_outputs);
-                GGML_ASSERT((n_outputs_prev + n_outputs_new) * n_vocab <= (int64_t) lctx.logits_size);
-                ggml_backend_tensor_get_async(backend_res, res, logits_out, 0, n_outputs_new * n_vocab * sizeof(float));
-            }
+#if defined(MADV_PAGEOUT)
+        if (policy == LLAMA_RELEASE_POLICY_FORCE) {
+            ret = madvise(addr, len, MADV_PAGEOUT);
+        }
+#endif
+#if defined(MADV_DONTNEED)
+        if (ret != 0) {
+            ret = madvise(addr, len, MADV_DONTNEED);
         }
+#endif
+        GGML_UNUSED(ret);
+    }
 
-        // extract embeddings
-        if (embd) {
-            throw std::runtime_error("embd is currently not supported");
+    // what left the page cache, the rest will come back as minor faults
+    const size_t nb_released = nb_resident - std::min(nb_resident, segments_resident_size(segments));
 
-            ggml_backend_t backend_embd = ggml_backend_sched_get_tensor_backend(lctx.sched.back(), embd); // todo.
-            GGML_ASSERT(backend_embd != nullptr);
+    if (lctx.win_released.size() <= cur_id) {
+        lctx.win_released.resize(cur_id + 1, 0);
+    }
+    lctx.win_released[cur_id] = segments_size(segments);
+    lctx.n_bytes_released    += nb_released;
+}
 
-            switch (cparams.pooling_type) {
-                case LLAMA_POOLING_TYPE_NONE:
-                    {
-                        // extract token embeddings
-                        GGML_ASSERT(lctx.embd != nullptr);
-                        float * embd_out = lctx.embd + n_outputs_prev*n_embd;
-                        const int32_t n_outputs_new = lctx.n_outputs;
+// size of the micro-batches the master pipelines a batch in, 0 to process each ubatch as a whole
+static uint32_t llama_micro_batch_size(const llama_context & lctx, const llama_batch & batch) {
+    const auto & cparams = lctx.cparams;
 
-                        if (n_outputs_new) {
-                            GGML_ASSERT( n_outputs_prev + n_outputs_new <= n_outputs);
-                            GGML_ASSERT((n_outputs_prev + n_outputs_new)*n_embd <= (int64_t) lctx.embd_size);
-                            ggml_backend_tensor_get_async(backend_embd, embd, embd_out, 0, n_outputs_new*n_embd*sizeof(float));
-                        }
-                    } break;
-                case LLAMA_POOLING_TYPE_MEAN:
-                case LLAMA_POOLING_TYPE_CLS:
-                case LLAMA_POOLING_TYPE_LAST:
-                    {
-                        // extract sequence embeddings (cleared before processing each batch)
-                        auto & embd_seq_out = lctx.embd_seq;
+    if (cparams.n_micro_batch == 0 || cparams.n_world == 1 || batch.n_tokens <= (int32_t) cparams.n_micro_batch) {
+        return 0;
+    }
 
-                        for (uint32_t s = 0; s < ubatch.n_seqs; ++s) {
-                            const llama_seq_id seq_id = ubatch.seq_id[s][0];
-                            if (embd_seq_out.find(seq_id) != embd_seq_out.end()) {
-                                continue;
-                            }
-                            embd_seq_out[seq_id].resize(n_embd);
-                            ggml_backend_tensor_get_async(backend_embd, embd, embd_seq_out[seq_id].data(), (n_embd*seq_id)*sizeof(float), n_embd*sizeof(float));
-                        }
-                    } break;
-                case LLAMA_POOLING_TYPE_RANK:
-                    {
-                        // extract the rerank score - a single float per sequence
-                        auto & embd_seq_out = lctx.embd_seq;
+    if (lctx.kv_self.recurrent || !cparams.causal_attn || cparams.embeddings) {
+        return 0;
+    }
 
-                        for (uint32_t s = 0; s < ubatch.n_seqs; ++s) {
-                            const llama_seq_id seq_id = ubatch.seq_id[s][0];
-                            if (embd_seq_out.find(seq_id) != embd_seq_out.end()) {
-                                continue;
-                            }
-                            embd_seq_out[seq_id].resize(1);
-                            ggml_backend_tensor_get_async(backend_embd, embd, embd_seq_out[seq_id].data(), (seq_id)*sizeof(float), sizeof(float));
-                        }
-                    } break;
-                case LLAMA_POOLING_TYPE_UNSPECIFIED:
-                    {
-                        GGML_ABORT("unknown pooling type");
-                    }
-            }
+    // a micro-batch must not see the kv cells of later ones, which holds as long as
+    // positions keep increasing within each sequence
+    std::unordered_map<llama_seq_id, llama_pos> last_pos;
+    for (int32_t i = 0; i < batch.n_tokens; ++i) {
+        if (batch.n_seq_id && batch.n_seq_id[i] != 1) {
+            return 0;
         }
-        n_outputs_prev += lctx.n_outputs;
+
+        const llama_pos    pos    = batch.pos    ? batch.pos[i]       : batch.all_pos_0 + i*batch.all_pos_1;
+        const llama_seq_id seq_id = batch.seq_id ? batch.seq_id[i][0] : batch.all_seq_id;
+
+        auto it = last_pos.find(seq_id);
+        if (it != last_pos.end() && pos <= it->second) {
+            return 0;
+        }
+        last_pos[seq_id] = pos;
     }
 
-    if (my_rank == 0) {
-        // set output mappings
-        bool sorted_output = true;
-        GGML_ASSERT(lctx.sbatch.out_ids.size() == n_outputs);
+    return cparams.n_micro_batch;
+}
 
-        for (size_t i = 0; i < n_outputs; ++i) {
-            size_t out_id = lctx.sbatch.out_ids[i];
-            lctx.output_ids[out_id] = i;
-            if (out_id != i) {
-                sorted_output = false;
-            }
+// split a simple-split ubatch into consecutive micro-batches, they are views into the ubatch
+// and each owns a disjoint slice of its activation buffers
+static std::vector<llama_ubatch> llama_split_micro_batches(const llama_ubatch & ubatch, uint32_t n_micro_batch, int64_t n_embd) {
+    std::vector<llama_ubatch> mbatches;
+
+    if (n_micro_batch == 0 || ubatch.equal_seqs || ubatch.n_tokens <= n_micro_batch) {
+        mbatches.push_back(ubatch);
+        return mbatches;
+    }
+
+    for (uint32_t offset = 0; offset < ubatch.n_tokens; offset += n_micro_batch) {
+        llama_ubatch mb = ubatch;
+
+        mb.n_tokens     = std::min(n_micro_batch, ubatch.n_tokens - offset);
+        mb.n_seq_tokens = 1;
+        mb.n_seqs       = mb.n_tokens;
+        mb.token        = ubatch.token        ? ubatch.token        + offset        : nullptr;
+        mb.embd         = ubatch.embd         ? ubatch.embd         + offset*n_embd : nullptr;
+        mb.backend_embd = ubatch.backend_embd ? ubatch.backend_embd + offset*n_embd : nullptr;
+        mb.out_embd     = ubatch.out_embd     ? ubatch.out_embd     + offset*n_embd : nullptr;
+        mb.pos          = ubatch.pos          ? ubatch.pos          + offset        : nullptr;
+        mb.n_seq_id     = ubatch.n_seq_id     ? ubatch.n_seq_id     + offset        : nullptr;
+        mb.seq_id       = ubatch.seq_id       ? ubatch.seq_id       + offset        : nullptr;
+        mb.output       = ubatch.output       ? ubatch.output       + offset        : nullptr;
+
+        mbatches.push_back(mb);
+    }
+
+    return mbatches;
+}
+
+// the input tensors of the graphs, saved with a cache entry and restored when its graphs are reused
+static std::array<ggml_tensor **, 17> llama_graph_inputs(llama_context & lctx) {
+    return {{
+        &lctx.inp_tokens,  &lctx.inp_embd,    &lctx.backend_embd,    &lctx.out_embd,        &lctx.inp_pos,
+        &lctx.inp_out_ids, &lctx.inp_KQ_mask, &lctx.inp_KQ_mask_swa, &lctx.inp_K_shift,     &lctx.inp_mean,
+        &lctx.inp_cls,     &lctx.inp_s_copy,  &lctx.inp_s_mask,      &lctx.inp_s_seq,       &lctx.inp_pos_bucket,
+        &lctx.inp_embd_enc, &lctx.inp_KQ_mask_cross,
+    }};
+}
+
+// the entry with the graphs of this shape, -1 if there is none
+static int llama_graph_cache_match(const llama_context & lctx, const llama_ubatch & ubatch) {
+    const auto & cache = lctx.graph_cache;
+    const auto & runs  = lctx.kv_self.runs;
+    for (int ie = 0; ie < (int) cache.entries.size(); ++ie) {
+        const auto & e = cache.entries[ie];
+        if (!e.valid ||
+            e.n_tokens  != ubatch.n_tokens ||
+            e.n_kv      != lctx.kv_self.n ||
+            e.n_outputs != lctx.n_outputs ||
+            e.inp_embd  != (ubatch.embd != nullptr) ||
+            e.run_n.size() != runs.size()) {
+            continue;
+        }
+        // the runs may start at other cells, but their lengths shape the graph
+        bool same_runs = true;
+        for (size_t r = 0; r < runs.size(); ++r) {
+            same_runs = same_runs && e.run_n[r] == runs[r].n;
         }
+        if (same_runs) {
+            return ie;
+        }
+    }
+    return -1;
+}
 
-        if (sorted_output) {
-            lctx.sbatch.out_ids.clear();
+// the entry that a graph of a new shape is built in, the one not used last
+static int llama_graph_cache_slot(const llama_context & lctx) {
+    return lctx.graph_cache.last == 0 ? 1 : 0;
+}
+
+static void llama_graph_cache_store(llama_context & lctx, int ie, const llama_ubatch & ubatch, const std::vector<ggml_cgraph *> & gf) {
+    auto & cache = lctx.graph_cache;
+    auto & e     = cache.entries[ie];
+
+    e.valid     = true;
+    e.n_tokens  = ubatch.n_tokens;
+    e.n_kv      = lctx.kv_self.n;
+    e.n_outputs = lctx.n_outputs;
+    e.inp_embd  = ubatch.embd != nullptr;
+    e.gf        = gf;
+
+    e.run_n.clear();
+    for (const llama_kv_run & run : lctx.kv_self.runs) {
+        e.run_n.push_back(run.n);
+    }
+
+    e.inputs.clear();
+    for (ggml_tensor ** inp : llama_graph_inputs(lctx)) {
+        e.inputs.push_back(*inp);
+    }
+
+    // the stores of a layer follow the order of the runs, see llm_build_kv_store
+    std::map<std::string, uint32_t> n_stores;
+
+    e.kv_stores.clear();
+    e.kv_store_runs.clear();
+    for (auto * sub_gf : gf) {
+        for (int i = 0; i < ggml_graph_n_nodes(sub_gf); ++i) {
+            ggml_tensor * node = ggml_graph_node(sub_gf, i);
+            if (node->op != GGML_OP_CPY || node->src[1] == nullptr) {
+                continue;
+            }
+            const char * name = node->src[1]->name;
+            if (strncmp(name, "k_cache_view", 12) == 0 || strncmp(name, "v_cache_view", 12) == 0) {
+                const uint32_t run = n_stores[name]++;
+                e.kv_stores.push_back(node->src[1]);
+                e.kv_stores.push_back(node);
+                e.kv_store_runs.push_back(run);
+                e.kv_store_runs.push_back(run);
+            }
         }
+    }
 
-        // set to total number of outputs in the batch, for use in llama_get_logits_ith
-        lctx.n_outputs = n_outputs;
+    cache.cur  = ie;
+    cache.last = ie;
+}
+
+// switch to the graphs of an entry. if the schedulers were set up for other graphs, the tensors of these lose their
+// place in the compute buffers, which the other graphs reuse, and each scheduler takes them again before its subgraph runs
+static void llama_graph_cache_use(llama_context & lctx, int ie) {
+    auto & cache = lctx.graph_cache;
+    auto & e     = cache.entries[ie];
+
+    const auto inputs = llama_graph_inputs(lctx);
+    for (size_t k = 0; k < inputs.size(); ++k) {
+        *inputs[k] = e.inputs[k];
     }
+    cache.last = ie;
 
-    // wait for the computation to finish (automatically done when obtaining the model output)
-    // llama_synchronize(&lctx);
+    if (cache.cur == ie) {
+        return;
+    }
 
-    // decide if we need to defrag the kv cache
-    if (cparams.causal_attn && cparams.defrag_thold >= 0.0f) {
-        const float fragmentation = kv_self.n >= 128 ? 1.0f - float(kv_self.used)/float(kv_self.n) : 0.0f;
-        // queue defragmentation for next llama_kv_cache_update
-        if (fragmentation > cparams.defrag_thold) {
-            llama_kv_cache_defrag(kv_self);
+    auto release = [](ggml_tensor * t) {
+        if (t->buffer != nullptr && ggml_backend_buffer_get_usage(t->buffer) == GGML_BACKEND_BUFFER_USAGE_COMPUTE) {
+            t->buffer = nullptr;
+            t->data   = nullptr;
+        }
+    };
+    for (auto * sub_gf : e.gf) {
+        for (int i = 0; i < ggml_graph_n_leafs(sub_gf); ++i) {
+            release(ggml_graph_leaf(sub_gf, i));
+        }
+        for (int i = 0; i < ggml_graph_n_nodes(sub_gf); ++i) {
+            release(ggml_graph_node(sub_gf, i));
         }
     }
 
-    // Reset state for the next token before backend sync, to allow the CPU activities in the reset to
-    // overlap with device computation.
-    for (size_t i = 0; i < (size_t)lctx.sched.size(); ++i) {
-        ggml_backend_sched_reset(lctx.sched[i]);
+    lctx.sched_pending.assign(e.gf.size(), true);
+    cache.cur = ie;
+}
+
+// reset the scheduler of a subgraph of the cached graphs in use and place its tensors as the build did
+static void llama_graph_cache_reset_sched(llama_context & lctx, size_t i) {
+    const auto & e = lctx.graph_cache.entries[lctx.graph_cache.cur];
+
+    ggml_backend_sched_reset(lctx.sched[i]);
+    for (const auto & pin : e.pins) {
+        if (pin.sub_gf_id == (int) i) {
+            ggml_backend_sched_set_tensor_backend(lctx.sched[i], pin.tensor, pin.backend);
+        }
     }
+}
 
-    return 0;
+// the KV head, or the first cell of each run, is baked into the offsets of the KV store views, move them to the current one
+static void llama_graph_cache_set_kv_head(llama_context & lctx) {
+    const auto & kv_self = lctx.kv_self;
+    const auto & e       = lctx.graph_cache.entries[lctx.graph_cache.cur];
+
+    for (size_t k = 0; k < e.kv_stores.size(); ++k) {
+        ggml_tensor * t   = e.kv_stores[k];
+        ggml_tensor * src = t->view_src;
+        GGML_ASSERT(src != nullptr && src->data != nullptr);
+
+        const uint32_t cell = kv_self.runs.empty() ? kv_self.head : kv_self.runs[e.kv_store_runs[k]].cell;
+
+        // K, and V unless transposed, are stored a row per cell
+        const bool row_per_cell = t->name[0] == 'k' || !kv_self.v_trans;
+        const size_t offs = cell * (row_per_cell ? ggml_nbytes(src) / kv_self.size : ggml_element_size(src));
+
+        t->view_offs = offs;
+        t->data      = (char *) src->data + offs;
+        if (t->op == GGML_OP_VIEW) {
+            memcpy(t->op_params, &offs, sizeof(offs));
+        }
+    }
 }
 
-// encode a batch of tokens by evaluating the encoder part of the transformer
+static int  llama_ring_abort        (llama_context & lctx);
+static void llama_ring_recover_local(llama_context & lctx, const uint8_t * frame);
+static void llama_ring_join_local   (llama_context & lctx, const uint8_t * frame);
+static void llama_kv_handoff_local  (llama_context & lctx, const uint8_t * frame);
+static void llama_kv_replica_apply  (llama_context & lctx);
+static void llama_kv_replica_delta  (const llama_context & lctx, uint32_t il_last, const std::vector<std::pair<uint32_t, uint32_t>> & cell_ranges, std::vector<uint8_t> & out);
+static void llama_route_master      (llama_context & lctx);
+static void llama_tp_start          (llama_context & lctx);
+
+// decode a batch of tokens by evaluating the transformer
 //
 //   - lctx:      llama context
 //   - batch:     batch to evaluate
@@ -18712,602 +20708,1409 @@ static int llama_decode_internal(
 // return positive int on warning
 // return negative int on error
 //
-static int llama_encode_internal(
+static int llama_decode_internal(
          llama_context & lctx,
-           llama_batch   batch) {
-
-    lctx.is_encoding = true;
+           llama_batch   batch_all,
+                  bool   server_mode) {
+    const auto   & model   = lctx.model;
+    const auto   & hparams = model.hparams;
+    const auto   & cparams = lctx.cparams;
+    const uint32_t n_world = cparams.n_world;
+    const uint32_t my_rank = cparams.rank;
 
-    const uint32_t n_tokens = batch.n_tokens;
+    const uint32_t n_worker    = cparams.n_worker;
+    const uint32_t worker_rank = cparams.worker_rank;
 
-    if (n_tokens == 0) {
-        LLAMA_LOG_ERROR("%s: n_tokens == 0\n", __func__);
-        return -1;
+    lctx.is_encoding = false;
+    const uint32_t n_tokens_all = batch_all.n_tokens;
+    if (my_rank != 0) {
+        batch_all.token = nullptr;
     }
 
-    const auto & model   = lctx.model;
-    const auto & hparams = model.hparams;
-    const auto & cparams = lctx.cparams;
-
-    GGML_ASSERT((!batch.token && batch.embd) || (batch.token && !batch.embd)); // NOLINT
+    GGML_ASSERT(!(my_rank == 0 && n_tokens_all == 0) && "n_tokens == 0 on master node");
 
-    if (batch.token) {
-        for (uint32_t i = 0; i < n_tokens; ++i) {
-            if (batch.token[i] < 0 || (uint32_t)batch.token[i] >= model.vocab.n_vocab) {
-                LLAMA_LOG_ERROR("%s: invalid token[%d] = %d\n", __func__, i, batch.token[i]);
+    if (batch_all.token) {
+        for (uint32_t i = 0; i < n_tokens_all; ++i) {
+            if (batch_all.token[i] < 0 || (uint32_t)batch_all.token[i] >= model.vocab.n_vocab) {
+                LLAMA_LOG_ERROR("%s: invalid token[%d] = %d\n", __func__, i, batch_all.token[i]);
                 return -1;
             }
         }
     }
 
-    // micro-batching is not possible for non-causal encoding, so we process the batch in a single shot
-    GGML_ASSERT(cparams.n_ubatch >= n_tokens && "encoder requires n_ubatch >= n_tokens");
+    GGML_ASSERT(n_tokens_all <= cparams.n_batch);
+
+    GGML_ASSERT((cparams.causal_attn || cparams.n_ubatch >= n_tokens_all) && "non-causal attention requires n_ubatch >= n_tokens");
 
     if (lctx.t_compute_start_us == 0) {
         lctx.t_compute_start_us = ggml_time_us();
     }
+    lctx.n_queued_tokens += n_tokens_all;
 
-    lctx.n_queued_tokens += n_tokens;
+    auto & kv_self = lctx.kv_self;
 
-    const int64_t n_embd = hparams.n_embd;
+    const int64_t n_embd  = hparams.n_embd;
+    const int64_t n_vocab = hparams.n_vocab;
 
-    lctx.sbatch.from_batch(batch, n_embd, /* simple_split */ true, /* logits_all */ true);
+    uint32_t n_outputs = 0;
+    uint32_t n_outputs_prev = 0;
 
-    const llama_ubatch ubatch = lctx.sbatch.split_simple(n_tokens);
+    const auto n_ubatch = cparams.n_ubatch;
 
-    // reserve output buffer
-    if (llama_output_reserve(lctx, n_tokens) < n_tokens) {
-        LLAMA_LOG_ERROR("%s: could not reserve space for batch with %u outputs\n", __func__, n_tokens);
-        return -2;
-    };
+    // this indicates we are doing pooled embedding, so we ignore batch.logits and output all tokens
+    const bool embd_pooled = cparams.embeddings && cparams.pooling_type != LLAMA_POOLING_TYPE_NONE;
 
-    for (uint32_t i = 0; i < n_tokens; ++i) {
-        lctx.output_ids[i] = i;
+    lctx.embd_seq.clear();
+
+    // count outputs
+    if (batch_all.logits && !embd_pooled) {
+        for (uint32_t i = 0; i < n_tokens_all; ++i) {
+            n_outputs += batch_all.logits[i] != 0;
+        }
+    } else if (lctx.logits_all || embd_pooled) {
+        n_outputs = n_tokens_all;
+    } else {
+        // keep last output only
+        n_outputs = 1;
     }
 
-    lctx.inp_embd_enc = NULL;
-    lctx.n_outputs = n_tokens;
+    sync_meta meta;
+    meta.n_ctx = cparams.n_ctx;
+    bool is_last_dev = (worker_rank == n_worker - 1);
 
-    int n_threads = n_tokens == 1 ? cparams.n_threads : cparams.n_threads_batch;
-    ggml_threadpool_t threadpool = n_tokens == 1 ? lctx.threadpool : lctx.threadpool_batch;
+    // the ring is final by the first pass, see how the outputs for the master leave this device
+    if (my_rank != 0 && lctx.comm.relay == nullptr) {
+        llama_route_master(lctx);
+    }
+    if (n_world > 1 && !lctx.tp.started) {
+        llama_tp_start(lctx);
+    }
 
-    GGML_ASSERT(n_threads > 0);
+    // the next node stopped answering, the graphs are built without the split from now on
+    if (lctx.tp.broken && lctx.tp.socket != nullptr) {
+        lctx.tp.close();
+        lctx.graph_cache.clear();
+    }
 
-    ggml_backend_sched_reset(lctx.sched.at(0)); // todo.
-    ggml_backend_sched_set_eval_callback(lctx.sched.at(0), lctx.cparams.cb_eval, lctx.cparams.cb_eval_user_data); // todo.
+    if (my_rank != 0) {
+        auto & arena = lctx.meta_arena;
+        arena.recv_buf.resize(meta_recv_capacity(cparams.n_batch));
 
-    std::vector<ggml_cgraph *> gf = llama_build_graph(lctx, ubatch, false);
+        if (llama_recv_meta(*lctx.recv_socket, arena, &meta, &lctx.comm) == -1) {
+            return -1;
+        }
 
-    // the output embeddings after the final encoder normalization
-    struct ggml_tensor * embd = nullptr;
+        // the batch arrays stay in the arena until the next message, no copies needed
+        if (meta.n_tokens > 0) {
+            batch_all.n_tokens  = meta.n_tokens;
+            batch_all.pos       = meta.pos;
+            batch_all.n_seq_id  = meta.n_seq_id;
+            batch_all.seq_id    = meta.seq_id;
+            batch_all.logits    = meta.logits;
+            batch_all.all_pos_0 = meta.all_pos_0;
+            batch_all.all_pos_1 = meta.all_pos_1;
+        }
 
-    // there are two cases here
-    if (llama_model_has_decoder(&lctx.model)) {
-        // first case is an encoder-decoder T5 model where embeddings are passed to decoder
-        embd = ggml_graph_node(gf.back(), -1); // todo.
-        GGML_ASSERT(strcmp(embd->name, "result_norm") == 0 && "missing result_output tensor");
-    } else {
-        // second case is an encoder-only T5 model
-        if (cparams.embeddings) {
-            // only output embeddings if required
-            embd = ggml_graph_node(gf.back(), -1);  // todo.
-            if (strcmp(embd->name, "result_embd_pooled") != 0) {
-                embd = ggml_graph_node(gf.back(), -2);  // todo.
-            }
-            GGML_ASSERT(strcmp(embd->name, "result_embd_pooled") == 0 && "missing embeddings tensor");
+        if (kv_cache_op(meta.clear_kv_cache,
+                    [&]{ llama_kv_cache_clear       (&lctx); },
+                    [&]{ llama_send_kv_cache_clear  (&lctx); },
+                    is_last_dev)) {
+            LLAMA_LOG_DEBUG("%s: received signal kv_cache_clear\n", __func__);
+            return -1;
         }
-    }
 
-    ggml_backend_sched_alloc_graph(lctx.sched.at(0), gf.at(0)); // todo.
+        if (kv_cache_op(meta.kv_seq_rm,
+                    [&]{ llama_kv_cache_seq_rm      (&lctx, meta.rm_seq_id, meta.rm_p0, meta.rm_p1); },
+                    [&]{ llama_send_kv_cache_seq_rm (&lctx, meta.rm_seq_id, meta.rm_p0, meta.rm_p1); },
+                    is_last_dev)) {
+            LLAMA_LOG_DEBUG("%s: received signal kv_cache_seq_rm\n", __func__);
+            return -1;
+        }
 
-    llama_set_inputs(lctx, ubatch);
+        if (kv_cache_op(meta.kv_seq_add,
+                    [&]{ llama_kv_cache_seq_add     (&lctx, meta.add_seq_id, meta.add_p0, meta.add_p1, meta.add_delta); },
+                    [&]{ llama_send_kv_cache_seq_add(&lctx, meta.add_seq_id, meta.add_p0, meta.add_p1, meta.add_delta); },
+                    is_last_dev)) {
+            LLAMA_LOG_DEBUG("%s: received signal kv_cache_seq_add\n", __func__);
+            return -1;
+        }
 
-    llama_graph_compute(lctx, gf.at(0), lctx.sched.at(0), n_threads, threadpool); // todo.
-
-    // extract embeddings
-    if (embd) {
-        ggml_backend_t backend_embd = ggml_backend_sched_get_tensor_backend(lctx.sched.at(0), embd); // todo.
-        GGML_ASSERT(backend_embd != nullptr);
+        if (kv_cache_op(meta.kv_seq_cp,
+                    [&]{ llama_kv_cache_seq_cp      (&lctx, meta.cp_src_seq_id, meta.cp_dst_seq_id, meta.cp_p0, meta.cp_p1); },
+                    [&]{ llama_send_kv_cache_seq_cp (&lctx, meta.cp_src_seq_id, meta.cp_dst_seq_id, meta.cp_p0, meta.cp_p1); },
+                    is_last_dev)) {
+            LLAMA_LOG_DEBUG("%s: received signal kv_cache_seq_cp\n", __func__);
+            return -1;
+        }
 
-        if (llama_model_has_decoder(&lctx.model)) {
-            lctx.embd_enc.resize(n_tokens*n_embd);
-            float * embd_out = lctx.embd_enc.data();
+        if (kv_cache_op(meta.kv_seq_keep,
+                    [&]{ llama_kv_cache_seq_keep     (&lctx, meta.keep_seq_id); },
+                    [&]{ llama_send_kv_cache_seq_keep(&lctx, meta.keep_seq_id); },
+                    is_last_dev)) {
+            LLAMA_LOG_DEBUG("%s: received signal kv_cache_seq_keep\n", __func__);
+            return -1;
+        }
 
-            ggml_backend_tensor_get_async(backend_embd, embd, embd_out, 0, n_tokens*n_embd*sizeof(float));
-            GGML_ASSERT(!ubatch.equal_seqs); // TODO: handle equal splits
+        if (kv_cache_op(meta.kv_seq_div,
+                    [&]{ llama_kv_cache_seq_div     (&lctx, meta.div_seq_id, meta.div_p0, meta.div_p1, meta.div_factor); },
+                    [&]{ llama_send_kv_cache_seq_div(&lctx, meta.div_seq_id, meta.div_p0, meta.div_p1, meta.div_factor); },
+                    is_last_dev)) {
+            LLAMA_LOG_DEBUG("%s: received signal kv_cache_seq_div\n", __func__);
+            return -1;
+        }
 
-            // remember the sequence ids used during the encoding - needed for cross attention later
-            lctx.seq_ids_enc.resize(n_tokens);
-            for (uint32_t i = 0; i < n_tokens; i++) {
-                for (int s = 0; s < ubatch.n_seq_id[i]; s++) {
-                    llama_seq_id seq_id = ubatch.seq_id[i][s];
-                    lctx.seq_ids_enc[i].insert(seq_id);
-                }
+        if (meta.perf_set != nullptr) {
+            if (my_rank < meta.perf_n_rank) {
+                meta.perf_set[my_rank] = llama_rank_perf_take(lctx);
             }
-        } else {
-            GGML_ASSERT(lctx.embd != nullptr);
+            // the last device closes the ring, which brings the reports back to the master
+            llama_forward_meta(lctx, meta_perf_frame_size(meta.perf_n_rank));
+            return -1;
+        }
 
-            switch (cparams.pooling_type) {
-                case LLAMA_POOLING_TYPE_NONE:
-                    {
-                        // extract token embeddings
-                        GGML_ASSERT(lctx.embd != nullptr);
-                        float * embd_out = lctx.embd;
+        if (meta.recover_frame != nullptr) {
+            llama_ring_recover_local(lctx, meta.recover_frame);
+            return -1;
+        }
 
-                        GGML_ASSERT(n_tokens*n_embd <= (int64_t) lctx.embd_size);
-                        ggml_backend_tensor_get_async(backend_embd, embd, embd_out, 0, n_tokens*n_embd*sizeof(float));
-                    } break;
-                case LLAMA_POOLING_TYPE_MEAN:
-                case LLAMA_POOLING_TYPE_CLS:
-                case LLAMA_POOLING_TYPE_LAST:
-                    {
-                        // extract sequence embeddings
-                        auto & embd_seq_out = lctx.embd_seq;
-                        embd_seq_out.clear();
+        if (meta.join_frame != nullptr) {
+            llama_ring_join_local(lctx, meta.join_frame);
+            return -1;
+        }
 
-                        GGML_ASSERT(!ubatch.equal_seqs); // TODO: handle equal splits
+        if (meta.kv_handoff_frame != nullptr) {
+            llama_kv_handoff_local(lctx, meta.kv_handoff_frame);
+            return -1;
+        }
 
-                        for (uint32_t i = 0; i < n_tokens; i++) {
-                            const llama_seq_id seq_id = ubatch.seq_id[i][0];
-                            if (embd_seq_out.find(seq_id) != embd_seq_out.end()) {
-                                continue;
-                            }
-                            embd_seq_out[seq_id].resize(n_embd);
-                            ggml_backend_tensor_get_async(backend_embd, embd, embd_seq_out[seq_id].data(), (n_embd*seq_id)*sizeof(float), n_embd*sizeof(float));
-                        }
-                    } break;
-                case LLAMA_POOLING_TYPE_RANK:
-                    {
-                        // TODO: this likely should be the same logic as in llama_decoder_internal, but better to
-                        //       wait for an encoder model that requires this pooling type in order to test it
-                        //       https://github.com/ggerganov/llama.cpp/pull/9510
-                        GGML_ABORT("RANK pooling not implemented yet");
-                    }
-                case LLAMA_POOLING_TYPE_UNSPECIFIED:
-                    {
-                        GGML_ABORT("unknown pooling type");
-                    }
+        if (meta.reshard_window != nullptr) {
+            uint32_t n_layer_window_new[32];
+            uint32_t n_layer_extra_new[32];
+            uint32_t n_gpu_layers_new[32];
+            std::copy(meta.reshard_window, meta.reshard_window + 32, n_layer_window_new);
+            std::copy(meta.reshard_extra,  meta.reshard_extra  + 32, n_layer_extra_new);
+            if (meta.reshard_gpu_layers != nullptr) {
+                std::copy(meta.reshard_gpu_layers, meta.reshard_gpu_layers + 32, n_gpu_layers_new);
+            }
+
+            // pass it on first, so that the ranks reload their weights in parallel
+            if (!is_last_dev) {
+                llama_forward_meta(lctx, meta_reshard_frame_size());
             }
+            llama_reshard_local(lctx, n_layer_window_new, n_layer_extra_new, meta.reshard_gpu_layers != nullptr ? n_gpu_layers_new : nullptr, my_rank, n_world);
+            return -1;
         }
     }
 
-    // Reset state for the next token before backend sync, to allow the CPU activities in the reset to
-    // overlap with device computation.
-    ggml_backend_sched_reset(lctx.sched.at(0)); // todo.
-
-    return 0;
-}
+    // micro-batching is decided by the master and travels with the metadata,
+    // so that all devices split the batch and assign kv cells the same way
+    if (my_rank == 0) {
+        meta.n_micro_batch = llama_micro_batch_size(lctx, batch_all);
+    }
+    const uint32_t n_micro_batch = meta.n_micro_batch;
 
-// find holes from the beginning of the KV cache and fill them by moving data from the end of the cache
-static void llama_kv_cache_defrag_internal(struct llama_context & lctx) {
-    auto & kv_self = lctx.kv_self;
+    if (!is_last_dev) {
+        meta.n_tokens  = batch_all.n_tokens;
+        meta.pos       = batch_all.pos;
+        meta.n_seq_id  = batch_all.n_seq_id;
+        meta.seq_id    = batch_all.seq_id;
+        meta.logits    = batch_all.logits;
+        meta.all_pos_0 = batch_all.all_pos_0;
+        meta.all_pos_1 = batch_all.all_pos_1;
+        llama_send_meta(*lctx.send_socket, lctx.meta_arena.send_buf, &meta, server_mode);
+    } 
+    
+    lctx.sbatch.from_batch(batch_all, n_embd,
+        /* simple_split */ !kv_self.recurrent,
+        /* logits_all   */ n_outputs == n_tokens_all);
 
-    const auto & hparams = lctx.model.hparams;
+    // reserve output buffer
+    if (my_rank == 0 && llama_output_reserve(lctx, n_outputs) < n_outputs) {
+        LLAMA_LOG_ERROR("%s: could not reserve space for batch with %u outputs\n", __func__, n_outputs);
+        return -2;
+    };
 
-    const uint32_t n_layer = hparams.n_layer;
+    // the comm threads are started on first use, when the ring is already set up
+    if (cparams.async_comm && n_world > 1 && !lctx.comm.is_async()) {
+        // a few staging buffers are enough to keep the link busy while bounding the memory in flight
+        lctx.comm.start(llama_default_buffer_type_cpu(model, true), 4, n_embd, cparams.n_ubatch);
+    }
 
-    const uint32_t n_kv   = llama_kv_cache_cell_max(kv_self);
-    const uint32_t n_used = kv_self.used;
+    // catch up with the cells the previous device wrote in the last passes
+    if (lctx.comm.replica != nullptr) {
+        llama_kv_replica_apply(lctx);
+    }
 
-    assert(n_used <= n_kv);
+    while (lctx.sbatch.n_tokens > 0) { // handle multiple batches
+        llama_ubatch ubatch;
+        if (kv_self.recurrent) {
+            if (embd_pooled) {
+                // Pooled embeddings cannot be split across ubatches (yet)
+                ubatch = lctx.sbatch.split_seq(n_ubatch);
+            } else {
+                // recurrent model architectures are easier to implement
+                // with equal-length sequences
+                ubatch = lctx.sbatch.split_equal(n_ubatch);
+            }
+        } else {
+            ubatch = lctx.sbatch.split_simple(n_ubatch);
+        }
+        const uint32_t n_tokens = ubatch.n_tokens;
 
-    //const int64_t t_start = ggml_time_us();
+        // prefill is split into micro-batches that stream through the ring one after another,
+        // so that the next device can work on micro-batch j while this one computes j + 1
+        std::vector<llama_ubatch> mbatches = llama_split_micro_batches(ubatch, n_micro_batch, n_embd);
 
-    // number of cells moved
-    uint32_t n_moves = 0;
+        // offset of the second half of the activation receive buffer
+        const size_t n_embd_half = lctx.sbatch.ubatch_backend_embd.size() / 2;
 
-    // each move requires 6*n_layer tensors (see build_defrag)
-    //   - source view, destination view, copy operation
-    //   - x2 for keys and values
-    //const uint32_t max_moves = llama_model_max_nodes(model)/(6*n_layer);
-    // TODO: tmp fix https://github.com/ggerganov/llama.cpp/issues/6685#issuecomment-2057579516
-    const uint32_t max_moves = (llama_model_max_nodes(lctx.model) - 2*n_layer)/(6*n_layer);
+        // non-causal masks do not use the KV cache
+        std::vector<uint32_t> mb_kv_head;
+        std::vector<std::vector<llama_kv_run>> mb_kv_runs;
+        if (hparams.causal_attn) {
+            llama_kv_cache_update(&lctx);
 
-    // determine which KV cells to move where
-    //
-    //  cell i moves to ids[i]
-    //
-    //  if ids[i] == i || ids[i] == n_kv, then cell i is not moved
-    //
-    std::vector<uint32_t> ids(n_kv, n_kv);
+            // if we have enough unused cells before the current head ->
+            //   better to start searching from the beginning of the cache, hoping to fill it
+            if (kv_self.head > kv_self.used + 2 * n_tokens) {
+                kv_self.head = 0;
+            }
 
-    for (uint32_t i0 = 0; i0 < n_used; ++i0) {
-        const auto & cell0 = kv_self.cells[i0];
+            // reserve the cells of all micro-batches up front, every device does the same split
+            // on the same metadata, so the slots stay identical across the ring. cells of later
+            // micro-batches have larger positions and are hidden from earlier ones by the causal mask
+            for (size_t m = 0; m < mbatches.size(); ) {
+                if (!llama_kv_cache_find_slot(kv_self, mbatches[m])) {
+                    lctx.comm.flush();
+                    return 1;
+                }
 
-        if (!cell0.is_empty()) {
-            ids[i0] = i0;
+                // a graph stores at most LLAMA_KV_MAX_RUNS runs of cells, a micro-batch spread over more
+                // gives its cells back and is stored again in two halves
+                if (kv_self.runs.size() > LLAMA_KV_MAX_RUNS) {
+                    llama_kv_cache_release_runs(kv_self);
 
-            continue;
-        }
+                    const std::vector<llama_ubatch> halves = llama_split_micro_batches(mbatches[m], (mbatches[m].n_tokens + 1) / 2, n_embd);
+                    mbatches.erase(mbatches.begin() + m);
+                    mbatches.insert(mbatches.begin() + m, halves.begin(), halves.end());
+                    continue;
+                }
 
-        // found a hole - fill it with data from the end of the cache
+                mb_kv_head.push_back(kv_self.head);
+                mb_kv_runs.push_back(kv_self.runs);
 
-        uint32_t nh = 1;
+                if (m + 1 < mbatches.size()) {
+                    kv_self.head += mbatches[m].n_tokens;
+                    if (kv_self.head >= kv_self.size) {
+                        kv_self.head = 0;
+                    }
+                }
+                ++m;
+            }
 
-        // determine the size of the hole
-        while (i0 + nh < n_used && kv_self.cells[i0 + nh].is_empty()) {
-            nh++;
+            if (!kv_self.recurrent) {
+                // a heuristic, to avoid attending the full cache if it is not yet utilized
+                // after enough generations, the benefit from this heuristic disappears
+                // if we start defragmenting the cache, the benefit from this will be more important
+                const uint32_t pad = llama_kv_cache_get_padding(cparams);
+                kv_self.n = std::min(kv_self.size, std::max(pad, GGML_PAD(llama_kv_cache_cell_max(kv_self), pad)));
+            }
         }
 
-        uint32_t nf = 0;
-        uint32_t is = n_kv - 1;
-
-        // starting from the end, find nh non-empty cells
-        for (; is > i0; --is) {
-            const auto & cell1 = kv_self.cells[is];
+        const size_t n_mbatch = mbatches.size();
+        mb_kv_head.resize(n_mbatch, kv_self.head);
+        mb_kv_runs.resize(n_mbatch);
 
-            if (cell1.is_empty() || ids[is] != n_kv) {
-                continue;
+        // count the outputs in this u_batch
+        int32_t n_outputs_new = 0;
+        std::vector<int32_t> mb_n_outputs(n_mbatch, 0);
+        for (size_t m = 0; m < n_mbatch; ++m) {
+            const llama_ubatch & mb = mbatches[m];
+            if (n_outputs == n_tokens_all) {
+                mb_n_outputs[m] = mb.n_tokens;
+            } else {
+                GGML_ASSERT(mb.output);
+                for (uint32_t i = 0; i < mb.n_tokens; i++) {
+                    mb_n_outputs[m] += (int32_t) (mb.output[i] != 0);
+                }
             }
+            n_outputs_new += mb_n_outputs[m];
+        }
 
-            // non-empty cell which is not yet moved
-            nf++;
+        std::vector<ggml_cgraph *> gf;
 
-            if (nf == nh) {
-                break;
-            }
-        }
+        // the output is always the last tensor in the graph
+        struct ggml_tensor * res        = nullptr;
+        struct ggml_tensor * embd       = nullptr;
+        struct ggml_tensor * sub_gf_out = nullptr;
+        const  int64_t       n_embd     = hparams.n_embd;
 
-        // this can only happen if `n_used` is not accurate, which would be a bug
-        GGML_ASSERT(nf == nh && "KV defrag bug: nf != nh");
+        // build and allocate the graph of a micro-batch, it replaces the graph of the previous one
+        auto build_graph = [&](size_t m) {
+            const llama_ubatch & mb = mbatches[m];
 
-        nf = 0;
+            // needs to happen before the graph is built
+            lctx.n_outputs = mb_n_outputs[m];
+            kv_self.head   = mb_kv_head[m];
+            kv_self.runs   = mb_kv_runs[m];
 
-        uint32_t i1 = is;
+            // a step or micro-batch with the shape of one of the cached graphs reuses them, only the inputs and the
+            // KV store offsets change. a micro-batch stored in several runs of cells needs runs of the same lengths
+            const bool cacheable = !kv_self.recurrent && cparams.pooling_type == LLAMA_POOLING_TYPE_NONE;
+            const int  ie_reuse  = cacheable ? llama_graph_cache_match(lctx, mb) : -1;
 
-        // are we moving a continuous block of memory?
-        bool cont = false;
+            if (ie_reuse >= 0) {
+                llama_graph_cache_use(lctx, ie_reuse);
+                llama_graph_cache_set_kv_head(lctx);
+                gf = lctx.graph_cache.entries[ie_reuse].gf;
+            } else {
+                for (size_t i = 0; i < lctx.sched.size(); i++) {
+                    ggml_backend_sched_reset(lctx.sched[i]);
+                    ggml_backend_sched_set_eval_callback(lctx.sched[i], lctx.cparams.cb_eval, lctx.cparams.cb_eval_user_data);
+                }
 
-        // should we stop searching for the next move?
-        bool stop = false;
+                if (cacheable) {
+                    // built in the buffer of the entry, so that the graphs of the other entry stay
+                    const int ie = llama_graph_cache_slot(lctx);
+                    auto & e = lctx.graph_cache.entries[ie];
+                    e.valid = false;
+                    e.pins.clear();
 
-        // go back and move the nf cells to the hole
-        for (; i1 < n_kv; ++i1) {
-            auto & cell1 = kv_self.cells[i1];
+                    lctx.graph_cache.building = &e;
+                    std::swap(lctx.buf_compute_meta, e.buf_meta);
+                    gf = llama_build_graph(lctx, mb, false);
+                    std::swap(lctx.buf_compute_meta, e.buf_meta);
+                    lctx.graph_cache.building = nullptr;
 
-            if (cell1.is_empty() || ids[i1] != n_kv) {
-                if (n_moves == max_moves) {
-                    stop = true;
-                    break;
+                    llama_graph_cache_store(lctx, ie, mb, gf);
+                } else {
+                    gf = llama_build_graph(lctx, mb, false);
                 }
-
-                cont = false;
-                continue;
+                lctx.sched_pending.assign(gf.size(), true);
             }
+            GGML_ASSERT(lctx.sched.size() == gf.size());
 
-            // this cell goes to (i0 + nf)
-            ids[i1] = i0 + nf;
+            res  = nullptr;
+            embd = nullptr;
+            if (my_rank == 0) {
+                res  = ggml_graph_node(gf.back(), -1);
+                embd = ggml_graph_node(gf.back(), -2);
+            }
+
+            if (lctx.n_outputs == 0) {
+                // no output
+                res  = nullptr;
+                embd = nullptr;
+            } else if (cparams.embeddings) {
+                res  = nullptr; // do not extract logits for embedding case
+                embd = nullptr;
+                for (int i = ggml_graph_n_nodes(gf.back()) - 1; i >= 0; --i) {
+                    if (strcmp(ggml_graph_node(gf.back(), i)->name, "result_embd_pooled") == 0) {
+                        embd = ggml_graph_node(gf.back(), i);
+                        break;
+                    }
+                }
+                GGML_ASSERT(embd != nullptr && "missing embeddings tensor");
+            } else {
+                embd = nullptr; // do not extract embeddings when not needed
+            }
+        };
 
-            // move the cell meta data
-            kv_self.cells[i0 + nf] = cell1;
+        // micro-batches of the same shape share these graphs, the last one is usually shorter or holds the outputs
+        // and switches to graphs of its own, which stay cached next to these
+        build_graph(0);
+        size_t m_built = 0;
 
-            // clear the old cell and move the head there
-            cell1 = llama_kv_cell();
-            kv_self.head = n_used;
+        const size_t n_gf      = gf.size();
+        const size_t n_layer   = hparams.n_layer;
+        bool         is_output = false;
+        GGML_ASSERT(my_rank == 0 || n_world > 1);
 
-            if (!cont) {
-                n_moves++;
-                cont = true;
+        // whether each subgraph ends with the last layer, known before compute so that receives can be posted ahead
+        std::vector<bool> sub_last_l(n_gf, false);
+        for (size_t i = 0; i < n_gf; ++i) {
+            const char * name = ggml_graph_node(gf[i], -1)->name;
+            if (strcmp(name, "result_output") != 0 && strcmp(name, "inp_embd") != 0) {
+                const int cur_l = std::atoi(strchr(name, '-') + 1);
+                sub_last_l[i] = cur_l == static_cast<int>(n_layer) - 1;
             }
+        }
 
-            nf++;
+        auto needs_recv = [&](size_t i) {
+            return n_world > 1 && !(my_rank == 0 && i == 0) && !(my_rank == 0 && i > 0 && sub_last_l[i - 1]);
+        };
 
-            if (nf == nh) {
-                break;
-            }
-        }
+        llama_comm & comm        = lctx.comm;
+        bool         recv_posted = false;
 
-        if (stop || n_moves == max_moves) {
-            break;
-        }
+        for (size_t i = 0; i < n_gf; ++i) {
+            const bool is_out_embd = my_rank == 0 && i == n_gf - 1;
+            const bool is_last_l   = sub_last_l[i];
 
-        //LLAMA_LOG_INFO("(tmp log) KV defrag: move [%u, %u) to [%u, %u)\n", is, i1 + 1, i0, i0 + nh);
+            // the pages of a released window that are still out of the page cache are read back by faults in this compute
+            if (i < lctx.win_released.size() && lctx.win_released[i] > 0) {
+                const std::vector<Segment> segments = graph_weight_segments(gf[i], &model);
+                lctx.n_bytes_refaulted += segments_size(segments) - std::min(segments_size(segments), segments_resident_size(segments));
+                lctx.win_released[i]    = 0;
+            }
 
-        i0 += nh - 1;
-    }
+            if (lctx.win_perf.size() < n_gf) {
+                lctx.win_perf.resize(n_gf);
+            }
+            auto & wperf = lctx.win_perf[i];
+            wperf.n_runs++;
 
-    if (n_moves == 0) {
-        return;
-    }
+            // wait for the streamed weights of this window, the read of the next one then overlaps its compute
+            if (model.stream) {
+                const int w = model.stream->window_of(gf[i]);
+                if (w >= 0) {
+                    const int64_t t_start_us = ggml_time_us();
+                    model.stream->acquire(w);
+                    wperf.t_prefetch_us += ggml_time_us() - t_start_us;
+                }
+            }
 
-    //LLAMA_LOG_INFO("(tmp log) KV defrag cell moves: %u\n", n_moves);
+            const int64_t n_maj_faults_start = llama_major_faults();
 
-    //LLAMA_LOG_INFO("expected gf nodes: %u\n", 6*n_moves*n_layer);
+            for (size_t m = 0; m < n_mbatch; ++m) {
+                llama_ubatch mb = mbatches[m];
 
-#if 0
-    // CPU defrag
-    //
-    // TODO: optimizations are possible:
-    //       - multiple threads
-    //       - avoid copying to the host memory when already there
-    //
-    // likely not worth the effort, as we have ggml_graph based defrag
-    //
+                if (m != m_built) {
+                    build_graph(m);
+                    m_built = m;
+                }
 
-    const uint32_t n_embd_k_gqa = hparams.n_embd_k_gqa();
-    const uint32_t n_embd_v_gqa = hparams.n_embd_v_gqa();
+                const int n_threads = mb.n_tokens == 1 ? cparams.n_threads : cparams.n_threads_batch;
+                ggml_threadpool_t threadpool = mb.n_tokens == 1 ? lctx.threadpool : lctx.threadpool_batch;
+                GGML_ASSERT(n_threads > 0);
 
-    const uint32_t kv_size = kv_self.size;
+                ggml_cgraph * sub_gf = gf[i];
 
-    std::vector<uint8_t> buf_k;
-    std::vector<uint8_t> buf_v;
+                // receive data from other nodes, the input tensor is then bound to where it landed
+                if (needs_recv(i)) {
+                    float * dst = is_out_embd ? mb.out_embd : mb.backend_embd;
+                    if (comm.is_async()) {
+                        if (!recv_posted) {
+                            comm.post_recv(lctx.recv_socket, dst, is_out_embd);
+                        }
+                        dst = comm.wait_recv(mb.pos, mb.n_tokens);
+                        if (dst == nullptr) {
+                            return llama_ring_abort(lctx);
+                        }
+                        if (is_out_embd) {
+                            mb.out_embd = dst;
+                        } else {
+                            mb.backend_embd = dst;
+                        }
+                    } else {
+                        const int64_t t_start_us = ggml_time_us();
+                        const int64_t n_pos = llama_recv_tensors(*lctx.recv_socket, dst, mb.pos, comm.pending, is_out_embd, comm.epoch, comm.ring, comm.replica, &comm);
+                        comm.t_comm_us      += ggml_time_us() - t_start_us;
+                        comm.t_comm_wait_us += ggml_time_us() - t_start_us;
+                        if (n_pos < 0) {
+                            return llama_ring_abort(lctx);
+                        }
+                    }
+                }
 
-    for (uint32_t il = 0; il < n_layer; ++il) {
-        const size_t k_size_row = ggml_row_size(kv_self.k_l[il]->type, n_embd_k_gqa);
-        const size_t k_size     = ggml_row_size(kv_self.k_l[il]->type, n_embd_k_gqa*kv_size);
+                // ensure ggml_backend_tensor_get_async of the previous subgraph has finished
+                if (i > 0 && (n_world == 1 || (my_rank == 0 && sub_last_l[i - 1]))) {
+                    ggml_backend_sched_synchronize(lctx.sched[i - 1]);
+                }
 
-        const size_t v_size_el = ggml_type_size(kv_self.v_l[il]->type);
-        const size_t v_size    = ggml_row_size (kv_self.v_l[il]->type, n_embd_v_gqa*kv_size);
+                if (lctx.sched_pending[i]) {
+                    if (lctx.graph_cache.cur >= 0) {
+                        llama_graph_cache_reset_sched(lctx, i);
+                    }
+                    ggml_backend_sched_alloc_graph(lctx.sched[i], sub_gf);
+                    lctx.sched_pending[i] = false;
+                }
 
-        buf_k.resize(k_size);
-        buf_v.resize(v_size);
+                mb.activate_input  = (my_rank == 0 && i == 0);
+                mb.activate_output = (my_rank == 0 && is_out_embd);
+                GGML_ASSERT(!(mb.activate_input && mb.activate_output));
 
-        ggml_backend_tensor_get(kv_self.k_l[il], buf_k.data(), 0, buf_k.size());
-        ggml_backend_tensor_get(kv_self.v_l[il], buf_v.data(), 0, buf_v.size());
+                llama_set_inputs(lctx, mb);
 
-        // batch move [i, i+nm) to [id, id+nm)
-        // note: cells can move only to a lower index
-        for (uint32_t i = 0; i < n_kv; ++i) {
-            const uint32_t id = ids[i];
+                // the inputs are consumed, post the receive of the next ones so that it completes during compute
+                if (comm.is_async()) {
+                    const size_t next_i = m + 1 < n_mbatch ? i     : i + 1;
+                    const size_t next_m = m + 1 < n_mbatch ? m + 1 : 0;
 
-            if (i == id || id == n_kv) {
-                continue;
-            }
+                    recv_posted = next_i < n_gf && needs_recv(next_i);
+                    if (recv_posted) {
+                        const bool next_out_embd = my_rank == 0 && next_i == n_gf - 1;
+                        float * dst = next_out_embd ? mbatches[next_m].out_embd : mbatches[next_m].backend_embd;
+                        // never land on the activations the compute below reads
+                        if (!next_out_embd && dst == mb.backend_embd) {
+                            dst += n_embd_half;
+                        }
+                        comm.post_recv(lctx.recv_socket, dst, next_out_embd);
+                    }
+                }
 
-            uint32_t nm = 1;
+                // how much of the window the prefetch managed to bring in before we need it
+                if (m == 0 && cparams.residency_stats) {
+                    wperf.resident_pct += is_graph_loaded(sub_gf);
+                }
 
-            while (i + nm < n_kv && ids[i + nm] == id + nm) {
-                nm++;
-            }
+                {   // compute graph
+                    timer(llama_graph_compute);
+                    const int64_t t_start_us = ggml_time_us();
+                    llama_graph_compute(lctx, sub_gf, lctx.sched[i], n_threads, threadpool);
+                    wperf.t_compute_us += ggml_time_us() - t_start_us;
+                }
 
-            // move keys
-            {
-                const int64_t os =  i*k_size_row;
-                const int64_t od = id*k_size_row;
+                sub_gf_out = ggml_graph_node(sub_gf, -1);
+                is_output  = strcmp(sub_gf_out->name, "result_output") == 0;
+                if (is_output) {
+                    // extract logits
+                    if (res) {
+                        ggml_backend_t backend_res = ggml_backend_sched_get_tensor_backend(lctx.sched.back(), res);
+                        GGML_ASSERT(backend_res != nullptr);
+                        GGML_ASSERT(lctx.logits != nullptr);
+
+                        int32_t n_outputs_mb_prev = n_outputs_prev;
+                        for (size_t k = 0; k < m; ++k) {
+                            n_outputs_mb_prev += mb_n_outputs[k];
+                        }
 
-                memcpy(buf_k.data() + od, buf_k.data() + os, nm*k_size_row);
-            }
+                        float * logits_out = lctx.logits + n_outputs_mb_prev * n_vocab;
+                        const int32_t n_outputs_mb = lctx.n_outputs;
 
-            // move values (note: they are transposed)
-            {
-                const int64_t os =  i;
-                const int64_t od = id;
+                        if (n_outputs_mb) {
+                            GGML_ASSERT( n_outputs_mb_prev + n_outputs_mb <= (int32_t) n_outputs);
+                            GGML_ASSERT((n_outputs_mb_prev + n_outputs_mb) * n_vocab <= (int64_t) lctx.logits_size);
+                            ggml_backend_tensor_get_async(backend_res, res, logits_out, 0, n_outputs_mb * n_vocab * sizeof(float));
+                        }
 
-                for (uint32_t j = 0; j < n_embd_v_gqa; ++j) {
-                    memcpy(buf_v.data() + (od + j*kv_size)*v_size_el, buf_v.data() + (os + j*kv_size)*v_size_el, nm*v_size_el);
+                        // the graph of the next micro-batch reuses the compute buffers
+                        if (m + 1 < n_mbatch) {
+                            ggml_backend_sched_synchronize(lctx.sched.back());
+                        }
+                    }
+                    continue;
                 }
-            }
 
-            i += nm - 1;
-        }
+                const bool is_send      = !(n_world == 1 || (my_rank == 0 && is_last_l));
+                const bool is_to_master = my_rank != 0 && is_last_l;
 
-        ggml_backend_tensor_set(kv_self.k_l[il], buf_k.data(), 0, buf_k.size());
-        ggml_backend_tensor_set(kv_self.v_l[il], buf_v.data(), 0, buf_v.size());
-    }
-#else
-    // ggml_graph defrag
+                // the outputs for the master, and with a link of its own the input of its next cycle, skip the forwarders after the last device
+                const bool is_direct = is_to_master || (my_rank != 0 && is_last_dev && lctx.master_direct);
 
-    ggml_backend_sched_reset(lctx.sched.at(0)); // todo.
+                float * embd_buf;
+                if (is_send && comm.is_async()) {
+                    // the output goes into a staging buffer that the comm thread sends while we move on
+                    embd_buf = comm.acquire();
+                } else if (!is_send) {
+                    embd_buf = is_last_l ? mb.out_embd : mb.backend_embd;
+                } else {
+                    embd_buf = mb.backend_embd;
+                }
+                GGML_ASSERT(embd_buf != nullptr);
+
+                // copy device data to cpu memory
+                size_t         buf_size = sub_gf_out->ne[0] * sub_gf_out->ne[1] * sizeof(float);
+                ggml_backend_t backend  = ggml_backend_sched_get_tensor_backend(lctx.sched[i], sub_gf_out);
+                GGML_ASSERT(buf_size <= ggml_nbytes(sub_gf_out));
+                GGML_ASSERT(backend  != nullptr);
+                ggml_backend_tensor_get_async(backend, sub_gf_out, embd_buf, 0, buf_size);
+                ggml_backend_sched_synchronize(lctx.sched[i]);
+
+                // send the result to the next node or the master
+                if (is_send) {
+                    zmq::socket_t * s     = is_direct ? lctx.master_socket : lctx.send_socket;
+                    const int64_t   n_pos = lctx.inp_pos ? lctx.inp_pos->ne[0] : 0;
+
+                    // the next device keeps a replica of our kv cache, the cells this window wrote go along
+                    std::vector<uint8_t> kv_delta;
+                    if (comm.replica != nullptr && my_rank != 0 && (!is_to_master || is_last_dev) && hparams.causal_attn && !kv_self.recurrent) {
+                        std::vector<std::pair<uint32_t, uint32_t>> cell_ranges;
+                        if (mb_kv_runs[m].empty()) {
+                            cell_ranges.emplace_back(mb_kv_head[m], mb_kv_head[m] + mb.n_tokens);
+                        }
+                        for (const llama_kv_run & run : mb_kv_runs[m]) {
+                            cell_ranges.emplace_back(run.cell, run.cell + run.n);
+                        }
+                        llama_kv_replica_delta(lctx, std::atoi(strchr(sub_gf_out->name, '-') + 1), cell_ranges, kv_delta);
+                    }
 
-    ggml_cgraph * gf = llama_build_graph_defrag(lctx, ids);
+                    if (comm.is_async()) {
+                        llama_comm::send_job job;
+                        job.socket    = s;
+                        job.embd      = embd_buf;
+                        job.ne[0]     = sub_gf_out->ne[0];
+                        job.ne[1]     = sub_gf_out->ne[1];
+                        job.pos.assign(mb.pos, mb.pos + n_pos);
+                        job.to_master = is_to_master;
+                        job.kv_delta  = std::move(kv_delta);
+                        comm.send(std::move(job));
+                    } else {
+                        const int64_t t_start_us = ggml_time_us();
+                        llama_send_tensors(*s, embd_buf, sub_gf_out->ne, mb.pos, n_pos, cparams.comm_type, comm.buf, is_to_master, comm.epoch, &kv_delta);
+                        comm.t_comm_us      += ggml_time_us() - t_start_us;
+                        comm.t_send_us      += ggml_time_us() - t_start_us;
+                        comm.t_comm_wait_us += ggml_time_us() - t_start_us;
+                    }
+                }
+            }
 
-    llama_graph_compute(lctx, gf, lctx.sched.at(0), lctx.cparams.n_threads, lctx.threadpool); // todo.
-#endif
+            wperf.n_maj_faults += llama_major_faults() - n_maj_faults_start;
 
-    //const int64_t t_end = ggml_time_us();
+            if (is_output) {
+                break;
+            }
 
-    //LLAMA_LOG_INFO("(tmp log) KV defrag time: %.3f ms\n", (t_end - t_start)/1000.0);
-}
+            const int64_t t_prefetch_start_us = ggml_time_us();
 
-static void llama_kv_cache_update_internal(struct llama_context & lctx) {
-    bool need_reserve = false;
+            // make room for the next window before it is prefetched or faulted in
+            if (cparams.release_policy != LLAMA_RELEASE_POLICY_OFF && n_world > 1) {
+                llama_release_window(lctx, gf[i], i, gf[(i + 1) % n_gf]);
+            }
 
-    // apply K-shift if needed
-    if (lctx.model.hparams.rope_type != LLAMA_ROPE_TYPE_NONE && lctx.kv_self.has_shift) {
-        if (lctx.model.arch == LLM_ARCH_DEEPSEEK2) { // not supported due to MLA
-            GGML_ABORT("Deepseek2 does not support K-shift");
-        }
+            // overlap memory scheduling with other nodes' communication and computing
+            if (cparams.prefetch && n_world > 1) {
+                timer(manage_graph_tensors);
 
-        auto * sched = lctx.sched.at(0);
+                int next_gf_id = (i + 1) % n_gf;
+                manage_graph_tensors(gf[next_gf_id], POSIX_MADV_WILLNEED, cparams.force);
+                if (my_rank == 0 && (is_last_l || (next_gf_id == (int)n_gf - 1))) {
+                    manage_graph_tensors(gf[0], POSIX_MADV_WILLNEED, cparams.force);
+                }
+            }
 
-        ggml_backend_sched_reset(sched);
+            wperf.t_prefetch_us += ggml_time_us() - t_prefetch_start_us;
+        }
 
-        ggml_cgraph * gf = llama_build_graph_k_shift(lctx);
+        // set to the outputs of the whole u_batch, for the extraction below
+        lctx.n_outputs = n_outputs_new;
 
-        ggml_backend_sched_alloc_graph(sched, gf);
+        // update the kv ring buffer
+        {
+            kv_self.head = mb_kv_head.back() + mbatches.back().n_tokens;
 
-        llama_set_k_shift(lctx);
+            // Ensure kv cache head points to a valid index.
+            if (kv_self.head >= kv_self.size) {
+                kv_self.head = 0;
+            }
+        }
+        // extract embeddings
+        if (embd) {
+            throw std::runtime_error("embd is currently not supported");
 
-        llama_graph_compute(lctx, gf, sched, lctx.cparams.n_threads, lctx.threadpool);
-        
-        need_reserve = true;
+            ggml_backend_t backend_embd = ggml_backend_sched_get_tensor_backend(lctx.sched.back(), embd); // todo.
+            GGML_ASSERT(backend_embd != nullptr);
 
-        {
-            auto & kv_self = lctx.kv_self;
+            switch (cparams.pooling_type) {
+                case LLAMA_POOLING_TYPE_NONE:
+                    {
+                        // extract token embeddings
+                        GGML_ASSERT(lctx.embd != nullptr);
+                        float * embd_out = lctx.embd + n_outputs_prev*n_embd;
+                        const int32_t n_outputs_new = lctx.n_outputs;
 
-            kv_self.has_shift = false;
+                        if (n_outputs_new) {
+                            GGML_ASSERT( n_outputs_prev + n_outputs_new <= n_outputs);
+                            GGML_ASSERT((n_outputs_prev + n_outputs_new)*n_embd <= (int64_t) lctx.embd_size);
+                            ggml_backend_tensor_get_async(backend_embd, embd, embd_out, 0, n_outputs_new*n_embd*sizeof(float));
+                        }
+                    } break;
+                case LLAMA_POOLING_TYPE_MEAN:
+                case LLAMA_POOLING_TYPE_CLS:
+                case LLAMA_POOLING_TYPE_LAST:
+                    {
+                        // extract sequence embeddings (cleared before processing each batch)
+                        auto & embd_seq_out = lctx.embd_seq;
 
-            for (uint32_t i = 0; i < kv_self.size; ++i) {
-                kv_self.cells[i].delta = 0;
+                        for (uint32_t s = 0; s < ubatch.n_seqs; ++s) {
+                            const llama_seq_id seq_id = ubatch.seq_id[s][0];
+                            if (embd_seq_out.find(seq_id) != embd_seq_out.end()) {
+                                continue;
+                            }
+                            embd_seq_out[seq_id].resize(n_embd);
+                            ggml_backend_tensor_get_async(backend_embd, embd, embd_seq_out[seq_id].data(), (n_embd*seq_id)*sizeof(float), n_embd*sizeof(float));
+                        }
+                    } break;
+                case LLAMA_POOLING_TYPE_RANK:
+                    {
+                        // extract the rerank score - a single float per sequence
+                        auto & embd_seq_out = lctx.embd_seq;
+
+                        for (uint32_t s = 0; s < ubatch.n_seqs; ++s) {
+                            const llama_seq_id seq_id = ubatch.seq_id[s][0];
+                            if (embd_seq_out.find(seq_id) != embd_seq_out.end()) {
+                                continue;
+                            }
+                            embd_seq_out[seq_id].resize(1);
+                            ggml_backend_tensor_get_async(backend_embd, embd, embd_seq_out[seq_id].data(), (seq_id)*sizeof(float), sizeof(float));
+                        }
+                    } break;
+                case LLAMA_POOLING_TYPE_UNSPECIFIED:
+                    {
+                        GGML_ABORT("unknown pooling type");
+                    }
             }
         }
+        n_outputs_prev += lctx.n_outputs;
     }
 
-    // defragment the KV cache if needed
-    if (lctx.kv_self.do_defrag) {
-        llama_kv_cache_defrag_internal(lctx);
+    // the sockets are used by the caller between decodes (metadata, kv cache commands)
+    lctx.comm.flush();
 
-        need_reserve = true;
+    if (my_rank == 0) {
+        // set output mappings
+        bool sorted_output = true;
+        GGML_ASSERT(lctx.sbatch.out_ids.size() == n_outputs);
 
-        lctx.kv_self.do_defrag = false;
+        for (size_t i = 0; i < n_outputs; ++i) {
+            size_t out_id = lctx.sbatch.out_ids[i];
+            lctx.output_ids[out_id] = i;
+            if (out_id != i) {
+                sorted_output = false;
+            }
+        }
+
+        if (sorted_output) {
+            lctx.sbatch.out_ids.clear();
+        }
+
+        // set to total number of outputs in the batch, for use in llama_get_logits_ith
+        lctx.n_outputs = n_outputs;
     }
 
-    // reserve a worst case graph again
-    if (need_reserve) {
-        // TODO: extract to a function
-        // build worst-case graph
-        uint32_t n_seqs = 1; // TODO: worst-case number of sequences
-        uint32_t n_tokens = std::min(lctx.cparams.n_ctx, lctx.cparams.n_ubatch);
-        llama_token token = llama_token_bos(&lctx.model); // not actually used by llama_build_graph, but required to choose between token and embedding inputs graph
-        llama_ubatch ubatch = { true, n_tokens, n_tokens / n_seqs, n_seqs, &token, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, true, false};
-        std::vector<ggml_cgraph *> gf = llama_build_graph(lctx, ubatch, true);
-        GGML_ASSERT(lctx.sched.size() == gf.size());
+    // wait for the computation to finish (automatically done when obtaining the model output)
+    // llama_synchronize(&lctx);
 
-        bool ok = true;
-        for (size_t i = 0; i < gf.size(); ++i) {
-            ggml_backend_sched_reset(lctx.sched[i]);
-            ok = ok & ggml_backend_sched_reserve(lctx.sched[i], gf[i]);
+    // decide if we need to defrag the kv cache
+    if (cparams.causal_attn && cparams.defrag_thold >= 0.0f) {
+        const float fragmentation = kv_self.n >= 128 ? 1.0f - float(kv_self.used)/float(kv_self.n) : 0.0f;
+        // queue defragmentation for next llama_kv_cache_update
+        if (fragmentation > cparams.defrag_thold) {
+            llama_kv_cache_defrag(kv_self);
         }
-        if (!ok) {
-            LLAMA_LOG_ERROR("%s: failed to allocate compute buffers\n", __func__);
+    }
+
+    // Reset state for the next token before backend sync, to allow the CPU activities in the reset to
+    // overlap with device computation. cached graphs keep their allocation for the next step
+    if (lctx.graph_cache.cur < 0) {
+        for (size_t i = 0; i < (size_t)lctx.sched.size(); ++i) {
+            ggml_backend_sched_reset(lctx.sched[i]);
         }
     }
+
+    return 0;
 }
 
+// encode a batch of tokens by evaluating the encoder part of the transformer
 //
-// quantization
+//   - lctx:      llama context
+//   - batch:     batch to evaluate
 //
+// return 0 on success
+// return positive int on warning
+// return negative int on error
+//
+static int llama_encode_internal(
+         llama_context & lctx,
+           llama_batch   batch) {
 
-struct quantize_state_internal {
-    const llama_model                 & model;
-    const llama_model_quantize_params * params;
-
-    int n_attention_wv    = 0;
-    int n_ffn_down        = 0;
-    int n_ffn_gate        = 0;
-    int n_ffn_up          = 0;
-    int i_attention_wv    = 0;
-    int i_ffn_down        = 0;
-    int i_ffn_gate        = 0;
-    int i_ffn_up          = 0;
-
-    int n_k_quantized     = 0;
-    int n_fallback        = 0;
+    lctx.is_encoding = true;
 
-    bool has_imatrix      = false;
+    const uint32_t n_tokens = batch.n_tokens;
 
-    // used to figure out if a model shares tok_embd with the output weight
-    bool has_output       = false;
+    if (n_tokens == 0) {
+        LLAMA_LOG_ERROR("%s: n_tokens == 0\n", __func__);
+        return -1;
+    }
 
-    quantize_state_internal(const llama_model & model, const llama_model_quantize_params * params)
-        : model(model)
-        , params(params)
-        {}
-};
+    const auto & model   = lctx.model;
+    const auto & hparams = model.hparams;
+    const auto & cparams = lctx.cparams;
 
-static void llama_tensor_dequantize_internal(
-    struct ggml_tensor * tensor, std::vector<no_init<float>> & output, std::vector<std::thread> & workers,
-    const size_t nelements, const int nthread
-) {
-    if (output.size() < nelements) {
-        output.resize(nelements);
-    }
-    float * f32_output = (float *) output.data();
+    GGML_ASSERT((!batch.token && batch.embd) || (batch.token && !batch.embd)); // NOLINT
 
-    ggml_type_traits_t qtype;
-    if (ggml_is_quantized(tensor->type)) {
-        qtype = ggml_internal_get_type_traits(tensor->type);
-        if (qtype.to_float == NULL) {
-            throw std::runtime_error(format("type %s unsupported for integer quantization: no dequantization available", ggml_type_name(tensor->type)));
+    if (batch.token) {
+        for (uint32_t i = 0; i < n_tokens; ++i) {
+            if (batch.token[i] < 0 || (uint32_t)batch.token[i] >= model.vocab.n_vocab) {
+                LLAMA_LOG_ERROR("%s: invalid token[%d] = %d\n", __func__, i, batch.token[i]);
+                return -1;
+            }
         }
-    } else if (tensor->type != GGML_TYPE_F16 &&
-               tensor->type != GGML_TYPE_BF16) {
-        throw std::runtime_error(format("cannot dequantize/convert tensor type %s", ggml_type_name(tensor->type)));
     }
 
-    if (nthread < 2) {
-        if (tensor->type == GGML_TYPE_F16) {
-            ggml_fp16_to_fp32_row((ggml_fp16_t *)tensor->data, f32_output, nelements);
-        } else if (tensor->type == GGML_TYPE_BF16) {
-            ggml_bf16_to_fp32_row((ggml_bf16_t *)tensor->data, f32_output, nelements);
-        } else if (ggml_is_quantized(tensor->type)) {
-            qtype.to_float(tensor->data, f32_output, nelements);
-        } else {
-            GGML_ABORT("fatal error"); // unreachable
-        }
-        return;
+    // micro-batching is not possible for non-causal encoding, so we process the batch in a single shot
+    GGML_ASSERT(cparams.n_ubatch >= n_tokens && "encoder requires n_ubatch >= n_tokens");
+
+    if (lctx.t_compute_start_us == 0) {
+        lctx.t_compute_start_us = ggml_time_us();
     }
 
-    size_t block_size;
-    if (tensor->type == GGML_TYPE_F16 ||
-        tensor->type == GGML_TYPE_BF16) {
-        block_size = 1;
-    } else {
-        block_size = (size_t)ggml_blck_size(tensor->type);
+    lctx.n_queued_tokens += n_tokens;
+
+    const int64_t n_embd = hparams.n_embd;
+
+    lctx.sbatch.from_batch(batch, n_embd, /* simple_split */ true, /* logits_all */ true);
+
+    const llama_ubatch ubatch = lctx.sbatch.split_simple(n_tokens);
+
+    // reserve output buffer
+    if (llama_output_reserve(lctx, n_tokens) < n_tokens) {
+        LLAMA_LOG_ERROR("%s: could not reserve space for batch with %u outputs\n", __func__, n_tokens);
+        return -2;
+    };
+
+    for (uint32_t i = 0; i < n_tokens; ++i) {
+        lctx.output_ids[i] = i;
     }
 
-    size_t block_size_bytes = ggml_type_size(tensor->type);
+    lctx.inp_embd_enc = NULL;
+    lctx.n_outputs = n_tokens;
 
-    GGML_ASSERT(nelements % block_size == 0);
-    size_t nblocks = nelements / block_size;
-    size_t blocks_per_thread = nblocks / nthread;
-    size_t spare_blocks = nblocks - (blocks_per_thread * nthread); // if blocks aren't divisible by thread count
+    int n_threads = n_tokens == 1 ? cparams.n_threads : cparams.n_threads_batch;
+    ggml_threadpool_t threadpool = n_tokens == 1 ? lctx.threadpool : lctx.threadpool_batch;
 
-    size_t in_buff_offs = 0;
-    size_t out_buff_offs = 0;
+    GGML_ASSERT(n_threads > 0);
 
-    for (int tnum = 0; tnum < nthread; tnum++) {
-        size_t thr_blocks = blocks_per_thread + (tnum == nthread - 1 ? spare_blocks : 0); // num blocks for this thread
-        size_t thr_elems = thr_blocks * block_size; // number of elements for this thread
-        size_t thr_block_bytes = thr_blocks * block_size_bytes; // number of input bytes for this thread
+    ggml_backend_sched_reset(lctx.sched.at(0)); // todo.
+    ggml_backend_sched_set_eval_callback(lctx.sched.at(0), lctx.cparams.cb_eval, lctx.cparams.cb_eval_user_data); // todo.
 
-        auto compute = [qtype] (ggml_type typ, uint8_t * inbuf, float * outbuf, int nels) {
-            if (typ == GGML_TYPE_F16) {
-                ggml_fp16_to_fp32_row((ggml_fp16_t *)inbuf, outbuf, nels);
-            } else if (typ == GGML_TYPE_BF16) {
-                ggml_bf16_to_fp32_row((ggml_bf16_t *)inbuf, outbuf, nels);
-            } else {
-                qtype.to_float(inbuf, outbuf, nels);
+    std::vector<ggml_cgraph *> gf = llama_build_graph(lctx, ubatch, false);
+
+    // the output embeddings after the final encoder normalization
+    struct ggml_tensor * embd = nullptr;
+
+    // there are two cases here
+    if (llama_model_has_decoder(&lctx.model)) {
+        // first case is an encoder-decoder T5 model where embeddings are passed to decoder
+        embd = ggml_graph_node(gf.back(), -1); // todo.
+        GGML_ASSERT(strcmp(embd->name, "result_norm") == 0 && "missing result_output tensor");
+    } else {
+        // second case is an encoder-only T5 model
+        if (cparams.embeddings) {
+            // only output embeddings if required
+            embd = ggml_graph_node(gf.back(), -1);  // todo.
+            if (strcmp(embd->name, "result_embd_pooled") != 0) {
+                embd = ggml_graph_node(gf.back(), -2);  // todo.
             }
-        };
-        workers.emplace_back(compute, tensor->type, (uint8_t *) tensor->data + in_buff_offs, f32_output + out_buff_offs, thr_elems);
-        in_buff_offs += thr_block_bytes;
-        out_buff_offs += thr_elems;
+            GGML_ASSERT(strcmp(embd->name, "result_embd_pooled") == 0 && "missing embeddings tensor");
+        }
     }
-    for (auto & w : workers) { w.join(); }
-    workers.clear();
-}
 
-static ggml_type llama_tensor_get_type(quantize_state_internal & qs, ggml_type new_type, const ggml_tensor * tensor, llama_ftype ftype) {
-    const std::string name = ggml_get_name(tensor);
+    ggml_backend_sched_alloc_graph(lctx.sched.at(0), gf.at(0)); // todo.
 
-    // TODO: avoid hardcoded tensor names - use the TN_* constants
-    const llm_arch arch = qs.model.arch;
-    const auto       tn = LLM_TN(arch);
+    llama_set_inputs(lctx, ubatch);
 
-    auto use_more_bits = [](int i_layer, int n_layers) -> bool {
-        return i_layer < n_layers/8 || i_layer >= 7*n_layers/8 || (i_layer - n_layers/8)%3 == 2;
-    };
-    const int n_expert = std::max(1, (int)qs.model.hparams.n_expert);
-    auto layer_info = [n_expert] (int i_layer, int n_layer, const char * name) {
-        if (n_expert > 1) {
-            // Believe it or not, "experts" in the FFN of Mixtral-8x7B are not consecutive, but occasionally randomly
-            // sprinkled in the model. Hence, simply dividing i_ffn_down by n_expert does not work
-            // for getting the current layer as I initially thought, and we need to resort to parsing the
-            // tensor name.
-            if (sscanf(name, "blk.%d.", &i_layer) != 1) {
-                throw std::runtime_error(format("Failed to determine layer for tensor %s", name));
+    llama_graph_compute(lctx, gf.at(0), lctx.sched.at(0), n_threads, threadpool); // todo.
+
+    // extract embeddings
+    if (embd) {
+        ggml_backend_t backend_embd = ggml_backend_sched_get_tensor_backend(lctx.sched.at(0), embd); // todo.
+        GGML_ASSERT(backend_embd != nullptr);
+
+        if (llama_model_has_decoder(&lctx.model)) {
+            lctx.embd_enc.resize(n_tokens*n_embd);
+            float * embd_out = lctx.embd_enc.data();
+
+            ggml_backend_tensor_get_async(backend_embd, embd, embd_out, 0, n_tokens*n_embd*sizeof(float));
+            GGML_ASSERT(!ubatch.equal_seqs); // TODO: handle equal splits
+
+            // remember the sequence ids used during the encoding - needed for cross attention later
+            lctx.seq_ids_enc.resize(n_tokens);
+            for (uint32_t i = 0; i < n_tokens; i++) {
+                for (int s = 0; s < ubatch.n_seq_id[i]; s++) {
+                    llama_seq_id seq_id = ubatch.seq_id[i][s];
+                    lctx.seq_ids_enc[i].insert(seq_id);
+                }
             }
-            if (i_layer < 0 || i_layer >= n_layer) {
-                throw std::runtime_error(format("Bad layer %d for tensor %s. Must be in [0, %d)", i_layer, name, n_layer));
+        } else {
+            GGML_ASSERT(lctx.embd != nullptr);
+
+            switch (cparams.pooling_type) {
+                case LLAMA_POOLING_TYPE_NONE:
+                    {
+                        // extract token embeddings
+                        GGML_ASSERT(lctx.embd != nullptr);
+                        float * embd_out = lctx.embd;
+
+                        GGML_ASSERT(n_tokens*n_embd <= (int64_t) lctx.embd_size);
+                        ggml_backend_tensor_get_async(backend_embd, embd, embd_out, 0, n_tokens*n_embd*sizeof(float));
+                    } break;
+                case LLAMA_POOLING_TYPE_MEAN:
+                case LLAMA_POOLING_TYPE_CLS:
+                case LLAMA_POOLING_TYPE_LAST:
+                    {
+                        // extract sequence embeddings
+                        auto & embd_seq_out = lctx.embd_seq;
+                        embd_seq_out.clear();
+
+                        GGML_ASSERT(!ubatch.equal_seqs); // TODO: handle equal splits
+
+                        for (uint32_t i = 0; i < n_tokens; i++) {
+                            const llama_seq_id seq_id = ubatch.seq_id[i][0];
+                            if (embd_seq_out.find(seq_id) != embd_seq_out.end()) {
+                                continue;
+                            }
+                            embd_seq_out[seq_id].resize(n_embd);
+                            ggml_backend_tensor_get_async(backend_embd, embd, embd_seq_out[seq_id].data(), (n_embd*seq_id)*sizeof(float), n_embd*sizeof(float));
+                        }
+                    } break;
+                case LLAMA_POOLING_TYPE_RANK:
+                    {
+                        // TODO: this likely should be the same logic as in llama_decoder_internal, but better to
+                        //       wait for an encoder model that requires this pooling type in order to test it
+                        //       https://github.com/ggerganov/llama.cpp/pull/9510
+                        GGML_ABORT("RANK pooling not implemented yet");
+                    }
+                case LLAMA_POOLING_TYPE_UNSPECIFIED:
+                    {
+                        GGML_ABORT("unknown pooling type");
+                    }
             }
         }
-        return std::make_pair(i_layer, n_layer);
-    };
+    }
 
-    // for arches that share the same tensor between the token embeddings and the output, we quantize the token embeddings
-    // with the quantization of the output tensor
-    if (name == tn(LLM_TENSOR_OUTPUT, "weight") || (!qs.has_output && name == tn(LLM_TENSOR_TOKEN_EMBD, "weight"))) {
-        if (qs.params->output_tensor_type < GGML_TYPE_COUNT) {
-            new_type = qs.params->output_tensor_type;
-        } else {
-            int nx = tensor->ne[0];
-            if (arch == LLM_ARCH_FALCON || nx % QK_K != 0) {
-                new_type = GGML_TYPE_Q8_0;
-            }
-            else if (ftype == LLAMA_FTYPE_MOSTLY_IQ2_XXS || ftype == LLAMA_FTYPE_MOSTLY_IQ2_XS || ftype == LLAMA_FTYPE_MOSTLY_IQ3_XXS ||
-                     ftype == LLAMA_FTYPE_MOSTLY_IQ1_S   || ftype == LLAMA_FTYPE_MOSTLY_IQ2_S  || ftype == LLAMA_FTYPE_MOSTLY_IQ2_M   ||
-                     ftype == LLAMA_FTYPE_MOSTLY_IQ1_M) {
+    // Reset state for the next token before backend sync, to allow the CPU activities in the reset to
+    // overlap with device computation.
+    ggml_backend_sched_reset(lctx.sched.at(0)); // todo.
+
+    return 0;
+}
+
+// find holes from the beginning of the KV cache and fill them by moving data from the end of the cache
+static void llama_kv_cache_defrag_internal(struct llama_context & lctx) {
+    auto & kv_self = lctx.kv_self;
+
+    const auto & hparams = lctx.model.hparams;
+
+    const uint32_t n_layer = hparams.n_layer;
+
+    const uint32_t n_kv   = llama_kv_cache_cell_max(kv_self);
+    const uint32_t n_used = kv_self.used;
+
+    assert(n_used <= n_kv);
+
+    //const int64_t t_start = ggml_time_us();
+
+    // number of cells moved
+    uint32_t n_moves = 0;
+
+    // each move requires 6*n_layer tensors (see build_defrag)
+    //   - source view, destination view, copy operation
+    //   - x2 for keys and values
+    //const uint32_t max_moves = llama_model_max_nodes(model)/(6*n_layer);
+    // TODO: tmp fix https://github.com/ggerganov/llama.cpp/issues/6685#issuecomment-2057579516
+    const uint32_t max_moves = (llama_model_max_nodes(lctx.model, 1) - 2*n_layer)/(6*n_layer);
+
+    // determine which KV cells to move where
+    //
+    //  cell i moves to ids[i]
+    //
+    //  if ids[i] == i || ids[i] == n_kv, then cell i is not moved
+    //
+    std::vector<uint32_t> ids(n_kv, n_kv);
+
+    for (uint32_t i0 = 0; i0 < n_used; ++i0) {
+        const auto & cell0 = kv_self.cells[i0];
+
+        if (!cell0.is_empty()) {
+            ids[i0] = i0;
+
+            continue;
+        }
+
+        // found a hole - fill it with data from the end of the cache
+
+        uint32_t nh = 1;
+
+        // determine the size of the hole
+        while (i0 + nh < n_used && kv_self.cells[i0 + nh].is_empty()) {
+            nh++;
+        }
+
+        uint32_t nf = 0;
+        uint32_t is = n_kv - 1;
+
+        // starting from the end, find nh non-empty cells
+        for (; is > i0; --is) {
+            const auto & cell1 = kv_self.cells[is];
+
+            if (cell1.is_empty() || ids[is] != n_kv) {
+                continue;
+            }
+
+            // non-empty cell which is not yet moved
+            nf++;
+
+            if (nf == nh) {
+                break;
+            }
+        }
+
+        // this can only happen if `n_used` is not accurate, which would be a bug
+        GGML_ASSERT(nf == nh && "KV defrag bug: nf != nh");
+
+        nf = 0;
+
+        uint32_t i1 = is;
+
+        // are we moving a continuous block of memory?
+        bool cont = false;
+
+        // should we stop searching for the next move?
+        bool stop = false;
+
+        // go back and move the nf cells to the hole
+        for (; i1 < n_kv; ++i1) {
+            auto & cell1 = kv_self.cells[i1];
+
+            if (cell1.is_empty() || ids[i1] != n_kv) {
+                if (n_moves == max_moves) {
+                    stop = true;
+                    break;
+                }
+
+                cont = false;
+                continue;
+            }
+
+            // this cell goes to (i0 + nf)
+            ids[i1] = i0 + nf;
+
+            // move the cell meta data
+            kv_self.cells[i0 + nf] = cell1;
+
+            // clear the old cell and move the head there
+            cell1 = llama_kv_cell();
+            kv_self.head = n_used;
+
+            if (!cont) {
+                n_moves++;
+                cont = true;
+            }
+
+            nf++;
+
+            if (nf == nh) {
+                break;
+            }
+        }
+
+        if (stop || n_moves == max_moves) {
+            break;
+        }
+
+        //LLAMA_LOG_INFO("(tmp log) KV defrag: move [%u, %u) to [%u, %u)\n", is, i1 + 1, i0, i0 + nh);
+
+        i0 += nh - 1;
+    }
+
+    if (n_moves == 0) {
+        return;
+    }
+
+    //LLAMA_LOG_INFO("(tmp log) KV defrag cell moves: %u\n", n_moves);
+
+    //LLAMA_LOG_INFO("expected gf nodes: %u\n", 6*n_moves*n_layer);
+
+#if 0
+    // CPU defrag
+    //
+    // TODO: optimizations are possible:
+    //       - multiple threads
+    //       - avoid copying to the host memory when already there
+    //
+    // likely not worth the effort, as we have ggml_graph based defrag
+    //
+
+    const uint32_t n_embd_k_gqa = hparams.n_embd_k_gqa();
+    const uint32_t n_embd_v_gqa = hparams.n_embd_v_gqa();
+
+    const uint32_t kv_size = kv_self.size;
+
+    std::vector<uint8_t> buf_k;
+    std::vector<uint8_t> buf_v;
+
+    for (uint32_t il = 0; il < n_layer; ++il) {
+        const size_t k_size_row = ggml_row_size(kv_self.k_l[il]->type, n_embd_k_gqa);
+        const size_t k_size     = ggml_row_size(kv_self.k_l[il]->type, n_embd_k_gqa*kv_size);
+
+        const size_t v_size_el = ggml_type_size(kv_self.v_l[il]->type);
+        const size_t v_size    = ggml_row_size (kv_self.v_l[il]->type, n_embd_v_gqa*kv_size);
+
+        buf_k.resize(k_size);
+        buf_v.resize(v_size);
+
+        ggml_backend_tensor_get(kv_self.k_l[il], buf_k.data(), 0, buf_k.size());
+        ggml_backend_tensor_get(kv_self.v_l[il], buf_v.data(), 0, buf_v.size());
+
+        // batch move [i, i+nm) to [id, id+nm)
+        // note: cells can move only to a lower index
+        for (uint32_t i = 0; i < n_kv; ++i) {
+            const uint32_t id = ids[i];
+
+            if (i == id || id == n_kv) {
+                continue;
+            }
+
+            uint32_t nm = 1;
+
+            while (i + nm < n_kv && ids[i + nm] == id + nm) {
+                nm++;
+            }
+
+            // move keys
+            {
+                const int64_t os =  i*k_size_row;
+                const int64_t od = id*k_size_row;
+
+                memcpy(buf_k.data() + od, buf_k.data() + os, nm*k_size_row);
+            }
+
+            // move values (note: they are transposed)
+            {
+                const int64_t os =  i;
+                const int64_t od = id;
+
+                for (uint32_t j = 0; j < n_embd_v_gqa; ++j) {
+                    memcpy(buf_v.data() + (od + j*kv_size)*v_size_el, buf_v.data() + (os + j*kv_size)*v_size_el, nm*v_size_el);
+                }
+            }
+
+            i += nm - 1;
+        }
+
+        ggml_backend_tensor_set(kv_self.k_l[il], buf_k.data(), 0, buf_k.size());
+        ggml_backend_tensor_set(kv_self.v_l[il], buf_v.data(), 0, buf_v.size());
+    }
+#else
+    // ggml_graph defrag
+
+    ggml_backend_sched_reset(lctx.sched.at(0)); // todo.
+
+    ggml_cgraph * gf = llama_build_graph_defrag(lctx, ids);
+
+    llama_graph_compute(lctx, gf, lctx.sched.at(0), lctx.cparams.n_threads, lctx.threadpool); // todo.
+#endif
+
+    //const int64_t t_end = ggml_time_us();
+
+    //LLAMA_LOG_INFO("(tmp log) KV defrag time: %.3f ms\n", (t_end - t_start)/1000.0);
+}
+
+static void llama_kv_cache_update_internal(struct llama_context & lctx) {
+    bool need_reserve = false;
+
+    // apply K-shift if needed
+    if (lctx.model.hparams.rope_type != LLAMA_ROPE_TYPE_NONE && lctx.kv_self.has_shift) {
+        if (lctx.model.arch == LLM_ARCH_DEEPSEEK2) { // not supported due to MLA
+            GGML_ABORT("Deepseek2 does not support K-shift");
+        }
+
+        auto * sched = lctx.sched.at(0);
+
+        ggml_backend_sched_reset(sched);
+
+        ggml_cgraph * gf = llama_build_graph_k_shift(lctx);
+
+        ggml_backend_sched_alloc_graph(sched, gf);
+
+        llama_set_k_shift(lctx);
+
+        llama_graph_compute(lctx, gf, sched, lctx.cparams.n_threads, lctx.threadpool);
+        
+        need_reserve = true;
+
+        {
+            auto & kv_self = lctx.kv_self;
+
+            kv_self.has_shift = false;
+
+            for (uint32_t i = 0; i < kv_self.size; ++i) {
+                kv_self.cells[i].delta = 0;
+            }
+        }
+    }
+
+    // defragment the KV cache if needed
+    if (lctx.kv_self.do_defrag) {
+        llama_kv_cache_defrag_internal(lctx);
+
+        need_reserve = true;
+
+        lctx.kv_self.do_defrag = false;
+    }
+
+    // the previous device shifted or moved the same cells, which its replica here does not follow
+    if (need_reserve && lctx.comm.replica != nullptr) {
+        lctx.kv_replica.valid = false;
+    }
+
+    // reserve a worst case graph again
+    if (need_reserve) {
+        // TODO: extract to a function
+        // build worst-case graph
+        uint32_t n_seqs = 1; // TODO: worst-case number of sequences
+        uint32_t n_tokens = std::min(lctx.cparams.n_ctx, lctx.cparams.n_ubatch);
+        llama_token token = llama_token_bos(&lctx.model); // not actually used by llama_build_graph, but required to choose between token and embedding inputs graph
+        llama_ubatch ubatch = { true, n_tokens, n_tokens / n_seqs, n_seqs, &token, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, true, false};
+        std::vector<ggml_cgraph *> gf = llama_build_graph(lctx, ubatch, true);
+        GGML_ASSERT(lctx.sched.size() == gf.size());
+
+        bool ok = true;
+        for (size_t i = 0; i < gf.size(); ++i) {
+            ggml_backend_sched_reset(lctx.sched[i]);
+            ok = ok & ggml_backend_sched_reserve(lctx.sched[i], gf[i]);
+        }
+        if (!ok) {
+            LLAMA_LOG_ERROR("%s: failed to allocate compute buffers\n", __func__);
+        }
+    }
+}
+
+//
+// quantization
+//
+
+struct quantize_state_internal {
+    const llama_model                 & model;
+    const llama_model_quantize_params * params;
+
+    int n_attention_wv    = 0;
+    int n_ffn_down        = 0;
+    int n_ffn_gate        = 0;
+    int n_ffn_up          = 0;
+    int i_attention_wv    = 0;
+    int i_ffn_down        = 0;
+    int i_ffn_gate        = 0;
+    int i_ffn_up          = 0;
+
+    int n_k_quantized     = 0;
+    int n_fallback        = 0;
+
+    bool has_imatrix      = false;
+
+    // used to figure out if a model shares tok_embd with the output weight
+    bool has_output       = false;
+
+    quantize_state_internal(const llama_model & model, const llama_model_quantize_params * params)
+        : model(model)
+        , params(params)
+        {}
+};
+
+static void llama_tensor_dequantize_internal(
+    struct ggml_tensor * tensor, std::vector<no_init<float>> & output, std::vector<std::thread> & workers,
+    const size_t nelements, const int nthread
+) {
+    if (output.size() < nelements) {
+        output.resize(nelements);
+    }
+    float * f32_output = (float *) output.data();
+
+    ggml_type_traits_t qtype;
+    if (ggml_is_quantized(tensor->type)) {
+        qtype = ggml_internal_get_type_traits(tensor->type);
+        if (qtype.to_float == NULL) {
+            throw std::runtime_error(format("type %s unsupported for integer quantization: no dequantization available", ggml_type_name(tensor->type)));
+        }
+    } else if (tensor->type != GGML_TYPE_F16 &&
+               tensor->type != GGML_TYPE_BF16) {
+        throw std::runtime_error(format("cannot dequantize/convert tensor type %s", ggml_type_name(tensor->type)));
+    }
+
+    if (nthread < 2) {
+        if (tensor->type == GGML_TYPE_F16) {
+            ggml_fp16_to_fp32_row((ggml_fp16_t *)tensor->data, f32_output, nelements);
+        } else if (tensor->type == GGML_TYPE_BF16) {
+            ggml_bf16_to_fp32_row((ggml_bf16_t *)tensor->data, f32_output, nelements);
+        } else if (ggml_is_quantized(tensor->type)) {
+            qtype.to_float(tensor->data, f32_output, nelements);
+        } else {
+            GGML_ABORT("fatal error"); // unreachable
+        }
+        return;
+    }
+
+    size_t block_size;
+    if (tensor->type == GGML_TYPE_F16 ||
+        tensor->type == GGML_TYPE_BF16) {
+        block_size = 1;
+    } else {
+        block_size = (size_t)ggml_blck_size(tensor->type);
+    }
+
+    size_t block_size_bytes = ggml_type_size(tensor->type);
+
+    GGML_ASSERT(nelements % block_size == 0);
+    size_t nblocks = nelements / block_size;
+    size_t blocks_per_thread = nblocks / nthread;
+    size_t spare_blocks = nblocks - (blocks_per_thread * nthread); // if blocks aren't divisible by thread count
+
+    size_t in_buff_offs = 0;
+    size_t out_buff_offs = 0;
+
+    for (int tnum = 0; tnum < nthread; tnum++) {
+        size_t thr_blocks = blocks_per_thread + (tnum == nthread - 1 ? spare_blocks : 0); // num blocks for this thread
+        size_t thr_elems = thr_blocks * block_size; // number of elements for this thread
+        size_t thr_block_bytes = thr_blocks * block_size_bytes; // number of input bytes for this thread
+
+        auto compute = [qtype] (ggml_type typ, uint8_t * inbuf, float * outbuf, int nels) {
+            if (typ == GGML_TYPE_F16) {
+                ggml_fp16_to_fp32_row((ggml_fp16_t *)inbuf, outbuf, nels);
+            } else if (typ == GGML_TYPE_BF16) {
+                ggml_bf16_to_fp32_row((ggml_bf16_t *)inbuf, outbuf, nels);
+            } else {
+                qtype.to_float(inbuf, outbuf, nels);
+            }
+        };
+        workers.emplace_back(compute, tensor->type, (uint8_t *) tensor->data + in_buff_offs, f32_output + out_buff_offs, thr_elems);
+        in_buff_offs += thr_block_bytes;
+        out_buff_offs += thr_elems;
+    }
+    for (auto & w : workers) { w.join(); }
+    workers.clear();
+}
+
+static ggml_type llama_tensor_get_type(quantize_state_internal & qs, ggml_type new_type, const ggml_tensor * tensor, llama_ftype ftype) {
+    const std::string name = ggml_get_name(tensor);
+
+    // TODO: avoid hardcoded tensor names - use the TN_* constants
+    const llm_arch arch = qs.model.arch;
+    const auto       tn = LLM_TN(arch);
+
+    auto use_more_bits = [](int i_layer, int n_layers) -> bool {
+        return i_layer < n_layers/8 || i_layer >= 7*n_layers/8 || (i_layer - n_layers/8)%3 == 2;
+    };
+    const int n_expert = std::max(1, (int)qs.model.hparams.n_expert);
+    auto layer_info = [n_expert] (int i_layer, int n_layer, const char * name) {
+        if (n_expert > 1) {
+            // Believe it or not, "experts" in the FFN of Mixtral-8x7B are not consecutive, but occasionally randomly
+            // sprinkled in the model. Hence, simply dividing i_ffn_down by n_expert does not work
+            // for getting the current layer as I initially thought, and we need to resort to parsing the
+            // tensor name.
+            if (sscanf(name, "blk.%d.", &i_layer) != 1) {
+                throw std::runtime_error(format("Failed to determine layer for tensor %s", name));
+            }
+            if (i_layer < 0 || i_layer >= n_layer) {
+                throw std::runtime_error(format("Bad layer %d for tensor %s. Must be in [0, %d)", i_layer, name, n_layer));
+            }
+        }
+        return std::make_pair(i_layer, n_layer);
+    };
+
+    // for arches that share the same tensor between the token embeddings and the output, we quantize the token embeddings
+    // with the quantization of the output tensor
+    if (name == tn(LLM_TENSOR_OUTPUT, "weight") || (!qs.has_output && name == tn(LLM_TENSOR_TOKEN_EMBD, "weight"))) {
+        if (qs.params->output_tensor_type < GGML_TYPE_COUNT) {
+            new_type = qs.params->output_tensor_type;
+        } else {
+            int nx = tensor->ne[0];
+            if (arch == LLM_ARCH_FALCON || nx % QK_K != 0) {
+                new_type = GGML_TYPE_Q8_0;
+            }
+            else if (ftype == LLAMA_FTYPE_MOSTLY_IQ2_XXS || ftype == LLAMA_FTYPE_MOSTLY_IQ2_XS || ftype == LLAMA_FTYPE_MOSTLY_IQ3_XXS ||
+                     ftype == LLAMA_FTYPE_MOSTLY_IQ1_S   || ftype == LLAMA_FTYPE_MOSTLY_IQ2_S  || ftype == LLAMA_FTYPE_MOSTLY_IQ2_M   ||
+                     ftype == LLAMA_FTYPE_MOSTLY_IQ1_M) {
                 new_type = GGML_TYPE_Q5_K;
             }
             else if (new_type != GGML_TYPE_Q8_0) {
@@ -19339,1549 +22142,2792 @@ static ggml_type llama_tensor_get_type(quantize_state_internal & qs, ggml_type n
             else new_type = ftype == LLAMA_FTYPE_MOSTLY_IQ2_S || ftype == LLAMA_FTYPE_MOSTLY_IQ2_M ? GGML_TYPE_IQ3_S : GGML_TYPE_Q2_K;
             ++qs.i_attention_wv;
         }
-        else if (qs.model.hparams.n_expert == 8 && name.find("attn_k.weight") != std::string::npos) {
-            new_type = GGML_TYPE_Q4_K;
+        else if (qs.model.hparams.n_expert == 8 && name.find("attn_k.weight") != std::string::npos) {
+            new_type = GGML_TYPE_Q4_K;
+        }
+        else if (name.find("ffn_down") != std::string::npos) {
+            if (qs.i_ffn_down < qs.n_ffn_down/8) {
+                new_type = ftype == LLAMA_FTYPE_MOSTLY_IQ2_S || ftype == LLAMA_FTYPE_MOSTLY_IQ2_M ? GGML_TYPE_IQ3_S : GGML_TYPE_Q2_K;
+            }
+            ++qs.i_ffn_down;
+        }
+        else if (name.find("attn_output.weight") != std::string::npos) {
+            if (qs.model.hparams.n_expert == 8) {
+                new_type = GGML_TYPE_Q5_K;
+            } else {
+                if (ftype == LLAMA_FTYPE_MOSTLY_IQ1_S || ftype == LLAMA_FTYPE_MOSTLY_IQ1_M) new_type = GGML_TYPE_IQ2_XXS;
+                else if (ftype == LLAMA_FTYPE_MOSTLY_IQ2_S || ftype == LLAMA_FTYPE_MOSTLY_IQ2_M) new_type = GGML_TYPE_IQ3_S;
+            }
+        }
+    } else if (name.find("attn_v.weight") != std::string::npos) {
+        if      (ftype == LLAMA_FTYPE_MOSTLY_Q2_K) {
+            new_type = qs.model.hparams.n_gqa() >= 4 ? GGML_TYPE_Q4_K : GGML_TYPE_Q3_K;
+        }
+        else if (ftype == LLAMA_FTYPE_MOSTLY_Q2_K_S && qs.model.hparams.n_gqa() >= 4) {
+            new_type = GGML_TYPE_Q4_K;
+        }
+        else if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_XXS) {
+            new_type = qs.model.hparams.n_gqa() >= 4 ? GGML_TYPE_Q4_K : !qs.has_imatrix ? GGML_TYPE_IQ3_S : GGML_TYPE_IQ3_XXS;
+        }
+        else if ((ftype == LLAMA_FTYPE_MOSTLY_IQ3_XS || ftype == LLAMA_FTYPE_MOSTLY_IQ3_S) && qs.model.hparams.n_gqa() >= 4) {
+            new_type = GGML_TYPE_Q4_K;
+        }
+        else if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_M) {
+            new_type = GGML_TYPE_Q4_K;
+        }
+        else if (ftype == LLAMA_FTYPE_MOSTLY_Q3_K_M) {
+            new_type = qs.i_attention_wv < 2 ? GGML_TYPE_Q5_K : GGML_TYPE_Q4_K;
+        }
+        else if (ftype == LLAMA_FTYPE_MOSTLY_Q3_K_L) new_type = GGML_TYPE_Q5_K;
+        else if ((ftype == LLAMA_FTYPE_MOSTLY_IQ4_NL || ftype == LLAMA_FTYPE_MOSTLY_IQ4_XS) && qs.model.hparams.n_gqa() >= 4) {
+            new_type = GGML_TYPE_Q5_K;
+        }
+        else if ((ftype == LLAMA_FTYPE_MOSTLY_Q4_K_M || ftype == LLAMA_FTYPE_MOSTLY_Q5_K_M) &&
+                use_more_bits(qs.i_attention_wv, qs.n_attention_wv)) new_type = GGML_TYPE_Q6_K;
+        else if (ftype == LLAMA_FTYPE_MOSTLY_Q4_K_S && qs.i_attention_wv < 4) new_type = GGML_TYPE_Q5_K;
+        if (qs.model.type == MODEL_70B) {
+            // In the 70B model we have 8 heads sharing the same attn_v weights. As a result, the attn_v.weight tensor is
+            // 8x smaller compared to attn_q.weight. Hence, we can get a nice boost in quantization accuracy with
+            // nearly negligible increase in model size by quantizing this tensor with more bits:
+            if (new_type == GGML_TYPE_Q3_K || new_type == GGML_TYPE_Q4_K) new_type = GGML_TYPE_Q5_K;
+        }
+        if (qs.model.hparams.n_expert == 8) {
+            // for the 8-expert model, bumping this to Q8_0 trades just ~128MB
+            // TODO: explore better strategies
+            new_type = GGML_TYPE_Q8_0;
+        }
+        ++qs.i_attention_wv;
+    } else if (name.find("attn_k.weight") != std::string::npos) {
+        if (qs.model.hparams.n_expert == 8) {
+            // for the 8-expert model, bumping this to Q8_0 trades just ~128MB
+            // TODO: explore better strategies
+            new_type = GGML_TYPE_Q8_0;
+        }
+        else if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_XS) {
+            new_type = GGML_TYPE_IQ3_XXS;
+        }
+        else if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_XXS) {
+            new_type = GGML_TYPE_IQ2_S;
+        }
+    } else if (name.find("attn_q.weight") != std::string::npos) {
+        if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_XS) {
+            new_type = GGML_TYPE_IQ3_XXS;
+        }
+        else if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_XXS) {
+            new_type = GGML_TYPE_IQ2_S;
+        }
+    } else if (name.find("ffn_down") != std::string::npos) {
+        auto info = layer_info(qs.i_ffn_down, qs.n_ffn_down, name.c_str());
+        int i_layer = info.first, n_layer = info.second;
+        if      (ftype == LLAMA_FTYPE_MOSTLY_Q2_K) new_type = GGML_TYPE_Q3_K;
+        else if (ftype == LLAMA_FTYPE_MOSTLY_Q2_K_S) {
+            if (i_layer < n_layer/8) new_type = GGML_TYPE_Q4_K;
+        }
+        else if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_XXS && !qs.has_imatrix) {
+            new_type = i_layer < n_layer/8 ? GGML_TYPE_Q4_K : GGML_TYPE_Q3_K;
+        }
+        else if (ftype == LLAMA_FTYPE_MOSTLY_Q3_K_M) {
+            new_type = i_layer < n_layer/16 ? GGML_TYPE_Q5_K
+                     : arch != LLM_ARCH_FALCON || use_more_bits(i_layer, n_layer) ? GGML_TYPE_Q4_K
+                     : GGML_TYPE_Q3_K;
+        }
+        else if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_M && (i_layer < n_layer/8 ||
+                    (qs.model.hparams.n_expert == 8 && use_more_bits(i_layer, n_layer)))) {
+            new_type = GGML_TYPE_Q4_K;
+        }
+        else if (ftype == LLAMA_FTYPE_MOSTLY_Q3_K_L) {
+            new_type = arch == LLM_ARCH_FALCON ? GGML_TYPE_Q4_K : GGML_TYPE_Q5_K;
+        }
+        else if (ftype == LLAMA_FTYPE_MOSTLY_Q4_K_M) {
+            if (arch == LLM_ARCH_FALCON) {
+                new_type = i_layer < n_layer/16 ? GGML_TYPE_Q6_K :
+                           use_more_bits(i_layer, n_layer) ? GGML_TYPE_Q5_K : GGML_TYPE_Q4_K;
+            } else {
+                if (use_more_bits(i_layer, n_layer)) new_type = GGML_TYPE_Q6_K;
+            }
+        }
+        else if (i_layer < n_layer/8 && (ftype == LLAMA_FTYPE_MOSTLY_IQ4_NL || ftype == LLAMA_FTYPE_MOSTLY_IQ4_XS) && !qs.has_imatrix) {
+            new_type = GGML_TYPE_Q5_K;
+        }
+        else if (ftype == LLAMA_FTYPE_MOSTLY_Q5_K_M && use_more_bits(i_layer, n_layer)) new_type = GGML_TYPE_Q6_K;
+        else if (ftype == LLAMA_FTYPE_MOSTLY_Q4_K_S && arch != LLM_ARCH_FALCON && i_layer < n_layer/8) {
+            new_type = GGML_TYPE_Q5_K;
+        }
+        else if ((ftype == LLAMA_FTYPE_MOSTLY_Q4_0 || ftype == LLAMA_FTYPE_MOSTLY_Q5_0)
+                && qs.has_imatrix && i_layer < n_layer/8) {
+            // Guard against craziness in the first few ffn_down layers that can happen even with imatrix for Q4_0/Q5_0.
+            // We only do it when an imatrix is provided because a) we want to make sure that one can always get the
+            // same quantization as before imatrix stuff, and b) Q4_1/Q5_1 do go crazy on ffn_down without an imatrix.
+            new_type = ftype == LLAMA_FTYPE_MOSTLY_Q4_0 ? GGML_TYPE_Q4_1 : GGML_TYPE_Q5_1;
+        }
+        ++qs.i_ffn_down;
+    } else if (name.find("attn_output.weight") != std::string::npos) {
+        if (arch != LLM_ARCH_FALCON) {
+            if (qs.model.hparams.n_expert == 8) {
+                if (ftype == LLAMA_FTYPE_MOSTLY_Q2_K   || ftype == LLAMA_FTYPE_MOSTLY_IQ3_XS || ftype == LLAMA_FTYPE_MOSTLY_IQ3_XXS ||
+                    ftype == LLAMA_FTYPE_MOSTLY_Q3_K_S || ftype == LLAMA_FTYPE_MOSTLY_Q3_K_M  || ftype == LLAMA_FTYPE_MOSTLY_IQ4_NL  ||
+                    ftype == LLAMA_FTYPE_MOSTLY_Q4_K_S || ftype == LLAMA_FTYPE_MOSTLY_Q4_K_M  || ftype == LLAMA_FTYPE_MOSTLY_IQ3_S  ||
+                    ftype == LLAMA_FTYPE_MOSTLY_IQ3_M  || ftype == LLAMA_FTYPE_MOSTLY_IQ4_XS) {
+                    new_type = GGML_TYPE_Q5_K;
+                }
+            } else {
+                if      (ftype == LLAMA_FTYPE_MOSTLY_Q2_K   ) new_type = GGML_TYPE_Q3_K;
+                else if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_XXS) new_type = GGML_TYPE_IQ3_S;
+                else if (ftype == LLAMA_FTYPE_MOSTLY_Q3_K_M ) new_type = GGML_TYPE_Q4_K;
+                else if (ftype == LLAMA_FTYPE_MOSTLY_Q3_K_L ) new_type = GGML_TYPE_Q5_K;
+                else if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_M  ) new_type = GGML_TYPE_Q4_K;
+            }
+        } else {
+            if (ftype == LLAMA_FTYPE_MOSTLY_Q3_K_L) new_type = GGML_TYPE_Q4_K;
+        }
+    }
+    else if (name.find("attn_qkv.weight") != std::string::npos) {
+        if (ftype == LLAMA_FTYPE_MOSTLY_Q3_K_M || ftype == LLAMA_FTYPE_MOSTLY_Q3_K_L || ftype == LLAMA_FTYPE_MOSTLY_IQ3_M) {
+            new_type = GGML_TYPE_Q4_K;
+        }
+        else if (ftype == LLAMA_FTYPE_MOSTLY_Q4_K_M) new_type = GGML_TYPE_Q5_K;
+        else if (ftype == LLAMA_FTYPE_MOSTLY_Q5_K_M) new_type = GGML_TYPE_Q6_K;
+    }
+    else if (name.find("ffn_gate") != std::string::npos) {
+        auto info = layer_info(qs.i_ffn_gate, qs.n_ffn_gate, name.c_str());
+        int i_layer = info.first, n_layer = info.second;
+        if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_XS && (i_layer >= n_layer/8 && i_layer < 7*n_layer/8)) {
+            new_type = GGML_TYPE_IQ3_XXS;
+        }
+        ++qs.i_ffn_gate;
+    }
+    else if (name.find("ffn_up") != std::string::npos) {
+        auto info = layer_info(qs.i_ffn_up, qs.n_ffn_up, name.c_str());
+        int i_layer = info.first, n_layer = info.second;
+        if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_XS && (i_layer >= n_layer/8 && i_layer < 7*n_layer/8)) {
+            new_type = GGML_TYPE_IQ3_XXS;
         }
-        else if (name.find("ffn_down") != std::string::npos) {
-            if (qs.i_ffn_down < qs.n_ffn_down/8) {
-                new_type = ftype == LLAMA_FTYPE_MOSTLY_IQ2_S || ftype == LLAMA_FTYPE_MOSTLY_IQ2_M ? GGML_TYPE_IQ3_S : GGML_TYPE_Q2_K;
-            }
-            ++qs.i_ffn_down;
+        ++qs.i_ffn_up;
+    }
+
+    //    if (ftype == LLAMA_FTYPE_MOSTLY_Q2_K) new_type = GGML_TYPE_Q3_K;
+    //}
+    // IK: let's remove this, else Q2_K is almost the same as Q3_K_S
+    //else if (name.find("ffn_gate") != std::string::npos || name.find("ffn_up") != std::string::npos) {
+    //    if (ftype == LLAMA_FTYPE_MOSTLY_Q2_K) new_type = GGML_TYPE_Q3_K;
+    //}
+    // This can be used to reduce the size of the Q5_K_S model.
+    // The associated PPL increase is fully in line with the size reduction
+    //else {
+    //    if (ftype == LLAMA_FTYPE_MOSTLY_Q5_K_S) new_type = GGML_TYPE_Q4_K;
+    //}
+    bool convert_incompatible_tensor = false;
+    if (new_type == GGML_TYPE_Q2_K    || new_type == GGML_TYPE_Q3_K    || new_type == GGML_TYPE_Q4_K   ||
+        new_type == GGML_TYPE_Q5_K    || new_type == GGML_TYPE_Q6_K    || new_type == GGML_TYPE_IQ4_XS ||
+        new_type == GGML_TYPE_IQ2_XS  || new_type == GGML_TYPE_IQ2_XXS || new_type == GGML_TYPE_IQ2_S  ||
+        new_type == GGML_TYPE_IQ3_XXS || new_type == GGML_TYPE_IQ1_S   || new_type == GGML_TYPE_IQ3_S  ||
+        new_type == GGML_TYPE_IQ1_M) {
+        int nx = tensor->ne[0];
+        int ny = tensor->ne[1];
+        if (nx % QK_K != 0) {
+            LLAMA_LOG_WARN("\n\n%s : tensor cols %d x %d are not divisible by %d, required for %s", __func__, nx, ny, QK_K, ggml_type_name(new_type));
+            convert_incompatible_tensor = true;
+        } else {
+            ++qs.n_k_quantized;
         }
-        else if (name.find("attn_output.weight") != std::string::npos) {
-            if (qs.model.hparams.n_expert == 8) {
-                new_type = GGML_TYPE_Q5_K;
-            } else {
-                if (ftype == LLAMA_FTYPE_MOSTLY_IQ1_S || ftype == LLAMA_FTYPE_MOSTLY_IQ1_M) new_type = GGML_TYPE_IQ2_XXS;
-                else if (ftype == LLAMA_FTYPE_MOSTLY_IQ2_S || ftype == LLAMA_FTYPE_MOSTLY_IQ2_M) new_type = GGML_TYPE_IQ3_S;
-            }
+    }
+    if (convert_incompatible_tensor) {
+        switch (new_type) {
+            case GGML_TYPE_TQ1_0:
+            case GGML_TYPE_TQ2_0:  new_type = GGML_TYPE_Q4_0; break;  // TODO: use a symmetric type instead
+            case GGML_TYPE_IQ2_XXS:
+            case GGML_TYPE_IQ2_XS:
+            case GGML_TYPE_IQ2_S:
+            case GGML_TYPE_IQ3_XXS:
+            case GGML_TYPE_IQ3_S:
+            case GGML_TYPE_IQ1_S:
+            case GGML_TYPE_IQ1_M:
+            case GGML_TYPE_Q2_K:
+            case GGML_TYPE_Q3_K:
+            case GGML_TYPE_IQ4_XS: new_type = GGML_TYPE_IQ4_NL; break;
+            case GGML_TYPE_Q4_K:   new_type = GGML_TYPE_Q5_0;   break;
+            case GGML_TYPE_Q5_K:   new_type = GGML_TYPE_Q5_1;   break;
+            case GGML_TYPE_Q6_K:   new_type = GGML_TYPE_Q8_0;   break;
+            default: throw std::runtime_error("\nUnsupported tensor size encountered\n");
         }
-    } else if (name.find("attn_v.weight") != std::string::npos) {
-        if      (ftype == LLAMA_FTYPE_MOSTLY_Q2_K) {
-            new_type = qs.model.hparams.n_gqa() >= 4 ? GGML_TYPE_Q4_K : GGML_TYPE_Q3_K;
+        if (tensor->ne[0] % ggml_blck_size(new_type) != 0) {
+            new_type = GGML_TYPE_F16;
         }
-        else if (ftype == LLAMA_FTYPE_MOSTLY_Q2_K_S && qs.model.hparams.n_gqa() >= 4) {
-            new_type = GGML_TYPE_Q4_K;
+        LLAMA_LOG_WARN(" - using fallback quantization %s\n", ggml_type_name(new_type));
+        ++qs.n_fallback;
+    }
+
+    return new_type;
+}
+
+static size_t llama_tensor_quantize_internal(enum ggml_type new_type, const float * f32_data, void * new_data, const int64_t chunk_size, int64_t nrows, int64_t n_per_row, const float * imatrix, std::vector<std::thread> & workers, const int nthread) {
+    if (nthread < 2) {
+        // single-thread
+        size_t new_size = ggml_quantize_chunk(new_type, f32_data, new_data, 0, nrows, n_per_row, imatrix);
+        if (!ggml_validate_row_data(new_type, new_data, new_size)) {
+            throw std::runtime_error("quantized data validation failed");
         }
-        else if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_XXS) {
-            new_type = qs.model.hparams.n_gqa() >= 4 ? GGML_TYPE_Q4_K : !qs.has_imatrix ? GGML_TYPE_IQ3_S : GGML_TYPE_IQ3_XXS;
+        return new_size;
+    }
+
+    std::mutex mutex;
+    int64_t counter = 0;
+    size_t new_size = 0;
+    bool valid = true;
+    auto compute = [&mutex, &counter, &new_size, &valid, new_type, f32_data, new_data, chunk_size,
+            nrows, n_per_row, imatrix]() {
+        const int64_t nrows_per_chunk = chunk_size / n_per_row;
+        size_t local_size = 0;
+        while (true) {
+            std::unique_lock<std::mutex> lock(mutex);
+            int64_t first_row = counter; counter += nrows_per_chunk;
+            if (first_row >= nrows) {
+                if (local_size > 0) {
+                    new_size += local_size;
+                }
+                break;
+            }
+            lock.unlock();
+            const int64_t this_nrow = std::min(nrows - first_row, nrows_per_chunk);
+            size_t this_size = ggml_quantize_chunk(new_type, f32_data, new_data, first_row * n_per_row, this_nrow, n_per_row, imatrix);
+            local_size += this_size;
+
+            // validate the quantized data
+            const size_t row_size  = ggml_row_size(new_type, n_per_row);
+            void * this_data = (char *) new_data + first_row * row_size;
+            if (!ggml_validate_row_data(new_type, this_data, this_size)) {
+                std::unique_lock<std::mutex> lock(mutex);
+                valid = false;
+                break;
+            }
         }
-        else if ((ftype == LLAMA_FTYPE_MOSTLY_IQ3_XS || ftype == LLAMA_FTYPE_MOSTLY_IQ3_S) && qs.model.hparams.n_gqa() >= 4) {
-            new_type = GGML_TYPE_Q4_K;
+    };
+    for (int it = 0; it < nthread - 1; ++it) {
+        workers.emplace_back(compute);
+    }
+    compute();
+    for (auto & w : workers) { w.join(); }
+    workers.clear();
+    if (!valid) {
+        throw std::runtime_error("quantized data validation failed");
+    }
+    return new_size;
+}
+
+static ggml_type llama_ftype_get_default_type(llama_ftype ftype) {
+    switch (ftype) {
+        case LLAMA_FTYPE_MOSTLY_Q4_0: return GGML_TYPE_Q4_0;
+        case LLAMA_FTYPE_MOSTLY_Q4_1: return GGML_TYPE_Q4_1;
+        case LLAMA_FTYPE_MOSTLY_Q5_0: return GGML_TYPE_Q5_0;
+        case LLAMA_FTYPE_MOSTLY_Q5_1: return GGML_TYPE_Q5_1;
+        case LLAMA_FTYPE_MOSTLY_Q8_0: return GGML_TYPE_Q8_0;
+        case LLAMA_FTYPE_MOSTLY_F16:  return GGML_TYPE_F16;
+        case LLAMA_FTYPE_MOSTLY_BF16: return GGML_TYPE_BF16;
+        case LLAMA_FTYPE_ALL_F32:     return GGML_TYPE_F32;
+
+        // K-quants
+        case LLAMA_FTYPE_MOSTLY_Q2_K_S:
+        case LLAMA_FTYPE_MOSTLY_Q2_K:    return GGML_TYPE_Q2_K;
+        case LLAMA_FTYPE_MOSTLY_IQ3_XS:  return GGML_TYPE_IQ3_S;
+        case LLAMA_FTYPE_MOSTLY_Q3_K_S:
+        case LLAMA_FTYPE_MOSTLY_Q3_K_M:
+        case LLAMA_FTYPE_MOSTLY_Q3_K_L:  return GGML_TYPE_Q3_K;
+        case LLAMA_FTYPE_MOSTLY_Q4_K_S:
+        case LLAMA_FTYPE_MOSTLY_Q4_K_M:  return GGML_TYPE_Q4_K;
+        case LLAMA_FTYPE_MOSTLY_Q5_K_S:
+        case LLAMA_FTYPE_MOSTLY_Q5_K_M:  return GGML_TYPE_Q5_K;
+        case LLAMA_FTYPE_MOSTLY_Q6_K:    return GGML_TYPE_Q6_K;
+        case LLAMA_FTYPE_MOSTLY_TQ1_0:   return GGML_TYPE_TQ1_0;
+        case LLAMA_FTYPE_MOSTLY_TQ2_0:   return GGML_TYPE_TQ2_0;
+        case LLAMA_FTYPE_MOSTLY_IQ2_XXS: return GGML_TYPE_IQ2_XXS;
+        case LLAMA_FTYPE_MOSTLY_IQ2_XS:  return GGML_TYPE_IQ2_XS;
+        case LLAMA_FTYPE_MOSTLY_IQ2_S:   return GGML_TYPE_IQ2_XS;
+        case LLAMA_FTYPE_MOSTLY_IQ2_M:   return GGML_TYPE_IQ2_S;
+        case LLAMA_FTYPE_MOSTLY_IQ3_XXS: return GGML_TYPE_IQ3_XXS;
+        case LLAMA_FTYPE_MOSTLY_IQ1_S:   return GGML_TYPE_IQ1_S;
+        case LLAMA_FTYPE_MOSTLY_IQ1_M:   return GGML_TYPE_IQ1_M;
+        case LLAMA_FTYPE_MOSTLY_IQ4_NL:  return GGML_TYPE_IQ4_NL;
+        case LLAMA_FTYPE_MOSTLY_IQ4_XS:  return GGML_TYPE_IQ4_XS;
+        case LLAMA_FTYPE_MOSTLY_IQ3_S:   return GGML_TYPE_IQ3_S;
+        case LLAMA_FTYPE_MOSTLY_IQ3_M:   return GGML_TYPE_IQ3_S;
+
+        default: return GGML_TYPE_COUNT;
+    }
+}
+
+// pick a llama_ftype for every layer so that the repeating layers fit into params->hybrid_budget: the layers are
+// grouped into windows of params->hybrid_window, every window starts at params->hybrid_ftype and the windows with
+// the highest imatrix importance per extra byte are promoted to params->ftype while the budget allows it
+static std::vector<llama_ftype> llama_model_quantize_plan_layers(
+        const llama_model_loader & ml, const llama_model & model, const llama_model_quantize_params * params,
+        const std::unordered_map<std::string, std::vector<float>> * imatrix_data) {
+    const int n_layer  = model.hparams.n_layer;
+    const int n_window = std::max(1, params->hybrid_window);
+
+    const ggml_type type_hi = llama_ftype_get_default_type(params->ftype);
+    const ggml_type type_lo = llama_ftype_get_default_type(params->hybrid_ftype);
+    if (type_lo == GGML_TYPE_COUNT) {
+        throw std::runtime_error(format("invalid hybrid file type %d", params->hybrid_ftype));
+    }
+    if (!imatrix_data) {
+        throw std::runtime_error("hybrid quantization needs an importance matrix to rank the layers");
+    }
+
+    auto type_bytes = [](const ggml_tensor * t, ggml_type type) -> int64_t {
+        if (t->ne[0] % ggml_blck_size(type) != 0) {
+            return ggml_nbytes(t);
+        }
+        return ggml_nelements(t) / ggml_blck_size(type) * ggml_type_size(type);
+    };
+
+    std::vector<double>  importance(n_layer, 0.0);
+    std::vector<int64_t> nb_hi(n_layer, 0);
+    std::vector<int64_t> nb_lo(n_layer, 0);
+
+    for (int i = 0; i < ml.n_tensors; ++i) {
+        const struct ggml_tensor * t = ml.get_tensor_meta(i);
+        const std::string name = ggml_get_name(t);
+
+        int il = -1;
+        if (sscanf(name.c_str(), "blk.%d.", &il) != 1 || il < 0 || il >= n_layer) {
+            continue;
         }
-        else if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_M) {
-            new_type = GGML_TYPE_Q4_K;
+
+        // sizes are estimated from the default type of each ftype, the mixture rules of llama_tensor_get_type are ignored
+        const bool quantize = ggml_n_dims(t) >= 2 && name.rfind("weight") == name.size() - 6 &&
+                              name.find("_norm.weight") == std::string::npos;
+        nb_hi[il] += quantize ? type_bytes(t, type_hi) : (int64_t) ggml_nbytes(t);
+        nb_lo[il] += quantize ? type_bytes(t, type_lo) : (int64_t) ggml_nbytes(t);
+
+        // with the same weight error everywhere, the squared error of an output row grows with sum(imatrix),
+        // the mean squared activation of its input columns, so a tensor weighs sum(imatrix) * rows
+        auto it = imatrix_data->find(name);
+        if (quantize && it != imatrix_data->end()) {
+            double sum = 0.0;
+            for (float v : it->second) {
+                sum += v;
+            }
+            importance[il] += sum * t->ne[1];
         }
-        else if (ftype == LLAMA_FTYPE_MOSTLY_Q3_K_M) {
-            new_type = qs.i_attention_wv < 2 ? GGML_TYPE_Q5_K : GGML_TYPE_Q4_K;
+    }
+
+    struct layer_window {
+        int     il0;
+        int     il1;
+        double  gain;
+        int64_t cost;
+    };
+
+    std::vector<layer_window> windows;
+    int64_t nb_total = 0;
+    for (int il0 = 0; il0 < n_layer; il0 += n_window) {
+        layer_window w = { il0, std::min(n_layer, il0 + n_window), 0.0, 0 };
+        for (int il = w.il0; il < w.il1; ++il) {
+            w.gain   += importance[il];
+            w.cost   += nb_hi[il] - nb_lo[il];
+            nb_total += nb_lo[il];
         }
-        else if (ftype == LLAMA_FTYPE_MOSTLY_Q3_K_L) new_type = GGML_TYPE_Q5_K;
-        else if ((ftype == LLAMA_FTYPE_MOSTLY_IQ4_NL || ftype == LLAMA_FTYPE_MOSTLY_IQ4_XS) && qs.model.hparams.n_gqa() >= 4) {
-            new_type = GGML_TYPE_Q5_K;
+        windows.push_back(w);
+    }
+
+    std::vector<layer_window> ranked = windows;
+    std::stable_sort(ranked.begin(), ranked.end(), [](const layer_window & a, const layer_window & b) {
+        return a.gain / std::max<int64_t>(a.cost, 1) > b.gain / std::max<int64_t>(b.cost, 1);
+    });
+
+    const int64_t budget = (int64_t) ((double) params->hybrid_budget * 1024.0 * 1024.0 * 1024.0);
+
+    std::vector<llama_ftype> layer_ftypes(n_layer, params->hybrid_ftype);
+    int n_hi = 0;
+    for (const auto & w : ranked) {
+        if (nb_total + w.cost > budget) {
+            continue;
         }
-        else if ((ftype == LLAMA_FTYPE_MOSTLY_Q4_K_M || ftype == LLAMA_FTYPE_MOSTLY_Q5_K_M) &&
-                use_more_bits(qs.i_attention_wv, qs.n_attention_wv)) new_type = GGML_TYPE_Q6_K;
-        else if (ftype == LLAMA_FTYPE_MOSTLY_Q4_K_S && qs.i_attention_wv < 4) new_type = GGML_TYPE_Q5_K;
-        if (qs.model.type == MODEL_70B) {
-            // In the 70B model we have 8 heads sharing the same attn_v weights. As a result, the attn_v.weight tensor is
-            // 8x smaller compared to attn_q.weight. Hence, we can get a nice boost in quantization accuracy with
-            // nearly negligible increase in model size by quantizing this tensor with more bits:
-            if (new_type == GGML_TYPE_Q3_K || new_type == GGML_TYPE_Q4_K) new_type = GGML_TYPE_Q5_K;
+        nb_total += w.cost;
+        for (int il = w.il0; il < w.il1; ++il) {
+            layer_ftypes[il] = params->ftype;
+            n_hi++;
         }
-        if (qs.model.hparams.n_expert == 8) {
-            // for the 8-expert model, bumping this to Q8_0 trades just ~128MB
-            // TODO: explore better strategies
-            new_type = GGML_TYPE_Q8_0;
+    }
+
+    if (nb_total > budget) {
+        LLAMA_LOG_WARN("%s: repeating layers need %.2f GiB at %s, more than the budget of %.2f GiB\n", __func__,
+            nb_total / 1024.0 / 1024.0 / 1024.0, llama_model_ftype_name(params->hybrid_ftype).c_str(), params->hybrid_budget);
+    }
+
+    for (const auto & w : windows) {
+        LLAMA_LOG_INFO("%s: layers [%3d, %3d) -> %-24s importance = %10.4e, extra = %8.2f MiB\n", __func__,
+            w.il0, w.il1, llama_model_ftype_name(layer_ftypes[w.il0]).c_str(), w.gain, w.cost / 1024.0 / 1024.0);
+    }
+    LLAMA_LOG_INFO("%s: %d of %d layers at %s, estimated size of the repeating layers = %.2f GiB\n", __func__,
+        n_hi, n_layer, llama_model_ftype_name(params->ftype).c_str(), nb_total / 1024.0 / 1024.0 / 1024.0);
+
+    return layer_ftypes;
+}
+
+static void llama_model_quantize_internal(const std::string & fname_inp, const std::string & fname_out, const llama_model_quantize_params * params) {
+    llama_ftype ftype = params->ftype;
+    ggml_type default_type = llama_ftype_get_default_type(ftype);
+
+    if (default_type == GGML_TYPE_COUNT) {
+        throw std::runtime_error(format("invalid output file type %d\n", ftype));
+    }
+
+    int nthread = params->nthread;
+
+    if (nthread <= 0) {
+        nthread = std::thread::hardware_concurrency();
+    }
+
+    // mmap consistently increases speed Linux, and also increases speed on Windows with
+    // hot cache. It may cause a slowdown on macOS, possibly related to free memory.
+#if defined(__linux__) || defined(_WIN32)
+    constexpr bool use_mmap = true;
+#else
+    constexpr bool use_mmap = false;
+#endif
+
+    llama_model_kv_override * kv_overrides = nullptr;
+    if (params->kv_overrides) {
+        auto v = (std::vector<llama_model_kv_override>*)params->kv_overrides;
+        kv_overrides = v->data();
+    }
+    llama_model_loader ml(fname_inp, use_mmap, /*check_tensors*/ true, kv_overrides);
+    ml.init_mappings(false); // no prefetching
+
+    llama_model model;
+    llm_load_arch(ml, model);
+    llm_load_hparams(ml, model);
+
+    struct quantize_state_internal qs(model, params);
+
+    if (params->only_copy) {
+        ftype = model.ftype;
+    }
+    const std::unordered_map<std::string, std::vector<float>> * imatrix_data = nullptr;
+    if (params->imatrix) {
+        imatrix_data = static_cast<const std::unordered_map<std::string, std::vector<float>>*>(params->imatrix);
+        if (imatrix_data) {
+            LLAMA_LOG_INFO("================================ Have weights data with %d entries\n",int(imatrix_data->size()));
+            qs.has_imatrix = true;
+            // check imatrix for nans or infs
+            for (const auto & kv : *imatrix_data) {
+                for (float f : kv.second) {
+                    if (!std::isfinite(f)) {
+                        throw std::runtime_error(format("imatrix contains non-finite value %f\n", f));
+                    }
+                }
+            }
         }
-        ++qs.i_attention_wv;
-    } else if (name.find("attn_k.weight") != std::string::npos) {
-        if (qs.model.hparams.n_expert == 8) {
-            // for the 8-expert model, bumping this to Q8_0 trades just ~128MB
-            // TODO: explore better strategies
-            new_type = GGML_TYPE_Q8_0;
+    }
+
+    std::vector<llama_ftype> layer_ftypes;
+    if (params->layer_ftypes) {
+        layer_ftypes = *static_cast<const std::vector<llama_ftype> *>(params->layer_ftypes);
+    } else if (params->hybrid_ftype != LLAMA_FTYPE_GUESSED && !params->only_copy) {
+        layer_ftypes = llama_model_quantize_plan_layers(ml, model, params, imatrix_data);
+    }
+    for (llama_ftype layer_ftype : layer_ftypes) {
+        if (layer_ftype != LLAMA_FTYPE_GUESSED && llama_ftype_get_default_type(layer_ftype) == GGML_TYPE_COUNT) {
+            throw std::runtime_error(format("invalid layer file type %d\n", layer_ftype));
         }
-        else if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_XS) {
-            new_type = GGML_TYPE_IQ3_XXS;
+    }
+
+    const size_t align = GGUF_DEFAULT_ALIGNMENT;
+    struct gguf_context * ctx_out = gguf_init_empty();
+
+    // copy the KV pairs from the input file
+    gguf_set_kv     (ctx_out, ml.meta);
+    gguf_set_val_u32(ctx_out, "general.quantization_version", GGML_QNT_VERSION); // TODO: use LLM_KV
+    gguf_set_val_u32(ctx_out, "general.file_type", ftype); // TODO: use LLM_KV
+    if (!layer_ftypes.empty()) {
+        std::vector<int32_t> data(layer_ftypes.begin(), layer_ftypes.end());
+        gguf_set_arr_data(ctx_out, "quantize.layer_ftypes", GGUF_TYPE_INT32, data.data(), data.size());
+    }
+
+    // Remove split metadata
+    gguf_remove_key(ctx_out, ml.llm_kv(LLM_KV_SPLIT_NO).c_str());
+    gguf_remove_key(ctx_out, ml.llm_kv(LLM_KV_SPLIT_COUNT).c_str());
+    gguf_remove_key(ctx_out, ml.llm_kv(LLM_KV_SPLIT_TENSORS_COUNT).c_str());
+
+    if (params->kv_overrides) {
+        const std::vector<llama_model_kv_override> & overrides = *(const std::vector<llama_model_kv_override> *)params->kv_overrides;
+        for (auto & o : overrides) {
+            if (o.key[0] == 0) break;
+            if (o.tag == LLAMA_KV_OVERRIDE_TYPE_FLOAT) {
+                gguf_set_val_f32(ctx_out, o.key, o.val_f64);
+            } else if (o.tag == LLAMA_KV_OVERRIDE_TYPE_INT) {
+                gguf_set_val_i32(ctx_out, o.key, o.val_i64);
+            } else if (o.tag == LLAMA_KV_OVERRIDE_TYPE_BOOL) {
+                gguf_set_val_bool(ctx_out, o.key, o.val_bool);
+            } else if (o.tag == LLAMA_KV_OVERRIDE_TYPE_STR) {
+                gguf_set_val_str(ctx_out, o.key, o.val_str);
+            } else {
+                LLAMA_LOG_WARN("%s: unknown KV override type for key %s\n", __func__, o.key);
+            }
         }
-        else if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_XXS) {
-            new_type = GGML_TYPE_IQ2_S;
+    }
+
+    for (int i = 0; i < ml.n_tensors; ++i) {
+        const struct ggml_tensor * meta = ml.get_tensor_meta(i);
+
+        const std::string name = ggml_get_name(meta);
+
+        // TODO: avoid hardcoded tensor names - use the TN_* constants
+        if (name.find("attn_v.weight")   != std::string::npos ||
+            name.find("attn_qkv.weight") != std::string::npos ||
+            name.find("attn_kv_b.weight")!= std::string::npos) {
+            ++qs.n_attention_wv;
+        } else if (name == LLM_TN(model.arch)(LLM_TENSOR_OUTPUT, "weight")) {
+            qs.has_output = true;
         }
-    } else if (name.find("attn_q.weight") != std::string::npos) {
-        if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_XS) {
-            new_type = GGML_TYPE_IQ3_XXS;
+    }
+
+    qs.n_ffn_down = qs.n_ffn_gate = qs.n_ffn_up = (int)model.hparams.n_layer;
+
+    // sanity checks
+    {
+        const auto & n_head_kv_iter = model.hparams.n_head_kv_arr.begin();
+        // attention layers have a non-zero number of kv heads
+        int32_t n_attn_layer = model.hparams.n_layer - std::count(n_head_kv_iter, n_head_kv_iter + model.hparams.n_layer, 0);
+        if (llama_model_has_encoder(&model)) {
+            n_attn_layer *= 3;
         }
-        else if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_XXS) {
-            new_type = GGML_TYPE_IQ2_S;
+        GGML_ASSERT((qs.n_attention_wv == n_attn_layer) && "n_attention_wv is unexpected");
+    }
+
+    size_t total_size_org = 0;
+    size_t total_size_new = 0;
+
+    std::vector<std::thread> workers;
+    workers.reserve(nthread);
+
+    int idx = 0;
+
+    std::vector<no_init<uint8_t>> read_data;
+    std::vector<no_init<uint8_t>> work;
+    std::vector<no_init<float>> f32_conv_buf;
+
+    uint16_t n_split = 1;
+    // Assume split index is continuous
+    if (params->keep_split) {
+        for (int i = 0; i < ml.n_tensors; ++i) {
+            n_split = std::max(uint16_t(ml.get_weight(i)->idx+1), n_split);
         }
-    } else if (name.find("ffn_down") != std::string::npos) {
-        auto info = layer_info(qs.i_ffn_down, qs.n_ffn_down, name.c_str());
-        int i_layer = info.first, n_layer = info.second;
-        if      (ftype == LLAMA_FTYPE_MOSTLY_Q2_K) new_type = GGML_TYPE_Q3_K;
-        else if (ftype == LLAMA_FTYPE_MOSTLY_Q2_K_S) {
-            if (i_layer < n_layer/8) new_type = GGML_TYPE_Q4_K;
+    }
+    std::vector<gguf_context*> ctx_outs(n_split, NULL);
+    ctx_outs[0] = ctx_out;
+
+    // populate the original tensors so we get an initial meta data
+    for (int i = 0; i < ml.n_tensors; ++i) {
+        auto weight = ml.get_weight(i);
+        uint16_t i_split = params->keep_split ? weight->idx : 0;
+        struct ggml_tensor * tensor = weight->tensor;
+        if (ctx_outs[i_split] == NULL) {
+            ctx_outs[i_split] = gguf_init_empty();
         }
-        else if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_XXS && !qs.has_imatrix) {
-            new_type = i_layer < n_layer/8 ? GGML_TYPE_Q4_K : GGML_TYPE_Q3_K;
+        gguf_add_tensor(ctx_outs[i_split], tensor);
+    }
+
+    // Set split info if needed
+    if (n_split > 1) {
+        for (size_t i = 0; i < ctx_outs.size(); ++i) {
+            gguf_set_val_u16(ctx_outs[i], ml.llm_kv(LLM_KV_SPLIT_NO).c_str(), i);
+            gguf_set_val_u16(ctx_outs[i], ml.llm_kv(LLM_KV_SPLIT_COUNT).c_str(), n_split);
+            gguf_set_val_i32(ctx_outs[i], ml.llm_kv(LLM_KV_SPLIT_TENSORS_COUNT).c_str(), ml.n_tensors);
         }
-        else if (ftype == LLAMA_FTYPE_MOSTLY_Q3_K_M) {
-            new_type = i_layer < n_layer/16 ? GGML_TYPE_Q5_K
-                     : arch != LLM_ARCH_FALCON || use_more_bits(i_layer, n_layer) ? GGML_TYPE_Q4_K
-                     : GGML_TYPE_Q3_K;
+    }
+
+    int cur_split = -1;
+    std::ofstream fout;
+    auto close_ofstream = [&]() {
+        // Write metadata and close file handler
+        if (fout.is_open()) {
+            fout.seekp(0);
+            std::vector<uint8_t> data(gguf_get_meta_size(ctx_outs[cur_split]));
+            gguf_get_meta_data(ctx_outs[cur_split], data.data());
+            fout.write((const char *) data.data(), data.size());
+            fout.close();
         }
-        else if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_M && (i_layer < n_layer/8 ||
-                    (qs.model.hparams.n_expert == 8 && use_more_bits(i_layer, n_layer)))) {
-            new_type = GGML_TYPE_Q4_K;
+    };
+    auto new_ofstream = [&](int index) {
+        cur_split = index;
+        GGML_ASSERT(ctx_outs[cur_split] && "Find uninitialized gguf_context");
+        std::string fname = fname_out;
+        if (params->keep_split) {
+            char split_path[PATH_MAX] = {0};
+            llama_split_path(split_path, sizeof(split_path), fname_out.c_str(), cur_split, n_split);
+            fname = std::string(split_path);
         }
-        else if (ftype == LLAMA_FTYPE_MOSTLY_Q3_K_L) {
-            new_type = arch == LLM_ARCH_FALCON ? GGML_TYPE_Q4_K : GGML_TYPE_Q5_K;
+
+        fout = std::ofstream(fname, std::ios::binary);
+        fout.exceptions(std::ofstream::failbit); // fail fast on write errors
+        const size_t meta_size = gguf_get_meta_size(ctx_outs[cur_split]);
+        // placeholder for the meta data
+        ::zeros(fout, meta_size);
+    };
+
+    const auto tn = LLM_TN(model.arch);
+    new_ofstream(0);
+    for (int i = 0; i < ml.n_tensors; ++i) {
+        auto weight = ml.get_weight(i);
+        struct ggml_tensor * tensor = weight->tensor;
+        if (weight->idx != cur_split && params->keep_split) {
+            close_ofstream();
+            new_ofstream(weight->idx);
         }
-        else if (ftype == LLAMA_FTYPE_MOSTLY_Q4_K_M) {
-            if (arch == LLM_ARCH_FALCON) {
-                new_type = i_layer < n_layer/16 ? GGML_TYPE_Q6_K :
-                           use_more_bits(i_layer, n_layer) ? GGML_TYPE_Q5_K : GGML_TYPE_Q4_K;
-            } else {
-                if (use_more_bits(i_layer, n_layer)) new_type = GGML_TYPE_Q6_K;
+
+        const std::string name = ggml_get_name(tensor);
+
+        if (!ml.use_mmap) {
+            if (read_data.size() < ggml_nbytes(tensor)) {
+                read_data.resize(ggml_nbytes(tensor));
             }
+            tensor->data = read_data.data();
         }
-        else if (i_layer < n_layer/8 && (ftype == LLAMA_FTYPE_MOSTLY_IQ4_NL || ftype == LLAMA_FTYPE_MOSTLY_IQ4_XS) && !qs.has_imatrix) {
-            new_type = GGML_TYPE_Q5_K;
-        }
-        else if (ftype == LLAMA_FTYPE_MOSTLY_Q5_K_M && use_more_bits(i_layer, n_layer)) new_type = GGML_TYPE_Q6_K;
-        else if (ftype == LLAMA_FTYPE_MOSTLY_Q4_K_S && arch != LLM_ARCH_FALCON && i_layer < n_layer/8) {
-            new_type = GGML_TYPE_Q5_K;
+        ml.load_data_for(tensor);
+
+        LLAMA_LOG_INFO("[%4d/%4d] %36s - [%s], type = %6s, ",
+               ++idx, ml.n_tensors,
+               ggml_get_name(tensor),
+               llama_format_tensor_shape(tensor).c_str(),
+               ggml_type_name(tensor->type));
+
+        // This used to be a regex, but <regex> has an extreme cost to compile times.
+        bool quantize = name.rfind("weight") == name.size() - 6; // ends with 'weight'?
+
+        // quantize only 2D and 3D tensors (experts)
+        quantize &= (ggml_n_dims(tensor) >= 2);
+
+        // do not quantize norm tensors
+        quantize &= name.find("_norm.weight") == std::string::npos;
+
+        quantize &= params->quantize_output_tensor || name != "output.weight";
+        quantize &= !params->only_copy;
+
+        // do not quantize expert gating tensors
+        // NOTE: can't use LLM_TN here because the layer number is not known
+        quantize &= name.find("ffn_gate_inp.weight") == std::string::npos;
+
+        // do not quantize positional embeddings and token types (BERT)
+        quantize &= name != LLM_TN(model.arch)(LLM_TENSOR_POS_EMBD,    "weight");
+        quantize &= name != LLM_TN(model.arch)(LLM_TENSOR_TOKEN_TYPES, "weight");
+
+        // do not quantize Mamba's small yet 2D weights
+        // NOTE: can't use LLM_TN here because the layer number is not known
+        quantize &= name.find("ssm_conv1d.weight") == std::string::npos;
+
+        // do not quantize RWKV's time_mix_first tensors
+        quantize &= name.find("time_mix_first.weight") == std::string::npos;
+        quantize &= name.find("time_mix_w1.weight") == std::string::npos;
+        quantize &= name.find("time_mix_w2.weight") == std::string::npos;
+        quantize &= name.find("time_mix_decay_w1.weight") == std::string::npos;
+        quantize &= name.find("time_mix_decay_w2.weight") == std::string::npos;
+
+        // do not quantize relative position bias (T5)
+        quantize &= name.find("attn_rel_b.weight") == std::string::npos;
+
+        enum ggml_type new_type;
+        void * new_data;
+        size_t new_size;
+
+        // layers listed in the per-layer plan use their own ftype instead of the file type
+        llama_ftype tensor_ftype = ftype;
+        {
+            int il = -1;
+            if (!layer_ftypes.empty() && sscanf(name.c_str(), "blk.%d.", &il) == 1 &&
+                il >= 0 && il < (int) layer_ftypes.size() && layer_ftypes[il] != LLAMA_FTYPE_GUESSED) {
+                tensor_ftype = layer_ftypes[il];
+                // the mixture rules do not advance every counter for every ftype, so resync them with the layer
+                qs.i_ffn_down = qs.i_ffn_gate = qs.i_ffn_up = il;
+            }
         }
-        else if ((ftype == LLAMA_FTYPE_MOSTLY_Q4_0 || ftype == LLAMA_FTYPE_MOSTLY_Q5_0)
-                && qs.has_imatrix && i_layer < n_layer/8) {
-            // Guard against craziness in the first few ffn_down layers that can happen even with imatrix for Q4_0/Q5_0.
-            // We only do it when an imatrix is provided because a) we want to make sure that one can always get the
-            // same quantization as before imatrix stuff, and b) Q4_1/Q5_1 do go crazy on ffn_down without an imatrix.
-            new_type = ftype == LLAMA_FTYPE_MOSTLY_Q4_0 ? GGML_TYPE_Q4_1 : GGML_TYPE_Q5_1;
+
+        if (quantize) {
+            const ggml_type tensor_default_type = llama_ftype_get_default_type(tensor_ftype);
+            new_type = tensor_default_type;
+
+            // get more optimal quantization type based on the tensor shape, layer, etc.
+            if (!params->pure && ggml_is_quantized(tensor_default_type)) {
+                new_type = llama_tensor_get_type(qs, new_type, tensor, tensor_ftype);
+            }
+            if (params->token_embedding_type < GGML_TYPE_COUNT && strcmp(tensor->name, "token_embd.weight") == 0) {
+                new_type = params->token_embedding_type;
+            }
+            if (params->output_tensor_type < GGML_TYPE_COUNT && strcmp(tensor->name, "output.weight") == 0) {
+                new_type = params->output_tensor_type;
+            }
+
+            // If we've decided to quantize to the same type the tensor is already
+            // in then there's nothing to do.
+            quantize = tensor->type != new_type;
         }
-        ++qs.i_ffn_down;
-    } else if (name.find("attn_output.weight") != std::string::npos) {
-        if (arch != LLM_ARCH_FALCON) {
-            if (qs.model.hparams.n_expert == 8) {
-                if (ftype == LLAMA_FTYPE_MOSTLY_Q2_K   || ftype == LLAMA_FTYPE_MOSTLY_IQ3_XS || ftype == LLAMA_FTYPE_MOSTLY_IQ3_XXS ||
-                    ftype == LLAMA_FTYPE_MOSTLY_Q3_K_S || ftype == LLAMA_FTYPE_MOSTLY_Q3_K_M  || ftype == LLAMA_FTYPE_MOSTLY_IQ4_NL  ||
-                    ftype == LLAMA_FTYPE_MOSTLY_Q4_K_S || ftype == LLAMA_FTYPE_MOSTLY_Q4_K_M  || ftype == LLAMA_FTYPE_MOSTLY_IQ3_S  ||
-                    ftype == LLAMA_FTYPE_MOSTLY_IQ3_M  || ftype == LLAMA_FTYPE_MOSTLY_IQ4_XS) {
-                    new_type = GGML_TYPE_Q5_K;
+
+        if (!quantize) {
+            new_type = tensor->type;
+            new_data = tensor->data;
+            new_size = ggml_nbytes(tensor);
+            LLAMA_LOG_INFO("size = %8.3f MB\n", ggml_nbytes(tensor)/1024.0/1024.0);
+        } else {
+            const int64_t nelements = ggml_nelements(tensor);
+
+            const float * imatrix = nullptr;
+            if (imatrix_data) {
+                auto it = imatrix_data->find(tensor->name);
+                if (it == imatrix_data->end()) {
+                    LLAMA_LOG_INFO("\n====== %s: did not find weights for %s\n", __func__, tensor->name);
+                } else {
+                    if (it->second.size() == (size_t)tensor->ne[0]*tensor->ne[2]) {
+                        imatrix = it->second.data();
+                    } else {
+                        LLAMA_LOG_INFO("\n====== %s: imatrix size %d is different from tensor size %d for %s\n", __func__,
+                                int(it->second.size()), int(tensor->ne[0]*tensor->ne[2]), tensor->name);
+
+                        // this can happen when quantizing an old mixtral model with split tensors with a new incompatible imatrix
+                        // this is a significant error and it may be good idea to abort the process if this happens,
+                        // since many people will miss the error and not realize that most of the model is being quantized without an imatrix
+                        // tok_embd should be ignored in this case, since it always causes this warning
+                        if (name != tn(LLM_TENSOR_TOKEN_EMBD, "weight")) {
+                            throw std::runtime_error(format("imatrix size %d is different from tensor size %d for %s",
+                                    int(it->second.size()), int(tensor->ne[0]*tensor->ne[2]), tensor->name));
+                        }
+                    }
                 }
+            }
+            if ((new_type == GGML_TYPE_IQ2_XXS ||
+                 new_type == GGML_TYPE_IQ2_XS  ||
+                 new_type == GGML_TYPE_IQ2_S   ||
+                 new_type == GGML_TYPE_IQ1_S   ||
+                (new_type == GGML_TYPE_IQ1_M && strcmp(tensor->name, "token_embd.weight") && strcmp(tensor->name, "output.weight"))  ||
+                (new_type == GGML_TYPE_Q2_K && tensor_ftype == LLAMA_FTYPE_MOSTLY_Q2_K_S && strcmp(tensor->name, "token_embd.weight") != 0)) && !imatrix) {
+                LLAMA_LOG_ERROR("\n\n============================================================\n");
+                LLAMA_LOG_ERROR("Missing importance matrix for tensor %s in a very low-bit quantization\n", tensor->name);
+                LLAMA_LOG_ERROR("The result will be garbage, so bailing out\n");
+                LLAMA_LOG_ERROR("============================================================\n\n");
+                throw std::runtime_error(format("Missing importance matrix for tensor %s in a very low-bit quantization", tensor->name));
+            }
+
+            float * f32_data;
+
+            if (tensor->type == GGML_TYPE_F32) {
+                f32_data = (float *) tensor->data;
+            } else if (ggml_is_quantized(tensor->type) && !params->allow_requantize) {
+                throw std::runtime_error(format("requantizing from type %s is disabled", ggml_type_name(tensor->type)));
             } else {
-                if      (ftype == LLAMA_FTYPE_MOSTLY_Q2_K   ) new_type = GGML_TYPE_Q3_K;
-                else if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_XXS) new_type = GGML_TYPE_IQ3_S;
-                else if (ftype == LLAMA_FTYPE_MOSTLY_Q3_K_M ) new_type = GGML_TYPE_Q4_K;
-                else if (ftype == LLAMA_FTYPE_MOSTLY_Q3_K_L ) new_type = GGML_TYPE_Q5_K;
-                else if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_M  ) new_type = GGML_TYPE_Q4_K;
+                llama_tensor_dequantize_internal(tensor, f32_conv_buf, workers, nelements, nthread);
+                f32_data = (float *) f32_conv_buf.data();
             }
-        } else {
-            if (ftype == LLAMA_FTYPE_MOSTLY_Q3_K_L) new_type = GGML_TYPE_Q4_K;
+
+            LLAMA_LOG_INFO("converting to %s .. ", ggml_type_name(new_type));
+            fflush(stdout);
+
+            if (work.size() < (size_t)nelements * 4) {
+                work.resize(nelements * 4); // upper bound on size
+            }
+            new_data = work.data();
+
+            const int64_t n_per_row = tensor->ne[0];
+            const int64_t nrows = tensor->ne[1];
+
+            static const int64_t min_chunk_size = 32 * 512;
+            const int64_t chunk_size = (n_per_row >= min_chunk_size ? n_per_row : n_per_row * ((min_chunk_size + n_per_row - 1)/n_per_row));
+
+            const int64_t nelements_matrix = tensor->ne[0] * tensor->ne[1];
+            const int64_t nchunk = (nelements_matrix + chunk_size - 1)/chunk_size;
+            const int64_t nthread_use = nthread > 1 ? std::max((int64_t)1, std::min((int64_t)nthread, nchunk)) : 1;
+
+            // quantize each expert separately since they have different importance matrices
+            new_size = 0;
+            for (int64_t i03 = 0; i03 < tensor->ne[2]; ++i03) {
+                const float * f32_data_03 = f32_data + i03 * nelements_matrix;
+                void * new_data_03 = (char *)new_data + ggml_row_size(new_type, n_per_row) * i03 * nrows;
+                const float * imatrix_03 = imatrix ? imatrix + i03 * n_per_row : nullptr;
+
+                new_size += llama_tensor_quantize_internal(new_type, f32_data_03, new_data_03, chunk_size, nrows, n_per_row, imatrix_03, workers, nthread_use);
+            }
+            LLAMA_LOG_INFO("size = %8.2f MiB -> %8.2f MiB\n", ggml_nbytes(tensor)/1024.0/1024.0, new_size/1024.0/1024.0);
         }
+        total_size_org += ggml_nbytes(tensor);
+        total_size_new += new_size;
+
+        // update the gguf meta data as we go
+        gguf_set_tensor_type(ctx_outs[cur_split], name.c_str(), new_type);
+        gguf_set_tensor_data(ctx_outs[cur_split], name.c_str(), new_data, new_size);
+
+        // write tensor data + padding
+        fout.write((const char *) new_data, new_size);
+        zeros(fout, GGML_PAD(new_size, align) - new_size);
     }
-    else if (name.find("attn_qkv.weight") != std::string::npos) {
-        if (ftype == LLAMA_FTYPE_MOSTLY_Q3_K_M || ftype == LLAMA_FTYPE_MOSTLY_Q3_K_L || ftype == LLAMA_FTYPE_MOSTLY_IQ3_M) {
-            new_type = GGML_TYPE_Q4_K;
-        }
-        else if (ftype == LLAMA_FTYPE_MOSTLY_Q4_K_M) new_type = GGML_TYPE_Q5_K;
-        else if (ftype == LLAMA_FTYPE_MOSTLY_Q5_K_M) new_type = GGML_TYPE_Q6_K;
+    close_ofstream();
+    for (auto & c:ctx_outs) {
+        gguf_free(c);
     }
-    else if (name.find("ffn_gate") != std::string::npos) {
-        auto info = layer_info(qs.i_ffn_gate, qs.n_ffn_gate, name.c_str());
-        int i_layer = info.first, n_layer = info.second;
-        if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_XS && (i_layer >= n_layer/8 && i_layer < 7*n_layer/8)) {
-            new_type = GGML_TYPE_IQ3_XXS;
-        }
-        ++qs.i_ffn_gate;
+
+    LLAMA_LOG_INFO("%s: model size  = %8.2f MB\n", __func__, total_size_org/1024.0/1024.0);
+    LLAMA_LOG_INFO("%s: quant size  = %8.2f MB\n", __func__, total_size_new/1024.0/1024.0);
+
+    if (qs.n_fallback > 0) {
+        LLAMA_LOG_WARN("%s: WARNING: %d of %d tensor(s) required fallback quantization\n",
+                __func__, qs.n_fallback, qs.n_k_quantized + qs.n_fallback);
     }
-    else if (name.find("ffn_up") != std::string::npos) {
-        auto info = layer_info(qs.i_ffn_up, qs.n_ffn_up, name.c_str());
-        int i_layer = info.first, n_layer = info.second;
-        if (ftype == LLAMA_FTYPE_MOSTLY_IQ3_XS && (i_layer >= n_layer/8 && i_layer < 7*n_layer/8)) {
-            new_type = GGML_TYPE_IQ3_XXS;
-        }
-        ++qs.i_ffn_up;
+}
+
+static void llama_lora_adapter_init_internal(struct llama_model * model, const char * path_lora, struct llama_lora_adapter & adapter) {
+    LLAMA_LOG_INFO("%s: loading lora adapter from '%s' ...\n", __func__, path_lora);
+
+    ggml_context * ctx = nullptr;
+    struct gguf_init_params meta_gguf_params = {
+        /* .no_alloc = */ true,
+        /* .ctx      = */ &ctx,
+    };
+    struct gguf_context * ctx_gguf = gguf_init_from_file(path_lora, meta_gguf_params);
+    if (!ctx_gguf) {
+        throw std::runtime_error("failed to load lora adapter file from " + std::string(path_lora));
     }
 
-    //    if (ftype == LLAMA_FTYPE_MOSTLY_Q2_K) new_type = GGML_TYPE_Q3_K;
-    //}
-    // IK: let's remove this, else Q2_K is almost the same as Q3_K_S
-    //else if (name.find("ffn_gate") != std::string::npos || name.find("ffn_up") != std::string::npos) {
-    //    if (ftype == LLAMA_FTYPE_MOSTLY_Q2_K) new_type = GGML_TYPE_Q3_K;
-    //}
-    // This can be used to reduce the size of the Q5_K_S model.
-    // The associated PPL increase is fully in line with the size reduction
-    //else {
-    //    if (ftype == LLAMA_FTYPE_MOSTLY_Q5_K_S) new_type = GGML_TYPE_Q4_K;
-    //}
-    bool convert_incompatible_tensor = false;
-    if (new_type == GGML_TYPE_Q2_K    || new_type == GGML_TYPE_Q3_K    || new_type == GGML_TYPE_Q4_K   ||
-        new_type == GGML_TYPE_Q5_K    || new_type == GGML_TYPE_Q6_K    || new_type == GGML_TYPE_IQ4_XS ||
-        new_type == GGML_TYPE_IQ2_XS  || new_type == GGML_TYPE_IQ2_XXS || new_type == GGML_TYPE_IQ2_S  ||
-        new_type == GGML_TYPE_IQ3_XXS || new_type == GGML_TYPE_IQ1_S   || new_type == GGML_TYPE_IQ3_S  ||
-        new_type == GGML_TYPE_IQ1_M) {
-        int nx = tensor->ne[0];
-        int ny = tensor->ne[1];
-        if (nx % QK_K != 0) {
-            LLAMA_LOG_WARN("\n\n%s : tensor cols %d x %d are not divisible by %d, required for %s", __func__, nx, ny, QK_K, ggml_type_name(new_type));
-            convert_incompatible_tensor = true;
-        } else {
-            ++qs.n_k_quantized;
+    // check metadata
+    {
+        auto get_kv_str = [&](const std::string & key) -> std::string {
+            int id = gguf_find_key(ctx_gguf, key.c_str());
+            return id < 0 ? "" : std::string(gguf_get_val_str(ctx_gguf, id));
+        };
+        auto get_kv_f32 = [&](const std::string & key) -> float {
+            int id = gguf_find_key(ctx_gguf, key.c_str());
+            return id < 0 ? 0.0f : gguf_get_val_f32(ctx_gguf, id);
+        };
+        LLM_KV llm_kv = LLM_KV(LLM_ARCH_UNKNOWN);
+
+        auto general_type = get_kv_str(llm_kv(LLM_KV_GENERAL_TYPE));
+        if (general_type != "adapter") {
+            gguf_free(ctx_gguf);
+            throw std::runtime_error("expect general.type to be 'adapter', but got: " + general_type);
         }
-    }
-    if (convert_incompatible_tensor) {
-        switch (new_type) {
-            case GGML_TYPE_TQ1_0:
-            case GGML_TYPE_TQ2_0:  new_type = GGML_TYPE_Q4_0; break;  // TODO: use a symmetric type instead
-            case GGML_TYPE_IQ2_XXS:
-            case GGML_TYPE_IQ2_XS:
-            case GGML_TYPE_IQ2_S:
-            case GGML_TYPE_IQ3_XXS:
-            case GGML_TYPE_IQ3_S:
-            case GGML_TYPE_IQ1_S:
-            case GGML_TYPE_IQ1_M:
-            case GGML_TYPE_Q2_K:
-            case GGML_TYPE_Q3_K:
-            case GGML_TYPE_IQ4_XS: new_type = GGML_TYPE_IQ4_NL; break;
-            case GGML_TYPE_Q4_K:   new_type = GGML_TYPE_Q5_0;   break;
-            case GGML_TYPE_Q5_K:   new_type = GGML_TYPE_Q5_1;   break;
-            case GGML_TYPE_Q6_K:   new_type = GGML_TYPE_Q8_0;   break;
-            default: throw std::runtime_error("\nUnsupported tensor size encountered\n");
+
+        auto general_arch_str = get_kv_str(llm_kv(LLM_KV_GENERAL_ARCHITECTURE));
+        auto general_arch = llm_arch_from_string(general_arch_str);
+        if (general_arch != model->arch) {
+            gguf_free(ctx_gguf);
+            throw std::runtime_error("model arch and LoRA arch mismatch");
         }
-        if (tensor->ne[0] % ggml_blck_size(new_type) != 0) {
-            new_type = GGML_TYPE_F16;
+
+        auto adapter_type = get_kv_str(llm_kv(LLM_KV_ADAPTER_TYPE));
+        if (adapter_type != "lora") {
+            gguf_free(ctx_gguf);
+            throw std::runtime_error("expect adapter.type to be 'lora', but got: " + adapter_type);
+        }
+
+        adapter.alpha = get_kv_f32(llm_kv(LLM_KV_ADAPTER_LORA_ALPHA));
+    }
+
+    int n_tensors = gguf_get_n_tensors(ctx_gguf);
+
+    // contexts for each buffer type
+    std::map<ggml_backend_buffer_type_t, ggml_context *> ctx_map;
+    auto get_ctx_for_buft = [&](ggml_backend_buffer_type_t buft) -> ggml_context * {
+        auto it = ctx_map.find(buft);
+        if (it == ctx_map.end()) {
+            // add a new context
+            struct ggml_init_params params = {
+                /*.mem_size   =*/ n_tensors*ggml_tensor_overhead(),
+                /*.mem_buffer =*/ NULL,
+                /*.no_alloc   =*/ true,
+            };
+            ggml_context * buft_ctx = ggml_init(params);
+            ctx_map[buft] = buft_ctx;
+            return buft_ctx;
+        };
+        return it->second;
+    };
+
+    // bundle lora_a and lora_b into pairs
+    std::map<std::string, llama_lora_weight> ab_map;
+    auto str_endswith = [](const std::string & str, const std::string & suffix) {
+        return str.size() >= suffix.size() && str.compare(str.size()-suffix.size(), suffix.size(), suffix) == 0;
+    };
+    for (ggml_tensor * cur = ggml_get_first_tensor(ctx); cur; cur = ggml_get_next_tensor(ctx, cur)) {
+        std::string name(cur->name);
+        if (str_endswith(name, ".lora_a")) {
+            replace_all(name, ".lora_a", "");
+            if (ab_map.find(name) == ab_map.end()) {
+                ab_map[name] = llama_lora_weight(cur, nullptr);
+            } else {
+                ab_map[name].a = cur;
+            }
+        } else if (str_endswith(name, ".lora_b")) {
+            replace_all(name, ".lora_b", "");
+            if (ab_map.find(name) == ab_map.end()) {
+                ab_map[name] = llama_lora_weight(nullptr, cur);
+            } else {
+                ab_map[name].b = cur;
+            }
+        } else {
+            gguf_free(ctx_gguf);
+            ggml_free(ctx);
+            throw std::runtime_error("LoRA tensor '" + name + "' has unexpected suffix");
         }
-        LLAMA_LOG_WARN(" - using fallback quantization %s\n", ggml_type_name(new_type));
-        ++qs.n_fallback;
     }
 
-    return new_type;
-}
+    // add tensors
+    for (auto & it : ab_map) {
+        const std::string & name = it.first;
+        llama_lora_weight & w = it.second;
 
-static size_t llama_tensor_quantize_internal(enum ggml_type new_type, const float * f32_data, void * new_data, const int64_t chunk_size, int64_t nrows, int64_t n_per_row, const float * imatrix, std::vector<std::thread> & workers, const int nthread) {
-    if (nthread < 2) {
-        // single-thread
-        size_t new_size = ggml_quantize_chunk(new_type, f32_data, new_data, 0, nrows, n_per_row, imatrix);
-        if (!ggml_validate_row_data(new_type, new_data, new_size)) {
-            throw std::runtime_error("quantized data validation failed");
+        if (!w.a || !w.b) {
+            gguf_free(ctx_gguf);
+            ggml_free(ctx);
+            throw std::runtime_error("LoRA tensor pair for '" + name + "' is missing one component");
         }
-        return new_size;
-    }
 
-    std::mutex mutex;
-    int64_t counter = 0;
-    size_t new_size = 0;
-    bool valid = true;
-    auto compute = [&mutex, &counter, &new_size, &valid, new_type, f32_data, new_data, chunk_size,
-            nrows, n_per_row, imatrix]() {
-        const int64_t nrows_per_chunk = chunk_size / n_per_row;
-        size_t local_size = 0;
-        while (true) {
-            std::unique_lock<std::mutex> lock(mutex);
-            int64_t first_row = counter; counter += nrows_per_chunk;
-            if (first_row >= nrows) {
-                if (local_size > 0) {
-                    new_size += local_size;
-                }
-                break;
-            }
-            lock.unlock();
-            const int64_t this_nrow = std::min(nrows - first_row, nrows_per_chunk);
-            size_t this_size = ggml_quantize_chunk(new_type, f32_data, new_data, first_row * n_per_row, this_nrow, n_per_row, imatrix);
-            local_size += this_size;
+        // device buft and device ctx
+        auto * model_tensor = llama_get_model_tensor(model, name.c_str());
+        if (!model_tensor) {
+            gguf_free(ctx_gguf);
+            ggml_free(ctx);
+            throw std::runtime_error("LoRA tensor '" + name + "' does not exist in base model");
+        }
+        struct ggml_context * dev_ctx = get_ctx_for_buft(ggml_backend_buffer_get_type(model_tensor->buffer));
+        // validate tensor shape
+        if (model_tensor->ne[0] != w.a->ne[0] || model_tensor->ne[1] != w.b->ne[1]) {
+            gguf_free(ctx_gguf);
+            ggml_free(ctx);
+            throw std::runtime_error("tensor '" + name + "' has incorrect shape");
+        }
+        if (w.a->ne[1] != w.b->ne[0]) {
+            gguf_free(ctx_gguf);
+            ggml_free(ctx);
+            throw std::runtime_error("lora_a tensor is not transposed (hint: adapter from \"finetune\" example is no longer supported)");
+        }
+        // save tensor to adapter
+        struct ggml_tensor * tensor_a = ggml_dup_tensor(dev_ctx, w.a);
+        struct ggml_tensor * tensor_b = ggml_dup_tensor(dev_ctx, w.b);
+        ggml_set_name(tensor_a, w.a->name);
+        ggml_set_name(tensor_b, w.b->name);
+        adapter.ab_map[name] = llama_lora_weight(tensor_a, tensor_b);
+    }
 
-            // validate the quantized data
-            const size_t row_size  = ggml_row_size(new_type, n_per_row);
-            void * this_data = (char *) new_data + first_row * row_size;
-            if (!ggml_validate_row_data(new_type, this_data, this_size)) {
-                std::unique_lock<std::mutex> lock(mutex);
-                valid = false;
-                break;
+    // allocate tensors / buffers and zero
+    {
+        adapter.ctxs.reserve(ctx_map.size());
+        adapter.bufs.reserve(ctx_map.size());
+        for (auto it : ctx_map) {
+            ggml_backend_buffer_type_t buft = it.first;
+            ggml_context * ctx_dev = it.second;
+            ggml_backend_buffer_t buf = ggml_backend_alloc_ctx_tensors_from_buft(ctx_dev, buft);
+            if (!buf) {
+                gguf_free(ctx_gguf);
+                ggml_free(ctx);
+                throw std::runtime_error("failed to allocate buffer for lora adapter\n");
             }
+            LLAMA_LOG_INFO("%s: %10s LoRA buffer size = %8.2f MiB\n", __func__, ggml_backend_buffer_name(buf), ggml_backend_buffer_get_size(buf)/1024.0/1024.0);
+            adapter.ctxs.push_back(ctx_dev);
+            adapter.bufs.push_back(buf);
         }
-    };
-    for (int it = 0; it < nthread - 1; ++it) {
-        workers.emplace_back(compute);
     }
-    compute();
-    for (auto & w : workers) { w.join(); }
-    workers.clear();
-    if (!valid) {
-        throw std::runtime_error("quantized data validation failed");
+
+    // set tensor data
+    {
+        llama_file gguf_file(path_lora, "rb");
+        std::vector<uint8_t> read_buf;
+        auto set_tensor = [&](struct ggml_tensor * orig, struct ggml_tensor * dev) {
+            size_t offs = gguf_get_data_offset(ctx_gguf) + gguf_get_tensor_offset(ctx_gguf, gguf_find_tensor(ctx_gguf, orig->name));
+            size_t size = ggml_nbytes(orig);
+            read_buf.resize(size);
+            gguf_file.seek(offs, SEEK_SET);
+            gguf_file.read_raw(read_buf.data(), size);
+            ggml_backend_tensor_set(dev, read_buf.data(), 0, size);
+        };
+        for (auto & it : adapter.ab_map) {
+            auto orig = ab_map[it.first];
+            auto dev  = it.second;
+            set_tensor(orig.a, dev.a);
+            set_tensor(orig.b, dev.b);
+        }
     }
-    return new_size;
-}
 
-static void llama_model_quantize_internal(const std::string & fname_inp, const std::string & fname_out, const llama_model_quantize_params * params) {
-    ggml_type default_type;
-    llama_ftype ftype = params->ftype;
+    LLAMA_LOG_INFO("%s: loaded %ld tensors from lora file\n", __func__, adapter.ab_map.size()*2);
+
+    // free ctx for reading gguf
+    gguf_free(ctx_gguf);
+    ggml_free(ctx);
+}
 
-    switch (params->ftype) {
-        case LLAMA_FTYPE_MOSTLY_Q4_0: default_type = GGML_TYPE_Q4_0; break;
-        case LLAMA_FTYPE_MOSTLY_Q4_1: default_type = GGML_TYPE_Q4_1; break;
-        case LLAMA_FTYPE_MOSTLY_Q5_0: default_type = GGML_TYPE_Q5_0; break;
-        case LLAMA_FTYPE_MOSTLY_Q5_1: default_type = GGML_TYPE_Q5_1; break;
-        case LLAMA_FTYPE_MOSTLY_Q8_0: default_type = GGML_TYPE_Q8_0; break;
-        case LLAMA_FTYPE_MOSTLY_F16:  default_type = GGML_TYPE_F16;  break;
-        case LLAMA_FTYPE_MOSTLY_BF16: default_type = GGML_TYPE_BF16; break;
-        case LLAMA_FTYPE_ALL_F32:     default_type = GGML_TYPE_F32;  break;
+int32_t llama_lora_adapter_set(
+            struct llama_context * ctx,
+            struct llama_lora_adapter * adapter,
+            float scale) {
+    if (ctx->cparams.flash_attn) {
+        LLAMA_LOG_ERROR("%s: flash_attn is not compatible with LoRA\n", __func__);
+        return -1;
+    }
+    ctx->lora_adapters[adapter] = scale;
+    ctx->graph_cache.clear();
+    return 0;
+}
 
-        // K-quants
-        case LLAMA_FTYPE_MOSTLY_Q2_K_S:
-        case LLAMA_FTYPE_MOSTLY_Q2_K:    default_type = GGML_TYPE_Q2_K;    break;
-        case LLAMA_FTYPE_MOSTLY_IQ3_XS:  default_type = GGML_TYPE_IQ3_S;   break;
-        case LLAMA_FTYPE_MOSTLY_Q3_K_S:
-        case LLAMA_FTYPE_MOSTLY_Q3_K_M:
-        case LLAMA_FTYPE_MOSTLY_Q3_K_L:  default_type = GGML_TYPE_Q3_K;    break;
-        case LLAMA_FTYPE_MOSTLY_Q4_K_S:
-        case LLAMA_FTYPE_MOSTLY_Q4_K_M:  default_type = GGML_TYPE_Q4_K;    break;
-        case LLAMA_FTYPE_MOSTLY_Q5_K_S:
-        case LLAMA_FTYPE_MOSTLY_Q5_K_M:  default_type = GGML_TYPE_Q5_K;    break;
-        case LLAMA_FTYPE_MOSTLY_Q6_K:    default_type = GGML_TYPE_Q6_K;    break;
-        case LLAMA_FTYPE_MOSTLY_TQ1_0:   default_type = GGML_TYPE_TQ1_0;   break;
-        case LLAMA_FTYPE_MOSTLY_TQ2_0:   default_type = GGML_TYPE_TQ2_0;   break;
-        case LLAMA_FTYPE_MOSTLY_IQ2_XXS: default_type = GGML_TYPE_IQ2_XXS; break;
-        case LLAMA_FTYPE_MOSTLY_IQ2_XS:  default_type = GGML_TYPE_IQ2_XS;  break;
-        case LLAMA_FTYPE_MOSTLY_IQ2_S:   default_type = GGML_TYPE_IQ2_XS;  break;
-        case LLAMA_FTYPE_MOSTLY_IQ2_M:   default_type = GGML_TYPE_IQ2_S;   break;
-        case LLAMA_FTYPE_MOSTLY_IQ3_XXS: default_type = GGML_TYPE_IQ3_XXS; break;
-        case LLAMA_FTYPE_MOSTLY_IQ1_S:   default_type = GGML_TYPE_IQ1_S;   break;
-        case LLAMA_FTYPE_MOSTLY_IQ1_M:   default_type = GGML_TYPE_IQ1_M;   break;
-        case LLAMA_FTYPE_MOSTLY_IQ4_NL:  default_type = GGML_TYPE_IQ4_NL;  break;
-        case LLAMA_FTYPE_MOSTLY_IQ4_XS:  default_type = GGML_TYPE_IQ4_XS;  break;
-        case LLAMA_FTYPE_MOSTLY_IQ3_S:   default_type = GGML_TYPE_IQ3_S;   break;
-        case LLAMA_FTYPE_MOSTLY_IQ3_M:   default_type = GGML_TYPE_IQ3_S;   break;
-        
-        default: throw std::runtime_error(format("invalid output file type %d\n", ftype));
+int32_t llama_lora_adapter_remove(
+            struct llama_context * ctx,
+            struct llama_lora_adapter * adapter) {
+    auto pos = ctx->lora_adapters.find(adapter);
+    if (pos != ctx->lora_adapters.end()) {
+        ctx->lora_adapters.erase(pos);
+        ctx->graph_cache.clear();
+        return 0;
     }
+    return -1;
+}
 
-    int nthread = params->nthread;
+void llama_lora_adapter_clear(struct llama_context * ctx) {
+    ctx->lora_adapters.clear();
+    ctx->graph_cache.clear();
+}
 
-    if (nthread <= 0) {
-        nthread = std::thread::hardware_concurrency();
-    }
+void llama_lora_adapter_free(struct llama_lora_adapter * adapter) {
+    delete adapter;
+}
 
-    // mmap consistently increases speed Linux, and also increases speed on Windows with
-    // hot cache. It may cause a slowdown on macOS, possibly related to free memory.
-#if defined(__linux__) || defined(_WIN32)
-    constexpr bool use_mmap = true;
-#else
-    constexpr bool use_mmap = false;
+//
+// interface implementation
+//
+struct llama_model_params llama_model_default_params() {
+    struct llama_model_params result = {
+        /*.n_world                     =*/ 1,
+        /*.rank                        =*/ 0,
+        /*.n_layer_window              =*/ {0},
+        /*.n_layer_extra               =*/ {0},
+        /*.n_gpu_layers                =*/ 0,
+        /*.split_mode                  =*/ LLAMA_SPLIT_MODE_LAYER,
+        /*.main_gpu                    =*/ 0,
+        /*.tensor_split                =*/ nullptr,
+        /*.rpc_servers                 =*/ nullptr,
+        /*.progress_callback           =*/ nullptr,
+        /*.progress_callback_user_data =*/ nullptr,
+        /*.kv_overrides                =*/ nullptr,
+        /*.vocab_only                  =*/ false,
+        /*.use_mmap                    =*/ true,
+        /*.use_mlock                   =*/ false,
+        /*.check_tensors               =*/ false,
+        /*.keep_out_in_metal           =*/ true,
+        /*.keep_out_in_cuda            =*/ false,
+        /*.stream_weights              =*/ false,
+        /*.repack                      =*/ false,
+    };
+
+#ifdef GGML_USE_METAL
+    // note: we usually have plenty of VRAM, so by default offload all layers to the GPU
+    result.n_gpu_layers = 999;
 #endif
 
-    llama_model_kv_override * kv_overrides = nullptr;
-    if (params->kv_overrides) {
-        auto v = (std::vector<llama_model_kv_override>*)params->kv_overrides;
-        kv_overrides = v->data();
-    }
-    llama_model_loader ml(fname_inp, use_mmap, /*check_tensors*/ true, kv_overrides);
-    ml.init_mappings(false); // no prefetching
+    return result;
+}
 
-    llama_model model;
-    llm_load_arch(ml, model);
-    llm_load_hparams(ml, model);
+struct llama_context_params llama_context_default_params() {
+    struct llama_context_params result = {
+        /*.n_world                     =*/ 1,
+        /*.rank                        =*/ 0,
+        /*.n_layer_window              =*/ {32},
+        /*.n_layer_extra               =*/ {0},
+        /*.tp_ffn_share                =*/ {0},
+        /*.n_gpu_layers                =*/ 0,
+        /*.n_cycles                    =*/ 0,
+        /*.prefetch                    =*/ false,
+        /*.force                       =*/ false,
+        /*.release_policy              =*/ LLAMA_RELEASE_POLICY_OFF,
+        /*.async_comm                  =*/ false,
+        /*.residency_stats             =*/ false,
+        /*.master_priority             =*/ 1.01,
+        /*.keep_out_in_metal           =*/ true,
+        /*.keep_out_in_cuda            =*/ false,
+        /*.master_ip                   =*/ nullptr,
+        /*.next_node_ip                =*/ nullptr,
+        /*.data_port                   =*/ 9000,
+        /*.signal_port                 =*/ 10000,
+        /*.tp_port                     =*/ 11000,
+        /*.fail_timeout                =*/ 0,
+        /*.kv_replicate                =*/ false,
+        /*.n_ctx                       =*/ 512,
+        /*.n_predict                   =*/ 512,
+        /*.n_batch                     =*/ 2048,
+        /*.n_ubatch                    =*/ 512,
+        /*.n_micro_batch               =*/ 0,
+        /*.n_seq_max                   =*/ 1,
+        /*.n_threads                   =*/ GGML_DEFAULT_N_THREADS, // TODO: better default
+        /*.n_threads_batch             =*/ GGML_DEFAULT_N_THREADS,
+        /*.rope_scaling_type           =*/ LLAMA_ROPE_SCALING_TYPE_UNSPECIFIED,
+        /*.pooling_type                =*/ LLAMA_POOLING_TYPE_UNSPECIFIED,
+        /*.attention_type              =*/ LLAMA_ATTENTION_TYPE_UNSPECIFIED,
+        /*.rope_freq_base              =*/ 0.0f,
+        /*.rope_freq_scale             =*/ 0.0f,
+        /*.yarn_ext_factor             =*/ -1.0f,
+        /*.yarn_attn_factor            =*/ 1.0f,
+        /*.yarn_beta_fast              =*/ 32.0f,
+        /*.yarn_beta_slow              =*/ 1.0f,
+        /*.yarn_orig_ctx               =*/ 0,
+        /*.defrag_thold                =*/ -1.0f,
+        /*.cb_eval                     =*/ nullptr,
+        /*.cb_eval_user_data           =*/ nullptr,
+        /*.type_k                      =*/ GGML_TYPE_F16,
+        /*.type_v                      =*/ GGML_TYPE_F16,
+        /*.comm_type                   =*/ GGML_TYPE_F32,
+        /*.logits_all                  =*/ false,
+        /*.embeddings                  =*/ false,
+        /*.offload_kqv                 =*/ true,
+        /*.flash_attn                  =*/ false,
+        /*.no_perf                     =*/ true,
+        /*.abort_callback              =*/ nullptr,
+        /*.abort_callback_data         =*/ nullptr,
+    };
 
-    struct quantize_state_internal qs(model, params);
+    return result;
+}
 
-    if (params->only_copy) {
-        ftype = model.ftype;
-    }
-    const std::unordered_map<std::string, std::vector<float>> * imatrix_data = nullptr;
-    if (params->imatrix) {
-        imatrix_data = static_cast<const std::unordered_map<std::string, std::vector<float>>*>(params->imatrix);
-        if (imatrix_data) {
-            LLAMA_LOG_INFO("================================ Have weights data with %d entries\n",int(imatrix_data->size()));
-            qs.has_imatrix = true;
-            // check imatrix for nans or infs
-            for (const auto & kv : *imatrix_data) {
-                for (float f : kv.second) {
-                    if (!std::isfinite(f)) {
-                        throw std::runtime_error(format("imatrix contains non-finite value %f\n", f));
-                    }
-                }
-            }
-        }
-    }
+struct llama_sampler_chain_params llama_sampler_chain_default_params() {
+    struct llama_sampler_chain_params result = {
+        /*.no_perf                     =*/ true,
+    };
 
-    const size_t align = GGUF_DEFAULT_ALIGNMENT;
-    struct gguf_context * ctx_out = gguf_init_empty();
+    return result;
+}
 
-    // copy the KV pairs from the input file
-    gguf_set_kv     (ctx_out, ml.meta);
-    gguf_set_val_u32(ctx_out, "general.quantization_version", GGML_QNT_VERSION); // TODO: use LLM_KV
-    gguf_set_val_u32(ctx_out, "general.file_type", ftype); // TODO: use LLM_KV
+struct llama_model_quantize_params llama_model_quantize_default_params() {
+    struct llama_model_quantize_params result = {
+        /*.nthread                     =*/ 0,
+        /*.ftype                       =*/ LLAMA_FTYPE_MOSTLY_Q5_1,
+        /*.output_tensor_type          =*/ GGML_TYPE_COUNT,
+        /*.token_embedding_type        =*/ GGML_TYPE_COUNT,
+        /*.allow_requantize            =*/ false,
+        /*.quantize_output_tensor      =*/ true,
+        /*.only_copy                   =*/ false,
+        /*.pure                        =*/ false,
+        /*.keep_split                  =*/ false,
+        /*.imatrix                     =*/ nullptr,
+        /*.kv_overrides                =*/ nullptr,
+        /*.layer_ftypes                =*/ nullptr,
+        /*.hybrid_ftype                =*/ LLAMA_FTYPE_GUESSED,
+        /*.hybrid_budget               =*/ 0.0f,
+        /*.hybrid_window               =*/ 1,
+    };
 
-    // Remove split metadata
-    gguf_remove_key(ctx_out, ml.llm_kv(LLM_KV_SPLIT_NO).c_str());
-    gguf_remove_key(ctx_out, ml.llm_kv(LLM_KV_SPLIT_COUNT).c_str());
-    gguf_remove_key(ctx_out, ml.llm_kv(LLM_KV_SPLIT_TENSORS_COUNT).c_str());
+    return result;
+}
 
-    if (params->kv_overrides) {
-        const std::vector<llama_model_kv_override> & overrides = *(const std::vector<llama_model_kv_override> *)params->kv_overrides;
-        for (auto & o : overrides) {
-            if (o.key[0] == 0) break;
-            if (o.tag == LLAMA_KV_OVERRIDE_TYPE_FLOAT) {
-                gguf_set_val_f32(ctx_out, o.key, o.val_f64);
-            } else if (o.tag == LLAMA_KV_OVERRIDE_TYPE_INT) {
-                gguf_set_val_i32(ctx_out, o.key, o.val_i64);
-            } else if (o.tag == LLAMA_KV_OVERRIDE_TYPE_BOOL) {
-                gguf_set_val_bool(ctx_out, o.key, o.val_bool);
-            } else if (o.tag == LLAMA_KV_OVERRIDE_TYPE_STR) {
-                gguf_set_val_str(ctx_out, o.key, o.val_str);
-            } else {
-                LLAMA_LOG_WARN("%s: unknown KV override type for key %s\n", __func__, o.key);
-            }
-        }
-    }
+size_t llama_max_devices(void) {
+    return 16;
+}
 
-    for (int i = 0; i < ml.n_tensors; ++i) {
-        const struct ggml_tensor * meta = ml.get_tensor_meta(i);
+bool llama_supports_mmap(void) {
+    return llama_mmap::SUPPORTED;
+}
 
-        const std::string name = ggml_get_name(meta);
+bool llama_supports_mlock(void) {
+    return llama_mlock::SUPPORTED;
+}
 
-        // TODO: avoid hardcoded tensor names - use the TN_* constants
-        if (name.find("attn_v.weight")   != std::string::npos ||
-            name.find("attn_qkv.weight") != std::string::npos ||
-            name.find("attn_kv_b.weight")!= std::string::npos) {
-            ++qs.n_attention_wv;
-        } else if (name == LLM_TN(model.arch)(LLM_TENSOR_OUTPUT, "weight")) {
-            qs.has_output = true;
-        }
-    }
+bool llama_supports_gpu_offload(void) {
+#if defined(GGML_USE_VULKAN) || \
+    defined(GGML_USE_SYCL) || defined(GGML_USE_KOMPUTE) || defined(GGML_USE_RPC)
+    // Defined when llama.cpp is compiled with support for offloading model layers to GPU.
+    return true;
+#else
+    return ggml_backend_dev_by_type(GGML_BACKEND_DEVICE_TYPE_GPU) != nullptr ||
+        ggml_backend_dev_by_type(GGML_BACKEND_DEVICE_TYPE_GPU_FULL) != nullptr;
+#endif
+}
 
-    qs.n_ffn_down = qs.n_ffn_gate = qs.n_ffn_up = (int)model.hparams.n_layer;
+void llama_backend_init(void) {
+    ggml_time_init();
 
-    // sanity checks
+    // needed to initialize f16 tables
     {
-        const auto & n_head_kv_iter = model.hparams.n_head_kv_arr.begin();
-        // attention layers have a non-zero number of kv heads
-        int32_t n_attn_layer = model.hparams.n_layer - std::count(n_head_kv_iter, n_head_kv_iter + model.hparams.n_layer, 0);
-        if (llama_model_has_encoder(&model)) {
-            n_attn_layer *= 3;
-        }
-        GGML_ASSERT((qs.n_attention_wv == n_attn_layer) && "n_attention_wv is unexpected");
+        struct ggml_init_params params = { 0, NULL, false };
+        struct ggml_context * ctx = ggml_init(params);
+        ggml_free(ctx);
     }
+}
 
-    size_t total_size_org = 0;
-    size_t total_size_new = 0;
+void llama_numa_init(enum ggml_numa_strategy numa) {
+    if (numa != GGML_NUMA_STRATEGY_DISABLED) {
+        ggml_numa_init(numa);
+    }
+}
 
-    std::vector<std::thread> workers;
-    workers.reserve(nthread);
+void llama_attach_threadpool(
+             struct llama_context * ctx,
+        ggml_threadpool_t   threadpool,
+        ggml_threadpool_t   threadpool_batch) {
+    ctx->threadpool       = threadpool;
+    ctx->threadpool_batch = threadpool_batch ? threadpool_batch : threadpool;
+}
 
-    int idx = 0;
+void llama_detach_threadpool(struct llama_context * ctx) {
+    ctx->threadpool       = nullptr;
+    ctx->threadpool_batch = nullptr;
+}
 
-    std::vector<no_init<uint8_t>> read_data;
-    std::vector<no_init<uint8_t>> work;
-    std::vector<no_init<float>> f32_conv_buf;
+void llama_backend_free(void) {
+    ggml_quantize_free();
+}
 
-    uint16_t n_split = 1;
-    // Assume split index is continuous
-    if (params->keep_split) {
-        for (int i = 0; i < ml.n_tensors; ++i) {
-            n_split = std::max(uint16_t(ml.get_weight(i)->idx+1), n_split);
-        }
-    }
-    std::vector<gguf_context*> ctx_outs(n_split, NULL);
-    ctx_outs[0] = ctx_out;
+int64_t llama_time_us(void) {
+    return ggml_time_us();
+}
 
-    // populate the original tensors so we get an initial meta data
-    for (int i = 0; i < ml.n_tensors; ++i) {
-        auto weight = ml.get_weight(i);
-        uint16_t i_split = params->keep_split ? weight->idx : 0;
-        struct ggml_tensor * tensor = weight->tensor;
-        if (ctx_outs[i_split] == NULL) {
-            ctx_outs[i_split] = gguf_init_empty();
-        }
-        gguf_add_tensor(ctx_outs[i_split], tensor);
-    }
+struct llama_model * llama_load_model_from_file(const char * path_model, struct llama_model_params params) {
+    ggml_time_init();
 
-    // Set split info if needed
-    if (n_split > 1) {
-        for (size_t i = 0; i < ctx_outs.size(); ++i) {
-            gguf_set_val_u16(ctx_outs[i], ml.llm_kv(LLM_KV_SPLIT_NO).c_str(), i);
-            gguf_set_val_u16(ctx_outs[i], ml.llm_kv(LLM_KV_SPLIT_COUNT).c_str(), n_split);
-            gguf_set_val_i32(ctx_outs[i], ml.llm_kv(LLM_KV_SPLIT_TENSORS_COUNT).c_str(), ml.n_tensors);
-        }
+    llama_model * model = new llama_model;
+
+    unsigned cur_percentage = 0;
+    if (params.progress_callback == NULL) {
+        params.progress_callback_user_data = &cur_percentage;
+        params.progress_callback = [](float progress, void * ctx) {
+            unsigned * cur_percentage_p = (unsigned *) ctx;
+            unsigned percentage = (unsigned) (100 * progress);
+            while (percentage > *cur_percentage_p) {
+                *cur_percentage_p = percentage;
+                LLAMA_LOG_CONT(".");
+                if (percentage >= 100) {
+                    LLAMA_LOG_CONT("\n");
+                }
+            }
+            return true;
+        };
     }
 
-    int cur_split = -1;
-    std::ofstream fout;
-    auto close_ofstream = [&]() {
-        // Write metadata and close file handler
-        if (fout.is_open()) {
-            fout.seekp(0);
-            std::vector<uint8_t> data(gguf_get_meta_size(ctx_outs[cur_split]));
-            gguf_get_meta_data(ctx_outs[cur_split], data.data());
-            fout.write((const char *) data.data(), data.size());
-            fout.close();
-        }
-    };
-    auto new_ofstream = [&](int index) {
-        cur_split = index;
-        GGML_ASSERT(ctx_outs[cur_split] && "Find uninitialized gguf_context");
-        std::string fname = fname_out;
-        if (params->keep_split) {
-            char split_path[PATH_MAX] = {0};
-            llama_split_path(split_path, sizeof(split_path), fname_out.c_str(), cur_split, n_split);
-            fname = std::string(split_path);
+    if (params.rpc_servers != nullptr && params.rpc_servers[0] != '\0') {
+        // split the servers set them into model->rpc_servers
+        std::string servers(params.rpc_servers);
+        size_t pos = 0;
+        while ((pos = servers.find(',')) != std::string::npos) {
+            std::string server = servers.substr(0, pos);
+            model->rpc_servers.push_back(server);
+            servers.erase(0, pos + 1);
         }
+        model->rpc_servers.push_back(servers);
+    }
 
-        fout = std::ofstream(fname, std::ios::binary);
-        fout.exceptions(std::ofstream::failbit); // fail fast on write errors
-        const size_t meta_size = gguf_get_meta_size(ctx_outs[cur_split]);
-        // placeholder for the meta data
-        ::zeros(fout, meta_size);
-    };
+    // create list of devices to use with this model
+    // currently, we use all available devices
+    // TODO: rework API to give user more control over device selection
+    for (size_t i = 0; i < ggml_backend_dev_count(); ++i) {
+        ggml_backend_dev_t dev = ggml_backend_dev_get(i);
+        switch (ggml_backend_dev_type(dev)) {
+            case GGML_BACKEND_DEVICE_TYPE_CPU:
+            case GGML_BACKEND_DEVICE_TYPE_CPU_FULL:
+                // skip CPU backends since they are `handled separately
+                break;
 
-    const auto tn = LLM_TN(model.arch);
-    new_ofstream(0);
-    for (int i = 0; i < ml.n_tensors; ++i) {
-        auto weight = ml.get_weight(i);
-        struct ggml_tensor * tensor = weight->tensor;
-        if (weight->idx != cur_split && params->keep_split) {
-            close_ofstream();
-            new_ofstream(weight->idx);
+            case GGML_BACKEND_DEVICE_TYPE_GPU:
+            case GGML_BACKEND_DEVICE_TYPE_GPU_FULL:
+                model->devices.push_back(dev);
+                break;
         }
+    }
+
+    (void)path_model;
 
-        const std::string name = ggml_get_name(tensor);
+    return model;
+}
 
-        if (!ml.use_mmap) {
-            if (read_data.size() < ggml_nbytes(tensor)) {
-                read_data.resize(ggml_nbytes(tensor));
-            }
-            tensor->data = read_data.data();
-        }
-        ml.load_data_for(tensor);
+void llama_free_model(struct llama_model * model) {
+    delete model;
+}
 
-        LLAMA_LOG_INFO("[%4d/%4d] %36s - [%s], type = %6s, ",
-               ++idx, ml.n_tensors,
-               ggml_get_name(tensor),
-               llama_format_tensor_shape(tensor).c_str(),
-               ggml_type_name(tensor->type));
+static uint32_t map_rank_to_port(uint32_t rank, uint32_t data_port) {
+    return data_port + rank;
+}
 
-        // This used to be a regex, but <regex> has an extreme cost to compile times.
-        bool quantize = name.rfind("weight") == name.size() - 6; // ends with 'weight'?
+static std::string try_connect(llama_context * ctx, uint32_t rank, TopoRebuildHelperInfo * infos, uint32_t n_world, zmq::socket_t ** socket){
+    auto prev_rank = (rank - 1 + n_world) % n_world;
+    std::string ip = infos[prev_rank].dev_info.next_ip;
+    auto port = map_rank_to_port(rank, ctx->data_port);
+    
+    if (!is_port_open(ip, port)) {
+        *socket = nullptr;
+        return "";
+    }
+    std::string send_endp = "tcp://" + ip + ":" + std::to_string(port);
+    *socket = new zmq::socket_t(*ctx->sock_context, zmq::socket_type::push);
+    try {
+        (*socket)->connect(send_endp);
+    } catch (const zmq::error_t& e) {
+        delete *socket;
+        *socket = nullptr;
+        return "";
+    }
+    return ip;
+}
 
-        // quantize only 2D and 3D tensors (experts)
-        quantize &= (ggml_n_dims(tensor) >= 2);
+// outputs for the master take the direct link of this device when the master port can be reached from here,
+// otherwise they take the ring and the devices after this one pass them on
+static void llama_route_master(llama_context & lctx) {
+    lctx.comm.relay = &lctx.master_socket;
+    if (lctx.master_socket == lctx.send_socket) {
+        return; // the next node is the master
+    }
 
-        // do not quantize norm tensors
-        quantize &= name.find("_norm.weight") == std::string::npos;
+    const uint32_t port = map_rank_to_port(0, lctx.data_port);
+    if (is_port_open(lctx.master_ip, port)) {
+        lctx.master_direct = true;
+        LLAMA_LOG_INFO("%s: outputs for the master go directly to %s:%u\n", __func__, lctx.master_ip.c_str(), port);
+        return;
+    }
 
-        quantize &= params->quantize_output_tensor || name != "output.weight";
-        quantize &= !params->only_copy;
+    LLAMA_LOG_WARN("%s: master port %s:%u is not reachable, outputs for the master take the ring\n", __func__, lctx.master_ip.c_str(), port);
+    if (lctx.comm.is_async()) {
+        lctx.comm.flush();
+    }
+    lctx.master_socket->set(zmq::sockopt::linger, 0);
+    lctx.master_socket->close();
+    delete lctx.master_socket;
+    lctx.master_socket = lctx.send_socket;
+}
+
+// partial output of the SiLU-gated FFN over the rows from n_keep on, x and out are [n_embd, n_tokens]
+static bool llama_tp_ffn_compute(
+        struct ggml_tensor * gate,
+        struct ggml_tensor * up,
+        struct ggml_tensor * down,
+                   int64_t   n_keep,
+                   int64_t   n_tokens,
+               const float * x,
+                     float * out,
+                       int   n_threads,
+      std::vector<uint8_t> & buf) {
+    const int64_t n_embd = gate->ne[0];
+    const int64_t n_rest = gate->ne[1] - n_keep;
+
+    // activations, and the f32 intermediates and work buffer of the matmuls
+    const size_t mem_size = ggml_graph_overhead() + 16 * ggml_tensor_overhead() +
+                            (3 * n_embd + 5 * n_rest) * n_tokens * sizeof(float) + 64 * n_threads + 1024 * 1024;
+    buf.resize(mem_size);
+
+    struct ggml_init_params params = {
+        /*.mem_size   =*/ buf.size(),
+        /*.mem_buffer =*/ buf.data(),
+        /*.no_alloc   =*/ false,
+    };
+    struct ggml_context * ctx = ggml_init(params);
+    if (ctx == nullptr) {
+        return false;
+    }
 
-        // do not quantize expert gating tensors
-        // NOTE: can't use LLM_TN here because the layer number is not known
-        quantize &= name.find("ffn_gate_inp.weight") == std::string::npos;
+    struct ggml_tensor * inp = ggml_new_tensor_2d(ctx, GGML_TYPE_F32, n_embd, n_tokens);
+    memcpy(inp->data, x, ggml_nbytes(inp));
 
-        // do not quantize positional embeddings and token types (BERT)
-        quantize &= name != LLM_TN(model.arch)(LLM_TENSOR_POS_EMBD,    "weight");
-        quantize &= name != LLM_TN(model.arch)(LLM_TENSOR_TOKEN_TYPES, "weight");
+    struct ggml_tensor * up_r   = ggml_view_2d(ctx, up,   n_embd, n_rest,      up->nb[1],   n_keep * up->nb[1]);
+    struct ggml_tensor * gate_r = ggml_view_2d(ctx, gate, n_embd, n_rest,      gate->nb[1], n_keep * gate->nb[1]);
+    struct ggml_tensor * down_r = ggml_view_2d(ctx, down, n_rest, down->ne[1], down->nb[1], ggml_row_size(down->type, n_keep));
 
-        // do not quantize Mamba's small yet 2D weights
-        // NOTE: can't use LLM_TN here because the layer number is not known
-        quantize &= name.find("ssm_conv1d.weight") == std::string::npos;
+    struct ggml_tensor * cur = ggml_mul(ctx, ggml_silu(ctx, ggml_mul_mat(ctx, gate_r, inp)), ggml_mul_mat(ctx, up_r, inp));
+    cur = ggml_mul_mat(ctx, down_r, cur);
 
-        // do not quantize RWKV's time_mix_first tensors
-        quantize &= name.find("time_mix_first.weight") == std::string::npos;
-        quantize &= name.find("time_mix_w1.weight") == std::string::npos;
-        quantize &= name.find("time_mix_w2.weight") == std::string::npos;
-        quantize &= name.find("time_mix_decay_w1.weight") == std::string::npos;
-        quantize &= name.find("time_mix_decay_w2.weight") == std::string::npos;
+    struct ggml_cgraph * gf = ggml_new_graph(ctx);
+    ggml_build_forward_expand(gf, cur);
 
-        // do not quantize relative position bias (T5)
-        quantize &= name.find("attn_rel_b.weight") == std::string::npos;
+    const bool ok = ggml_graph_compute_with_ctx(ctx, gf, n_threads) == GGML_STATUS_SUCCESS;
+    if (ok) {
+        memcpy(out, cur->data, ggml_nbytes(cur));
+    }
+    ggml_free(ctx);
+    return ok;
+}
 
-        enum ggml_type new_type;
-        void * new_data;
-        size_t new_size;
+// on the next node of a node that splits its FFN: compute the rows it leaves for every request, from a mapping
+// of the model file of our own as the loader only mapped the layers of this node
+static void llama_tp_serve_loop(llama_context * ctx) {
+    auto & tp = ctx->tp;
+    const llama_model & model = ctx->model;
+    const LLM_TN tn(model.arch);
 
-        if (quantize) {
-            new_type = default_type;
+    zmq::socket_t socket(*ctx->sock_context, zmq::socket_type::rep);
+    socket.set(zmq::sockopt::rcvtimeo, 100);
+    socket.set(zmq::sockopt::linger, 0);
 
-            // get more optimal quantization type based on the tensor shape, layer, etc.
-            if (!params->pure && ggml_is_quantized(default_type)) {
-                new_type = llama_tensor_get_type(qs, new_type, tensor, ftype);
-            }
-            if (params->token_embedding_type < GGML_TYPE_COUNT && strcmp(tensor->name, "token_embd.weight") == 0) {
-                new_type = params->token_embedding_type;
-            }
-            if (params->output_tensor_type < GGML_TYPE_COUNT && strcmp(tensor->name, "output.weight") == 0) {
-                new_type = params->output_tensor_type;
-            }
+    const std::string endp = "tcp://*:" + std::to_string(map_rank_to_port(ctx->bind_rank, ctx->tp_port));
+    try {
+        socket.bind(endp);
+    } catch (const zmq::error_t & e) {
+        LLAMA_LOG_ERROR("%s: failed to bind %s: %s\n", __func__, endp.c_str(), e.what());
+        return;
+    }
 
-            // If we've decided to quantize to the same type the tensor is already
-            // in then there's nothing to do.
-            quantize = tensor->type != new_type;
+    struct ggml_context * meta = nullptr;
+    struct gguf_init_params params = {
+        /*.no_alloc =*/ true,
+        /*.ctx      =*/ &meta,
+    };
+    struct gguf_context * gguf = gguf_init_from_file(model.path.c_str(), params);
+
+    std::unique_ptr<llama_file> file;
+    std::unique_ptr<llama_mmap> mapping;
+    if (gguf != nullptr) {
+        try {
+            file.reset(new llama_file(model.path.c_str(), "rb"));
+            mapping.reset(new llama_mmap(file.get(), 0));
+        } catch (const std::exception & e) {
+            LLAMA_LOG_ERROR("%s: %s\n", __func__, e.what());
+            mapping.reset();
         }
+    }
+    if (mapping == nullptr) {
+        // the previous node gets empty replies and stops splitting
+        LLAMA_LOG_ERROR("%s: failed to map %s, cannot compute FFN rows of the previous node\n", __func__, model.path.c_str());
+    }
 
-        if (!quantize) {
-            new_type = tensor->type;
-            new_data = tensor->data;
-            new_size = ggml_nbytes(tensor);
-            LLAMA_LOG_INFO("size = %8.3f MB\n", ggml_nbytes(tensor)/1024.0/1024.0);
-        } else {
-            const int64_t nelements = ggml_nelements(tensor);
+    // weights in split model files are not found and get empty replies as well
+    auto weight = [&](llm_tensor type, uint32_t il) -> ggml_tensor * {
+        if (mapping == nullptr) {
+            return nullptr;
+        }
+        const std::string name = tn(type, "weight", il);
+        ggml_tensor * t  = ggml_get_tensor(meta, name.c_str());
+        const int     id = gguf_find_tensor(gguf, name.c_str());
+        if (t == nullptr || id < 0) {
+            return nullptr;
+        }
+        const size_t offs = gguf_get_data_offset(gguf) + gguf_get_tensor_offset(gguf, id);
+        if (offs + ggml_nbytes(t) > mapping->size) {
+            return nullptr;
+        }
+        t->data = (uint8_t *) mapping->addr + offs;
+        return t;
+    };
 
-            const float * imatrix = nullptr;
-            if (imatrix_data) {
-                auto it = imatrix_data->find(tensor->name);
-                if (it == imatrix_data->end()) {
-                    LLAMA_LOG_INFO("\n====== %s: did not find weights for %s\n", __func__, tensor->name);
-                } else {
-                    if (it->second.size() == (size_t)tensor->ne[0]*tensor->ne[2]) {
-                        imatrix = it->second.data();
-                    } else {
-                        LLAMA_LOG_INFO("\n====== %s: imatrix size %d is different from tensor size %d for %s\n", __func__,
-                                int(it->second.size()), int(tensor->ne[0]*tensor->ne[2]), tensor->name);
+    LLAMA_LOG_INFO("%s: computing FFN rows of the previous node on %s\n", __func__, endp.c_str());
 
-                        // this can happen when quantizing an old mixtral model with split tensors with a new incompatible imatrix
-                        // this is a significant error and it may be good idea to abort the process if this happens,
-                        // since many people will miss the error and not realize that most of the model is being quantized without an imatrix
-                        // tok_embd should be ignored in this case, since it always causes this warning
-                        if (name != tn(LLM_TENSOR_TOKEN_EMBD, "weight")) {
-                            throw std::runtime_error(format("imatrix size %d is different from tensor size %d for %s",
-                                    int(it->second.size()), int(tensor->ne[0]*tensor->ne[2]), tensor->name));
-                        }
-                    }
-                }
-            }
-            if ((new_type == GGML_TYPE_IQ2_XXS ||
-                 new_type == GGML_TYPE_IQ2_XS  ||
-                 new_type == GGML_TYPE_IQ2_S   ||
-                 new_type == GGML_TYPE_IQ1_S   ||
-                (new_type == GGML_TYPE_IQ1_M && strcmp(tensor->name, "token_embd.weight") && strcmp(tensor->name, "output.weight"))  ||
-                (new_type == GGML_TYPE_Q2_K && params->ftype == LLAMA_FTYPE_MOSTLY_Q2_K_S && strcmp(tensor->name, "token_embd.weight") != 0)) && !imatrix) {
-                LLAMA_LOG_ERROR("\n\n============================================================\n");
-                LLAMA_LOG_ERROR("Missing importance matrix for tensor %s in a very low-bit quantization\n", tensor->name);
-                LLAMA_LOG_ERROR("The result will be garbage, so bailing out\n");
-                LLAMA_LOG_ERROR("============================================================\n\n");
-                throw std::runtime_error(format("Missing importance matrix for tensor %s in a very low-bit quantization", tensor->name));
+    std::vector<uint8_t> buf;
+    while (!tp.stop) {
+        std::vector<zmq::message_t> msgs;
+        try {
+            if (!zmq::recv_multipart(socket, std::back_inserter(msgs))) {
+                continue;
             }
+        } catch (const zmq::error_t & e) {
+            LLAMA_LOG_ERROR("%s: %s\n", __func__, e.what());
+            break;
+        }
 
-            float * f32_data;
+        zmq::message_t reply;
+        if (msgs.size() == 2 && msgs[0].size() == sizeof(llama_tp::request)) {
+            const auto * req = (const llama_tp::request *) msgs[0].data();
 
-            if (tensor->type == GGML_TYPE_F32) {
-                f32_data = (float *) tensor->data;
-            } else if (ggml_is_quantized(tensor->type) && !params->allow_requantize) {
-                throw std::runtime_error(format("requantizing from type %s is disabled", ggml_type_name(tensor->type)));
-            } else {
-                llama_tensor_dequantize_internal(tensor, f32_conv_buf, workers, nelements, nthread);
-                f32_data = (float *) f32_conv_buf.data();
+            ggml_tensor * gate = weight(LLM_TENSOR_FFN_GATE, req->il);
+            ggml_tensor * up   = weight(LLM_TENSOR_FFN_UP,   req->il);
+            ggml_tensor * down = weight(LLM_TENSOR_FFN_DOWN, req->il);
+            if (gate != nullptr && up != nullptr && down != nullptr && req->n_keep < gate->ne[1] &&
+                msgs[1].size() == gate->ne[0] * req->n_tokens * sizeof(float)) {
+                reply.rebuild(msgs[1].size());
+                if (!llama_tp_ffn_compute(gate, up, down, req->n_keep, req->n_tokens, (const float *) msgs[1].data(),
+                                          (float *) reply.data(), ctx->cparams.n_threads, buf)) {
+                    reply.rebuild(0);
+                }
             }
+        }
+        try {
+            socket.send(reply, zmq::send_flags::none);
+        } catch (const zmq::error_t & e) {
+            LLAMA_LOG_ERROR("%s: %s\n", __func__, e.what());
+            break;
+        }
+    }
 
-            LLAMA_LOG_INFO("converting to %s .. ", ggml_type_name(new_type));
-            fflush(stdout);
+    if (gguf != nullptr) {
+        gguf_free(gguf);
+    }
+    if (meta != nullptr) {
+        ggml_free(meta);
+    }
+}
 
-            if (work.size() < (size_t)nelements * 4) {
-                work.resize(nelements * 4); // upper bound on size
-            }
-            new_data = work.data();
+// on the first pass, when the ring is final: connect to the next node if this node splits its FFN with it,
+// and serve the rows the previous node splits off
+static void llama_tp_start(llama_context & lctx) {
+    auto       & tp      = lctx.tp;
+    const auto & cparams = lctx.cparams;
+    const uint32_t my_rank = cparams.rank;
+    const uint32_t n_world = cparams.n_world;
 
-            const int64_t n_per_row = tensor->ne[0];
-            const int64_t nrows = tensor->ne[1];
+    tp.started = true;
 
-            static const int64_t min_chunk_size = 32 * 512;
-            const int64_t chunk_size = (n_per_row >= min_chunk_size ? n_per_row : n_per_row * ((min_chunk_size + n_per_row - 1)/n_per_row));
+    const uint32_t prev_share = cparams.tp_ffn_share[(my_rank + n_world - 1) % n_world];
+    if (prev_share > 0 && prev_share < 1000) {
+        tp.stop   = false;
+        tp.thread = std::thread(llama_tp_serve_loop, &lctx);
+    }
 
-            const int64_t nelements_matrix = tensor->ne[0] * tensor->ne[1];
-            const int64_t nchunk = (nelements_matrix + chunk_size - 1)/chunk_size;
-            const int64_t nthread_use = nthread > 1 ? std::max((int64_t)1, std::min((int64_t)nthread, nchunk)) : 1;
+    const uint32_t share = cparams.tp_ffn_share[my_rank];
+    if (share == 0 || share >= 1000) {
+        return;
+    }
 
-            // quantize each expert separately since they have different importance matrices
-            new_size = 0;
-            for (int64_t i03 = 0; i03 < tensor->ne[2]; ++i03) {
-                const float * f32_data_03 = f32_data + i03 * nelements_matrix;
-                void * new_data_03 = (char *)new_data + ggml_row_size(new_type, n_per_row) * i03 * nrows;
-                const float * imatrix_03 = imatrix ? imatrix + i03 * n_per_row : nullptr;
+    std::string next_ip;
+    uint32_t    next_bind_rank;
+    {
+        std::lock_guard<std::mutex> lock(lctx.ring.mutex);
+        next_ip        = lctx.next_node_ip;
+        next_bind_rank = cparams.original_next_rank;
+    }
+    const std::string endp = "tcp://" + next_ip + ":" + std::to_string(map_rank_to_port(next_bind_rank, lctx.tp_port));
 
-                new_size += llama_tensor_quantize_internal(new_type, f32_data_03, new_data_03, chunk_size, nrows, n_per_row, imatrix_03, workers, nthread_use);
-            }
-            LLAMA_LOG_INFO("size = %8.2f MiB -> %8.2f MiB\n", ggml_nbytes(tensor)/1024.0/1024.0, new_size/1024.0/1024.0);
-        }
-        total_size_org += ggml_nbytes(tensor);
-        total_size_new += new_size;
+    // the pass waits for the rows of the next node, with fault tolerance no longer than a rank may stay silent
+    tp.timeout_ms = lctx.ring.enabled() ? lctx.ring.fail_timeout_ms : 30000;
+    tp.socket     = new zmq::socket_t(*lctx.sock_context, zmq::socket_type::req);
+    tp.socket->set(zmq::sockopt::rcvtimeo, (int) tp.timeout_ms);
+    tp.socket->set(zmq::sockopt::linger, 0);
+    try {
+        tp.socket->connect(endp);
+    } catch (const zmq::error_t & e) {
+        LLAMA_LOG_ERROR("%s: failed to connect to %s: %s\n", __func__, endp.c_str(), e.what());
+        tp.close();
+        return;
+    }
+    tp.layers.resize(lctx.model.hparams.n_layer);
 
-        // update the gguf meta data as we go
-        gguf_set_tensor_type(ctx_outs[cur_split], name.c_str(), new_type);
-        gguf_set_tensor_data(ctx_outs[cur_split], name.c_str(), new_data, new_size);
+    LLAMA_LOG_INFO("%s: computing %.1f%% of the FFN rows of the CPU layers, the rest on %s\n", __func__, share / 10.0, endp.c_str());
+}
 
-        // write tensor data + padding
-        fout.write((const char *) new_data, new_size);
-        zeros(fout, GGML_PAD(new_size, align) - new_size);
+// the layers move on a reshard, drop the split of this node and stop serving the one of the previous node
+static void llama_tp_reset(llama_context & lctx) {
+    auto & tp = lctx.tp;
+
+    tp.halt();
+    tp.close();
+    tp.layers.clear();
+    tp.broken = false;
+
+    std::fill(std::begin(lctx.cparams.tp_ffn_share),      std::end(lctx.cparams.tp_ffn_share),      0);
+    std::fill(std::begin(lctx.setup_params.tp_ffn_share), std::end(lctx.setup_params.tp_ffn_share), 0);
+    lctx.graph_cache.clear();
+}
+
+void llama_init_sockets(struct llama_context * ctx, uint32_t n_world, uint32_t my_rank) {
+    if (n_world == 1) {
+        return; 
     }
-    close_ofstream();
-    for (auto & c:ctx_outs) {
-        gguf_free(c);
+
+    ctx->sock_context  = new zmq::context_t(2); 
+    ctx->send_socket   = new zmq::socket_t(*ctx->sock_context, zmq::socket_type::push);
+    ctx->recv_socket   = new zmq::socket_t(*ctx->sock_context, zmq::socket_type::pull);
+    ctx->signal_socket = new zmq::socket_t(*ctx->sock_context, zmq::socket_type::pull);
+
+    if (my_rank != 0 && my_rank != (n_world - 1)) {
+        ctx->master_socket = new zmq::socket_t(*ctx->sock_context, zmq::socket_type::push);
+    } else if (my_rank == (n_world - 1)) {
+        ctx->master_socket = ctx->send_socket; // No need for master_socket in the last rank, reuse send_socket for communication
     }
 
-    LLAMA_LOG_INFO("%s: model size  = %8.2f MB\n", __func__, total_size_org/1024.0/1024.0);
-    LLAMA_LOG_INFO("%s: quant size  = %8.2f MB\n", __func__, total_size_new/1024.0/1024.0);
+    ctx->bind_rank = my_rank;
 
-    if (qs.n_fallback > 0) {
-        LLAMA_LOG_WARN("%s: WARNING: %d of %d tensor(s) required fallback quantization\n",
-                __func__, qs.n_fallback, qs.n_k_quantized + qs.n_fallback);
+    const uint32_t next_rank = (my_rank + 1) % n_world;
+    std::string recv_endp   = "tcp://*:"                         + std::to_string(map_rank_to_port(my_rank,   ctx->data_port));
+    std::string send_endp   = "tcp://" + ctx->next_node_ip + ":" + std::to_string(map_rank_to_port(next_rank, ctx->data_port));
+    std::string master_endp = "tcp://" + ctx->master_ip    + ":" + std::to_string(map_rank_to_port(0,         ctx->data_port));
+    std::string signal_endp = "tcp://*:"                         + std::to_string(map_rank_to_port(my_rank,   ctx->signal_port));
+
+    try {
+        ctx->recv_socket->bind(recv_endp);
+        ctx->signal_socket->bind(signal_endp);
+        ctx->send_socket->connect(send_endp);
+        if (ctx->master_socket && my_rank != (n_world - 1)) {
+            ctx->master_socket->connect(master_endp);
+        }
+    } catch (const zmq::error_t &e) {
+        LLAMA_LOG_INFO("Error binding/connecting recv socket to endpoint: %s", e.what());
+        exit(1);
     }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
 }
 
-static void llama_lora_adapter_init_internal(struct llama_model * model, const char * path_lora, struct llama_lora_adapter & adapter) {
-    LLAMA_LOG_INFO("%s: loading lora adapter from '%s' ...\n", __func__, path_lora);
+int llama_gather_device_info(struct llama_context * ctx, struct device_info * dev_info_set) {
+    uint32_t n_world = ctx->cparams.n_world;
+    if (n_world == 1) return 0;
+    GGML_ASSERT(dev_info_set != nullptr);
+    GGML_ASSERT(ctx != nullptr && ctx->send_socket != nullptr);
 
-    ggml_context * ctx = nullptr;
-    struct gguf_init_params meta_gguf_params = {
-        /* .no_alloc = */ true,
-        /* .ctx      = */ &ctx,
-    };
-    struct gguf_context * ctx_gguf = gguf_init_from_file(path_lora, meta_gguf_params);
-    if (!ctx_gguf) {
-        throw std::runtime_error("failed to load lora adapter file from " + std::string(path_lora));
-    }
+    // master rank sends its device info to its next rank
+    try {
+        char * buffer = nullptr;
+        size_t buffer_size = serialize(&dev_info_set[0], &buffer);
 
-    // check metadata
-    {
-        auto get_kv_str = [&](const std::string & key) -> std::string {
-            int id = gguf_find_key(ctx_gguf, key.c_str());
-            return id < 0 ? "" : std::string(gguf_get_val_str(ctx_gguf, id));
-        };
-        auto get_kv_f32 = [&](const std::string & key) -> float {
-            int id = gguf_find_key(ctx_gguf, key.c_str());
-            return id < 0 ? 0.0f : gguf_get_val_f32(ctx_gguf, id);
-        };
-        LLM_KV llm_kv = LLM_KV(LLM_ARCH_UNKNOWN);
+        std::vector<zmq::message_t> send_msgs;
+        send_msgs.emplace_back(buffer, buffer_size);
+        zmq::send_multipart(*ctx->send_socket, send_msgs);
 
-        auto general_type = get_kv_str(llm_kv(LLM_KV_GENERAL_TYPE));
-        if (general_type != "adapter") {
-            gguf_free(ctx_gguf);
-            throw std::runtime_error("expect general.type to be 'adapter', but got: " + general_type);
-        }
+        free(buffer);
+    } catch (const zmq::error_t& e) {
+        LLAMA_LOG_INFO("Failed to send data: %s\n", e.what());
+        return -1;
+    }
 
-        auto general_arch_str = get_kv_str(llm_kv(LLM_KV_GENERAL_ARCHITECTURE));
-        auto general_arch = llm_arch_from_string(general_arch_str);
-        if (general_arch != model->arch) {
-            gguf_free(ctx_gguf);
-            throw std::runtime_error("model arch and LoRA arch mismatch");
-        }
+    // master rank receives aggregated device info from its previous rank (a barrier op)
+    std::vector<zmq::message_t> recv_msgs;
+    if (!zmq::recv_multipart(*ctx->recv_socket, std::back_inserter(recv_msgs))) {
+        return -1;
+    }
+    GGML_ASSERT(recv_msgs.size() == n_world);
 
-        auto adapter_type = get_kv_str(llm_kv(LLM_KV_ADAPTER_TYPE));
-        if (adapter_type != "lora") {
-            gguf_free(ctx_gguf);
-            throw std::runtime_error("expect adapter.type to be 'lora', but got: " + adapter_type);
-        }
+    for (size_t i = 0; i < recv_msgs.size(); i++) {
+        deserialize((const char *)recv_msgs[i].data(), &dev_info_set[i]);
+    }
+    return 0;
+}
 
-        adapter.alpha = get_kv_f32(llm_kv(LLM_KV_ADAPTER_LORA_ALPHA));
+int llama_send_device_info(struct llama_context * ctx, struct device_info * dev_info) {
+    // non-master ranks receive device info from their previous rank
+    std::vector<zmq::message_t> recv_msgs;
+    if (!zmq::recv_multipart(*ctx->recv_socket, std::back_inserter(recv_msgs))) {
+        return -1;
     }
 
-    int n_tensors = gguf_get_n_tensors(ctx_gguf);
+    GGML_ASSERT(dev_info != nullptr);
+    GGML_ASSERT(ctx != nullptr && ctx->send_socket != nullptr);
 
-    // contexts for each buffer type
-    std::map<ggml_backend_buffer_type_t, ggml_context *> ctx_map;
-    auto get_ctx_for_buft = [&](ggml_backend_buffer_type_t buft) -> ggml_context * {
-        auto it = ctx_map.find(buft);
-        if (it == ctx_map.end()) {
-            // add a new context
-            struct ggml_init_params params = {
-                /*.mem_size   =*/ n_tensors*ggml_tensor_overhead(),
-                /*.mem_buffer =*/ NULL,
-                /*.no_alloc   =*/ true,
-            };
-            ggml_context * buft_ctx = ggml_init(params);
-            ctx_map[buft] = buft_ctx;
-            return buft_ctx;
-        };
-        return it->second;
-    };
+    // non-master ranks aggregate their device info and forward it to their next rank
+    try {
+        char * buffer = nullptr;
+        size_t buffer_size = serialize(dev_info, &buffer);
 
-    // bundle lora_a and lora_b into pairs
-    std::map<std::string, llama_lora_weight> ab_map;
-    auto str_endswith = [](const std::string & str, const std::string & suffix) {
-        return str.size() >= suffix.size() && str.compare(str.size()-suffix.size(), suffix.size(), suffix) == 0;
-    };
-    for (ggml_tensor * cur = ggml_get_first_tensor(ctx); cur; cur = ggml_get_next_tensor(ctx, cur)) {
-        std::string name(cur->name);
-        if (str_endswith(name, ".lora_a")) {
-            replace_all(name, ".lora_a", "");
-            if (ab_map.find(name) == ab_map.end()) {
-                ab_map[name] = llama_lora_weight(cur, nullptr);
-            } else {
-                ab_map[name].a = cur;
-            }
-        } else if (str_endswith(name, ".lora_b")) {
-            replace_all(name, ".lora_b", "");
-            if (ab_map.find(name) == ab_map.end()) {
-                ab_map[name] = llama_lora_weight(nullptr, cur);
-            } else {
-                ab_map[name].b = cur;
-            }
-        } else {
-            gguf_free(ctx_gguf);
-            ggml_free(ctx);
-            throw std::runtime_error("LoRA tensor '" + name + "' has unexpected suffix");
-        }
+        recv_msgs.emplace_back(buffer, buffer_size);
+        zmq::send_multipart(*ctx->send_socket, recv_msgs);
+
+        free(buffer);
+    } catch (const zmq::error_t& e) {
+        LLAMA_LOG_INFO("Failed to send data: %s\n", e.what());
+        return -1;
     }
 
-    // add tensors
-    for (auto & it : ab_map) {
-        const std::string & name = it.first;
-        llama_lora_weight & w = it.second;
+    return 0;
+}
 
-        if (!w.a || !w.b) {
-            gguf_free(ctx_gguf);
-            ggml_free(ctx);
-            throw std::runtime_error("LoRA tensor pair for '" + name + "' is missing one component");
-        }
+int llama_bcast_startup_args(llama_context * ctx, uint32_t rank, startup_args * args) {
+    int32_t n_world = ctx->cparams.n_world;
+    if (n_world == 1) return 0;
+    GGML_ASSERT(ctx != nullptr && ctx->send_socket != nullptr);
 
-        // device buft and device ctx
-        auto * model_tensor = llama_get_model_tensor(model, name.c_str());
-        if (!model_tensor) {
-            gguf_free(ctx_gguf);
-            ggml_free(ctx);
-            throw std::runtime_error("LoRA tensor '" + name + "' does not exist in base model");
-        }
-        struct ggml_context * dev_ctx = get_ctx_for_buft(ggml_backend_buffer_get_type(model_tensor->buffer));
-        // validate tensor shape
-        if (model_tensor->ne[0] != w.a->ne[0] || model_tensor->ne[1] != w.b->ne[1]) {
-            gguf_free(ctx_gguf);
-            ggml_free(ctx);
-            throw std::runtime_error("tensor '" + name + "' has incorrect shape");
-        }
-        if (w.a->ne[1] != w.b->ne[0]) {
-            gguf_free(ctx_gguf);
-            ggml_free(ctx);
-            throw std::runtime_error("lora_a tensor is not transposed (hint: adapter from \"finetune\" example is no longer supported)");
+    std::vector<zmq::message_t> msgs;
+
+    if (rank == 0){
+        // master rank sends its startup args to its next rank
+        try {
+            msgs.emplace_back("should_profile", strlen("should_profile"));
+            msgs.emplace_back(&args->should_profile, sizeof(args->should_profile));
+            msgs.emplace_back("n_ctx", strlen("n_ctx"));
+            msgs.emplace_back(&args->n_ctx, sizeof(args->n_ctx));
+            zmq::send_multipart(*ctx->send_socket, msgs);
+        } catch (const zmq::error_t& e) {
+            LLAMA_LOG_INFO("Failed to send data: %s\n", e.what());
+            return -1;
         }
-        // save tensor to adapter
-        struct ggml_tensor * tensor_a = ggml_dup_tensor(dev_ctx, w.a);
-        struct ggml_tensor * tensor_b = ggml_dup_tensor(dev_ctx, w.b);
-        ggml_set_name(tensor_a, w.a->name);
-        ggml_set_name(tensor_b, w.b->name);
-        adapter.ab_map[name] = llama_lora_weight(tensor_a, tensor_b);
-    }
 
-    // allocate tensors / buffers and zero
-    {
-        adapter.ctxs.reserve(ctx_map.size());
-        adapter.bufs.reserve(ctx_map.size());
-        for (auto it : ctx_map) {
-            ggml_backend_buffer_type_t buft = it.first;
-            ggml_context * ctx_dev = it.second;
-            ggml_backend_buffer_t buf = ggml_backend_alloc_ctx_tensors_from_buft(ctx_dev, buft);
-            if (!buf) {
-                gguf_free(ctx_gguf);
-                ggml_free(ctx);
-                throw std::runtime_error("failed to allocate buffer for lora adapter\n");
-            }
-            LLAMA_LOG_INFO("%s: %10s LoRA buffer size = %8.2f MiB\n", __func__, ggml_backend_buffer_name(buf), ggml_backend_buffer_get_size(buf)/1024.0/1024.0);
-            adapter.ctxs.push_back(ctx_dev);
-            adapter.bufs.push_back(buf);
+        // master rank receives ack from its previous rank (a barrier op)
+        msgs.clear();
+        if (!zmq::recv_multipart(*ctx->recv_socket, std::back_inserter(msgs))) {
+            return -1;
         }
-    }
 
-    // set tensor data
-    {
-        llama_file gguf_file(path_lora, "rb");
-        std::vector<uint8_t> read_buf;
-        auto set_tensor = [&](struct ggml_tensor * orig, struct ggml_tensor * dev) {
-            size_t offs = gguf_get_data_offset(ctx_gguf) + gguf_get_tensor_offset(ctx_gguf, gguf_find_tensor(ctx_gguf, orig->name));
-            size_t size = ggml_nbytes(orig);
-            read_buf.resize(size);
-            gguf_file.seek(offs, SEEK_SET);
-            gguf_file.read_raw(read_buf.data(), size);
-            ggml_backend_tensor_set(dev, read_buf.data(), 0, size);
-        };
-        for (auto & it : adapter.ab_map) {
-            auto orig = ab_map[it.first];
-            auto dev  = it.second;
-            set_tensor(orig.a, dev.a);
-            set_tensor(orig.b, dev.b);
+        GGML_ASSERT(msgs.size() == 1);
+        GGML_ASSERT(msgs[0].to_string() == "ACK");
+    } else {
+        // non-master ranks receive startup args from their previous rank
+        if (!zmq::recv_multipart(*ctx->recv_socket, std::back_inserter(msgs))) {
+            return -1;
         }
-    }
 
-    LLAMA_LOG_INFO("%s: loaded %ld tensors from lora file\n", __func__, adapter.ab_map.size()*2);
+        GGML_ASSERT(msgs[0].to_string() == "should_profile");
+        GGML_ASSERT(msgs[1].size() == sizeof(bool));
+        GGML_ASSERT(msgs[2].to_string() == "n_ctx");
+        GGML_ASSERT(msgs[3].size() == sizeof(uint32_t));
 
-    // free ctx for reading gguf
-    gguf_free(ctx_gguf);
-    ggml_free(ctx);
-}
+        args->should_profile = *static_cast<bool*>(msgs[1].data());      
+        args->n_ctx = *static_cast<uint32_t*>(msgs[3].data());
 
-int32_t llama_lora_adapter_set(
-            struct llama_context * ctx,
-            struct llama_lora_adapter * adapter,
-            float scale) {
-    if (ctx->cparams.flash_attn) {
-        LLAMA_LOG_ERROR("%s: flash_attn is not compatible with LoRA\n", __func__);
-        return -1;
+        // non-master ranks forward the startup args to their next rank
+        try {
+            // last rank just sends an ack to pass the barrier
+            if ((int)rank == (int)n_world - 1) {
+                msgs.clear();
+                msgs.emplace_back("ACK", strlen("ACK"));
+            }
+            zmq::send_multipart(*ctx->send_socket, msgs);
+        } catch (const zmq::error_t & e) {
+            LLAMA_LOG_INFO("Failed to send data: %s\n", e.what());
+            return -1;
+        }
     }
-    ctx->lora_adapters[adapter] = scale;
+
     return 0;
 }
 
-int32_t llama_lora_adapter_remove(
-            struct llama_context * ctx,
-            struct llama_lora_adapter * adapter) {
-    auto pos = ctx->lora_adapters.find(adapter);
-    if (pos != ctx->lora_adapters.end()) {
-        ctx->lora_adapters.erase(pos);
-        return 0;
-    }
-    return -1;
-}
+int llama_profile_links(struct llama_context * ctx, struct device_info * dev_info) {
+    const uint32_t n_world = ctx->cparams.n_world;
+    const uint32_t my_rank = ctx->cparams.rank;
+    if (n_world == 1) return 0;
+    GGML_ASSERT(dev_info != nullptr);
+    GGML_ASSERT(ctx->send_socket != nullptr && ctx->recv_socket != nullptr);
 
-void llama_lora_adapter_clear(struct llama_context * ctx) {
-    ctx->lora_adapters.clear();
-}
+    const int n_ping   = 10; // round trips used to estimate the ring latency
+    const int n_burst  = 8;  // messages per throughput burst
+    const int n_tokens = 16; // tokens carried by each burst message
 
-void llama_lora_adapter_free(struct llama_lora_adapter * adapter) {
-    delete adapter;
-}
+    // probe with messages of the same size as the activations we send at inference time
+    const size_t nb_token = ggml_row_size(ctx->comm.comm_type, ctx->model.hparams.n_embd);
+    std::vector<uint8_t> payload(nb_token * n_tokens, 0);
 
-//
-// interface implementation
-//
-struct llama_model_params llama_model_default_params() {
-    struct llama_model_params result = {
-        /*.n_world                     =*/ 1,
-        /*.rank                        =*/ 0,
-        /*.n_layer_window              =*/ {0},
-        /*.n_gpu_layers                =*/ 0,
-        /*.split_mode                  =*/ LLAMA_SPLIT_MODE_LAYER,
-        /*.main_gpu                    =*/ 0,
-        /*.tensor_split                =*/ nullptr,
-        /*.rpc_servers                 =*/ nullptr,
-        /*.progress_callback           =*/ nullptr,
-        /*.progress_callback_user_data =*/ nullptr,
-        /*.kv_overrides                =*/ nullptr,
-        /*.vocab_only                  =*/ false,
-        /*.use_mmap                    =*/ true,
-        /*.use_mlock                   =*/ false,
-        /*.check_tensors               =*/ false,
-        /*.keep_out_in_metal           =*/ true,
-        /*.keep_out_in_cuda            =*/ false,
+    auto send_msg = [&](size_t nb) {
+        std::vector<zmq::message_t> msgs;
+        msgs.emplace_back(payload.data(), nb);
+        zmq::send_multipart(*ctx->send_socket, msgs);
+    };
+    auto recv_msg = [&](std::vector<zmq::message_t> & msgs) {
+        msgs.clear();
+        return zmq::recv_multipart(*ctx->recv_socket, std::back_inserter(msgs)).has_value();
     };
 
-#ifdef GGML_USE_METAL
-    // note: we usually have plenty of VRAM, so by default offload all layers to the GPU
-    result.n_gpu_layers = 999;
-#endif
-
-    return result;
-}
+    std::vector<zmq::message_t> msgs;
+    float ring_rtt = 0.0f;
 
-struct llama_context_params llama_context_default_params() {
-    struct llama_context_params result = {
-        /*.n_world                     =*/ 1,
-        /*.rank                        =*/ 0,
-        /*.n_layer_window              =*/ {32},
-        /*.n_gpu_layers                =*/ 0,
-        /*.n_cycles                    =*/ 0,
-        /*.prefetch                    =*/ false,
-        /*.force                       =*/ false,
-        /*.master_priority             =*/ 1.01,
-        /*.keep_out_in_metal           =*/ true,
-        /*.keep_out_in_cuda            =*/ false,
-        /*.master_ip                   =*/ nullptr,
-        /*.next_node_ip                =*/ nullptr,
-        /*.data_port                   =*/ 9000,
-        /*.signal_port                 =*/ 10000,
-        /*.n_ctx                       =*/ 512,
-        /*.n_predict                   =*/ 512,
-        /*.n_batch                     =*/ 2048,
-        /*.n_ubatch                    =*/ 512,
-        /*.n_seq_max                   =*/ 1,
-        /*.n_threads                   =*/ GGML_DEFAULT_N_THREADS, // TODO: better default
-        /*.n_threads_batch             =*/ GGML_DEFAULT_N_THREADS,
-        /*.rope_scaling_type           =*/ LLAMA_ROPE_SCALING_TYPE_UNSPECIFIED,
-        /*.pooling_type                =*/ LLAMA_POOLING_TYPE_UNSPECIFIED,
-        /*.attention_type              =*/ LLAMA_ATTENTION_TYPE_UNSPECIFIED,
-        /*.rope_freq_base              =*/ 0.0f,
-        /*.rope_freq_scale             =*/ 0.0f,
-        /*.yarn_ext_factor             =*/ -1.0f,
-        /*.yarn_attn_factor            =*/ 1.0f,
-        /*.yarn_beta_fast              =*/ 32.0f,
-        /*.yarn_beta_slow              =*/ 1.0f,
-        /*.yarn_orig_ctx               =*/ 0,
-        /*.defrag_thold                =*/ -1.0f,
-        /*.cb_eval                     =*/ nullptr,
-        /*.cb_eval_user_data           =*/ nullptr,
-        /*.type_k                      =*/ GGML_TYPE_F16,
-        /*.type_v                      =*/ GGML_TYPE_F16,
-        /*.logits_all                  =*/ false,
-        /*.embeddings                  =*/ false,
-        /*.offload_kqv                 =*/ true,
-        /*.flash_attn                  =*/ false,
-        /*.no_perf                     =*/ true,
-        /*.abort_callback              =*/ nullptr,
-        /*.abort_callback_data         =*/ nullptr,
-    };
+    try {
+        // 1. ring latency: the master circulates single-token messages around the ring,
+        //    the first one is not timed since it also waits for the slowest device to finish profiling
+        if (my_rank == 0) {
+            std::vector<float> rtts;
+            for (int i = 0; i <= n_ping; ++i) {
+                const int64_t t_start_us = ggml_time_us();
+                send_msg(nb_token);
+                if (!recv_msg(msgs)) return -1;
+                if (i > 0) {
+                    rtts.push_back((ggml_time_us() - t_start_us) / 1000.0f);
+                }
+            }
+            std::sort(rtts.begin(), rtts.end());
+            ring_rtt = rtts[rtts.size() / 2];
+            memcpy(payload.data(), &ring_rtt, sizeof(float));
+        } else {
+            for (int i = 0; i <= n_ping; ++i) {
+                if (!recv_msg(msgs)) return -1;
+                send_msg(nb_token);
+            }
+        }
 
-    return result;
-}
+        // 2. link throughput: ranks take turns to push a burst to their next rank, so that only one
+        //    link is loaded at a time. the receiver times the burst with its own clock
+        auto recv_burst = [&]() -> float {
+            int64_t t_first_us = 0;
+            for (int i = 0; i < n_burst; ++i) {
+                if (!recv_msg(msgs)) return -1.0f;
+                if (i == 0) {
+                    t_first_us = ggml_time_us();
+                    memcpy(&ring_rtt, msgs[0].data(), sizeof(float));
+                }
+            }
+            const int64_t t_us = std::max<int64_t>(ggml_time_us() - t_first_us, 1);
+            return (float)(payload.size() * (n_burst - 1)) / t_us; // bytes/us = MB/s
+        };
 
-struct llama_sampler_chain_params llama_sampler_chain_default_params() {
-    struct llama_sampler_chain_params result = {
-        /*.no_perf                     =*/ true,
-    };
+        float link_bw = 0.0f;
+        if (my_rank == 0) {
+            for (int i = 0; i < n_burst; ++i) send_msg(payload.size());
+            link_bw = recv_burst();
+        } else {
+            link_bw = recv_burst();
+            memcpy(payload.data(), &ring_rtt, sizeof(float));
+            for (int i = 0; i < n_burst; ++i) send_msg(payload.size());
+        }
+        if (link_bw < 0.0f) return -1;
 
-    return result;
-}
+        // without synchronized clocks we cannot tell the hops apart, so each link takes an equal share of the ring latency
+        dev_info->net.link_bw      = link_bw;
+        dev_info->net.link_latency = ring_rtt / n_world;
+        dev_info->net.ring_rtt     = my_rank == 0 ? ring_rtt : 0.0f;
+    } catch (const zmq::error_t & e) {
+        LLAMA_LOG_INFO("Failed to profile links: %s\n", e.what());
+        return -1;
+    }
 
-struct llama_model_quantize_params llama_model_quantize_default_params() {
-    struct llama_model_quantize_params result = {
-        /*.nthread                     =*/ 0,
-        /*.ftype                       =*/ LLAMA_FTYPE_MOSTLY_Q5_1,
-        /*.output_tensor_type          =*/ GGML_TYPE_COUNT,
-        /*.token_embedding_type        =*/ GGML_TYPE_COUNT,
-        /*.allow_requantize            =*/ false,
-        /*.quantize_output_tensor      =*/ true,
-        /*.only_copy                   =*/ false,
-        /*.pure                        =*/ false,
-        /*.keep_split                  =*/ false,
-        /*.imatrix                     =*/ nullptr,
-        /*.kv_overrides                =*/ nullptr,
-    };
+    LLAMA_LOG_INFO("%s: link from rank %u: %.2f MB/s, latency %.2f ms (ring rtt %.2f ms)\n",
+        __func__, (my_rank + n_world - 1) % n_world, dev_info->net.link_bw, dev_info->net.link_latency, ring_rtt);
 
-    return result;
+    return 0;
 }
 
-size_t llama_max_devices(void) {
-    return 16;
-}
+int llama_bcast_layer_setup(struct llama_context * ctx, uint32_t * n_layer_window, uint32_t * n_layer_extra, uint32_t * n_gpu_layers, uint32_t * tp_ffn_share) {
+    uint32_t n_world = ctx->cparams.n_world;
+    if (n_world == 1) return 0;
+    GGML_ASSERT(ctx != nullptr && ctx->send_socket != nullptr);
 
-bool llama_supports_mmap(void) {
-    return llama_mmap::SUPPORTED;
-}
+    std::vector<zmq::message_t> msgs;
 
-bool llama_supports_mlock(void) {
-    return llama_mlock::SUPPORTED;
-}
+    // master rank sends its layer setup to its next rank
+    try {
+        msgs.emplace_back("n_layer_window", strlen("n_layer_window"));
+        msgs.emplace_back(n_layer_window, sizeof(uint32_t) * 32);
 
-bool llama_supports_gpu_offload(void) {
-#if defined(GGML_USE_VULKAN) || \
-    defined(GGML_USE_SYCL) || defined(GGML_USE_KOMPUTE) || defined(GGML_USE_RPC)
-    // Defined when llama.cpp is compiled with support for offloading model layers to GPU.
-    return true;
-#else
-    return ggml_backend_dev_by_type(GGML_BACKEND_DEVICE_TYPE_GPU) != nullptr ||
-        ggml_backend_dev_by_type(GGML_BACKEND_DEVICE_TYPE_GPU_FULL) != nullptr;
-#endif
-}
+        if (n_layer_extra != nullptr) {
+            msgs.emplace_back("n_layer_extra", strlen("n_layer_extra"));
+            msgs.emplace_back(n_layer_extra, sizeof(uint32_t) * 32);
+        }
 
-void llama_backend_init(void) {
-    ggml_time_init();
+        if (n_gpu_layers != nullptr) {
+            msgs.emplace_back("n_gpu_layers", strlen("n_gpu_layers"));
+            msgs.emplace_back(n_gpu_layers, sizeof(uint32_t) * 32);
+        }
 
-    // needed to initialize f16 tables
-    {
-        struct ggml_init_params params = { 0, NULL, false };
-        struct ggml_context * ctx = ggml_init(params);
-        ggml_free(ctx);
+        if (tp_ffn_share != nullptr) {
+            msgs.emplace_back("tp_ffn_share", strlen("tp_ffn_share"));
+            msgs.emplace_back(tp_ffn_share, sizeof(uint32_t) * 32);
+        }
+
+        zmq::send_multipart(*ctx->send_socket, msgs);
+    } catch (const zmq::error_t & e) {
+        LLAMA_LOG_INFO("Failed to send data: %s\n", e.what());
+        return -1;
     }
-}
 
-void llama_numa_init(enum ggml_numa_strategy numa) {
-    if (numa != GGML_NUMA_STRATEGY_DISABLED) {
-        ggml_numa_init(numa);
+    // master rank receives ack from its previous rank (a barrier op)
+    msgs.clear();
+    if (!zmq::recv_multipart(*ctx->recv_socket, std::back_inserter(msgs))) {
+        return -1;
     }
-}
 
-void llama_attach_threadpool(
-             struct llama_context * ctx,
-        ggml_threadpool_t   threadpool,
-        ggml_threadpool_t   threadpool_batch) {
-    ctx->threadpool       = threadpool;
-    ctx->threadpool_batch = threadpool_batch ? threadpool_batch : threadpool;
-}
+    GGML_ASSERT(msgs.size() == 1);
+    GGML_ASSERT(msgs[0].to_string() == "ACK");
 
-void llama_detach_threadpool(struct llama_context * ctx) {
-    ctx->threadpool       = nullptr;
-    ctx->threadpool_batch = nullptr;
+    return 0;
 }
 
-void llama_backend_free(void) {
-    ggml_quantize_free();
-}
+int llama_rebuild_topo(llama_context * ctx,
+                            uint32_t * n_layer_window,
+                         device_info * dev_info_set,
+                            NodeType * node_type,
+                            char     * is_forwarder) {
+    uint32_t n_world = ctx->cparams.n_world;
+    uint32_t my_rank = ctx->cparams.rank;
+    TopoRebuildHelperInfo* topo_helper = new TopoRebuildHelperInfo[n_world];
 
-int64_t llama_time_us(void) {
-    return ggml_time_us();
-}
+    if (dev_info_set == nullptr) {
+        // for non-master ranks, receive devices info from their previous rank
+        std::vector<zmq::message_t> msgs;
+        if (!zmq::recv_multipart(*ctx->recv_socket, std::back_inserter(msgs))) {
+            return -1;
+        }
+        for (size_t i = 0; i < msgs.size(); i++) {
+            topo_helper[i].deserialize((char *)msgs[i].data());
+        }
+        GGML_ASSERT(msgs.size() == n_world);
+    } else {
+        for (size_t i = 0; i < n_world; i++) {
+            topo_helper[i].dev_info = dev_info_set[i];
+            topo_helper[i].is_forwarder = 0;
+        }
+    }
 
-struct llama_model * llama_load_model_from_file(const char * path_model, struct llama_model_params params) {
-    ggml_time_init();
+    GGML_ASSERT(ctx != nullptr && ctx->send_socket != nullptr);
 
-    llama_model * model = new llama_model;
+    auto next_rank = (my_rank + 1) % n_world;
+    auto next_connect_rank = (my_rank + 1) % n_world;
+    zmq::socket_t * socket_to_close = nullptr;
+    bool is_not_exit = n_layer_window[my_rank] > 0 || topo_helper[my_rank].is_forwarder == 1;
+    
+    if (is_not_exit) {
+        // reconstruct socket to the next valid rank
+        auto current_rank = my_rank;
+        std::vector<uint32_t> nodes;
+        auto next_rank_ = next_rank;
+
+        while (next_rank_ != my_rank) {
+            nodes.push_back(next_rank_);
+            if (n_layer_window[next_rank_] > 0) {
+                break;
+            }
+            next_rank_   = (next_rank_   + 1) % n_world;
+            current_rank = (current_rank + 1) % n_world;
+        }
 
-    unsigned cur_percentage = 0;
-    if (params.progress_callback == NULL) {
-        params.progress_callback_user_data = &cur_percentage;
-        params.progress_callback = [](float progress, void * ctx) {
-            unsigned * cur_percentage_p = (unsigned *) ctx;
-            unsigned percentage = (unsigned) (100 * progress);
-            while (percentage > *cur_percentage_p) {
-                *cur_percentage_p = percentage;
-                LLAMA_LOG_CONT(".");
-                if (percentage >= 100) {
-                    LLAMA_LOG_CONT("\n");
+        if (next_rank_ == my_rank) {
+            // only one node
+            ctx->next_node_ip = "";
+            socket_to_close   = ctx->send_socket;
+            ctx->send_socket  = nullptr;
+        } else {
+            // iterate node reverse
+            zmq::socket_t * socket = nullptr;
+            std::string ip;
+            for (int i = nodes.size() - 1; i > 0; --i) {
+                auto rank = nodes[i];
+                ip = try_connect(ctx, rank, topo_helper, n_world, &socket);
+                if (!ip.empty()) {
+                    next_connect_rank = rank;
+                    break;
                 }
             }
-            return true;
-        };
+            topo_helper[next_connect_rank].is_forwarder = 1;
+            if (next_connect_rank != next_rank) {
+                // reset socket
+                GGML_ASSERT(socket != nullptr);
+                GGML_ASSERT(!ip.empty());
+                socket_to_close   = ctx->send_socket;
+                ctx->send_socket  = socket;
+                ctx->next_node_ip = ip;
+                ctx->cparams.original_next_rank = next_connect_rank;
+            }
+        }
+    } else if (n_layer_window[next_rank] <= 0 && topo_helper[next_rank].is_forwarder == 0) {
+        socket_to_close = ctx->send_socket;
     }
 
-    if (params.rpc_servers != nullptr && params.rpc_servers[0] != '\0') {
-        // split the servers set them into model->rpc_servers
-        std::string servers(params.rpc_servers);
-        size_t pos = 0;
-        while ((pos = servers.find(',')) != std::string::npos) {
-            std::string server = servers.substr(0, pos);
-            model->rpc_servers.push_back(server);
-            servers.erase(0, pos + 1);
+    // notify next exiting node
+    if (socket_to_close != nullptr) {
+        GGML_ASSERT(n_layer_window[next_rank] <= 0 && topo_helper[next_rank].is_forwarder == 0);
+        try {
+            auto msgs = topohelper_to_messages(topo_helper, n_world);
+            socket_to_close->set(zmq::sockopt::linger, 3500);
+            zmq::send_multipart(*socket_to_close, msgs);
+        } catch (const zmq::error_t & e) {
+            LLAMA_LOG_INFO("Failed to send data: %s\n", e.what());
+            return -1;
         }
-        model->rpc_servers.push_back(servers);
     }
-
-    // create list of devices to use with this model
-    // currently, we use all available devices
-    // TODO: rework API to give user more control over device selection
-    for (size_t i = 0; i < ggml_backend_dev_count(); ++i) {
-        ggml_backend_dev_t dev = ggml_backend_dev_get(i);
-        switch (ggml_backend_dev_type(dev)) {
-            case GGML_BACKEND_DEVICE_TYPE_CPU:
-            case GGML_BACKEND_DEVICE_TYPE_CPU_FULL:
-                // skip CPU backends since they are `handled separately
-                break;
-
-            case GGML_BACKEND_DEVICE_TYPE_GPU:
-            case GGML_BACKEND_DEVICE_TYPE_GPU_FULL:
-                model->devices.push_back(dev);
-                break;
+    
+    // notify next connect node
+    if (!ctx->next_node_ip.empty() && is_not_exit) {
+        GGML_ASSERT(ctx->send_socket != nullptr);
+        try {
+            auto msgs = topohelper_to_messages(topo_helper, n_world);
+            zmq::send_multipart(*ctx->send_socket, msgs);
+        } catch (const zmq::error_t & e) {
+            LLAMA_LOG_INFO("Failed to send data: %s\n", e.what());
+            return -1;
         }
     }
-
-    (void)path_model;
-
-    return model;
-}
-
-void llama_free_model(struct llama_model * model) {
-    delete model;
-}
-
-static uint32_t map_rank_to_port(uint32_t rank, uint32_t data_port) {
-    return data_port + rank;
-}
-
-static std::string try_connect(llama_context * ctx, uint32_t rank, TopoRebuildHelperInfo * infos, uint32_t n_world, zmq::socket_t ** socket){
-    auto prev_rank = (rank - 1 + n_world) % n_world;
-    std::string ip = infos[prev_rank].dev_info.next_ip;
-    auto port = map_rank_to_port(rank, ctx->data_port);
     
-    if (!is_port_open(ip, port)) {
-        *socket = nullptr;
-        return "";
+    if (n_layer_window[my_rank] > 0) {
+        *node_type = NodeType::NODE_TYPE_WORKER;
+    } else if (topo_helper[my_rank].is_forwarder == 1) {
+        *node_type = NodeType::NODE_TYPE_FORWARDER;
+    } else {
+        *node_type = NodeType::NODE_TYPE_EXIT;
     }
-    std::string send_endp = "tcp://" + ip + ":" + std::to_string(port);
-    *socket = new zmq::socket_t(*ctx->sock_context, zmq::socket_type::push);
-    try {
-        (*socket)->connect(send_endp);
-    } catch (const zmq::error_t& e) {
-        delete *socket;
-        *socket = nullptr;
-        return "";
+
+    if (ctx->send_socket != nullptr && *node_type != NodeType::NODE_TYPE_EXIT) {
+        // recv the whole view of all nodes
+        std::vector<zmq::message_t> msgs;
+        if (!zmq::recv_multipart(*ctx->recv_socket, std::back_inserter(msgs))) {
+            return -1;
+        }
+        GGML_ASSERT(msgs.size() == n_world);
+        for (size_t i = 0; i < msgs.size(); i++) {
+            topo_helper[i].deserialize((char *)msgs[i].data());
+        }
+        // broadcast the whole view
+        if (next_connect_rank != 0) {
+            try {
+                zmq::send_multipart(*ctx->send_socket, msgs);
+            } catch (const zmq::error_t & e) {
+                LLAMA_LOG_INFO("Failed to send data: %s\n", e.what());
+                return -1;
+            }
+        }
     }
-    return ip;
-}
 
-void llama_init_sockets(struct llama_context * ctx, uint32_t n_world, uint32_t my_rank) {
-    if (n_world == 1) {
-        return; 
+    for (size_t i = 0; i < n_world; i++) {
+        is_forwarder[i] = topo_helper[i].is_forwarder;
     }
 
-    ctx->sock_context  = new zmq::context_t(2); 
-    ctx->send_socket   = new zmq::socket_t(*ctx->sock_context, zmq::socket_type::push);
-    ctx->recv_socket   = new zmq::socket_t(*ctx->sock_context, zmq::socket_type::pull);
-    ctx->signal_socket = new zmq::socket_t(*ctx->sock_context, zmq::socket_type::pull);
+    ctx->cparams.node_type = *node_type;
 
-    if (my_rank != 0 && my_rank != (n_world - 1)) {
-        ctx->master_socket = new zmq::socket_t(*ctx->sock_context, zmq::socket_type::push);
-    } else if (my_rank == (n_world - 1)) {
-        ctx->master_socket = ctx->send_socket; // No need for master_socket in the last rank, reuse send_socket for communication
+    if (socket_to_close != nullptr) {
+        socket_to_close->close();
+        delete socket_to_close;
     }
+    delete [] topo_helper;
+    return 0;
+}
 
-    const uint32_t next_rank = (my_rank + 1) % n_world;
-    std::string recv_endp   = "tcp://*:"                         + std::to_string(map_rank_to_port(my_rank,   ctx->data_port));
-    std::string send_endp   = "tcp://" + ctx->next_node_ip + ":" + std::to_string(map_rank_to_port(next_rank, ctx->data_port));
-    std::string master_endp = "tcp://" + ctx->master_ip    + ":" + std::to_string(map_rank_to_port(0,         ctx->data_port));
-    std::string signal_endp = "tcp://*:"                         + std::to_string(map_rank_to_port(my_rank,   ctx->signal_port));
-
-    try {
-        ctx->recv_socket->bind(recv_endp);
-        ctx->signal_socket->bind(signal_endp);
-        ctx->send_socket->connect(send_endp);
-        if (ctx->master_socket && my_rank != (n_world - 1)) {
-            ctx->master_socket->connect(master_endp);
+int llama_forward_messages(llama_context *ctx) {
+    zmq::message_t message;
+    int more = true;
+    int timeout_ms = 10;
+    ctx->recv_socket->setsockopt(ZMQ_RCVTIMEO, &timeout_ms, sizeof(timeout_ms));
+    while (more) {
+        auto recv_result = ctx->recv_socket->recv(message, zmq::recv_flags::none);
+        if (!recv_result) {
+            return -1;
         }
-    } catch (const zmq::error_t &e) {
-        LLAMA_LOG_INFO("Error binding/connecting recv socket to endpoint: %s", e.what());
-        exit(1);
+        size_t more_size = sizeof(more);
+        ctx->recv_socket->getsockopt(ZMQ_RCVMORE, &more, &more_size);
+        
+        ctx->send_socket->send(message, 
+            more ? zmq::send_flags::sndmore : zmq::send_flags::none);
     }
-
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    return 0;
 }
 
-int llama_gather_device_info(struct llama_context * ctx, struct device_info * dev_info_set) {
+int llama_recv_layer_setup(struct llama_context * ctx, uint32_t * n_layer_window, uint32_t * n_layer_extra, uint32_t * n_gpu_layers, uint32_t * tp_ffn_share) {
     uint32_t n_world = ctx->cparams.n_world;
-    if (n_world == 1) return 0;
-    GGML_ASSERT(dev_info_set != nullptr);
-    GGML_ASSERT(ctx != nullptr && ctx->send_socket != nullptr);
-
-    // master rank sends its device info to its next rank
-    try {
-        char * buffer = nullptr;
-        size_t buffer_size = serialize(&dev_info_set[0], &buffer);
-
-        std::vector<zmq::message_t> send_msgs;
-        send_msgs.emplace_back(buffer, buffer_size);
-        zmq::send_multipart(*ctx->send_socket, send_msgs);
+    uint32_t my_rank = ctx->cparams.rank;
 
-        free(buffer);
-    } catch (const zmq::error_t& e) {
-        LLAMA_LOG_INFO("Failed to send data: %s\n", e.what());
+    // non-master ranks receive data from their previous rank
+    std::vector<zmq::message_t> msgs;
+    if (!zmq::recv_multipart(*ctx->recv_socket, std::back_inserter(msgs))) {
         return -1;
     }
 
-    // master rank receives aggregated device info from its previous rank (a barrier op)
-    std::vector<zmq::message_t> recv_msgs;
-    if (!zmq::recv_multipart(*ctx->recv_socket, std::back_inserter(recv_msgs))) {
-        return -1;
+    GGML_ASSERT(msgs[0].to_string() == "n_layer_window");
+    GGML_ASSERT(msgs[1].size() == sizeof(uint32_t) * 32);
+    memcpy(n_layer_window, msgs[1].data(), sizeof(uint32_t) * 32);
+
+    // the optional arrays follow as name and value pairs
+    for (size_t i = 2; i + 1 < msgs.size(); i += 2) {
+        const std::string key = msgs[i].to_string();
+        GGML_ASSERT(msgs[i + 1].size() == sizeof(uint32_t) * 32);
+        if (key == "n_layer_extra") {
+            memcpy(n_layer_extra, msgs[i + 1].data(), sizeof(uint32_t) * 32);
+        } else if (key == "tp_ffn_share") {
+            memcpy(tp_ffn_share, msgs[i + 1].data(), sizeof(uint32_t) * 32);
+        } else {
+            GGML_ASSERT(key == "n_gpu_layers");
+            memcpy(n_gpu_layers, msgs[i + 1].data(), sizeof(uint32_t) * 32);
+        }
     }
-    GGML_ASSERT(recv_msgs.size() == n_world);
 
-    for (size_t i = 0; i < recv_msgs.size(); i++) {
-        deserialize((const char *)recv_msgs[i].data(), &dev_info_set[i]);
+    // non-master ranks forward the received message to their next rank
+    try {
+        if (my_rank == n_world - 1) {
+            // last rank just sends an ack to pass the barrier
+            msgs.clear();
+            msgs.emplace_back("ACK", strlen("ACK"));
+        }
+        zmq::send_multipart(*ctx->send_socket, msgs);
+    } catch (const zmq::error_t& e) {
+        LLAMA_LOG_INFO("Failed to send data: %s\n", e.what());
+        return -1;
     }
+    
     return 0;
 }
 
-int llama_send_device_info(struct llama_context * ctx, struct device_info * dev_info) {
-    // non-master ranks receive device info from their previous rank
-    std::vector<zmq::message_t> recv_msgs;
-    if (!zmq::recv_multipart(*ctx->recv_socket, std::back_inserter(recv_msgs))) {
-        return -1;
+int llama_gather_rank_perf(struct llama_context * ctx, struct llama_rank_perf * perf_set) {
+    const uint32_t n_world = ctx->cparams.n_world;
+    GGML_ASSERT(ctx->cparams.rank == 0);
+    GGML_ASSERT(perf_set != nullptr);
+
+    std::fill(perf_set, perf_set + n_world, llama_rank_perf());
+    perf_set[0] = llama_rank_perf_take(*ctx);
+
+    if (n_world == 1 || ctx->send_socket == nullptr) {
+        return 0;
+    }
+
+    if (ctx->comm.is_async()) {
+        ctx->comm.flush();
     }
 
-    GGML_ASSERT(dev_info != nullptr);
-    GGML_ASSERT(ctx != nullptr && ctx->send_socket != nullptr);
+    // master rank sends an empty report around the ring, each worker fills in its own entry
+    const size_t size = meta_perf_frame_size(n_world);
+    auto & buf = ctx->meta_arena.send_buf;
+    meta_header * hdr = meta_init_header(buf, size, META_CMD_PERF);
+    hdr->args[0] = n_world;
+    std::memcpy(buf.data() + sizeof(meta_header), perf_set, n_world * sizeof(llama_rank_perf));
 
-    // non-master ranks aggregate their device info and forward it to their next rank
     try {
-        char * buffer = nullptr;
-        size_t buffer_size = serialize(dev_info, &buffer);
+        ctx->send_socket->send(zmq::buffer(buf.data(), size), zmq::send_flags::none);
+    } catch (const zmq::error_t & e) {
+        LLAMA_LOG_INFO("Failed to send data: %s\n", e.what());
+        return -1;
+    }
 
-        recv_msgs.emplace_back(buffer, buffer_size);
-        zmq::send_multipart(*ctx->send_socket, recv_msgs);
+    // master rank receives the filled report from its previous rank (a barrier op)
+    auto & recv_buf = ctx->meta_arena.recv_buf;
+    recv_buf.resize(std::max(recv_buf.size(), size));
 
-        free(buffer);
-    } catch (const zmq::error_t& e) {
-        LLAMA_LOG_INFO("Failed to send data: %s\n", e.what());
+    const auto res = ctx->recv_socket->recv(zmq::buffer(recv_buf), zmq::recv_flags::none);
+    if (!res || res->size != size || ((const meta_header *) recv_buf.data())->cmd != META_CMD_PERF) {
+        LLAMA_LOG_ERROR("%s: unexpected reply to the rank report\n", __func__);
         return -1;
     }
 
+    std::memcpy(perf_set + 1, recv_buf.data() + sizeof(meta_header) + sizeof(llama_rank_perf), (n_world - 1) * sizeof(llama_rank_perf));
     return 0;
 }
 
-int llama_bcast_startup_args(llama_context * ctx, uint32_t rank, startup_args * args) {
-    int32_t n_world = ctx->cparams.n_world;
-    if (n_world == 1) return 0;
-    GGML_ASSERT(ctx != nullptr && ctx->send_socket != nullptr);
-
-    std::vector<zmq::message_t> msgs;
+int llama_reshard(
+        struct llama_context * ctx, 
+              const uint32_t * n_layer_window, 
+              const uint32_t * n_layer_extra, 
+              const uint32_t * n_gpu_layers) {
+    const auto & cparams = ctx->cparams;
+    const uint32_t n_world = cparams.n_world;
+    const uint32_t n_layer = ctx->model.hparams.n_layer;
+    GGML_ASSERT(cparams.rank == 0);
 
-    if (rank == 0){
-        // master rank sends its startup args to its next rank
-        try {
-            msgs.emplace_back("should_profile", strlen("should_profile"));
-            msgs.emplace_back(&args->should_profile, sizeof(args->should_profile));
-            msgs.emplace_back("n_ctx", strlen("n_ctx"));
-            msgs.emplace_back(&args->n_ctx, sizeof(args->n_ctx));
-            zmq::send_multipart(*ctx->send_socket, msgs);
-        } catch (const zmq::error_t& e) {
-            LLAMA_LOG_INFO("Failed to send data: %s\n", e.what());
-            return -1;
-        }
+    uint32_t n_layer_extra_[32] = {0};
+    if (n_layer_extra != nullptr) {
+        std::copy(n_layer_extra, n_layer_extra + 32, n_layer_extra_);
+    }
 
-        // master rank receives ack from its previous rank (a barrier op)
-        msgs.clear();
-        if (!zmq::recv_multipart(*ctx->recv_socket, std::back_inserter(msgs))) {
+    // the ranks holding layers define the ring, moving layers must not add or remove any of them
+    for (uint32_t i = 0; i < n_world; ++i) {
+        if ((n_layer_window[i] > 0) != (cparams.n_layer_window[i] > 0)) {
+            LLAMA_LOG_ERROR("%s: rank %u cannot join or leave the ring by resharding\n", __func__, i);
             return -1;
         }
+    }
+    if (!llama_layer_windows_valid(n_layer, n_world, n_layer_window, n_layer_extra_)) {
+        LLAMA_LOG_ERROR("%s: the windows do not add up to %u layers in whole cycles\n", __func__, n_layer);
+        return -1;
+    }
 
-        GGML_ASSERT(msgs.size() == 1);
-        GGML_ASSERT(msgs[0].to_string() == "ACK");
-    } else {
-        // non-master ranks receive startup args from their previous rank
-        if (!zmq::recv_multipart(*ctx->recv_socket, std::back_inserter(msgs))) {
-            return -1;
+    if (ctx->send_socket != nullptr) {
+        if (ctx->comm.is_async()) {
+            ctx->comm.flush();
         }
 
-        GGML_ASSERT(msgs[0].to_string() == "should_profile");
-        GGML_ASSERT(msgs[1].size() == sizeof(bool));
-        GGML_ASSERT(msgs[2].to_string() == "n_ctx");
-        GGML_ASSERT(msgs[3].size() == sizeof(uint32_t));
+        const size_t size = meta_reshard_frame_size();
+        auto & buf = ctx->meta_arena.send_buf;
+        meta_header * hdr = meta_init_header(buf, size, META_CMD_RESHARD);
+        hdr->args[0] = n_gpu_layers != nullptr;
 
-        args->should_profile = *static_cast<bool*>(msgs[1].data());      
-        args->n_ctx = *static_cast<uint32_t*>(msgs[3].data());
+        uint32_t * p = (uint32_t *) (buf.data() + sizeof(meta_header));
+        std::copy(n_layer_window, n_layer_window + 32, p);
+        std::copy(n_layer_extra_, n_layer_extra_ + 32, p + 32);
+        if (n_gpu_layers != nullptr) {
+            std::copy(n_gpu_layers, n_gpu_layers + 32, p + 64);
+        } else {
+            std::fill(p + 64, p + 96, 0u);
+        }
 
-        // non-master ranks forward the startup args to their next rank
         try {
-            // last rank just sends an ack to pass the barrier
-            if ((int)rank == (int)n_world - 1) {
-                msgs.clear();
-                msgs.emplace_back("ACK", strlen("ACK"));
-            }
-            zmq::send_multipart(*ctx->send_socket, msgs);
+            ctx->send_socket->send(zmq::buffer(buf.data(), size), zmq::send_flags::none);
         } catch (const zmq::error_t & e) {
             LLAMA_LOG_INFO("Failed to send data: %s\n", e.what());
             return -1;
         }
     }
 
-    return 0;
+    if (llama_reshard_local(*ctx, n_layer_window, n_layer_extra_, n_gpu_layers, cparams.rank, n_world) != 0) {
+        return -1;
+    }
+    return llama_kv_handoff(*ctx);
 }
 
-int llama_bcast_layer_setup(struct llama_context * ctx, uint32_t * n_layer_window, uint32_t * n_gpu_layers) {
-    uint32_t n_world = ctx->cparams.n_world;
-    if (n_world == 1) return 0;
-    GGML_ASSERT(ctx != nullptr && ctx->send_socket != nullptr);
+// heartbeat of a device, sent to the signal port of the master
+#define RING_HEARTBEAT_MAGIC 0x54424852 // "RHBT"
 
-    std::vector<zmq::message_t> msgs;
+struct ring_heartbeat {
+    uint32_t magic;
+    uint32_t rank;
+    uint32_t epoch;
+    uint32_t next_bind_rank;
+    char     next_ip[64];
+};
 
-    // master rank sends its layer setup to its next rank
-    try {
-        msgs.emplace_back("n_layer_window", strlen("n_layer_window"));
-        msgs.emplace_back(n_layer_window, sizeof(uint32_t) * 32);
+static bool ring_is_heartbeat(const zmq::message_t & msg) {
+    return msg.size() == sizeof(ring_heartbeat) && msg.data<ring_heartbeat>()->magic == RING_HEARTBEAT_MAGIC;
+}
 
-        if (n_gpu_layers != nullptr) {
-            msgs.emplace_back("n_gpu_layers", strlen("n_gpu_layers"));
-            msgs.emplace_back(n_gpu_layers, sizeof(uint32_t) * 32);
+// request of a device to join the ring, sent to the signal port of the master and followed by its serialized device_info
+#define RING_JOIN_MAGIC 0x4e4a4852 // "RHJN"
+
+struct ring_join_request {
+    uint32_t magic;
+    uint32_t bind_rank;
+};
+
+static bool ring_is_join_request(const zmq::message_t & msg) {
+    return msg.size() > sizeof(ring_join_request) && msg.data<ring_join_request>()->magic == RING_JOIN_MAGIC;
+}
+
+static void llama_ring_heartbeat_loop(llama_context * ctx) {
+    auto & ring = ctx->ring;
+
+    zmq::socket_t socket(*ctx->sock_context, zmq::socket_type::push);
+    socket.set(zmq::sockopt::linger, 0);
+    socket.set(zmq::sockopt::sndhwm, 1); // a heartbeat that cannot go out now is worthless later
+    socket.connect("tcp://" + ctx->master_ip + ":" + std::to_string(map_rank_to_port(0, ctx->signal_port)));
+
+    while (!ring.stop) {
+        ring_heartbeat hb = {};
+        hb.magic = RING_HEARTBEAT_MAGIC;
+        {
+            std::lock_guard<std::mutex> lock(ring.mutex);
+            hb.rank           = ring.rank;
+            hb.epoch          = ring.epoch;
+            hb.next_bind_rank = ctx->cparams.original_next_rank;
+            snprintf(hb.next_ip, sizeof(hb.next_ip), "%s", ctx->next_node_ip.c_str());
         }
+        socket.send(zmq::buffer(&hb, sizeof(hb)), zmq::send_flags::dontwait);
 
-        zmq::send_multipart(*ctx->send_socket, msgs);
-    } catch (const zmq::error_t & e) {
-        LLAMA_LOG_INFO("Failed to send data: %s\n", e.what());
-        return -1;
+        for (uint32_t t = 0; t < ring.heartbeat_ms() && !ring.stop; t += 50) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
     }
+}
 
-    // master rank receives ack from its previous rank (a barrier op)
-    msgs.clear();
-    if (!zmq::recv_multipart(*ctx->recv_socket, std::back_inserter(msgs))) {
-        return -1;
-    }
+static void llama_ring_monitor_loop(llama_context * ctx) {
+    auto & ring   = ctx->ring;
+    auto & socket = *ctx->signal_socket;
 
-    GGML_ASSERT(msgs.size() == 1);
-    GGML_ASSERT(msgs[0].to_string() == "ACK");
+    socket.set(zmq::sockopt::rcvtimeo, (int) ring.heartbeat_ms());
 
-    return 0;
-}
+    while (!ring.stop) {
+        zmq::message_t msg;
+        if (socket.recv(msg, zmq::recv_flags::none) && ring_is_heartbeat(msg)) {
+            const ring_heartbeat * hb = msg.data<ring_heartbeat>();
 
-int llama_rebuild_topo(llama_context * ctx,
-                            uint32_t * n_layer_window,
-                         device_info * dev_info_set,
-                            NodeType * node_type,
-                            char     * is_forwarder) {
-    uint32_t n_world = ctx->cparams.n_world;
-    uint32_t my_rank = ctx->cparams.rank;
-    TopoRebuildHelperInfo* topo_helper = new TopoRebuildHelperInfo[n_world];
+            std::lock_guard<std::mutex> lock(ring.mutex);
+            // a device that has not taken the new ring yet reports an outdated rank
+            if (hb->epoch == ring.epoch && hb->rank > 0 && hb->rank < ring.peers.size()) {
+                auto & peer = ring.peers[hb->rank];
+                peer.t_last_us      = ggml_time_us();
+                peer.next_bind_rank = hb->next_bind_rank;
+                peer.next_ip.assign(hb->next_ip, strnlen(hb->next_ip, sizeof(hb->next_ip)));
+            }
+        } else if (ring_is_join_request(msg)) {
+            llama_ring::join_entry entry = {};
+            entry.req.bind_rank = msg.data<ring_join_request>()->bind_rank;
+            try {
+                // the others reach the new device at the address it connected from
+                snprintf(entry.req.ip, sizeof(entry.req.ip), "%s", msg.gets("Peer-Address"));
+            } catch (const zmq::error_t & e) {
+                LLAMA_LOG_WARN("%s: ignoring a join request from an unknown address: %s\n", __func__, e.what());
+                continue;
+            }
+            const uint8_t * data = msg.data<uint8_t>() + sizeof(ring_join_request);
+            entry.dev_info.assign(data, data + msg.size() - sizeof(ring_join_request));
 
-    if (dev_info_set == nullptr) {
-        // for non-master ranks, receive devices info from their previous rank
-        std::vector<zmq::message_t> msgs;
-        if (!zmq::recv_multipart(*ctx->recv_socket, std::back_inserter(msgs))) {
-            return -1;
+            LLAMA_LOG_INFO("%s: device at %s asks to join the ring\n", __func__, entry.req.ip);
+            std::lock_guard<std::mutex> lock(ring.mutex);
+            ring.joins.push_back(std::move(entry));
+            ring.joins_cv.notify_all();
         }
-        for (size_t i = 0; i < msgs.size(); i++) {
-            topo_helper[i].deserialize((char *)msgs[i].data());
+
+        if (!ring.enabled() || ring.failed_rank >= 0) {
+            continue; // no failure detection, or waiting for llama_recover_ring
         }
-        GGML_ASSERT(msgs.size() == n_world);
-    } else {
-        for (size_t i = 0; i < n_world; i++) {
-            topo_helper[i].dev_info = dev_info_set[i];
-            topo_helper[i].is_forwarder = 0;
+
+        std::lock_guard<std::mutex> lock(ring.mutex);
+        const int64_t t_now_us = ggml_time_us();
+        for (uint32_t r = 1; r < ring.peers.size(); ++r) {
+            if (t_now_us - ring.peers[r].t_last_us > 1000LL * ring.fail_timeout_ms) {
+                LLAMA_LOG_ERROR("%s: no heartbeat from rank %u for %.1f s, considering it failed\n", __func__, r, 1e-6 * (t_now_us - ring.peers[r].t_last_us));
+                ring.failed_rank = r;
+                break;
+            }
         }
     }
 
-    GGML_ASSERT(ctx != nullptr && ctx->send_socket != nullptr);
+    socket.set(zmq::sockopt::rcvtimeo, -1);
+}
 
-    auto next_rank = (my_rank + 1) % n_world;
-    auto next_connect_rank = (my_rank + 1) % n_world;
-    zmq::socket_t * socket_to_close = nullptr;
-    bool is_not_exit = n_layer_window[my_rank] > 0 || topo_helper[my_rank].is_forwarder == 1;
-    
-    if (is_not_exit) {
-        // reconstruct socket to the next valid rank
-        auto current_rank = my_rank;
-        std::vector<uint32_t> nodes;
-        auto next_rank_ = next_rank;
+void llama_start_heartbeat(struct llama_context * ctx) {
+    auto & ring = ctx->ring;
+    if (ctx->cparams.n_world == 1 || ring.thread.joinable()) {
+        return;
+    }
+    // the master watches its signal port for join requests even without failure detection
+    if (!ring.enabled() && ctx->cparams.rank != 0) {
+        return;
+    }
 
-        while (next_rank_ != my_rank) {
-            nodes.push_back(next_rank_);
-            if (n_layer_window[next_rank_] > 0) {
-                break;
-            }
-            next_rank_   = (next_rank_   + 1) % n_world;
-            current_rank = (current_rank + 1) % n_world;
+    ring.rank  = ctx->cparams.rank;
+    ring.epoch = ctx->comm.epoch;
+    if (ring.enabled()) {
+        ctx->comm.ring = &ring;
+    }
+
+    if (ctx->cparams.rank == 0) {
+        // every device gets one timeout from now to send its first heartbeat
+        ring.peers.assign(ctx->cparams.n_world, llama_ring::peer());
+        for (auto & peer : ring.peers) {
+            peer.t_last_us = ggml_time_us();
         }
+        ring.thread = std::thread(llama_ring_monitor_loop, ctx);
+    } else {
+        ring.thread = std::thread(llama_ring_heartbeat_loop, ctx);
+    }
 
-        if (next_rank_ == my_rank) {
-            // only one node
-            ctx->next_node_ip = "";
-            socket_to_close   = ctx->send_socket;
-            ctx->send_socket  = nullptr;
-        } else {
-            // iterate node reverse
-            zmq::socket_t * socket = nullptr;
-            std::string ip;
-            for (int i = nodes.size() - 1; i > 0; --i) {
-                auto rank = nodes[i];
-                ip = try_connect(ctx, rank, topo_helper, n_world, &socket);
-                if (!ip.empty()) {
-                    next_connect_rank = rank;
-                    break;
-                }
-            }
-            topo_helper[next_connect_rank].is_forwarder = 1;
-            if (next_connect_rank != next_rank) {
-                // reset socket
-                GGML_ASSERT(socket != nullptr);
-                GGML_ASSERT(!ip.empty());
-                socket_to_close   = ctx->send_socket;
-                ctx->send_socket  = socket;
-                ctx->next_node_ip = ip;
-                ctx->cparams.original_next_rank = next_connect_rank;
-            }
+    if (ring.enabled()) {
+        LLAMA_LOG_INFO("%s: heartbeat every %u ms, a rank is considered failed after %u ms of silence\n", __func__, ring.heartbeat_ms(), ring.fail_timeout_ms);
+    }
+}
+
+int32_t llama_failed_rank(struct llama_context * ctx) {
+    return ctx->ring.failed_rank;
+}
+
+// point the send socket of this device to another node
+static void llama_ring_reconnect(llama_context & lctx, const std::string & next_ip, uint32_t next_bind_rank) {
+    zmq::socket_t * socket = new zmq::socket_t(*lctx.sock_context, zmq::socket_type::push);
+    socket->connect("tcp://" + next_ip + ":" + std::to_string(map_rank_to_port(next_bind_rank, lctx.data_port)));
+
+    // whatever is still queued for the failed rank goes away with the old socket
+    if (lctx.master_socket == lctx.send_socket) {
+        lctx.master_socket = socket;
+    }
+    lctx.send_socket->set(zmq::sockopt::linger, 0);
+    lctx.send_socket->close();
+    delete lctx.send_socket;
+    lctx.send_socket = socket;
+
+    std::lock_guard<std::mutex> lock(lctx.ring.mutex);
+    lctx.next_node_ip               = next_ip;
+    lctx.cparams.original_next_rank = next_bind_rank;
+}
+
+// count the devices that compute, the last of them sends its output to the master
+static void llama_ring_set_workers(llama_cparams & cparams, const uint32_t * n_layer_window, uint32_t my_rank, uint32_t n_world) {
+    cparams.worker_rank = 0;
+    cparams.n_worker    = 1;
+    for (uint32_t i = 1; i < n_world; ++i) {
+        if (n_layer_window[i] > 0) {
+            cparams.worker_rank += i <= my_rank ? 1 : 0;
+            cparams.n_worker++;
         }
-    } else if (n_layer_window[next_rank] <= 0 && topo_helper[next_rank].is_forwarder == 0) {
-        socket_to_close = ctx->send_socket;
     }
+}
 
-    // notify next exiting node
-    if (socket_to_close != nullptr) {
-        GGML_ASSERT(n_layer_window[next_rank] <= 0 && topo_helper[next_rank].is_forwarder == 0);
-        try {
-            auto msgs = topohelper_to_messages(topo_helper, n_world);
-            socket_to_close->set(zmq::sockopt::linger, 3500);
-            zmq::send_multipart(*socket_to_close, msgs);
-        } catch (const zmq::error_t & e) {
-            LLAMA_LOG_INFO("Failed to send data: %s\n", e.what());
+// the ring lost a device in the middle of a pass, drop what is in flight
+static int llama_ring_abort(llama_context & lctx) {
+    lctx.comm.reset();
+
+    if (lctx.cparams.rank == 0) {
+        return -3;
+    }
+
+    // the master sent the new ring while this device waited for activations
+    std::vector<uint8_t> frame;
+    frame.swap(lctx.ring.recover_frame);
+    if (!meta_is_recover_frame(frame.data(), frame.size())) {
+        LLAMA_LOG_ERROR("%s: unexpected control message of %zu bytes in the middle of a pass\n", __func__, frame.size());
+        return -1;
+    }
+    llama_ring_recover_local(lctx, frame.data());
+    return -1;
+}
+
+// continue on the ring the master rebuilt without a failed rank: reconnect if it was our next node,
+// take our new rank and the layers of the new windows, then report back to the master
+static void llama_ring_recover_local(llama_context & lctx, const uint8_t * frame) {
+    auto & cparams = lctx.cparams;
+
+    const meta_header * hdr = (const meta_header *) frame;
+    meta_recover rec;
+    std::memcpy(&rec, frame + sizeof(meta_header), sizeof(rec));
+
+    const uint32_t failed_rank = hdr->args[0];
+    const uint32_t epoch       = hdr->args[1];
+    const uint32_t my_rank     = cparams.rank - (cparams.rank > failed_rank ? 1 : 0);
+    const uint32_t n_world     = cparams.n_world - 1;
+
+    if (lctx.comm.is_async()) {
+        lctx.comm.reset();
+    }
+
+    if (hdr->args[2]) {
+        const std::string next_ip(rec.next_ip, strnlen(rec.next_ip, sizeof(rec.next_ip)));
+        llama_ring_reconnect(lctx, next_ip, hdr->args[3]);
+        LLAMA_LOG_INFO("%s: rank %u failed, sending to %s:%u from now on\n", __func__, failed_rank,
+            next_ip.c_str(), map_rank_to_port(hdr->args[3], lctx.data_port));
+    }
+
+    llama_ring_set_workers(cparams, rec.n_layer_window, my_rank, n_world);
+    lctx.comm.epoch = epoch;
+    {
+        std::lock_guard<std::mutex> lock(lctx.ring.mutex);
+        lctx.ring.rank  = my_rank;
+        lctx.ring.epoch = epoch;
+    }
+
+    const int ret = llama_reshard_local(lctx, rec.n_layer_window, rec.n_layer_extra, nullptr, my_rank, n_world, failed_rank);
+
+    std::vector<uint8_t> buf;
+    meta_header * ack = meta_init_header(buf, sizeof(meta_header), META_CMD_RECOVER);
+    ack->args[0] = my_rank;
+    ack->args[1] = epoch;
+    ack->args[2] = ret;
+    try {
+        lctx.master_socket->send(zmq::buffer(buf.data(), sizeof(meta_header)), zmq::send_flags::none);
+    } catch (const zmq::error_t & e) {
+        LLAMA_LOG_WARN("%s: failed to report to the master: %s\n", __func__, e.what());
+    }
+}
+
+int llama_recover_ring(
+        struct llama_context * ctx,
+                    uint32_t   failed_rank,
+              const uint32_t * n_layer_window,
+              const uint32_t * n_layer_extra) {
+    auto & cparams = ctx->cparams;
+    auto & ring    = ctx->ring;
+
+    const uint32_t n_world = cparams.n_world;
+    const uint32_t n_layer = ctx->model.hparams.n_layer;
+    GGML_ASSERT(cparams.rank == 0);
+
+    if (!ring.thread.joinable() || failed_rank == 0 || failed_rank >= n_world) {
+        LLAMA_LOG_ERROR("%s: cannot remove rank %u from a ring of %u\n", __func__, failed_rank, n_world);
+        return -1;
+    }
+    if (!llama_layer_windows_valid(n_layer, n_world - 1, n_layer_window, n_layer_extra)) {
+        LLAMA_LOG_ERROR("%s: the layer windows do not cover the %u layers on %u devices\n", __func__, n_layer, n_world - 1);
+        return -1;
+    }
+
+    // where every device listens, rank r is the next node of rank r - 1
+    std::vector<std::string> ip(n_world);
+    std::vector<uint32_t>    bind_rank(n_world, 0);
+    {
+        std::lock_guard<std::mutex> lock(ring.mutex);
+        ring.peers[0].next_ip        = ctx->next_node_ip;
+        ring.peers[0].next_bind_rank = cparams.original_next_rank;
+        for (uint32_t r = 0; r < n_world; ++r) {
+            ip       [(r + 1) % n_world] = ring.peers[r].next_ip;
+            bind_rank[(r + 1) % n_world] = ring.peers[r].next_bind_rank;
+        }
+    }
+    ip[0]        = ctx->master_ip;
+    bind_rank[0] = 0;
+
+    for (uint32_t r = 1; r < n_world; ++r) {
+        if (r != failed_rank && ip[r].empty()) {
+            LLAMA_LOG_ERROR("%s: the address of rank %u is unknown, rank %u never sent a heartbeat\n", __func__, r, r - 1);
             return -1;
         }
     }
-    
-    // notify next connect node
-    if (!ctx->next_node_ip.empty() && is_not_exit) {
-        GGML_ASSERT(ctx->send_socket != nullptr);
+
+    const uint32_t prev_rank = failed_rank - 1;
+    const uint32_t next_rank = (failed_rank + 1) % n_world;
+    const uint32_t epoch     = ctx->comm.epoch + 1;
+
+    ctx->comm.reset();
+
+    // the ring is broken, so the new one goes to every device directly. they reload their layers in parallel
+    std::vector<uint8_t> buf;
+    for (uint32_t r = 1; r < n_world; ++r) {
+        if (r == failed_rank) {
+            continue;
+        }
+        meta_header * hdr = meta_init_header(buf, meta_recover_frame_size(), META_CMD_RECOVER);
+        hdr->args[0] = failed_rank;
+        hdr->args[1] = epoch;
+        hdr->args[2] = r == prev_rank;
+        hdr->args[3] = bind_rank[next_rank];
+
+        meta_recover * rec = (meta_recover *) (buf.data() + sizeof(meta_header));
+        std::memset(rec, 0, sizeof(meta_recover));
+        std::copy(n_layer_window, n_layer_window + 32, rec->n_layer_window);
+        std::copy(n_layer_extra,  n_layer_extra  + 32, rec->n_layer_extra);
+        snprintf(rec->next_ip, sizeof(rec->next_ip), "%s", ip[next_rank].c_str());
+
         try {
-            auto msgs = topohelper_to_messages(topo_helper, n_world);
-            zmq::send_multipart(*ctx->send_socket, msgs);
+            zmq::socket_t socket(*ctx->sock_context, zmq::socket_type::push);
+            socket.set(zmq::sockopt::linger, (int) ring.fail_timeout_ms);
+            socket.connect("tcp://" + ip[r] + ":" + std::to_string(map_rank_to_port(bind_rank[r], ctx->data_port)));
+            socket.send(zmq::buffer(buf.data(), meta_recover_frame_size()), zmq::send_flags::none);
         } catch (const zmq::error_t & e) {
-            LLAMA_LOG_INFO("Failed to send data: %s\n", e.what());
+            LLAMA_LOG_ERROR("%s: failed to reach rank %u: %s\n", __func__, r, e.what());
             return -1;
         }
     }
-    
-    if (n_layer_window[my_rank] > 0) {
-        *node_type = NodeType::NODE_TYPE_WORKER;
-    } else if (topo_helper[my_rank].is_forwarder == 1) {
-        *node_type = NodeType::NODE_TYPE_FORWARDER;
-    } else {
-        *node_type = NodeType::NODE_TYPE_EXIT;
+
+    if (prev_rank == 0) {
+        llama_ring_reconnect(*ctx, ip[next_rank], bind_rank[next_rank]);
     }
 
-    if (ctx->send_socket != nullptr && *node_type != NodeType::NODE_TYPE_EXIT) {
-        // recv the whole view of all nodes
+    llama_ring_set_workers(cparams, n_layer_window, 0, n_world - 1);
+    ctx->comm.epoch = epoch;
+
+    if (llama_reshard_local(*ctx, n_layer_window, n_layer_extra, nullptr, 0, n_world - 1, failed_rank) != 0) {
+        return -1;
+    }
+
+    // wait until every device runs on the new ring, activations of the old one may still arrive
+    int ret = 0;
+    uint32_t n_ack = 0;
+    ctx->recv_socket->set(zmq::sockopt::rcvtimeo, (int) ring.fail_timeout_ms);
+    while (n_ack < n_world - 2) {
         std::vector<zmq::message_t> msgs;
         if (!zmq::recv_multipart(*ctx->recv_socket, std::back_inserter(msgs))) {
-            return -1;
+            LLAMA_LOG_ERROR("%s: only %u of %u devices joined the new ring\n", __func__, n_ack, n_world - 2);
+            ret = -1;
+            break;
         }
-        GGML_ASSERT(msgs.size() == n_world);
-        for (size_t i = 0; i < msgs.size(); i++) {
-            topo_helper[i].deserialize((char *)msgs[i].data());
+        if (msgs.size() != 1 || msgs[0].size() != sizeof(meta_header)) {
+            continue;
         }
-        // broadcast the whole view
-        if (next_connect_rank != 0) {
-            try {
-                zmq::send_multipart(*ctx->send_socket, msgs);
-            } catch (const zmq::error_t & e) {
-                LLAMA_LOG_INFO("Failed to send data: %s\n", e.what());
-                return -1;
-            }
+        const meta_header * ack = msgs[0].data<meta_header>();
+        if (ack->magic != META_MAGIC || ack->cmd != META_CMD_RECOVER || (uint32_t) ack->args[1] != epoch) {
+            continue;
+        }
+        if (ack->args[2] != 0) {
+            LLAMA_LOG_ERROR("%s: rank %d failed to load its new layers\n", __func__, ack->args[0]);
+            ret = -1;
         }
+        n_ack++;
     }
+    ctx->recv_socket->set(zmq::sockopt::rcvtimeo, -1);
 
-    for (size_t i = 0; i < n_world; i++) {
-        is_forwarder[i] = topo_helper[i].is_forwarder;
+    {
+        std::lock_guard<std::mutex> lock(ring.mutex);
+        ring.peers.erase(ring.peers.begin() + failed_rank);
+        for (auto & peer : ring.peers) {
+            peer.t_last_us = ggml_time_us();
+        }
+        ring.epoch = epoch;
     }
+    ring.failed_rank = -1;
 
-    ctx->cparams.node_type = *node_type;
-
-    if (socket_to_close != nullptr) {
-        socket_to_close->close();
-        delete socket_to_close;
+    if (ret == 0) {
+        LLAMA_LOG_INFO("%s: removed rank %u, the ring continues with %u devices\n", __func__, failed_rank, n_world - 1);
+        ret = llama_kv_handoff(*ctx);
     }
-    delete [] topo_helper;
-    return 0;
+    return ret;
 }
 
-int llama_forward_messages(llama_context *ctx) {
-    zmq::message_t message;
-    int more = true;
-    int timeout_ms = 10;
-    ctx->recv_socket->setsockopt(ZMQ_RCVTIMEO, &timeout_ms, sizeof(timeout_ms));
-    while (more) {
-        auto recv_result = ctx->recv_socket->recv(message, zmq::recv_flags::none);
-        if (!recv_result) {
+int llama_join_ring(
+        struct llama_context     * ctx,
+                    uint32_t       bind_rank,
+    const struct device_info     * dev_info,
+        struct llama_join_setup  * setup) {
+    auto & cparams = ctx->cparams;
+
+    // the new device comes after the last rank, so its next node is the master
+    ctx->sock_context  = new zmq::context_t(2);
+    ctx->send_socket   = new zmq::socket_t(*ctx->sock_context, zmq::socket_type::push);
+    ctx->recv_socket   = new zmq::socket_t(*ctx->sock_context, zmq::socket_type::pull);
+    ctx->signal_socket = new zmq::socket_t(*ctx->sock_context, zmq::socket_type::pull);
+    ctx->master_socket = ctx->send_socket;
+    ctx->bind_rank     = bind_rank;
+    ctx->next_node_ip  = ctx->master_ip;
+    cparams.original_next_rank = 0;
+
+    try {
+        ctx->recv_socket  ->bind("tcp://*:" + std::to_string(map_rank_to_port(bind_rank, ctx->data_port)));
+        ctx->signal_socket->bind("tcp://*:" + std::to_string(map_rank_to_port(bind_rank, ctx->signal_port)));
+        ctx->send_socket  ->connect("tcp://" + ctx->master_ip + ":" + std::to_string(map_rank_to_port(0, ctx->data_port)));
+
+        char * buffer = nullptr;
+        size_t buffer_size = serialize(dev_info, &buffer);
+        zmq::message_t msg(sizeof(ring_join_request) + buffer_size);
+        ring_join_request * req = msg.data<ring_join_request>();
+        req->magic     = RING_JOIN_MAGIC;
+        req->bind_rank = bind_rank;
+        std::memcpy(msg.data<uint8_t>() + sizeof(ring_join_request), buffer, buffer_size);
+        free(buffer);
+
+        zmq::socket_t socket(*ctx->sock_context, zmq::socket_type::push);
+        socket.connect("tcp://" + ctx->master_ip + ":" + std::to_string(map_rank_to_port(0, ctx->signal_port)));
+        socket.send(msg, zmq::send_flags::none);
+    } catch (const zmq::error_t & e) {
+        LLAMA_LOG_ERROR("%s: failed to reach the master at %s: %s\n", __func__, ctx->master_ip.c_str(), e.what());
+        return -1;
+    }
+
+    LLAMA_LOG_INFO("%s: waiting for the master at %s to take this device into the ring\n", __func__, ctx->master_ip.c_str());
+
+    // the master answers once the ranks in the ring are idle
+    zmq::message_t msg;
+    while (true) {
+        if (!ctx->recv_socket->recv(msg, zmq::recv_flags::none)) {
             return -1;
         }
-        size_t more_size = sizeof(more);
-        ctx->recv_socket->getsockopt(ZMQ_RCVMORE, &more, &more_size);
-        
-        ctx->send_socket->send(message, 
-            more ? zmq::send_flags::sndmore : zmq::send_flags::none);
+        if (msg.size() == meta_join_frame_size() && msg.data<meta_header>()->magic == META_MAGIC && msg.data<meta_header>()->cmd == META_CMD_JOIN) {
+            break;
+        }
+    }
+
+    const meta_header * hdr  = msg.data<meta_header>();
+    const meta_join   * join = (const meta_join *) (msg.data<uint8_t>() + sizeof(meta_header));
+    if (hdr->version != META_VERSION) {
+        LLAMA_LOG_ERROR("%s: the master speaks version %u of the control messages, this device version %u\n", __func__, hdr->version, META_VERSION);
+        return -1;
+    }
+    if (hdr->args[0] == 0) {
+        LLAMA_LOG_INFO("%s: the master has no layers for this device\n", __func__);
+        return -1;
+    }
+
+    setup->rank    = hdr->args[0];
+    setup->n_world = hdr->args[0] + 1;
+    setup->n_ctx   = hdr->args[3];
+    std::copy(join->n_layer_window, join->n_layer_window + 32, setup->n_layer_window);
+    std::copy(join->n_layer_extra,  join->n_layer_extra  + 32, setup->n_layer_extra);
+    std::copy(join->n_gpu_layers,   join->n_gpu_layers   + 32, setup->n_gpu_layers);
+
+    cparams.rank    = setup->rank;
+    cparams.n_world = setup->n_world;
+    llama_ring_set_workers(cparams, setup->n_layer_window, setup->rank, setup->n_world);
+    ctx->comm.epoch = hdr->args[2];
+    {
+        std::lock_guard<std::mutex> lock(ctx->ring.mutex);
+        ctx->ring.rank  = setup->rank;
+        ctx->ring.epoch = hdr->args[2];
     }
+
+    LLAMA_LOG_INFO("%s: joined the ring as rank %u of %u\n", __func__, setup->rank, setup->n_world);
     return 0;
 }
 
-int llama_recv_layer_setup(struct llama_context * ctx, uint32_t * n_layer_window, uint32_t * n_gpu_layers) {
-    uint32_t n_world = ctx->cparams.n_world;
-    uint32_t my_rank = ctx->cparams.rank;
+bool llama_poll_join(
+        struct llama_context       * ctx,
+                     int32_t         timeout_ms,
+        struct llama_join_request  * req,
+        struct device_info         * dev_info) {
+    auto & ring = ctx->ring;
+    if (!ring.thread.joinable() || ctx->cparams.rank != 0) {
+        return false;
+    }
 
-    // non-master ranks receive data from their previous rank
-    std::vector<zmq::message_t> msgs;
-    if (!zmq::recv_multipart(*ctx->recv_socket, std::back_inserter(msgs))) {
-        return -1;
+    std::unique_lock<std::mutex> lock(ring.mutex);
+    if (!ring.joins_cv.wait_for(lock, std::chrono::milliseconds(std::max(timeout_ms, 0)), [&]{ return !ring.joins.empty() || ring.stop; }) || ring.joins.empty()) {
+        return false;
+    }
+    if (req == nullptr) {
+        return true;
     }
 
-    GGML_ASSERT(msgs[0].to_string() == "n_layer_window");
-    GGML_ASSERT(msgs[1].size() == sizeof(uint32_t) * 32);
-    memcpy(n_layer_window, msgs[1].data(), sizeof(uint32_t) * 32);
+    llama_ring::join_entry entry = std::move(ring.joins.front());
+    ring.joins.pop_front();
+    lock.unlock();
+
+    *req = entry.req;
+    deserialize((const char *) entry.dev_info.data(), dev_info);
+    return true;
+}
+
+int llama_admit_device(
+        struct llama_context            * ctx,
+        const struct llama_join_request * req,
+                     const uint32_t     * n_layer_window,
+                     const uint32_t     * n_layer_extra,
+                     const uint32_t     * n_gpu_layers) {
+    auto & cparams = ctx->cparams;
+    auto & ring    = ctx->ring;
 
-    if (msgs.size() > 2) {
-        GGML_ASSERT(msgs[2].to_string() == "n_gpu_layers");
-        GGML_ASSERT(msgs[3].size() == sizeof(uint32_t) * 32);
-        memcpy(n_gpu_layers, msgs[3].data(), sizeof(uint32_t) * 32);
+    const uint32_t n_world = cparams.n_world;
+    const uint32_t n_layer = ctx->model.hparams.n_layer;
+    GGML_ASSERT(cparams.rank == 0);
+
+    std::vector<uint8_t> buf;
+    meta_header * hdr = meta_init_header(buf, meta_join_frame_size(), META_CMD_JOIN);
+    meta_join   * join = (meta_join *) (buf.data() + sizeof(meta_header));
+    std::memset(join, 0, sizeof(meta_join));
+    snprintf(join->ip, sizeof(join->ip), "%s", req->ip);
+
+    bool admit = n_layer_window != nullptr && n_world < 32;
+    if (admit) {
+        uint32_t n_layer_extra_[32] = {0};
+        if (n_layer_extra != nullptr) {
+            std::copy(n_layer_extra, n_layer_extra + 32, n_layer_extra_);
+        }
+        // the new device computes, and so does every rank already in the ring
+        for (uint32_t i = 0; i <= n_world && admit; ++i) {
+            admit = n_layer_window[i] > 0;
+        }
+        if (!admit || !llama_layer_windows_valid(n_layer, n_world + 1, n_layer_window, n_layer_extra_)) {
+            LLAMA_LOG_ERROR("%s: the windows must give layers to all %u devices and add up to %u layers\n", __func__, n_world + 1, n_layer);
+            admit = false;
+        }
+        std::copy(n_layer_window, n_layer_window + 32, join->n_layer_window);
+        std::copy(n_layer_extra_, n_layer_extra_ + 32, join->n_layer_extra);
+        if (n_gpu_layers != nullptr) {
+            std::copy(n_gpu_layers, n_gpu_layers + 32, join->n_gpu_layers);
+        }
     }
 
-    // non-master ranks forward the received message to their next rank
-    try {
-        if (my_rank == n_world - 1) {
-            // last rank just sends an ack to pass the barrier
-            msgs.clear();
-            msgs.emplace_back("ACK", strlen("ACK"));
+    hdr->args[0] = admit ? n_world : 0;
+    hdr->args[1] = req->bind_rank;
+    hdr->args[2] = ctx->comm.epoch;
+    hdr->args[3] = cparams.n_ctx;
+    hdr->args[4] = n_gpu_layers != nullptr;
+
+    if (!admit) {
+        // tell the device directly, it is not connected to anyone yet
+        try {
+            zmq::socket_t socket(*ctx->sock_context, zmq::socket_type::push);
+            socket.set(zmq::sockopt::linger, 1000);
+            socket.connect("tcp://" + std::string(req->ip) + ":" + std::to_string(map_rank_to_port(req->bind_rank, ctx->data_port)));
+            socket.send(zmq::buffer(buf.data(), meta_join_frame_size()), zmq::send_flags::none);
+        } catch (const zmq::error_t & e) {
+            LLAMA_LOG_WARN("%s: failed to turn away the device at %s: %s\n", __func__, req->ip, e.what());
         }
-        zmq::send_multipart(*ctx->send_socket, msgs);
-    } catch (const zmq::error_t& e) {
-        LLAMA_LOG_INFO("Failed to send data: %s\n", e.what());
+        return n_layer_window == nullptr ? 0 : -1;
+    }
+
+    if (ctx->comm.is_async()) {
+        ctx->comm.flush();
+    }
+
+    // the ranks reload their layers while the new device loads its own. the master only sends,
+    // the ring keeps the order, so the first batch waits behind the new device at the end of the ring
+    try {
+        ctx->send_socket->send(zmq::buffer(buf.data(), meta_join_frame_size()), zmq::send_flags::none);
+    } catch (const zmq::error_t & e) {
+        LLAMA_LOG_ERROR("%s: failed to send the new ring: %s\n", __func__, e.what());
         return -1;
     }
-    
-    return 0;
+
+    if (ring.thread.joinable()) {
+        std::lock_guard<std::mutex> lock(ring.mutex);
+        llama_ring::peer peer;
+        peer.t_last_us = ggml_time_us();
+        ring.peers.push_back(peer);
+    }
+
+    llama_ring_set_workers(cparams, join->n_layer_window, 0, n_world + 1);
+
+    LLAMA_LOG_INFO("%s: device at %s joins as rank %u\n", __func__, req->ip, n_world);
+    if (llama_reshard_local(*ctx, join->n_layer_window, join->n_layer_extra, n_gpu_layers != nullptr ? join->n_gpu_layers : nullptr, 0, n_world + 1) != 0) {
+        return -1;
+    }
+    return llama_kv_handoff(*ctx);
+}
+
+// take the new ring with a device after the last rank, which sends to the new device from now on
+static void llama_ring_join_local(llama_context & lctx, const uint8_t * frame) {
+    auto & cparams = lctx.cparams;
+
+    const meta_header * hdr = (const meta_header *) frame;
+    meta_join join;
+    std::memcpy(&join, frame + sizeof(meta_header), sizeof(join));
+
+    const uint32_t new_rank = hdr->args[0];
+    const uint32_t my_rank  = cparams.rank;
+    const uint32_t n_world  = new_rank + 1;
+
+    if (my_rank + 1 == new_rank) {
+        const std::string ip(join.ip, strnlen(join.ip, sizeof(join.ip)));
+        const uint32_t bind_rank = hdr->args[1];
+
+        zmq::socket_t * socket = new zmq::socket_t(*lctx.sock_context, zmq::socket_type::push);
+        socket->connect("tcp://" + ip + ":" + std::to_string(map_rank_to_port(bind_rank, lctx.data_port)));
+
+        if (lctx.comm.is_async()) {
+            lctx.comm.flush();
+        }
+        // the old next node is the master, keep talking to it over the same socket
+        if (lctx.master_socket != lctx.send_socket) {
+            lctx.master_socket->set(zmq::sockopt::linger, 0);
+            lctx.master_socket->close();
+            delete lctx.master_socket;
+        }
+        lctx.master_socket = lctx.send_socket;
+        lctx.send_socket   = socket;
+        {
+            std::lock_guard<std::mutex> lock(lctx.ring.mutex);
+            lctx.next_node_ip          = ip;
+            cparams.original_next_rank = bind_rank;
+        }
+        LLAMA_LOG_INFO("%s: a device joined after this rank, sending to %s:%u from now on\n", __func__,
+            ip.c_str(), map_rank_to_port(bind_rank, lctx.data_port));
+    }
+
+    // pass it on first, so that the ranks reload their weights in parallel
+    llama_forward_meta(lctx, meta_join_frame_size());
+
+    llama_ring_set_workers(cparams, join.n_layer_window, my_rank, n_world);
+    llama_reshard_local(lctx, join.n_layer_window, join.n_layer_extra, hdr->args[4] ? join.n_gpu_layers : nullptr, my_rank, n_world);
 }
 
 void llama_free_sockets(struct llama_context * ctx, char ** msg) {
@@ -20892,6 +24938,13 @@ void llama_free_sockets(struct llama_context * ctx, char ** msg) {
 
     if (n_world == 1) return;
 
+    llama_tp_reset(*ctx);
+
+    // the monitor owns the signal socket of the master until now
+    if (my_rank == 0) {
+        ctx->ring.halt();
+    }
+
     zmq::socket_t signal_sender(*ctx->sock_context, zmq::socket_type::push);
     std::string endp = "tcp://" + ctx->next_node_ip + ":" + std::to_string(map_rank_to_port(next_rank, ctx->signal_port));
     signal_sender.connect(endp);
@@ -20901,7 +24954,13 @@ void llama_free_sockets(struct llama_context * ctx, char ** msg) {
     }
 
     zmq::message_t recv_msg;
-    if (ctx->signal_socket->recv(recv_msg, zmq::recv_flags::none)) {
+    bool received = false;
+    while ((received = ctx->signal_socket->recv(recv_msg, zmq::recv_flags::none).has_value())) {
+        if (!ring_is_heartbeat(recv_msg) && !ring_is_join_request(recv_msg)) {
+            break;
+        }
+    }
+    if (received) {
         std::string msg_str(static_cast<char*>(recv_msg.data()), recv_msg.size());
         if (msg_str == "STOP" && my_rank != 0) {
             signal_sender.send(recv_msg, zmq::send_flags::dontwait);
@@ -20940,6 +24999,8 @@ struct llama_context * llama_new_context_with_model(
     ctx->next_node_ip    = params.next_node_ip;
     ctx->data_port       = params.data_port;
     ctx->signal_port     = params.signal_port;
+    ctx->tp_port         = params.tp_port;
+    ctx->ring.fail_timeout_ms = params.fail_timeout;
     ctx->cparams.n_world = params.n_world;
     ctx->cparams.rank    = params.rank;
     ctx->cparams.force   = params.force;
@@ -20983,16 +25044,42 @@ void * llama_context_setup_backend(
         params.flash_attn = false;
     }
 
+    if (!comm_type_supported(params.comm_type)) {
+        LLAMA_LOG_WARN("%s: comm_type %s is not supported - using f32\n", __func__, ggml_type_name(params.comm_type));
+        params.comm_type = GGML_TYPE_F32;
+    }
+
+    // without flash_attn a quantized V cache is kept a row per cell and dequantized on read, which only the CPU does
     if (params.type_v != GGML_TYPE_F16 && !params.flash_attn) {
-        LLAMA_LOG_ERROR("%s: V cache quantization requires flash_attn\n", __func__);
-        return nullptr;
+        if (!ggml_is_quantized(params.type_v) || model->arch == LLM_ARCH_T5) {
+            LLAMA_LOG_ERROR("%s: V cache of type %s requires flash_attn\n", __func__, ggml_type_name(params.type_v));
+            return nullptr;
+        }
+        // with offload_kqv the cache of a layer goes where its weights are, see llama_kv_cache_init
+        for (const auto & buft : model->buft_layer) {
+            if (params.offload_kqv && buft.buft != llama_default_buffer_type_cpu(*model, true)) {
+                LLAMA_LOG_ERROR("%s: V cache of type %s on the GPU requires flash_attn\n", __func__, ggml_type_name(params.type_v));
+                return nullptr;
+            }
+        }
     }
 
     const auto & hparams = model->hparams;
     auto       & cparams = ctx->cparams;
 
+    ctx->setup_params = params;
+
     std::copy(std::begin(params.n_layer_window), std::end(params.n_layer_window), cparams.n_layer_window);
+    std::copy(std::begin(params.n_layer_extra),  std::end(params.n_layer_extra),  cparams.n_layer_extra);
+    std::copy(std::begin(params.tp_ffn_share),   std::end(params.tp_ffn_share),   cparams.tp_ffn_share);
     cparams.prefetch         = params.prefetch;
+    cparams.release_policy   = params.release_policy;
+    cparams.comm_type        = params.comm_type;
+    cparams.async_comm       = params.async_comm;
+    cparams.residency_stats  = params.residency_stats;
+    cparams.kv_replicate     = params.kv_replicate;
+    ctx->comm.comm_type      = params.comm_type;
+    ctx->comm.replica        = params.kv_replicate ? &ctx->kv_replica : nullptr;
     cparams.n_seq_max        = std::max(1u, params.n_seq_max);
     cparams.n_threads        = params.n_threads;
     cparams.n_threads_batch  = params.n_threads_batch;
@@ -21007,6 +25094,10 @@ void * llama_context_setup_backend(
     cparams.no_perf          = params.no_perf;
     cparams.pooling_type     = params.pooling_type;
 
+    if (model->stream) {
+        model->stream->spawn(params.n_threads);
+    }
+
     cparams.n_ctx            = params.n_ctx           == 0    ? hparams.n_ctx_train           : params.n_ctx;   
     cparams.rope_freq_base   = params.rope_freq_base  == 0.0f ? hparams.rope_freq_base_train  : params.rope_freq_base;
     cparams.rope_freq_scale  = params.rope_freq_scale == 0.0f ? hparams.rope_freq_scale_train : params.rope_freq_scale;
@@ -21026,6 +25117,7 @@ void * llama_context_setup_backend(
     }
 
     cparams.n_ubatch         = std::min(cparams.n_batch, params.n_ubatch == 0 ? params.n_batch : params.n_ubatch);
+    cparams.n_micro_batch    = std::min(cparams.n_ubatch, params.n_micro_batch);
 
     cparams.n_ctx_orig_yarn  = params.yarn_orig_ctx    != 0 ? params.yarn_orig_ctx    :
                                hparams.n_ctx_orig_yarn != 0 ? hparams.n_ctx_orig_yarn :
@@ -21066,10 +25158,14 @@ void * llama_context_setup_backend(
     LLAMA_LOG_INFO("%s: n_world      = %u\n",     __func__, cparams.n_world);
     LLAMA_LOG_INFO("%s: rank         = %u\n",     __func__, cparams.rank);
     LLAMA_LOG_INFO("%s: win_size     = %u\n",     __func__, cparams.n_layer_window[cparams.rank]);
+    LLAMA_LOG_INFO("%s: win_extra    = %u\n",     __func__, cparams.n_layer_extra[cparams.rank]);
     LLAMA_LOG_INFO("%s: n_ctx        = %u\n",     __func__, cparams.n_ctx);
     LLAMA_LOG_INFO("%s: n_batch      = %u\n",     __func__, cparams.n_batch);
     LLAMA_LOG_INFO("%s: n_ubatch     = %u\n",     __func__, cparams.n_ubatch);
+    LLAMA_LOG_INFO("%s: n_mbatch     = %u\n",     __func__, cparams.n_micro_batch);
     LLAMA_LOG_INFO("%s: flash_attn   = %d\n",     __func__, cparams.flash_attn);
+    LLAMA_LOG_INFO("%s: comm_type    = %s\n",     __func__, ggml_type_name(cparams.comm_type));
+    LLAMA_LOG_INFO("%s: async_comm   = %d\n",     __func__, cparams.async_comm);
     LLAMA_LOG_INFO("%s: freq_base    = %.1f\n",   __func__, cparams.rope_freq_base);
     LLAMA_LOG_INFO("%s: freq_scale   = %g\n",     __func__, cparams.rope_freq_scale);
     LLAMA_LOG_INFO("%s: master_ip    = %s\n",     __func__, ctx->master_ip.c_str());
@@ -21316,12 +25412,15 @@ void * llama_context_setup_backend(
                 }
             }
 
-            const size_t max_nodes    = llama_model_max_nodes(*model);
-            const size_t n_window_sum = std::accumulate(cparams.n_layer_window, cparams.n_layer_window + 32, 0u);
-            const size_t n_graphs     = static_cast<size_t>(std::ceil(llama_n_layer(model) / n_window_sum));
+            // a ubatch is stored in at most one run of cells per token, more than LLAMA_KV_MAX_RUNS are split further
+            const size_t max_nodes    = llama_model_max_nodes(*model, std::min<size_t>(LLAMA_KV_MAX_RUNS, cparams.n_ubatch));
+            const size_t n_graphs     = llama_n_cycles(llama_n_layer(model), cparams.n_world, cparams.n_layer_window, cparams.n_layer_extra);
 
             // buffer used to store the computation graph and the tensor meta data
             ctx->buf_compute_meta.resize(ggml_tensor_overhead()*max_nodes + ggml_graph_overhead_custom(max_nodes, false)*n_graphs);
+            for (auto & e : ctx->graph_cache.entries) {
+                e.buf_meta.resize(ctx->buf_compute_meta.size());
+            }
 
             // TODO: move these checks to ggml_backend_sched
             // enabling pipeline parallelism in the scheduler increases memory usage, so it is only done when necessary
@@ -21432,6 +25531,14 @@ uint32_t * llama_context_n_layer_window(struct llama_context * ctx) {
     return ctx->cparams.n_layer_window;
 }
 
+uint32_t * llama_context_n_layer_extra(struct llama_context * ctx) {
+    return ctx->cparams.n_layer_extra;
+}
+
+uint32_t * llama_context_tp_ffn_share(struct llama_context * ctx) {
+    return ctx->cparams.tp_ffn_share;
+}
+
 void llama_free(struct llama_context * ctx) {
     delete ctx;
 }
@@ -21618,6 +25725,18 @@ uint32_t llama_model_n_layers(const struct llama_model * model) {
     return model->hparams.n_layer;
 }
 
+int64_t llama_model_layers_nbytes(const struct llama_model * model, int32_t il0, int32_t il1) {
+    if (model->layer_nbytes.empty()) {
+        return -1;
+    }
+
+    int64_t nb = 0;
+    for (int32_t il = std::max(0, il0); il < std::min(il1, (int32_t) model->layer_nbytes.size()); ++il) {
+        nb += model->layer_nbytes[il];
+    }
+    return nb;
+}
+
 uint32_t llama_model_n_gpu_layers(const struct llama_model * model) {
     return model->n_gpu_layers;
 }
@@ -22102,8 +26221,8 @@ void llama_total_kv_size(
    const struct llama_context_params   cparams, 
                                 bool   use_gpu) {
     const llama_hparams hparams = model->hparams;
-    uint64_t nb_k = static_cast<uint64_t>(hparams.n_embd_k_gqa()) * cparams.n_ctx * ggml_type_size(cparams.type_k);
-    uint64_t nb_v = static_cast<uint64_t>(hparams.n_embd_v_gqa()) * cparams.n_ctx * ggml_type_size(cparams.type_v);
+    uint64_t nb_k = static_cast<uint64_t>(cparams.n_ctx) * ggml_row_size(cparams.type_k, hparams.n_embd_k_gqa());
+    uint64_t nb_v = static_cast<uint64_t>(cparams.n_ctx) * ggml_row_size(cparams.type_v, hparams.n_embd_v_gqa());
     if (use_gpu) {
         int n_gpu_layers = std::min(cparams.n_gpu_layers, hparams.n_layer);
         *gpu_cache = (nb_k + nb_v) * n_gpu_layers;
@@ -22129,8 +26248,8 @@ void llama_kv_size(
     const int64_t n_embd_k_gqa = static_cast<int64_t>(hparams.n_embd_k_gqa());
     const int64_t n_embd_v_gqa = static_cast<int64_t>(hparams.n_embd_v_gqa());
 
-    const int64_t nb_k = n_embd_k_gqa * n_kv * ggml_type_size(cparams.type_k);
-    const int64_t nb_v = n_embd_v_gqa * n_kv * ggml_type_size(cparams.type_v);
+    const int64_t nb_k = n_kv * ggml_row_size(cparams.type_k, n_embd_k_gqa);
+    const int64_t nb_v = n_kv * ggml_row_size(cparams.type_v, n_embd_v_gqa);
     if (use_gpu) {
         const int64_t n_gpu_layers = std::min(n_layer, static_cast<int64_t>(cparams.n_gpu_layers));
         *gpu_cache = (nb_k + nb_v) * n_gpu_layers;
@@ -22216,10 +26335,10 @@ void llama_model_n_flops(
             case LLM_ARCH_MINICPM:
             case LLM_ARCH_GRANITE:
             case LLM_ARCH_GRANITE_MOE:
-                llm_load_llama_tensors(*ml, *model, ctx_map, 1, 0, n_layer_window, &use_mmap_buffer, false);
+                llm_load_llama_tensors(*ml, *model, ctx_map, 1, 0, n_layer_window, nullptr, &use_mmap_buffer, false);
                 break;
             case LLM_ARCH_QWEN2:
-                llm_load_qwen2_tensors(*ml, *model, ctx_map, 1, 0, n_layer_window, false);
+                llm_load_qwen2_tensors(*ml, *model, ctx_map, 1, 0, n_layer_window, nullptr, false);
                 break;
             default:
                 throw std::runtime_error("unsupported architecture\n");
@@ -22227,13 +26346,17 @@ void llama_model_n_flops(
 
     bool rope_used = false;
 
+    // the layers of a hybrid quantized model differ in size, the scheduler sums them up
+    model->layer_nbytes.assign(n_layer, 0);
+
     for (auto * cur = ggml_get_first_tensor(ctx); cur != NULL; cur = ggml_get_next_tensor(ctx, cur)) {
         std::string tensor_name(ggml_get_name(cur));
-        std::regex blk_regex("blk\\.\\d+\\.(.+)");
+        std::regex blk_regex("blk\\.(\\d+)\\.(.+)");
         std::smatch match;
 
-        if (std::regex_match(tensor_name, match, blk_regex) && match.size() > 1) {
-            std::string blk_suffix = match[1].str();
+        if (std::regex_match(tensor_name, match, blk_regex) && match.size() > 2) {
+            const int il = std::stoi(match[1].str());
+            std::string blk_suffix = match[2].str();
 
             if (blk_suffix == "attn_norm.weight" || blk_suffix == "ffn_norm.weight") {
                 count_n_flops (n_flops,  GGML_TYPE_F32, PROFILER_LAYER_BACKEND, 4 * n_embd + 1); // rms norm
@@ -22279,6 +26402,9 @@ void llama_model_n_flops(
             }
             count_n_params(n_params, cur->type,         PROFILER_LAYER_BACKEND, ggml_nelements(cur));
             count_n_bytes (n_bytes,                     PROFILER_LAYER_BACKEND, ggml_nbytes(cur));
+            if (il < (int)n_layer) {
+                model->layer_nbytes[il] += ggml_nbytes(cur);
+            }
         } else {
             if (tensor_name == "token_embd.weight") {
                 count_n_params(n_params, cur->type,     PROFILER_LAYER_INPUT, ggml_nelements(cur));
@@ -22467,6 +26593,8 @@ int32_t llama_control_vector_apply(struct llama_context * lctx, const float * da
     const llama_model & model = lctx->model;
     llama_control_vector & cvec = lctx->cvec;
 
+    lctx->graph_cache.clear();
+
     if (data == nullptr) {
         // disable the current control vector (but leave allocated for later)
         cvec.layer_start = -1;
@@ -22608,18 +26736,7 @@ void llama_kv_cache_clear(struct llama_context * ctx) {
 }
 
 void llama_send_kv_cache_clear(struct llama_context * ctx) {
-    if (ctx->send_socket == nullptr) {
-        return;
-    }
-    
-    try {
-        std::vector<zmq::message_t> send_msgs;
-        const char * cmd = "clear_kv_cache";
-        send_msgs.emplace_back(cmd, strlen(cmd));
-        zmq::send_multipart(*ctx->send_socket, send_msgs);
-    } catch (const zmq::error_t & e) {
-        LLAMA_LOG_INFO("Failed to send KV cache clear signal: %s\n", e.what());
-    }
+    llama_send_meta_cmd(ctx, META_CMD_KV_CLEAR, {});
 }
 
 bool llama_kv_cache_seq_rm(struct llama_context * ctx, llama_seq_id seq_id, llama_pos p0, llama_pos p1) {
@@ -22627,20 +26744,7 @@ bool llama_kv_cache_seq_rm(struct llama_context * ctx, llama_seq_id seq_id, llam
 }
 
 void llama_send_kv_cache_seq_rm(struct llama_context * ctx, llama_seq_id seq_id, llama_pos p0, llama_pos p1) {
-    if (ctx->send_socket == nullptr) {
-        return;
-    }
-
-    try {
-        std::vector<zmq::message_t> msgs;
-        msgs.emplace_back("kv_seq_rm", strlen("kv_seq_rm"));
-        msgs.emplace_back(&seq_id, sizeof(seq_id));
-        msgs.emplace_back(&p0,     sizeof(p0));
-        msgs.emplace_back(&p1,     sizeof(p1));
-        zmq::send_multipart(*ctx->send_socket, msgs);
-    } catch (const zmq::error_t & e) {
-        LLAMA_LOG_WARN("Failed to send kv_seq_rm: %s\n", e.what());
-    }
+    llama_send_meta_cmd(ctx, META_CMD_KV_SEQ_RM, {seq_id, p0, p1});
 }
 
 void llama_kv_cache_seq_cp(struct llama_context * ctx, llama_seq_id seq_id_src, llama_seq_id seq_id_dst, llama_pos p0, llama_pos p1) {
@@ -22651,21 +26755,7 @@ void llama_kv_cache_seq_cp(struct llama_context * ctx, llama_seq_id seq_id_src,
 }
 
 void llama_send_kv_cache_seq_cp(struct llama_context * ctx, llama_seq_id seq_id_src, llama_seq_id seq_id_dst, llama_pos p0, llama_pos p1) {
-    if (ctx->send_socket == nullptr) {
-        return;
-    }
-
-    try {
-        std::vector<zmq::message_t> msgs;
-        msgs.emplace_back("kv_seq_cp", strlen("kv_seq_cp"));
-        msgs.emplace_back(&seq_id_src, sizeof(seq_id_src));
-        msgs.emplace_back(&seq_id_dst, sizeof(seq_id_dst));
-        msgs.emplace_back(&p0,         sizeof(p0));
-        msgs.emplace_back(&p1,         sizeof(p1));
-        zmq::send_multipart(*ctx->send_socket, msgs);
-    } catch (const zmq::error_t & e) {
-        LLAMA_LOG_WARN("Failed to send kv_seq_cp: %s\n", e.what());
-    }
+    llama_send_meta_cmd(ctx, META_CMD_KV_SEQ_CP, {seq_id_src, seq_id_dst, p0, p1});
 }
 
 void llama_kv_cache_seq_keep(struct llama_context * ctx, llama_seq_id seq_id) {
@@ -22673,18 +26763,7 @@ void llama_kv_cache_seq_keep(struct llama_context * ctx, llama_seq_id seq_id) {
 }
 
 void llama_send_kv_cache_seq_keep(struct llama_context * ctx, llama_seq_id seq_id) {
-    if (ctx->send_socket == nullptr) {
-        return;
-    }
-
-    try {
-        std::vector<zmq::message_t> msgs;
-        msgs.emplace_back("kv_seq_keep", strlen("kv_seq_keep"));
-        msgs.emplace_back(&seq_id, sizeof(seq_id));
-        zmq::send_multipart(*ctx->send_socket, msgs);
-    } catch (const zmq::error_t & e) {
-        LLAMA_LOG_WARN("Failed to send kv_seq_keep: %s\n", e.what());
-    }
+    llama_send_meta_cmd(ctx, META_CMD_KV_SEQ_KEEP, {seq_id});
 }
 
 void llama_kv_cache_seq_add(struct llama_context * ctx, llama_seq_id seq_id, llama_pos p0, llama_pos p1, llama_pos delta) {
@@ -22696,21 +26775,7 @@ void llama_kv_cache_seq_add(struct llama_context * ctx, llama_seq_id seq_id, lla
 }
 
 void llama_send_kv_cache_seq_add(struct llama_context * ctx, llama_seq_id seq_id, llama_pos p0, llama_pos p1, llama_pos delta) {
-    if (ctx->send_socket == nullptr) {
-        return;
-    }
-    
-    try {
-        std::vector<zmq::message_t> msgs;
-        msgs.emplace_back("kv_seq_add", strlen("kv_seq_add"));
-        msgs.emplace_back(&seq_id, sizeof(seq_id));
-        msgs.emplace_back(&p0,     sizeof(p0));
-        msgs.emplace_back(&p1,     sizeof(p1));
-        msgs.emplace_back(&delta,  sizeof(delta));
-        zmq::send_multipart(*ctx->send_socket, msgs);
-    } catch (const zmq::error_t & e) {
-        LLAMA_LOG_WARN("Failed to send kv_seq_add: %s\n", e.what());
-    }
+    llama_send_meta_cmd(ctx, META_CMD_KV_SEQ_ADD, {seq_id, p0, p1, delta});
 }
 
 void llama_kv_cache_seq_div(struct llama_context * ctx, llama_seq_id seq_id, llama_pos p0, llama_pos p1, int d) {
@@ -22722,21 +26787,7 @@ void llama_kv_cache_seq_div(struct llama_context * ctx, llama_seq_id seq_id, lla
 }
 
 void llama_send_kv_cache_seq_div(struct llama_context * ctx, llama_seq_id seq_id, llama_pos p0, llama_pos p1, int d) {
-    if (ctx->send_socket == nullptr) {
-        return;
-    }
-
-    try {
-        std::vector<zmq::message_t> msgs;
-        msgs.emplace_back("kv_seq_div", strlen("kv_seq_div"));
-        msgs.emplace_back(&seq_id, sizeof(seq_id));
-        msgs.emplace_back(&p0,     sizeof(p0));
-        msgs.emplace_back(&p1,     sizeof(p1));
-        msgs.emplace_back(&d,      sizeof(d));
-        zmq::send_multipart(*ctx->send_socket, msgs);
-    } catch (const zmq::error_t & e) {
-        LLAMA_LOG_WARN("Failed to send kv_seq_div: %s\n", e.what());
-    }
+    llama_send_meta_cmd(ctx, META_CMD_KV_SEQ_DIV, {seq_id, p0, p1, d});
 }
 
 llama_pos llama_kv_cache_seq_pos_max(struct llama_context * ctx, llama_seq_id seq_id) {
@@ -22994,8 +27045,78 @@ struct llama_data_write {
 
         write(&cell_count, sizeof(cell_count));
 
-        write_kv_cache_meta(kv_self, cell_ranges, seq_id);
-        write_kv_cache_data(ctx, cell_ranges);
+        write_kv_cache_meta(kv_self, cell_ranges, seq_id);
+        write_kv_cache_data(ctx, cell_ranges);
+    }
+
+    // the given cells of layer il, from the kv cache of this rank or, if given, from the replica of the layer
+    void write_kv_layer(const struct llama_context * ctx, uint32_t il, const llama_kv_replica::layer * replica,
+                        const std::vector<std::pair<uint32_t, uint32_t>> & cell_ranges) {
+        const struct llama_kv_cache & kv_self = ctx->kv_self;
+        const struct llama_hparams & hparams = ctx->model.hparams;
+        const auto & cparams = ctx->cparams;
+
+        const ggml_tensor * k = nullptr;
+        const ggml_tensor * v = nullptr;
+        if (replica == nullptr) {
+            const int32_t local_il = map_layer_to_local_id(il, cparams.n_world, cparams.rank, cparams.n_layer_window, cparams.n_layer_extra);
+            GGML_ASSERT(local_il >= 0 && (size_t) local_il < kv_self.k_l.size());
+            k = kv_self.k_l[local_il];
+            v = kv_self.v_l[local_il];
+        }
+
+        const ggml_type type_k = replica == nullptr ? k->type : replica->type_k;
+        const ggml_type type_v = replica == nullptr ? v->type : replica->type_v;
+
+        // read from the tensor, or from the same offset of its copy in host memory
+        auto write_data = [&](const ggml_tensor * tensor, const std::vector<uint8_t> * host, size_t offset, size_t size) {
+            if (host != nullptr) {
+                GGML_ASSERT(offset + size <= host->size());
+                write(host->data() + offset, size);
+            } else {
+                write_tensor_data(tensor, offset, size);
+            }
+        };
+
+        const uint32_t n_range = cell_ranges.size();
+        write(&n_range, sizeof(n_range));
+        for (const auto & range : cell_ranges) {
+            write(&range.first,  sizeof(range.first));
+            write(&range.second, sizeof(range.second));
+        }
+
+        const uint32_t n_embd_k_gqa = hparams.n_embd_k_gqa(il) + hparams.n_embd_k_s();
+        const uint32_t n_embd_v_gqa = hparams.n_embd_v_gqa(il) + hparams.n_embd_v_s();
+
+        const int32_t  k_type_i   = (int32_t) type_k;
+        const uint64_t k_size_row = ggml_row_size(type_k, n_embd_k_gqa);
+        write(&k_type_i,   sizeof(k_type_i));
+        write(&k_size_row, sizeof(k_size_row));
+        for (const auto & range : cell_ranges) {
+            write_data(k, replica ? &replica->k : nullptr, range.first * k_size_row, (range.second - range.first) * k_size_row);
+        }
+
+        const uint32_t v_trans  = kv_self.v_trans ? 1 : 0;
+        const int32_t  v_type_i = (int32_t) type_v;
+        write(&v_trans,  sizeof(v_trans));
+        write(&v_type_i, sizeof(v_type_i));
+        if (!kv_self.v_trans) {
+            const uint64_t v_size_row = ggml_row_size(type_v, n_embd_v_gqa);
+            write(&v_size_row, sizeof(v_size_row));
+            for (const auto & range : cell_ranges) {
+                write_data(v, replica ? &replica->v : nullptr, range.first * v_size_row, (range.second - range.first) * v_size_row);
+            }
+        } else {
+            // each row of the transposed value holds one element per cell
+            const uint32_t v_size_el = ggml_type_size(type_v);
+            write(&v_size_el,    sizeof(v_size_el));
+            write(&n_embd_v_gqa, sizeof(n_embd_v_gqa));
+            for (uint32_t j = 0; j < n_embd_v_gqa; ++j) {
+                for (const auto & range : cell_ranges) {
+                    write_data(v, replica ? &replica->v : nullptr, (range.first + j * kv_self.size) * v_size_el, (range.second - range.first) * v_size_el);
+                }
+            }
+        }
     }
 };
 
@@ -23121,13 +27242,14 @@ struct llama_data_read {
                 return false;
             }
 
-            // DEBUG CHECK: kv_self.head should be our first cell, kv_self.head + cell_count - 1 should be our last cell (verify seq_id and pos values)
-            // Assume that this is one contiguous block of cells
-            GGML_ASSERT(kv_self.head + cell_count <= kv_self.size);
+            // DEBUG CHECK: kv_self.head should be our first cell, the end of the last run our last cell (verify seq_id and pos values)
+            // Assume that this is one contiguous block of cells unless the cells were spread over several pages
+            const uint32_t cell_last = kv_self.runs.empty() ? kv_self.head + cell_count - 1 : kv_self.runs.back().cell + kv_self.runs.back().n - 1;
+            GGML_ASSERT(cell_last < kv_self.size);
             GGML_ASSERT(kv_self.cells[kv_self.head].pos == batch.pos[0]);
-            GGML_ASSERT(kv_self.cells[kv_self.head + cell_count - 1].pos == batch.pos[cell_count - 1]);
+            GGML_ASSERT(kv_self.cells[cell_last].pos == batch.pos[cell_count - 1]);
             GGML_ASSERT(kv_self.cells[kv_self.head].has_seq_id(dest_seq_id));
-            GGML_ASSERT(kv_self.cells[kv_self.head + cell_count - 1].has_seq_id(dest_seq_id));
+            GGML_ASSERT(kv_self.cells[cell_last].has_seq_id(dest_seq_id));
         } else {
             // whole KV cache restore
 
@@ -23173,6 +27295,7 @@ struct llama_data_read {
 
             kv_self.head = 0;
             kv_self.used = cell_count;
+            llama_kv_cache_pages_reset(kv_self);
         }
 
         if (kv_self.recurrent) {
@@ -23207,6 +27330,12 @@ struct llama_data_read {
             return false;
         }
 
+        // the cells restored by read_kv_cache_meta, one run unless they were spread over several pages
+        std::vector<llama_kv_run> runs = kv_self.runs;
+        if (runs.empty()) {
+            runs.push_back({ 0, kv_self.head, cell_count });
+        }
+
         // For each layer, read the keys for each cell, one row is one cell, read as one contiguous block
         for (uint32_t il = 0; il < n_layer; ++il) {
             const uint32_t n_embd_k_gqa = hparams.n_embd_k_gqa(il) + hparams.n_embd_k_s();
@@ -23231,7 +27360,10 @@ struct llama_data_read {
 
             if (cell_count) {
                 // Read and set the keys for the whole cell range
-                ggml_backend_tensor_set(kv_self.k_l[il], read(cell_count * k_size_row), kv_self.head * k_size_row, cell_count * k_size_row);
+                const uint8_t * src = read(cell_count * k_size_row);
+                for (const llama_kv_run & run : runs) {
+                    ggml_backend_tensor_set(kv_self.k_l[il], src + run.i_token * k_size_row, run.cell * k_size_row, run.n * k_size_row);
+                }
             }
         }
 
@@ -23259,7 +27391,10 @@ struct llama_data_read {
 
                 if (cell_count) {
                     // Read and set the values for the whole cell range
-                    ggml_backend_tensor_set(kv_self.v_l[il], read(cell_count * v_size_row), kv_self.head * v_size_row, cell_count * v_size_row);
+                    const uint8_t * src = read(cell_count * v_size_row);
+                    for (const llama_kv_run & run : runs) {
+                        ggml_backend_tensor_set(kv_self.v_l[il], src + run.i_token * v_size_row, run.cell * v_size_row, run.n * v_size_row);
+                    }
                 }
             }
         } else {
@@ -23296,8 +27431,11 @@ struct llama_data_read {
                 if (cell_count) {
                     // For each row in the transposed matrix, read the values for the whole cell range
                     for (uint32_t j = 0; j < n_embd_v_gqa; ++j) {
-                        const size_t dst_offset = (kv_self.head + j * kv_self.size) * v_size_el;
-                        ggml_backend_tensor_set(kv_self.v_l[il], read(cell_count * v_size_el), dst_offset, cell_count * v_size_el);
+                        const uint8_t * src = read(cell_count * v_size_el);
+                        for (const llama_kv_run & run : runs) {
+                            const size_t dst_offset = (run.cell + j * kv_self.size) * v_size_el;
+                            ggml_backend_tensor_set(kv_self.v_l[il], src + run.i_token * v_size_el, dst_offset, run.n * v_size_el);
+                        }
                     }
                 }
             }
@@ -23320,6 +27458,109 @@ struct llama_data_read {
             throw std::runtime_error("failed to restore kv cache");
         }
     }
+
+    // cells of layer il written by write_kv_layer, into the kv cache of this rank or, if given, into the replica of the layer
+    bool read_kv_layer(struct llama_context * ctx, uint32_t il, llama_kv_replica::layer * replica) {
+        struct llama_kv_cache & kv_self = ctx->kv_self;
+        const struct llama_hparams & hparams = ctx->model.hparams;
+        const auto & cparams = ctx->cparams;
+
+        ggml_tensor * k = nullptr;
+        ggml_tensor * v = nullptr;
+        if (replica == nullptr) {
+            const int32_t local_il = map_layer_to_local_id(il, cparams.n_world, cparams.rank, cparams.n_layer_window, cparams.n_layer_extra);
+            if (local_il < 0 || (size_t) local_il >= kv_self.k_l.size()) {
+                LLAMA_LOG_ERROR("%s: layer %u is not held by rank %u\n", __func__, il, cparams.rank);
+                return false;
+            }
+            k = kv_self.k_l[local_il];
+            v = kv_self.v_l[local_il];
+        }
+
+        // write to the tensor, or to the same offset of its copy in host memory
+        auto read_data = [&](ggml_tensor * tensor, std::vector<uint8_t> * host, size_t offset, size_t size) {
+            const uint8_t * src = read(size);
+            if (host != nullptr) {
+                std::memcpy(host->data() + offset, src, size);
+            } else {
+                ggml_backend_tensor_set(tensor, src, offset, size);
+            }
+        };
+
+        uint32_t n_range;
+        read_to(&n_range, sizeof(n_range));
+        std::vector<std::pair<uint32_t, uint32_t>> cell_ranges(n_range);
+        for (auto & range : cell_ranges) {
+            read_to(&range.first,  sizeof(range.first));
+            read_to(&range.second, sizeof(range.second));
+            if (range.first > range.second || range.second > kv_self.size) {
+                LLAMA_LOG_ERROR("%s: cells [%u, %u) out of a cache of %u cells\n", __func__, range.first, range.second, kv_self.size);
+                return false;
+            }
+        }
+
+        const uint32_t n_embd_k_gqa = hparams.n_embd_k_gqa(il) + hparams.n_embd_k_s();
+        const uint32_t n_embd_v_gqa = hparams.n_embd_v_gqa(il) + hparams.n_embd_v_s();
+
+        int32_t  k_type_i;
+        uint64_t k_size_row;
+        read_to(&k_type_i,   sizeof(k_type_i));
+        read_to(&k_size_row, sizeof(k_size_row));
+        if (k_type_i < 0 || k_type_i >= GGML_TYPE_COUNT || k_size_row != ggml_row_size((ggml_type) k_type_i, n_embd_k_gqa) ||
+            (k != nullptr && k->type != (ggml_type) k_type_i)) {
+            LLAMA_LOG_ERROR("%s: mismatched key type %d or row size %zu, layer %u\n", __func__, k_type_i, (size_t) k_size_row, il);
+            return false;
+        }
+        if (replica != nullptr) {
+            replica->type_k = (ggml_type) k_type_i;
+            replica->k.resize(k_size_row * kv_self.size);
+        }
+        for (const auto & range : cell_ranges) {
+            read_data(k, replica ? &replica->k : nullptr, range.first * k_size_row, (range.second - range.first) * k_size_row);
+        }
+
+        uint32_t v_trans;
+        int32_t  v_type_i;
+        read_to(&v_trans,  sizeof(v_trans));
+        read_to(&v_type_i, sizeof(v_type_i));
+        if (v_trans != (kv_self.v_trans ? 1u : 0u) || v_type_i < 0 || v_type_i >= GGML_TYPE_COUNT || (v != nullptr && v->type != (ggml_type) v_type_i)) {
+            LLAMA_LOG_ERROR("%s: mismatched value type %d or layout, layer %u\n", __func__, v_type_i, il);
+            return false;
+        }
+        if (!v_trans) {
+            uint64_t v_size_row;
+            read_to(&v_size_row, sizeof(v_size_row));
+            if (v_size_row != ggml_row_size((ggml_type) v_type_i, n_embd_v_gqa)) {
+                LLAMA_LOG_ERROR("%s: mismatched value row size (%zu), layer %u\n", __func__, (size_t) v_size_row, il);
+                return false;
+            }
+            if (replica != nullptr) {
+                replica->type_v = (ggml_type) v_type_i;
+                replica->v.resize(v_size_row * kv_self.size);
+            }
+            for (const auto & range : cell_ranges) {
+                read_data(v, replica ? &replica->v : nullptr, range.first * v_size_row, (range.second - range.first) * v_size_row);
+            }
+        } else {
+            uint32_t v_size_el, n_embd_v_gqa_ref;
+            read_to(&v_size_el,        sizeof(v_size_el));
+            read_to(&n_embd_v_gqa_ref, sizeof(n_embd_v_gqa_ref));
+            if (v_size_el != ggml_type_size((ggml_type) v_type_i) || n_embd_v_gqa_ref != n_embd_v_gqa) {
+                LLAMA_LOG_ERROR("%s: mismatched value element size (%u) or GQA embedding size (%u), layer %u\n", __func__, v_size_el, n_embd_v_gqa_ref, il);
+                return false;
+            }
+            if (replica != nullptr) {
+                replica->type_v = (ggml_type) v_type_i;
+                replica->v.resize((size_t) v_size_el * n_embd_v_gqa * kv_self.size);
+            }
+            for (uint32_t j = 0; j < n_embd_v_gqa; ++j) {
+                for (const auto & range : cell_ranges) {
+                    read_data(v, replica ? &replica->v : nullptr, (range.first + j * kv_self.size) * v_size_el, (range.second - range.first) * v_size_el);
+                }
+            }
+        }
+        return true;
+    }
 };
 
 struct llama_data_write_dummy : llama_data_write {
@@ -23445,6 +27686,436 @@ struct llama_data_read_file : llama_data_read {
     }
 };
 
+struct llama_data_write_vector : llama_data_write {
+    std::vector<uint8_t> & buf;
+
+    llama_data_write_vector(std::vector<uint8_t> & b) : buf(b) {}
+
+    void write(const void * src, size_t size) override {
+        const uint8_t * p = (const uint8_t *) src;
+        buf.insert(buf.end(), p, p + size);
+    }
+
+    void write_tensor_data(const struct ggml_tensor * tensor, size_t offset, size_t size) override {
+        const size_t n = buf.size();
+        buf.resize(n + size);
+        ggml_backend_tensor_get(tensor, buf.data() + n, offset, size);
+    }
+
+    size_t get_size_written() override {
+        return buf.size();
+    }
+};
+
+// the used cells of the kv cache as ranges, from inclusive, to exclusive
+static std::vector<std::pair<uint32_t, uint32_t>> llama_kv_cell_ranges(const llama_kv_cache & kv_self) {
+    std::vector<std::pair<uint32_t, uint32_t>> cell_ranges;
+    uint32_t cell_range_begin = kv_self.size;
+    for (uint32_t i = 0; i < kv_self.size; ++i) {
+        if (!kv_self.cells[i].is_empty()) {
+            if (cell_range_begin == kv_self.size) {
+                cell_range_begin = i;
+            }
+        } else if (cell_range_begin != kv_self.size) {
+            cell_ranges.emplace_back(cell_range_begin, i);
+            cell_range_begin = kv_self.size;
+        }
+    }
+    if (cell_range_begin != kv_self.size) {
+        cell_ranges.emplace_back(cell_range_begin, kv_self.size);
+    }
+    return cell_ranges;
+}
+
+// the used cells of layer il, from the kv cache of this rank or from a replica of the layer
+static bool llama_kv_layer_save(const llama_context & lctx, uint32_t il, const llama_kv_replica::layer * replica, std::vector<uint8_t> & out) {
+    out.clear();
+    try {
+        llama_data_write_vector data_ctx(out);
+        data_ctx.write_kv_layer(&lctx, il, replica, llama_kv_cell_ranges(lctx.kv_self));
+    } catch (const std::exception & err) {
+        LLAMA_LOG_ERROR("%s: failed to save the kv cache of layer %u: %s\n", __func__, il, err.what());
+        return false;
+    }
+    return true;
+}
+
+static bool llama_kv_layer_load(llama_context & lctx, uint32_t il, llama_kv_replica::layer * replica, const void * data, size_t size) {
+    try {
+        llama_data_read_buffer data_ctx((const uint8_t *) data, size);
+        return data_ctx.read_kv_layer(&lctx, il, replica);
+    } catch (const std::exception & err) {
+        LLAMA_LOG_ERROR("%s: failed to load the kv cache of layer %u: %s\n", __func__, il, err.what());
+        return false;
+    }
+}
+
+// the cells [head, head + n_cells) of the layers in the window that ends with layer il_last, as the next
+// device applies them to its replica
+static void llama_kv_replica_delta(const llama_context & lctx, uint32_t il_last, const std::vector<std::pair<uint32_t, uint32_t>> & cell_ranges, std::vector<uint8_t> & out) {
+    const auto & cparams = lctx.cparams;
+
+    const int32_t window = map_layer_to_window_id(il_last, cparams.n_world, cparams.rank, cparams.n_layer_window, cparams.n_layer_extra);
+    if (window < 0) {
+        return;
+    }
+
+    llama_data_write_vector data_ctx(out);
+    for (uint32_t il = 0; il <= il_last; ++il) {
+        if (map_layer_to_window_id(il, cparams.n_world, cparams.rank, cparams.n_layer_window, cparams.n_layer_extra) == window) {
+            data_ctx.write(&il, sizeof(il));
+            data_ctx.write_kv_layer(&lctx, il, nullptr, cell_ranges);
+        }
+    }
+}
+
+static void llama_kv_replica_apply(llama_context & lctx) {
+    auto & replica = lctx.kv_replica;
+    const uint32_t n_layer = lctx.model.hparams.n_layer;
+
+    std::vector<zmq::message_t> deltas;
+    {
+        std::lock_guard<std::mutex> lock(replica.mutex);
+        deltas.swap(replica.deltas);
+    }
+
+    for (auto & msg : deltas) {
+        try {
+            llama_data_read_buffer data_ctx(msg.data<uint8_t>(), msg.size());
+            while (data_ctx.get_size_read() < msg.size()) {
+                uint32_t il;
+                data_ctx.read_to(&il, sizeof(il));
+                if (il >= n_layer || !data_ctx.read_kv_layer(&lctx, il, &replica.layers[il])) {
+                    replica.valid = false;
+                    break;
+                }
+            }
+        } catch (const std::exception & err) {
+            LLAMA_LOG_WARN("%s: dropped kv cells of the previous rank: %s\n", __func__, err.what());
+            replica.valid = false;
+        }
+    }
+}
+
+static void llama_kv_replica_clear(llama_context & lctx) {
+    auto & replica = lctx.kv_replica;
+    {
+        std::lock_guard<std::mutex> lock(replica.mutex);
+        replica.deltas.clear();
+    }
+    replica.layers.clear();
+    replica.valid = true;
+}
+
+static void llama_kv_handoff_reset(llama_context & lctx) {
+    auto & handoff = lctx.kv_handoff;
+    handoff.src.clear();
+    handoff.dst.clear();
+    handoff.from_replica.clear();
+    handoff.saved.clear();
+    handoff.lost = false;
+}
+
+// take the cell metadata of the master, which the cells moved around refer to
+static bool llama_kv_handoff_adopt(llama_context & lctx, const meta_header * hdr, const zmq::message_t & cells) {
+    auto & kv_self = lctx.kv_self;
+    if ((uint32_t) hdr->args[4] != kv_self.size) {
+        LLAMA_LOG_ERROR("%s: the kv cache of the master has %d cells, this rank has %u\n", __func__, hdr->args[4], kv_self.size);
+        return false;
+    }
+
+    try {
+        llama_data_read_buffer data_ctx(cells.data<uint8_t>(), cells.size());
+        for (auto & cell : kv_self.cells) {
+            uint32_t n_seq_id;
+            data_ctx.read_to(&cell.pos,  sizeof(cell.pos));
+            data_ctx.read_to(&n_seq_id, sizeof(n_seq_id));
+
+            cell.delta = 0;
+            cell.seq_id.clear();
+            for (uint32_t j = 0; j < n_seq_id; ++j) {
+                llama_seq_id seq_id;
+                data_ctx.read_to(&seq_id, sizeof(seq_id));
+                cell.seq_id.insert(seq_id);
+            }
+        }
+    } catch (const std::exception & err) {
+        LLAMA_LOG_ERROR("%s: malformed cell metadata: %s\n", __func__, err.what());
+        return false;
+    }
+
+    kv_self.head = hdr->args[2];
+    kv_self.used = hdr->args[3];
+    llama_kv_cache_pages_reset(kv_self);
+    return true;
+}
+
+// load the layers addressed to this rank and drop them from parts, which are the cell metadata followed
+// by pairs of meta_kv_part and the cells of the layer
+static bool llama_kv_handoff_take(llama_context & lctx, std::vector<zmq::message_t> & parts) {
+    const uint32_t my_rank = lctx.cparams.rank;
+    const uint32_t n_layer = lctx.model.hparams.n_layer;
+
+    bool ok = true;
+    std::vector<zmq::message_t> rest;
+    rest.push_back(std::move(parts[0]));
+    for (size_t i = 1; i + 1 < parts.size(); i += 2) {
+        if (parts[i].size() != sizeof(meta_kv_part)) {
+            ok = false;
+            continue;
+        }
+        const meta_kv_part * part = parts[i].data<meta_kv_part>();
+        if (part->dst != my_rank) {
+            rest.push_back(std::move(parts[i]));
+            rest.push_back(std::move(parts[i + 1]));
+            continue;
+        }
+        if (part->il >= n_layer) {
+            ok = false;
+            continue;
+        }
+        llama_kv_replica::layer * replica = part->replica ? &lctx.kv_replica.layers[part->il] : nullptr;
+        ok = llama_kv_layer_load(lctx, part->il, replica, parts[i + 1].data(), parts[i + 1].size()) && ok;
+    }
+    parts.swap(rest);
+    return ok;
+}
+
+// add the layers this rank gives away in the first lap, or a copy of all its layers for the replica of the
+// next rank in the third. returns false if a layer it has to give away was lost
+static bool llama_kv_handoff_give(llama_context & lctx, int32_t lap, std::vector<zmq::message_t> & parts) {
+    auto & handoff = lctx.kv_handoff;
+    const auto & cparams = lctx.cparams;
+    const uint32_t my_rank = cparams.rank;
+    const uint32_t n_layer = lctx.model.hparams.n_layer;
+
+    // the cells of the last passes may still wait in the queue
+    if (lap == 1 && lctx.comm.replica != nullptr) {
+        llama_kv_replica_apply(lctx);
+    }
+
+    bool ok = true;
+    std::vector<uint8_t> cells;
+    for (uint32_t il = 0; il < n_layer; ++il) {
+        meta_kv_part part = {il, 0, 0, 0};
+        if (lap == 1) {
+            if (il >= handoff.src.size() || handoff.src[il] != (int32_t) my_rank) {
+                continue;
+            }
+            part.dst = handoff.dst[il];
+            if (handoff.from_replica[il]) {
+                const auto & replica = lctx.kv_replica;
+                const auto it = replica.layers.find(il);
+                if (!replica.valid || (it == replica.layers.end() && lctx.kv_self.used > 0)) {
+                    LLAMA_LOG_WARN("%s: the replica of layer %u is out of date\n", __func__, il);
+                    ok = false;
+                    continue;
+                }
+                if (it == replica.layers.end()) {
+                    continue; // nothing was evaluated yet
+                }
+                if (!llama_kv_layer_save(lctx, il, &it->second, cells)) {
+                    ok = false;
+                    continue;
+                }
+            } else {
+                const auto it = handoff.saved.find(il);
+                if (it == handoff.saved.end()) {
+                    ok = false;
+                    continue;
+                }
+                cells.swap(it->second);
+                handoff.saved.erase(it);
+            }
+            if (part.dst == my_rank) {
+                ok = llama_kv_layer_load(lctx, il, nullptr, cells.data(), cells.size()) && ok;
+                continue;
+            }
+        } else {
+            if (!this_layer_is_mine(il, cparams.n_world, my_rank, cparams.n_layer_window, cparams.n_layer_extra) ||
+                !llama_kv_layer_save(lctx, il, nullptr, cells)) {
+                continue;
+            }
+            part.dst     = (my_rank + 1) % cparams.n_world;
+            part.replica = 1;
+        }
+        parts.emplace_back(&part, sizeof(part));
+        parts.emplace_back(cells.data(), cells.size());
+    }
+    return ok;
+}
+
+// pass a META_CMD_KV_HANDOFF on, see llama_kv_handoff for the laps
+static void llama_kv_handoff_local(llama_context & lctx, const uint8_t * frame) {
+    auto & parts = lctx.meta_arena.handoff;
+
+    meta_header hdr;
+    std::memcpy(&hdr, frame, sizeof(hdr));
+    if (parts.empty()) {
+        LLAMA_LOG_ERROR("%s: kv cache handoff without cell metadata\n", __func__);
+        return;
+    }
+
+    const int32_t lap      = hdr.args[0];
+    bool          complete = hdr.args[1] != 0;
+
+    if (lap == 1) {
+        complete = llama_kv_handoff_adopt(lctx, &hdr, parts[0]) && complete;
+    }
+    if (lap == 3) {
+        llama_kv_replica_clear(lctx);
+    }
+    complete = llama_kv_handoff_take(lctx, parts) && complete;
+    if (lap == 1) {
+        complete = llama_kv_handoff_give(lctx, 1, parts) && !lctx.kv_handoff.lost && complete;
+    }
+    if (lap == 2) {
+        if (!complete) {
+            llama_kv_cache_clear(lctx.kv_self);
+        }
+        llama_kv_handoff_reset(lctx);
+    }
+    if (lap == 3 && lctx.comm.replica != nullptr) {
+        llama_kv_handoff_give(lctx, 3, parts);
+    }
+
+    hdr.args[1] = complete;
+
+    std::vector<zmq::message_t> msgs;
+    msgs.emplace_back(&hdr, sizeof(hdr));
+    for (auto & part : parts) {
+        msgs.push_back(std::move(part));
+    }
+    parts.clear();
+
+    if (lctx.comm.is_async()) {
+        lctx.comm.flush();
+    }
+    try {
+        zmq::send_multipart(*lctx.send_socket, msgs);
+    } catch (const zmq::error_t & e) {
+        LLAMA_LOG_WARN("%s: failed to pass the kv cache on: %s\n", __func__, e.what());
+    }
+}
+
+// send a META_CMD_KV_HANDOFF around the ring and wait until the last rank sends it back
+static bool llama_kv_handoff_lap(llama_context & lctx, meta_header & hdr, std::vector<zmq::message_t> & parts) {
+    auto & ring = lctx.ring;
+
+    std::vector<zmq::message_t> msgs;
+    msgs.emplace_back(&hdr, sizeof(hdr));
+    for (auto & part : parts) {
+        msgs.push_back(std::move(part));
+    }
+    parts.clear();
+
+    try {
+        zmq::send_multipart(*lctx.send_socket, msgs);
+    } catch (const zmq::error_t & e) {
+        LLAMA_LOG_ERROR("%s: failed to send the kv cache: %s\n", __func__, e.what());
+        return false;
+    }
+
+    if (ring.enabled()) {
+        lctx.recv_socket->set(zmq::sockopt::rcvtimeo, (int) ring.heartbeat_ms());
+    }
+    bool ok = false;
+    while (true) {
+        msgs.clear();
+        if (!zmq::recv_multipart(*lctx.recv_socket, std::back_inserter(msgs))) {
+            if (ring.enabled() && ring.failed_rank < 0) {
+                continue;
+            }
+            break;
+        }
+        // activations and acknowledgements of an older ring may still arrive
+        if (msgs.size() < 2 || msgs[0].size() != sizeof(meta_header)) {
+            continue;
+        }
+        const meta_header * ret = msgs[0].data<meta_header>();
+        if (ret->magic != META_MAGIC || ret->cmd != META_CMD_KV_HANDOFF || ret->args[0] != hdr.args[0]) {
+            continue;
+        }
+        hdr = *ret;
+        parts.assign(std::make_move_iterator(msgs.begin() + 1), std::make_move_iterator(msgs.end()));
+        ok = true;
+        break;
+    }
+    if (ring.enabled()) {
+        lctx.recv_socket->set(zmq::sockopt::rcvtimeo, -1);
+    }
+    return ok;
+}
+
+// move the kv cells of the layers that changed hands in llama_reshard_local, in laps of one META_CMD_KV_HANDOFF
+// around the ring. in the first lap each rank takes the master's cell metadata and the layers addressed to it,
+// and adds the layers it gives away; in the second the layers for ranks before their source arrive; with
+// kv_replicate, a third lap refreshes the replicas for the new split. returns 0 if the kv cache was kept,
+// 1 if a layer was lost and the cache was cleared on all ranks, -1 if the ring broke on the way
+static int llama_kv_handoff(llama_context & lctx) {
+    auto & cparams = lctx.cparams;
+    auto & kv_self = lctx.kv_self;
+
+    bool complete = !lctx.kv_handoff.lost;
+
+    if (lctx.send_socket == nullptr || cparams.n_world == 1) {
+        complete = complete && lctx.kv_handoff.saved.empty();
+        llama_kv_handoff_reset(lctx);
+        if (!complete) {
+            llama_kv_cache_clear(kv_self);
+        }
+        return complete ? 0 : 1;
+    }
+
+    const int64_t t_start_us = ggml_time_us();
+
+    std::vector<uint8_t> cells;
+    {
+        llama_data_write_vector data_ctx(cells);
+        data_ctx.write_kv_cache_meta(kv_self, {{0, kv_self.size}});
+    }
+
+    std::vector<uint8_t> buf;
+    meta_header hdr = *meta_init_header(buf, sizeof(meta_header), META_CMD_KV_HANDOFF);
+    hdr.args[2] = kv_self.head;
+    hdr.args[3] = kv_self.used;
+    hdr.args[4] = kv_self.size;
+
+    std::vector<zmq::message_t> parts;
+    parts.emplace_back(cells.data(), cells.size());
+    complete = llama_kv_handoff_give(lctx, 1, parts) && complete;
+
+    int ret = 0;
+    const int32_t n_lap = cparams.kv_replicate ? 3 : 2;
+    for (int32_t lap = 1; lap <= n_lap; ++lap) {
+        hdr.args[0] = lap;
+        hdr.args[1] = complete;
+        if (lap == 3) {
+            llama_kv_replica_clear(lctx);
+        }
+        if (!llama_kv_handoff_lap(lctx, hdr, parts)) {
+            ret = -1;
+            break;
+        }
+        complete = hdr.args[1] != 0 && llama_kv_handoff_take(lctx, parts) && complete;
+        if (lap == 2 && !complete) {
+            llama_kv_cache_clear(kv_self);
+        }
+    }
+
+    llama_kv_handoff_reset(lctx);
+    if (ret != 0) {
+        return ret;
+    }
+
+    if (complete) {
+        LLAMA_LOG_INFO("%s: the kv cache of %u cells moved with the layers in %.2f s\n", __func__, kv_self.used, 1e-6 * (ggml_time_us() - t_start_us));
+    } else {
+        LLAMA_LOG_WARN("%s: the kv cache of a moved layer was lost, it is cleared on all ranks\n", __func__);
+    }
+    return complete ? 0 : 1;
+}
+
 /** copy state data into either a buffer or file depending on the passed in context
  *
  * file context:
@@ -23739,10 +28410,12 @@ void llama_set_abort_callback(struct llama_context * ctx, bool (*abort_callback)
 
 void llama_set_embeddings(struct llama_context * ctx, bool embeddings) {
     ctx->cparams.embeddings = embeddings;
+    ctx->graph_cache.clear();
 }
 
 void llama_set_causal_attn(struct llama_context * ctx, bool causal_attn) {
     ctx->cparams.causal_attn = causal_attn;
+    ctx->graph_cache.clear();
 }
 
 struct llama_batch llama_batch_get_one(
@@ -24462,12 +29135,53 @@ struct llama_perf_context_data llama_perf_context(const struct llama_context * c
         return data;
     }
 
-    data.t_start_ms  = 1e-3 * ctx->t_start_us;
-    data.t_load_ms   = 1e-3 * ctx->t_load_us;
-    data.t_p_eval_ms = 1e-3 * ctx->t_p_eval_us;
-    data.t_eval_ms   = 1e-3 * ctx->t_eval_us;
-    data.n_p_eval    = std::max(1, ctx->n_p_eval);
-    data.n_eval      = std::max(1, ctx->n_eval);
+    data.t_start_ms     = 1e-3 * ctx->t_start_us;
+    data.t_load_ms      = 1e-3 * ctx->t_load_us;
+    data.t_p_eval_ms    = 1e-3 * ctx->t_p_eval_us;
+    data.t_eval_ms      = 1e-3 * ctx->t_eval_us;
+    data.t_comm_ms      = 1e-3 * ctx->comm.t_comm_us.load();
+    data.t_comm_wait_ms = 1e-3 * ctx->comm.t_comm_wait_us;
+    data.mb_released    = ctx->n_bytes_released  / (1024.0 * 1024.0);
+    data.mb_refaulted   = ctx->n_bytes_refaulted / (1024.0 * 1024.0);
+    data.n_p_eval       = std::max(1, ctx->n_p_eval);
+    data.n_eval         = std::max(1, ctx->n_eval);
+
+    int32_t n_active = 0;
+    for (int32_t i = 0; i < llama_perf_context_n_windows(ctx); ++i) {
+        const auto wdata = llama_perf_context_window(ctx, i);
+        if (wdata.n_runs == 0) {
+            continue;
+        }
+        data.resident_pct   += wdata.resident_pct;
+        data.t_compute_ms   += wdata.t_compute_ms;
+        data.t_prefetch_ms  += wdata.t_prefetch_ms;
+        data.n_major_faults += wdata.n_major_faults;
+        n_active++;
+    }
+    if (n_active > 0) {
+        data.resident_pct /= n_active;
+    }
+
+    return data;
+}
+
+int32_t llama_perf_context_n_windows(const struct llama_context * ctx) {
+    return ctx == nullptr ? 0 : (int32_t) ctx->win_perf.size();
+}
+
+struct llama_perf_window_data llama_perf_context_window(const struct llama_context * ctx, int32_t i) {
+    struct llama_perf_window_data data = {};
+
+    if (ctx == nullptr || i < 0 || i >= (int32_t) ctx->win_perf.size()) {
+        return data;
+    }
+
+    const auto & wperf = ctx->win_perf[i];
+    data.resident_pct   = wperf.n_runs > 0 ? wperf.resident_pct / wperf.n_runs : 0.0;
+    data.t_compute_ms   = 1e-3 * wperf.t_compute_us;
+    data.t_prefetch_ms  = 1e-3 * wperf.t_prefetch_us;
+    data.n_major_faults = wperf.n_maj_faults;
+    data.n_runs         = wperf.n_runs;
 
     return data;
 }
@@ -24483,6 +29197,35 @@ void llama_perf_context_print(const struct llama_context * ctx) {
     LLAMA_LOG_INFO("%s:        eval time = %10.2f ms / %5d runs   (%8.2f ms per token, %8.2f tokens per second)\n",
             __func__, data.t_eval_ms, data.n_eval, data.t_eval_ms / data.n_eval, 1e3 / data.t_eval_ms * data.n_eval);
     LLAMA_LOG_INFO("%s:       total time = %10.2f ms / %5d tokens\n", __func__, (t_end_ms - data.t_start_ms), (data.n_p_eval + data.n_eval));
+    if (ctx->cparams.n_world > 1) {
+        const double t_hidden_ms = std::max(0.0, data.t_comm_ms - data.t_comm_wait_ms);
+        LLAMA_LOG_INFO("%s:        comm time = %10.2f ms / %10.2f ms waited (%5.1f%% hidden behind compute)\n",
+                __func__, data.t_comm_ms, data.t_comm_wait_ms, data.t_comm_ms > 0.0 ? 100.0 * t_hidden_ms / data.t_comm_ms : 0.0);
+    }
+    if (ctx->model.stream) {
+        LLAMA_LOG_INFO("%s:   weight stream = %10.2f MiB read, %10.2f ms waited\n",
+                __func__, ctx->model.stream->n_bytes_read / (1024.0 * 1024.0), 1e-3 * ctx->model.stream->t_wait_us);
+    }
+    if (ctx->cparams.release_policy != LLAMA_RELEASE_POLICY_OFF) {
+        const int32_t n_tokens = data.n_p_eval + data.n_eval;
+        LLAMA_LOG_INFO("%s:     page release = %10.2f MiB released, %10.2f MiB re-faulted (%8.2f / %8.2f MiB per token)\n",
+                __func__, data.mb_released, data.mb_refaulted, data.mb_released / n_tokens, data.mb_refaulted / n_tokens);
+    }
+    if (llama_perf_context_n_windows(ctx) > 0) {
+        const bool residency = ctx->cparams.residency_stats;
+        LLAMA_LOG_INFO("%s:     window stats = %s%8" PRId64 " major faults, %10.2f ms compute, %10.2f ms prefetch\n",
+                __func__, residency ? format("%5.1f%% resident, ", data.resident_pct).c_str() : "",
+                data.n_major_faults, data.t_compute_ms, data.t_prefetch_ms);
+        for (int32_t i = 0; i < llama_perf_context_n_windows(ctx); ++i) {
+            const auto wdata = llama_perf_context_window(ctx, i);
+            if (wdata.n_runs == 0) {
+                continue;
+            }
+            LLAMA_LOG_INFO("%s:       window %3d = %s%8" PRId64 " major faults, %10.2f ms compute, %10.2f ms prefetch (%d runs)\n",
+                    __func__, i, residency ? format("%5.1f%% resident, ", wdata.resident_pct).c_str() : "",
+                    wdata.n_major_faults, wdata.t_compute_ms, wdata.t_prefetch_ms, wdata.n_runs);
+        }
+    }
 }
 
 void llama_perf_context_reset(struct llama_context * ctx) {
@@ -24490,6 +29233,14 @@ void llama_perf_context_reset(struct llama_context * ctx) {
     ctx->t_eval_us   = 0;
     ctx->n_eval      = -5; // set to -5 to ignore the first 5 evals due to preheat
     ctx->t_p_eval_us = ctx->n_p_eval = 0;
+
+    ctx->comm.t_comm_us      = 0;
+    ctx->comm.t_comm_wait_us = 0;
+
+    ctx->n_bytes_released  = 0;
+    ctx->n_bytes_refaulted = 0;
+
+    ctx->win_perf.clear();
 }
 
 void llama_perf_dump_yaml(FILE * stream, const llama_context * ctx) {
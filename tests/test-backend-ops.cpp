@@ -99,7 +99,7 @@ static void init_tensor_uniform(ggml_tensor * tensor, float min = -1.0f, float m
             };
 
             const size_t min_blocks_per_thread = 1;
-            const size_t n_threads = std::min<size_t>(std::thread::hardware_concurrency()/2,
+            const size_t n_threads = std::min<size_t>(std::max<size_t>(1, std::thread::hardware_concurrency()/2),
                                                       std::max<size_t>(1, n_blocks / min_blocks_per_thread));
             std::vector<std::future<void>> tasks;
             tasks.reserve(n_threads);
@@ -1349,6 +1349,93 @@ struct test_cpy : public test_case {
     }
 };
 
+// GGML_OP_CPY of a quantized tensor to F16/F32, checked against dequantize_row of the type
+struct test_cpy_dequant : public test_case {
+    const ggml_type type_src;
+    const ggml_type type_dst;
+    const std::array<int64_t, 4> ne;
+    const std::array<int64_t, 4> permute;
+
+    std::string op_desc(ggml_tensor * t) override {
+        return "CPY";
+        GGML_UNUSED(t);
+    }
+
+    std::string vars() override {
+        return VARS_TO_STR4(type_src, type_dst, ne, permute);
+    }
+
+    double max_nmse_err() override {
+        return 1e-6;
+    }
+
+    test_cpy_dequant(ggml_type type_src = GGML_TYPE_Q8_0, ggml_type type_dst = GGML_TYPE_F32,
+            std::array<int64_t, 4> ne = {256, 4, 4, 4},
+            std::array<int64_t, 4> permute = {0, 1, 2, 3})
+        : type_src(type_src), type_dst(type_dst), ne(ne), permute(permute) {}
+
+    // the copy, with NaNs in place of it if it differs from the dequantized rows of src
+    static void check(ggml_tensor * dst, const ggml_tensor * out, const ggml_tensor * src, int ith, int nth, void * userdata) {
+        GGML_ASSERT(ith == 0 && nth == 1);
+        test_cpy_dequant * test = (test_cpy_dequant *) userdata;
+
+        std::vector<float> ref(ggml_nelements(src));
+        const ggml_type_traits_t tt = ggml_internal_get_type_traits(src->type);
+        for (int64_t ir = 0; ir < ggml_nrows(src); ir++) {
+            tt.to_float((const char *) src->data + ir*src->nb[1], ref.data() + ir*src->ne[0], src->ne[0]);
+        }
+
+        // element i of the copy is element j of src with j[k] = i[permute[k]], see ggml_permute
+        const int64_t n_el = ggml_nelements(out);
+        std::vector<float> o(n_el), r(n_el);
+        int64_t i[4];
+        for (i[3] = 0; i[3] < out->ne[3]; i[3]++) {
+            for (i[2] = 0; i[2] < out->ne[2]; i[2]++) {
+                for (i[1] = 0; i[1] < out->ne[1]; i[1]++) {
+                    for (i[0] = 0; i[0] < out->ne[0]; i[0]++) {
+                        const int64_t io = ((i[3]*out->ne[2] + i[2])*out->ne[1] + i[1])*out->ne[0] + i[0];
+                        const int64_t * p = test->permute.data();
+                        const int64_t is = ((i[p[3]]*src->ne[2] + i[p[2]])*src->ne[1] + i[p[1]])*src->ne[0] + i[p[0]];
+                        o[io] = out->type == GGML_TYPE_F16 ? ggml_fp16_to_fp32(((const ggml_fp16_t *) out->data)[io]) : ((const float *) out->data)[io];
+                        r[io] = out->type == GGML_TYPE_F16 ? ggml_fp16_to_fp32(ggml_fp32_to_fp16(ref[is])) : ref[is];
+                    }
+                }
+            }
+        }
+
+        const double err = nmse(r.data(), o.data(), n_el);
+        const bool   ok  = err <= test->max_nmse_err(); // false for NaN too
+        if (!ok) {
+            printf("[cpy vs dequantize_row_%s] NMSE = %.9f > %.9f ", ggml_type_name(src->type), err, test->max_nmse_err());
+        }
+        for (int64_t k = 0; k < n_el; k++) {
+            const float v = ok ? o[k] : NAN;
+            if (dst->type == GGML_TYPE_F16) {
+                ((ggml_fp16_t *) dst->data)[k] = ggml_fp32_to_fp16(v);
+            } else {
+                ((float *) dst->data)[k] = v;
+            }
+        }
+    }
+
+    ggml_tensor * build_graph(ggml_context * ctx) override {
+        ggml_tensor * src = ggml_new_tensor(ctx, type_src, 4, ne.data());
+        ggml_set_name(src, "src");
+
+        ggml_tensor * src_p = ggml_permute(ctx, src, permute[0], permute[1], permute[2], permute[3]);
+        ggml_set_name(src_p, "src_permuted");
+
+        ggml_tensor * dst = ggml_new_tensor(ctx, type_dst, 4, src_p->ne);
+        ggml_set_name(dst, "dst");
+
+        ggml_tensor * out = ggml_cpy(ctx, src_p, dst);
+        out = ggml_map_custom2(ctx, out, src, check, 1, this);
+        ggml_set_name(out, "out");
+
+        return out;
+    }
+};
+
 // GGML_OP_CONT
 struct test_cont : public test_case {
     const ggml_type type;
@@ -1688,6 +1775,90 @@ struct test_mul_mat : public test_case {
     }
 };
 
+// GGML_OP_MUL_MAT with weights repacked into interleaved rows
+// no other backend has these types, so the product is checked in the graph against the one of the weights before repacking
+struct test_mul_mat_repack : public test_case {
+    const ggml_type type_a; // type before repacking
+    const int64_t m;
+    const int64_t n;
+    const int64_t k;
+    const std::array<int64_t, 2> nr; // repeat in dims 3 and 4 of b
+
+    ggml_tensor * a    = nullptr;
+    ggml_tensor * a_r4 = nullptr;
+
+    std::string op_desc(ggml_tensor * t) override {
+        return "MUL_MAT";
+        GGML_UNUSED(t);
+    }
+
+    std::string vars() override {
+        return VARS_TO_STR5(type_a, m, n, k, nr);
+    }
+
+    double max_nmse_err() override {
+        return 5e-4;
+    }
+
+    test_mul_mat_repack(ggml_type type_a = GGML_TYPE_Q4_K,
+            int64_t m = 32, int64_t n = 32, int64_t k = 256,
+            std::array<int64_t, 2> nr = {1, 1})
+        : type_a(type_a), m(m), n(n), k(k), nr(nr) {}
+
+    // the repacked product, with NaNs in place of it if it is too far from the reference
+    static void check(ggml_tensor * dst, const ggml_tensor * out, const ggml_tensor * ref, int ith, int nth, void * userdata) {
+        GGML_ASSERT(ith == 0 && nth == 1);
+        test_mul_mat_repack * test = (test_mul_mat_repack *) userdata;
+
+        const int64_t n_el = ggml_nelements(dst);
+        const float * o = (const float *) out->data;
+        const float * r = (const float *) ref->data;
+        float       * d = (float       *) dst->data;
+
+        const double err = nmse(r, o, n_el);
+        const bool   ok  = err <= test->max_nmse_err(); // false for NaN too
+        if (!ok) {
+            printf("[repacked vs %s] NMSE = %.9f > %.9f ", ggml_type_name(test->type_a), err, test->max_nmse_err());
+        }
+        for (int64_t i = 0; i < n_el; i++) {
+            d[i] = ok ? o[i] : NAN;
+        }
+    }
+
+    ggml_tensor * build_graph(ggml_context * ctx) override {
+        const ggml_type type_r4 = ggml_repack_type(type_a, m, k);
+        GGML_ASSERT(type_r4 != GGML_TYPE_COUNT);
+
+        // the gemv/gemm path only takes 2D weights, b is broadcast over them
+        a    = ggml_new_tensor_2d(ctx, type_a,  k, m);
+        a_r4 = ggml_new_tensor_2d(ctx, type_r4, k, m);
+        ggml_tensor * b = ggml_new_tensor_4d(ctx, GGML_TYPE_F32, k, n, nr[0], nr[1]);
+        ggml_set_name(a,    "a");
+        ggml_set_name(a_r4, "a_r4");
+        ggml_set_name(b,    "b");
+
+        ggml_tensor * ref = ggml_mul_mat(ctx, a,    b);
+        ggml_tensor * out = ggml_mul_mat(ctx, a_r4, b);
+        out = ggml_map_custom2(ctx, out, ref, check, 1, this);
+        ggml_set_name(out, "out");
+
+        return out;
+    }
+
+    void initialize_tensors(ggml_context * ctx) override {
+        for (ggml_tensor * t = ggml_get_first_tensor(ctx); t != NULL; t = ggml_get_next_tensor(ctx, t)) {
+            if (t != a_r4) {
+                init_tensor_uniform(t);
+            }
+        }
+
+        std::vector<uint8_t> data(ggml_nbytes(a));
+        ggml_backend_tensor_get(a, data.data(), 0, data.size());
+        ggml_repack(type_a, data.data(), m, k);
+        ggml_backend_tensor_set(a_r4, data.data(), 0, data.size());
+    }
+};
+
 // GGML_OP_MUL_MAT_ID
 struct test_mul_mat_id : public test_case {
     const ggml_type type_a;
@@ -3371,6 +3542,13 @@ static std::vector<std::unique_ptr<test_case>> make_test_cases_eval() {
             test_cases.emplace_back(new test_cpy(type_src, type_dst, {256, 2, 3, 4}, {1, 0, 2, 3})); // cpy not-contiguous
         }
     }
+    for (ggml_type type_src : {GGML_TYPE_Q8_0, GGML_TYPE_Q4_0, GGML_TYPE_Q4_1, GGML_TYPE_Q5_0, GGML_TYPE_Q5_1, GGML_TYPE_IQ4_NL}) {
+        for (ggml_type type_dst : {GGML_TYPE_F16, GGML_TYPE_F32}) {
+            test_cases.emplace_back(new test_cpy_dequant(type_src, type_dst, {256, 4, 4, 4}));
+            test_cases.emplace_back(new test_cpy_dequant(type_src, type_dst, {256, 2, 3, 4}, {0, 2, 1, 3})); // dequantize by rows
+            test_cases.emplace_back(new test_cpy_dequant(type_src, type_dst, {256, 2, 3, 4}, {1, 0, 2, 3})); // dequantize transposed, as the non-FA V cache
+        }
+    }
 
     test_cases.emplace_back(new test_cont());
     test_cases.emplace_back(new test_cont(GGML_TYPE_F32, {2, 1, 1 ,1}));
@@ -3486,6 +3664,27 @@ static std::vector<std::unique_ptr<test_case>> make_test_cases_eval() {
     }
 #endif
 
+    // row-interleaved weights, CPU only: gemv below 4 rows of b, gemm above, with a remainder, and broadcast over them
+    for (ggml_type type_a : {GGML_TYPE_Q4_K, GGML_TYPE_Q6_K}) {
+        for (int n = 1; n <= 8; ++n) {
+            test_cases.emplace_back(new test_mul_mat_repack(type_a, 16, n, 512, {1, 1}));
+        }
+        test_cases.emplace_back(new test_mul_mat_repack(type_a, 16, 35, 512, {1, 1}));
+        test_cases.emplace_back(new test_mul_mat_repack(type_a, 16,  1, 512, {2, 3}));
+        test_cases.emplace_back(new test_mul_mat_repack(type_a, 16,  7, 512, {3, 2}));
+        test_cases.emplace_back(new test_mul_mat_repack(type_a, 32, 35, 256, {2, 2}));
+    }
+
+    // the 4-row gemv of IQ1_S/IQ1_M only decodes, fewer than 4 rows of b, and the rows of a come in multiples of 4
+    for (ggml_type type_a : {GGML_TYPE_IQ1_S, GGML_TYPE_IQ1_M}) {
+        for (int n = 1; n <= 4; ++n) {
+            test_cases.emplace_back(new test_mul_mat(type_a, GGML_TYPE_F32, 16, n, 256, { 1,  1}, {1, 1}));
+            test_cases.emplace_back(new test_mul_mat(type_a, GGML_TYPE_F32, 18, n, 256, { 1,  1}, {1, 1}));
+        }
+        test_cases.emplace_back(new test_mul_mat(type_a, GGML_TYPE_F32, 16, 2, 512, { 1,  1}, {2, 3}));
+        test_cases.emplace_back(new test_mul_mat(type_a, GGML_TYPE_F32, 18, 2, 512, { 1,  1}, {2, 3}));
+    }
+
     test_cases.emplace_back(new test_mul_mat(GGML_TYPE_F16, GGML_TYPE_F32,  64, 2,  128, { 8,  1}, {1, 1}));
     test_cases.emplace_back(new test_mul_mat(GGML_TYPE_F16, GGML_TYPE_F32,  83, 2,  128, { 8,  1}, {4, 1}));
     test_cases.emplace_back(new test_mul_mat(GGML_TYPE_F16, GGML_TYPE_F32,  64, 2,   64, { 8,  1}, {4, 1}));
@@ -3708,6 +3907,13 @@ static std::vector<std::unique_ptr<test_case>> make_test_cases_perf() {
         }
     }
 
+    // row-interleaved weights, CPU only
+    for (int bs : {1, 4, 32, 512}) {
+        for (ggml_type type_a : {GGML_TYPE_Q4_K, GGML_TYPE_Q4_K_R4, GGML_TYPE_Q6_K, GGML_TYPE_Q6_K_R4}) {
+            test_cases.emplace_back(new test_mul_mat(type_a, GGML_TYPE_F32, 4096, bs, 14336, {1,  1}, {1, 1}));
+        }
+    }
+
     return test_cases;
 }
 
@@ -0,0 +1,99 @@
+// Round trip of ring activations through the wire types of --comm-type
+
+#include "../src/llama-comm.h"
+#include "ggml.h"
+
+#undef NDEBUG
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+// relative error of a single element, from the mantissa bits of the type
+constexpr float MAX_F16_ERROR  = 1.0f / 2048;
+constexpr float MAX_BF16_ERROR = 1.0f / 256;
+
+static const char * RESULT_STR[] = {"ok", "FAILED"};
+
+// activations of a hidden state: mostly small values with a few outliers
+static void generate_data(size_t n, float * dst) {
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = 0.1f + 2*cosf(i*0.37f) + (i % 97 == 0 ? 40.0f : 0.0f);
+    }
+}
+
+static bool test_round_trip(ggml_type type, const std::vector<float> & src, bool verbose) {
+    const int64_t n = src.size();
+
+    std::vector<uint8_t> wire(ggml_row_size(type, n));
+    std::vector<float>   dst(n);
+
+    const size_t n_bytes = llama_comm_encode(type, src.data(), n, wire.data());
+    llama_comm_decode(type, wire.data(), n, dst.data());
+
+    bool failed = n_bytes != wire.size();
+
+    const int64_t qk = ggml_blck_size(type);
+    for (int64_t ib = 0; ib < n / qk; ib++) {
+        // q8_0 rounds each element to a step of amax/127 of its block, the scale itself is f16
+        float amax = 0.0f;
+        for (int64_t i = ib*qk; i < (ib + 1)*qk; i++) {
+            amax = fmaxf(amax, fabsf(src[i]));
+        }
+
+        for (int64_t i = ib*qk; i < (ib + 1)*qk; i++) {
+            const float err = fabsf(dst[i] - src[i]);
+            float max_err = 0.0f;
+            switch (type) {
+                case GGML_TYPE_F32:  max_err = 0.0f;                                        break;
+                case GGML_TYPE_F16:  max_err = fabsf(src[i]) * MAX_F16_ERROR;               break;
+                case GGML_TYPE_BF16: max_err = fabsf(src[i]) * MAX_BF16_ERROR;              break;
+                case GGML_TYPE_Q8_0: max_err = amax / 127 * (0.5f + 127*MAX_F16_ERROR);     break;
+                default: assert(false);
+            }
+            if (err > max_err) {
+                if (verbose) {
+                    printf("%5s: element %5d: %f decoded as %f\n", ggml_type_name(type), (int) i, src[i], dst[i]);
+                }
+                failed = true;
+            }
+        }
+    }
+
+    printf("%5s round trip: %s\n", ggml_type_name(type), RESULT_STR[failed]);
+    return !failed;
+}
+
+int main(int argc, char * argv[]) {
+    bool verbose = false;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-v") {
+            verbose = true;
+        } else {
+            fprintf(stderr, "error: unknown argument: %s\n", arg.c_str());
+            return 1;
+        }
+    }
+
+    // fills the fp16 conversion tables
+    llama_backend_init();
+
+    // n_embd of a small model times a few tokens
+    std::vector<float> src(2048 * 3);
+    generate_data(src.size(), src.data());
+
+    int num_failed = 0;
+    for (ggml_type type : {GGML_TYPE_F32, GGML_TYPE_F16, GGML_TYPE_BF16, GGML_TYPE_Q8_0}) {
+        num_failed += !test_round_trip(type, src, verbose);
+    }
+
+    if (num_failed || verbose) {
+        printf("%d tests failed\n", num_failed);
+    }
+
+    llama_backend_free();
+
+    return num_failed > 0;
+}
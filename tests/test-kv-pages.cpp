@@ -0,0 +1,254 @@
+// Placement of tokens in the pages of the KV cache, see llama_kv_cache_page_next
+
+#include "llama.h"
+#include "common.h"
+#include "get-model.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+// cells per page, LLAMA_KV_PAGE_SIZE and LLAMA_KV_MAX_RUNS in llama.cpp
+constexpr int PAGE_SIZE = 16;
+constexpr int MAX_RUNS  = 32;
+
+static const char * RESULT_STR[] = {"ok", "FAILED"};
+
+// decode the tokens at positions [p0, p0 + n) of each of the sequences in one batch
+static int decode(llama_context * ctx, const std::vector<llama_seq_id> & seq_ids, llama_pos p0, int n) {
+    llama_batch batch = llama_batch_init(n * (int) seq_ids.size(), 0, 1);
+    for (const llama_seq_id seq_id : seq_ids) {
+        for (int i = 0; i < n; i++) {
+            llama_batch_add(batch, 0, p0 + i, { seq_id }, i == n - 1);
+        }
+    }
+    const int ret = llama_decode(ctx, batch);
+    llama_batch_free(batch);
+    return ret;
+}
+
+static int decode(llama_context * ctx, llama_seq_id seq_id, llama_pos p0, int n) {
+    return decode(ctx, std::vector<llama_seq_id>{ seq_id }, p0, n);
+}
+
+// the cell that holds the token at pos of seq_id, -1 if there is none
+static int cell_of(llama_context * ctx, llama_seq_id seq_id, llama_pos pos) {
+    const int n_seq_max = llama_n_seq_max(ctx);
+
+    llama_kv_cache_view view = llama_kv_cache_view_init(ctx, n_seq_max);
+    llama_kv_cache_view_update(ctx, &view);
+
+    int cell = -1;
+    for (int i = 0; i < view.n_cells && cell < 0; i++) {
+        if (view.cells[i].pos != pos) {
+            continue;
+        }
+        for (int j = 0; j < n_seq_max; j++) {
+            if (view.cells_sequences[i*n_seq_max + j] == seq_id) {
+                cell = i;
+                break;
+            }
+        }
+    }
+
+    llama_kv_cache_view_free(&view);
+    return cell;
+}
+
+#define CHECK(cond)                                                       \
+    do {                                                                  \
+        if (!(cond)) {                                                    \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __func__, __LINE__, #cond); \
+            return false;                                                 \
+        }                                                                 \
+    } while (0)
+
+// seq_cp lists the pages of the source in the table of the destination instead of copying the cells, and a
+// shared page only grows with tokens that are shared the same way
+static bool test_seq_cp_shares_pages(llama_context * ctx) {
+    llama_kv_cache_clear(ctx);
+
+    CHECK(decode(ctx, 0, 0, 20) == 0);
+    llama_kv_cache_seq_cp(ctx, 0, 1, -1, -1);
+    CHECK(llama_get_kv_cache_used_cells(ctx) == 20);
+    CHECK(cell_of(ctx, 1, 0) == 0 && cell_of(ctx, 1, 19) == 19);
+
+    // page 1 is shared, so each sequence opens a page of its own, the one after page 1 first
+    CHECK(decode(ctx, 1, 20, 1) == 0);
+    CHECK(cell_of(ctx, 1, 20) == 2*PAGE_SIZE);
+    CHECK(decode(ctx, 0, 20, 1) == 0);
+    CHECK(cell_of(ctx, 0, 20) == 3*PAGE_SIZE);
+    CHECK(llama_get_kv_cache_used_cells(ctx) == 22);
+
+    return true;
+}
+
+// a shared page stays with its other owners and is freed with the last one
+static bool test_free_shared_page(llama_context * ctx) {
+    llama_kv_cache_clear(ctx);
+
+    CHECK(decode(ctx, 0, 0, 20) == 0);
+    llama_kv_cache_seq_cp(ctx, 0, 1, -1, -1);
+
+    llama_kv_cache_seq_rm(ctx, 0, -1, -1);
+    CHECK(llama_get_kv_cache_used_cells(ctx) == 20);
+    CHECK(cell_of(ctx, 1, 0) == 0);
+
+    // pages 0 and 1 still belong to sequence 1
+    CHECK(decode(ctx, 2, 0, 1) == 0);
+    CHECK(cell_of(ctx, 2, 0) == 2*PAGE_SIZE);
+
+    llama_kv_cache_seq_rm(ctx, 1, -1, -1);
+    CHECK(llama_get_kv_cache_used_cells(ctx) == 1);
+
+    // the lowest free page is taken first
+    CHECK(decode(ctx, 3, 0, 1) == 0);
+    CHECK(cell_of(ctx, 3, 0) == 0);
+
+    return true;
+}
+
+// the block table lists the pages in the order of their tokens, so a sequence that took a freed lower page
+// keeps filling it after its pages were shared
+static bool test_table_order(llama_context * ctx) {
+    llama_kv_cache_clear(ctx);
+
+    CHECK(decode(ctx, 1, 0, PAGE_SIZE) == 0);
+    CHECK(decode(ctx, 0, 0, PAGE_SIZE) == 0);
+    CHECK(decode(ctx, 2, 0, PAGE_SIZE) == 0);
+    llama_kv_cache_seq_rm(ctx, 1, -1, -1);
+
+    // page 2 after the last page of sequence 0 is taken, so it continues in the freed page 0
+    CHECK(decode(ctx, 0, PAGE_SIZE, 4) == 0);
+    CHECK(cell_of(ctx, 0, PAGE_SIZE) == 0 && cell_of(ctx, 0, PAGE_SIZE + 3) == 3);
+
+    llama_kv_cache_seq_cp(ctx, 0, 3, -1, -1);
+    llama_kv_cache_seq_rm(ctx, 0, -1, -1);
+
+    CHECK(decode(ctx, 3, PAGE_SIZE + 4, 1) == 0);
+    CHECK(cell_of(ctx, 3, PAGE_SIZE + 4) == 4);
+
+    return true;
+}
+
+// a ubatch spread over more than MAX_RUNS runs of cells is split by llama_decode into parts that each fit
+static bool test_split_runs(llama_context * ctx) {
+    llama_kv_cache_clear(ctx);
+
+    // one token in a page of its own for each sequence, in two batches so that neither needs more runs
+    const int n_seq = MAX_RUNS + 1;
+    std::vector<llama_seq_id> seq_lo, seq_hi;
+    for (int s = 0; s < n_seq; s++) {
+        (s < n_seq/2 ? seq_lo : seq_hi).push_back(s);
+    }
+    CHECK(decode(ctx, seq_lo, 0, 1) == 0);
+    CHECK(decode(ctx, seq_hi, 0, 1) == 0);
+    CHECK(llama_get_kv_cache_used_cells(ctx) == n_seq);
+
+    // the second token of each sequence continues its page, one run per sequence
+    std::vector<llama_seq_id> seq_all = seq_lo;
+    seq_all.insert(seq_all.end(), seq_hi.begin(), seq_hi.end());
+    CHECK(decode(ctx, seq_all, 1, 1) == 0);
+    CHECK(llama_get_kv_cache_used_cells(ctx) == 2*n_seq);
+    for (int s = 0; s < n_seq; s++) {
+        CHECK(cell_of(ctx, s, 1) == s*PAGE_SIZE + 1);
+    }
+
+    // the logits of a split ubatch are the same as those of its parts decoded one after the other
+    const int n_vocab = llama_n_vocab(llama_get_model(ctx));
+    std::vector<float> logits_all;
+    for (int s = 0; s < n_seq; s++) {
+        const float * logits = llama_get_logits_ith(ctx, s);
+        logits_all.insert(logits_all.end(), logits, logits + n_vocab);
+    }
+
+    llama_kv_cache_seq_rm(ctx, -1, 1, -1);
+    CHECK(decode(ctx, seq_lo, 1, 1) == 0);
+    for (int s = 0; s < (int) seq_lo.size(); s++) {
+        const float * logits = llama_get_logits_ith(ctx, s);
+        for (int i = 0; i < n_vocab; i++) {
+            CHECK(fabsf(logits[i] - logits_all[s*n_vocab + i]) <= 1e-4f);
+        }
+    }
+
+    return true;
+}
+
+// the pages and block tables are rebuilt from the cells of a loaded state
+static bool test_state_load(llama_context * ctx) {
+    llama_kv_cache_clear(ctx);
+
+    // sequence 0 holds positions 0..15 in page 1 and 16..19 in page 0
+    CHECK(decode(ctx, 1, 0, PAGE_SIZE) == 0);
+    CHECK(decode(ctx, 0, 0, PAGE_SIZE) == 0);
+    CHECK(decode(ctx, 2, 0, PAGE_SIZE) == 0);
+    llama_kv_cache_seq_rm(ctx, 1, -1, -1);
+    CHECK(decode(ctx, 0, PAGE_SIZE, 4) == 0);
+    llama_kv_cache_seq_rm(ctx, 2, -1, -1);
+
+    std::vector<uint8_t> state(llama_state_get_size(ctx));
+    CHECK(llama_state_get_data(ctx, state.data(), state.size()) == state.size());
+
+    llama_kv_cache_clear(ctx);
+    CHECK(llama_state_set_data(ctx, state.data(), state.size()) == state.size());
+
+    // the state keeps the cells in the order of the cache but packs them, so positions 16..19 and 0..11
+    // fill page 0 and positions 12..15 start page 1
+    CHECK(llama_get_kv_cache_used_cells(ctx) == PAGE_SIZE + 4);
+    CHECK(cell_of(ctx, 0, PAGE_SIZE + 3) == 3 && cell_of(ctx, 0, PAGE_SIZE - 1) == PAGE_SIZE + 3);
+
+    // the newest token is in the full page 0, so the next one opens a page instead of joining the older
+    // tokens in page 1, and another sequence gets the lowest page that is left
+    CHECK(decode(ctx, 0, PAGE_SIZE + 4, 1) == 0);
+    CHECK(cell_of(ctx, 0, PAGE_SIZE + 4) == 2*PAGE_SIZE);
+    CHECK(decode(ctx, 1, 0, 1) == 0);
+    CHECK(cell_of(ctx, 1, 0) == 3*PAGE_SIZE);
+
+    return true;
+}
+
+int main(int argc, char ** argv) {
+    char * model_path = get_model_or_exit(argc, argv);
+
+    llama_backend_init();
+
+    gpt_params params;
+    params.model      = model_path;
+    params.n_ctx      = 64*PAGE_SIZE;
+    params.n_batch    = 64*PAGE_SIZE;
+    params.n_parallel = 64;
+    params.warmup     = false;
+    postprocess_cpu_params(params.cpuparams, nullptr);
+    postprocess_cpu_params(params.cpuparams_batch, &params.cpuparams);
+
+    llama_init_result llama_init = llama_init_from_gpt_params(params);
+    llama_model   * model = llama_init.model;
+    llama_context * ctx   = llama_init.context;
+    if (model == nullptr || ctx == nullptr) {
+        fprintf(stderr, "failed to load '%s'\n", model_path);
+        return 1;
+    }
+
+    int num_failed = 0;
+    auto run = [&](const char * name, bool (*test)(llama_context *)) {
+        const bool ok = test(ctx);
+        printf("%-24s: %s\n", name, RESULT_STR[!ok]);
+        num_failed += !ok;
+    };
+    run("seq_cp shares pages",   test_seq_cp_shares_pages);
+    run("free shared page",      test_free_shared_page);
+    run("block table order",     test_table_order);
+    run("split runs",            test_split_runs);
+    run("state load",            test_state_load);
+
+    if (num_failed) {
+        printf("%d tests failed\n", num_failed);
+    }
+
+    llama_free(ctx);
+    llama_free_model(model);
+    llama_backend_free();
+
+    return num_failed > 0;
+}
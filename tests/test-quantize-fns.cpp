@@ -22,6 +22,10 @@ constexpr float MAX_QUANTIZATION_TOTAL_ERROR_3BITS_XXS = 0.0050f;
 constexpr float MAX_DOT_PRODUCT_ERROR = 0.02f;
 constexpr float MAX_DOT_PRODUCT_ERROR_LOWBIT = 0.04f;
 constexpr float MAX_DOT_PRODUCT_ERROR_TERNARY = 0.15f;
+constexpr float MAX_GEMV_ERROR = 1e-5f;
+
+// values in a row of the gemv tests
+constexpr int GEMV_ROW_SIZE = 512;
 
 static const char* RESULT_STR[] = {"ok", "FAILED"};
 
@@ -96,6 +100,38 @@ static float dot_product_error(
     return fabsf(result - dot_ref) / test_size;
 }
 
+// Largest difference between the gemv of the rows of test_data1 with test_data2 and vec_dot per row
+static float gemv_error(
+    ggml_type type, ggml_type_traits_t & qfns, size_t test_size, const float * test_data1, const float * test_data2
+) {
+    const int64_t nrows = test_size / GEMV_ROW_SIZE;
+    GGML_ASSERT(nrows % qfns.ncols == 0);
+
+    std::vector<uint8_t> tmp_q1(ggml_row_size(type, test_size));
+    std::vector<uint8_t> tmp_q2(ggml_row_size(qfns.vec_dot_type, GEMV_ROW_SIZE));
+    std::vector<float>   imatrix(GEMV_ROW_SIZE, 1.0f);
+
+    // the types with a gemv may need an importance matrix to quantize
+    ggml_quantize_chunk(type, test_data1, tmp_q1.data(), 0, nrows, GEMV_ROW_SIZE, imatrix.data());
+    ggml_internal_get_type_traits(qfns.vec_dot_type).from_float(test_data2, tmp_q2.data(), GEMV_ROW_SIZE);
+
+    std::vector<float> result(nrows, INFINITY);
+    qfns.gemv(GEMV_ROW_SIZE, result.data(), nrows, tmp_q1.data(), tmp_q2.data(), 1, nrows);
+
+    const size_t row_size = ggml_row_size(type, GEMV_ROW_SIZE);
+    float max_error = 0.0f;
+    for (int64_t ir = 0; ir < nrows; ir++) {
+        float result_ref = INFINITY;
+        qfns.vec_dot(GEMV_ROW_SIZE, &result_ref, 0, tmp_q1.data() + ir*row_size, 0, tmp_q2.data(), 0, 1);
+        // a row the gemv left out stays INFINITY and fails
+        const float err = fabsf(result[ir] - result_ref) / GEMV_ROW_SIZE;
+        if (!(err <= max_error)) {
+            max_error = isnan(err) ? INFINITY : err;
+        }
+    }
+    return max_error;
+}
+
 int main(int argc, char * argv[]) {
     bool verbose = false;
     const size_t test_size = 32 * 128;
@@ -179,6 +215,16 @@ int main(int argc, char * argv[]) {
                 printf("%5s dot product error:              %s (%f)\n", ggml_type_name(type), RESULT_STR[failed], vec_dot_error);
             }
         }
+
+        // the gemv of several rows at once has to match vec_dot per row, repacked types have no vec_dot to compare to
+        if (qfns.gemv && qfns.vec_dot) {
+            const float gemv_err = gemv_error(type, qfns, test_size, test_data.data(), test_data2.data());
+            failed = !(gemv_err < MAX_GEMV_ERROR);
+            num_failed += failed;
+            if (failed || verbose) {
+                printf("%5s gemv error:                     %s (%f)\n", ggml_type_name(type), RESULT_STR[failed], gemv_err);
+            }
+        }
     }
 
     if (num_failed || verbose) {
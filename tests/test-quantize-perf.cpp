@@ -28,6 +28,8 @@
 #define L3_SIZE    32*20480
 #define MEM_SIZE 32*2048000
 
+#define GEMV_ROW_SIZE 1024
+
 struct quantize_perf_params {
     std::vector<std::string> include_types;
     std::vector<size_t> test_sizes;
@@ -37,6 +39,7 @@ struct quantize_perf_params {
     bool op_dequantize_row_q = false;
     bool op_quantize_row_q_dot = false;
     bool op_vec_dot_q = false;
+    bool op_gemv_q = false;
     int64_t iterations = ITERATIONS;
 };
 
@@ -118,13 +121,13 @@ static void usage(char * argv[]) {
     printf("  -3                    use size as L1, L2, L3 sizes (L1:%d L2:%d L3:%d)\n", L1_SIZE, L2_SIZE, L3_SIZE);
     printf("  -4                    use size as L1, L2, L3, MEM sizes (L1:%d L2:%d L3:%d MEM:%d)\n", L1_SIZE, L2_SIZE, L3_SIZE, MEM_SIZE);
     printf("  --op OP               set test operation as quantize_row_q_reference, quantize_row_q, dequantize_row_q,\n");
-    printf("                        quantize_row_q_dot, vec_dot_q (all)\n");
+    printf("                        quantize_row_q_dot, vec_dot_q, gemv_q (all)\n");
     printf("  --type TYPE           set test type as");
     for (int i = 0; i < GGML_TYPE_COUNT; i++) {
         ggml_type type = (ggml_type) i;
         ggml_type_traits_t qfns = ggml_internal_get_type_traits(type);
         if (ggml_type_name(type) != NULL) {
-            if (qfns.from_float && qfns.to_float) {
+            if ((qfns.from_float && qfns.to_float) || qfns.gemv) {
                 printf(" %s", ggml_type_name(type));
             }
         }
@@ -185,6 +188,8 @@ int main(int argc, char * argv[]) {
                 params.op_quantize_row_q_dot = true;
             } else if (op == "vec_dot_q") {
                 params.op_vec_dot_q = true;
+            } else if (op == "gemv_q") {
+                params.op_gemv_q = true;
             } else {
                 invalid_param = true;
                 break;
@@ -235,8 +240,8 @@ int main(int argc, char * argv[]) {
     if (params.test_sizes.empty()) {
         params.test_sizes.push_back(L1_SIZE);
     }
-    if (!(params.op_quantize_row_q_reference || params.op_quantize_row_q || params.op_dequantize_row_q || params.op_quantize_row_q_dot || params.op_vec_dot_q)) {
-        params.op_quantize_row_q_reference = params.op_quantize_row_q = params.op_dequantize_row_q = params.op_quantize_row_q_dot = params.op_vec_dot_q = true;
+    if (!(params.op_quantize_row_q_reference || params.op_quantize_row_q || params.op_dequantize_row_q || params.op_quantize_row_q_dot || params.op_vec_dot_q || params.op_gemv_q)) {
+        params.op_quantize_row_q_reference = params.op_quantize_row_q = params.op_dequantize_row_q = params.op_quantize_row_q_dot = params.op_vec_dot_q = params.op_gemv_q = true;
     }
 
     std::sort(params.test_sizes.begin(), params.test_sizes.end());
@@ -355,6 +360,48 @@ int main(int argc, char * argv[]) {
                 printf("\n");
             }
         }
+
+        if (params.op_gemv_q && qfns.gemv) {
+            if (!(qfns.from_float && qfns.to_float)) {
+                printf("%s\n", ggml_type_name(type));
+
+                ggml_quantize_init(type);
+            }
+
+            // rows of GEMV_ROW_SIZE values against one row of activations, as in decoding
+            printf("  gemv_q\n");
+            std::vector<float> imatrix(GEMV_ROW_SIZE, 1.0f);
+            ggml_internal_get_type_traits(qfns.vec_dot_type).from_float(test_data2, test_q2, GEMV_ROW_SIZE);
+            for (size_t size : params.test_sizes) {
+                const int64_t nrows = size / GEMV_ROW_SIZE;
+                if (size % GEMV_ROW_SIZE != 0 || nrows % qfns.ncols != 0) {
+                    printf("    %zu values: skipped, not a multiple of %" PRId64 " rows of %d values\n", size, qfns.ncols, GEMV_ROW_SIZE);
+                    continue;
+                }
+                ggml_quantize_chunk(type, test_data1, test_q1, 0, nrows, GEMV_ROW_SIZE, imatrix.data());
+                size_t quantized_size = ggml_row_size(type, size);
+
+                printf("    %zu values (%.2f MB)\n", size, 4*size/(float)(1024*1024));
+                auto gemv_fn = [&](void) -> float {
+                    qfns.gemv(GEMV_ROW_SIZE, test_out, nrows, test_q1, test_q2, 1, nrows);
+                    return test_out[0];
+                };
+                benchmark_function(size, quantized_size, iterations, gemv_fn);
+
+                if (qfns.vec_dot) {
+                    printf("    %zu values (%.2f MB), vec_dot per row\n", size, 4*size/(float)(1024*1024));
+                    const size_t row_size = ggml_row_size(type, GEMV_ROW_SIZE);
+                    auto vec_dot_fn = [&](void) -> float {
+                        for (int64_t ir = 0; ir < nrows; ir++) {
+                            qfns.vec_dot(GEMV_ROW_SIZE, test_out + ir, 0, (const char *) test_q1 + ir*row_size, 0, test_q2, 0, 1);
+                        }
+                        return test_out[0];
+                    };
+                    benchmark_function(size, quantized_size, iterations, vec_dot_fn);
+                }
+            }
+            printf("\n");
+        }
     }
 
     ggml_free(ctx);
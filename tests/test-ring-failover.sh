@@ -0,0 +1,91 @@
+#!/bin/bash
+#
+# Kill a device of a three device ring on localhost in the middle of generation and check that the master
+# drops it from the ring and still finishes the answer. The ranks bind data_port + rank and
+# signal_port + rank, so they can share one host.
+#
+# usage: ./tests/test-ring-failover.sh [model.gguf] [layer windows, default 1,1,1] [bin dir, default ./build/bin]
+#
+# the model defaults to LLAMACPP_TEST_MODELFILE as for the other model tests, which is how ctest runs it.
+# the layer windows must tile the layers of the model, e.g. 8,8,8 for a model with 24 layers
+#
+
+set -u
+
+MODEL=${1:-${LLAMACPP_TEST_MODELFILE:-}}
+WINDOWS=${2:-1,1,1}
+BIN_DIR=${3:-./build/bin}
+
+if [ -z "$MODEL" ]; then
+    echo "WARNING: No model file provided. Skipping this test. Set LLAMACPP_TEST_MODELFILE=<gguf_model_path> to run it."
+    exit 0
+fi
+
+N_PREDICT=256
+FAIL_TIMEOUT=2
+KILL_AFTER_BYTES=64 # of generated text, so that the failure happens in the middle of a pass
+DEADLINE=300        # seconds for the whole run
+
+LOG_DIR=$(mktemp -d)
+PIDS=()
+
+cleanup() {
+    for pid in "${PIDS[@]}"; do
+        kill -9 "$pid" 2>/dev/null
+    done
+    wait 2>/dev/null
+}
+trap cleanup EXIT
+
+fail() {
+    echo "FAILED: $1"
+    for f in "$LOG_DIR"/*.log; do
+        echo "-------- $f --------"
+        tail -n 30 "$f"
+    done
+    exit 1
+}
+
+common_args=(
+    -m "$MODEL" --world 3 --master 127.0.0.1 --next 127.0.0.1
+    --data-port 19000 --signal-port 20000 --tp-port 21000
+    --fail-timeout "$FAIL_TIMEOUT" --kv-replicate
+)
+
+for rank in 2 1; do
+    "$BIN_DIR/llama-cli" "${common_args[@]}" --rank "$rank" > "$LOG_DIR/rank$rank.out" 2> "$LOG_DIR/rank$rank.log" &
+    PIDS+=($!)
+done
+PID_VICTIM=${PIDS[1]}
+PID_SURVIVOR=${PIDS[0]}
+
+"$BIN_DIR/llama-cli" "${common_args[@]}" --rank 0 -lw "$WINDOWS" -c 1024 -n "$N_PREDICT" --ignore-eos --temp 0 \
+    -p "Write a long story about a lighthouse keeper." > "$LOG_DIR/rank0.out" 2> "$LOG_DIR/rank0.log" &
+PID_MASTER=$!
+PIDS+=($PID_MASTER)
+
+# wait until the ring is generating, then take a device down without letting it say goodbye
+t_start=$SECONDS
+while [ "$(wc -c < "$LOG_DIR/rank0.out")" -lt "$KILL_AFTER_BYTES" ]; do
+    kill -0 "$PID_MASTER" 2>/dev/null || fail "the master exited before generating"
+    [ $((SECONDS - t_start)) -lt "$DEADLINE" ] || fail "no output within $DEADLINE seconds"
+    sleep 0.2
+done
+kill -9 "$PID_VICTIM"
+echo "killed rank 1 after $(wc -c < "$LOG_DIR/rank0.out") bytes of output"
+
+while kill -0 "$PID_MASTER" 2>/dev/null; do
+    [ $((SECONDS - t_start)) -lt "$DEADLINE" ] || fail "the master did not finish within $DEADLINE seconds"
+    sleep 0.5
+done
+wait "$PID_MASTER"
+status=$?
+
+[ "$status" -eq 0 ]                                               || fail "the master exited with status $status"
+grep -q "rank 1 failed, continuing" "$LOG_DIR/rank0.log"          || fail "the master did not rebuild the ring"
+if ! kill -0 "$PID_SURVIVOR" 2>/dev/null; then
+    wait "$PID_SURVIVOR" || fail "rank 2 died with the ring"
+fi
+
+echo "OK: the ring continued without rank 1, $(wc -c < "$LOG_DIR/rank0.out") bytes of output"
+rm -rf "$LOG_DIR"
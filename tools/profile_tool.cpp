@@ -54,7 +54,7 @@ int main(int argc, char ** argv) {
     llama_model_loader * ml = llama_model_load(params.model.c_str(), model, &mparams);
 
     device_info dev_info;
-    llama_profile_device(&dev_info, model, ml, params.gpu_mem, params.n_predict, params.n_ctx, params.cpuparams.n_threads, params.flash_attn);
+    llama_profile_device(&dev_info, model, ml, params.gpu_mem, params.n_predict, params.n_ctx, params.cpuparams.n_threads, params.flash_attn, nullptr);
     device_print_props(&dev_info, 1, model, cparams);
 
     llama_free_model(model);